@@ -0,0 +1,799 @@
+/*
+ * core_bench.c — saros.h micro-benchmarks, results as JSON
+ *
+ *   core_bench [--quick] [--samples N] [--cpu-mhz F] [--out results.json] [catalog.sdb ...]
+ *
+ * Every catalog is measured with the same kernels:
+ *
+ *   find_next / find_past        find_*_eclipse
+ *   saros_window                 find_*_saros_window
+ *   octal_phase / octal_phase_ms calculate_*_octal_phase(_ms), resolution 2
+ *   average_bin                  get_average_bin (built-in solar only; it
+ *                                does not read a catalog)
+ *
+ * over two timestamp patterns spread across the catalog's span:
+ *
+ *   random       uniform timestamps, a fresh search path every call
+ *   sequential   ascending timestamps, neighbouring calls share a path
+ *
+ * and two cache states:
+ *
+ *   warm   the same sample set replayed back to back.  latency_ns feeds
+ *          each result into the next timestamp, so calls cannot overlap;
+ *          throughput_mops runs them independently.
+ *   cold   a buffer larger than the last-level cache is swept before each
+ *          call; latency_ns is the median of single timed calls, less the
+ *          timer's own overhead.
+ *
+ * The built-in catalogs are the ones the library was compiled with
+ * (modern or SAROS_USE_ALL, raw or SAROS_USE_COMPACT — see "build" in the
+ * output); in raw builds they are also measured through saros_db.h.  Any
+ * other catalog, e.g. the full Saros 1-180 set, is passed as a
+ * build_saros_file.py file and measured through saros_db.h.
+ * first_call_ns is the very first lookup of the process, which includes
+ * building the hosted search caches.
+ *
+ * Every result also has "cycles", its latency_ns converted to CPU cycles.
+ * On x86 the conversion factor is the TSC rate, measured against the
+ * monotonic clock at start-up (the TSC ticks at the nominal frequency,
+ * so turbo clocks count a little low).  Elsewhere pass --cpu-mhz with the
+ * core clock; without it "cycles" is 0 and config.cycle_counter "none".
+ *
+ * Compare raw and compact data by configuring core with and without
+ * -DSAROS_USE_COMPACT=ON and diffing the two outputs.
+ *
+ * "footprint" gives the flash bytes of the built-in solar and lunar tables
+ * in both formats, whichever one this build uses (footprint.h): raw
+ * times / info arrays against the compact blocks, block index and packed
+ * info, plus the series records both share.  Together with the latencies
+ * of a raw and a compact build this is the size/speed trade-off of
+ * SAROS_USE_COMPACT.
+ *
+ * "ephemerides" times the Ephemeris.h lookups on the built-in new moon,
+ * apogee and ascending node tables, warm only, with the same patterns:
+ *
+ *   bisect                 the plain binary search find_closest used to be
+ *   find_closest           interpolated guess + gallop
+ *   cursor_seek            fractonica_cursor_seek, one cursor per run
+ *   fraction_at            fractonica_ephemeris_fraction_at, no window
+ *   fraction_at_cursor     fractonica_ephemeris_fraction_at_cursor
+ *   fractions_sorted       fractonica_ephemeris_fractions_sorted over the
+ *                          whole sample set, sequential only (it needs
+ *                          sorted input); latency_ns is its time per sample
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "saros.h"
+#include "saros_db.h"
+#include "saros_file.h"
+#include "Ephemeris.h"
+#include "new_moon.h"
+#include "apogee.h"
+#include "nodal_ascending.h"
+#include "footprint.h"
+
+#ifdef _WIN32
+#  include <windows.h>
+#  include <intrin.h>
+#else
+#  include <time.h>
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#  include <x86intrin.h>
+#endif
+
+#define BENCH_SAMPLES_DEFAULT 65536u
+#define BENCH_SAMPLES_QUICK   4096u
+#define BENCH_REPEATS         5u
+#define BENCH_COLD_CALLS      256u
+#define BENCH_COLD_QUICK      32u
+#define BENCH_EVICT_BYTES     (64u << 20)
+#define BENCH_MAX_FILES       8
+#define BENCH_SEED            0x5A205A205A205A20ull
+
+/* ── Timing ─────────────────────────────────────────────────────────────── */
+
+static uint64_t now_ns(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER        t;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (uint64_t)((double)t.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+#endif
+}
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  define BENCH_CYCLE_COUNTER "rdtsc"
+static uint64_t now_cycles(void)
+{
+    return (uint64_t)__rdtsc();
+}
+
+/* TSC ticks per nanosecond, over ~20 ms of the monotonic clock. */
+static double measure_cycles_per_ns(void)
+{
+    const uint64_t n0 = now_ns(), c0 = now_cycles();
+    uint64_t       n1;
+    do
+        n1 = now_ns();
+    while (n1 - n0 < 20000000u);
+    return (double)(now_cycles() - c0) / (double)(n1 - n0);
+}
+#else
+#  define BENCH_CYCLE_COUNTER "none"
+static double measure_cycles_per_ns(void)
+{
+    return 0.0;
+}
+#endif
+
+/* latency_ns -> cycles; set in main(), 0 if unknown. */
+static double g_cycles_per_ns;
+
+static int cmp_double(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double *v, size_t n)
+{
+    qsort(v, n, sizeof(double), cmp_double);
+    return (n & 1u) ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+static uint64_t xorshift(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+/* Results are folded into this so no call is optimised away. */
+static volatile uint64_t g_sink;
+
+/* ── Catalogs and kernels ───────────────────────────────────────────────── */
+
+typedef struct {
+    char              name[96];
+    const char       *source;      /* "builtin", "builtin-db" or "file" */
+    int               is_lunar;
+    const saros_db_t *db;          /* NULL: the saros.h find_* API */
+    int64_t           first, last; /* first and last eclipse */
+    uint8_t           saros_min, saros_max;
+} bench_catalog_t;
+
+typedef uint64_t (*bench_kernel_t)(const bench_catalog_t *c, int64_t ts, uint8_t saros);
+
+static uint8_t saros_of(const bench_catalog_t *c, const eclipse_entry_t *e)
+{
+    return c->is_lunar ? e->info.lunar.saros_number : e->info.solar.saros_number;
+}
+
+static eclipse_result_t find_next(const bench_catalog_t *c, int64_t ts);
+
+static uint64_t k_find_next(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    (void)saros;
+    return (uint64_t)find_next(c, ts).eclipse.unix_time;
+}
+
+static uint64_t k_find_past(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    eclipse_result_t r;
+    (void)saros;
+    if (c->db)
+        r = saros_db_find_past(c->db, ts);
+    else
+        r = c->is_lunar ? find_past_lunar_eclipse(ts) : find_past_solar_eclipse(ts);
+    return (uint64_t)r.eclipse.unix_time;
+}
+
+static uint64_t k_saros_window(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    saros_window_t w;
+    if (c->db)
+        w = saros_db_saros_window(c->db, ts, saros);
+    else
+        w = c->is_lunar ? find_lunar_saros_window(ts, saros) : find_solar_saros_window(ts, saros);
+    return (uint64_t)(w.past.unix_time ^ w.future.unix_time);
+}
+
+static uint64_t k_octal_phase(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    if (c->db)
+        return saros_db_octal_phase(c->db, ts, saros, 2, 1);
+    return c->is_lunar ? calculate_lunar_octal_phase(ts, saros, 2)
+                       : calculate_solar_octal_phase(ts, saros, 2);
+}
+
+static uint64_t k_octal_phase_ms(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    const int64_t ms = ts * 1000 + (ts & 511);
+    if (c->db)
+        return saros_db_octal_phase(c->db, ms, saros, 2, 1000);
+    return c->is_lunar ? calculate_lunar_octal_phase_ms(ms, saros, 2)
+                       : calculate_solar_octal_phase_ms(ms, saros, 2);
+}
+
+static uint64_t k_average_bin(const bench_catalog_t *c, int64_t ts, uint8_t saros)
+{
+    (void)c;
+    (void)saros;
+    /* A birthday 80 years back, as in the desktop app's average clock. */
+    return get_average_bin(ts, ts - 2524608000LL, 1, 2);
+}
+
+typedef struct {
+    const char     *name;
+    bench_kernel_t  run;
+    int             builtin_solar_only;
+} bench_case_t;
+
+static const bench_case_t k_cases[] = {
+    { "find_next",      k_find_next,      0 },
+    { "find_past",      k_find_past,      0 },
+    { "saros_window",   k_saros_window,   0 },
+    { "octal_phase",    k_octal_phase,    0 },
+    { "octal_phase_ms", k_octal_phase_ms, 0 },
+    { "average_bin",    k_average_bin,    1 },
+};
+
+/* ── Measurement ────────────────────────────────────────────────────────── */
+
+typedef struct {
+    size_t   samples;
+    unsigned cold_calls;
+    int64_t *ts;
+    uint8_t *saros;
+    uint8_t *evict;
+    double   timer_ns;
+} bench_state_t;
+
+static eclipse_result_t find_next(const bench_catalog_t *c, int64_t ts)
+{
+    if (c->db)
+        return saros_db_find_next(c->db, ts);
+    return c->is_lunar ? find_next_lunar_eclipse(ts) : find_next_solar_eclipse(ts);
+}
+
+/* Fill ts/saros for one pattern.  Each sample's series is the one of the
+ * next eclipse, so window and phase calls land on a series alive at ts
+ * rather than taking the early out of an expired one. */
+static void make_inputs(bench_state_t *s, const bench_catalog_t *c, int sequential)
+{
+    uint64_t      rng  = BENCH_SEED ^ (uint64_t)c->first ^ ((uint64_t)sequential << 32);
+    const int64_t span = c->last - c->first;
+    size_t        i;
+
+    for (i = 0; i < s->samples; i++) {
+        eclipse_result_t r;
+        if (sequential)
+            s->ts[i] = c->first + (int64_t)((double)span * (double)i / (double)s->samples);
+        else
+            s->ts[i] = c->first + (int64_t)(xorshift(&rng) % (uint64_t)span);
+        r           = find_next(c, s->ts[i]);
+        s->saros[i] = saros_of(c, &r.eclipse);
+    }
+}
+
+static void evict_caches(bench_state_t *s)
+{
+    size_t i;
+    for (i = 0; i < BENCH_EVICT_BYTES; i += 64)
+        s->evict[i]++;
+}
+
+static double run_latency(const bench_state_t *s, const bench_catalog_t *c, bench_kernel_t k)
+{
+    uint64_t acc = 0, t0;
+    size_t   i;
+
+    t0 = now_ns();
+    for (i = 0; i < s->samples; i++)
+        acc += k(c, s->ts[i] + (int64_t)(acc & 1u), s->saros[i]);
+    t0 = now_ns() - t0;
+    g_sink += acc;
+    return (double)t0 / (double)s->samples;
+}
+
+static double run_throughput(const bench_state_t *s, const bench_catalog_t *c, bench_kernel_t k)
+{
+    uint64_t acc = 0, t0;
+    size_t   i;
+
+    t0 = now_ns();
+    for (i = 0; i < s->samples; i++)
+        acc ^= k(c, s->ts[i], s->saros[i]);
+    t0 = now_ns() - t0;
+    g_sink += acc;
+    return (double)s->samples * 1e3 / (double)t0;
+}
+
+static double run_cold(bench_state_t *s, const bench_catalog_t *c, bench_kernel_t k)
+{
+    double   lat[BENCH_COLD_CALLS];
+    uint64_t t0;
+    size_t   i, step = s->samples / s->cold_calls;
+
+    for (i = 0; i < s->cold_calls; i++) {
+        const size_t j = i * step;
+        evict_caches(s);
+        t0 = now_ns();
+        g_sink += k(c, s->ts[j], s->saros[j]);
+        lat[i] = (double)(now_ns() - t0) - s->timer_ns;
+    }
+    return median(lat, s->cold_calls);
+}
+
+static double timer_overhead(void)
+{
+    double   d[BENCH_COLD_CALLS];
+    size_t   i;
+    for (i = 0; i < BENCH_COLD_CALLS; i++) {
+        const uint64_t t0 = now_ns();
+        d[i] = (double)(now_ns() - t0);
+    }
+    return median(d, BENCH_COLD_CALLS);
+}
+
+/* ── Ephemerides ────────────────────────────────────────────────────────── */
+
+typedef uint64_t (*eph_kernel_t)(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor,
+                                 int64_t ts);
+
+/* fractonica_find_closest as it was before the interpolated search. */
+static fractonica_search_result_t bisect_closest(const fractonica_mem_source_t *src, int64_t ts)
+{
+    fractonica_search_result_t r = { 0, 0, false, false };
+    uint32_t                   left = 0, right = src->entry_count - 1;
+
+    if (ts < src->timestamps[0]) {
+        r.found_future = true;
+        return r;
+    }
+    if (ts > src->timestamps[right]) {
+        r.past_index = right;
+        r.found_past = true;
+        return r;
+    }
+    while (left <= right) {
+        const uint32_t mid = left + (right - left) / 2;
+        const int64_t  v   = src->timestamps[mid];
+        if (v < ts) {
+            left = mid + 1;
+        } else if (v > ts) {
+            if (mid == 0)
+                break;
+            right = mid - 1;
+        } else {
+            r.past_index = r.future_index = mid;
+            r.found_past = r.found_future = true;
+            return r;
+        }
+    }
+    if (left < src->entry_count) {
+        r.future_index = left;
+        r.found_future = true;
+    }
+    if (left > 0) {
+        r.past_index = left - 1;
+        r.found_past = true;
+    }
+    return r;
+}
+
+static uint64_t e_bisect(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor, int64_t ts)
+{
+    (void)cursor;
+    return bisect_closest(src, ts).past_index;
+}
+
+static uint64_t e_find_closest(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor,
+                               int64_t ts)
+{
+    (void)cursor;
+    return fractonica_find_closest(src, ts).past_index;
+}
+
+static uint64_t e_cursor_seek(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor,
+                              int64_t ts)
+{
+    return fractonica_cursor_seek(src, cursor, ts) ? cursor->index : 0u;
+}
+
+static uint64_t e_fraction_at(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor,
+                              int64_t ts)
+{
+    (void)cursor;
+    return fractonica_ephemeris_fraction_at(src, ts, 4096, NULL, NULL).bin;
+}
+
+static uint64_t e_fraction_at_cursor(const fractonica_mem_source_t *src, fractonica_cursor_t *cursor,
+                                     int64_t ts)
+{
+    return fractonica_ephemeris_fraction_at_cursor(src, ts, 4096, cursor).bin;
+}
+
+static const struct {
+    const char  *name;
+    eph_kernel_t run;
+} k_eph_cases[] = {
+    { "bisect",             e_bisect },
+    { "find_closest",       e_find_closest },
+    { "cursor_seek",        e_cursor_seek },
+    { "fraction_at",        e_fraction_at },
+    { "fraction_at_cursor", e_fraction_at_cursor },
+};
+
+static double run_eph(const bench_state_t *s, const fractonica_mem_source_t *src, eph_kernel_t k,
+                      int dependent)
+{
+    fractonica_cursor_t cursor;
+    uint64_t            acc = 0, t0;
+    size_t              i;
+
+    memset(&cursor, 0, sizeof(cursor));
+    t0 = now_ns();
+    if (dependent) {
+        for (i = 0; i < s->samples; i++)
+            acc += k(src, &cursor, s->ts[i] + (int64_t)(acc & 1u));
+    } else {
+        for (i = 0; i < s->samples; i++)
+            acc ^= k(src, &cursor, s->ts[i]);
+    }
+    t0 = now_ns() - t0;
+    g_sink += acc;
+    return dependent ? (double)t0 / (double)s->samples : (double)s->samples * 1e3 / (double)t0;
+}
+
+/* fractonica_ephemeris_fractions_sorted over s->ts, ns per sample. */
+static double run_eph_batch(const bench_state_t *s, const fractonica_mem_source_t *src,
+                            uint32_t *bins, double *normalized, double *progress)
+{
+    uint64_t t0 = now_ns();
+    g_sink += fractonica_ephemeris_fractions_sorted(src, s->ts, s->samples, 4096, bins, normalized,
+                                                    progress, NULL);
+    t0 = now_ns() - t0;
+    g_sink += bins[s->samples / 2];
+    return (double)t0 / (double)s->samples;
+}
+
+static void bench_ephemeris(FILE *out, bench_state_t *s, const char *name,
+                            const fractonica_mem_source_t *src, int last)
+{
+    static const char *const patterns[2] = { "random", "sequential" };
+    const int64_t            first = src->timestamps[0];
+    const int64_t            span  = src->timestamps[src->entry_count - 1] - first;
+    const char              *sep   = "";
+    uint64_t                 rng   = BENCH_SEED ^ (uint64_t)first;
+    size_t                   k, i;
+    int                      p;
+
+    fprintf(out, "    {\n      \"name\": \"%s\",\n      \"entries\": %lu,\n      \"results\": [\n",
+            name, (unsigned long)src->entry_count);
+    for (p = 0; p < 2; p++) {
+        for (i = 0; i < s->samples; i++)
+            s->ts[i] = first + (p ? (int64_t)((double)span * (double)i / (double)s->samples)
+                                  : (int64_t)(xorshift(&rng) % (uint64_t)span));
+        for (k = 0; k < sizeof(k_eph_cases) / sizeof(k_eph_cases[0]); k++) {
+            double   lat[BENCH_REPEATS], thr[BENCH_REPEATS];
+            unsigned r;
+            for (r = 0; r < BENCH_REPEATS; r++) {
+                lat[r] = run_eph(s, src, k_eph_cases[k].run, 1);
+                thr[r] = run_eph(s, src, k_eph_cases[k].run, 0);
+            }
+            fprintf(out, "%s        { \"function\": \"%s\", \"pattern\": \"%s\", \"cache\": \"warm\", "
+                         "\"latency_ns\": %.2f, \"cycles\": %.1f, \"throughput_mops\": %.3f }",
+                    sep, k_eph_cases[k].name, patterns[p], median(lat, BENCH_REPEATS),
+                    median(lat, BENCH_REPEATS) * g_cycles_per_ns, median(thr, BENCH_REPEATS));
+            sep = ",\n";
+        }
+    }
+    {
+        /* s->ts still holds the sequential pattern */
+        uint32_t *bins       = (uint32_t *)malloc(s->samples * sizeof(uint32_t));
+        double   *normalized = (double *)malloc(s->samples * sizeof(double));
+        double   *progress   = (double *)malloc(s->samples * sizeof(double));
+        double    lat[BENCH_REPEATS];
+        unsigned  r;
+        if (!bins || !normalized || !progress) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        for (r = 0; r < BENCH_REPEATS; r++)
+            lat[r] = run_eph_batch(s, src, bins, normalized, progress);
+        fprintf(out, "%s        { \"function\": \"fractions_sorted\", \"pattern\": \"sequential\", "
+                     "\"cache\": \"warm\", \"latency_ns\": %.2f, \"cycles\": %.1f, \"throughput_mops\": %.3f }",
+                sep, median(lat, BENCH_REPEATS), median(lat, BENCH_REPEATS) * g_cycles_per_ns,
+                1e3 / median(lat, BENCH_REPEATS));
+        free(bins);
+        free(normalized);
+        free(progress);
+    }
+    fprintf(out, "\n      ]\n    }%s\n", last ? "" : ",");
+}
+
+/* ── JSON ───────────────────────────────────────────────────────────────── */
+
+static void bench_footprint(FILE *out, const char *name, const bench_footprint_t *f, int last)
+{
+    const size_t raw     = f->raw_times + f->raw_info + f->saros;
+    const size_t compact = f->compact_blocks + f->compact_index + f->compact_info + f->saros;
+
+    fprintf(out, "    {\n      \"name\": \"%s\",\n      \"entries\": %lu,\n", name,
+            (unsigned long)f->entries);
+    fprintf(out, "      \"raw\": { \"times\": %lu, \"info\": %lu, \"saros\": %lu, \"total\": %lu },\n",
+            (unsigned long)f->raw_times, (unsigned long)f->raw_info, (unsigned long)f->saros,
+            (unsigned long)raw);
+    fprintf(out, "      \"compact\": { \"blocks\": %lu, \"index\": %lu, \"info\": %lu, "
+                 "\"saros\": %lu, \"total\": %lu },\n",
+            (unsigned long)f->compact_blocks, (unsigned long)f->compact_index,
+            (unsigned long)f->compact_info, (unsigned long)f->saros, (unsigned long)compact);
+    fprintf(out, "      \"compact_ratio\": %.3f\n    }%s\n", (double)compact / (double)raw, last ? "" : ",");
+}
+
+static void json_string(FILE *out, const char *s)
+{
+    fputc('"', out);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            fprintf(out, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(out, "\\u%04x", (unsigned)(unsigned char)*s);
+        else
+            fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+static void bench_catalog(FILE *out, bench_state_t *s, const bench_catalog_t *c,
+                          double first_call_ns, int last)
+{
+    static const char *const patterns[2] = { "random", "sequential" };
+    const char              *sep = "";
+    size_t                   k;
+    int                      p;
+
+    fprintf(out, "    {\n      \"name\": ");
+    json_string(out, c->name);
+    fprintf(out, ",\n      \"source\": \"%s\",\n      \"kind\": \"%s\",\n",
+            c->source, c->is_lunar ? "lunar" : "solar");
+    fprintf(out, "      \"saros_first\": %u,\n      \"saros_last\": %u,\n",
+            (unsigned)c->saros_min, (unsigned)c->saros_max);
+    fprintf(out, "      \"first_eclipse\": %lld,\n      \"last_eclipse\": %lld,\n",
+            (long long)c->first, (long long)c->last);
+    if (first_call_ns >= 0.0)
+        fprintf(out, "      \"first_call_ns\": %.1f,\n", first_call_ns);
+    fprintf(out, "      \"results\": [\n");
+
+    for (p = 0; p < 2; p++) {
+        make_inputs(s, c, p);
+        for (k = 0; k < sizeof(k_cases) / sizeof(k_cases[0]); k++) {
+            const bench_case_t *bc = &k_cases[k];
+            double              lat[BENCH_REPEATS], thr[BENCH_REPEATS], cold;
+            unsigned            r;
+
+            if (bc->builtin_solar_only && (c->db || c->is_lunar))
+                continue;
+            g_sink += bc->run(c, s->ts[0], s->saros[0]);      /* warm-up */
+            for (r = 0; r < BENCH_REPEATS; r++) {
+                lat[r] = run_latency(s, c, bc->run);
+                thr[r] = run_throughput(s, c, bc->run);
+            }
+            cold = run_cold(s, c, bc->run);
+
+            if (cold < 0.0)
+                cold = 0.0;
+            fprintf(out, "%s        { \"function\": \"%s\", \"pattern\": \"%s\", \"cache\": \"warm\", "
+                         "\"latency_ns\": %.2f, \"cycles\": %.1f, \"throughput_mops\": %.3f },\n",
+                    sep, bc->name, patterns[p], median(lat, BENCH_REPEATS),
+                    median(lat, BENCH_REPEATS) * g_cycles_per_ns, median(thr, BENCH_REPEATS));
+            fprintf(out, "        { \"function\": \"%s\", \"pattern\": \"%s\", \"cache\": \"cold\", "
+                         "\"latency_ns\": %.2f, \"cycles\": %.1f }",
+                    bc->name, patterns[p], cold, cold * g_cycles_per_ns);
+            sep = ",\n";
+        }
+    }
+    fprintf(out, "\n");
+    fprintf(out, "      ]\n    }%s\n", last ? "" : ",");
+}
+
+/* ── Driver ─────────────────────────────────────────────────────────────── */
+
+/* Span and series range of c, from one walk over its eclipses. */
+static void scan_catalog(bench_catalog_t *c)
+{
+    eclipse_result_t r = find_next(c, INT64_MIN);
+
+    c->first     = r.eclipse.unix_time;
+    c->saros_min = 255;
+    c->saros_max = 0;
+    while (r.eclipse.valid) {
+        const uint8_t n = saros_of(c, &r.eclipse);
+        if (n < c->saros_min) c->saros_min = n;
+        if (n > c->saros_max) c->saros_max = n;
+        c->last = r.eclipse.unix_time;
+        r = find_next(c, r.eclipse.unix_time + 1);
+    }
+}
+
+static void builtin_catalog(bench_catalog_t *c, int is_lunar, const saros_db_t *db)
+{
+    memset(c, 0, sizeof(*c));
+    snprintf(c->name, sizeof(c->name), "%s/%s%s", is_lunar ? "lunar" : "solar",
+#ifdef SAROS_USE_ALL
+             "all",
+#else
+             "modern",
+#endif
+             db ? " (saros_db)" : "");
+    c->source   = db ? "builtin-db" : "builtin";
+    c->is_lunar = is_lunar;
+    c->db       = db;
+    scan_catalog(c);
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--quick] [--samples N] [--cpu-mhz F] [--out results.json] [catalog.sdb ...]\n",
+            argv0);
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    bench_catalog_t cats[4 + BENCH_MAX_FILES];
+    saros_file_t    files[BENCH_MAX_FILES];
+    fractonica_mem_source_t ephemerides[3];
+    double          first_call[2];
+    bench_state_t   st;
+    const char     *out_path = NULL;
+    FILE           *out      = stdout;
+    double          cpu_mhz  = 0.0;
+    size_t          ncat = 0, nfile = 0, i;
+    uint64_t        t0;
+    int             a;
+
+    /* Before anything else touches the catalogs. */
+    t0 = now_ns();
+    g_sink += (uint64_t)find_next_solar_eclipse(0).eclipse.unix_time;
+    first_call[0] = (double)(now_ns() - t0);
+    t0 = now_ns();
+    g_sink += (uint64_t)find_next_lunar_eclipse(0).eclipse.unix_time;
+    first_call[1] = (double)(now_ns() - t0);
+
+    memset(&st, 0, sizeof(st));
+    st.samples    = BENCH_SAMPLES_DEFAULT;
+    st.cold_calls = BENCH_COLD_CALLS;
+    for (a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--quick") == 0) {
+            st.samples    = BENCH_SAMPLES_QUICK;
+            st.cold_calls = BENCH_COLD_QUICK;
+        } else if (strcmp(argv[a], "--samples") == 0 && a + 1 < argc) {
+            st.samples = (size_t)strtoul(argv[++a], NULL, 10);
+            if (st.samples < BENCH_COLD_CALLS)
+                st.samples = BENCH_COLD_CALLS;
+        } else if (strcmp(argv[a], "--cpu-mhz") == 0 && a + 1 < argc) {
+            cpu_mhz = strtod(argv[++a], NULL);
+            if (cpu_mhz <= 0.0)
+                return usage(argv[0]);
+        } else if (strcmp(argv[a], "--out") == 0 && a + 1 < argc) {
+            out_path = argv[++a];
+        } else if (argv[a][0] == '-' || nfile == BENCH_MAX_FILES) {
+            return usage(argv[0]);
+        } else {
+            saros_file_status_t rc = saros_file_open(&files[nfile], argv[a]);
+            if (rc != SAROS_FILE_OK) {
+                fprintf(stderr, "%s: cannot load catalog (status %d)\n", argv[a], (int)rc);
+                return 1;
+            }
+            memset(&cats[4 + nfile], 0, sizeof(cats[0]));
+            snprintf(cats[4 + nfile].name, sizeof(cats[0].name), "%s", argv[a]);
+            cats[4 + nfile].source   = "file";
+            cats[4 + nfile].is_lunar = files[nfile].db.is_lunar;
+            cats[4 + nfile].db       = &files[nfile].db;
+            nfile++;
+        }
+    }
+
+    builtin_catalog(&cats[ncat++], 0, NULL);
+    builtin_catalog(&cats[ncat++], 1, NULL);
+#ifndef SAROS_USE_COMPACT
+    builtin_catalog(&cats[ncat++], 0, &saros_solar_db);
+    builtin_catalog(&cats[ncat++], 1, &saros_lunar_db);
+#endif
+    for (i = 0; i < nfile; i++) {
+        cats[ncat] = cats[4 + i];
+        scan_catalog(&cats[ncat++]);
+    }
+
+    st.ts    = (int64_t *)malloc(st.samples * sizeof(int64_t));
+    st.saros = (uint8_t *)malloc(st.samples);
+    st.evict = (uint8_t *)calloc(BENCH_EVICT_BYTES, 1);
+    if (!st.ts || !st.saros || !st.evict) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    st.timer_ns = timer_overhead();
+    g_cycles_per_ns = cpu_mhz > 0.0 ? cpu_mhz * 1e-3 : measure_cycles_per_ns();
+    fractonica_mem_init(&ephemerides[0], FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps);
+    fractonica_mem_init(&ephemerides[1], FRACTONICA_APOGEE_COUNT, fractonica_apogee_timestamps);
+    fractonica_mem_init(&ephemerides[2], FRACTONICA_NODAL_ASCENDING_COUNT,
+                        fractonica_nodal_ascending_timestamps);
+
+    if (out_path && !(out = fopen(out_path, "w"))) {
+        perror(out_path);
+        return 1;
+    }
+
+    fprintf(out, "{\n  \"benchmark\": \"core_bench\",\n  \"schema\": 4,\n");
+    fprintf(out, "  \"build\": {\n");
+#ifdef SAROS_USE_COMPACT
+    fprintf(out, "    \"format\": \"compact\",\n");
+#else
+    fprintf(out, "    \"format\": \"raw\",\n");
+#endif
+#ifdef SAROS_USE_EYTZINGER
+    fprintf(out, "    \"eytzinger\": true,\n");
+#else
+    fprintf(out, "    \"eytzinger\": false,\n");
+#endif
+#ifdef SAROS_NO_SERIES_CACHE
+    fprintf(out, "    \"series_cache\": false,\n");
+#else
+    fprintf(out, "    \"series_cache\": true,\n");
+#endif
+#if defined(__VERSION__)
+    fprintf(out, "    \"compiler\": ");
+    json_string(out, __VERSION__);
+    fprintf(out, "\n");
+#elif defined(_MSC_VER)
+    fprintf(out, "    \"compiler\": \"MSVC %d\"\n", _MSC_VER);
+#else
+    fprintf(out, "    \"compiler\": \"unknown\"\n");
+#endif
+    fprintf(out, "  },\n  \"config\": {\n");
+    fprintf(out, "    \"samples\": %lu,\n    \"repeats\": %u,\n    \"cold_calls\": %u,\n",
+            (unsigned long)st.samples, BENCH_REPEATS, st.cold_calls);
+    fprintf(out, "    \"timer_overhead_ns\": %.1f,\n", st.timer_ns);
+    fprintf(out, "    \"cycle_counter\": \"%s\",\n    \"cycles_per_ns\": %.4f\n  },\n  \"footprint\": [\n",
+            cpu_mhz > 0.0 ? "cpu-mhz" : BENCH_CYCLE_COUNTER, g_cycles_per_ns);
+    bench_footprint(out, "solar", &bench_footprint_solar, 0);
+    bench_footprint(out, "lunar", &bench_footprint_lunar, 1);
+    fprintf(out, "  ],\n  \"catalogs\": [\n");
+
+    for (i = 0; i < ncat; i++) {
+        const double fc = cats[i].source[0] == 'b' && !cats[i].db ? first_call[cats[i].is_lunar] : -1.0;
+        bench_catalog(out, &st, &cats[i], fc, i + 1 == ncat);
+        fflush(out);
+    }
+    fprintf(out, "  ],\n  \"ephemerides\": [\n");
+    bench_ephemeris(out, &st, "new_moon", &ephemerides[0], 0);
+    bench_ephemeris(out, &st, "apogee", &ephemerides[1], 0);
+    bench_ephemeris(out, &st, "nodal_ascending", &ephemerides[2], 1);
+    fprintf(out, "  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    for (i = 0; i < nfile; i++)
+        saros_file_close(&files[i]);
+    free(st.ts);
+    free(st.saros);
+    free(st.evict);
+    return 0;
+}
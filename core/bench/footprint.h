@@ -0,0 +1,29 @@
+/*
+ * footprint.h — flash footprint of the built-in eclipse tables, for core_bench
+ *
+ * Both data formats are measured whichever one the library was built
+ * with: footprint_solar.c / footprint_lunar.c include the raw and the
+ * compact headers of their catalog and only take sizeof of the arrays,
+ * so none of the data is linked into core_bench.
+ */
+
+#ifndef CORE_BENCH_FOOTPRINT_H
+#define CORE_BENCH_FOOTPRINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint32_t entries;
+    size_t   saros;           /* series records, the same in both formats */
+    size_t   raw_times;       /* eclipse_times_<slice>[] */
+    size_t   raw_info;        /* eclipse_info_<slice>[] */
+    size_t   compact_blocks;  /* eclipse_times_<slice>_packed[] */
+    size_t   compact_index;   /* per-block base and frame */
+    size_t   compact_info;    /* packed info, bias and width */
+} bench_footprint_t;
+
+extern const bench_footprint_t bench_footprint_solar;
+extern const bench_footprint_t bench_footprint_lunar;
+
+#endif /* CORE_BENCH_FOOTPRINT_H */
@@ -0,0 +1,12 @@
+/*
+ * footprint_lunar.c — sizes of the built-in lunar tables (see footprint.h)
+ */
+
+#include "../include/saros/lunar/eclipse_times_modern.h"
+#include "../include/saros/lunar/eclipse_info_modern.h"
+#include "../include/saros/lunar/eclipse_times_modern_compact.h"
+#include "../include/saros/lunar/eclipse_info_modern_compact.h"
+#include "../include/saros/lunar/saros_modern.h"
+
+#define BENCH_FOOTPRINT bench_footprint_lunar
+#include "footprint_tables.h"
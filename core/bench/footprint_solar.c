@@ -0,0 +1,12 @@
+/*
+ * footprint_solar.c — sizes of the built-in solar tables (see footprint.h)
+ */
+
+#include "../include/saros/solar/eclipse_times_modern.h"
+#include "../include/saros/solar/eclipse_info_modern.h"
+#include "../include/saros/solar/eclipse_times_modern_compact.h"
+#include "../include/saros/solar/eclipse_info_modern_compact.h"
+#include "../include/saros/solar/saros_modern.h"
+
+#define BENCH_FOOTPRINT bench_footprint_solar
+#include "footprint_tables.h"
@@ -0,0 +1,16 @@
+/*
+ * footprint_tables.h — defines BENCH_FOOTPRINT from the raw and compact
+ * headers of one catalog, included just before (see footprint.h).
+ */
+
+#include "footprint.h"
+
+const bench_footprint_t BENCH_FOOTPRINT = {
+    ECLIPSE_MODERN_COUNT,
+    sizeof(saros_modern),
+    sizeof(eclipse_times_modern),
+    sizeof(eclipse_info_modern),
+    sizeof(eclipse_times_modern_packed),
+    sizeof(eclipse_times_modern_base) + sizeof(eclipse_times_modern_frame),
+    sizeof(eclipse_info_modern_packed) + sizeof(eclipse_info_modern_bias) + sizeof(eclipse_info_modern_width),
+};
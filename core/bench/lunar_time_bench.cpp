@@ -0,0 +1,119 @@
+/*
+ * lunar_time_bench.cpp — LunarTime / LunarTimeEngine calls per second
+ *
+ *   host:   lunar_time_bench [--quick]
+ *   ESP32:  pio run -e esp32s3-lunar-bench -t upload -t monitor
+ *           (embedd/platformio.ini; results on the serial port)
+ *
+ * Each engine answers getEventInfo() for the three built-in events over
+ * two timestamp patterns inside the tables' span:
+ *
+ *   clock    one-second steps, what a running clock asks for
+ *   random   uniform timestamps, a window change almost every call
+ *
+ * Engines: LunarTime(4, 8) (double ceil + binOctal), and LunarTimeEngine
+ * with octal 4 and 10 digits (shift), decimal 6 digits and base 12,
+ * 4 digits (multiply).  Output is one line per engine and pattern:
+ *
+ *   <engine> <pattern> <calls/s> <checksum>
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "LunarTime.h"
+#include "LunarTimeEngine.h"
+
+#if defined(ARDUINO)
+#  include <Arduino.h>
+#  define BENCH_CALLS       20000u
+#  define BENCH_PRINT(...)  Serial.printf(__VA_ARGS__)
+static uint64_t now_us() { return static_cast<uint64_t>(micros()); }
+#else
+#  include <chrono>
+#  define BENCH_CALLS       2000000u
+#  define BENCH_PRINT(...)  printf(__VA_ARGS__)
+static uint64_t now_us() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+using namespace Fractonica;
+
+// Inside every built-in table (they start in 2010 and run 512 entries)
+static constexpr int64_t BenchStart = 1300000000;
+static constexpr int64_t BenchSpan  = 30ll * 365 * 86400;
+
+static uint64_t state = 0x5A205A205A205A20ull;
+
+static int64_t RandomTimestamp() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return BenchStart + static_cast<int64_t>(state % BenchSpan);
+}
+
+// calls/s of lookup(ts) over `calls` timestamps; checksum keeps the calls alive
+template<typename Lookup>
+static void Run(const char *engine, const char *pattern, const bool random, const uint32_t calls,
+                Lookup lookup) {
+    uint64_t checksum = 0;
+    int64_t ts = BenchStart;
+    const uint64_t t0 = now_us();
+    for (uint32_t i = 0; i < calls; i++) {
+        ts = random ? RandomTimestamp() : ts + 1;
+        checksum += lookup(ts);
+    }
+    const uint64_t us = now_us() - t0;
+    const double perSecond = us ? static_cast<double>(calls) * 3.0 * 1e6 / static_cast<double>(us) : 0.0;
+    BENCH_PRINT("%-18s %-7s %12.0f %016llx\n", engine, pattern, perSecond,
+                static_cast<unsigned long long>(checksum));
+}
+
+template<uint32_t Base, uint8_t Digits>
+static void RunEngine(const char *name, const uint32_t calls) {
+    for (int random = 0; random < 2; random++) {
+        const LunarTimeEngine<Base, Digits> engine;
+        Run(name, random ? "random" : "clock", random, calls, [&](const int64_t ts) {
+            return engine.getEventInfo(ts, NEW_MOON).digits.packed
+                   + engine.getEventInfo(ts, APOGEE).digits.packed
+                   + engine.getEventInfo(ts, NODAL_ASCENDING).digits.packed;
+        });
+    }
+}
+
+static void RunAll(const uint32_t calls) {
+    for (int random = 0; random < 2; random++) {
+        const LunarTime lunarTime(4, 8);
+        Run("LunarTime(4,8)", random ? "random" : "clock", random, calls, [&](const int64_t ts) {
+            const uint32_t t = static_cast<uint32_t>(ts);
+            return static_cast<uint64_t>(lunarTime.getEventInfo(t, NEW_MOON).binOctal)
+                   + lunarTime.getEventInfo(t, APOGEE).binOctal
+                   + lunarTime.getEventInfo(t, NODAL_ASCENDING).binOctal;
+        });
+    }
+    RunEngine<8, 4>("Engine<8,4>", calls);
+    RunEngine<8, 10>("Engine<8,10>", calls);
+    RunEngine<10, 6>("Engine<10,6>", calls);
+    RunEngine<12, 4>("Engine<12,4>", calls);
+}
+
+#if defined(ARDUINO)
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+    RunAll(BENCH_CALLS);
+}
+
+void loop() {
+    delay(1000);
+}
+#else
+int main(const int argc, char **argv) {
+    const bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+    RunAll(quick ? BENCH_CALLS / 20 : BENCH_CALLS);
+    return 0;
+}
+#endif
@@ -0,0 +1,54 @@
+//
+// Sun and Moon positions from analytic series, without SPICE kernels.
+//
+
+#ifndef FRACTONICA_ANALYTICEPHEMERIS_H
+#define FRACTONICA_ANALYTICEPHEMERIS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Fractonica::AnalyticEphemeris {
+
+    /**
+     * Low-precision geocentric Sun and Moon (Paul Schlyter's mean elements
+     * with the 12 + 5 + 2 main lunar perturbation terms, the series
+     * libs/astro/moon.hpp started from).  Good to a few arcminutes for
+     * centuries around 2000, enough for phases and alignments on targets
+     * that cannot load kernels.
+     *
+     * Every function is a pure function of the day number: reentrant, no
+     * globals, no allocation.  The batch calls evaluate two epochs per
+     * step with SIMD sin/cos on GCC/Clang (plain loops elsewhere) and give
+     * the same results as the single-epoch calls.
+     */
+
+    /** Rectangular coordinates, ecliptic and equinox of date unless noted. */
+    struct Position {
+        double x, y, z;
+    };
+
+    /** Days since 1999-12-31 00:00 UT, the day number of the series. */
+    constexpr double DayNumber(const int64_t unixSeconds) {
+        return static_cast<double>(unixSeconds - 946598400) / 86400.0;
+    }
+
+    /** Sun, in AU. */
+    Position Sun(double d);
+
+    /** Moon, in Earth radii. */
+    Position Moon(double d);
+
+    /** Ecliptic to equatorial coordinates, both of date. */
+    Position ToEquatorial(const Position &ecliptic, double d);
+
+    /** Sun-Moon angle seen from the Earth, radians: 0 new, pi full moon. */
+    double Elongation(double d);
+
+    /** Sun(d[i]) / Moon(d[i]) / Elongation(d[i]) for i < count. */
+    void SunPositions(const double *d, size_t count, Position *out);
+    void MoonPositions(const double *d, size_t count, Position *out);
+    void Elongations(const double *d, size_t count, double *out);
+}
+
+#endif //FRACTONICA_ANALYTICEPHEMERIS_H
@@ -7,8 +7,22 @@
  * Binary format (little-endian):
  *   uint32  magic           - "FRAC" (0x43415246)
  *   uint32  entry_count     - Number of timestamps
- *   uint64  reserved        - Reserved
+ *   uint64  reserved        - Format version: 0 (single series) or 2
  *   int64[] timestamps      - Absolute timestamps
+ *
+ * Version 2 holds several named series (new moon, apogee, ...) behind a
+ * coarse time index shared by all of them; entry_count is their total:
+ *   uint32  series_count    - 1..FRACTONICA_MAX_SERIES
+ *   uint32  index_count     - Rows of the time index
+ *   int64   index_start     - Time of row 0
+ *   int64   index_step      - Seconds between rows (e.g. a year)
+ *   series_count x { char name[16]; uint32 first; uint32 count }
+ *                           - Series entries are timestamps[first..+count)
+ *   uint32[index_count][series_count]
+ *                           - Row k: entries of each series earlier than
+ *                             index_start + k * index_step
+ *   zero padding to 8 bytes
+ *   int64[] timestamps      - All series, one after another
  */
 
 #ifndef FRACTONICA_EPHEMERIS_H
@@ -28,6 +42,10 @@ extern "C"
 
 #define FRACTONICA_MAGIC 0x43415246
 #define FRACTONICA_HEADER_SIZE 16
+#define FRACTONICA_VERSION_MULTI 2u
+#define FRACTONICA_MULTI_HEADER_SIZE 40
+#define FRACTONICA_MAX_SERIES 8u
+#define FRACTONICA_SERIES_NAME_SIZE 16u
 /* Error value returned for invalid queries */
 #define FRACTONICA_INVALID UINT64_MAX
 
@@ -41,11 +59,43 @@ typedef struct
 
 
 
+#ifndef FRACTONICA_FILE_PAGE_SIZE
+#define FRACTONICA_FILE_PAGE_SIZE 4096u /* bytes per cached block, multiple of 8 */
+#endif
+#ifndef FRACTONICA_FILE_CACHE_PAGES
+#define FRACTONICA_FILE_CACHE_PAGES 4u
+#endif
+
+typedef enum
+{
+  FRACTONICA_FILE_BUFFERED = 0, /* stdio reads through the block cache */
+  FRACTONICA_FILE_MMAP = 1      /* read-only mapping (POSIX); else buffered */
+} fractonica_file_mode_t;
+
+/* An open ephemeris file.  Entries are read a block at a time into a small
+ * LRU cache, or straight from a mapping of the whole file. */
+typedef struct
+{
+  fractonica_header_t header;
+  void *handle;        /* FILE * of a buffered file */
+  const uint8_t *map;  /* whole file, mmap mode */
+  size_t map_size;
+  uint32_t page[FRACTONICA_FILE_CACHE_PAGES]; /* block held by each slot */
+  uint32_t used[FRACTONICA_FILE_CACHE_PAGES]; /* last use, 0 = empty slot */
+  uint32_t clock;
+  uint8_t data[FRACTONICA_FILE_CACHE_PAGES][FRACTONICA_FILE_PAGE_SIZE];
+} fractonica_file_source_t;
+
+/* Sorted timestamps, either in memory (static arrays, PROGMEM) or in an
+ * open file; every search below works on both. */
 typedef struct
 {
   uint32_t entry_count;
-  const int64_t *timestamps; /* Pointer to static int64 array */
-} fractonica_mem_source_t;
+  const int64_t *timestamps;      /* Pointer to static int64 array */
+  fractonica_file_source_t *file; /* used when timestamps is NULL */
+} fractonica_source_t;
+
+typedef fractonica_source_t fractonica_mem_source_t;
 
 typedef struct
 {
@@ -73,6 +123,16 @@ typedef struct
   bool found_future;
 } fractonica_search_result_t;
 
+/* Last window found for one source, so the next query near it is O(1).
+ * Zero-initialise before first use; a cursor belongs to one source. */
+typedef struct
+{
+  int64_t start;   /* timestamp of entry index */
+  int64_t end;     /* timestamp of entry index + 1 */
+  uint32_t index;
+  bool valid;      /* start <= last sought timestamp < end */
+} fractonica_cursor_t;
+
 /**
  * Open an ephemeris binary file and read its header.
  */
@@ -89,26 +149,59 @@ void fractonica_file_close(void *handle);
 int64_t fractonica_file_get_timestamp(void *handle,
                                       const fractonica_header_t *header,
                                       uint32_t index);
+/**
+ * Open an ephemeris file as a source (see fractonica_file_init()).
+ * Checks the magic and that the file holds every entry it declares.
+ * FRACTONICA_FILE_MMAP falls back to buffered reads where there is no
+ * mmap.  The struct is large (the cache); keep it static or on the heap.
+ */
+bool fractonica_file_source_open(fractonica_file_source_t *file,
+                                 const char *filepath,
+                                 fractonica_file_mode_t mode);
+
+/**
+ * Close a file opened with fractonica_file_source_open().
+ */
+void fractonica_file_source_close(fractonica_file_source_t *file);
+
+/**
+ * Initialize a source reading from an open file.
+ */
+void fractonica_file_init(fractonica_source_t *source,
+                          fractonica_file_source_t *file);
+
 /**
  * Initialize a memory source from static data.
  */
-void fractonica_mem_init(fractonica_mem_source_t *source, uint32_t count,
+void fractonica_mem_init(fractonica_source_t *source, uint32_t count,
                           const int64_t *timestamps);
 
 /**
- * Get the timestamp of period N from memory.
+ * Get the timestamp of period N from a memory or file source.
  */
-int64_t fractonica_mem_get_timestamp(const fractonica_mem_source_t *source,
+int64_t fractonica_mem_get_timestamp(const fractonica_source_t *source,
                                       uint32_t index);
 
 /**
  * Find closest period indices (past and future) for a given timestamp.
  * If timestamp is exact match, past_index == future_index.
+ * Interpolates between the first and last entry, so nearly periodic
+ * series are found in a few reads.
  */
 fractonica_search_result_t
-fractonica_find_closest(const fractonica_mem_source_t *source,
+fractonica_find_closest(const fractonica_source_t *source,
                         int64_t timestamp);
 
+/**
+ * Move a cursor to the window start <= timestamp < end of consecutive
+ * entries.  Free while timestamp stays in the cursor's window, a read or
+ * two when it moves on to a neighbouring one.  Returns false (and leaves
+ * cursor->valid false) before the first or from the last entry on.
+ */
+bool fractonica_cursor_seek(const fractonica_source_t *source,
+                            fractonica_cursor_t *cursor,
+                            int64_t timestamp);
+
 /**
  * Compute bin/progress from ephemeris periods around a unix timestamp.
  *
@@ -120,12 +213,107 @@ fractonica_find_closest(const fractonica_mem_source_t *source,
  * resolution must be > 0.
  */
 fractonica_ephemeris_fraction_t
-fractonica_ephemeris_fraction_at(const fractonica_mem_source_t *source,
+fractonica_ephemeris_fraction_at(const fractonica_source_t *source,
                                  int64_t unix_ts,
                                  uint32_t resolution,
                                  int64_t *io_window_start, /* optional in/out */
                                  int64_t *io_window_end);  /* optional in/out */
 
+/**
+ * fractonica_ephemeris_fraction_at() through a cursor kept by the caller,
+ * one per source.  At an entry's exact timestamp this is bin 0 of the
+ * window that starts there (the uncached call reports it as invalid).
+ */
+fractonica_ephemeris_fraction_t
+fractonica_ephemeris_fraction_at_cursor(const fractonica_source_t *source,
+                                        int64_t unix_ts,
+                                        uint32_t resolution,
+                                        fractonica_cursor_t *cursor);
+
+/**
+ * fractonica_ephemeris_fraction_at() for count timestamps sorted ascending,
+ * into caller-provided arrays (structure of arrays; any may be NULL):
+ * bins[i], normalized[i] and progress[i] are what fraction_at would return
+ * for timestamps[i], and valid[i] its valid flag.  Invalid samples are 0.
+ *
+ * The window follows the timestamps in a merge-style walk, so a sorted
+ * batch reads each entry at most once beyond a gallop per window change,
+ * and the per-window work is done once per window rather than per sample.
+ * Unsorted input gives the same results, only slower.
+ *
+ * Returns the number of valid samples.
+ */
+size_t
+fractonica_ephemeris_fractions_sorted(const fractonica_source_t *source,
+                                      const int64_t *timestamps,
+                                      size_t count,
+                                      uint32_t resolution,
+                                      uint32_t *bins,
+                                      double *normalized,
+                                      double *progress,
+                                      bool *valid);
+
+/* ── Multi-series container (version 2) ─────────────────────────────────── */
+
+/* A version 2 container in memory.  Every series is a plain source (its
+ * timestamps point into the buffer), so cursors and fraction_at work on
+ * each one; fractonica_multi_find_all() searches all of them at once. */
+typedef struct
+{
+  uint32_t series_count;
+  uint32_t index_count;
+  int64_t index_start;
+  int64_t index_step;
+  const uint8_t *index; /* index_count rows of series_count uint32 */
+  char names[FRACTONICA_MAX_SERIES][FRACTONICA_SERIES_NAME_SIZE + 1];
+  fractonica_source_t series[FRACTONICA_MAX_SERIES];
+  void *buffer;         /* file contents owned by fractonica_multi_open() */
+} fractonica_multi_t;
+
+/**
+ * Validate a version 2 container in a caller-owned buffer (8-byte aligned,
+ * little-endian host) that outlives multi.  Returns false if the header,
+ * series table or index is inconsistent with size, or an index row does
+ * not count the entries of its series before the row's time.
+ */
+bool fractonica_multi_open_memory(fractonica_multi_t *multi,
+                                  const uint8_t *data, size_t size);
+
+/**
+ * Read a version 2 file into memory and open it.
+ */
+bool fractonica_multi_open(fractonica_multi_t *multi, const char *filepath);
+
+/**
+ * Release what fractonica_multi_open() loaded.
+ */
+void fractonica_multi_close(fractonica_multi_t *multi);
+
+/**
+ * Series named name, or NULL.
+ */
+const fractonica_source_t *fractonica_multi_series(const fractonica_multi_t *multi,
+                                                   const char *name);
+
+/**
+ * fractonica_find_closest() for every series (out[series_count]).  One
+ * index row brackets each series to the entries of one index step, so
+ * the per-series search is a few reads.
+ */
+void fractonica_multi_find_all(const fractonica_multi_t *multi,
+                               int64_t timestamp,
+                               fractonica_search_result_t *out);
+
+/**
+ * Write series (sorted, in memory or files) as a version 2 container with
+ * one index row every index_step seconds.  Returns false on I/O errors or
+ * bad arguments.
+ */
+bool fractonica_multi_write(const char *filepath,
+                            const char *const *names,
+                            const fractonica_source_t *series,
+                            uint32_t series_count,
+                            int64_t index_step);
 
 #ifdef __cplusplus
 }
@@ -20,6 +20,7 @@ namespace Fractonica {
         int16_t posY = 405;
         const int16_t posX = 160;
         fractonica_mem_source_t newMoon, apogee, nodalAscending;
+        fractonica_cursor_t newMoonCursor{}, apogeeCursor{}, nodalAscendingCursor{};
         uint32_t resolution;
         
 
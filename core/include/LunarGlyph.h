@@ -7,15 +7,15 @@
 
 #include "IDisplay.h"
 #include "IMatrix.h"
-#include "LunarTime.h"
+#include "LunarTimeEngine.h"
 
 namespace Fractonica {
     class LunarGlyph {
 
-        LunarTime time_;
+        LunarTimeEngine<8, 4> time_;
     public:
 
-        LunarGlyph() : time_(LunarTime(4, 8)) {}
+        LunarGlyph() = default;
         void draw(int64_t timestamp, IMatrix *matrix) const;
         void draw(uint32_t *lastNewMoon, uint32_t *lastNode, uint32_t *lastApogee, int64_t timestamp, int16_t x, int16_t y, uint8_t size, IDisplay *display) const;
         void drawRange(const int64_t now, const int64_t from, const int64_t to, IMatrix *matrix) const;
@@ -15,6 +15,9 @@ namespace Fractonica {
         NODAL_ASCENDING
     };
 
+    /** Built-in ephemeris table of an event (new_moon.h, apogee.h, nodal_ascending.h). */
+    fractonica_mem_source_t LunarEventSource(LunarEvent event);
+
     struct LunarEventInfo {
         uint32_t bin;
         uint32_t binOctal;
@@ -26,6 +29,8 @@ namespace Fractonica {
     class LunarTime {
 
         fractonica_mem_source_t newMoon{}, apogee{}, nodalAscending{};
+        // Last window per event; getEventInfo() only moves them along.
+        mutable fractonica_cursor_t newMoonCursor{}, apogeeCursor{}, nodalAscendingCursor{};
         uint32_t prevNewMoon = 0;
         uint32_t prevApogee = 0;
         uint32_t prevNodalAscending = 0;
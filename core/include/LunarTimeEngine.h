@@ -0,0 +1,179 @@
+//
+// LunarTime with the base and digit count fixed at compile time.
+//
+
+#ifndef FRACTONICA_LUNARTIMEENGINE_H
+#define FRACTONICA_LUNARTIMEENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "LunarTime.h"
+
+namespace Fractonica {
+
+    /**
+     * Digits of a bin in base Base, BitsPerDigit bits each, digit 0 (the
+     * least significant) in the lowest bits.  For a power-of-two base the
+     * packed value is the bin itself.
+     */
+    template<uint32_t Base, uint8_t Count>
+    struct LunarDigits {
+        static constexpr uint8_t BitsPerDigit = [] {
+            uint8_t bits = 0;
+            while ((Base - 1) >> bits) bits++;
+            return bits;
+        }();
+        static constexpr uint64_t Mask = (uint64_t(1) << BitsPerDigit) - 1;
+        static_assert(BitsPerDigit * Count <= 64, "digits do not fit in 64 bits");
+
+        uint64_t packed = 0;
+
+        constexpr uint32_t operator[](const size_t i) const {
+            return static_cast<uint32_t>((packed >> (i * BitsPerDigit)) & Mask);
+        }
+
+        static constexpr LunarDigits FromBin(uint32_t bin) {
+            LunarDigits d;
+            if constexpr ((Base & (Base - 1)) == 0) {
+                d.packed = bin;
+            } else {
+                for (uint8_t i = 0; i < Count; i++) {
+                    d.packed |= static_cast<uint64_t>(bin % Base) << (i * BitsPerDigit);
+                    bin /= Base;
+                }
+            }
+            return d;
+        }
+    };
+
+    /**
+     * LunarTime for Base^Digits bins per window, e.g. LunarTimeEngine<8, 4>
+     * for the 4-digit octal clock.  Same bins and progress as
+     * LunarTime::getEventInfo(), computed in exact integer arithmetic
+     * (multiply by a per-window reciprocal, shift for power-of-two bases)
+     * instead of a double ceil, and the digits come packed instead of as
+     * a decimal-looking binOctal.  Windows longer than 2^32 seconds, which
+     * the built-in tables do not have, fall back to
+     * fractonica_ephemeris_fraction_at_cursor().
+     */
+    template<uint32_t Base, uint8_t Digits>
+    class LunarTimeEngine {
+    public:
+        static_assert(Base >= 2 && Digits >= 1, "need a base of 2 or more and at least one digit");
+
+        static constexpr uint64_t Resolution = [] {
+            uint64_t r = 1;
+            for (uint8_t i = 0; i < Digits; i++) r *= Base;
+            return r;
+        }();
+        static_assert(Resolution <= (uint64_t(1) << 31), "Base^Digits must be at most 2^31");
+
+        static constexpr bool PowerOfTwoBase = (Base & (Base - 1)) == 0;
+        static constexpr uint8_t Shift = LunarDigits<Base, Digits>::BitsPerDigit * Digits;
+
+        using DigitVector = LunarDigits<Base, Digits>;
+
+        struct Info {
+            uint32_t bin;           // 0..Resolution-1
+            DigitVector digits;     // bin in base Base
+            double progress;        // 0..1 toward the next bin
+            double normalized;      // 0..1 within the window
+            LunarEvent event;
+            bool valid;
+        };
+
+        LunarTimeEngine() {
+            for (int e = NEW_MOON; e <= NODAL_ASCENDING; e++) {
+                sources_[e] = LunarEventSource(static_cast<LunarEvent>(e));
+            }
+        }
+
+        [[nodiscard]] Info getEventInfo(int64_t timestamp, LunarEvent type) const;
+
+    private:
+        // Reciprocal of the current window of one event, redone when the
+        // cursor moves to another window.
+        struct Window {
+            int64_t start = 0, end = 0;
+            uint64_t period = 0;
+            uint64_t reciprocal = 0;    // floor((2^64 - 1) / period); 0 if period >= 2^32
+            double inverse = 0.0;
+        };
+
+        static uint64_t MulHigh(uint64_t a, uint64_t b);
+
+        fractonica_mem_source_t sources_[3]{};
+        mutable fractonica_cursor_t cursors_[3]{};
+        mutable Window windows_[3]{};
+    };
+
+    template<uint32_t B, uint8_t D>
+    uint64_t LunarTimeEngine<B, D>::MulHigh(const uint64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+        // 32-bit targets (ESP32, AVR): four 32x32 products
+        const uint64_t aLo = a & 0xFFFFFFFFu, aHi = a >> 32;
+        const uint64_t bLo = b & 0xFFFFFFFFu, bHi = b >> 32;
+        const uint64_t lo = aLo * bLo;
+        const uint64_t mid1 = aHi * bLo + (lo >> 32);
+        const uint64_t mid2 = aLo * bHi + (mid1 & 0xFFFFFFFFu);
+        return aHi * bHi + (mid1 >> 32) + (mid2 >> 32);
+#endif
+    }
+
+    template<uint32_t B, uint8_t D>
+    typename LunarTimeEngine<B, D>::Info LunarTimeEngine<B, D>::getEventInfo(const int64_t timestamp,
+                                                                             const LunarEvent type) const {
+        Info info{};
+        info.event = type;
+        if (type < NEW_MOON || type > NODAL_ASCENDING) return info;
+
+        fractonica_cursor_t &cursor = cursors_[type];
+        if (!fractonica_cursor_seek(&sources_[type], &cursor, timestamp)) return info;
+
+        Window &w = windows_[type];
+        if (w.start != cursor.start || w.end != cursor.end) {
+            w.start = cursor.start;
+            w.end = cursor.end;
+            w.period = static_cast<uint64_t>(cursor.end - cursor.start);
+            w.reciprocal = w.period >> 32 ? 0 : UINT64_MAX / w.period;
+            w.inverse = 1.0 / static_cast<double>(w.period);
+        }
+
+        if (w.reciprocal == 0) {
+            const fractonica_ephemeris_fraction_t f = fractonica_ephemeris_fraction_at_cursor(
+                &sources_[type], timestamp, static_cast<uint32_t>(Resolution), &cursor);
+            info.bin = f.bin;
+            info.digits = DigitVector::FromBin(f.bin);
+            info.progress = f.progress;
+            info.normalized = f.normalized;
+            info.valid = f.valid;
+            return info;
+        }
+
+        // start <= timestamp < end, so elapsed < period < 2^32 and x < 2^63
+        const uint64_t elapsed = static_cast<uint64_t>(timestamp - w.start);
+        const uint64_t x = PowerOfTwoBase ? elapsed << Shift : elapsed * Resolution;
+        // The reciprocal rounds down, so q is floor(x / period) or up to two below
+        uint64_t q = MulHigh(x, w.reciprocal);
+        uint64_t rem = x - q * w.period;
+        while (rem >= w.period) {
+            rem -= w.period;
+            q++;
+        }
+
+        // Bins are ceil-mapped like fill_fraction(): an exact boundary ends
+        // the bin below it at progress 1
+        const bool boundary = rem == 0 && q > 0;
+        info.bin = static_cast<uint32_t>(q - boundary);
+        info.digits = DigitVector::FromBin(info.bin);
+        info.progress = boundary ? 1.0 : static_cast<double>(rem) * w.inverse;
+        info.normalized = static_cast<double>(elapsed) * w.inverse;
+        info.valid = true;
+        return info;
+    }
+}
+
+#endif //FRACTONICA_LUNARTIMEENGINE_H
@@ -0,0 +1,325 @@
+//
+// The generated eclipse catalogs as constexpr data (C++20).
+//
+// Every query on the catalogs is consteval, so the tables themselves never
+// reach the binary; only what a query returns does.  Use it for values known
+// at build time (alive series, series spans, the eclipse after a build
+// epoch); lookups at run time stay with saros.h.
+//
+
+#ifndef FRACTONICA_SAROSCATALOG_H
+#define FRACTONICA_SAROSCATALOG_H
+
+#if !defined(__cpp_consteval)
+#error "SarosCatalog.h needs C++20"
+#endif
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+#include <span>
+#include "saros.h"
+#ifdef ECLIPSE_USE_PROGMEM
+#include <avr/pgmspace.h>
+#endif
+
+// Alive series are taken at this moment (unix seconds) unless the build
+// sets its own; 2026-01-01, the date saros.h's hand-written tables are for.
+#ifndef SAROS_BUILD_EPOCH
+#define SAROS_BUILD_EPOCH 1767225600
+#endif
+
+// The data headers of both catalogs share guards and names, so each goes
+// into its own namespace, with its tables declared constexpr.
+#define ECLIPSE_CONST constexpr
+
+namespace Fractonica::SarosCatalog::SolarData {
+#include "saros/solar/eclipse_times_modern.h"
+#include "saros/solar/eclipse_info_modern.h"
+#include "saros/solar/saros_modern.h"
+    constexpr uint8_t First = ECLIPSE_MODERN_SAROS_FIRST;
+    constexpr uint8_t Last = ECLIPSE_MODERN_SAROS_LAST;
+}
+
+#undef ECLIPSE_TIMES_MODERN_H
+#undef ECLIPSE_INFO_MODERN_H
+#undef SAROS_MODERN_H
+#undef ECLIPSE_MODERN_COUNT
+#undef ECLIPSE_MODERN_SAROS_FIRST
+#undef ECLIPSE_MODERN_SAROS_LAST
+#undef ECLIPSE_MODERN_SAROS_COUNT
+
+namespace Fractonica::SarosCatalog::LunarData {
+#include "saros/lunar/eclipse_times_modern.h"
+#include "saros/lunar/eclipse_info_modern.h"
+#include "saros/lunar/saros_modern.h"
+    constexpr uint8_t First = ECLIPSE_MODERN_SAROS_FIRST;
+    constexpr uint8_t Last = ECLIPSE_MODERN_SAROS_LAST;
+}
+
+#undef ECLIPSE_TIMES_MODERN_H
+#undef ECLIPSE_INFO_MODERN_H
+#undef SAROS_MODERN_H
+#undef ECLIPSE_MODERN_COUNT
+#undef ECLIPSE_MODERN_SAROS_FIRST
+#undef ECLIPSE_MODERN_SAROS_LAST
+#undef ECLIPSE_MODERN_SAROS_COUNT
+#undef ECLIPSE_CONST
+
+namespace Fractonica::SarosCatalog {
+
+    enum class Kind : uint8_t { Solar, Lunar };
+
+    /** One catalog as raw build_db.py tables (the saros_db_t layout). */
+    struct Catalog {
+        std::span<const uint8_t> times;   // sorted little-endian int64
+        std::span<const uint8_t> info;    // ECLIPSE_INFO_SIZE-byte records
+        std::span<const uint8_t> saros;   // SAROS_RECORD_SIZE-byte records
+        uint8_t first;
+        uint8_t last;
+
+        [[nodiscard]] consteval uint32_t Count() const { return static_cast<uint32_t>(times.size() / 8); }
+        [[nodiscard]] consteval int64_t Time(uint32_t i) const;
+        [[nodiscard]] consteval uint8_t SarosNumber(uint32_t i) const { return info[i * ECLIPSE_INFO_SIZE + 6]; }
+        [[nodiscard]] consteval uint8_t SarosPos(uint32_t i) const { return info[i * ECLIPSE_INFO_SIZE + 7]; }
+        [[nodiscard]] consteval bool Has(uint8_t saros) const { return saros >= first && saros <= last; }
+
+        /** Eclipses in a series; 0 for a series outside the catalog. */
+        [[nodiscard]] consteval uint8_t SeriesCount(uint8_t saros) const {
+            return Has(saros) ? this->saros[(saros - first) * SAROS_RECORD_SIZE] : 0;
+        }
+
+        /** Global index of the eclipse at pos within a series. */
+        [[nodiscard]] consteval uint16_t SeriesIndex(uint8_t saros, uint8_t pos) const {
+            const size_t at = (saros - first) * SAROS_RECORD_SIZE + 2u + pos * 2u;
+            return static_cast<uint16_t>(this->saros[at] | this->saros[at + 1] << 8);
+        }
+    };
+
+    consteval int64_t Catalog::Time(const uint32_t i) const {
+        uint64_t v = 0;
+        for (int b = 7; b >= 0; --b) {
+            v = v << 8 | times[i * 8u + b];
+        }
+        return static_cast<int64_t>(v);
+    }
+
+    constexpr Catalog Solar{SolarData::eclipse_times_modern, SolarData::eclipse_info_modern,
+                            SolarData::saros_modern, SolarData::First, SolarData::Last};
+    constexpr Catalog Lunar{LunarData::eclipse_times_modern, LunarData::eclipse_info_modern,
+                            LunarData::saros_modern, LunarData::First, LunarData::Last};
+
+    consteval const Catalog &Get(const Kind kind) {
+        return kind == Kind::Lunar ? Lunar : Solar;
+    }
+
+    struct Eclipse {
+        int64_t time = 0;
+        uint32_t index = 0;     // position in the catalog
+        uint8_t saros = 0;
+        uint8_t pos = 0;        // position in the series
+        bool valid = false;
+    };
+
+    /** Eclipses of one series either side of a moment (saros_window_t). */
+    struct Window {
+        Eclipse past;
+        Eclipse future;
+    };
+
+    /** A whole series: first and last eclipse and how many there are. */
+    struct Series {
+        int64_t first = 0;
+        int64_t last = 0;
+        uint8_t count = 0;
+
+        [[nodiscard]] constexpr int64_t Duration() const { return last - first; }
+    };
+
+    // ── Queries ─────────────────────────────────────────────────────────
+
+    consteval Eclipse At(const Catalog &c, const uint32_t index) {
+        if (index >= c.Count()) return {};
+        return {c.Time(index), index, c.SarosNumber(index), c.SarosPos(index), true};
+    }
+
+    /** First catalog index whose time is >= timestamp (> if strict). */
+    consteval uint32_t Bound(const Catalog &c, const int64_t timestamp, const bool strict) {
+        uint32_t lo = 0, hi = c.Count();
+        while (lo < hi) {
+            const uint32_t mid = lo + (hi - lo) / 2;
+            const int64_t t = c.Time(mid);
+            if (strict ? t <= timestamp : t < timestamp) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    /** find_next_*_eclipse(): nearest eclipse at or after timestamp. */
+    consteval Eclipse NextEclipse(const Catalog &c, const int64_t timestamp) {
+        return At(c, Bound(c, timestamp, false));
+    }
+
+    /** find_past_*_eclipse(): nearest eclipse at or before timestamp. */
+    consteval Eclipse PastEclipse(const Catalog &c, const int64_t timestamp) {
+        const uint32_t i = Bound(c, timestamp, true);
+        return i ? At(c, i - 1) : Eclipse{};
+    }
+
+    /** find_*_saros_window(): past < timestamp <= future within one series. */
+    consteval Window SarosWindow(const Catalog &c, const int64_t timestamp, const uint8_t saros) {
+        Window w;
+        const uint8_t n = c.SeriesCount(saros);
+        uint8_t p = 0;
+        while (p < n && c.Time(c.SeriesIndex(saros, p)) < timestamp) ++p;
+        if (p < n) w.future = At(c, c.SeriesIndex(saros, p));
+        if (p > 0) w.past = At(c, c.SeriesIndex(saros, p - 1));
+        return w;
+    }
+
+    /** calculate_*_octal_phase(): timestamp in seconds, resolution 1/2/3. */
+    consteval uint64_t OctalPhase(const Catalog &c, const int64_t timestamp, const uint8_t saros,
+                                  const uint8_t resolution) {
+        const Window w = SarosWindow(c, timestamp, saros);
+        if (!w.past.valid || !w.future.valid) return 0;
+        const uint64_t total = static_cast<uint64_t>(w.future.time - w.past.time);
+        const unsigned bits = 12u * ((resolution + 2u) % 3u + 1u);
+        uint64_t r = static_cast<uint64_t>(timestamp - w.past.time);
+        uint64_t q = r / total;
+        r %= total;
+        for (unsigned b = 0; b < bits; ++b) {
+            r <<= 1;
+            q = q << 1 | (r >= total ? 1u : 0u);
+            if (r >= total) r -= total;
+        }
+        return q;
+    }
+
+    consteval Series ReadSeries(const Catalog &c, const uint8_t saros) {
+        const uint8_t n = c.SeriesCount(saros);
+        if (n == 0) return {};
+        return {c.Time(c.SeriesIndex(saros, 0)), c.Time(c.SeriesIndex(saros, n - 1)), n};
+    }
+
+    // ── Tables built at compile time ────────────────────────────────────
+
+    template<Kind K>
+    consteval auto MakeSeriesTable() {
+        constexpr const Catalog &c = Get(K);
+        std::array<Series, c.last - c.first + 1> table{};
+        for (size_t i = 0; i < table.size(); ++i) {
+            table[i] = ReadSeries(c, static_cast<uint8_t>(c.first + i));
+        }
+        return table;
+    }
+
+    /** Every series of a catalog, indexed by saros - first. */
+    template<Kind K>
+    inline constexpr auto SeriesTable = MakeSeriesTable<K>();
+
+    /** Series record of a saros number, empty outside the catalog. */
+    template<Kind K>
+    constexpr Series SeriesOf(const uint8_t saros) {
+        constexpr uint8_t first = Get(K).first;
+        const size_t i = static_cast<size_t>(saros - first);
+        return saros >= first && i < SeriesTable<K>.size() ? SeriesTable<K>[i] : Series{};
+    }
+
+    /**
+     * Series alive at Epoch (first eclipse <= Epoch <= last eclipse) in
+     * birth order, as saros.h's SarosOrderedByBirth / SarosIndexLookup, plus
+     * the length of each one's saros window at Epoch.
+     */
+    template<Kind K, int64_t Epoch>
+    class Alive {
+        static constexpr const auto &Table = SeriesTable<K>;
+        static constexpr uint8_t First = Get(K).first;
+
+        static consteval bool IsAlive(const Series &s) {
+            return s.count && s.first <= Epoch && Epoch <= s.last;
+        }
+
+        static consteval size_t CountAlive() {
+            size_t n = 0;
+            for (const Series &s : Table) n += IsAlive(s);
+            return n;
+        }
+
+    public:
+        static constexpr size_t Count = CountAlive();
+        static constexpr uint8_t NotAlive = 0xFF;
+
+    private:
+        static consteval std::array<uint8_t, Count> MakeByBirth() {
+            std::array<uint8_t, Count> out{};
+            size_t n = 0;
+            for (size_t i = 0; i < Table.size(); ++i) {
+                if (!IsAlive(Table[i])) continue;
+                // Insertion sort on the first eclipse; the tables are tiny.
+                size_t at = n++;
+                while (at > 0 && Table[out[at - 1] - First].first > Table[i].first) {
+                    out[at] = out[at - 1];
+                    --at;
+                }
+                out[at] = static_cast<uint8_t>(First + i);
+            }
+            return out;
+        }
+
+        static consteval std::array<uint8_t, 256> MakeIndex(const std::array<uint8_t, Count> &byBirth) {
+            std::array<uint8_t, 256> out{};
+            out.fill(NotAlive);
+            for (size_t i = 0; i < Count; ++i) out[byBirth[i]] = static_cast<uint8_t>(i);
+            return out;
+        }
+
+        static consteval std::array<int64_t, Count> MakeWindowSeconds(const std::array<uint8_t, Count> &byBirth) {
+            std::array<int64_t, Count> out{};
+            for (size_t i = 0; i < Count; ++i) {
+                const Window w = SarosWindow(Get(K), Epoch, byBirth[i]);
+                out[i] = w.past.valid && w.future.valid ? w.future.time - w.past.time : 0;
+            }
+            return out;
+        }
+
+        static consteval uint8_t Extreme(const std::array<uint8_t, Count> &byBirth, const bool oldest) {
+            uint8_t v = oldest ? 0 : 0xFF;
+            for (const uint8_t s : byBirth) v = (oldest ? s > v : s < v) ? s : v;
+            return v;
+        }
+
+    public:
+        /** Alive saros numbers, oldest series first. */
+        static constexpr std::array<uint8_t, Count> ByBirth = MakeByBirth();
+
+        /** Position in ByBirth by saros number, NotAlive for the rest. */
+        static constexpr std::array<uint8_t, 256> Index = MakeIndex(ByBirth);
+
+        /** Saros window length in seconds at Epoch, in ByBirth order. */
+        static constexpr std::array<int64_t, Count> WindowSeconds = MakeWindowSeconds(ByBirth);
+
+        /** Lowest and highest alive saros number. */
+        static constexpr uint8_t Youngest = Extreme(ByBirth, false);
+        static constexpr uint8_t Oldest = Extreme(ByBirth, true);
+    };
+
+    using AliveSolar = Alive<Kind::Solar, SAROS_BUILD_EPOCH>;
+    using AliveLunar = Alive<Kind::Lunar, SAROS_BUILD_EPOCH>;
+
+    // saros.h's tables are written by hand; hold them to the catalog.
+    namespace Detail {
+        consteval bool MatchesSarosTables() {
+            using A = Alive<Kind::Solar, 1767225600>;
+            if (A::Count != ALIVE_SAROS_COUNT) return false;
+            if (A::Youngest != YOUNGEST_SAROS || A::Oldest != OLDEST_SAROS) return false;
+            for (size_t i = 0; i < A::Count; ++i) {
+                if (SarosOrderedByBirth[i] != A::ByBirth[i]) return false;
+                if (SarosIndexLookup[A::ByBirth[i]] != i) return false;
+            }
+            return true;
+        }
+    }
+    static_assert(Detail::MatchesSarosTables(), "saros.h alive-series tables disagree with the catalog");
+}
+
+#endif //FRACTONICA_SAROSCATALOG_H
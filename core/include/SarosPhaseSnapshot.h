@@ -0,0 +1,220 @@
+//
+// Current saros phases shared between threads.
+//
+
+#ifndef FRACTONICA_SAROSPHASESNAPSHOT_H
+#define FRACTONICA_SAROSPHASESNAPSHOT_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "saros.h"
+
+namespace Fractonica {
+
+    /**
+     * Current octal bin of a fixed set of saros series at one or more
+     * resolutions, e.g. every alive series at resolution 2.
+     *
+     * One thread owns the clock and calls Update(now): until the earliest
+     * pending rollover that is a single compare, and then only the series
+     * that rolled over are advanced (saros_phase_tracker_t, no search while
+     * a window lasts).  Any number of other threads (audio callback, UI,
+     * input tasks) read through a sequence lock: O(1), never blocking the
+     * writer and never calling into saros.h.  Bins are stored as 32-bit
+     * halves, so the lock stays lock-free on 32-bit MCUs too.
+     *
+     * Configure() and Update() must come from the same thread.
+     */
+    template<size_t MaxSeries = ALIVE_SAROS_COUNT, size_t MaxResolutions = 3>
+    class SarosPhaseSnapshot {
+    public:
+        static constexpr uint8_t NoSlot = 0xFF;
+        static_assert(MaxSeries > 0 && MaxSeries < NoSlot, "slot indices are uint8_t");
+        static_assert(MaxResolutions > 0, "at least one resolution");
+
+        SarosPhaseSnapshot() {
+            for (auto &s : slots_) s.store(NoSlot, std::memory_order_relaxed);
+        }
+
+        SarosPhaseSnapshot(const SarosPhaseSnapshot &) = delete;
+        SarosPhaseSnapshot &operator=(const SarosPhaseSnapshot &) = delete;
+
+        // ── Writer ──────────────────────────────────────────────────────
+
+        /**
+         * Track count series (slot i = saros[i]) at each of the given
+         * resolutions (index r = resolutions[r]) and publish their bins at
+         * now.  scale: 1 for seconds, 1000 for milliseconds.  Extra series
+         * or resolutions beyond the template limits are ignored.
+         */
+        void Configure(const uint8_t *saros, size_t count, const uint8_t *resolutions,
+                       size_t resolutionCount, uint16_t scale, bool lunar, int64_t now);
+
+        /**
+         * Advance to now.  Returns true if any bin changed (and a new
+         * snapshot was published).  Time may also jump backwards.
+         */
+        bool Update(int64_t now);
+
+        /** Earliest moment any tracked bin changes; INT64_MAX if never. */
+        [[nodiscard]] int64_t NextChange() const { return nextChange_; }
+
+        // ── Readers (any thread) ────────────────────────────────────────
+
+        /** Bin of slot at resolution index r; 0 for an empty slot. */
+        [[nodiscard]] uint64_t Bin(size_t slot, size_t r = 0) const;
+
+        /** Bin of a tracked series; false if it is not tracked. */
+        bool TryGet(uint8_t sarosNumber, size_t r, uint64_t &bin) const;
+
+        /** Slot of a tracked series, NoSlot if it is not tracked. */
+        [[nodiscard]] uint8_t Slot(uint8_t sarosNumber) const {
+            return slots_[sarosNumber].load(std::memory_order_relaxed);
+        }
+
+        /** Changes with every published snapshot; cheap "anything new?" test. */
+        [[nodiscard]] uint32_t Version() const {
+            return seq_.load(std::memory_order_acquire) & ~1u;
+        }
+
+    private:
+        static constexpr size_t Capacity = MaxSeries * MaxResolutions;
+
+        template<typename F>
+        auto ReadConsistent(F read) const -> decltype(read());
+
+        void BeginWrite();
+        void EndWrite();
+        void Store(size_t i, uint64_t bin);
+        [[nodiscard]] uint64_t Load(size_t i) const;
+        void Refresh(int64_t now, bool all);
+
+        // Writer-only state
+        saros_phase_tracker_t trackers_[Capacity] = {};
+        size_t series_ = 0;
+        size_t resolutions_ = 0;
+        int64_t nextChange_ = INT64_MAX;
+        int64_t last_ = INT64_MIN;
+
+        // Shared state, written only between BeginWrite() and EndWrite()
+        std::atomic<uint32_t> seq_{0};
+        std::atomic<uint32_t> bins_[Capacity][2] = {};
+        std::atomic<uint8_t> slots_[256];
+        std::atomic<uint8_t> stride_{0};
+    };
+
+    template<size_t S, size_t R>
+    template<typename F>
+    auto SarosPhaseSnapshot<S, R>::ReadConsistent(F read) const -> decltype(read()) {
+        for (;;) {
+            const uint32_t before = seq_.load(std::memory_order_acquire);
+            if (before & 1u) continue;              // writer mid-update
+            auto value = read();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) return value;
+        }
+    }
+
+    template<size_t S, size_t R>
+    inline void SarosPhaseSnapshot<S, R>::BeginWrite() {
+        seq_.store(seq_.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    template<size_t S, size_t R>
+    inline void SarosPhaseSnapshot<S, R>::EndWrite() {
+        seq_.store(seq_.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+    template<size_t S, size_t R>
+    inline void SarosPhaseSnapshot<S, R>::Store(const size_t i, const uint64_t bin) {
+        bins_[i][0].store(static_cast<uint32_t>(bin), std::memory_order_relaxed);
+        bins_[i][1].store(static_cast<uint32_t>(bin >> 32), std::memory_order_relaxed);
+    }
+
+    template<size_t S, size_t R>
+    inline uint64_t SarosPhaseSnapshot<S, R>::Load(const size_t i) const {
+        return bins_[i][0].load(std::memory_order_relaxed)
+             | static_cast<uint64_t>(bins_[i][1].load(std::memory_order_relaxed)) << 32;
+    }
+
+    template<size_t S, size_t R>
+    void SarosPhaseSnapshot<S, R>::Configure(const uint8_t *saros, size_t count, const uint8_t *resolutions,
+                                             size_t resolutionCount, const uint16_t scale, const bool lunar,
+                                             const int64_t now) {
+        if (count > S) count = S;
+        if (resolutionCount > R) resolutionCount = R;
+
+        BeginWrite();
+        for (auto &s : slots_) s.store(NoSlot, std::memory_order_relaxed);
+        series_ = count;
+        resolutions_ = resolutionCount;
+        stride_.store(static_cast<uint8_t>(resolutionCount), std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t r = 0; r < resolutionCount; ++r) {
+                saros_phase_tracker_t *t = &trackers_[i * resolutionCount + r];
+                if (lunar) lunar_phase_tracker_init(t, saros[i], resolutions[r], scale);
+                else solar_phase_tracker_init(t, saros[i], resolutions[r], scale);
+            }
+            slots_[saros[i]].store(static_cast<uint8_t>(i), std::memory_order_relaxed);
+        }
+        for (size_t i = count * resolutionCount; i < Capacity; ++i) Store(i, 0);
+        Refresh(now, true);
+        EndWrite();
+    }
+
+    template<size_t S, size_t R>
+    bool SarosPhaseSnapshot<S, R>::Update(const int64_t now) {
+        const bool rewound = now < last_;
+        if (!rewound && now < nextChange_) {
+            last_ = now;
+            return false;
+        }
+        BeginWrite();
+        Refresh(now, rewound);
+        EndWrite();
+        return true;
+    }
+
+    // Advance every tracker due at now (or all of them) and find the next change.
+    template<size_t S, size_t R>
+    void SarosPhaseSnapshot<S, R>::Refresh(const int64_t now, const bool all) {
+        int64_t next = INT64_MAX;
+        for (size_t i = 0; i < series_ * resolutions_; ++i) {
+            saros_phase_tracker_t &t = trackers_[i];
+            if (all || t.next_change <= now) {
+                Store(i, saros_phase_tracker_update(&t, now));
+            }
+            if (t.next_change < next) next = t.next_change;
+        }
+        nextChange_ = next;
+        last_ = now;
+    }
+
+    template<size_t S, size_t R>
+    uint64_t SarosPhaseSnapshot<S, R>::Bin(const size_t slot, const size_t r) const {
+        if (slot >= S || r >= R) return 0;
+        return ReadConsistent([&] {
+            const size_t stride = stride_.load(std::memory_order_relaxed);
+            return r < stride ? Load(slot * stride + r) : 0;
+        });
+    }
+
+    template<size_t S, size_t R>
+    bool SarosPhaseSnapshot<S, R>::TryGet(const uint8_t sarosNumber, const size_t r, uint64_t &bin) const {
+        uint64_t value = 0;
+        const uint8_t slot = ReadConsistent([&] {
+            const size_t stride = stride_.load(std::memory_order_relaxed);
+            const uint8_t s = slots_[sarosNumber].load(std::memory_order_relaxed);
+            if (s == NoSlot || r >= stride) return NoSlot;
+            value = Load(s * stride + r);
+            return s;
+        });
+        if (slot == NoSlot) return false;
+        bin = value;
+        return true;
+    }
+}
+
+#endif //FRACTONICA_SAROSPHASESNAPSHOT_H
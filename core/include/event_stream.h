@@ -0,0 +1,191 @@
+/*
+ * event_stream.h — eclipses, saros rollovers and ephemeris events in time order
+ *
+ * Merges any number of sources into one stream over [t0, t1]:
+ *   - eclipse catalogs (saros_db_t: the compiled-in saros_solar_db /
+ *     saros_lunar_db of raw builds, or catalog files from saros_file.h;
+ *     under SAROS_USE_COMPACT only the files, since saros_db.h cannot
+ *     read the bit-packed tables and those builds define no saros_*_db),
+ *   - saros bin rollovers of a saros_rollover_queue_t,
+ *   - ephemeris timestamp tables (fractonica_mem_source_t: new_moon.h,
+ *     apogee.h, nodal_ascending.h, ...).
+ * Each source keeps one pending event and is only bisected once, when it
+ * is added; after that every event costs a comparison per source.  A
+ * thousand-year scan is one pass over the tables instead of one search per
+ * step of a simulated clock.
+ *
+ *   static const fractonica_mem_source_t new_moon = {
+ *       FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps, NULL };
+ *   fractonica_event_stream_t s;
+ *   fractonica_event_t        ev;
+ *   fractonica_events_init(&s, t0, t1);
+ *   fractonica_events_add_catalog(&s, &saros_solar_db, NULL);
+ *   fractonica_events_add_catalog(&s, &saros_lunar_db, NULL);
+ *   fractonica_events_add_ephemeris(&s, &new_moon, 0);      // tag: caller's choice
+ *   saros_rollover_queue_init(&q, trackers, n, t0);   // seconds trackers
+ *   fractonica_events_add_rollovers(&s, &q);
+ *   while (fractonica_events_next(&s, &ev)) { ... }
+ *
+ * Events at the same moment come out catalogs first, then ephemerides,
+ * then rollovers, each group in the order it was added.
+ */
+
+#ifndef FRACTONICA_EVENT_STREAM_H
+#define FRACTONICA_EVENT_STREAM_H
+
+#include "saros_db.h"
+#include "Ephemeris.h"
+
+#define FRACTONICA_EVENTS_MAX_CATALOGS    4u
+#define FRACTONICA_EVENTS_MAX_EPHEMERIDES 8u
+
+typedef enum {
+    FRACTONICA_EVENT_ECLIPSE   = 0,   /**< eclipse from a catalog */
+    FRACTONICA_EVENT_ROLLOVER  = 1,   /**< saros bin change */
+    FRACTONICA_EVENT_EPHEMERIS = 2    /**< ephemeris timestamp */
+} fractonica_event_kind_t;
+
+/** One event; which member of the union is set depends on kind. */
+typedef struct {
+    int64_t timestamp;           /**< unix seconds */
+    uint8_t kind;                /**< fractonica_event_kind_t */
+    uint8_t source;              /**< catalog / ephemeris position in the stream */
+    uint8_t tag;                 /**< ephemeris tag given to add_ephemeris() */
+    union {
+        eclipse_entry_t        eclipse;      /**< ECLIPSE; is_lunar from the db */
+        saros_rollover_event_t rollover;     /**< ROLLOVER */
+        uint32_t               index;        /**< EPHEMERIS: entry index */
+    } u;
+} fractonica_event_t;
+
+typedef struct {
+    int64_t                        t0, t1;
+    saros_range_t                  catalogs[FRACTONICA_EVENTS_MAX_CATALOGS];
+    eclipse_entry_t                pending[FRACTONICA_EVENTS_MAX_CATALOGS];
+    uint8_t                        has_pending[FRACTONICA_EVENTS_MAX_CATALOGS];
+    const fractonica_mem_source_t *ephemerides[FRACTONICA_EVENTS_MAX_EPHEMERIDES];
+    uint32_t                       ephemeris_next[FRACTONICA_EVENTS_MAX_EPHEMERIDES];
+    uint8_t                        ephemeris_tag[FRACTONICA_EVENTS_MAX_EPHEMERIDES];
+    saros_rollover_queue_t        *rollovers;
+    uint8_t                        catalog_count;
+    uint8_t                        ephemeris_count;
+} fractonica_event_stream_t;
+
+/**
+ * fractonica_events_init(s, t0, t1)
+ *   Empty stream over t0 <= timestamp <= t1.
+ *
+ * fractonica_events_add_catalog(s, db, filter)
+ *   Eclipses of db in the interval, optionally filtered (filter may be
+ *   NULL).  Returns 0 if FRACTONICA_EVENTS_MAX_CATALOGS are already added.
+ *
+ * fractonica_events_add_ephemeris(s, source, tag)
+ *   Timestamps of source in the interval; tag is copied into its events.
+ *   Returns 0 if FRACTONICA_EVENTS_MAX_EPHEMERIDES are already added.
+ *
+ * fractonica_events_add_rollovers(s, queue)
+ *   Bin changes popped from queue (already brought to t0 with
+ *   saros_rollover_queue_init(), timestamps in seconds).  The queue
+ *   advances with the stream.
+ *
+ * fractonica_events_next(s, &event)
+ *   Next event in time order; returns 0 once the interval is exhausted.
+ */
+static inline void fractonica_events_init(fractonica_event_stream_t *s, int64_t t0, int64_t t1)
+{
+    memset(s, 0, sizeof(*s));
+    s->t0 = t0;
+    s->t1 = t1;
+}
+
+static inline int fractonica_events_add_catalog(fractonica_event_stream_t *s, const saros_db_t *db,
+                                                const saros_range_filter_t *filter)
+{
+    const uint8_t i = s->catalog_count;
+
+    if (i >= FRACTONICA_EVENTS_MAX_CATALOGS)
+        return 0;
+    saros_db_range(&s->catalogs[i], db, s->t0, s->t1, filter);
+    s->has_pending[i] = (uint8_t)saros_range_next(&s->catalogs[i], &s->pending[i]);
+    s->catalog_count++;
+    return 1;
+}
+
+static inline int fractonica_events_add_ephemeris(fractonica_event_stream_t *s,
+                                                  const fractonica_mem_source_t *source, uint8_t tag)
+{
+    const uint8_t              i = s->ephemeris_count;
+    fractonica_search_result_t r;
+
+    if (i >= FRACTONICA_EVENTS_MAX_EPHEMERIDES)
+        return 0;
+    r = fractonica_find_closest(source, s->t0);
+    s->ephemerides[i]    = source;
+    s->ephemeris_tag[i]  = tag;
+    s->ephemeris_next[i] = r.found_future ? r.future_index : source->entry_count;
+    s->ephemeris_count++;
+    return 1;
+}
+
+static inline void fractonica_events_add_rollovers(fractonica_event_stream_t *s,
+                                                   saros_rollover_queue_t *queue)
+{
+    s->rollovers = queue;
+}
+
+static inline int fractonica_events_next(fractonica_event_stream_t *s, fractonica_event_t *event)
+{
+    int64_t best_time = 0;
+    int     best_kind = -1;
+    uint8_t best = 0, i;
+
+    for (i = 0; i < s->catalog_count; i++) {
+        if (s->has_pending[i] && (best_kind < 0 || s->pending[i].unix_time < best_time)) {
+            best_time = s->pending[i].unix_time;
+            best_kind = FRACTONICA_EVENT_ECLIPSE;
+            best      = i;
+        }
+    }
+    for (i = 0; i < s->ephemeris_count; i++) {
+        const fractonica_mem_source_t *src = s->ephemerides[i];
+        int64_t                        t;
+        if (s->ephemeris_next[i] >= src->entry_count)
+            continue;
+        t = fractonica_mem_get_timestamp(src, s->ephemeris_next[i]);
+        if (best_kind < 0 || t < best_time) {
+            best_time = t;
+            best_kind = FRACTONICA_EVENT_EPHEMERIS;
+            best      = i;
+        }
+    }
+    if (s->rollovers) {
+        const int64_t t = saros_rollover_queue_next(s->rollovers);
+        if (t != INT64_MAX && (best_kind < 0 || t < best_time)) {
+            best_time = t;
+            best_kind = FRACTONICA_EVENT_ROLLOVER;
+        }
+    }
+    if (best_kind < 0 || best_time > s->t1)
+        return 0;
+
+    memset(event, 0, sizeof(*event));
+    event->timestamp = best_time;
+    event->kind      = (uint8_t)best_kind;
+    event->source    = best;
+    switch (best_kind) {
+    case FRACTONICA_EVENT_ECLIPSE:
+        event->u.eclipse  = s->pending[best];
+        s->has_pending[best] = (uint8_t)saros_range_next(&s->catalogs[best], &s->pending[best]);
+        break;
+    case FRACTONICA_EVENT_EPHEMERIS:
+        event->tag     = s->ephemeris_tag[best];
+        event->u.index = s->ephemeris_next[best]++;
+        break;
+    default:
+        saros_rollover_queue_pop(s->rollovers, best_time, &event->u.rollover);
+        break;
+    }
+    return 1;
+}
+
+#endif /* FRACTONICA_EVENT_STREAM_H */
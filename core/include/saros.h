@@ -31,6 +31,11 @@
  *   #include "saros.h"                // declarations only — no SAROS_IMPL_*
  *   // call find_next_solar_eclipse(), find_next_lunar_eclipse(), etc.
  *
+ *   Both catalogs are also exported as saros_db_t tables (saros_solar_db,
+ *   saros_lunar_db).  saros_db.h searches any saros_db_t with inline
+ *   functions, so one translation unit can query both, or a merged
+ *   "next eclipse of any kind".
+ *
  * ── Data slices ───────────────────────────────────────────────────────────
  *   "modern"  Saros 110–173  (default, ~4500 eclipses, lower flash usage)
  *   "all"     Saros   1–180  (full catalog, ~13000 eclipses)
@@ -41,11 +46,35 @@
  * ── PROGMEM (AVR / ESP32) ─────────────────────────────────────────────────
  *   Define ECLIPSE_USE_PROGMEM before including the data headers.
  *   The data headers define the ECLIPSE_READ_* macros accordingly.
+ *
+ * ── Compact data (SAROS_USE_COMPACT) ─────────────────────────────────────
+ *   Define SAROS_USE_COMPACT and include eclipse_times_<slice>_compact.h /
+ *   eclipse_info_<slice>_compact.h (scripts/build_compact_db.py) instead of
+ *   the raw times and info headers.  Timestamps are frame-of-reference
+ *   packed in blocks of 32 behind an int64 skip index, and info records
+ *   are bit-packed to 58-59 bits, so "modern" drops from ~96 KB to ~64 KB
+ *   per catalog.
+ *   The API is unchanged.  Lookups bisect the skip index, then one block;
+ *   every other read decodes its value in place.  saros_<slice>.h is
+ *   shared by both formats.
+ *
+ * ── Search index (hosted builds) ──────────────────────────────────────────
+ *   Define SAROS_USE_EYTZINGER in the implementation units to search a
+ *   cache-friendly copy of the times array (Eytzinger / BFS order) instead
+ *   of bisecting the packed bytes.  The copy is built on first use or by
+ *   init_solar_search_index() / init_lunar_search_index(), and costs
+ *   10 bytes of RAM per eclipse.  Ignored on Arduino and PROGMEM builds.
+ *
+ *   Hosted builds also materialise each Saros series into a contiguous
+ *   int64 array the first time it is searched (768 bytes per series), so
+ *   find_*_saros_window() bisects native values instead of reloading the
+ *   194-byte index record.  Define SAROS_NO_SERIES_CACHE to opt out.
  */
 
 #ifndef SAROS_H
 #define SAROS_H
 #include <math.h>
+#include <stddef.h>   /* size_t */
 #include <stdint.h>
 #include <string.h>   /* memset, memcpy */
 
@@ -119,6 +148,26 @@ typedef enum {
     LUNAR_ECL_TYPE_COUNT = 13
 } lunar_eclipse_type_t;
 
+/** Type masks (bit = 1 << ecl_type) for saros_range_filter_t. */
+#define SAROS_ECL_BIT(type)     (1UL << (type))
+#define SOLAR_ECL_MASK_ANNULAR  (SAROS_ECL_BIT(SOLAR_ECL_A)  | SAROS_ECL_BIT(SOLAR_ECL_Aplus) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_Aminus) | SAROS_ECL_BIT(SOLAR_ECL_Am) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_An) | SAROS_ECL_BIT(SOLAR_ECL_As))
+#define SOLAR_ECL_MASK_HYBRID   (SAROS_ECL_BIT(SOLAR_ECL_H)  | SAROS_ECL_BIT(SOLAR_ECL_H2) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_H3) | SAROS_ECL_BIT(SOLAR_ECL_Hm))
+#define SOLAR_ECL_MASK_PARTIAL  (SAROS_ECL_BIT(SOLAR_ECL_P)  | SAROS_ECL_BIT(SOLAR_ECL_Pb) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_Pe))
+#define SOLAR_ECL_MASK_TOTAL    (SAROS_ECL_BIT(SOLAR_ECL_T)  | SAROS_ECL_BIT(SOLAR_ECL_Tplus) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_Tminus) | SAROS_ECL_BIT(SOLAR_ECL_Tm) | \
+                                 SAROS_ECL_BIT(SOLAR_ECL_Tn) | SAROS_ECL_BIT(SOLAR_ECL_Ts))
+#define LUNAR_ECL_MASK_PENUMBRAL (SAROS_ECL_BIT(LUNAR_ECL_N) | SAROS_ECL_BIT(LUNAR_ECL_Nb) | \
+                                  SAROS_ECL_BIT(LUNAR_ECL_Ne) | SAROS_ECL_BIT(LUNAR_ECL_Nx))
+#define LUNAR_ECL_MASK_PARTIAL  (SAROS_ECL_BIT(LUNAR_ECL_P)  | SAROS_ECL_BIT(LUNAR_ECL_Pb) | \
+                                 SAROS_ECL_BIT(LUNAR_ECL_Pe))
+#define LUNAR_ECL_MASK_TOTAL    (SAROS_ECL_BIT(LUNAR_ECL_T)  | SAROS_ECL_BIT(LUNAR_ECL_Tplus) | \
+                                 SAROS_ECL_BIT(LUNAR_ECL_Tminus) | SAROS_ECL_BIT(LUNAR_ECL_Tm) | \
+                                 SAROS_ECL_BIT(LUNAR_ECL_Tn) | SAROS_ECL_BIT(LUNAR_ECL_Ts))
+
 /** Decoded solar eclipse record (expanded from the 10-byte packed form). */
 typedef struct {
     int16_t  latitude_deg10;   /**< latitude  × 10, e.g. 633 = 63.3°N */
@@ -180,12 +229,101 @@ typedef struct {
     uint8_t         saros_number;
 } saros_window_t;
 
+/**
+ * saros_phase_tracker_t — incremental calculate_*_octal_phase(_ms)().
+ *
+ * Caches the current [past, future] window of one series together with a
+ * fixed-point reciprocal of its length, so an update whose timestamp is
+ * still inside the window costs a few integer multiplies and no search.
+ * Built for clock loops whose time only moves forward, but any timestamp
+ * is accepted: leaving the window simply triggers a new search.
+ *
+ * next_change is the first timestamp (in tracker units) at which the bin
+ * returned by the last update changes, so callers can sleep until then.
+ * Before a series starts it is the moment its first window opens; it is
+ * INT64_MAX once the series has ended.
+ * All fields are read-only for callers.
+ */
+typedef struct {
+    int64_t  past;          /**< window start, seconds */
+    int64_t  future;        /**< window end, seconds */
+    uint64_t total;         /**< window length in tracker units */
+    uint64_t recip;         /**< floor((2^(63+total_bits) - 1) / total) */
+    int64_t  next_change;   /**< next bin change, tracker units */
+    uint64_t bin;           /**< bin returned by the last update */
+    uint32_t scale;         /**< 1 = seconds, 1000 = ms, SAROS_NS_PER_SECOND = ns */
+    uint8_t  saros_number;
+    uint8_t  bits;          /**< log2 of bins per window (12/24/36, or 3 * digits) */
+    uint8_t  total_bits;    /**< bit length of total */
+    uint8_t  is_lunar;
+    uint8_t  valid;         /**< 1 while past/future hold a complete window */
+    uint8_t  floor_key;     /**< 1 for *_init_ns trackers: windows are [past, future) */
+} saros_phase_tracker_t;
+
+/**
+ * saros_phase_t — position inside a saros window as an unsigned 0.64
+ * fixed-point fraction: 0 at the window's first eclipse, 2^64 (which
+ * wraps to 0) at the next one.  One unit is about 3e-11 ns of an 18-year
+ * window, so every nanosecond timestamp has its own phase.  The top
+ * 3 * n bits are the n-digit octal bin, n = 1..SAROS_PHASE_MAX_DIGITS
+ * (saros_phase_digits()).
+ */
+typedef uint64_t saros_phase_t;
+
+#define SAROS_PHASE_MAX_DIGITS 21
+#define SAROS_NS_PER_SECOND    1000000000u
+
+/**
+ * saros_rollover_queue_t — upcoming digit changes of several series, in
+ * time order.  A binary min-heap over caller-owned trackers keyed on their
+ * next_change, so the earliest change is always at the root and a clock
+ * can sleep until saros_rollover_queue_next() instead of polling.
+ */
+typedef struct {
+    saros_phase_tracker_t *trackers;   /**< heap storage (caller-owned) */
+    uint8_t                count;
+} saros_rollover_queue_t;
+
+/**
+ * saros_db_t — one eclipse catalog as plain tables (raw build_db.py layout),
+ * so a single set of search functions (saros_db.h) serves every catalog
+ * and can be inlined into the caller.  The pointers may come from the
+ * compiled-in data (saros_solar_db / saros_lunar_db) or from a file.
+ */
+typedef struct {
+    const uint8_t *times;        /**< count sorted int64 timestamps, little-endian */
+    const uint8_t *info;         /**< count ECLIPSE_INFO_SIZE-byte info records */
+    const uint8_t *saros;        /**< one SAROS_RECORD_SIZE record per series */
+    uint32_t       count;
+    uint8_t        saros_first;
+    uint8_t        saros_last;
+    uint8_t        is_lunar;
+} saros_db_t;
+
+/** One digit change popped from a saros_rollover_queue_t. */
+typedef struct {
+    int64_t  timestamp;        /**< moment of the change, tracker units */
+    uint64_t bin;              /**< bin from that moment on */
+    uint8_t  saros_number;
+    uint8_t  is_lunar;
+} saros_rollover_event_t;
+
 #define ALIVE_SAROS_COUNT 40
 #define OLDEST_SAROS 156
 #define YOUNGEST_SAROS 117
 #define AVERAGE_SAROS_PERIOD_SECONDS 568971789
 
-const static uint8_t SarosIndexLookup[157] = {
+/* constexpr in C++ so SarosCatalog.h can check them against the catalog
+ * at compile time. */
+#ifdef __cplusplus
+#  define _SAROS_TABLE static constexpr
+#else
+#  define _SAROS_TABLE static const
+#endif
+
+/* Alive series (solar, at the start of 2026) in birth order, and each
+ * series' position in that order. */
+_SAROS_TABLE uint8_t SarosIndexLookup[157] = {
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -193,10 +331,12 @@ const static uint8_t SarosIndexLookup[157] = {
     21,22,23,25,27,26,33,29,24,28,30,31,32,34,35,36,37,38,39
 };
 
-const static uint8_t SarosOrderedByBirth[ALIVE_SAROS_COUNT] = {
+_SAROS_TABLE uint8_t SarosOrderedByBirth[ALIVE_SAROS_COUNT] = {
     117,118,119,120,121,128,122,127,124,125,123,130,129,131,126,132,133,134,135,136,137,138,139,140,146,141,143,142,147,145,148,149,150,144,151,152,153,154,155,156
 };
 
+#undef _SAROS_TABLE
+
 /* ── Public API ─────────────────────────────────────────────────────────── */
 
 #ifdef __cplusplus
@@ -226,22 +366,147 @@ eclipse_result_t find_past_solar_eclipse(int64_t timestamp);
  */
 saros_window_t find_solar_saros_window(int64_t timestamp, uint8_t saros_number);
 
+/**
+ * find_next_solar_eclipses(ts, n, out) / find_past_solar_eclipses(ts, n, out)
+ *   Batch form of find_next/past_solar_eclipse for n timestamps.
+ *   out[i] receives the same result as the single-timestamp call for ts[i].
+ *   Best with ascending input: each search gallops from the previous index,
+ *   and runs of samples landing on the same eclipse reuse the decoded result.
+ *   Unsorted input is still answered correctly, just without the speed-up.
+ */
+void find_next_solar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out);
+void find_past_solar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out);
 
-
-/** Same three functions for lunar eclipses. */
+/** Same functions for lunar eclipses. */
 eclipse_result_t find_next_lunar_eclipse(int64_t timestamp);
 eclipse_result_t find_past_lunar_eclipse(int64_t timestamp);
 saros_window_t find_lunar_saros_window(int64_t timestamp, uint8_t saros_number);
+void find_next_lunar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out);
+void find_past_lunar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out);
+
+/**
+ * init_solar_search_index() / init_lunar_search_index()
+ *   Build the SAROS_USE_EYTZINGER search index now instead of on the first
+ *   lookup.  Safe to call more than once and from any thread; a no-op when
+ *   the index is not compiled in.
+ */
+void init_solar_search_index(void);
+void init_lunar_search_index(void);
 uint64_t calculate_solar_octal_phase(int64_t timestamp, uint8_t saros_number, uint8_t resolution);
 uint64_t calculate_solar_octal_phase_ms(int64_t timestamp, uint8_t saros_number, uint8_t resolution);
 uint64_t calculate_lunar_octal_phase(int64_t timestamp, uint8_t saros_number, uint8_t resolution);
 uint64_t calculate_lunar_octal_phase_ms(int64_t timestamp, uint8_t saros_number, uint8_t resolution);
 void get_solar_saros_series(uint8_t saros_number, int64_t times[SAROS_MAX_ECLIPSES], uint8_t *count);
+
+/**
+ * calculate_solar_octal_phases(ts, saros, n, resolution, out) / ..._ms(...)
+ *   out[i] = calculate_solar_octal_phase(_ms)(ts, saros[i], resolution),
+ *   e.g. for all ALIVE_SAROS_COUNT series in SarosOrderedByBirth at once.
+ *   Hosted builds keep each series' window and reciprocal in a per-thread
+ *   cache, so a call only searches series whose window has expired; the
+ *   rest cost a multiply each.  Same for the lunar catalog.
+ */
+void calculate_solar_octal_phases(int64_t timestamp, const uint8_t *saros, size_t n,
+                                  uint8_t resolution, uint64_t *out);
+void calculate_solar_octal_phases_ms(int64_t timestamp, const uint8_t *saros, size_t n,
+                                     uint8_t resolution, uint64_t *out);
+void calculate_lunar_octal_phases(int64_t timestamp, const uint8_t *saros, size_t n,
+                                  uint8_t resolution, uint64_t *out);
+void calculate_lunar_octal_phases_ms(int64_t timestamp, const uint8_t *saros, size_t n,
+                                     uint8_t resolution, uint64_t *out);
 uint64_t get_solar_saros_period_duration_ms(int64_t timestamp, uint8_t saros_number, uint8_t period);
 uint64_t get_solar_rollover_epoch(int64_t timestamp, uint8_t saros_number, uint64_t bin);
 uint64_t get_average_rollover_epoch(int64_t reference, int64_t timestamp, uint64_t bin);
 uint64_t get_average_bin(int64_t reference, int64_t timestamp, uint16_t scale, uint8_t resolution);
 
+/**
+ * solar_phase_tracker_init(t, saros, resolution, scale) / lunar_phase_tracker_init(...)
+ *   Prepare a tracker for one series.  scale selects the timestamp unit of
+ *   saros_phase_tracker_update(): 1 for seconds (calculate_*_octal_phase)
+ *   or 1000 for milliseconds (calculate_*_octal_phase_ms).
+ *
+ * saros_phase_tracker_update(t, ts)
+ *   Same value as calculate_*_octal_phase(_ms)(ts, saros, resolution);
+ *   only searches when ts leaves the cached window.  Updates next_change.
+ */
+void     solar_phase_tracker_init(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                  uint8_t resolution, uint16_t scale);
+void     lunar_phase_tracker_init(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                  uint8_t resolution, uint16_t scale);
+uint64_t saros_phase_tracker_update(saros_phase_tracker_t *tracker, int64_t timestamp);
+
+/**
+ * calculate_solar_phase_ns(ts_ns, saros) / calculate_lunar_phase_ns(...)
+ *   saros_phase_t of the series at ts_ns (nanoseconds since the epoch, so
+ *   years 1678..2262).  The window is [past, future) to the nanosecond:
+ *   the phase is 0 exactly at each eclipse.  0 outside the series.
+ *
+ * solar_phase_tracker_init_ns(t, saros, digits) / lunar_phase_tracker_init_ns(...)
+ *   Tracker taking nanosecond timestamps whose saros_phase_tracker_update()
+ *   returns saros_phase_digits(calculate_*_phase_ns(ts, saros), digits),
+ *   digits = 1..SAROS_PHASE_MAX_DIGITS, searching only on window changes.
+ *   Works with saros_rollover_queue_t like any other tracker.
+ *
+ * saros_phase_tracker_phase(t, ts)
+ *   Full saros_phase_t at ts from the tracker's cached window, for
+ *   per-sample audio or per-frame animation; searches only when ts leaves
+ *   the window and leaves bin / next_change alone.  For trackers of any
+ *   scale; ts in the tracker's units.  Second and millisecond windows are
+ *   (past, future] in whole keys, so they run on to the end of the closing
+ *   eclipse's key; from the eclipse to there the phase stays at UINT64_MAX.
+ */
+saros_phase_t calculate_solar_phase_ns(int64_t timestamp_ns, uint8_t saros_number);
+saros_phase_t calculate_lunar_phase_ns(int64_t timestamp_ns, uint8_t saros_number);
+void          solar_phase_tracker_init_ns(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                          uint8_t digits);
+void          lunar_phase_tracker_init_ns(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                          uint8_t digits);
+saros_phase_t saros_phase_tracker_phase(saros_phase_tracker_t *tracker, int64_t timestamp);
+
+/**
+ * saros_phase_digits(phase, digits)
+ *   The first digits octal digits of phase as a bin in [0, 8^digits);
+ *   digits is clamped to SAROS_PHASE_MAX_DIGITS.
+ */
+static inline uint64_t saros_phase_digits(saros_phase_t phase, uint8_t digits)
+{
+    if (digits == 0u)
+        return 0;
+    if (digits > SAROS_PHASE_MAX_DIGITS)
+        digits = SAROS_PHASE_MAX_DIGITS;
+    return phase >> (64u - 3u * digits);
+}
+
+/**
+ * saros_rollover_queue_init(q, trackers, count, ts)
+ *   Takes count trackers prepared with solar/lunar_phase_tracker_init()
+ *   (any mix of series, both catalogs; all with the same scale), brings
+ *   them to ts and orders them.  The array is reordered in place and must
+ *   outlive the queue.
+ *
+ * saros_rollover_queue_next(q)
+ *   Timestamp of the earliest pending change; INT64_MAX if none.
+ *
+ * saros_rollover_queue_pop(q, ts, &event)
+ *   If a change is due at or before ts, fills event, advances that series
+ *   and returns 1; otherwise returns 0.  Call in a loop to drain every
+ *   change up to ts in time order.
+ */
+void    saros_rollover_queue_init(saros_rollover_queue_t *queue, saros_phase_tracker_t *trackers,
+                                  uint8_t count, int64_t timestamp);
+int64_t saros_rollover_queue_next(const saros_rollover_queue_t *queue);
+int     saros_rollover_queue_pop(saros_rollover_queue_t *queue, int64_t timestamp,
+                                 saros_rollover_event_t *event);
+
+/**
+ * saros_solar_db / saros_lunar_db
+ *   The compiled-in catalogs as saros_db_t, for the saros_db.h engine.
+ *   Defined by solar_impl.c / lunar_impl.c; not available when those are
+ *   built with SAROS_USE_COMPACT.
+ */
+extern const saros_db_t saros_solar_db;
+extern const saros_db_t saros_lunar_db;
+
 #ifdef __cplusplus
 }
 #endif
@@ -264,14 +529,13 @@ static eclipse_result_t find_closest_solar_eclipse(int64_t timestamp)
     return (d_pst < d_nxt) ? pst : nxt;
 }
 
+/* Position of an alive series in SarosOrderedByBirth, -1 if it is not
+ * alive.  The alive series are exactly YOUNGEST_SAROS..OLDEST_SAROS. */
 static int8_t get_alive_saros_index(const uint8_t number)
 {
-    for (uint8_t i = 0; i < ALIVE_SAROS_COUNT; i++) {
-        if (SarosOrderedByBirth[i] == number) {
-            return (int8_t) i;
-        }
-    }
-    return -1;
+    if (number < YOUNGEST_SAROS || number > OLDEST_SAROS)
+        return -1;
+    return (int8_t) SarosIndexLookup[number];
 }
 
 /**
@@ -290,6 +554,179 @@ static inline eclipse_result_t find_closest_lunar_eclipse(int64_t timestamp)
     return (d_pst < d_nxt) ? pst : nxt;
 }
 
+/* ══════════════════════════════════════════════════════════════════════════ *
+ * Internal helpers shared by the implementation units and saros_db.h.        *
+ * Catalog-independent: they only see the arrays they are handed.             *
+ * ══════════════════════════════════════════════════════════════════════════ */
+
+/* ── Low-level PROGMEM / RAM accessors ─────────────────────────────────── */
+
+static inline int64_t _saros_read_i64(const uint8_t *arr, uint32_t idx)
+{
+    const uint8_t *p = arr + idx * 8u;
+    uint64_t lo = (uint64_t)ECLIPSE_READ_DWORD(p);
+    uint64_t hi = (uint64_t)ECLIPSE_READ_DWORD(p + 4u);
+    return (int64_t)(lo | (hi << 32));
+}
+
+/* ── Decoders ───────────────────────────────────────────────────────────── */
+
+static inline solar_eclipse_info_t _decode_solar(const uint8_t b[ECLIPSE_INFO_SIZE])
+{
+    solar_eclipse_info_t r;
+    r.latitude_deg10   = (int16_t)((uint16_t)b[0] | ((uint16_t)b[1] << 8));
+    r.longitude_deg10  = (int16_t)((uint16_t)b[2] | ((uint16_t)b[3] << 8));
+    r.central_duration = (uint16_t)b[4] | ((uint16_t)b[5] << 8);
+    r.saros_number     = b[6];
+    r.saros_pos        = b[7];
+    r.ecl_type         = b[8];
+    r.sun_alt          = b[9];
+    return r;
+}
+
+static inline lunar_eclipse_info_t _decode_lunar(const uint8_t b[ECLIPSE_INFO_SIZE])
+{
+    lunar_eclipse_info_t r;
+    r.pen_duration   = (uint16_t)b[0] | ((uint16_t)b[1] << 8);
+    r.par_duration   = (uint16_t)b[2] | ((uint16_t)b[3] << 8);
+    r.total_duration = (uint16_t)b[4] | ((uint16_t)b[5] << 8);
+    r.saros_number   = b[6];
+    r.saros_pos      = b[7];
+    r.ecl_type       = b[8];
+    r._pad           = 0;
+    return r;
+}
+
+/* ── Fixed-point bin arithmetic ─────────────────────────────────────────── */
+
+/*
+ * bin = floor(elapsed * 2^bits / total) without floating point.  total gets
+ * a normalised reciprocal once per window; a bin is then one 64x64->128
+ * multiply, a shift and a single correction step.  Exact while elapsed is
+ * below 2^(total_bits + 1), which holds for every in-window timestamp.
+ * The 128-bit products are split into 32-bit halves where the compiler
+ * has no native 128-bit type (ESP32, AVR).
+ */
+typedef struct {
+    uint64_t hi, lo;
+} _saros_u128;
+
+static inline _saros_u128 _u128_mul(uint64_t a, uint64_t b)
+{
+    _saros_u128 r;
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128)a * b;
+    r.hi = (uint64_t)(p >> 64);
+    r.lo = (uint64_t)p;
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+    uint64_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    r.lo = (mid << 32) | (uint32_t)ll;
+    r.hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+    return r;
+}
+
+/* Low 64 bits of x >> n, 0 <= n < 128. */
+static inline uint64_t _u128_shr(_saros_u128 x, uint8_t n)
+{
+    if (n == 0u)  return x.lo;
+    if (n < 64u)  return (x.lo >> n) | (x.hi << (64u - n));
+    return x.hi >> (n - 64u);
+}
+
+/* a <= b */
+static inline int _u128_le(_saros_u128 a, _saros_u128 b)
+{
+    return (a.hi < b.hi) || (a.hi == b.hi && a.lo <= b.lo);
+}
+
+static inline uint8_t _saros_bit_length(uint64_t v)
+{
+    uint8_t n = 0;
+    while (v) {
+        v >>= 1;
+        n++;
+    }
+    return n;
+}
+
+/*
+ * floor(a * 2^shift / d) with 64-bit divisions only: the shift is fed in
+ * chunks small enough that the running remainder never overflows.  d must
+ * be below 2^62 and the quotient must fit in 64 bits.  Two or three
+ * divisions for the window lengths in the catalogs.
+ */
+static inline uint64_t _saros_div_pow2(uint64_t a, uint8_t shift, uint64_t d)
+{
+    const uint8_t step_max = (uint8_t)(63u - _saros_bit_length(d));
+    uint64_t      q = a / d, r = a % d;
+
+    while (shift) {
+        uint8_t step = (shift < step_max) ? shift : step_max;
+        r <<= step;
+        q = (q << step) + r / d;
+        r %= d;
+        shift = (uint8_t)(shift - step);
+    }
+    return q;
+}
+
+/* floor((2^(63 + bit_length(d)) - 1) / d), once per window.  The result
+ * lies in [2^63, 2^64). */
+static inline uint64_t _saros_reciprocal(uint64_t d, uint8_t d_bits)
+{
+    uint64_t q = _saros_div_pow2(1u, (uint8_t)(63u + d_bits), d);
+    return ((d & (d - 1u)) == 0u) ? q - 1u : q;
+}
+
+/* floor(elapsed * 2^bits / total) for elapsed < total and bits <= 64, from
+ * the reciprocal of _saros_reciprocal(). */
+static inline uint64_t _saros_fixed_bin(uint64_t elapsed, uint64_t total,
+                                        uint64_t recip, uint8_t total_bits,
+                                        uint8_t bits)
+{
+    _saros_u128 x, p;
+    uint64_t    q;
+
+    if (total == 0u)
+        return 0;
+    q = _u128_shr(_u128_mul(elapsed, recip), (uint8_t)(63u + total_bits - bits));
+
+    /* q is exact or a little short: bump while (q + 1) * total <= elapsed << bits */
+    x.hi = (bits == 0u) ? 0u : (bits < 64u) ? (elapsed >> (64u - bits)) : elapsed;
+    x.lo = (bits < 64u) ? (elapsed << bits) : 0u;
+    for (;;) {
+        p = _u128_mul(q + 1u, total);
+        if (!_u128_le(p, x))
+            break;
+        q++;
+    }
+    return q;
+}
+
+/* Smallest elapsed at which the bin reaches bin + 1:
+ * ceil((bin + 1) * total / 2^bits). */
+static inline uint64_t _saros_bin_start(uint64_t bin, uint64_t total, uint8_t bits)
+{
+    _saros_u128 p = _u128_mul(bin + 1u, total);
+    uint64_t    e = _u128_shr(p, bits);
+    uint64_t    mask = (bits == 0u) ? 0u : (bits < 64u) ? (((uint64_t)1 << bits) - 1u) : ~(uint64_t)0;
+    if (p.lo & mask)
+        e++;
+    return e;
+}
+
+/* Bins per window as a power of two, with the same wrap-around as
+ * calculate_*_octal_phase(): resolution 1/2/3 -> 4/8/12 octal digits. */
+static inline uint8_t _saros_resolution_bits(uint8_t resolution)
+{
+    return (uint8_t)(12u * (((unsigned)resolution + 2u) % 3u + 1u));
+}
+
 /* ══════════════════════════════════════════════════════════════════════════ *
  * Implementation — compiled only when SAROS_IMPL_SOLAR or SAROS_IMPL_LUNAR  *
  * is defined (typically in the dedicated .c / .cpp translation unit).        *
@@ -307,15 +744,41 @@ static inline eclipse_result_t find_closest_lunar_eclipse(int64_t timestamp)
  *   saros_modern[]         / saros_all[]
  */
 #ifdef SAROS_USE_ALL
-#  define _SAROS_TIMES_ARR   eclipse_times_all
-#  define _SAROS_INFO_ARR    eclipse_info_all
+#  ifdef SAROS_USE_COMPACT
+#    define _SAROS_TIMES_ARR      eclipse_times_all_packed
+#    define _SAROS_TIMES_BASE     eclipse_times_all_base
+#    define _SAROS_TIMES_FRAME    eclipse_times_all_frame
+#    define _SAROS_BLOCK_SIZE     ECLIPSE_ALL_BLOCK_SIZE
+#    define _SAROS_BLOCKS         ECLIPSE_ALL_BLOCKS
+#    define _SAROS_INFO_ARR       eclipse_info_all_packed
+#    define _SAROS_INFO_BIAS      eclipse_info_all_bias
+#    define _SAROS_INFO_WIDTH     eclipse_info_all_width
+#    define _SAROS_INFO_BITS      ECLIPSE_ALL_INFO_BITS
+#    define _SAROS_INFO_NULLABLE  ECLIPSE_ALL_INFO_NULLABLE
+#  else
+#    define _SAROS_TIMES_ARR   eclipse_times_all
+#    define _SAROS_INFO_ARR    eclipse_info_all
+#  endif
 #  define _SAROS_SAROS_ARR   saros_all
 #  define _SAROS_COUNT       ECLIPSE_ALL_COUNT
 #  define _SAROS_FIRST       ((uint8_t)ECLIPSE_ALL_SAROS_FIRST)
 #  define _SAROS_LAST        ((uint8_t)ECLIPSE_ALL_SAROS_LAST)
 #else
-#  define _SAROS_TIMES_ARR   eclipse_times_modern
-#  define _SAROS_INFO_ARR    eclipse_info_modern
+#  ifdef SAROS_USE_COMPACT
+#    define _SAROS_TIMES_ARR      eclipse_times_modern_packed
+#    define _SAROS_TIMES_BASE     eclipse_times_modern_base
+#    define _SAROS_TIMES_FRAME    eclipse_times_modern_frame
+#    define _SAROS_BLOCK_SIZE     ECLIPSE_MODERN_BLOCK_SIZE
+#    define _SAROS_BLOCKS         ECLIPSE_MODERN_BLOCKS
+#    define _SAROS_INFO_ARR       eclipse_info_modern_packed
+#    define _SAROS_INFO_BIAS      eclipse_info_modern_bias
+#    define _SAROS_INFO_WIDTH     eclipse_info_modern_width
+#    define _SAROS_INFO_BITS      ECLIPSE_MODERN_INFO_BITS
+#    define _SAROS_INFO_NULLABLE  ECLIPSE_MODERN_INFO_NULLABLE
+#  else
+#    define _SAROS_TIMES_ARR   eclipse_times_modern
+#    define _SAROS_INFO_ARR    eclipse_info_modern
+#  endif
 #  define _SAROS_SAROS_ARR   saros_modern
 #  define _SAROS_COUNT       ECLIPSE_MODERN_COUNT
 #  define _SAROS_FIRST       ((uint8_t)ECLIPSE_MODERN_SAROS_FIRST)
@@ -324,14 +787,72 @@ static inline eclipse_result_t find_closest_lunar_eclipse(int64_t timestamp)
 
 #define SAROS_COUNT _SAROS_COUNT
 
+/* Every series reader steps through the records in SAROS_RECORD_SIZE
+ * strides; refuse to build against a saros_<slice>.h generated with a
+ * different record size (the array would be silently misread). */
+typedef char _saros_record_stride_check[
+    (sizeof(_SAROS_SAROS_ARR) == (size_t)(_SAROS_LAST - _SAROS_FIRST + 1u) * SAROS_RECORD_SIZE) ? 1 : -1];
+
+/* Hosted = plain RAM data and a libc; RAM caches are only built there. */
+#if !defined(ARDUINO) && !defined(ECLIPSE_USE_PROGMEM)
+#  define _SAROS_HOSTED 1
+#endif
+
+#if defined(SAROS_USE_EYTZINGER) && defined(_SAROS_HOSTED)
+#  define _SAROS_EYTZINGER 1
+#endif
+
+#if !defined(SAROS_NO_SERIES_CACHE) && defined(_SAROS_HOSTED)
+#  define _SAROS_SERIES_CACHE 1
+#endif
+
+/* ── One-shot initialisation flags (hosted caches) ───────────────────────── */
+
+#ifdef _SAROS_HOSTED
+#define _SAROS_STATE_EMPTY    0
+#define _SAROS_STATE_BUILDING 1
+#define _SAROS_STATE_READY    2
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+static inline long _saros_state_load(volatile long *p)
+{
+    return _InterlockedOr(p, 0);
+}
+static inline int _saros_state_claim(volatile long *p)
+{
+    return _InterlockedCompareExchange(p, _SAROS_STATE_BUILDING, _SAROS_STATE_EMPTY)
+           == _SAROS_STATE_EMPTY;
+}
+static inline void _saros_state_publish(volatile long *p)
+{
+    _InterlockedExchange(p, _SAROS_STATE_READY);
+}
+#else
+static inline long _saros_state_load(volatile long *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+static inline int _saros_state_claim(volatile long *p)
+{
+    long expected = _SAROS_STATE_EMPTY;
+    return __atomic_compare_exchange_n(p, &expected, _SAROS_STATE_BUILDING, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+static inline void _saros_state_publish(volatile long *p)
+{
+    __atomic_store_n(p, _SAROS_STATE_READY, __ATOMIC_RELEASE);
+}
+#endif
+#endif /* _SAROS_HOSTED */
+
 /* ── Low-level PROGMEM / RAM accessors ─────────────────────────────────── */
 
+#ifndef SAROS_USE_COMPACT
+
 static inline int64_t _saros_read_time(const uint8_t *arr, uint32_t idx)
 {
-    const uint8_t *p = arr + idx * 8u;
-    uint64_t lo = (uint64_t)ECLIPSE_READ_DWORD(p);
-    uint64_t hi = (uint64_t)ECLIPSE_READ_DWORD(p + 4u);
-    return (int64_t)(lo | (hi << 32));
+    return _saros_read_i64(arr, idx);
 }
 
 
@@ -343,6 +864,66 @@ static inline void _saros_read_info_raw(const uint8_t *arr, uint32_t idx,
         out[i] = ECLIPSE_READ_BYTE(p + i);
 }
 
+#else /* SAROS_USE_COMPACT */
+
+/* 'width' (<= 57) bits starting at bit 'bit' of arr, LSB-first. */
+static inline uint64_t _saros_read_bits(const uint8_t *arr, uint32_t bit, uint8_t width)
+{
+    const uint8_t *p     = arr + (bit >> 3);
+    const uint8_t  shift = (uint8_t)(bit & 7u);
+    const uint8_t  need  = (uint8_t)((shift + width + 7u) >> 3);
+    uint64_t       v     = 0;
+
+    if (width == 0u)
+        return 0;
+    for (uint8_t i = 0; i < need; i++)
+        v |= (uint64_t)ECLIPSE_READ_BYTE(p + i) << (8u * i);
+    return (v >> shift) & (((uint64_t)1 << width) - 1u);
+}
+
+/* arr is the packed offset payload; the block's base and frame come from the
+ * catalog's skip index. */
+static inline int64_t _saros_read_time(const uint8_t *arr, uint32_t idx)
+{
+    const uint32_t block = idx / _SAROS_BLOCK_SIZE;
+    const uint32_t j     = idx % _SAROS_BLOCK_SIZE;
+    const int64_t  base  = _saros_read_i64(_SAROS_TIMES_BASE, block);
+    uint32_t       frame;
+    uint8_t        width;
+
+    if (j == 0u)
+        return base;
+    frame = ECLIPSE_READ_DWORD(_SAROS_TIMES_FRAME + block * 4u);
+    width = (uint8_t)(frame & 0xFFu);
+    return base + (int64_t)_saros_read_bits(arr, (frame >> 8) * 8u + (j - 1u) * width, width);
+}
+
+/* Expands one bit-packed record back into the raw 10-byte layout, so the
+ * decoders below are shared by both formats. */
+static inline void _saros_read_info_raw(const uint8_t *arr, uint32_t idx,
+                                        uint8_t out[ECLIPSE_INFO_SIZE])
+{
+    uint32_t bit = idx * _SAROS_INFO_BITS;
+
+    for (uint8_t f = 0; f < 7u; f++) {
+        const uint8_t  width = _SAROS_INFO_WIDTH[f];
+        const uint32_t s     = (uint32_t)_saros_read_bits(arr, bit, width);
+        uint8_t       *o     = out + (f < 3u ? 2u * f : f + 3u);
+        int32_t        v;
+
+        bit += width;
+        if ((_SAROS_INFO_NULLABLE >> f) & 1u)
+            v = s ? _SAROS_INFO_BIAS[f] + (int32_t)s - 1 : 0xFFFF;
+        else
+            v = _SAROS_INFO_BIAS[f] + (int32_t)s;
+        o[0] = (uint8_t)v;
+        if (f < 3u)
+            o[1] = (uint8_t)((uint32_t)v >> 8);
+    }
+}
+
+#endif /* SAROS_USE_COMPACT */
+
 static void _saros_load_series(const uint8_t *saros_arr,
                                uint8_t  saros_num,
                                uint8_t  saros_first,
@@ -356,32 +937,15 @@ static void _saros_load_series(const uint8_t *saros_arr,
         out_indices[i] = ECLIPSE_READ_WORD(p + 2u + (uint32_t)i * 2u);
 }
 
-/* ── Decoders ───────────────────────────────────────────────────────────── */
-
-static inline solar_eclipse_info_t _decode_solar(const uint8_t b[ECLIPSE_INFO_SIZE])
-{
-    solar_eclipse_info_t r;
-    r.latitude_deg10   = (int16_t)((uint16_t)b[0] | ((uint16_t)b[1] << 8));
-    r.longitude_deg10  = (int16_t)((uint16_t)b[2] | ((uint16_t)b[3] << 8));
-    r.central_duration = (uint16_t)b[4] | ((uint16_t)b[5] << 8);
-    r.saros_number     = b[6];
-    r.saros_pos        = b[7];
-    r.ecl_type         = b[8];
-    r.sun_alt          = b[9];
-    return r;
-}
-
-static inline lunar_eclipse_info_t _decode_lunar(const uint8_t b[ECLIPSE_INFO_SIZE])
+/* Global index of the eclipse at 'pos' within a series, without loading
+ * the whole record. */
+static inline uint16_t _saros_series_index(const uint8_t *saros_arr,
+                                           uint8_t saros_num,
+                                           uint8_t saros_first,
+                                           uint8_t pos)
 {
-    lunar_eclipse_info_t r;
-    r.pen_duration   = (uint16_t)b[0] | ((uint16_t)b[1] << 8);
-    r.par_duration   = (uint16_t)b[2] | ((uint16_t)b[3] << 8);
-    r.total_duration = (uint16_t)b[4] | ((uint16_t)b[5] << 8);
-    r.saros_number   = b[6];
-    r.saros_pos      = b[7];
-    r.ecl_type       = b[8];
-    r._pad           = 0;
-    return r;
+    uint32_t offset = (uint32_t)(saros_num - saros_first) * SAROS_RECORD_SIZE;
+    return ECLIPSE_READ_WORD(saros_arr + offset + 2u + (uint32_t)pos * 2u);
 }
 
 /* ── eclipse_entry builder ─────────────────────────────────────────────── */
@@ -407,6 +971,66 @@ static eclipse_entry_t _make_entry(const uint8_t *times_arr,
 
 /* ── Binary search ──────────────────────────────────────────────────────── */
 
+#ifdef SAROS_USE_COMPACT
+/*
+ * Bisect the skip index for the block that holds the bound, then the block
+ * itself with its base and frame read once.  strict = 0: first index with
+ * value >= key; strict = 1: first index with value > key.
+ */
+static uint32_t _compact_bound(const uint8_t *times_arr, uint32_t count, int64_t key, int strict)
+{
+    uint32_t lo = 0, hi = _SAROS_BLOCKS;
+    uint32_t block, first, last, bit;
+    int64_t  base;
+    uint8_t  width;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2u;
+        int64_t  t   = _saros_read_i64(_SAROS_TIMES_BASE, mid);
+        if (strict ? (t <= key) : (t < key))
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    if (lo == 0u)
+        return 0;
+
+    /* the base of 'block' is below the bound; its other members are not known */
+    block = lo - 1u;
+    base  = _saros_read_i64(_SAROS_TIMES_BASE, block);
+    {
+        uint32_t frame = ECLIPSE_READ_DWORD(_SAROS_TIMES_FRAME + block * 4u);
+        width = (uint8_t)(frame & 0xFFu);
+        bit   = (frame >> 8) * 8u;
+    }
+    first = block * _SAROS_BLOCK_SIZE;
+    last  = first + _SAROS_BLOCK_SIZE;
+    if (last > count)
+        last = count;
+
+    lo = 1u;
+    hi = last - first;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2u;
+        int64_t  t   = base + (int64_t)_saros_read_bits(times_arr, bit + (mid - 1u) * width, width);
+        if (strict ? (t <= key) : (t < key))
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    return first + lo;
+}
+
+static uint32_t _lower_bound(const uint8_t *times_arr, uint32_t count, int64_t key)
+{
+    return _compact_bound(times_arr, count, key, 0);
+}
+
+static uint32_t _upper_bound(const uint8_t *times_arr, uint32_t count, int64_t key)
+{
+    return _compact_bound(times_arr, count, key, 1);
+}
+#else
 /* First index with value >= key; returns count if all values < key. */
 static uint32_t _lower_bound(const uint8_t *times_arr, uint32_t count, int64_t key)
 {
@@ -434,15 +1058,244 @@ static uint32_t _upper_bound(const uint8_t *times_arr, uint32_t count, int64_t k
     }
     return lo;
 }
+#endif /* SAROS_USE_COMPACT */
 
-/* ── Saros-neighbour lookup ─────────────────────────────────────────────── */
+/* ── Eytzinger search index (SAROS_USE_EYTZINGER) ───────────────────────── */
 
+#ifdef _SAROS_EYTZINGER
 /*
- * Given the focal eclipse's saros_number and saros_pos, load the series and
- * return the immediately preceding and following eclipses within it.
+ * The times array re-laid out in BFS order of an implicit binary tree
+ * (node k has children 2k and 2k+1, slot 0 unused).  The top levels of the
+ * tree share a few cache lines, and the descent below has no data-dependent
+ * branch, so a lookup is ~13 predictable loads of native int64 values
+ * instead of ~13 mispredicted probes of two 32-bit reads each.
  */
-static void _saros_neighbours(
-    const uint8_t *times_arr,
+static int64_t       _eytz_times[_SAROS_COUNT + 1u];
+static uint16_t      _eytz_index[_SAROS_COUNT + 1u];   /* node -> sorted index */
+static volatile long _eytz_state;
+
+static uint32_t _eytz_fill(const uint8_t *times_arr, uint32_t i, uint32_t k)
+{
+    if (k <= _SAROS_COUNT) {
+        i = _eytz_fill(times_arr, i, 2u * k);
+        _eytz_times[k] = _saros_read_time(times_arr, i);
+        _eytz_index[k] = (uint16_t)i;
+        i = _eytz_fill(times_arr, i + 1u, 2u * k + 1u);
+    }
+    return i;
+}
+
+/* Non-blocking: while another thread is building, callers fall back to the
+ * plain binary search rather than wait. */
+static int _eytz_ready(void)
+{
+    if (_saros_state_load(&_eytz_state) == _SAROS_STATE_READY)
+        return 1;
+    if (!_saros_state_claim(&_eytz_state))
+        return 0;
+    _eytz_fill(_SAROS_TIMES_ARR, 0u, 1u);
+    _saros_state_publish(&_eytz_state);
+    return 1;
+}
+
+/* First sorted index with time >= key; _SAROS_COUNT if none. */
+static uint32_t _eytz_lower_bound(int64_t key)
+{
+    uint32_t k = 1u;
+    while (k <= _SAROS_COUNT) {
+#if defined(__GNUC__)
+        __builtin_prefetch(&_eytz_times[16u * k]);
+#endif
+        k = 2u * k + (uint32_t)(_eytz_times[k] < key);
+    }
+    /* Undo the trailing right turns, then the final left turn. */
+#if defined(__GNUC__)
+    k >>= (uint32_t)__builtin_ctz(~k) + 1u;
+#else
+    while (k & 1u)
+        k >>= 1;
+    k >>= 1;
+#endif
+    return k ? _eytz_index[k] : _SAROS_COUNT;
+}
+#endif /* _SAROS_EYTZINGER */
+
+/* Catalog-wide bounds used by find_next/past_*_eclipse(). */
+static uint32_t _catalog_lower_bound(int64_t key)
+{
+#ifdef _SAROS_EYTZINGER
+    if (_eytz_ready())
+        return _eytz_lower_bound(key);
+#endif
+    return _lower_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, key);
+}
+
+static uint32_t _catalog_upper_bound(int64_t key)
+{
+#ifdef _SAROS_EYTZINGER
+    /* Integer keys: first time > key is first time >= key + 1. */
+    if (key == INT64_MAX)
+        return _SAROS_COUNT;
+    if (_eytz_ready())
+        return _eytz_lower_bound(key + 1);
+#endif
+    return _upper_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, key);
+}
+
+static void _catalog_index_init(void)
+{
+#ifdef _SAROS_EYTZINGER
+    (void)_eytz_ready();
+#endif
+}
+
+/* ── Per-series time tables (hosted builds) ──────────────────────────────── */
+
+#ifdef _SAROS_SERIES_CACHE
+#define _SAROS_SERIES_N ((uint32_t)(_SAROS_LAST - _SAROS_FIRST) + 1u)
+
+static int64_t       _series_times[_SAROS_SERIES_N][SAROS_MAX_ECLIPSES];
+static uint8_t       _series_count[_SAROS_SERIES_N];
+static volatile long _series_state[_SAROS_SERIES_N];
+
+/*
+ * Timestamps of a whole series in position order, materialised on first
+ * use.  All SAROS_MAX_ECLIPSES slots are filled exactly as
+ * get_*_saros_series() reports them.  Returns NULL while another thread is
+ * still filling the same series; the caller then takes the PROGMEM path.
+ * saros_num must already be range-checked.
+ */
+static const int64_t *_series_cached(uint8_t saros_num, uint8_t *out_count)
+{
+    uint32_t s = (uint32_t)(saros_num - _SAROS_FIRST);
+
+    if (_saros_state_load(&_series_state[s]) != _SAROS_STATE_READY) {
+        uint16_t indices[SAROS_MAX_ECLIPSES];
+        uint8_t  count = 0;
+        uint8_t  i;
+
+        if (!_saros_state_claim(&_series_state[s]))
+            return NULL;
+        _saros_load_series(_SAROS_SAROS_ARR, saros_num, _SAROS_FIRST, &count, indices);
+        for (i = 0; i < SAROS_MAX_ECLIPSES; i++)
+            _series_times[s][i] = _saros_read_time(_SAROS_TIMES_ARR, indices[i]);
+        _series_count[s] = count;
+        _saros_state_publish(&_series_state[s]);
+    }
+    *out_count = _series_count[s];
+    return _series_times[s];
+}
+#endif /* _SAROS_SERIES_CACHE */
+
+/* ── Galloping search (sorted query streams) ───────────────────────────── */
+
+/* Bounded binary search over [lo, hi): first index whose time is >= key
+ * (strict == 0, lower bound) or > key (strict != 0, upper bound). */
+static uint32_t _bound_in(const uint8_t *times_arr, uint32_t lo, uint32_t hi,
+                          int64_t key, int strict)
+{
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2u;
+        int64_t  t   = _saros_read_time(times_arr, mid);
+        if (strict ? (t <= key) : (t < key))
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * Same result as _lower_bound (strict == 0) or _upper_bound (strict != 0),
+ * but starts at 'hint' (typically the previous result) and widens the
+ * bracket in powers of two before bisecting.  A key that moved d entries
+ * away from the hint costs O(log d) reads instead of O(log count).
+ */
+static uint32_t _gallop_bound(const uint8_t *times_arr, uint32_t count,
+                              int64_t key, uint32_t hint, int strict)
+{
+    uint32_t lo = 0u, hi = count, step = 1u;
+    int64_t  t;
+
+    if (hint > count)
+        hint = count;
+
+    if (hint < count) {
+        t = _saros_read_time(times_arr, hint);
+        if (strict ? (t <= key) : (t < key)) {
+            /* Answer lies after the hint: gallop forward. */
+            lo = hint + 1u;
+            while (step < count - hint) {
+                uint32_t probe = hint + step;
+                t = _saros_read_time(times_arr, probe);
+                if (!(strict ? (t <= key) : (t < key))) {
+                    hi = probe;
+                    break;
+                }
+                lo = probe + 1u;
+                step <<= 1;
+            }
+            return _bound_in(times_arr, lo, hi, key, strict);
+        }
+    }
+
+    /* Answer is at or before the hint: gallop backward. */
+    hi = hint;
+    while (hi > 0u) {
+        uint32_t probe = (hi > step) ? hi - step : 0u;
+        t = _saros_read_time(times_arr, probe);
+        if (strict ? (t <= key) : (t < key)) {
+            lo = probe + 1u;
+            break;
+        }
+        hi = probe;
+        step <<= 1;
+    }
+    return _bound_in(times_arr, lo, hi, key, strict);
+}
+
+/*
+ * Shared body of find_next/past_*_eclipses().  'build' decodes the focal
+ * eclipse and its Saros neighbours; it only runs when the focal index
+ * changes, otherwise the previous result is copied.
+ */
+static void _batch_find(const uint8_t *times_arr, uint32_t count,
+                        const int64_t *timestamps, size_t n,
+                        eclipse_result_t *out, int past,
+                        eclipse_result_t (*build)(uint32_t))
+{
+    uint32_t hint = 0u;
+    uint32_t prev = UINT32_MAX;
+    size_t   i;
+
+    for (i = 0; i < n; i++) {
+        uint32_t idx = _gallop_bound(times_arr, count, timestamps[i], hint, past);
+        uint32_t focal;
+        hint = idx;
+
+        /* past: idx is an upper bound, the focal eclipse is idx - 1 */
+        if (past ? (idx == 0u) : (idx >= count)) {
+            memset(&out[i], 0, sizeof(out[i]));
+            prev = UINT32_MAX;
+            continue;
+        }
+        focal = past ? idx - 1u : idx;
+        if (focal == prev)
+            out[i] = out[i - 1u];
+        else
+            out[i] = build(focal);
+        prev = focal;
+    }
+}
+
+/* ── Saros-neighbour lookup ─────────────────────────────────────────────── */
+
+/*
+ * Given the focal eclipse's saros_number and saros_pos, load the series and
+ * return the immediately preceding and following eclipses within it.
+ */
+static void _saros_neighbours(
+    const uint8_t *times_arr,
     const uint8_t *info_arr,
     const uint8_t *saros_arr,
     uint8_t saros_first, uint8_t saros_last,
@@ -457,6 +1310,25 @@ static void _saros_neighbours(
     if (saros_num < saros_first || saros_num > saros_last)
         return;
 
+#ifdef _SAROS_HOSTED
+    /* Only the two neighbouring slots are needed. */
+    {
+        uint8_t count = ECLIPSE_READ_BYTE(saros_arr +
+                        (uint32_t)(saros_num - saros_first) * SAROS_RECORD_SIZE);
+        if (saros_pos > 0u && saros_pos <= count) {
+            *out_prev = _make_entry(times_arr, info_arr,
+                _saros_series_index(saros_arr, saros_num, saros_first, saros_pos - 1u),
+                is_lunar);
+        }
+        if ((uint32_t)saros_pos + 1u < (uint32_t)count) {
+            *out_next = _make_entry(times_arr, info_arr,
+                _saros_series_index(saros_arr, saros_num, saros_first, saros_pos + 1u),
+                is_lunar);
+        }
+        return;
+    }
+#endif
+
     uint8_t  count = 0;
     uint16_t indices[SAROS_MAX_ECLIPSES];
     _saros_load_series(saros_arr, saros_num, saros_first, &count, indices);
@@ -469,6 +1341,157 @@ static void _saros_neighbours(
     }
 }
 
+/* ── Saros window lookup ────────────────────────────────────────────────── */
+
+/*
+ * Shared body of find_solar/lunar_saros_window(): bisect the series for the
+ * first eclipse at-or-after timestamp and return it with its predecessor.
+ */
+static saros_window_t _find_saros_window(int64_t timestamp, uint8_t saros_number,
+                                         int is_lunar)
+{
+    saros_window_t w;
+    memset(&w, 0, sizeof(w));
+    w.saros_number = saros_number;
+
+    if (saros_number < _SAROS_FIRST || saros_number > _SAROS_LAST)
+        return w;
+
+    uint8_t  count = 0;
+    uint8_t  lo = 0, hi;
+
+#ifdef _SAROS_SERIES_CACHE
+    const int64_t *times = _series_cached(saros_number, &count);
+    if (times) {
+        if (count == 0u)
+            return w;
+        hi = count;
+        while (lo < hi) {
+            uint8_t mid = lo + (hi - lo) / 2u;
+            if (times[mid] < timestamp)
+                lo = mid + 1u;
+            else
+                hi = mid;
+        }
+        if (lo < count)
+            w.future = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR,
+                _saros_series_index(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, lo),
+                is_lunar);
+        if (lo > 0u)
+            w.past   = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR,
+                _saros_series_index(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, lo - 1u),
+                is_lunar);
+        return w;
+    }
+#endif
+
+    uint16_t indices[SAROS_MAX_ECLIPSES];
+    _saros_load_series(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, &count, indices);
+
+    if (count == 0u)
+        return w;
+
+    /* Binary-search within this series' eclipse list */
+    hi = count;
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2u;
+        int64_t t = _saros_read_time(_SAROS_TIMES_ARR, indices[mid]);
+        if (t < timestamp)
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    /* lo = first index in 'indices[]' whose eclipse time >= timestamp */
+
+    if (lo < count)
+        w.future = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo],      is_lunar);
+    if (lo > 0u)
+        w.past   = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo - 1u], is_lunar);
+
+    return w;
+}
+
+/* ── Multi-series phases ────────────────────────────────────────────────── */
+
+#ifdef _SAROS_HOSTED
+#if defined(__cplusplus)
+#  define _SAROS_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#  define _SAROS_THREAD_LOCAL __declspec(thread)
+#else
+#  define _SAROS_THREAD_LOCAL _Thread_local
+#endif
+
+#define _SAROS_PHASE_N ((uint32_t)(_SAROS_LAST - _SAROS_FIRST) + 1u)
+
+/*
+ * Struct-of-arrays cache of each series' current window, one slot per
+ * series.  A slot holds the window key range (past, future], in seconds,
+ * that its last search answered, plus the window length and reciprocal in
+ * the caller's units.  Windows before a series starts or after it ends are
+ * cached too, with total = 0.  Thread-local, so concurrent callers never
+ * see each other's half-written slots.
+ */
+typedef struct {
+    int64_t  past[_SAROS_PHASE_N];
+    int64_t  future[_SAROS_PHASE_N];
+    uint64_t total[_SAROS_PHASE_N];
+    uint64_t recip[_SAROS_PHASE_N];
+    uint8_t  total_bits[_SAROS_PHASE_N];
+    uint16_t scale[_SAROS_PHASE_N];    /* 0 = slot never filled */
+} _saros_phase_cache_t;
+
+static _SAROS_THREAD_LOCAL _saros_phase_cache_t _phase_cache;
+
+static void _phase_refresh(_saros_phase_cache_t *c, uint32_t slot, uint8_t saros_number,
+                           int64_t key, uint16_t scale, int is_lunar)
+{
+    saros_window_t w = _find_saros_window(key, saros_number, is_lunar);
+
+    c->scale[slot]  = scale;
+    c->past[slot]   = w.past.valid   ? w.past.unix_time   : INT64_MIN;
+    c->future[slot] = w.future.valid ? w.future.unix_time : INT64_MAX;
+    c->total[slot]  = 0;
+    if (w.past.valid && w.future.valid) {
+        c->total[slot]      = (uint64_t)(w.future.unix_time - w.past.unix_time) * scale;
+        c->total_bits[slot] = _saros_bit_length(c->total[slot]);
+        c->recip[slot]      = _saros_reciprocal(c->total[slot], c->total_bits[slot]);
+    }
+}
+
+/*
+ * calculate_*_octal_phases(_ms) body.  The first pass only re-searches
+ * series whose cached window no longer holds the timestamp; the second
+ * evaluates every bin from the cache in one straight loop over the
+ * arrays.
+ */
+static void _octal_phases(int64_t timestamp, const uint8_t *saros, size_t n,
+                          uint8_t resolution, uint16_t scale, uint64_t *out, int is_lunar)
+{
+    _saros_phase_cache_t *c    = &_phase_cache;
+    const int64_t         key  = (scale == 1u) ? timestamp : timestamp / (int64_t)scale;
+    const uint8_t         bits = _saros_resolution_bits(resolution);
+    size_t                i;
+
+    for (i = 0; i < n; i++) {
+        const uint32_t slot = (uint32_t)(uint8_t)(saros[i] - _SAROS_FIRST);
+        if (saros[i] < _SAROS_FIRST || saros[i] > _SAROS_LAST)
+            continue;
+        if (c->scale[slot] != scale || key <= c->past[slot] || key > c->future[slot])
+            _phase_refresh(c, slot, saros[i], key, scale, is_lunar);
+    }
+
+    for (i = 0; i < n; i++) {
+        const uint32_t slot = (uint32_t)(uint8_t)(saros[i] - _SAROS_FIRST);
+        uint64_t       bin  = 0;
+        if (slot < _SAROS_PHASE_N && c->total[slot] != 0u)
+            bin = _saros_fixed_bin((uint64_t)(timestamp - c->past[slot] * (int64_t)scale),
+                                   c->total[slot], c->recip[slot], c->total_bits[slot], bits);
+        out[i] = bin;
+    }
+}
+#endif /* _SAROS_HOSTED */
+
 /* ────────────────────────────────────────────────────────────────────────── *
  * SOLAR implementation                                                       *
  * ────────────────────────────────────────────────────────────────────────── */
@@ -493,7 +1516,7 @@ eclipse_result_t find_next_solar_eclipse(int64_t timestamp)
 {
     eclipse_result_t empty;
     memset(&empty, 0, sizeof(empty));
-    uint32_t idx = _lower_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamp);
+    uint32_t idx = _catalog_lower_bound(timestamp);
     if (idx >= _SAROS_COUNT)
         return empty;
     return _solar_build(idx);
@@ -504,11 +1527,6 @@ static inline uint64_t map(const uint64_t input, const uint64_t in_min, const ui
     return  ((input - in_min) * (out_max - out_min) + (in_max - in_min) / 2) / (in_max - in_min) + out_min;
 }
 
-static const long double PowersOfEight[4] = {
-    4096,16777216,68719476736,281474976710656
-};
-
-
 uint64_t get_solar_saros_period_duration_ms(int64_t timestamp, uint8_t saros_number, uint8_t period) {
     saros_window_t w = find_solar_saros_window(timestamp, saros_number);
     if (!w.past.valid || !w.future.valid) {
@@ -544,12 +1562,26 @@ uint64_t get_average_bin(int64_t reference, int64_t timestamp, uint16_t scale, c
         timestamp += AVERAGE_SAROS_PERIOD_SECONDS;
     }
     const uint64_t elapsed = reference - (timestamp - AVERAGE_SAROS_PERIOD_SECONDS);
-    const uint64_t total = AVERAGE_SAROS_PERIOD_SECONDS * scale;
-    const long double n = (long double)elapsed / (long double)total;
-    return (uint64_t)floor(n * PowersOfEight[(resolution - 1) % 3]);
+    const uint64_t total = (uint64_t)AVERAGE_SAROS_PERIOD_SECONDS * scale;
+    if (total == 0u) return 0;
+    return _saros_div_pow2(elapsed, _saros_resolution_bits(resolution), total);
 }
 
 void get_solar_saros_series(uint8_t saros_number, int64_t times[SAROS_MAX_ECLIPSES], uint8_t *count) {
+    if (saros_number < _SAROS_FIRST || saros_number > _SAROS_LAST) {
+        memset(times, 0, SAROS_MAX_ECLIPSES * sizeof(int64_t));
+        *count = 0;
+        return;
+    }
+#ifdef _SAROS_SERIES_CACHE
+    {
+        const int64_t *cached = _series_cached(saros_number, count);
+        if (cached) {
+            memcpy(times, cached, SAROS_MAX_ECLIPSES * sizeof(int64_t));
+            return;
+        }
+    }
+#endif
     uint16_t indices[SAROS_MAX_ECLIPSES];
     uint8_t c = 0;
     _saros_load_series(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, &c, indices);
@@ -559,15 +1591,22 @@ void get_solar_saros_series(uint8_t saros_number, int64_t times[SAROS_MAX_ECLIPS
     *count = c;
 }
 
+/* floor(elapsed / total * 2^bits), bits = 12 * ((resolution + 2) % 3 + 1)
+ * (_saros_resolution_bits(): 1/2/3 -> 12/24/36, then 4 wraps to 12), in
+ * exact integer arithmetic; no floating point, so it is cheap on soft-float
+ * MCUs. */
 static uint64_t get_bin(const uint64_t timestamp, const saros_window_t w, const uint16_t scale, const uint8_t resolution) {
     const uint64_t elapsed = (timestamp - (w.past.unix_time * scale));
     const uint64_t total = (w.future.unix_time - w.past.unix_time) * scale;
-    const long double n = (long double)elapsed / (long double)total;
-    return (uint64_t)floor(n * PowersOfEight[(resolution - 1) % 3]);
+    if (total == 0u) return 0;
+    return _saros_div_pow2(elapsed, _saros_resolution_bits(resolution), total);
 }
 
 uint64_t calculate_lunar_octal_phase_ms(const int64_t timestamp, const uint8_t saros_number, const uint8_t resolution) {
     saros_window_t w = find_lunar_saros_window(timestamp / 1000, saros_number);
+    if (!w.past.valid || !w.future.valid) {
+        return 0;
+    }
     return get_bin(timestamp, w, 1000, resolution);
 }
 
@@ -607,50 +1646,281 @@ uint64_t calculate_solar_octal_phase(const int64_t timestamp, const uint8_t saro
     return get_bin(timestamp, w, 1, resolution);
 }
 
+void calculate_solar_octal_phases(int64_t timestamp, const uint8_t *saros, size_t n,
+                                  uint8_t resolution, uint64_t *out)
+{
+#ifdef _SAROS_HOSTED
+    _octal_phases(timestamp, saros, n, resolution, 1u, out, /*lunar=*/0);
+#else
+    for (size_t i = 0; i < n; i++)
+        out[i] = calculate_solar_octal_phase(timestamp, saros[i], resolution);
+#endif
+}
+
+void calculate_solar_octal_phases_ms(int64_t timestamp, const uint8_t *saros, size_t n,
+                                     uint8_t resolution, uint64_t *out)
+{
+#ifdef _SAROS_HOSTED
+    _octal_phases(timestamp, saros, n, resolution, 1000u, out, /*lunar=*/0);
+#else
+    for (size_t i = 0; i < n; i++)
+        out[i] = calculate_solar_octal_phase_ms(timestamp, saros[i], resolution);
+#endif
+}
+
+/* ── Phase tracker ──────────────────────────────────────────────────────── */
+
+static void _tracker_init(saros_phase_tracker_t *t, uint8_t saros_number,
+                          uint8_t bits, uint32_t scale, uint8_t is_lunar)
+{
+    memset(t, 0, sizeof(*t));
+    t->saros_number = saros_number;
+    t->bits         = bits;
+    t->scale        = scale ? scale : 1u;
+    t->is_lunar     = is_lunar;
+    t->next_change  = INT64_MIN;   /* forces a search on the first update */
+}
+
+void solar_phase_tracker_init(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                              uint8_t resolution, uint16_t scale)
+{
+    _tracker_init(tracker, saros_number, _saros_resolution_bits(resolution), scale, 0);
+}
+
+void lunar_phase_tracker_init(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                              uint8_t resolution, uint16_t scale)
+{
+    _tracker_init(tracker, saros_number, _saros_resolution_bits(resolution), scale, 1);
+}
+
+static void _tracker_init_ns(saros_phase_tracker_t *t, uint8_t saros_number,
+                             uint8_t digits, uint8_t is_lunar)
+{
+    if (digits == 0u)
+        digits = 1u;
+    if (digits > SAROS_PHASE_MAX_DIGITS)
+        digits = SAROS_PHASE_MAX_DIGITS;
+    _tracker_init(t, saros_number, (uint8_t)(3u * digits), SAROS_NS_PER_SECOND, is_lunar);
+    t->floor_key = 1u;
+}
+
+void solar_phase_tracker_init_ns(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                 uint8_t digits)
+{
+    _tracker_init_ns(tracker, saros_number, digits, 0);
+}
+
+void lunar_phase_tracker_init_ns(saros_phase_tracker_t *tracker, uint8_t saros_number,
+                                 uint8_t digits)
+{
+    _tracker_init_ns(tracker, saros_number, digits, 1);
+}
+
+/* seconds * scale, saturated to the int64 range. */
+static int64_t _tracker_scaled(int64_t seconds, uint32_t scale)
+{
+    if (seconds > INT64_MAX / (int64_t)scale)
+        return INT64_MAX;
+    if (seconds < INT64_MIN / (int64_t)scale)
+        return INT64_MIN;
+    return seconds * (int64_t)scale;
+}
+
+/*
+ * Window search key of a timestamp.  Seconds and milliseconds truncate
+ * like the calculate_*_ms functions, so the window is (past, future] in
+ * whole keys.  floor_key trackers search the second after the floored
+ * one, which puts the timestamp in [past, future) at full precision.
+ */
+static int64_t _tracker_key(const saros_phase_tracker_t *t, int64_t timestamp)
+{
+    int64_t key;
+
+    if (t->scale == 1u)
+        return timestamp;
+    key = timestamp / (int64_t)t->scale;
+    if (t->floor_key && timestamp % (int64_t)t->scale >= 0)
+        key++;
+    return key;
+}
+
+/* First timestamp whose key is past the window ending at 'seconds'. */
+static int64_t _tracker_key_end(const saros_phase_tracker_t *t, int64_t seconds)
+{
+    if (t->floor_key)
+        return _tracker_scaled(seconds, t->scale);
+    if (seconds >= 0 || t->scale == 1u)
+        return (seconds == INT64_MAX) ? INT64_MAX : _tracker_scaled(seconds + 1, t->scale);
+    return _tracker_scaled(seconds, t->scale) + 1;
+}
+
+/* Bring the cached window to the key of timestamp; 0 if there is none
+ * (next_change then holds the moment one opens, or INT64_MAX). */
+static int _tracker_window(saros_phase_tracker_t *t, int64_t timestamp)
+{
+    const int64_t  key = _tracker_key(t, timestamp);
+    saros_window_t w;
+
+    if (t->valid && key > t->past && key <= t->future)
+        return 1;
+    w = t->is_lunar ? find_lunar_saros_window(key, t->saros_number)
+                    : find_solar_saros_window(key, t->saros_number);
+    t->valid = (uint8_t)(w.past.valid && w.future.valid);
+    t->bin   = 0;
+    if (!t->valid) {
+        /* Before the series starts the window opens right after its
+         * first eclipse; after it ends nothing changes any more. */
+        t->next_change = w.future.valid ? _tracker_key_end(t, w.future.unix_time) : INT64_MAX;
+        return 0;
+    }
+    t->past       = w.past.unix_time;
+    t->future     = w.future.unix_time;
+    t->total      = (uint64_t)(t->future - t->past) * t->scale;
+    t->total_bits = _saros_bit_length(t->total);
+    t->recip      = _saros_reciprocal(t->total, t->total_bits);
+    return 1;
+}
+
+/* timestamp - past * scale without forming past * scale, which leaves the
+ * int64 range for nanoseconds outside 1678..2262. */
+static uint64_t _tracker_elapsed(const saros_phase_tracker_t *t, int64_t timestamp)
+{
+    const int64_t q = timestamp / (int64_t)t->scale;
+    const int64_t r = timestamp % (int64_t)t->scale;
+    return (uint64_t)(q - t->past) * t->scale + (uint64_t)r;
+}
+
+uint64_t saros_phase_tracker_update(saros_phase_tracker_t *tracker, int64_t timestamp)
+{
+    saros_phase_tracker_t *t = tracker;
+    uint64_t               elapsed, step;
+
+    if (!_tracker_window(t, timestamp))
+        return 0;
+
+    elapsed = _tracker_elapsed(t, timestamp);
+    t->bin  = _saros_fixed_bin(elapsed, t->total, t->recip, t->total_bits, t->bits);
+
+    /* The bin changes at the next bin start or where the window ends. */
+    step = _saros_bin_start(t->bin, t->total, t->bits) - elapsed;
+    t->next_change = _tracker_key_end(t, t->future);
+    if (timestamp <= INT64_MAX - (int64_t)step && timestamp + (int64_t)step < t->next_change)
+        t->next_change = timestamp + (int64_t)step;
+    return t->bin;
+}
+
+saros_phase_t saros_phase_tracker_phase(saros_phase_tracker_t *tracker, int64_t timestamp)
+{
+    saros_phase_tracker_t *t = tracker;
+    uint64_t               elapsed;
+
+    if (!_tracker_window(t, timestamp))
+        return 0;
+    /* Only whole-key windows reach their end: 2^64 is not a phase. */
+    elapsed = _tracker_elapsed(t, timestamp);
+    if (elapsed >= t->total)
+        return UINT64_MAX;
+    return _saros_fixed_bin(elapsed, t->total, t->recip, t->total_bits, 64u);
+}
+
+saros_phase_t calculate_solar_phase_ns(int64_t timestamp_ns, uint8_t saros_number)
+{
+    saros_phase_tracker_t t;
+    solar_phase_tracker_init_ns(&t, saros_number, SAROS_PHASE_MAX_DIGITS);
+    return saros_phase_tracker_phase(&t, timestamp_ns);
+}
+
+/* ── Rollover queue ─────────────────────────────────────────────────────── */
+
+static void _rollover_sift_down(saros_rollover_queue_t *q, uint8_t i)
+{
+    saros_phase_tracker_t *h = q->trackers;
+    for (;;) {
+        uint32_t l = 2u * i + 1u, r = l + 1u, m = i;
+        if (l < q->count && h[l].next_change < h[m].next_change) m = l;
+        if (r < q->count && h[r].next_change < h[m].next_change) m = r;
+        if (m == i)
+            return;
+        saros_phase_tracker_t tmp = h[i];
+        h[i] = h[m];
+        h[m] = tmp;
+        i = (uint8_t)m;
+    }
+}
+
+void saros_rollover_queue_init(saros_rollover_queue_t *queue, saros_phase_tracker_t *trackers,
+                               uint8_t count, int64_t timestamp)
+{
+    uint8_t i;
+    queue->trackers = trackers;
+    queue->count    = count;
+    for (i = 0; i < count; i++)
+        saros_phase_tracker_update(&trackers[i], timestamp);
+    for (i = count / 2u; i-- > 0u;)
+        _rollover_sift_down(queue, i);
+}
+
+int64_t saros_rollover_queue_next(const saros_rollover_queue_t *queue)
+{
+    return queue->count ? queue->trackers[0].next_change : INT64_MAX;
+}
+
+int saros_rollover_queue_pop(saros_rollover_queue_t *queue, int64_t timestamp,
+                             saros_rollover_event_t *event)
+{
+    saros_phase_tracker_t *top;
+    int64_t                at;
+
+    if (queue->count == 0u)
+        return 0;
+    top = &queue->trackers[0];
+    at  = top->next_change;
+    if (at == INT64_MAX || at > timestamp)
+        return 0;
+
+    event->timestamp    = at;
+    event->bin          = saros_phase_tracker_update(top, at);
+    event->saros_number = top->saros_number;
+    event->is_lunar     = top->is_lunar;
+    _rollover_sift_down(queue, 0);
+    return 1;
+}
+
+#ifndef SAROS_USE_COMPACT
+const saros_db_t saros_solar_db = {
+    _SAROS_TIMES_ARR, _SAROS_INFO_ARR, _SAROS_SAROS_ARR,
+    _SAROS_COUNT, _SAROS_FIRST, _SAROS_LAST, /*is_lunar=*/0
+};
+#endif
+
 eclipse_result_t find_past_solar_eclipse(int64_t timestamp)
 {
     eclipse_result_t empty;
     memset(&empty, 0, sizeof(empty));
-    uint32_t idx = _upper_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamp);
+    uint32_t idx = _catalog_upper_bound(timestamp);
     if (idx == 0u)
         return empty;
     return _solar_build(idx - 1u);
 }
 
-saros_window_t find_solar_saros_window(int64_t timestamp, uint8_t saros_number)
+void init_solar_search_index(void)
 {
-    saros_window_t w;
-    memset(&w, 0, sizeof(w));
-    w.saros_number = saros_number;
-
-    if (saros_number < _SAROS_FIRST || saros_number > _SAROS_LAST)
-        return w;
-
-    uint8_t  count = 0;
-    uint16_t indices[SAROS_MAX_ECLIPSES];
-    _saros_load_series(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, &count, indices);
-
-    if (count == 0u)
-        return w;
+    _catalog_index_init();
+}
 
-    /* Binary-search within this series' eclipse list */
-    uint8_t lo = 0, hi = count;
-    while (lo < hi) {
-        uint8_t mid = lo + (hi - lo) / 2u;
-        int64_t t = _saros_read_time(_SAROS_TIMES_ARR, indices[mid]);
-        if (t < timestamp)
-            lo = mid + 1u;
-        else
-            hi = mid;
-    }
-    /* lo = first index in 'indices[]' whose eclipse time >= timestamp */
+void find_next_solar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out)
+{
+    _batch_find(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamps, n, out, /*past=*/0, _solar_build);
+}
 
-    if (lo < count)
-        w.future = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo],      0);
-    if (lo > 0u)
-        w.past   = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo - 1u], 0);
+void find_past_solar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out)
+{
+    _batch_find(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamps, n, out, /*past=*/1, _solar_build);
+}
 
-    return w;
+saros_window_t find_solar_saros_window(int64_t timestamp, uint8_t saros_number)
+{
+    return _find_saros_window(timestamp, saros_number, /*lunar=*/0);
 }
 
 #endif /* SAROS_IMPL_SOLAR */
@@ -679,54 +1949,76 @@ eclipse_result_t find_next_lunar_eclipse(int64_t timestamp)
 {
     eclipse_result_t empty;
     memset(&empty, 0, sizeof(empty));
-    uint32_t idx = _lower_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamp);
+    uint32_t idx = _catalog_lower_bound(timestamp);
     if (idx >= _SAROS_COUNT)
         return empty;
     return _lunar_build(idx);
 }
 
+#ifndef SAROS_USE_COMPACT
+const saros_db_t saros_lunar_db = {
+    _SAROS_TIMES_ARR, _SAROS_INFO_ARR, _SAROS_SAROS_ARR,
+    _SAROS_COUNT, _SAROS_FIRST, _SAROS_LAST, /*is_lunar=*/1
+};
+#endif
+
 eclipse_result_t find_past_lunar_eclipse(int64_t timestamp)
 {
     eclipse_result_t empty;
     memset(&empty, 0, sizeof(empty));
-    uint32_t idx = _upper_bound(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamp);
+    uint32_t idx = _catalog_upper_bound(timestamp);
     if (idx == 0u)
         return empty;
     return _lunar_build(idx - 1u);
 }
 
-saros_window_t find_lunar_saros_window(int64_t timestamp, uint8_t saros_number)
+void init_lunar_search_index(void)
 {
-    saros_window_t w;
-    memset(&w, 0, sizeof(w));
-    w.saros_number = saros_number;
+    _catalog_index_init();
+}
 
-    if (saros_number < _SAROS_FIRST || saros_number > _SAROS_LAST)
-        return w;
+void find_next_lunar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out)
+{
+    _batch_find(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamps, n, out, /*past=*/0, _lunar_build);
+}
 
-    uint8_t  count = 0;
-    uint16_t indices[SAROS_MAX_ECLIPSES];
-    _saros_load_series(_SAROS_SAROS_ARR, saros_number, _SAROS_FIRST, &count, indices);
+void find_past_lunar_eclipses(const int64_t *timestamps, size_t n, eclipse_result_t *out)
+{
+    _batch_find(_SAROS_TIMES_ARR, _SAROS_COUNT, timestamps, n, out, /*past=*/1, _lunar_build);
+}
 
-    if (count == 0u)
-        return w;
+saros_window_t find_lunar_saros_window(int64_t timestamp, uint8_t saros_number)
+{
+    return _find_saros_window(timestamp, saros_number, /*lunar=*/1);
+}
 
-    uint8_t lo = 0, hi = count;
-    while (lo < hi) {
-        uint8_t mid = lo + (hi - lo) / 2u;
-        int64_t t = _saros_read_time(_SAROS_TIMES_ARR, indices[mid]);
-        if (t < timestamp)
-            lo = mid + 1u;
-        else
-            hi = mid;
-    }
+saros_phase_t calculate_lunar_phase_ns(int64_t timestamp_ns, uint8_t saros_number)
+{
+    saros_phase_tracker_t t;
+    lunar_phase_tracker_init_ns(&t, saros_number, SAROS_PHASE_MAX_DIGITS);
+    return saros_phase_tracker_phase(&t, timestamp_ns);
+}
 
-    if (lo < count)
-        w.future = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo],      1);
-    if (lo > 0u)
-        w.past   = _make_entry(_SAROS_TIMES_ARR, _SAROS_INFO_ARR, indices[lo - 1u], 1);
+void calculate_lunar_octal_phases(int64_t timestamp, const uint8_t *saros, size_t n,
+                                  uint8_t resolution, uint64_t *out)
+{
+#ifdef _SAROS_HOSTED
+    _octal_phases(timestamp, saros, n, resolution, 1u, out, /*lunar=*/1);
+#else
+    for (size_t i = 0; i < n; i++)
+        out[i] = calculate_lunar_octal_phase(timestamp, saros[i], resolution);
+#endif
+}
 
-    return w;
+void calculate_lunar_octal_phases_ms(int64_t timestamp, const uint8_t *saros, size_t n,
+                                     uint8_t resolution, uint64_t *out)
+{
+#ifdef _SAROS_HOSTED
+    _octal_phases(timestamp, saros, n, resolution, 1000u, out, /*lunar=*/1);
+#else
+    for (size_t i = 0; i < n; i++)
+        out[i] = calculate_lunar_octal_phase_ms(timestamp, saros[i], resolution);
+#endif
 }
 
 #endif /* SAROS_IMPL_LUNAR */
@@ -734,6 +2026,16 @@ saros_window_t find_lunar_saros_window(int64_t timestamp, uint8_t saros_number)
 /* Clean up internal macros */
 #undef _SAROS_TIMES_ARR
 #undef _SAROS_INFO_ARR
+#undef _SAROS_TIMES_BASE
+#undef _SAROS_TIMES_FRAME
+#undef _SAROS_BLOCK_SIZE
+#undef _SAROS_BLOCKS
+#undef _SAROS_INFO_BIAS
+#undef _SAROS_INFO_WIDTH
+#undef _SAROS_INFO_BITS
+#undef _SAROS_INFO_NULLABLE
+#undef _SAROS_PHASE_N
+#undef _SAROS_THREAD_LOCAL
 #undef _SAROS_SAROS_ARR
 #undef _SAROS_COUNT
 #undef _SAROS_FIRST
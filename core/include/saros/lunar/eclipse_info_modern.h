@@ -32,6 +32,10 @@
 #  define ECLIPSE_ATTR           /* nothing */
 #endif
 
+#ifndef ECLIPSE_CONST
+#  define ECLIPSE_CONST          const   /* constexpr under SarosCatalog.h */
+#endif
+
 #define ECLIPSE_MODERN_COUNT       4657u
 #define ECLIPSE_MODERN_SAROS_FIRST 110u
 #define ECLIPSE_MODERN_SAROS_LAST  173u
@@ -46,7 +50,7 @@
  *   [8]   uint8   ecl_type  (lunar_eclipse_type_t enum)
  *   [9]   uint8   _pad
  * Size: 46,570 bytes */
-static const uint8_t eclipse_info_modern[46570u] ECLIPSE_ATTR = {
+static ECLIPSE_CONST uint8_t eclipse_info_modern[46570u] ECLIPSE_ATTR = {
     0x2e, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x01, 0x00, 0xde, 0x18, 0xff, 0xff, 0xff, 0xff,
     0x6e, 0x01, 0x00, 0x00, 0x12, 0x21, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x02, 0x00, 0x00, 0x42, 0x27,
     0xff, 0xff, 0xff, 0xff, 0x6e, 0x03, 0x00, 0x00, 0x34, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x04,
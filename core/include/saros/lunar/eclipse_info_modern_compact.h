@@ -0,0 +1,2204 @@
+/*
+ * Auto-generated by build_compact_db.py — DO NOT EDIT
+ *
+ * Bit-packed lunar eclipse_info_t records (59 bits each).
+ * Saros range : 110–173
+ * Eclipses    : 4657
+ * Flash usage : 34,346 bytes (33.5 KB)
+ *
+ * Usage: #define SAROS_USE_COMPACT in the lunar implementation unit, which
+ * then includes this header instead of the raw one.  ECLIPSE_USE_PROGMEM
+ * works as for the raw headers.
+ */
+
+#ifndef ECLIPSE_INFO_MODERN_COMPACT_H
+#define ECLIPSE_INFO_MODERN_COMPACT_H
+
+#include <stdint.h>
+
+#ifdef ECLIPSE_USE_PROGMEM
+#  include <avr/pgmspace.h>
+#  define ECLIPSE_READ_BYTE(p)   pgm_read_byte(p)
+#  define ECLIPSE_READ_WORD(p)   pgm_read_word(p)
+#  define ECLIPSE_READ_DWORD(p)  pgm_read_dword(p)
+#  define ECLIPSE_ATTR           PROGMEM
+#else
+#  define ECLIPSE_READ_BYTE(p)   (*(const uint8_t  *)(p))
+#  define ECLIPSE_READ_WORD(p)   (*(const uint16_t *)(p))
+#  define ECLIPSE_READ_DWORD(p)  (*(const uint32_t *)(p))
+#  define ECLIPSE_ATTR           /* nothing */
+#endif
+
+#define ECLIPSE_MODERN_COUNT       4657u
+#define ECLIPSE_MODERN_SAROS_FIRST 110u
+#define ECLIPSE_MODERN_SAROS_LAST  173u
+#define ECLIPSE_MODERN_INFO_BITS     59u
+#define ECLIPSE_MODERN_INFO_NULLABLE 0x06u
+
+/* Field layout, in the order of the raw 10-byte record:
+ *   pen_duration_s     bias    486  width 15
+ *   par_duration_s     bias    150  width 14  (0 = n/a)
+ *   total_duration_s   bias    156  width 13  (0 = n/a)
+ *   saros_number       bias    110  width  6
+ *   saros_pos          bias      0  width  7
+ *   ecl_type           bias      0  width  4
+ *   _pad               bias      0  width  0
+ * A field decodes to bias + stored value; for nullable fields stored 0 is
+ * 0xFFFF and bias + stored - 1 otherwise.  Read on every decode, so these
+ * two stay in RAM. */
+static const int32_t eclipse_info_modern_bias[7] = { 486, 150, 156, 110, 0, 0, 0 };
+static const uint8_t eclipse_info_modern_width[7] = { 15, 14, 13, 6, 7, 4, 0 };
+
+/* eclipse_info_modern_packed[] — 59-bit records, LSB-first, same order as the times.
+ * Size: 34,346 bytes */
+static const uint8_t eclipse_info_modern_packed[34346u] ECLIPSE_ATTR = {
+    0x48, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xcb,
+    0x07, 0x00, 0x00, 0x00, 0x80, 0x00, 0xb8, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe0, 0xa4, 0x02,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x72, 0x06, 0x00, 0x00, 0x00, 0x02, 0x40, 0x88, 0xb9, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x40, 0x6e, 0x03, 0x00, 0x00, 0x80, 0x20, 0x00, 0xc8, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x2d, 0x09, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x48, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x40, 0x97, 0x01, 0x00, 0x00, 0x80, 0x10, 0x00,
+    0xde, 0x15, 0x00, 0x00, 0x00, 0x82, 0x01, 0xa8, 0x3c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x42, 0xe0,
+    0x76, 0xae, 0x00, 0x00, 0x00, 0x41, 0x0c, 0x24, 0x00, 0x00, 0x00, 0x08, 0x02, 0x60, 0x8c, 0x01,
+    0x00, 0x00, 0x20, 0x20, 0x00, 0x51, 0x06, 0x00, 0x00, 0x00, 0x43, 0x00, 0xf4, 0x71, 0xe9, 0x11,
+    0x00, 0x00, 0x12, 0x64, 0xbe, 0x02, 0x00, 0x00, 0x80, 0x30, 0x00, 0x24, 0x1b, 0x00, 0x00, 0x00,
+    0x82, 0x02, 0x20, 0x82, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00, 0x53, 0xd7, 0x62, 0x01, 0x00, 0x40,
+    0x41, 0xe0, 0x31, 0x00, 0x00, 0x00, 0x08, 0x04, 0x60, 0x5d, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00,
+    0x91, 0x0e, 0x00, 0x00, 0x00, 0x81, 0x01, 0xd4, 0x4c, 0x00, 0x00, 0x00, 0x18, 0x06, 0x80, 0xbe,
+    0x7b, 0xc8, 0x00, 0x00, 0xb0, 0x20, 0x66, 0x1b, 0x00, 0x00, 0x00, 0x84, 0x02, 0xf8, 0x40, 0x00,
+    0x00, 0x00, 0x90, 0x04, 0xc0, 0xb3, 0x07, 0x00, 0x00, 0x80, 0xe0, 0x00, 0x56, 0x2b, 0x00, 0x00,
+    0x00, 0x0c, 0x04, 0x80, 0xe7, 0x4d, 0x6c, 0x00, 0x00, 0x60, 0x10, 0xaf, 0x0e, 0x00, 0x00, 0x00,
+    0x82, 0x01, 0x9c, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x81, 0x2d, 0x01, 0x00, 0x00, 0x40, 0x22,
+    0x00, 0x31, 0x20, 0x00, 0x00, 0x00, 0x02, 0xc4, 0x08, 0xbe, 0x00, 0x00, 0x00, 0x30, 0x14, 0x40,
+    0xb8, 0x17, 0xc8, 0x01, 0x00, 0xa0, 0x41, 0xf8, 0xbd, 0xfe, 0x01, 0x00, 0x08, 0x07, 0x22, 0xe2,
+    0x00, 0x00, 0x00, 0x80, 0x08, 0x80, 0x20, 0x05, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x5c, 0x85, 0x1b,
+    0x0d, 0x00, 0x08, 0x12, 0x04, 0x45, 0x00, 0x00, 0x00, 0x80, 0x01, 0x08, 0x95, 0x19, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0xa8, 0xf9, 0x1e, 0x3b, 0x00, 0x00, 0x38, 0xc8, 0x0a, 0x02, 0x00, 0x00, 0x80,
+    0x02, 0x10, 0x24, 0x09, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0xde, 0x4b, 0x00, 0x40, 0x40,
+    0x90, 0x4f, 0x09, 0x00, 0x00, 0x00, 0x84, 0x00, 0x08, 0x2b, 0x00, 0x00, 0x00, 0x48, 0x08, 0xe0,
+    0x48, 0x1c, 0x9b, 0x00, 0x40, 0xa0, 0x20, 0x07, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x20, 0xd9,
+    0x42, 0x11, 0x00, 0x30, 0x1c, 0x48, 0xdc, 0x17, 0xe3, 0x01, 0x00, 0xe0, 0x41, 0x5e, 0x1d, 0x00,
+    0x00, 0x00, 0x14, 0x01, 0x10, 0x6b, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0xa4, 0xb0, 0x34, 0x03,
+    0x00, 0x42, 0x82, 0x34, 0x08, 0x00, 0x00, 0x00, 0x60, 0x00, 0x01, 0xc7, 0x02, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0x92, 0x02, 0x50, 0x18, 0x83, 0x2e, 0x00, 0x10, 0x2c,
+    0xc8, 0xee, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00, 0xfa, 0xb8, 0x81, 0x09, 0x00, 0x0c, 0x08, 0xe2,
+    0xf9, 0x5d, 0x7a, 0x00, 0x00, 0x80, 0x10, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x85, 0x00, 0x8c, 0x1f,
+    0x00, 0x00, 0x00, 0x50, 0x04, 0x80, 0x42, 0x3c, 0xf0, 0x00, 0x80, 0xa0, 0x20, 0xbd, 0x09, 0x00,
+    0x00, 0x00, 0x98, 0x00, 0x08, 0xca, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0xd6, 0x02, 0x00, 0x00,
+    0x80, 0xc4, 0x00, 0x46, 0xc7, 0xea, 0x0c, 0x00, 0x04, 0x0c, 0x52, 0xeb, 0x00, 0x00, 0x00, 0xc0,
+    0x18, 0x80, 0x76, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x8c, 0x76, 0xc7, 0x18, 0x00, 0x18, 0x12,
+    0xe4, 0xf7, 0x6b, 0xf6, 0x00, 0x00, 0x10, 0x21, 0xa1, 0x16, 0x00, 0x00, 0x00, 0x8a, 0x01, 0x20,
+    0x43, 0x00, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0xac, 0xf8, 0x11, 0x02, 0x00, 0x61, 0x41, 0xa6, 0x1a,
+    0x00, 0x00, 0x00, 0x30, 0x02, 0x80, 0xbd, 0x01, 0x00, 0x00, 0x80, 0x28, 0x80, 0xd7, 0x05, 0x00,
+    0x00, 0x00, 0xc9, 0x01, 0x6c, 0x90, 0x9d, 0x1b, 0x00, 0x08, 0x1a, 0x44, 0x2d, 0x02, 0x00, 0x00,
+    0x80, 0x41, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x96, 0x00, 0xf8, 0xf4, 0xda, 0x39, 0x00, 0x30,
+    0x28, 0x88, 0xf6, 0xb7, 0xee, 0x01, 0x00, 0x40, 0x42, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x04,
+    0x30, 0x8a, 0x00, 0x00, 0x00, 0x40, 0x21, 0x00, 0x91, 0x71, 0x6a, 0x04, 0x00, 0x02, 0x83, 0x00,
+    0x3f, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x61, 0x00, 0x12, 0x0c,
+    0x00, 0x00, 0x00, 0x12, 0x04, 0xc0, 0x23, 0xb7, 0x39, 0x00, 0x10, 0x38, 0x08, 0xf2, 0x04, 0x00,
+    0x00, 0x00, 0xa3, 0x00, 0x56, 0x19, 0x00, 0x00, 0x00, 0x2c, 0x02, 0xe0, 0xf6, 0xcd, 0x7f, 0x00,
+    0x60, 0x58, 0x90, 0x8f, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x20, 0xc8, 0x7f, 0xfd, 0x1e, 0x00, 0x00,
+    0x26, 0x44, 0x7d, 0x03, 0x00, 0x00, 0x40, 0x51, 0x00, 0xa9, 0x08, 0x00, 0x00, 0x00, 0x94, 0x02,
+    0x98, 0x1b, 0xd7, 0x49, 0x00, 0x20, 0x34, 0x08, 0x86, 0x01, 0x00, 0x00, 0x80, 0x03, 0x10, 0xfe,
+    0x22, 0x00, 0x00, 0x00, 0x30, 0x04, 0x40, 0x00, 0x02, 0x00, 0x00, 0x80, 0x38, 0x0c, 0x57, 0x06,
+    0x00, 0x00, 0x00, 0x49, 0x02, 0xf4, 0x92, 0xb3, 0x1d, 0x00, 0x08, 0x1e, 0x84, 0xbf, 0x02, 0x00,
+    0x00, 0x80, 0x61, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x96, 0x01, 0x10, 0x01, 0xa3, 0x44, 0x00,
+    0x30, 0x30, 0x88, 0x69, 0x01, 0x00, 0x00, 0x00, 0x04, 0x10, 0x36, 0x15, 0x00, 0x00, 0x00, 0x34,
+    0x01, 0xd0, 0x00, 0x86, 0x7c, 0x00, 0x00, 0xa0, 0x10, 0xfa, 0x0e, 0x00, 0x00, 0x00, 0x85, 0x01,
+    0x98, 0x22, 0x00, 0x00, 0x00, 0x50, 0x0c, 0x20, 0x75, 0xbc, 0x30, 0x01, 0x80, 0xe0, 0x20, 0x06,
+    0x0c, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x18, 0x96, 0x00, 0x00, 0x00, 0xc0, 0x14, 0xc0, 0x6a, 0xf8,
+    0x27, 0x01, 0x00, 0x02, 0x41, 0xd0, 0x1a, 0x00, 0x00, 0x00, 0x24, 0x0a, 0x00, 0x4f, 0x0e, 0x79,
+    0x00, 0x20, 0x80, 0x10, 0xf7, 0x0b, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x0c, 0x3c, 0x00, 0x00, 0x00,
+    0x58, 0x08, 0x40, 0x16, 0xcc, 0x20, 0x01, 0xc0, 0xd0, 0x20, 0xe6, 0x0a, 0x00, 0x00, 0x00, 0x90,
+    0x00, 0x40, 0x6e, 0x00, 0x00, 0x00, 0xd0, 0x08, 0x80, 0x0b, 0x98, 0xf6, 0x01, 0x00, 0xa0, 0x42,
+    0x48, 0xbf, 0x41, 0x07, 0x00, 0x14, 0x07, 0x42, 0x89, 0x00, 0x00, 0x00, 0x40, 0x39, 0x80, 0xe3,
+    0xf1, 0xda, 0x04, 0x00, 0xc2, 0x83, 0x04, 0x41, 0x00, 0x00, 0x00, 0x38, 0x04, 0xc0, 0x76, 0x02,
+    0x00, 0x00, 0x00, 0x63, 0x00, 0x10, 0x63, 0x84, 0x06, 0x00, 0x88, 0x04, 0x99, 0x73, 0x00, 0x00,
+    0x00, 0x90, 0x2c, 0xc0, 0x45, 0x59, 0xeb, 0x01, 0x80, 0x20, 0x42, 0x78, 0x33, 0x00, 0x00, 0x00,
+    0x18, 0x08, 0xc0, 0xf9, 0x00, 0x00, 0x00, 0x60, 0x29, 0x80, 0x96, 0x70, 0xaf, 0x04, 0x00, 0x83,
+    0x83, 0x10, 0x3b, 0x00, 0x00, 0x00, 0x40, 0x04, 0xc0, 0x01, 0x02, 0x00, 0x00, 0x40, 0x33, 0x00,
+    0x5b, 0x60, 0xf8, 0x07, 0x00, 0x00, 0x0b, 0x49, 0x08, 0x47, 0x31, 0x00, 0x50, 0x20, 0x88, 0x38,
+    0x02, 0x00, 0x00, 0x00, 0x05, 0x01, 0xa6, 0xc7, 0xad, 0x13, 0x00, 0x08, 0x10, 0x32, 0x3e, 0x01,
+    0x00, 0x00, 0xe0, 0x18, 0x80, 0x2d, 0x0a, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x08, 0x91, 0x39, 0x1f,
+    0x00, 0x20, 0x14, 0x24, 0xf3, 0x01, 0x00, 0x00, 0x40, 0xc2, 0x00, 0x52, 0x08, 0x00, 0x00, 0x00,
+    0x1c, 0x40, 0xf0, 0x29, 0x67, 0x3e, 0x00, 0x10, 0x48, 0x48, 0xd4, 0x16, 0xae, 0x00, 0x00, 0x23,
+    0x41, 0x34, 0x20, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x19, 0x0e, 0x9a, 0x00, 0x60, 0x78, 0x10,
+    0x0c, 0x09, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xf8, 0x46, 0x00, 0x00, 0x00, 0x68, 0x08, 0xe0, 0x12,
+    0xdc, 0x04, 0x01, 0x00, 0x70, 0x21, 0x2c, 0xe2, 0xb4, 0x07, 0x00, 0x8a, 0x04, 0xa9, 0x4b, 0x00,
+    0x00, 0x00, 0xa0, 0x24, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x07, 0x10, 0x9a, 0xc7, 0xd4, 0x13,
+    0x00, 0x08, 0x11, 0x42, 0x70, 0x01, 0x00, 0x00, 0xe0, 0x20, 0x80, 0x66, 0x0a, 0x00, 0x00, 0x00,
+    0x0c, 0x02, 0xf8, 0x94, 0xed, 0x22, 0x00, 0x20, 0x16, 0x04, 0x1f, 0x02, 0x00, 0x00, 0x40, 0xd2,
+    0x00, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x10, 0x2b, 0x87, 0x3f, 0x00, 0x10, 0x4c, 0xc8,
+    0x2f, 0x57, 0x4c, 0x01, 0x00, 0x43, 0x41, 0x0c, 0x21, 0x00, 0x00, 0x00, 0x2c, 0x07, 0xe0, 0x1d,
+    0xf6, 0x9c, 0x00, 0x60, 0x80, 0x10, 0x86, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x01, 0xf0, 0x4b, 0x00,
+    0x00, 0x00, 0x68, 0x0a, 0xa0, 0x1c, 0xbc, 0x0c, 0x01, 0x00, 0x80, 0x21, 0x19, 0x63, 0xcd, 0x08,
+    0x00, 0x0a, 0x05, 0xe9, 0x53, 0x00, 0x00, 0x00, 0xa0, 0x28, 0xc0, 0x63, 0x03, 0x00, 0x00, 0x80,
+    0x27, 0x00, 0x7c, 0xc7, 0xe9, 0x13, 0x00, 0x08, 0x12, 0xa2, 0x9d, 0x01, 0x00, 0x00, 0xe0, 0x28,
+    0x00, 0x89, 0x0a, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x40, 0x98, 0xbd, 0x25, 0x00, 0x20, 0x18, 0xe4,
+    0x4d, 0x02, 0x00, 0x00, 0x40, 0xe2, 0x00, 0x21, 0x12, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x78, 0x2c,
+    0x13, 0x41, 0x00, 0x10, 0x50, 0xc8, 0x80, 0x17, 0xad, 0x01, 0x00, 0x63, 0x41, 0xfc, 0x21, 0x00,
+    0x00, 0x00, 0x2c, 0x08, 0x00, 0x22, 0x1e, 0x9f, 0x00, 0x60, 0x88, 0x10, 0xd9, 0x0b, 0x00, 0x00,
+    0x00, 0x48, 0x01, 0xa4, 0x4f, 0x00, 0x00, 0x00, 0x68, 0x0c, 0x00, 0x29, 0x0c, 0x17, 0x01, 0x00,
+    0x90, 0x21, 0xd0, 0x63, 0x99, 0x09, 0x00, 0x8a, 0x05, 0x81, 0x5e, 0x00, 0x00, 0x00, 0xa0, 0x2c,
+    0x40, 0x3d, 0x04, 0x00, 0x00, 0x80, 0x47, 0x00, 0x52, 0xc7, 0xf8, 0x13, 0x00, 0x08, 0x13, 0xc2,
+    0xc5, 0x01, 0x00, 0x00, 0xe0, 0x30, 0x00, 0xa4, 0x0a, 0x00, 0x00, 0x00, 0x8c, 0x02, 0xec, 0x9a,
+    0xdf, 0x27, 0x00, 0x20, 0x1a, 0x84, 0x80, 0x02, 0x00, 0x00, 0x40, 0xf2, 0x00, 0xbe, 0x14, 0x00,
+    0x00, 0x00, 0x9c, 0x01, 0x40, 0x2e, 0x47, 0x43, 0x00, 0x10, 0x54, 0x48, 0xc7, 0xb7, 0xf4, 0x01,
+    0x00, 0x83, 0x41, 0x16, 0x23, 0x00, 0x00, 0x00, 0x2c, 0x09, 0x00, 0x25, 0x86, 0xa0, 0x00, 0x60,
+    0x90, 0x10, 0x0b, 0x0d, 0x00, 0x00, 0x00, 0x88, 0x01, 0x44, 0x52, 0x00, 0x00, 0x00, 0x68, 0x0e,
+    0xa0, 0x37, 0x0c, 0x23, 0x01, 0x00, 0xa0, 0x21, 0x5d, 0x64, 0x32, 0x0a, 0x00, 0x0a, 0x06, 0x91,
+    0x6c, 0x00, 0x00, 0x00, 0xa0, 0x30, 0x80, 0xdb, 0x04, 0x00, 0x00, 0x80, 0x67, 0x00, 0x22, 0xc7,
+    0x04, 0x14, 0x00, 0x08, 0x14, 0x22, 0xea, 0x01, 0x00, 0x00, 0xe0, 0x38, 0x80, 0xb1, 0x0a, 0x00,
+    0x00, 0x00, 0xcc, 0x02, 0x20, 0x9d, 0x7d, 0x29, 0x00, 0x20, 0x1c, 0x24, 0xb3, 0x02, 0x00, 0x00,
+    0x40, 0x02, 0x01, 0xb6, 0x16, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x98, 0x30, 0x0b, 0x46, 0x00, 0x10,
+    0x58, 0xc8, 0x04, 0xd8, 0x2b, 0x02, 0x00, 0xa3, 0x41, 0x90, 0x24, 0x00, 0x00, 0x00, 0x2c, 0x0a,
+    0x20, 0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3d, 0xb1, 0x0b, 0x05, 0x00, 0xc3, 0x84, 0xec,
+    0x70, 0x00, 0x00, 0x00, 0x40, 0x0e, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x40, 0x83, 0x00, 0x44, 0xe2,
+    0x85, 0x09, 0x00, 0x80, 0x0d, 0x31, 0x26, 0x23, 0x55, 0x00, 0x50, 0x34, 0x88, 0xdf, 0x03, 0x00,
+    0x00, 0x00, 0xa5, 0x01, 0xb4, 0x2a, 0x00, 0x00, 0x00, 0x3c, 0x04, 0xc0, 0x37, 0xb6, 0xa0, 0x00,
+    0x40, 0xa8, 0x90, 0x4e, 0xb0, 0x69, 0x01, 0x00, 0x07, 0x82, 0xf8, 0x55, 0x00, 0x00, 0x00, 0x60,
+    0x18, 0xe0, 0xf6, 0x4c, 0x55, 0x01, 0x00, 0xf1, 0x20, 0x31, 0x17, 0x00, 0x00, 0x00, 0x92, 0x08,
+    0x80, 0xc1, 0x00, 0x00, 0x00, 0xe0, 0x14, 0x40, 0x9b, 0x59, 0x4b, 0x02, 0x80, 0xe0, 0x42, 0xca,
+    0xc1, 0xba, 0x12, 0x00, 0x18, 0x0e, 0x82, 0x33, 0x01, 0x00, 0x00, 0x60, 0x59, 0x80, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x6c, 0x8a, 0x81, 0x28, 0x00, 0x18, 0x28, 0xc4, 0xc3, 0x03, 0x00,
+    0x00, 0x00, 0x82, 0x00, 0x4b, 0x15, 0x00, 0x00, 0x00, 0x9a, 0x04, 0xd0, 0x16, 0xe3, 0x4f, 0x00,
+    0x00, 0x70, 0x08, 0x45, 0x19, 0xbe, 0x02, 0x80, 0xc2, 0x41, 0x58, 0x23, 0x00, 0x00, 0x00, 0x28,
+    0x0e, 0x40, 0x6d, 0x01, 0x00, 0x00, 0xe0, 0x29, 0x80, 0xb6, 0x31, 0x0d, 0x05, 0x00, 0x82, 0x85,
+    0x88, 0x89, 0xa1, 0x17, 0x00, 0x38, 0x12, 0x24, 0xb3, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x0b,
+    0x68, 0xe3, 0x0a, 0x00, 0x08, 0x08, 0x19, 0xc6, 0x00, 0x00, 0x00, 0x90, 0x48, 0xc0, 0x51, 0x06,
+    0x00, 0x00, 0x00, 0xc7, 0x00, 0xac, 0xcd, 0x53, 0x13, 0x00, 0x04, 0x18, 0xc2, 0x19, 0x8e, 0x9e,
+    0x00, 0xc0, 0x78, 0x10, 0x2c, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x03, 0x90, 0x45, 0x00, 0x00, 0x00,
+    0x80, 0x04, 0x20, 0x57, 0xfc, 0x44, 0x01, 0xc0, 0x50, 0x21, 0xc8, 0x5f, 0x05, 0x04, 0x00, 0x90,
+    0x04, 0x91, 0xab, 0x00, 0x00, 0x00, 0xd0, 0x28, 0x40, 0xde, 0xd8, 0x9d, 0x02, 0x00, 0xa0, 0x43,
+    0x88, 0xca, 0x68, 0x16, 0x00, 0x14, 0x0f, 0x32, 0x3e, 0x01, 0x00, 0x00, 0x40, 0x79, 0x80, 0x01,
+    0x0c, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x84, 0x8d, 0xbd, 0x28, 0x00, 0x10, 0x2e, 0x04, 0x7d, 0x3c,
+    0xf6, 0x00, 0xc0, 0xa1, 0x20, 0xc9, 0x15, 0x00, 0x00, 0x00, 0x18, 0x07, 0xd8, 0x0f, 0x00, 0x00,
+    0x00, 0x10, 0x01, 0x42, 0x13, 0xfa, 0xc2, 0x02, 0x00, 0x22, 0x42, 0x8c, 0x34, 0x00, 0x00, 0x00,
+    0x24, 0x13, 0xa0, 0xa0, 0x01, 0x00, 0x00, 0xc0, 0x39, 0x80, 0xa8, 0xb3, 0x1a, 0x05, 0x00, 0x41,
+    0x86, 0xd4, 0x88, 0x59, 0x29, 0x00, 0x30, 0x20, 0x44, 0xb4, 0x02, 0x00, 0x00, 0xc0, 0xd2, 0x00,
+    0x04, 0x14, 0x00, 0x00, 0x00, 0xa0, 0x01, 0xa0, 0x16, 0x6f, 0x51, 0x00, 0x30, 0x58, 0x08, 0x4c,
+    0xb8, 0x9d, 0x01, 0x00, 0x44, 0x41, 0x26, 0x2b, 0x00, 0x00, 0x00, 0x34, 0x0b, 0xe0, 0x41, 0x0e,
+    0xaf, 0x00, 0x00, 0xf0, 0x10, 0xb1, 0x32, 0xaf, 0xed, 0x10, 0x05, 0xe4, 0xd4, 0x58, 0x00, 0x00,
+    0x00, 0x50, 0x20, 0x80, 0x1c, 0x03, 0x00, 0x00, 0xc0, 0x73, 0x00, 0x61, 0xe3, 0x4e, 0x0a, 0x00,
+    0x04, 0x0c, 0xd9, 0x29, 0x03, 0x48, 0x00, 0x70, 0x2c, 0x88, 0x83, 0x05, 0x00, 0x00, 0x00, 0xe6,
+    0x01, 0x82, 0x1a, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x88, 0x86, 0xb2, 0x00, 0x80, 0x90, 0x10,
+    0xda, 0xad, 0xc0, 0x01, 0x00, 0x09, 0x85, 0x5c, 0x6a, 0x00, 0x00, 0x00, 0x70, 0x10, 0xa0, 0xfa,
+    0x7c, 0x58, 0x01, 0x40, 0xa0, 0x21, 0xb9, 0x62, 0xad, 0x0a, 0x00, 0x8c, 0x08, 0xf9, 0xb8, 0x00,
+    0x00, 0x00, 0xb0, 0x38, 0x00, 0x85, 0x05, 0x00, 0x00, 0x00, 0x88, 0x00, 0xea, 0xc5, 0x70, 0x14,
+    0x00, 0x0c, 0x17, 0x82, 0x26, 0x1e, 0x81, 0x00, 0x00, 0x59, 0x10, 0xd4, 0x0a, 0x00, 0x00, 0x00,
+    0x0d, 0x03, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x98, 0x8c, 0x6c, 0xcf, 0x0c, 0xf0,
+    0x39, 0x71, 0xe5, 0x7a, 0x9b, 0x73, 0x8a, 0xc8, 0xc1, 0xc3, 0x00, 0x00, 0x00, 0xa0, 0x44, 0x40,
+    0x65, 0x06, 0x00, 0x00, 0x80, 0x07, 0x01, 0xe0, 0xc6, 0xf4, 0x14, 0x00, 0x08, 0x19, 0x82, 0x65,
+    0xae, 0x9f, 0x00, 0xe0, 0x60, 0x10, 0x37, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x04, 0xec, 0x49, 0x00,
+    0x00, 0x00, 0x88, 0x04, 0x80, 0x14, 0xad, 0x67, 0x01, 0x00, 0x31, 0x21, 0x0a, 0x5d, 0x94, 0x05,
+    0x00, 0x92, 0x0a, 0xb9, 0xd7, 0x00, 0x00, 0x00, 0xe0, 0x24, 0xc0, 0x17, 0xfa, 0xd4, 0x02, 0x80,
+    0x60, 0x43, 0x4a, 0xc6, 0xe4, 0xf5, 0x6c, 0x18, 0x92, 0x83, 0x8a, 0x01, 0x00, 0x00, 0x60, 0x79,
+    0x80, 0xe0, 0x0b, 0x00, 0x00, 0x00, 0x50, 0x01, 0x64, 0x8c, 0x23, 0x29, 0x00, 0x18, 0x30, 0xe4,
+    0x6c, 0xfc, 0x26, 0x01, 0x00, 0xc2, 0x20, 0xcf, 0x15, 0x00, 0x00, 0x00, 0x9a, 0x06, 0x40, 0x74,
+    0x00, 0x00, 0x00, 0x20, 0x05, 0xc0, 0x57, 0x19, 0xf4, 0x46, 0x35, 0x00, 0x74, 0xe2, 0xca, 0x16,
+    0xf7, 0x29, 0x15, 0x92, 0x83, 0xab, 0x01, 0x00, 0x00, 0x40, 0x91, 0x80, 0x09, 0x0d, 0x00, 0x00,
+    0x00, 0x4f, 0x02, 0x14, 0x8e, 0xb5, 0x2a, 0x00, 0x10, 0x34, 0x04, 0xe9, 0xbc, 0x57, 0x01, 0xc0,
+    0xd1, 0x20, 0xf5, 0x16, 0x00, 0x00, 0x00, 0x98, 0x08, 0x30, 0xb1, 0x00, 0x00, 0x00, 0x10, 0x0d,
+    0xc0, 0x2f, 0xda, 0xd3, 0x02, 0x00, 0x82, 0x42, 0x90, 0xbc, 0x0a, 0x0e, 0x00, 0x24, 0x16, 0x92,
+    0xb3, 0x01, 0x00, 0x00, 0xc0, 0x51, 0x00, 0x73, 0xf4, 0xee, 0x05, 0x00, 0x01, 0x87, 0x08, 0x8e,
+    0x9b, 0xec, 0x23, 0x32, 0x26, 0xc7, 0x48, 0x03, 0x00, 0x00, 0xc0, 0x02, 0x01, 0x1a, 0x19, 0x00,
+    0x00, 0x00, 0x20, 0x03, 0x48, 0x1a, 0x13, 0x53, 0x00, 0x30, 0x64, 0x88, 0x0d, 0x99, 0x86, 0x02,
+    0x00, 0xa4, 0x41, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x34, 0x0e, 0xb0, 0x21, 0x01, 0x00, 0x00, 0x40,
+    0x12, 0x80, 0xf7, 0xb2, 0x16, 0xce, 0x8a, 0x40, 0xe8, 0x94, 0x95, 0x51, 0xee, 0x9e, 0x2a, 0x26,
+    0x07, 0x9c, 0x03, 0x00, 0x00, 0x80, 0x32, 0x01, 0x70, 0x1a, 0x00, 0x00, 0x00, 0x1e, 0x05, 0x30,
+    0x1d, 0x33, 0x57, 0x00, 0x20, 0x6c, 0x48, 0x04, 0x5a, 0xd5, 0x02, 0x80, 0xc3, 0x41, 0x3a, 0x2f,
+    0x00, 0x00, 0x00, 0x30, 0x12, 0xd0, 0x8e, 0x01, 0x00, 0x00, 0x20, 0x22, 0x80, 0x6b, 0x74, 0xb1,
+    0x05, 0x00, 0x44, 0x85, 0x94, 0x7d, 0x83, 0x20, 0x00, 0x48, 0x2e, 0x64, 0x6c, 0x03, 0x00, 0x00,
+    0x80, 0xb3, 0x00, 0xf5, 0x01, 0x00, 0x00, 0x00, 0x26, 0x40, 0x38, 0x4b, 0xeb, 0xe2, 0xf6, 0x13,
+    0x74, 0x4e, 0xf3, 0x78, 0xd3, 0xce, 0x2b, 0x83, 0x72, 0xb0, 0x37, 0x00, 0x00, 0x00, 0x2c, 0x11,
+    0x70, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0xc1, 0x31, 0x43, 0x05, 0x00, 0x83, 0x86, 0x60,
+    0x93, 0x09, 0x2b, 0x00, 0x40, 0x1c, 0x44, 0xcf, 0x02, 0x00, 0x00, 0x40, 0xf3, 0x00, 0xca, 0x14,
+    0x00, 0x00, 0x00, 0xa4, 0x01, 0x98, 0x33, 0xe7, 0xe3, 0x14, 0x0a, 0x88, 0xd0, 0x54, 0x39, 0xe6,
+    0xd6, 0xac, 0x82, 0x72, 0xda, 0x3d, 0x00, 0x00, 0x00, 0x28, 0x14, 0xc0, 0xaa, 0x01, 0x00, 0x00,
+    0xe0, 0x59, 0x80, 0xe9, 0x71, 0x93, 0x4d, 0x2f, 0x02, 0xe7, 0xcc, 0xa2, 0x29, 0x2f, 0x00, 0x38,
+    0x1e, 0x64, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x33, 0x01, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0xa2, 0x02,
+    0x60, 0x47, 0xb3, 0x5b, 0x00, 0x40, 0x58, 0x08, 0x19, 0x38, 0x41, 0x02, 0x80, 0x04, 0x43, 0x14,
+    0x37, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x80, 0xaf, 0x00, 0x00, 0x00, 0x60, 0x0a, 0x80, 0xe9, 0x34,
+    0x66, 0xee, 0x79, 0x81, 0xe7, 0x3c, 0x90, 0xaf, 0xed, 0x1c, 0x33, 0x2a, 0x07, 0xae, 0x03, 0x00,
+    0x00, 0xc0, 0x22, 0x01, 0x12, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x04, 0x50, 0x1e, 0x9b, 0x55, 0x00,
+    0x30, 0x6c, 0x88, 0x55, 0x39, 0xd1, 0x02, 0x00, 0xe4, 0x41, 0x20, 0x2e, 0x00, 0x00, 0x00, 0x34,
+    0x10, 0x50, 0x6f, 0x01, 0x00, 0x00, 0x40, 0x22, 0x80, 0x6f, 0x73, 0x5c, 0x7e, 0xb0, 0xc0, 0x08,
+    0xed, 0x94, 0x63, 0x6e, 0xe8, 0x2a, 0x2a, 0x67, 0x1a, 0x9c, 0x69, 0x00, 0x80, 0x52, 0x21, 0xd0,
+    0x1a, 0x00, 0x00, 0x00, 0x1e, 0x06, 0x00, 0x20, 0x2f, 0xdb, 0xa9, 0x25, 0x74, 0x8e, 0x4e, 0xba,
+    0x08, 0x03, 0x80, 0x03, 0x42, 0x94, 0x32, 0x00, 0x00, 0x00, 0x30, 0x14, 0xe0, 0xcc, 0x01, 0x00,
+    0x00, 0x20, 0x32, 0x00, 0x82, 0xb4, 0xc8, 0x05, 0x00, 0xc4, 0x85, 0x20, 0x85, 0x01, 0x27, 0x00,
+    0x48, 0x32, 0x84, 0x76, 0x03, 0x00, 0x00, 0x80, 0xd3, 0x00, 0x9c, 0x0f, 0x00, 0x00, 0x00, 0x26,
+    0x01, 0x50, 0x51, 0x27, 0xe9, 0xba, 0x19, 0x7c, 0x52, 0x11, 0x99, 0xe0, 0x76, 0x35, 0xc3, 0x72,
+    0xd4, 0x3d, 0x00, 0x00, 0x00, 0x2c, 0x93, 0x01, 0xbc, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x0f,
+    0x32, 0x76, 0x05, 0x00, 0x03, 0x87, 0xc0, 0x96, 0x8d, 0x6e, 0x25, 0x42, 0x20, 0x87, 0xfb, 0x02,
+    0x00, 0x00, 0x40, 0x13, 0x01, 0xb7, 0x18, 0x00, 0x00, 0x00, 0xa4, 0x02, 0xb0, 0x39, 0x0b, 0xe7,
+    0x94, 0x0b, 0x90, 0x10, 0x48, 0xd9, 0xe5, 0xee, 0xaf, 0xc2, 0x72, 0x1e, 0xc5, 0x57, 0x0c, 0x00,
+    0x28, 0x16, 0xb2, 0xae, 0x01, 0x00, 0x00, 0xe0, 0x69, 0x00, 0x18, 0x72, 0xd2, 0xdd, 0x77, 0x82,
+    0xe7, 0x8c, 0xa6, 0x99, 0xf1, 0x4a, 0x3a, 0x22, 0xc7, 0x48, 0x03, 0x00, 0x00, 0x00, 0x53, 0x01,
+    0x21, 0x1e, 0x00, 0x00, 0x00, 0xa2, 0x03, 0x10, 0x49, 0x9f, 0x5d, 0x00, 0x40, 0x60, 0xc8, 0x82,
+    0x98, 0x95, 0x02, 0x80, 0x44, 0x43, 0xda, 0x37, 0x00, 0x00, 0x00, 0x38, 0x0e, 0x50, 0x30, 0x01,
+    0x00, 0x00, 0x60, 0x1a, 0x00, 0x33, 0x75, 0xb3, 0x6e, 0xb1, 0x01, 0x28, 0xd5, 0x91, 0x45, 0xee,
+    0x7c, 0x33, 0x2e, 0x87, 0x09, 0xcc, 0x9c, 0x00, 0xc0, 0x42, 0x21, 0x41, 0x1c, 0x00, 0x00, 0x00,
+    0x20, 0x05, 0xf0, 0x23, 0x73, 0x59, 0x00, 0x30, 0x74, 0x88, 0x7c, 0x79, 0xfa, 0x96, 0x36, 0x24,
+    0x72, 0xbc, 0x31, 0x00, 0x00, 0x00, 0x34, 0x12, 0x50, 0xa2, 0x01, 0x00, 0x00, 0x40, 0x32, 0x80,
+    0xba, 0x33, 0x7b, 0x7e, 0xbc, 0x40, 0x09, 0x15, 0x94, 0x57, 0x6e, 0x12, 0x2b, 0x2e, 0x27, 0x84,
+    0xfc, 0xff, 0x00, 0x80, 0x72, 0x21, 0xf7, 0x1a, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x80, 0x25, 0x00,
+    0x00, 0x00, 0x40, 0x01, 0x82, 0x16, 0x79, 0xf7, 0xce, 0x46, 0xe1, 0x73, 0xee, 0xd3, 0x32, 0xb9,
+    0x90, 0x1d, 0x92, 0x43, 0xb5, 0xfd, 0x25, 0x00, 0x80, 0xb1, 0x90, 0x91, 0x0f, 0x00, 0x00, 0x00,
+    0x11, 0x02, 0x24, 0xa5, 0x83, 0x2f, 0x00, 0x20, 0x32, 0xc4, 0x56, 0x2c, 0x5a, 0x01, 0x40, 0xb2,
+    0x21, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x9c, 0x07, 0xd8, 0xae, 0x00, 0x00, 0x00, 0x30, 0x11, 0x00,
+    0xa1, 0x7a, 0x63, 0xe7, 0xde, 0x20, 0x94, 0x38, 0xc9, 0x3a, 0x77, 0xc7, 0x19, 0x98, 0xd3, 0x18,
+    0x8e, 0x6e, 0x00, 0x60, 0xa9, 0x10, 0x52, 0x0e, 0x00, 0x00, 0x00, 0xd0, 0x02, 0xd8, 0x09, 0x00,
+    0x00, 0x00, 0xa8, 0x00, 0xe1, 0x9c, 0xcc, 0x6e, 0x4f, 0xd1, 0xe0, 0x39, 0x19, 0x66, 0x1b, 0x5c,
+    0x07, 0x11, 0xc9, 0x81, 0xd0, 0x00, 0x00, 0x00, 0xd0, 0x4c, 0x80, 0xd3, 0x56, 0x0e, 0x00, 0x00,
+    0xe9, 0x40, 0x38, 0xcf, 0xec, 0xf9, 0xe8, 0x02, 0xa6, 0xa4, 0x4e, 0x76, 0xb9, 0xc7, 0xac, 0xc0,
+    0x9c, 0xc1, 0xf2, 0xad, 0x04, 0x00, 0x0a, 0x86, 0x18, 0x6c, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x60,
+    0xcb, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x81, 0xe4, 0x10, 0x5c, 0x3d, 0x05, 0x10, 0xca, 0x51,
+    0xdf, 0xe5, 0x35, 0x77, 0x4c, 0x4e, 0x19, 0xb7, 0x22, 0x01, 0x00, 0xe6, 0x42, 0xd2, 0x3f, 0x00,
+    0x00, 0x00, 0x44, 0x09, 0x60, 0x97, 0x6e, 0xc1, 0x00, 0x80, 0xd0, 0x10, 0xa3, 0xb1, 0x98, 0xdd,
+    0x4d, 0x09, 0xe7, 0xa8, 0x72, 0x00, 0x00, 0x00, 0x70, 0x20, 0x80, 0x04, 0x03, 0x00, 0x00, 0xc0,
+    0x54, 0x00, 0x7e, 0xea, 0x99, 0x9d, 0x84, 0x03, 0x51, 0x02, 0x26, 0x33, 0xdd, 0x35, 0x67, 0x64,
+    0x8e, 0xaa, 0x98, 0x17, 0x02, 0x80, 0xc5, 0x42, 0xd2, 0x39, 0x00, 0x00, 0x00, 0x40, 0x0c, 0xe0,
+    0xaf, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x80, 0xac, 0x72, 0xe1, 0x1d, 0x68, 0xc3, 0xe7, 0xc4, 0x98,
+    0xf1, 0xf0, 0x90, 0x44, 0x26, 0x87, 0x6d, 0x03, 0x00, 0x00, 0x40, 0x43, 0x01, 0x3b, 0x5c, 0x90,
+    0x03, 0x00, 0x24, 0x04, 0x59, 0x3d, 0x17, 0xe7, 0x28, 0x0b, 0x9c, 0x92, 0x34, 0xf9, 0xe6, 0x5e,
+    0xb5, 0x22, 0x73, 0x70, 0xcd, 0xd6, 0x14, 0x00, 0x28, 0x19, 0xb2, 0xb1, 0x01, 0x00, 0x00, 0xe0,
+    0x81, 0x00, 0xcf, 0x09, 0x00, 0x00, 0x00, 0x94, 0x00, 0x64, 0x92, 0xd9, 0xf0, 0x56, 0x15, 0x42,
+    0x28, 0x4d, 0xdd, 0x9a, 0x6b, 0xdf, 0x41, 0x39, 0x7c, 0xdd, 0x0d, 0x06, 0x00, 0x18, 0x0c, 0xb1,
+    0x03, 0x01, 0x00, 0x00, 0x10, 0x29, 0x46, 0x6a, 0xba, 0x14, 0xef, 0x1a, 0x62, 0x73, 0x82, 0xc7,
+    0xfe, 0x36, 0xbf, 0x25, 0x9d, 0x13, 0xd3, 0x01, 0x00, 0x00, 0xc0, 0x89, 0x00, 0x0e, 0x0d, 0x00,
+    0x00, 0x00, 0x93, 0x01, 0x5c, 0xa9, 0x25, 0x76, 0xfa, 0x0d, 0x46, 0x88, 0x9c, 0xec, 0x75, 0x13,
+    0x9d, 0xa1, 0x39, 0x9d, 0xe3, 0x79, 0x09, 0x00, 0x96, 0x0b, 0xe1, 0xe8, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x80, 0xdf, 0x03, 0x00, 0x00, 0x80, 0x4a, 0x00, 0x96, 0xcb, 0x1b, 0xb8, 0x08, 0x0e, 0xa0,
+    0xa3, 0x63, 0x16, 0xc5, 0x6f, 0x13, 0xa1, 0xa0, 0x71, 0x0e, 0x00, 0x00, 0x00, 0x4d, 0x05, 0xec,
+    0x73, 0x69, 0x13, 0x00, 0x90, 0x12, 0xa4, 0xf4, 0xdc, 0x97, 0x5b, 0x29, 0x80, 0x4a, 0xc3, 0x64,
+    0xa6, 0xfb, 0xe2, 0x0a, 0xcd, 0x01, 0x3e, 0x0f, 0x5a, 0x00, 0xa0, 0x68, 0x08, 0xcf, 0x56, 0x23,
+    0x00, 0x80, 0x27, 0x42, 0x04, 0x2f, 0x00, 0x00, 0x00, 0x50, 0x03, 0x20, 0x4a, 0xe6, 0xc4, 0x5d,
+    0x56, 0x10, 0xa1, 0x46, 0x75, 0x74, 0x6e, 0x84, 0x47, 0xe5, 0x28, 0x7a, 0xf9, 0x1c, 0x00, 0x60,
+    0x32, 0x84, 0x1b, 0x4c, 0x11, 0x00, 0x40, 0xb4, 0x20, 0xe2, 0xe9, 0x94, 0x7c, 0xc0, 0x08, 0xce,
+    0x51, 0x21, 0xdb, 0xdd, 0x43, 0x98, 0x78, 0x8e, 0x75, 0x07, 0x00, 0x00, 0x00, 0x47, 0x02, 0x80,
+    0x37, 0x00, 0x00, 0x00, 0x4c, 0x07, 0xc0, 0xa0, 0xde, 0xd5, 0x8d, 0x36, 0x20, 0xa1, 0x82, 0x32,
+    0xdc, 0x6d, 0x75, 0xc6, 0xe6, 0xb0, 0x91, 0x65, 0x29, 0x00, 0x58, 0x30, 0x24, 0xa9, 0x03, 0x00,
+    0x00, 0x00, 0xe4, 0x00, 0xd8, 0x12, 0x00, 0x00, 0x00, 0xaa, 0x01, 0xe8, 0x31, 0xa3, 0xe2, 0x72,
+    0x39, 0x84, 0xd2, 0x8d, 0x59, 0x17, 0xbf, 0x50, 0xa4, 0x82, 0xe4, 0x3c, 0x00, 0x00, 0x00, 0x34,
+    0x16, 0xe0, 0xd8, 0xad, 0x5a, 0x00, 0x40, 0x52, 0x10, 0xc8, 0x33, 0x45, 0x1e, 0x92, 0x40, 0xea,
+    0xd0, 0x92, 0xd5, 0xee, 0xca, 0x2b, 0x36, 0x67, 0x13, 0x3d, 0x7d, 0x01, 0x80, 0xb2, 0x21, 0x6f,
+    0xdb, 0xd5, 0x01, 0x00, 0x1e, 0x09, 0x29, 0xd4, 0x00, 0x00, 0x00, 0x40, 0x11, 0x00, 0x27, 0xd9,
+    0x15, 0x27, 0x5b, 0x61, 0x84, 0x50, 0xd5, 0xec, 0x79, 0x24, 0x1e, 0x96, 0xf3, 0xf8, 0x35, 0x84,
+    0x00, 0x80, 0xd1, 0x90, 0x8d, 0x30, 0x26, 0x01, 0x00, 0x11, 0x83, 0x94, 0x14, 0x00, 0x00, 0x00,
+    0xb0, 0x00, 0x61, 0x43, 0x0d, 0x9b, 0xa7, 0x1f, 0xd1, 0x39, 0x81, 0xe4, 0xe9, 0x3b, 0x24, 0x93,
+    0xcf, 0xe1, 0xf4, 0x00, 0x00, 0x00, 0xe0, 0x4c, 0x00, 0x4a, 0x07, 0x00, 0x00, 0x80, 0x09, 0x01,
+    0x4c, 0xd3, 0x34, 0xba, 0x86, 0x06, 0x25, 0x64, 0x52, 0x2e, 0xbc, 0xd7, 0xce, 0xe0, 0x9c, 0x88,
+    0x72, 0x84, 0x05, 0x00, 0x4b, 0x86, 0xc0, 0x75, 0x00, 0x00, 0x00, 0x80, 0x1e, 0xe0, 0xb0, 0x02,
+    0x00, 0x00, 0x40, 0x45, 0x00, 0xa3, 0xe6, 0x91, 0xfc, 0x4e, 0x07, 0x51, 0x5a, 0x31, 0x1b, 0xe3,
+    0x56, 0x8a, 0x58, 0x10, 0x01, 0x08, 0x00, 0x00, 0x80, 0xe6, 0x32, 0x00, 0xbc, 0x75, 0x0c, 0x00,
+    0x48, 0x0b, 0xf2, 0x76, 0xb6, 0xc4, 0xfb, 0x0e, 0x50, 0x9d, 0x58, 0x32, 0xe5, 0xed, 0x82, 0x05,
+    0xe7, 0x3c, 0xa5, 0xab, 0xf1, 0x77, 0x52, 0x38, 0xe7, 0x76, 0xbb, 0x58, 0x00, 0xc0, 0x33, 0x21,
+    0xfb, 0x1c, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x08, 0x24, 0x7f, 0xe2, 0x58, 0x2b, 0x90, 0x92, 0xae,
+    0xda, 0x3f, 0x27, 0xc6, 0xe3, 0x72, 0xfe, 0xc0, 0x39, 0x12, 0x00, 0x30, 0x1b, 0x22, 0x14, 0xc6,
+    0x30, 0x00, 0x20, 0x6a, 0x10, 0xdc, 0x05, 0x00, 0x00, 0x00, 0x56, 0x00, 0x38, 0xa9, 0x5d, 0xf4,
+    0xb4, 0x24, 0x3c, 0x87, 0x99, 0x8c, 0x81, 0xeb, 0x66, 0x02, 0x4a, 0x74, 0xdf, 0x99, 0x01, 0x00,
+    0x1c, 0x0a, 0x89, 0xf2, 0x00, 0x00, 0x00, 0x30, 0x25, 0x46, 0x49, 0x1a, 0x30, 0x67, 0xc2, 0xc0,
+    0x74, 0x9a, 0xca, 0xa3, 0xb7, 0xe7, 0x19, 0x9d, 0x23, 0x59, 0xe6, 0xb8, 0xd1, 0x65, 0xd1, 0x1c,
+    0xd0, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x04, 0x10, 0x5f, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0xa0, 0xdf,
+    0x9c, 0x98, 0xdf, 0xec, 0x30, 0x4a, 0x19, 0x66, 0x63, 0xbc, 0x4f, 0x91, 0x0b, 0x9a, 0x0c, 0x0b,
+    0x25, 0x00, 0xd0, 0x60, 0x08, 0x95, 0xd7, 0xa7, 0x01, 0x00, 0x89, 0x41, 0x8c, 0x0a, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x20, 0x74, 0x1e, 0xc0, 0x45, 0x0a, 0x58, 0x9d, 0x58, 0x32, 0xf1, 0xdd, 0x8c,
+    0x45, 0xe7, 0x88, 0xa7, 0x37, 0xf3, 0xe2, 0x53, 0x3a, 0xa7, 0x83, 0x5b, 0x76, 0x00, 0xc0, 0x43,
+    0x21, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x28, 0x03, 0xb8, 0x22, 0xbf, 0xe1, 0xfe, 0x2a, 0x94, 0x92,
+    0xb1, 0x1a, 0x42, 0xa7, 0xc7, 0x03, 0x73, 0xc6, 0xc2, 0xb3, 0x13, 0x00, 0x30, 0x1c, 0x72, 0x15,
+    0x16, 0x38, 0x00, 0x20, 0x72, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x96, 0x00, 0xe0, 0xa9, 0x3b,
+    0xf5, 0x4a, 0x25, 0x3e, 0xc8, 0xa1, 0xec, 0x84, 0x83, 0x68, 0x12, 0x4a, 0x5b, 0xe0, 0x7b, 0x04,
+    0x00, 0x9c, 0x0a, 0x39, 0xfa, 0x36, 0x1a, 0x00, 0x30, 0x29, 0x08, 0x23, 0xba, 0x14, 0xe7, 0xab,
+    0xe0, 0x74, 0xee, 0xca, 0xc7, 0xb7, 0xf9, 0x19, 0x9e, 0x23, 0x5f, 0x2e, 0xbf, 0xb7, 0x6d, 0xd9,
+    0x1c, 0xf1, 0x0e, 0x00, 0x00, 0x00, 0x50, 0x04, 0x90, 0x66, 0x00, 0x00, 0x00, 0xa8, 0x0c, 0x00,
+    0xe9, 0xec, 0x9c, 0xa7, 0xee, 0x40, 0x4a, 0x04, 0xe6, 0x61, 0xbc, 0x52, 0x11, 0x0c, 0xb2, 0x18,
+    0x4b, 0x36, 0x00, 0xd0, 0x64, 0x08, 0xa4, 0x17, 0xb9, 0x01, 0x00, 0xa9, 0x41, 0xf4, 0x0e, 0x00,
+    0x00, 0x00, 0x70, 0x01, 0x50, 0x71, 0x6e, 0xbb, 0x00, 0x00, 0x60, 0x11, 0x5a, 0xb2, 0xfe, 0x5d,
+    0x97, 0x85, 0x27, 0x51, 0xa9, 0x57, 0xf4, 0xb1, 0x54, 0x3c, 0x07, 0x93, 0xab, 0x92, 0x00, 0xc0,
+    0x53, 0x21, 0x8b, 0x20, 0x00, 0x00, 0x00, 0xa8, 0xc3, 0xc0, 0x20, 0x7b, 0xe0, 0x59, 0x2a, 0x98,
+    0xd2, 0xb3, 0x5a, 0x44, 0x3f, 0xc9, 0x23, 0x73, 0x52, 0xc4, 0xeb, 0x14, 0x00, 0x30, 0x1d, 0x02,
+    0x16, 0x9e, 0x3d, 0x00, 0x20, 0x7a, 0x90, 0xb8, 0x09, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x4c, 0xaa,
+    0xe3, 0xf5, 0xb9, 0x25, 0x40, 0x88, 0xa8, 0x5c, 0x87, 0xa3, 0x69, 0x22, 0x4a, 0x45, 0xe1, 0x34,
+    0x06, 0x00, 0x1c, 0x0b, 0xb1, 0x00, 0xd3, 0x23, 0x00, 0x30, 0x2d, 0x08, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x10, 0xd4, 0xcf, 0xac, 0x17, 0x00, 0x04, 0x28, 0xa2, 0x5a, 0xee, 0xbf, 0x9f, 0xd0,
+    0xf8, 0x1c, 0x1a, 0x33, 0x1e, 0x7e, 0x8c, 0x0b, 0xe7, 0xfc, 0x78, 0x00, 0x00, 0x00, 0x80, 0x24,
+    0x60, 0x66, 0x0b, 0x00, 0x00, 0x40, 0x75, 0x20, 0x7b, 0x67, 0xf6, 0xfc, 0x78, 0x87, 0x12, 0x62,
+    0x2f, 0xeb, 0xe2, 0xa1, 0x8a, 0x64, 0x50, 0x20, 0xf9, 0x17, 0x02, 0x80, 0x46, 0x43, 0x6e, 0xbd,
+    0x1f, 0x0e, 0x00, 0x48, 0x0e, 0x22, 0x8e, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x04, 0x6b, 0x04, 0x00,
+    0x00, 0x00, 0x9c, 0x00, 0xa0, 0x9b, 0xa3, 0x2d, 0x00, 0x00, 0x5a, 0x44, 0x97, 0x3c, 0x83, 0x47,
+    0x68, 0xf1, 0x49, 0xab, 0x6a, 0x4a, 0xbd, 0x4c, 0x95, 0x0f, 0x72, 0xe9, 0xbe, 0x2b, 0x00, 0xf0,
+    0x58, 0xc8, 0x73, 0xb8, 0x07, 0x01, 0x00, 0x0a, 0x41, 0x8e, 0xc7, 0xaf, 0x77, 0x57, 0x0a, 0xa7,
+    0x24, 0xad, 0xbe, 0xd1, 0xc1, 0xf2, 0xd0, 0xa4, 0x6e, 0x31, 0x7c, 0x0d, 0x27, 0x8c, 0xe7, 0x98,
+    0x85, 0xc9, 0x10, 0x00, 0x88, 0x20, 0x64, 0xca, 0x02, 0x00, 0x00, 0x80, 0x45, 0x00, 0xbf, 0x01,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0xc8, 0x54, 0x93, 0xec, 0xf7, 0x4b, 0x84, 0xd0, 0x5d, 0x79, 0x12,
+    0xaf, 0xd4, 0x64, 0x94, 0x5e, 0xc4, 0x2a, 0x0f, 0x00, 0x38, 0x17, 0xb2, 0x0b, 0x5e, 0x53, 0x00,
+    0x60, 0x62, 0x90, 0x87, 0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0xf0, 0x9c, 0x43, 0x2d, 0x00, 0x08,
+    0x52, 0x64, 0xbc, 0x9c, 0x83, 0x1f, 0xa3, 0x01, 0x3a, 0x5b, 0xe6, 0x6d, 0xdc, 0x3e, 0x97, 0x4e,
+    0xba, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x20, 0x17, 0x11, 0x01, 0x80, 0x0a, 0x41, 0x2c,
+    0xcf, 0xe3, 0xf9, 0xe2, 0x0e, 0x26, 0x14, 0x5d, 0x8e, 0xc5, 0x4f, 0x15, 0xd1, 0xa0, 0xe8, 0xb2,
+    0xd2, 0x04, 0x00, 0xcd, 0x86, 0x48, 0x7b, 0xb7, 0x1c, 0x00, 0x90, 0x1e, 0xc4, 0xfe, 0x01, 0x00,
+    0x00, 0xc0, 0x15, 0x00, 0x8d, 0x09, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x20, 0x36, 0x07, 0x59, 0x00,
+    0x00, 0xb8, 0x08, 0x30, 0xd9, 0x0c, 0xdf, 0xd4, 0x02, 0x94, 0xda, 0xd5, 0xd9, 0xfa, 0xc1, 0x2a,
+    0x20, 0x64, 0xdd, 0x2d, 0x65, 0x00, 0xe0, 0xb9, 0x90, 0x68, 0xb1, 0xf5, 0x02, 0x00, 0x54, 0x82,
+    0xa8, 0x8d, 0x4b, 0x6e, 0xff, 0x13, 0x50, 0xa7, 0x5a, 0xfd, 0xa4, 0x97, 0xe6, 0xb1, 0x49, 0x76,
+    0x63, 0x64, 0x3b, 0xca, 0x98, 0xcf, 0x91, 0x0b, 0x6f, 0x24, 0x00, 0x10, 0x45, 0xc8, 0x33, 0x06,
+    0x00, 0x00, 0x00, 0xab, 0x00, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x01, 0x40, 0xa8, 0x86, 0xd9,
+    0x43, 0x98, 0x10, 0x25, 0xd2, 0xb2, 0x2b, 0x6e, 0xab, 0x09, 0x29, 0x29, 0x8c, 0xd5, 0x22, 0x00,
+    0x70, 0x30, 0xe4, 0x27, 0x7c, 0xb6, 0x00, 0xc0, 0xd4, 0x20, 0x56, 0x0d, 0x00, 0x00, 0x00, 0x30,
+    0x01, 0xa0, 0x34, 0x4f, 0x56, 0x00, 0x10, 0xa8, 0x88, 0x88, 0x39, 0x10, 0xef, 0x4a, 0x23, 0x84,
+    0xda, 0xcc, 0x17, 0x39, 0xac, 0x2e, 0x9e, 0x04, 0xf5, 0x01, 0x00, 0x00, 0x00, 0xa2, 0x00, 0xcd,
+    0x2e, 0xf1, 0x02, 0x00, 0x55, 0x82, 0x58, 0x9e, 0x5b, 0xf3, 0x74, 0x1d, 0x4e, 0x68, 0xb6, 0x8c,
+    0x8a, 0xb7, 0x2a, 0xb2, 0x41, 0xfa, 0xe6, 0xab, 0x0a, 0x00, 0x1a, 0x0e, 0x21, 0xf7, 0x16, 0x3a,
+    0x00, 0x20, 0x41, 0x88, 0x29, 0x05, 0x00, 0x00, 0x80, 0x4b, 0x00, 0xec, 0x13, 0x00, 0x00, 0x00,
+    0x70, 0x04, 0x60, 0x6a, 0xee, 0xad, 0x00, 0x00, 0x78, 0x11, 0x60, 0x72, 0x23, 0x7e, 0xb0, 0x45,
+    0x28, 0x75, 0xac, 0x0d, 0x76, 0xb8, 0x55, 0x42, 0x08, 0xd2, 0x5b, 0xe5, 0x00, 0xc0, 0x83, 0x21,
+    0x97, 0xe3, 0x09, 0x07, 0x00, 0x28, 0x05, 0xb1, 0x49, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x40, 0xc0,
+    0x78, 0xd0, 0x66, 0x30, 0x21, 0x75, 0xb6, 0xd5, 0x70, 0xba, 0x80, 0x1e, 0x9c, 0xa4, 0x3f, 0x9e,
+    0xbb, 0x87, 0x90, 0x01, 0x9d, 0xc3, 0x30, 0x7f, 0x02, 0x00, 0x91, 0x84, 0xe8, 0x6b, 0x00, 0x00,
+    0x00, 0xb0, 0x0c, 0x80, 0xa0, 0x00, 0x00, 0x00, 0xc0, 0x26, 0x00, 0x51, 0xea, 0x84, 0x5d, 0x7c,
+    0x89, 0x51, 0x72, 0x2e, 0x03, 0xe3, 0xc8, 0x9a, 0x94, 0x92, 0xf5, 0x78, 0x6a, 0x02, 0x00, 0x27,
+    0x43, 0x50, 0xc3, 0x09, 0x0c, 0x00, 0x4c, 0x0e, 0x72, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x80,
+    0xf7, 0xf2, 0x1f, 0x05, 0x00, 0xc1, 0x8a, 0x9c, 0x99, 0x99, 0xf1, 0xf9, 0x34, 0x44, 0xa8, 0xcd,
+    0x8c, 0x93, 0x7f, 0xec, 0xf2, 0x49, 0x0d, 0x20, 0x00, 0x00, 0x00, 0xa0, 0xca, 0xf0, 0xf3, 0xb2,
+    0x37, 0x00, 0x50, 0x29, 0x88, 0x61, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x10, 0xf6, 0xce, 0x4a, 0xf9,
+    0x73, 0x0e, 0x28, 0x54, 0x59, 0xfe, 0xc4, 0x67, 0x15, 0xe1, 0xa0, 0xff, 0xb3, 0xc2, 0x05, 0x00,
+    0x4d, 0x87, 0xc0, 0x7b, 0x41, 0x1d, 0x00, 0x90, 0x22, 0xa4, 0x0b, 0x03, 0x00, 0x00, 0xc0, 0x35,
+    0x00, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0xb8, 0x02, 0xa0, 0x34, 0x53, 0x55, 0x00, 0x00, 0xc0, 0xc8,
+    0x2d, 0xb9, 0x14, 0x67, 0xda, 0x42, 0x94, 0x82, 0xd6, 0x24, 0xfb, 0xeb, 0x2a, 0x22, 0x34, 0xf5,
+    0x55, 0x7f, 0x00, 0xe0, 0xc9, 0x90, 0x16, 0xb2, 0xe8, 0x03, 0x00, 0xd4, 0x82, 0x44, 0x16, 0x00,
+    0x00, 0x00, 0xc8, 0x00, 0x41, 0x9a, 0x01, 0x00, 0x00, 0x80, 0x17, 0x00, 0x92, 0xe2, 0xe7, 0x5a,
+    0x59, 0x04, 0xd5, 0xf1, 0x56, 0x53, 0xea, 0x68, 0x7a, 0x74, 0x52, 0x1a, 0xf9, 0xfe, 0x0e, 0x4c,
+    0x26, 0x84, 0x56, 0xc3, 0xfe, 0x0a, 0x00, 0x44, 0x13, 0xd2, 0xcd, 0x01, 0x00, 0x00, 0xc0, 0x3a,
+    0x00, 0x3f, 0x03, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xa8, 0x5f, 0xf5, 0x95, 0x25, 0x48, 0xa9,
+    0xbe, 0x2c, 0x8d, 0x5f, 0x6b, 0x62, 0x4a, 0x8a, 0x64, 0x74, 0x0a, 0x00, 0x1c, 0x0d, 0xe1, 0x0f,
+    0xd7, 0x31, 0x00, 0x30, 0x3d, 0x88, 0xde, 0x04, 0x00, 0x00, 0x00, 0x8c, 0x00, 0xb2, 0xca, 0x86,
+    0x13, 0x00, 0x04, 0x2c, 0xc2, 0x6a, 0xee, 0xc8, 0x13, 0xd5, 0x18, 0xa1, 0x30, 0x73, 0x50, 0xbe,
+    0xb5, 0x0b, 0x28, 0xad, 0x83, 0x4f, 0x0c, 0x00, 0x80, 0x2c, 0x64, 0xe7, 0x1b, 0xf8, 0x00, 0x40,
+    0xb5, 0x20, 0x18, 0x09, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x40, 0x3a, 0xeb, 0xe2, 0x10, 0x38, 0xa4,
+    0x8e, 0x5e, 0x39, 0x13, 0xe7, 0x55, 0xa4, 0x83, 0xba, 0xd1, 0x60, 0xf8, 0x81, 0x34, 0x9e, 0x93,
+    0xef, 0xdd, 0x75, 0x00, 0x40, 0x92, 0x10, 0xb0, 0x0d, 0x00, 0x00, 0x00, 0x17, 0x01, 0xbc, 0x28,
+    0x00, 0x00, 0x00, 0xe0, 0x0c, 0x00, 0xd1, 0x7c, 0x4f, 0x01, 0x00, 0x10, 0x23, 0xa2, 0xe4, 0x55,
+    0x9c, 0x6c, 0x8b, 0x11, 0xe2, 0x5a, 0xdb, 0xec, 0xd3, 0xab, 0x8c, 0x10, 0x07, 0x58, 0x2d, 0x02,
+    0x80, 0x47, 0x43, 0x38, 0xc9, 0xbf, 0x10, 0x00, 0x50, 0x0c, 0x42, 0xaa, 0x00, 0x00, 0x00, 0x20,
+    0x0b, 0x00, 0x92, 0x07, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x80, 0x88, 0x1f, 0x2a, 0x00, 0x10, 0x56,
+    0x84, 0x5c, 0xed, 0xab, 0x77, 0xeb, 0xe1, 0x49, 0xc6, 0xe4, 0x2b, 0xdc, 0x4a, 0x19, 0x11, 0x22,
+    0x0f, 0xdb, 0x30, 0x00, 0x10, 0x51, 0x48, 0xa0, 0xf7, 0xa9, 0x00, 0x00, 0x0b, 0x41, 0x14, 0x10,
+    0x00, 0x00, 0x00, 0x6c, 0x04, 0xb0, 0x98, 0xe6, 0xd0, 0xbd, 0x93, 0x28, 0x25, 0x0e, 0x73, 0x38,
+    0x0e, 0xae, 0xc9, 0x29, 0x8d, 0x94, 0x71, 0x2c, 0x00, 0x70, 0x36, 0x04, 0x47, 0xec, 0xca, 0x00,
+    0xc0, 0x04, 0x21, 0xe1, 0x15, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x78, 0x26, 0x7f, 0x4a, 0x00, 0x10,
+    0xb4, 0x48, 0xbc, 0x19, 0x2d, 0x6f, 0x58, 0x83, 0x84, 0x9e, 0xcc, 0x3e, 0xf9, 0xdc, 0x2e, 0xa1,
+    0x44, 0x1e, 0x6e, 0x4f, 0x00, 0x00, 0xba, 0x90, 0xe8, 0xaf, 0x2a, 0x04, 0x00, 0x15, 0x83, 0x1c,
+    0x32, 0x00, 0x00, 0x00, 0xf8, 0x04, 0xa0, 0xdf, 0xac, 0x7f, 0xaf, 0xd4, 0xa0, 0x3a, 0x5f, 0x65,
+    0x4b, 0x7c, 0x59, 0x11, 0x0f, 0x8a, 0x4c, 0xaf, 0xe5, 0x38, 0xd7, 0x7c, 0xce, 0xc2, 0x17, 0xdd,
+    0x01, 0x00, 0x69, 0x42, 0xd0, 0x3b, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0xa3, 0x00, 0x00, 0x00,
+    0x80, 0x3b, 0x00, 0x44, 0xf3, 0x2b, 0x05, 0x00, 0x80, 0x8c, 0x04, 0x92, 0x27, 0x71, 0xa0, 0x2d,
+    0x48, 0x68, 0x6d, 0xcd, 0xb3, 0x97, 0xaf, 0x42, 0x42, 0xe5, 0x60, 0x69, 0x09, 0x00, 0x9e, 0x0d,
+    0x51, 0x27, 0x17, 0x46, 0x00, 0x40, 0x35, 0x48, 0x98, 0x03, 0x00, 0x00, 0x80, 0x4c, 0x00, 0x84,
+    0x21, 0x00, 0x00, 0x00, 0x78, 0x03, 0x10, 0x1b, 0x66, 0xa2, 0x00, 0x40, 0x60, 0x11, 0x72, 0x35,
+    0xba, 0x9e, 0xb4, 0xc7, 0x27, 0x45, 0x94, 0x3f, 0x71, 0x70, 0x65, 0x46, 0xe8, 0x45, 0xdc, 0xd7,
+    0x00, 0x40, 0x54, 0x21, 0xec, 0x5f, 0x16, 0x05, 0x00, 0xac, 0x04, 0x79, 0x4e, 0x00, 0x00, 0x00,
+    0xb0, 0x15, 0x40, 0x3d, 0x7a, 0x2a, 0x47, 0x3e, 0xc2, 0x74, 0x80, 0xcc, 0xf3, 0x78, 0xba, 0x26,
+    0xa8, 0xe4, 0x59, 0x1e, 0xba, 0xcf, 0xc7, 0xe1, 0x1c, 0x37, 0x71, 0x35, 0x03, 0x00, 0x53, 0x84,
+    0x18, 0x60, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x20, 0x6d, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x5d,
+    0x64, 0xf1, 0x08, 0x00, 0x02, 0x17, 0x81, 0x39, 0x9f, 0xe6, 0x79, 0x6b, 0x94, 0xd0, 0x8d, 0x59,
+    0x26, 0xcf, 0xdb, 0x45, 0x94, 0xde, 0xc5, 0xe4, 0x0c, 0x00, 0x40, 0x18, 0xc2, 0x04, 0x8e, 0x8c,
+    0x00, 0xa0, 0x6a, 0x90, 0x78, 0x07, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x74, 0x9a, 0x27, 0x2e, 0x00,
+    0x18, 0x56, 0x84, 0xa8, 0x6c, 0x89, 0x83, 0x2b, 0xf2, 0x41, 0x21, 0xea, 0x18, 0x7d, 0x2f, 0x1b,
+    0xd0, 0x31, 0xf9, 0x9e, 0x3c, 0x00, 0x20, 0x51, 0xc8, 0xfe, 0x07, 0x00, 0x00, 0x80, 0xcb, 0x30,
+    0xbe, 0x14, 0x00, 0x00, 0x00, 0x70, 0x08, 0xb0, 0x68, 0xce, 0xa3, 0x00, 0x00, 0x98, 0x91, 0x25,
+    0x72, 0x17, 0xae, 0xad, 0x45, 0x09, 0xdd, 0xad, 0x85, 0xf6, 0xf8, 0x55, 0x4a, 0xa8, 0x34, 0x3c,
+    0x41, 0x01, 0xc0, 0xc3, 0x21, 0x17, 0xe5, 0x07, 0x09, 0x00, 0x28, 0x07, 0xb9, 0x8c, 0x00, 0x00,
+    0x00, 0x90, 0x0d, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x96, 0xc2, 0x8c, 0x13, 0x00,
+    0x08, 0x2d, 0x12, 0xae, 0x7e, 0xd8, 0x5f, 0xf7, 0x00, 0x25, 0xa8, 0xf2, 0x33, 0x1e, 0xb3, 0x0c,
+    0x09, 0x3d, 0x8a, 0xc5, 0x1d, 0x00, 0x88, 0x2c, 0xe4, 0x24, 0x8c, 0xd0, 0x00, 0x80, 0xa5, 0x20,
+    0x9d, 0x0b, 0x00, 0x00, 0x00, 0x36, 0x03, 0x08, 0x42, 0x3b, 0xe1, 0xd2, 0x43, 0x9c, 0x0e, 0x99,
+    0xb9, 0x20, 0x97, 0xd7, 0x24, 0x95, 0xfc, 0xcb, 0x12, 0x38, 0xdd, 0x39, 0x9d, 0xb3, 0x29, 0xb6,
+    0x67, 0x00, 0x60, 0x92, 0x10, 0xf0, 0x0c, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0xe8, 0x02, 0x40, 0x7f, 0x0c, 0x14, 0x01, 0x40, 0xf0, 0x22, 0x66, 0xe7, 0xeb, 0xbc, 0x76,
+    0x0d, 0x13, 0xca, 0x30, 0x83, 0xe4, 0x70, 0xbb, 0x8c, 0x50, 0x02, 0x99, 0xf0, 0x01, 0x00, 0x28,
+    0x43, 0x58, 0xc1, 0x39, 0x12, 0x00, 0x54, 0x0e, 0xd2, 0x7a, 0x00, 0x00, 0x00, 0x40, 0x03, 0x84,
+    0x59, 0x08, 0x00, 0x00, 0x00, 0x1f, 0x01, 0xc4, 0x98, 0x17, 0x2c, 0x00, 0x18, 0x58, 0x84, 0xa5,
+    0xcc, 0x89, 0xfb, 0x2b, 0x02, 0x42, 0x8d, 0x6a, 0x5f, 0x9d, 0x5a, 0x9b, 0x50, 0x6a, 0xfa, 0x12,
+    0x3e, 0x00, 0x20, 0x55, 0x08, 0x6d, 0x18, 0x0b, 0x01, 0x80, 0xeb, 0x40, 0x72, 0x15, 0x00, 0x00,
+    0x00, 0x70, 0x09, 0x70, 0x69, 0xae, 0xa2, 0x00, 0x00, 0xa0, 0x91, 0x01, 0xb2, 0x01, 0x0e, 0xa2,
+    0x85, 0x09, 0xe9, 0xad, 0x85, 0xf6, 0xfb, 0x55, 0x4c, 0x88, 0x4b, 0x3c, 0x53, 0x01, 0xc0, 0xd3,
+    0x21, 0x2f, 0x65, 0x36, 0x09, 0x00, 0xa8, 0x07, 0xb1, 0xa3, 0x00, 0x00, 0x00, 0x90, 0x11, 0x40,
+    0xac, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x00, 0xdc, 0xc1, 0xd5, 0x12, 0x00, 0x08, 0x2e, 0x52, 0xad,
+    0x3e, 0xd9, 0xef, 0xf7, 0x08, 0xa5, 0xc1, 0x72, 0x3b, 0xbe, 0xb5, 0x4c, 0x09, 0xf9, 0x8b, 0xa1,
+    0x20, 0x00, 0x88, 0x2e, 0xa4, 0x46, 0x5c, 0xf1, 0x00, 0x80, 0xb5, 0x20, 0x8f, 0x0d, 0x00, 0x00,
+    0x00, 0xb6, 0x03, 0x90, 0x3b, 0x67, 0x5c, 0x00, 0x40, 0xa0, 0x08, 0xa2, 0x59, 0x23, 0x27, 0xd8,
+    0x44, 0x95, 0x7a, 0xcc, 0xab, 0xb8, 0x56, 0x3a, 0x9e, 0xb3, 0x2c, 0x1e, 0x69, 0x00, 0x60, 0x9a,
+    0x90, 0xc0, 0xed, 0x11, 0x01, 0x00, 0x18, 0x82, 0xc8, 0x19, 0x00, 0x00, 0x00, 0xe8, 0x04, 0xe0,
+    0x75, 0x1c, 0x0d, 0x01, 0x40, 0x00, 0x23, 0x8a, 0xe7, 0xf4, 0x7c, 0x77, 0x8d, 0x53, 0xf2, 0x2f,
+    0x3b, 0xe4, 0x64, 0xbb, 0x90, 0x10, 0x48, 0x19, 0x3a, 0x02, 0x00, 0x48, 0x43, 0xe8, 0xc1, 0xb4,
+    0x12, 0x00, 0x54, 0x0f, 0xb2, 0xdc, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x03, 0x09, 0x00, 0x00,
+    0x00, 0x5f, 0x01, 0xe4, 0x96, 0xc5, 0x29, 0x00, 0x18, 0x5a, 0x84, 0xa2, 0x2c, 0x8a, 0x7f, 0x2c,
+    0x12, 0x42, 0xdb, 0x6a, 0x8c, 0xbd, 0x73, 0x1b, 0x51, 0x1a, 0xfc, 0xe6, 0x3f, 0x00, 0x20, 0x59,
+    0xc8, 0xc7, 0x58, 0xa3, 0x01, 0x80, 0x0b, 0x41, 0x9e, 0x16, 0x00, 0x00, 0x00, 0x70, 0x0a, 0xd0,
+    0x69, 0x76, 0xa1, 0x00, 0x00, 0xa8, 0x91, 0xd4, 0xf1, 0xe2, 0x3d, 0x90, 0xc5, 0xe9, 0xe8, 0xad,
+    0x85, 0xf6, 0xfb, 0x55, 0x4e, 0x28, 0x60, 0xcc, 0x62, 0x87, 0xcf, 0xe3, 0x39, 0x38, 0xe5, 0x58,
+    0x09, 0x00, 0x28, 0x08, 0x69, 0xb8, 0x00, 0x00, 0x00, 0x90, 0x15, 0x40, 0xcd, 0x04, 0x00, 0x00,
+    0x00, 0xcf, 0x00, 0x3a, 0xc1, 0x33, 0x12, 0x00, 0x08, 0x2f, 0xa2, 0xab, 0x6e, 0xd9, 0x2b, 0xf8,
+    0x10, 0x25, 0xd8, 0xf2, 0x3f, 0xde, 0xb6, 0x8c, 0x09, 0xf1, 0x8d, 0x83, 0x23, 0x00, 0x88, 0x30,
+    0xc4, 0x62, 0x8c, 0x09, 0x01, 0x80, 0xc5, 0x20, 0x7e, 0x0f, 0x00, 0x00, 0x00, 0x36, 0x04, 0xb8,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0xa3, 0x79, 0xb5, 0x02, 0x00, 0x22, 0x45, 0x58, 0xcd,
+    0x32, 0x79, 0xc6, 0x26, 0xab, 0x44, 0x66, 0x8e, 0xc8, 0x01, 0xd5, 0xf9, 0x20, 0x7f, 0x71, 0x59,
+    0x03, 0x00, 0x13, 0x85, 0x98, 0x73, 0x05, 0x14, 0x00, 0xc0, 0x12, 0x64, 0xf3, 0x00, 0x00, 0x00,
+    0x40, 0x37, 0x00, 0x70, 0xe3, 0x41, 0x08, 0x00, 0x82, 0x18, 0xe1, 0x3c, 0x6b, 0xe7, 0x73, 0x6b,
+    0xa0, 0x12, 0x78, 0x39, 0x1f, 0xc7, 0xda, 0xa5, 0x84, 0x68, 0xcc, 0xe0, 0x13, 0x00, 0x40, 0x1b,
+    0xa2, 0x12, 0x76, 0x98, 0x00, 0xa0, 0x82, 0x10, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x9a, 0x00, 0xfc,
+    0x4b, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0xc0, 0xa7, 0x7c, 0x3a, 0x01, 0xc0, 0xe0, 0x22, 0xff, 0x64,
+    0x54, 0xbc, 0x67, 0x11, 0x11, 0x72, 0x58, 0x23, 0xed, 0x00, 0xdc, 0x8c, 0x92, 0xf3, 0x57, 0x12,
+    0x02, 0x00, 0xe9, 0x42, 0x84, 0xc8, 0x0e, 0x10, 0x00, 0x5c, 0x09, 0xa2, 0xc2, 0x00, 0x00, 0x00,
+    0x80, 0x5b, 0x80, 0x56, 0x05, 0x00, 0x00, 0x00, 0x21, 0x00, 0x74, 0x9a, 0x0f, 0x28, 0x00, 0x00,
+    0x6c, 0x44, 0x67, 0xcc, 0x6e, 0x5b, 0x5d, 0x81, 0x3a, 0x74, 0xeb, 0x9f, 0x5d, 0x7f, 0x15, 0x14,
+    0xba, 0x1c, 0x07, 0xdc, 0x0b, 0xf7, 0x7c, 0x8e, 0x4c, 0x79, 0x5b, 0x02, 0x00, 0x2a, 0x42, 0xca,
+    0x32, 0x00, 0x00, 0x00, 0x64, 0x06, 0x50, 0x39, 0x01, 0x00, 0x00, 0xc0, 0x3b, 0x00, 0x2f, 0xb0,
+    0x69, 0x04, 0x00, 0x02, 0x8c, 0x40, 0xaa, 0x31, 0x76, 0xfd, 0x3d, 0x46, 0xe8, 0xba, 0x8c, 0x90,
+    0xb7, 0x2d, 0x73, 0x4a, 0xfd, 0x63, 0x90, 0x09, 0x00, 0xa2, 0x0c, 0xc9, 0x1e, 0x07, 0x47, 0x00,
+    0x60, 0x35, 0xc8, 0x5f, 0x04, 0x00, 0x00, 0x80, 0x2d, 0x01, 0x94, 0x1a, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0xb0, 0x59, 0x9e, 0xa0, 0x00, 0x80, 0x50, 0x91, 0x69, 0x73, 0x53, 0x4e, 0xb3, 0x09, 0x2b,
+    0xc1, 0x99, 0x9b, 0x72, 0x97, 0x75, 0x40, 0x08, 0x68, 0x7c, 0xdd, 0x00, 0xc0, 0x54, 0x21, 0x1e,
+    0x5e, 0x9f, 0x06, 0x00, 0x30, 0x05, 0x69, 0x46, 0x00, 0x00, 0x00, 0xd0, 0x11, 0x40, 0xcf, 0x18,
+    0x0a, 0x02, 0x80, 0x40, 0x46, 0x2c, 0xcf, 0xa1, 0x39, 0xb2, 0x1a, 0xa9, 0x54, 0x5c, 0x56, 0xc7,
+    0x99, 0x76, 0x31, 0xa1, 0x9c, 0x73, 0x6c, 0x05, 0x00, 0x10, 0x87, 0x50, 0x85, 0x9b, 0x26, 0x00,
+    0xa8, 0x22, 0xe4, 0xbc, 0x02, 0x00, 0x00, 0x80, 0x36, 0x00, 0xb3, 0x13, 0x00, 0x00, 0x00, 0xbe,
+    0x03, 0x60, 0x26, 0x8f, 0x49, 0x00, 0x30, 0xbc, 0xc8, 0x39, 0x79, 0x15, 0x97, 0x5a, 0x64, 0x84,
+    0x52, 0xd6, 0x57, 0xbb, 0x07, 0x37, 0xa4, 0x84, 0x02, 0x36, 0x8a, 0x00, 0x40, 0xc2, 0x10, 0x96,
+    0xf2, 0x89, 0x04, 0x00, 0x97, 0x82, 0x7c, 0x35, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0xe9, 0x01,
+    0x00, 0x00, 0x40, 0x18, 0x00, 0x91, 0x66, 0xe7, 0x09, 0x00, 0x80, 0x1b, 0xe1, 0x15, 0xb3, 0xd8,
+    0xa7, 0x54, 0xa4, 0x0e, 0xda, 0xfa, 0x67, 0xef, 0x5f, 0x25, 0x85, 0x30, 0xc8, 0xac, 0xb7, 0x35,
+    0x3e, 0xa0, 0x63, 0x52, 0xfe, 0x97, 0x00, 0x80, 0x92, 0x10, 0xc5, 0x0d, 0x00, 0x00, 0x00, 0xd9,
+    0x01, 0x38, 0x4f, 0x00, 0x00, 0x00, 0xf0, 0x10, 0xc0, 0x05, 0x7c, 0x13, 0x01, 0x80, 0x10, 0x23,
+    0x4b, 0xea, 0x6f, 0x7d, 0x71, 0x0f, 0x12, 0xf2, 0x2f, 0x47, 0xe4, 0x61, 0xcb, 0xa0, 0x52, 0x20,
+    0xb9, 0x8d, 0x02, 0x80, 0x48, 0x43, 0xf6, 0xc8, 0xa8, 0x12, 0x00, 0x58, 0x0e, 0xe2, 0x36, 0x01,
+    0x00, 0x00, 0x60, 0x53, 0x80, 0x44, 0x08, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x70, 0x92, 0x9d, 0x24,
+    0x00, 0x20, 0x56, 0x44, 0xdf, 0xbc, 0x96, 0x57, 0x6d, 0xd2, 0x4a, 0x67, 0x66, 0xb1, 0x5c, 0x70,
+    0x9d, 0x10, 0xa2, 0x1c, 0xe7, 0x39, 0x00, 0x30, 0x59, 0xc8, 0xc8, 0x97, 0xf0, 0x01, 0x00, 0x6c,
+    0x41, 0x6a, 0x14, 0x00, 0x00, 0x00, 0x74, 0x05, 0xc0, 0x6f, 0x00, 0x00, 0x00, 0x40, 0x04, 0x04,
+    0x88, 0xf1, 0x0b, 0x04, 0x00, 0xc1, 0x8c, 0xc8, 0x9d, 0x71, 0x72, 0xce, 0x34, 0x54, 0x49, 0xb5,
+    0x8c, 0x8d, 0x0f, 0xed, 0x72, 0x42, 0x26, 0xe8, 0x9e, 0x0b, 0x00, 0xa0, 0x0e, 0x79, 0x0b, 0xd3,
+    0x4d, 0x00, 0x50, 0x49, 0x88, 0x43, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x68, 0x28, 0x00, 0x00,
+    0x00, 0x7c, 0x08, 0x00, 0x46, 0x16, 0x89, 0x00, 0x60, 0x80, 0x91, 0x64, 0x72, 0x29, 0x8e, 0xb5,
+    0x08, 0x29, 0xd5, 0xac, 0x9d, 0x76, 0x03, 0x6e, 0x4a, 0xe8, 0x12, 0x5c, 0x21, 0x01, 0x80, 0x94,
+    0x21, 0xe0, 0x65, 0xd8, 0x09, 0x00, 0xae, 0x05, 0x99, 0x76, 0x00, 0x00, 0x00, 0xc0, 0x35, 0xc0,
+    0x98, 0x04, 0x00, 0x00, 0x80, 0x50, 0x00, 0xf8, 0xcc, 0x83, 0x13, 0x00, 0x00, 0x38, 0x92, 0x22,
+    0x16, 0xaa, 0x00, 0xa0, 0x50, 0x91, 0xac, 0x35, 0xcf, 0xde, 0xbf, 0x8a, 0x0a, 0x11, 0x92, 0x61,
+    0xf0, 0x05, 0x7d, 0x42, 0xe9, 0xa2, 0x6c, 0x32, 0x01, 0x00, 0x35, 0x21, 0x76, 0x1d, 0x00, 0x00,
+    0x00, 0x32, 0x04, 0xd8, 0x9f, 0x00, 0x00, 0x00, 0xe0, 0x25, 0x80, 0x02, 0xf8, 0x1a, 0x02, 0x00,
+    0x41, 0x46, 0xdc, 0xd3, 0x7c, 0x7a, 0xae, 0x1e, 0x25, 0x24, 0x62, 0xbe, 0xc8, 0xab, 0x96, 0x49,
+    0xa5, 0x7f, 0x32, 0x67, 0x05, 0x00, 0xd1, 0x86, 0xfc, 0x93, 0xa7, 0x26, 0x00, 0xb0, 0x1e, 0x84,
+    0xaa, 0x02, 0x00, 0x00, 0xc0, 0xb6, 0x00, 0xcf, 0x12, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x18, 0x1d,
+    0xc7, 0x41, 0x00, 0x40, 0xb0, 0x48, 0xc8, 0x99, 0x31, 0xcf, 0xdb, 0xc4, 0x95, 0x98, 0xcc, 0x5c,
+    0x39, 0xe5, 0x3a, 0xa2, 0xd4, 0x3f, 0x5e, 0x7a, 0x00, 0x60, 0xba, 0x10, 0x02, 0x70, 0x4f, 0x04,
+    0x00, 0x18, 0x83, 0x94, 0x2f, 0x00, 0x00, 0x00, 0xe8, 0x0c, 0x20, 0x8a, 0x01, 0x00, 0x00, 0x80,
+    0x18, 0x00, 0xe6, 0x62, 0x10, 0x08, 0x00, 0x02, 0x1a, 0x99, 0x39, 0x73, 0xe2, 0xaa, 0x67, 0xac,
+    0xce, 0x63, 0x99, 0x19, 0xd7, 0xd9, 0x05, 0x85, 0xea, 0xd1, 0x8a, 0xf8, 0xd8, 0x40, 0x9e, 0x13,
+    0x18, 0x7e, 0x9c, 0x00, 0xa0, 0x9a, 0x90, 0xe7, 0x0d, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x14, 0x52,
+    0x00, 0x00, 0x00, 0xf8, 0x12, 0x00, 0x80, 0xac, 0xfe, 0x00, 0xc0, 0x10, 0x23, 0xa8, 0x64, 0x4b,
+    0x1c, 0x68, 0x91, 0x52, 0xc2, 0x59, 0xdb, 0xec, 0xcd, 0xdb, 0x98, 0xd0, 0x43, 0x18, 0x5e, 0x02,
+    0x00, 0x49, 0x43, 0xda, 0xcc, 0xd6, 0x14, 0x00, 0x5c, 0x0c, 0x02, 0x08, 0x01, 0x00, 0x00, 0x80,
+    0x73, 0x80, 0x51, 0x0a, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x24, 0x99, 0x17, 0x26, 0x00, 0x00, 0x72,
+    0xa4, 0x31, 0xdc, 0x43, 0x01, 0x40, 0xb1, 0x22, 0x47, 0x6b, 0x9b, 0xbd, 0x7f, 0x95, 0x55, 0xf2,
+    0x26, 0x4f, 0xe2, 0xd1, 0xfa, 0x88, 0x92, 0x43, 0xd9, 0x6a, 0x02, 0x00, 0x8a, 0x42, 0x64, 0xbe,
+    0x97, 0x08, 0x00, 0x64, 0x09, 0x52, 0x42, 0x01, 0x00, 0x00, 0xc0, 0x53, 0x00, 0xfc, 0x2f, 0x26,
+    0x04, 0x00, 0xc2, 0x8c, 0xc0, 0xa5, 0xc7, 0xf3, 0xa8, 0x3c, 0x4c, 0x27, 0xc9, 0xdc, 0x91, 0x27,
+    0x2d, 0xa3, 0x4a, 0x6e, 0xe5, 0x53, 0x0b, 0x00, 0x22, 0x0e, 0x71, 0x2b, 0x3b, 0x4f, 0x00, 0x60,
+    0x41, 0x48, 0xc9, 0x05, 0x00, 0x00, 0x80, 0x8d, 0x01, 0xfe, 0x28, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0x00, 0x2b, 0xb6, 0x73, 0x00, 0x80, 0x68, 0x11, 0xa4, 0xb3, 0x6a, 0x7e, 0xb9, 0xc9, 0x2b, 0x95,
+    0x98, 0x7d, 0x72, 0xbb, 0x75, 0x46, 0x69, 0x8f, 0xac, 0x04, 0x01, 0xc0, 0x84, 0x21, 0xbb, 0x60,
+    0x4b, 0x09, 0x00, 0xb0, 0x06, 0x11, 0x6e, 0x00, 0x00, 0x00, 0xd0, 0x1d, 0x00, 0xf3, 0x03, 0x00,
+    0x00, 0x00, 0x51, 0x00, 0x66, 0xc5, 0x02, 0x10, 0x00, 0x04, 0x35, 0x02, 0x6d, 0x0e, 0xbe, 0xe7,
+    0xc7, 0x60, 0x9d, 0xb8, 0x72, 0x2f, 0x4e, 0xb3, 0x4b, 0x0a, 0x99, 0xa6, 0x2b, 0x73, 0xde, 0x83,
+    0x3e, 0x07, 0x32, 0x4c, 0x3a, 0x01, 0x40, 0x45, 0x21, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x34, 0x03,
+    0xd8, 0xa5, 0x00, 0x00, 0x00, 0xf0, 0x29, 0x80, 0xec, 0x58, 0xd9, 0x01, 0x80, 0x41, 0x46, 0xf6,
+    0xc8, 0x72, 0x38, 0xc1, 0x22, 0xa6, 0x24, 0xb3, 0xae, 0xd8, 0x0b, 0xb7, 0x39, 0x21, 0xcb, 0xf0,
+    0xf5, 0x04, 0x00, 0xd2, 0x86, 0x4c, 0x9b, 0x57, 0x2b, 0x00, 0xb8, 0x1a, 0x04, 0x49, 0x02, 0x00,
+    0x00, 0x00, 0xf7, 0x00, 0x5f, 0x16, 0x00, 0x00, 0x00, 0x42, 0x02, 0x20, 0x30, 0xb3, 0x49, 0x00,
+    0x00, 0xe8, 0x48, 0x39, 0x58, 0x63, 0x02, 0x80, 0x82, 0x45, 0x58, 0xd6, 0x30, 0xbb, 0xfe, 0x2a,
+    0xac, 0x04, 0x52, 0x96, 0xc6, 0x8d, 0xf6, 0x19, 0x25, 0x84, 0x32, 0xe6, 0x04, 0x00, 0x54, 0x85,
+    0xe0, 0x82, 0x4b, 0x19, 0x00, 0xc8, 0x14, 0x24, 0x8c, 0x02, 0x00, 0x00, 0x80, 0xb7, 0x00, 0xec,
+    0x5f, 0x34, 0x08, 0x00, 0x04, 0x1a, 0x89, 0x46, 0x53, 0xe4, 0xfc, 0x76, 0x9c, 0x4e, 0x9b, 0x79,
+    0x24, 0x07, 0x5a, 0x66, 0x95, 0x9c, 0xcb, 0x8b, 0xb7, 0x54, 0x45, 0x9d, 0x53, 0x5c, 0x46, 0xa1,
+    0x00, 0xc0, 0x8a, 0x10, 0x6f, 0x0c, 0x00, 0x00, 0x00, 0x5b, 0x03, 0xdc, 0x56, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x80, 0x39, 0x6c, 0xc6, 0x00, 0x00, 0xe1, 0x22, 0x6c, 0x67, 0xe1, 0x3c, 0x75, 0x13,
+    0x18, 0xc2, 0x2f, 0x47, 0xe4, 0x34, 0xeb, 0x90, 0x52, 0x44, 0x99, 0x2f, 0x02, 0x80, 0x29, 0x43,
+    0xae, 0xc2, 0xa1, 0x13, 0x00, 0x60, 0x0e, 0x52, 0xfd, 0x00, 0x00, 0x00, 0xa0, 0x43, 0x00, 0x33,
+    0x09, 0x00, 0x00, 0x00, 0xe2, 0x00, 0xe8, 0x89, 0xb7, 0x1f, 0x00, 0x08, 0x6c, 0xe4, 0xc9, 0x7c,
+    0x6a, 0x01, 0x80, 0xd1, 0x22, 0x56, 0xe5, 0x58, 0x3c, 0x66, 0x17, 0x15, 0x82, 0x51, 0x87, 0xe9,
+    0xf6, 0x09, 0x81, 0x50, 0x66, 0x18, 0x76, 0x02, 0x80, 0xaa, 0x42, 0x92, 0x40, 0x00, 0x00, 0x00,
+    0x68, 0x87, 0x91, 0x4d, 0x01, 0x00, 0x00, 0xe0, 0x5b, 0x00, 0xbb, 0x31, 0x72, 0x03, 0x00, 0xc3,
+    0x8c, 0x08, 0x91, 0x73, 0x70, 0x49, 0x45, 0x4e, 0xc9, 0x64, 0xed, 0xae, 0xc7, 0x6c, 0x83, 0x42,
+    0x20, 0xe2, 0x5d, 0x0a, 0x00, 0x24, 0x0e, 0xd9, 0x38, 0x1f, 0x59, 0x00, 0x70, 0x39, 0xc8, 0x0d,
+    0x05, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x58, 0x2f, 0x00, 0x00, 0x00, 0x84, 0x05, 0xb0, 0x59, 0x16,
+    0x8c, 0x00, 0x00, 0xd8, 0x11, 0x20, 0xb0, 0x78, 0x04, 0x00, 0x45, 0x8b, 0x38, 0xac, 0x49, 0xf6,
+    0xf5, 0x55, 0x5a, 0xc9, 0xaa, 0x3c, 0x8f, 0xdb, 0xed, 0x43, 0x4a, 0x0b, 0x65, 0xf6, 0x09, 0x00,
+    0x28, 0x0b, 0xb9, 0x10, 0xe3, 0x3d, 0x00, 0x90, 0x2d, 0x08, 0x2b, 0x05, 0x00, 0x00, 0x00, 0x8f,
+    0x01, 0xcc, 0xbf, 0x4a, 0x10, 0x00, 0x08, 0x35, 0xe2, 0x80, 0x1e, 0xc0, 0xd7, 0xe2, 0x40, 0x9d,
+    0x48, 0xf3, 0x4b, 0xae, 0xb3, 0x0c, 0x2b, 0x65, 0x98, 0x85, 0xf0, 0x06, 0x8c, 0x3c, 0xa7, 0xc1,
+    0xac, 0x46, 0x01, 0x80, 0x25, 0x21, 0x76, 0x1a, 0x00, 0x00, 0x00, 0x36, 0x07, 0xf0, 0xb4, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x00, 0x40, 0x58, 0x49, 0x01, 0x00, 0xe2, 0x45, 0x0e, 0xcf, 0xce, 0x39,
+    0xe8, 0x26, 0x31, 0x54, 0x5c, 0xc6, 0xc6, 0xbb, 0xd5, 0x29, 0xa5, 0xdc, 0x72, 0xaf, 0x04, 0x00,
+    0x93, 0x86, 0x48, 0x87, 0xdb, 0x28, 0x00, 0xc0, 0x1e, 0x64, 0x40, 0x02, 0x00, 0x00, 0x40, 0x97,
+    0x00, 0x7c, 0x14, 0x00, 0x00, 0x00, 0x44, 0x02, 0x90, 0x11, 0x67, 0x3e, 0x00, 0x10, 0xdc, 0xc8,
+    0x6c, 0x79, 0xa9, 0x02, 0x00, 0xc3, 0x45, 0x70, 0xca, 0xa5, 0x38, 0xca, 0x2e, 0x2b, 0x94, 0xa9,
+    0x76, 0xd7, 0x81, 0x16, 0x0a, 0x21, 0xd4, 0x70, 0xf1, 0x04, 0x00, 0x95, 0x85, 0x38, 0x88, 0xf3,
+    0x13, 0x00, 0xd0, 0x10, 0x24, 0x9e, 0x02, 0x00, 0x00, 0xc0, 0xc7, 0x00, 0x4f, 0xe3, 0x79, 0x06,
+    0x00, 0x06, 0x1a, 0xb9, 0x1f, 0x8b, 0xdf, 0xd5, 0x89, 0xa0, 0x92, 0xc6, 0xba, 0x59, 0x37, 0xd7,
+    0x26, 0x85, 0x5a, 0xc5, 0x99, 0x15, 0x00, 0x48, 0x1d, 0x82, 0x74, 0xb6, 0xb5, 0x00, 0xe0, 0x7a,
+    0x90, 0x14, 0x0b, 0x00, 0x00, 0x00, 0x5c, 0x04, 0xa0, 0x62, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x80,
+    0xa2, 0xac, 0x04, 0x01, 0x00, 0xc0, 0x23, 0x98, 0x5f, 0x49, 0x08, 0x00, 0x0a, 0x17, 0x39, 0x57,
+    0x3f, 0xec, 0xcd, 0xab, 0xb8, 0x92, 0x5e, 0x99, 0x1f, 0x87, 0xdb, 0xa7, 0x84, 0x34, 0xca, 0x5b,
+    0x14, 0x00, 0x50, 0x17, 0x62, 0x34, 0x8e, 0x8c, 0x00, 0x20, 0x63, 0x90, 0x8a, 0x0a, 0x00, 0x00,
+    0x00, 0x5e, 0x03, 0x48, 0x21, 0x00, 0x00, 0x00, 0x18, 0x01, 0x61, 0xfc, 0xcb, 0x02, 0x01, 0x80,
+    0x60, 0x23, 0x2a, 0x67, 0x58, 0x0b, 0x00, 0x8e, 0x14, 0xa9, 0x35, 0xef, 0xe4, 0x37, 0xcb, 0xb4,
+    0xd2, 0x93, 0xf9, 0x19, 0xd7, 0xcd, 0xe8, 0x93, 0x92, 0xcc, 0x97, 0x14, 0x00, 0x58, 0x13, 0xd2,
+    0xbe, 0xed, 0x32, 0x00, 0x60, 0x7b, 0x10, 0xa6, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x48, 0x81,
+    0x69, 0x10, 0x00, 0x20, 0x60, 0x24, 0xf3, 0x8c, 0x9c, 0xc3, 0x6d, 0x22, 0x43, 0x8f, 0xe5, 0x4f,
+    0x5c, 0x4f, 0x1d, 0x53, 0x82, 0x33, 0x5b, 0x50, 0x00, 0x30, 0x6d, 0x48, 0x8d, 0x98, 0xa1, 0x02,
+    0x00, 0x0c, 0x42, 0x9e, 0x28, 0x00, 0x00, 0x00, 0x74, 0x0a, 0x30, 0x62, 0x01, 0x00, 0x00, 0x40,
+    0x2c, 0x80, 0xed, 0xb0, 0xcd, 0x03, 0x00, 0x01, 0x8e, 0xd8, 0x93, 0x43, 0x27, 0x00, 0x30, 0x5e,
+    0x44, 0xa3, 0x9c, 0x89, 0x7f, 0xec, 0xc2, 0x42, 0xdb, 0xea, 0x9f, 0x9d, 0x7e, 0x21, 0x11, 0xd2,
+    0x0d, 0x83, 0x4f, 0x00, 0x50, 0x5d, 0x48, 0xe4, 0x18, 0xd1, 0x01, 0x00, 0x2d, 0x41, 0x18, 0x2a,
+    0x00, 0x00, 0x00, 0x7c, 0x0d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x80, 0x04, 0x04, 0x97, 0xf1, 0x0c,
+    0x03, 0x00, 0x43, 0x8d, 0x74, 0x8e, 0xdb, 0xee, 0x5d, 0x44, 0x52, 0x67, 0x61, 0xfd, 0xaa, 0x87,
+    0x6a, 0xa3, 0x42, 0x37, 0x63, 0x34, 0x3b, 0xa0, 0x24, 0xcf, 0x01, 0x3b, 0x13, 0x5c, 0x00, 0x70,
+    0x41, 0xc8, 0x09, 0x06, 0x00, 0x00, 0x00, 0x4e, 0x02, 0xb8, 0x32, 0x00, 0x00, 0x00, 0x84, 0x07,
+    0x70, 0x45, 0x2e, 0x74, 0x00, 0x00, 0xe8, 0x11, 0x7e, 0xaf, 0xd0, 0x03, 0x00, 0xc5, 0x8b, 0xd0,
+    0xaa, 0xe3, 0x75, 0xca, 0x55, 0x5e, 0xa9, 0xb2, 0x3c, 0x8f, 0x03, 0xed, 0x63, 0x42, 0x35, 0xe5,
+    0x6f, 0x0a, 0x00, 0x28, 0x0c, 0x71, 0x22, 0xef, 0x4c, 0x00, 0x90, 0x35, 0x48, 0x69, 0x05, 0x00,
+    0x00, 0x00, 0xcf, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8c, 0x01, 0xd0, 0xfd, 0x75, 0x80, 0x00,
+    0x40, 0xb8, 0x91, 0x12, 0xb3, 0x44, 0x05, 0x00, 0x87, 0x8a, 0x64, 0x9b, 0x8f, 0xf2, 0x9b, 0x65,
+    0x5c, 0x49, 0xcd, 0xfc, 0x92, 0x23, 0x6b, 0x04, 0x4a, 0x7c, 0x66, 0x5c, 0x0a, 0x00, 0x2c, 0x0a,
+    0x19, 0xea, 0x2a, 0x2c, 0x00, 0xb0, 0x41, 0xc8, 0xf1, 0x05, 0x00, 0x00, 0x00, 0x10, 0x01, 0x78,
+    0xbf, 0x12, 0x06, 0x00, 0x10, 0x31, 0xc2, 0x79, 0x56, 0xcd, 0x03, 0x36, 0x99, 0xa1, 0xaf, 0x72,
+    0x1a, 0x7e, 0xa1, 0xce, 0x29, 0xa9, 0x9c, 0xcd, 0x2a, 0x00, 0x98, 0x38, 0xc4, 0x50, 0x7c, 0x58,
+    0x01, 0x00, 0x16, 0x21, 0x9b, 0x16, 0x00, 0x00, 0x00, 0xba, 0x05, 0xc8, 0xbb, 0x00, 0x00, 0x00,
+    0x20, 0x1a, 0xc0, 0x58, 0x98, 0xd2, 0x01, 0x80, 0x20, 0x47, 0x54, 0xc8, 0xaf, 0x11, 0x00, 0x18,
+    0x30, 0x92, 0x4f, 0x56, 0xc4, 0x1b, 0x76, 0x69, 0x21, 0x7e, 0x75, 0xd7, 0xde, 0xc2, 0xd0, 0x08,
+    0x55, 0x87, 0x21, 0x28, 0x00, 0xa8, 0x30, 0xe4, 0x99, 0xec, 0x18, 0x01, 0x80, 0xa6, 0x20, 0x33,
+    0x15, 0x00, 0x00, 0x00, 0x3e, 0x07, 0xb8, 0x65, 0x00, 0x00, 0x00, 0x40, 0x06, 0xc0, 0xc7, 0xd8,
+    0x74, 0x01, 0x80, 0xc1, 0x46, 0x56, 0xc6, 0xd1, 0xb6, 0xc0, 0x21, 0xaa, 0xc3, 0xaf, 0xa6, 0xd4,
+    0xd7, 0xb4, 0x59, 0x21, 0xdc, 0xb1, 0xc8, 0x1d, 0x77, 0xd2, 0xe7, 0xa4, 0x9d, 0x63, 0x2e, 0x00,
+    0xb8, 0x22, 0x64, 0x42, 0x03, 0x00, 0x00, 0x00, 0x37, 0x01, 0xe0, 0x19, 0x00, 0x00, 0x00, 0x42,
+    0x04, 0x68, 0x1b, 0x3f, 0x30, 0x00, 0x00, 0xf8, 0x48, 0x9a, 0x37, 0xbd, 0x01, 0x80, 0x02, 0x46,
+    0xea, 0xd4, 0xbe, 0x3a, 0xcd, 0x2a, 0xb0, 0x74, 0x5a, 0xde, 0xc6, 0xe5, 0xf5, 0x39, 0xa1, 0xac,
+    0xb2, 0x5c, 0x05, 0x00, 0x54, 0x86, 0xc8, 0x94, 0x17, 0x29, 0x00, 0xc8, 0x1c, 0x84, 0xcb, 0x02,
+    0x00, 0x00, 0x80, 0xf7, 0x00, 0x32, 0x13, 0x00, 0x00, 0x00, 0x46, 0x01, 0x70, 0xfe, 0x7a, 0x3f,
+    0x00, 0x20, 0xe0, 0xc8, 0x3f, 0x79, 0x64, 0x02, 0x80, 0x63, 0x45, 0xf4, 0xcd, 0x56, 0x39, 0xcd,
+    0x32, 0xaf, 0xd4, 0x66, 0x16, 0xcb, 0xc3, 0x36, 0x0a, 0xa5, 0x54, 0x33, 0x37, 0x05, 0x00, 0x56,
+    0x85, 0xc8, 0x79, 0x1b, 0x1c, 0x00, 0xd8, 0x22, 0xc4, 0x03, 0x03, 0x00, 0x00, 0x00, 0x98, 0x00,
+    0x47, 0x5f, 0xef, 0x01, 0x00, 0x08, 0x19, 0x51, 0x3c, 0xa3, 0xe5, 0x3b, 0x9a, 0xd0, 0xd0, 0x4b,
+    0xd9, 0x06, 0xef, 0x4d, 0x07, 0x95, 0xd4, 0xcf, 0xb3, 0x16, 0x00, 0x4c, 0x1d, 0x52, 0x2c, 0x0e,
+    0xaf, 0x0f, 0x07, 0x93, 0x9c, 0x6d, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x40, 0x62, 0x00, 0x00,
+    0x00, 0x10, 0x0f, 0x20, 0x1b, 0xcc, 0xdb, 0x00, 0x40, 0xa0, 0x23, 0x49, 0x63, 0xb3, 0x07, 0x00,
+    0x8c, 0x18, 0xc1, 0x26, 0xe3, 0xe1, 0xf8, 0xba, 0xb8, 0xd0, 0xbf, 0x7a, 0x69, 0xef, 0x5f, 0x88,
+    0x94, 0xec, 0xc3, 0x49, 0x14, 0x00, 0x54, 0x19, 0x12, 0x5d, 0x16, 0x9e, 0x00, 0x40, 0x5b, 0x90,
+    0xbd, 0x0a, 0x00, 0x00, 0x00, 0xdf, 0x03, 0xdc, 0x44, 0x00, 0x00, 0x00, 0x20, 0x05, 0xa0, 0x61,
+    0xfc, 0xb1, 0x00, 0xc0, 0x70, 0x23, 0xa4, 0xe2, 0x05, 0xdb, 0x81, 0x90, 0xd5, 0x69, 0x57, 0xff,
+    0xe9, 0x3b, 0xda, 0xb0, 0x50, 0x0b, 0x39, 0xf8, 0x7e, 0x48, 0x09, 0x74, 0xc6, 0xce, 0x4f, 0x17,
+    0x00, 0x5c, 0x12, 0x92, 0xbf, 0x01, 0x00, 0x00, 0x80, 0xa3, 0x80, 0x1b, 0x0d, 0x00, 0x00, 0x00,
+    0x61, 0x02, 0x10, 0x89, 0x21, 0x10, 0x00, 0x00, 0x7e, 0x04, 0xbd, 0xcb, 0xc9, 0x00, 0x40, 0x11,
+    0x23, 0x24, 0xea, 0x39, 0xbd, 0x52, 0x95, 0x58, 0xb2, 0x2d, 0xeb, 0xe2, 0x8c, 0xfa, 0xa0, 0x50,
+    0x62, 0xf9, 0xc2, 0x02, 0x00, 0x4a, 0x43, 0xea, 0xcb, 0x96, 0x15, 0x00, 0x64, 0x0f, 0x42, 0x73,
+    0x01, 0x00, 0x00, 0xc0, 0x83, 0x80, 0x26, 0x0b, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xd8, 0x7e, 0x33,
+    0x1f, 0x00, 0x10, 0x72, 0x84, 0x78, 0xac, 0x0d, 0x01, 0xc0, 0xc1, 0x22, 0x1b, 0x67, 0xb1, 0x3c,
+    0x66, 0x19, 0x58, 0xc2, 0x32, 0xbb, 0xe5, 0xa0, 0x1b, 0x89, 0x92, 0xb5, 0x19, 0xa0, 0x02, 0x00,
+    0xcb, 0x42, 0xfa, 0xbe, 0x50, 0x10, 0x00, 0x6c, 0x12, 0xf2, 0x86, 0x01, 0x00, 0x00, 0x00, 0x54,
+    0x00, 0x86, 0x04, 0x00, 0x00, 0x00, 0x25, 0x00, 0xa8, 0x7b, 0xb7, 0x01, 0x00, 0x20, 0x66, 0x04,
+    0xec, 0xcc, 0x8f, 0xdf, 0x63, 0x52, 0x3b, 0x05, 0xe5, 0x04, 0xfc, 0x2d, 0x9d, 0x54, 0xf2, 0x44,
+    0x8b, 0x5f, 0x00, 0x30, 0x79, 0x08, 0xbe, 0xd8, 0xc4, 0xee, 0x26, 0x6c, 0x72, 0x2a, 0x36, 0x00,
+    0x00, 0x00, 0x74, 0x0d, 0xb0, 0x96, 0x01, 0x00, 0x00, 0x40, 0x44, 0x80, 0x15, 0x30, 0x21, 0x03,
+    0x00, 0xc1, 0x8e, 0xa0, 0x89, 0x69, 0x19, 0x00, 0x30, 0x64, 0x24, 0x96, 0x0c, 0x86, 0x3b, 0xeb,
+    0xf2, 0x42, 0xed, 0x6a, 0x89, 0x3d, 0x6f, 0xa1, 0x52, 0x32, 0x11, 0x5f, 0x52, 0x00, 0x50, 0x69,
+    0xc8, 0xa8, 0xf9, 0xad, 0x02, 0x00, 0x8d, 0x41, 0xc2, 0x2b, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x50,
+    0x48, 0x01, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x7f, 0x31, 0xa9, 0x02, 0x00, 0x03, 0x8e, 0x14, 0x88,
+    0x25, 0x2a, 0x00, 0x40, 0x58, 0x64, 0x5b, 0xdd, 0xa6, 0x6b, 0x68, 0xd3, 0x42, 0x90, 0x64, 0x21,
+    0xfc, 0x45, 0xa5, 0x10, 0xa2, 0x3a, 0x87, 0x5d, 0x00, 0x70, 0x4d, 0x88, 0x6f, 0x07, 0x00, 0x00,
+    0x00, 0xae, 0x32, 0xe0, 0x34, 0x00, 0x00, 0x00, 0x84, 0x0a, 0x30, 0x0d, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x8e, 0xbc, 0xee, 0xd6, 0x02, 0x00, 0x85, 0x8c, 0xf8, 0xa6, 0x0f, 0x74, 0xce, 0x54, 0x64,
+    0xa9, 0xb8, 0x6c, 0x89, 0x6b, 0xe8, 0x93, 0x42, 0xbc, 0x65, 0x5e, 0x0b, 0x00, 0xa8, 0x0d, 0xd1,
+    0x34, 0xa3, 0x59, 0x00, 0x90, 0x41, 0xc8, 0x09, 0x06, 0x00, 0x00, 0x00, 0x2f, 0x02, 0x74, 0x31,
+    0x00, 0x00, 0x00, 0x8c, 0x04, 0x90, 0xf8, 0x85, 0x79, 0x00, 0x40, 0xd0, 0x11, 0x3d, 0xb1, 0x88,
+    0x03, 0x00, 0x47, 0x8b, 0xe4, 0x9c, 0xd7, 0x72, 0x94, 0x65, 0x62, 0xc9, 0xc5, 0x6c, 0x95, 0x3b,
+    0x6e, 0x34, 0x42, 0x06, 0x67, 0x9b, 0x0a, 0x00, 0xac, 0x0b, 0x21, 0x03, 0x57, 0x48, 0x00, 0xb0,
+    0x4d, 0x88, 0x31, 0x06, 0x00, 0x00, 0x00, 0x70, 0x01, 0xb4, 0x1b, 0x00, 0x00, 0x00, 0x94, 0x01,
+    0x80, 0xea, 0x01, 0x00, 0x00, 0x80, 0xa0, 0x8d, 0x8a, 0xf3, 0x15, 0x6e, 0x6c, 0x89, 0xed, 0x84,
+    0x93, 0xd1, 0x6f, 0x9b, 0x74, 0x54, 0xc9, 0x28, 0x3d, 0x8f, 0xff, 0xd5, 0xf4, 0x39, 0x1c, 0xe3,
+    0x29, 0x1b, 0xb4, 0x30, 0xca, 0x59, 0xe9, 0x00, 0x00, 0x00, 0xd0, 0x39, 0xc0, 0x84, 0x06, 0x00,
+    0x00, 0x00, 0x31, 0x01, 0xbe, 0xbe, 0xdd, 0x0a, 0x00, 0x04, 0x3c, 0xe2, 0x17, 0x46, 0x4a, 0x00,
+    0xc0, 0x98, 0x11, 0x42, 0xf2, 0x0f, 0x2e, 0xa9, 0x0b, 0x0c, 0x0d, 0xab, 0x71, 0xf5, 0x53, 0x85,
+    0x4c, 0x49, 0x4c, 0xac, 0x4f, 0x01, 0x40, 0xb5, 0x21, 0x45, 0xe7, 0x56, 0x0b, 0x00, 0xb4, 0x06,
+    0xb9, 0xb3, 0x00, 0x00, 0x00, 0xf0, 0x45, 0x40, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x92, 0x00, 0xc0,
+    0xc5, 0xfc, 0x09, 0x00, 0x0c, 0x39, 0x12, 0x15, 0x66, 0x9f, 0x00, 0x00, 0x69, 0x11, 0x63, 0x35,
+    0x96, 0x6e, 0x9f, 0x8d, 0x0b, 0x91, 0x93, 0x4b, 0x71, 0x79, 0x95, 0x44, 0xe8, 0xe7, 0xac, 0x76,
+    0x6b, 0xc4, 0x45, 0x39, 0x6e, 0xdf, 0xae, 0x04, 0x00, 0x38, 0x0b, 0xa1, 0xd4, 0x00, 0x00, 0x00,
+    0x10, 0x2e, 0x80, 0xc3, 0x07, 0x00, 0x00, 0x00, 0x20, 0x08, 0x44, 0xba, 0x3b, 0x0a, 0x00, 0x14,
+    0x33, 0x02, 0x94, 0xa6, 0xcb, 0x27, 0x50, 0x99, 0x1d, 0xea, 0xb2, 0x1c, 0x8e, 0x9a, 0x8f, 0x0a,
+    0xc9, 0x97, 0xc3, 0xee, 0x32, 0xa2, 0x38, 0x87, 0xe4, 0xac, 0x70, 0x01, 0x40, 0x16, 0x21, 0x35,
+    0x19, 0x00, 0x00, 0x00, 0x3c, 0x09, 0xe8, 0xd4, 0x00, 0x00, 0x00, 0x30, 0x16, 0x40, 0xd3, 0x57,
+    0xd3, 0x01, 0x00, 0x61, 0x47, 0x42, 0xc2, 0xbf, 0x0a, 0x00, 0x1c, 0x2e, 0x12, 0x75, 0xa6, 0xcb,
+    0x27, 0x96, 0x91, 0xa5, 0xfa, 0x32, 0x48, 0x4e, 0xb3, 0x11, 0x09, 0xf1, 0x9c, 0xf1, 0x2a, 0x00,
+    0xb0, 0x30, 0xa4, 0x25, 0x0c, 0x38, 0x01, 0xc0, 0x46, 0x21, 0x23, 0x19, 0x00, 0x00, 0x00, 0x40,
+    0x06, 0x30, 0x8a, 0x00, 0x00, 0x00, 0x50, 0x0a, 0x40, 0x9d, 0x07, 0x00, 0x00, 0x00, 0xa2, 0x36,
+    0x58, 0xcd, 0x79, 0x77, 0x71, 0x24, 0xb7, 0x33, 0x4c, 0x6e, 0xbe, 0x19, 0xd2, 0x59, 0x9d, 0xec,
+    0xf4, 0x75, 0x5e, 0x88, 0x13, 0xe8, 0xe8, 0x8c, 0xef, 0x6c, 0x0f, 0xc3, 0x2a, 0x07, 0xe4, 0x03,
+    0x00, 0x00, 0x40, 0xf7, 0x00, 0x97, 0x1a, 0x00, 0x00, 0x00, 0x44, 0x05, 0x00, 0xf3, 0x3e, 0x21,
+    0x00, 0x10, 0xf4, 0xc8, 0x28, 0x58, 0x86, 0x00, 0x00, 0x83, 0x46, 0x9c, 0xc8, 0x0f, 0xb8, 0x8c,
+    0x2e, 0x31, 0xd4, 0xa8, 0x66, 0xd2, 0x21, 0x13, 0x3a, 0xa5, 0x53, 0x31, 0x5b, 0x05, 0x00, 0x15,
+    0x87, 0xf4, 0x9e, 0x3b, 0x2f, 0x00, 0xd0, 0x1c, 0x44, 0xe7, 0x02, 0x00, 0x00, 0xc0, 0x27, 0x01,
+    0xff, 0x18, 0x00, 0x00, 0x00, 0xc8, 0x02, 0xb0, 0x15, 0xc3, 0x24, 0x00, 0x30, 0xe8, 0x08, 0x22,
+    0xb8, 0x51, 0x02, 0x00, 0xc4, 0x45, 0x50, 0xd5, 0x46, 0xfa, 0x73, 0x36, 0x2f, 0x34, 0x52, 0x0e,
+    0xc7, 0xbd, 0x56, 0x1a, 0x21, 0x92, 0x33, 0xdc, 0x2d, 0x22, 0x57, 0xe5, 0xe8, 0x83, 0xad, 0x1a,
+    0x00, 0xe0, 0x2e, 0xc4, 0x54, 0x03, 0x00, 0x00, 0x40, 0xc8, 0x00, 0xe6, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x00, 0xe7, 0xf2, 0x24, 0x00, 0x50, 0xd0, 0x08, 0x29, 0xda, 0x15, 0xe7, 0x2b, 0x85,
+    0x76, 0xcc, 0xcb, 0x57, 0x38, 0x4f, 0x3e, 0xab, 0x23, 0x62, 0xd6, 0xbf, 0x05, 0x8e, 0xea, 0x1c,
+    0xce, 0xf3, 0xe2, 0x05, 0x00, 0x99, 0x84, 0x30, 0x69, 0x00, 0x00, 0x00, 0xf0, 0x26, 0xa0, 0x83,
+    0x03, 0x00, 0x00, 0xc0, 0x68, 0x00, 0xf3, 0xde, 0xdf, 0x06, 0x00, 0x04, 0x1e, 0x41, 0xfe, 0xde,
+    0x17, 0x00, 0x70, 0xbc, 0x88, 0xd9, 0x99, 0x2e, 0x7f, 0x57, 0x66, 0x96, 0x54, 0xcb, 0xcf, 0x38,
+    0xa9, 0x46, 0x25, 0xe4, 0x77, 0xde, 0xae, 0x00, 0xc0, 0xca, 0x10, 0xe9, 0x70, 0x27, 0x05, 0x00,
+    0x5b, 0x85, 0x78, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x40, 0x81, 0x02, 0x00, 0x00, 0x40, 0x39,
+    0x00, 0x4b, 0x1e, 0x00, 0x00, 0x00, 0x08, 0xdb, 0xe0, 0x30, 0x2b, 0x59, 0x00, 0x90, 0xe0, 0x08,
+    0x2a, 0x19, 0xf7, 0x8e, 0x47, 0x87, 0x75, 0xa2, 0xd4, 0x8b, 0xfa, 0x97, 0x4e, 0xa1, 0x24, 0x35,
+    0x66, 0xb4, 0xd3, 0x0c, 0xb3, 0x1c, 0x74, 0xb0, 0xf1, 0x00, 0x00, 0x1d, 0x84, 0xe8, 0x6b, 0x00,
+    0x00, 0x00, 0x10, 0x17, 0xa0, 0xa7, 0xab, 0x3b, 0x00, 0x40, 0xe0, 0x23, 0xd4, 0x1f, 0x00, 0x00,
+    0x00, 0x8c, 0xda, 0x78, 0x20, 0x43, 0xdf, 0xa5, 0xb9, 0xc8, 0x50, 0x94, 0x9a, 0x3a, 0xd7, 0x41,
+    0x08, 0x75, 0xf0, 0xc5, 0xed, 0x75, 0xb6, 0x54, 0x9d, 0x43, 0x81, 0x5e, 0xc2, 0xc7, 0x49, 0x7b,
+    0x1c, 0x15, 0x0c, 0x00, 0x00, 0x00, 0xdf, 0x04, 0x2c, 0x6a, 0x00, 0x00, 0x00, 0x20, 0x0d, 0xc0,
+    0x4d, 0xcc, 0x7e, 0x00, 0xc0, 0xb0, 0x23, 0xad, 0xdf, 0x7a, 0x08, 0x00, 0x90, 0x17, 0x39, 0x54,
+    0xaf, 0xe8, 0x99, 0xd9, 0xc0, 0x10, 0x54, 0x99, 0x1f, 0xff, 0x5b, 0x89, 0x94, 0x12, 0xce, 0x7c,
+    0x37, 0xc0, 0x5c, 0x96, 0x53, 0x26, 0xc6, 0x81, 0x00, 0x80, 0xc3, 0x90, 0x5a, 0x0d, 0x00, 0x00,
+    0x00, 0x61, 0x03, 0x18, 0x69, 0x00, 0x00, 0x00, 0x00, 0x86, 0x60, 0x96, 0x7b, 0x86, 0x00, 0x40,
+    0x51, 0x23, 0xe4, 0x67, 0xd6, 0x0b, 0x00, 0x94, 0x1a, 0xd9, 0x2f, 0x0b, 0xe1, 0xe2, 0xf8, 0xb0,
+    0xce, 0x93, 0x39, 0x10, 0x57, 0x46, 0xca, 0x73, 0xf8, 0xcf, 0xe8, 0xf7, 0xbd, 0x64, 0x93, 0xf3,
+    0xb6, 0x5d, 0x11, 0x00, 0xc0, 0xa3, 0x10, 0xa3, 0x0e, 0x00, 0x00, 0x00, 0xe3, 0x01, 0xec, 0x79,
+    0x15, 0x19, 0x00, 0x10, 0x7a, 0xa4, 0xce, 0x03, 0x00, 0x00, 0xc0, 0x01, 0x03, 0x75, 0xe7, 0xb5,
+    0xdc, 0x56, 0x19, 0x5a, 0xb2, 0x2a, 0xa7, 0xe1, 0xdb, 0x19, 0x99, 0x50, 0xf2, 0x19, 0xca, 0x02,
+    0x00, 0x4b, 0x43, 0xbe, 0xc4, 0x81, 0x15, 0x00, 0x6c, 0x16, 0xa2, 0xa3, 0x01, 0x00, 0x00, 0x00,
+    0x74, 0x80, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x25, 0x01, 0x90, 0x78, 0x00, 0x00, 0x00, 0x20, 0x6e,
+    0xa3, 0xac, 0xac, 0x4c, 0x01, 0x40, 0x92, 0x23, 0x8d, 0x64, 0xd3, 0x3b, 0x1b, 0x9d, 0xd6, 0x41,
+    0x55, 0x27, 0xec, 0x82, 0x3b, 0x89, 0x12, 0xd9, 0xd8, 0xd3, 0xce, 0x34, 0xec, 0x72, 0x0c, 0xc5,
+    0x76, 0x0b, 0x00, 0x74, 0x11, 0x22, 0xb4, 0x01, 0x00, 0x00, 0x40, 0x64, 0x80, 0xf0, 0x0d, 0x00,
+    0x00, 0x00, 0xc1, 0x0f, 0x80, 0x7c, 0x00, 0x00, 0x00, 0x30, 0x6c, 0x80, 0x78, 0x9c, 0x77, 0x4f,
+    0xe3, 0x32, 0x3b, 0x12, 0x6a, 0xae, 0x9c, 0xd6, 0xa0, 0xd4, 0x91, 0x1a, 0xd3, 0xd9, 0x61, 0x55,
+    0x79, 0x4e, 0x13, 0xda, 0x18, 0xa7, 0x38, 0x0d, 0x72, 0x88, 0x32, 0x00, 0x00, 0x00, 0x7c, 0x14,
+    0x60, 0xbc, 0x01, 0x00, 0x00, 0x80, 0x3c, 0x00, 0x04, 0xb1, 0x78, 0x01, 0x00, 0x03, 0x8f, 0x0c,
+    0x7b, 0x31, 0x1e, 0x00, 0x40, 0x60, 0x44, 0x4b, 0xad, 0xa0, 0x53, 0x65, 0x13, 0x3b, 0x68, 0x65,
+    0x7b, 0x1c, 0x6b, 0xa5, 0x52, 0x72, 0x37, 0x2f, 0xde, 0xc6, 0x73, 0x5d, 0x4e, 0xea, 0x18, 0x4f,
+    0x02, 0x00, 0x2e, 0x43, 0x88, 0x35, 0x00, 0x00, 0x00, 0x84, 0x0e, 0x70, 0x70, 0x01, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x55, 0x05, 0x00, 0x00, 0x00, 0x26, 0x20, 0x54, 0x72, 0x79, 0x0f, 0x00, 0x28,
+    0x6c, 0x64, 0xe0, 0x5c, 0x66, 0x01, 0x80, 0x62, 0x23, 0x16, 0x66, 0x18, 0x3c, 0x12, 0x9f, 0xd6,
+    0x51, 0x33, 0xb7, 0xe3, 0x0b, 0x4a, 0x7d, 0x10, 0x14, 0x7a, 0x06, 0x47, 0xa3, 0x8c, 0x72, 0x1e,
+    0xb9, 0x8b, 0x08, 0x00, 0x78, 0x15, 0x32, 0xe3, 0x01, 0x00, 0x00, 0x60, 0x44, 0x00, 0xee, 0xae,
+    0xb3, 0x02, 0x00, 0x82, 0x8f, 0xe8, 0x74, 0x00, 0x00, 0x00, 0x38, 0x62, 0x00, 0xef, 0x0c, 0x95,
+    0x4f, 0x29, 0x53, 0x4b, 0xff, 0xe4, 0xfe, 0x1b, 0x1d, 0xa3, 0xd3, 0x19, 0x41, 0x83, 0x5b, 0x00,
+    0x60, 0x6d, 0x88, 0xb3, 0x58, 0xc6, 0x36, 0xa7, 0xed, 0x72, 0x00, 0x36, 0x00, 0x00, 0x00, 0x80,
+    0x0f, 0xd0, 0x82, 0x01, 0x00, 0x00, 0xa0, 0x2c, 0x80, 0xfb, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x6e,
+    0x04, 0x92, 0xab, 0x25, 0x00, 0x48, 0x74, 0x44, 0x8e, 0x7c, 0x79, 0x37, 0xa3, 0xe3, 0x3a, 0xdb,
+    0xea, 0xa8, 0xbd, 0x82, 0xa7, 0x51, 0x9a, 0x1b, 0xab, 0xda, 0xba, 0x86, 0x61, 0x8e, 0xfb, 0x78,
+    0xef, 0x01, 0x80, 0x4e, 0x42, 0xe4, 0x36, 0x00, 0x00, 0x00, 0x88, 0x0d, 0xc0, 0xa4, 0x01, 0x00,
+    0x00, 0x20, 0x00, 0x82, 0xcd, 0x03, 0x00, 0x00, 0x00, 0x27, 0x20, 0x04, 0x7a, 0x00, 0x00, 0x00,
+    0x30, 0x6e, 0xe0, 0x6c, 0x4c, 0x70, 0x87, 0xde, 0x42, 0x3b, 0xd6, 0x69, 0x72, 0xfc, 0x9a, 0x20,
+    0xd5, 0x79, 0x1d, 0x07, 0xdc, 0x26, 0x57, 0x7d, 0x4e, 0x1c, 0xba, 0x23, 0xaf, 0x42, 0x2d, 0x72,
+    0xf8, 0x34, 0x00, 0x00, 0x00, 0x7c, 0x15, 0x20, 0xcc, 0x01, 0x00, 0x00, 0x80, 0x44, 0x80, 0xbd,
+    0x10, 0x00, 0x00, 0x00, 0x43, 0x6f, 0x40, 0x77, 0xe7, 0x19, 0x00, 0x40, 0x62, 0x84, 0x44, 0xad,
+    0x9d, 0x97, 0x63, 0x23, 0x3b, 0x6e, 0x65, 0x69, 0x9c, 0x5d, 0x25, 0x53, 0xca, 0x36, 0x9b, 0xde,
+    0xa7, 0x74, 0x61, 0x4e, 0x32, 0xd9, 0x88, 0x02, 0x00, 0x4e, 0x43, 0xc4, 0x35, 0x00, 0x00, 0x00,
+    0x84, 0x0f, 0xa0, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x28, 0x02, 0x79, 0x08, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x18, 0x72, 0x71, 0x0e, 0x00, 0x28, 0x6e, 0x64, 0xbf, 0x7c, 0x4c, 0x01, 0x80, 0x72, 0x23,
+    0x34, 0x66, 0x15, 0x7c, 0x0b, 0x1f, 0xd7, 0xb1, 0x33, 0xef, 0xe4, 0xec, 0x4a, 0x81, 0x50, 0x25,
+    0x3a, 0x0d, 0x5f, 0xa9, 0xac, 0x72, 0x52, 0xbb, 0xf7, 0x0b, 0x00, 0x78, 0x16, 0x12, 0xee, 0x01,
+    0x00, 0x00, 0x60, 0x4c, 0x00, 0x8b, 0xee, 0x10, 0x02, 0x00, 0xc2, 0x8f, 0x44, 0x70, 0x00, 0x00,
+    0x00, 0x38, 0x64, 0x40, 0xee, 0x6c, 0x92, 0x03, 0x27, 0x63, 0x4b, 0xa8, 0x64, 0xc4, 0xdb, 0xf9,
+    0x22, 0xd4, 0x31, 0x44, 0x0b, 0x5e, 0x00, 0x60, 0x71, 0xc8, 0xca, 0x38, 0xd7, 0x3e, 0xb7, 0x0d,
+    0x73, 0xda, 0x37, 0x00, 0x00, 0x00, 0x80, 0x10, 0xf0, 0x9b, 0x01, 0x00, 0x00, 0xa0, 0x34, 0x00,
+    0xdc, 0x0e, 0x00, 0x00, 0x00, 0x44, 0x6e, 0xf0, 0x8d, 0xd1, 0x20, 0x00, 0x48, 0x76, 0xe4, 0x8a,
+    0x8c, 0x78, 0xe3, 0xa2, 0xf3, 0x3a, 0xed, 0xea, 0xae, 0x5d, 0x85, 0x27, 0x12, 0xfa, 0x1b, 0xdb,
+    0xda, 0xd8, 0x86, 0x65, 0x8e, 0x49, 0x19, 0x4c, 0x02, 0x80, 0x6e, 0x42, 0x2c, 0x37, 0x00, 0x00,
+    0x00, 0x88, 0x0e, 0xf0, 0x86, 0x01, 0x00, 0x00, 0x20, 0x08, 0x02, 0x17, 0x07, 0x00, 0x00, 0x00,
+    0x67, 0x00, 0x18, 0x78, 0x00, 0x00, 0x00, 0x30, 0x70, 0x00, 0x5f, 0xec, 0x66, 0xe3, 0xd6, 0x52,
+    0x3b, 0x9d, 0xe9, 0x3d, 0xdc, 0x48, 0xa0, 0xd5, 0x61, 0x20, 0x17, 0xde, 0x8b, 0x58, 0x81, 0xce,
+    0x20, 0xda, 0x2a, 0x0f, 0x49, 0x4d, 0x72, 0xaa, 0x37, 0x00, 0x00, 0x00, 0x7c, 0x16, 0xf0, 0xd7,
+    0x2d, 0x32, 0x00, 0x80, 0x4c, 0x10, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x83, 0x6f, 0x74, 0x73, 0xc5,
+    0x14, 0x00, 0x40, 0x64, 0xe4, 0x3b, 0xed, 0x99, 0x33, 0x61, 0x33, 0x3b, 0x68, 0xe5, 0x49, 0xdc,
+    0x47, 0xa5, 0x53, 0x3a, 0x36, 0x1f, 0xdf, 0x88, 0x75, 0x65, 0x0e, 0x72, 0x19, 0xb8, 0x02, 0x00,
+    0x6e, 0x43, 0x12, 0x36, 0x00, 0x00, 0x00, 0x84, 0x10, 0xa0, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x82, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xe8, 0x71, 0x7b, 0x0d, 0x00, 0x28, 0x70, 0x84,
+    0x99, 0xcc, 0x2c, 0x01, 0x80, 0x82, 0x23, 0x52, 0x66, 0x15, 0x7c, 0x05, 0x9f, 0xd7, 0x81, 0x33,
+    0xa3, 0xe5, 0x70, 0x4b, 0x85, 0x50, 0x34, 0x7a, 0x12, 0x7f, 0xad, 0xcc, 0x72, 0x62, 0xbd, 0x8b,
+    0x0e, 0x00, 0x78, 0x17, 0x52, 0xf6, 0x01, 0x00, 0x00, 0x60, 0x54, 0x00, 0x0a, 0xee, 0xb7, 0x00,
+    0x00, 0x02, 0x90, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x40, 0x01, 0x41, 0x62, 0x03, 0x00, 0x00, 0xc0,
+    0x31, 0x03, 0x5a, 0x67, 0x6f, 0x1c, 0x1a, 0x99, 0xdb, 0xa1, 0x22, 0x5b, 0xdc, 0x96, 0x16, 0xa5,
+    0x8e, 0x3c, 0x7a, 0x06, 0xff, 0x01, 0xab, 0x73, 0xec, 0xc6, 0x22, 0xf7, 0x07, 0x6e, 0x99, 0xb3,
+    0xcf, 0x01, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0xe5, 0x01, 0xb4, 0x75,
+    0x00, 0x00, 0x00, 0x20, 0x74, 0x00, 0x4a, 0x5c, 0xd3, 0x00, 0x40, 0xc2, 0x23, 0x39, 0x64, 0xbb,
+    0xbb, 0x13, 0x1d, 0xd8, 0xd9, 0x56, 0xc3, 0xec, 0xc4, 0x3b, 0x95, 0x90, 0xe3, 0xb8, 0xd8, 0xb6,
+    0x37, 0x4c, 0x73, 0x50, 0xcc, 0x8e, 0x14, 0x00, 0x74, 0x14, 0x72, 0xbb, 0x01, 0x00, 0x00, 0x40,
+    0x7c, 0x80, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x81, 0x10, 0x8c, 0x49, 0x00, 0x00, 0x00, 0x38, 0x05,
+    0x60, 0xb4, 0x03, 0x00, 0x00, 0x80, 0x91, 0x03, 0x71, 0xe2, 0xd5, 0xba, 0x2c, 0x16, 0xdb, 0x51,
+    0x4b, 0x87, 0x60, 0x00, 0x00, 0xb1, 0x88, 0x19, 0xb9, 0xff, 0x2e, 0xcd, 0x2a, 0x94, 0x0c, 0xd1,
+    0x77, 0x39, 0x6a, 0x6a, 0x13, 0xa4, 0xd3, 0x01, 0x00, 0x00, 0xe0, 0xbb, 0x80, 0x07, 0xef, 0x31,
+    0x02, 0x00, 0xa4, 0x82, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x18, 0x7e, 0x40, 0x7d, 0x1b, 0x71, 0x00,
+    0x00, 0x32, 0x23, 0x8b, 0x69, 0xa5, 0x9c, 0xeb, 0x1a, 0xda, 0xb1, 0x2a, 0xff, 0xe0, 0x51, 0x29,
+    0xa1, 0xce, 0xae, 0xb9, 0xff, 0x3e, 0xb4, 0x4b, 0x73, 0x46, 0xcd, 0xec, 0x16, 0x00, 0x70, 0x1c,
+    0xb2, 0xb4, 0x01, 0x00, 0x00, 0x20, 0x8c, 0x80, 0x37, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x51, 0xac,
+    0x62, 0x00, 0x00, 0x00, 0x30, 0x07, 0xc0, 0x8d, 0x5b, 0x64, 0x00, 0x40, 0x91, 0x23, 0x73, 0x63,
+    0x25, 0x08, 0x00, 0x94, 0x1c, 0x99, 0x33, 0xb7, 0xe0, 0x0d, 0xf8, 0xc0, 0x8e, 0x94, 0xd9, 0x2d,
+    0x1f, 0x5d, 0x4a, 0x84, 0x02, 0xd2, 0xb4, 0x78, 0x7f, 0x65, 0x97, 0x73, 0xfa, 0x0d, 0x85, 0x00,
+    0xc0, 0xc3, 0x90, 0xe2, 0x0f, 0x00, 0x00, 0x00, 0xe3, 0x02, 0x70, 0x6b, 0x00, 0x00, 0x00, 0x10,
+    0x82, 0x20, 0x48, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x37, 0x1a, 0x00, 0x00, 0x00, 0x0e, 0x1a,
+    0x68, 0x39, 0xd7, 0xe1, 0x5f, 0xc7, 0xe0, 0xce, 0x00, 0x59, 0xd5, 0xbe, 0xa9, 0x48, 0x75, 0xc2,
+    0xd2, 0xe7, 0xb8, 0x5d, 0x59, 0x9e, 0xf3, 0x3a, 0x6e, 0xbb, 0xdd, 0x71, 0xd3, 0x9c, 0x13, 0x0f,
+    0x00, 0x00, 0x00, 0xa0, 0x04, 0xc8, 0x70, 0xad, 0x05, 0x00, 0x28, 0x11, 0x84, 0xa0, 0x03, 0x00,
+    0x00, 0x00, 0xb1, 0x03, 0x03, 0x61, 0x56, 0x04, 0x00, 0x92, 0x1e, 0xc1, 0x20, 0x7b, 0xdd, 0x6d,
+    0xe8, 0xc4, 0x0e, 0xaa, 0x1a, 0x5a, 0xef, 0xd6, 0xc9, 0x84, 0x40, 0xc7, 0xda, 0x76, 0xca, 0x61,
+    0x9b, 0xd3, 0x6f, 0x0e, 0xb2, 0x00, 0xa0, 0xab, 0x90, 0xed, 0x0d, 0x00, 0x00, 0x00, 0x22, 0x04,
+    0xd8, 0x4e, 0x00, 0x00, 0x00, 0x08, 0x86, 0x20, 0xb3, 0x02, 0x00, 0x00, 0xc0, 0x39, 0x00, 0x58,
+    0x1d, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x90, 0x0e, 0xe3, 0x52, 0x00, 0xb0, 0xdc, 0x08, 0x50, 0x3a,
+    0xfb, 0x02, 0x00, 0xa8, 0x45, 0x6e, 0xc9, 0x66, 0x38, 0xa0, 0x56, 0xa2, 0xd4, 0x87, 0x4e, 0xcc,
+    0xf9, 0x53, 0xa3, 0x20, 0x54, 0x2f, 0xa4, 0x01, 0x00, 0x1f, 0x86, 0xd4, 0x79, 0x95, 0x14, 0x00,
+    0x20, 0x17, 0x24, 0xd0, 0x03, 0x00, 0x00, 0xc0, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x10,
+    0x1a, 0x40, 0x49, 0x6f, 0xe3, 0xf4, 0xd5, 0xd4, 0xce, 0x4e, 0x39, 0xfb, 0xce, 0x40, 0x29, 0x75,
+    0x6a, 0xcd, 0x36, 0xb8, 0xde, 0x5d, 0x9b, 0xd3, 0x75, 0xfe, 0xbe, 0x57, 0x87, 0xeb, 0x1c, 0xd1,
+    0x0d, 0x00, 0x00, 0x00, 0xa1, 0x04, 0x80, 0x6d, 0x00, 0x00, 0x00, 0x30, 0x09, 0x20, 0x8b, 0xdb,
+    0x59, 0x00, 0x40, 0xa1, 0x23, 0xfc, 0xe1, 0x91, 0x06, 0x00, 0x14, 0x1d, 0x89, 0x34, 0xc3, 0xe0,
+    0xe6, 0xf7, 0xc4, 0xce, 0x87, 0x19, 0x2a, 0x17, 0x5c, 0x6a, 0x94, 0x56, 0xd2, 0xd2, 0xf8, 0x8f,
+    0x65, 0x98, 0x83, 0x08, 0xee, 0x92, 0x00, 0xc0, 0xcb, 0x90, 0x06, 0x10, 0x00, 0x00, 0x00, 0x23,
+    0x03, 0x58, 0x65, 0x00, 0x00, 0x00, 0x10, 0x84, 0xa0, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00,
+    0x8c, 0x19, 0x00, 0x00, 0x00, 0x8e, 0x1a, 0x28, 0x37, 0x67, 0xdf, 0xc2, 0xc4, 0xe4, 0x8e, 0xef,
+    0x18, 0xca, 0xee, 0x9d, 0x68, 0x75, 0x9a, 0xd3, 0x95, 0xb9, 0xf6, 0x59, 0x9f, 0xf3, 0x3d, 0x36,
+    0xbd, 0xfd, 0x72, 0xdb, 0xa4, 0xb2, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x7c, 0x74, 0x41, 0x0e,
+    0x00, 0x28, 0x13, 0x44, 0x8f, 0x03, 0x00, 0x00, 0x00, 0xc1, 0x03, 0x9b, 0x1f, 0x00, 0x00, 0x00,
+    0x12, 0xdf, 0x70, 0x1f, 0x03, 0xdd, 0x25, 0xe8, 0xc8, 0x8e, 0x96, 0x1a, 0x48, 0x4f, 0xcb, 0xe9,
+    0x74, 0x70, 0xc7, 0xf5, 0xb6, 0xdb, 0x61, 0x9c, 0x23, 0x7a, 0x5e, 0xbc, 0x00, 0xa0, 0xb3, 0x90,
+    0x02, 0x0e, 0x00, 0x00, 0x00, 0x62, 0x04, 0x78, 0x42, 0x00, 0x00, 0x00, 0x08, 0x88, 0xa0, 0x05,
+    0x03, 0x00, 0x00, 0xc0, 0x49, 0x00, 0x19, 0x1d, 0x00, 0x00, 0x00, 0x8c, 0x1d, 0xd8, 0x08, 0x33,
+    0x4e, 0x00, 0xb0, 0xe0, 0x48, 0x46, 0xba, 0xf3, 0x02, 0x00, 0xc8, 0x45, 0xf2, 0xc9, 0xb7, 0x78,
+    0xc6, 0x56, 0xa3, 0xb4, 0x86, 0x96, 0xcc, 0x6b, 0x54, 0xab, 0x20, 0x08, 0x70, 0xc6, 0x02, 0x00,
+    0x5f, 0x86, 0x00, 0x7b, 0xab, 0x16, 0x00, 0x20, 0x19, 0xe4, 0x9d, 0x03, 0x00, 0x00, 0xc0, 0x10,
+    0x04, 0x28, 0x1a, 0x00, 0x00, 0x00, 0x90, 0x1a, 0x48, 0x21, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc0,
+    0x29, 0xba, 0x08, 0x9f, 0x99, 0xc6, 0x76, 0x3a, 0xca, 0x6d, 0x37, 0xa7, 0x49, 0xaa, 0x23, 0x6b,
+    0xc6, 0xc3, 0xe7, 0xf0, 0xe2, 0x1c, 0xfe, 0x73, 0x26, 0xbe, 0x6a, 0x9c, 0xe7, 0x5c, 0x70, 0xef,
+    0x08, 0x00, 0x08, 0x27, 0x24, 0xb2, 0x03, 0x00, 0x00, 0x80, 0x59, 0x00, 0x3b, 0x5c, 0x58, 0x02,
+    0x00, 0x8a, 0x1d, 0xf1, 0x02, 0x53, 0x22, 0x00, 0xa0, 0xec, 0xc8, 0xab, 0x79, 0x06, 0x17, 0xbe,
+    0x47, 0x76, 0xae, 0xcb, 0x0e, 0x39, 0xc4, 0x52, 0xa4, 0x24, 0x95, 0x6e, 0xc7, 0xf7, 0x2c, 0xcb,
+    0x1c, 0xa7, 0x30, 0xf2, 0x04, 0x00, 0x9e, 0x86, 0x00, 0x81, 0x00, 0x00, 0x00, 0x18, 0x1b, 0x80,
+    0xef, 0x02, 0x00, 0x00, 0x80, 0x30, 0x04, 0xc7, 0x11, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x10, 0xc8,
+    0x00, 0x00, 0x00, 0x70, 0xd8, 0xc0, 0x9f, 0xf9, 0xe0, 0x02, 0x00, 0x46, 0x47, 0x0a, 0xc7, 0xff,
+    0xb5, 0x76, 0x44, 0xac, 0x03, 0xa3, 0xbe, 0xd1, 0x27, 0xd3, 0x02, 0xa1, 0x01, 0x72, 0xf3, 0xed,
+    0x9d, 0x1b, 0x27, 0xb1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa3, 0xbc, 0x8b, 0x94, 0x00, 0x40,
+    0xa9, 0x20, 0xc6, 0x1b, 0x00, 0x00, 0x00, 0x88, 0x1e, 0x08, 0xf1, 0x00, 0x00, 0x00, 0x90, 0xfc,
+    0x40, 0xf0, 0x78, 0xe2, 0xce, 0x3d, 0x67, 0x76, 0xe2, 0xd3, 0x86, 0x39, 0xce, 0x4d, 0xa8, 0x33,
+    0x3d, 0xe6, 0xb8, 0x9d, 0x0f, 0xeb, 0x1c, 0x10, 0x74, 0x20, 0x1e, 0x59, 0xdd, 0xe5, 0x28, 0x71,
+    0x00, 0x00, 0x00, 0x10, 0x25, 0xe0, 0x96, 0x01, 0x00, 0x00, 0x40, 0x50, 0x04, 0x43, 0x1a, 0x00,
+    0x00, 0x00, 0xce, 0x02, 0x60, 0xe7, 0x00, 0x00, 0x00, 0x60, 0xf0, 0xc0, 0x10, 0x78, 0x43, 0x02,
+    0x80, 0x25, 0x47, 0xea, 0xd1, 0x70, 0x17, 0x00, 0x40, 0x2f, 0xc2, 0x52, 0x56, 0xc7, 0xe1, 0xb6,
+    0x22, 0xa5, 0x29, 0xf4, 0x63, 0x6e, 0xa5, 0x9a, 0x05, 0xd5, 0x85, 0xb7, 0x1c, 0x00, 0xf8, 0x34,
+    0xa4, 0xdd, 0x3b, 0xc0, 0x00, 0x00, 0xd9, 0x20, 0xf7, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x21, 0x28,
+    0xcb, 0x00, 0x00, 0x00, 0x80, 0xd8, 0x40, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x28, 0xd0,
+    0x8b, 0x17, 0x00, 0x34, 0x37, 0xf2, 0x4f, 0xf6, 0xb7, 0x55, 0x49, 0x5a, 0x1d, 0x59, 0x73, 0x2f,
+    0x1e, 0x95, 0x57, 0xe7, 0x00, 0xa2, 0x5f, 0x72, 0x2c, 0xe4, 0x3e, 0x27, 0x94, 0x2b, 0x79, 0x00,
+    0x40, 0x48, 0x21, 0x5c, 0x1f, 0x00, 0x00, 0x00, 0x4c, 0x03, 0x28, 0xe0, 0xca, 0x0a, 0x00, 0x50,
+    0xf0, 0xc8, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x85, 0x37, 0x88, 0xcd, 0x2d, 0x78, 0xdf, 0x3d, 0xb3,
+    0xd3, 0x57, 0x46, 0xc5, 0x95, 0x94, 0x2a, 0xa5, 0xbc, 0xb4, 0x43, 0x9e, 0x6c, 0x99, 0xe6, 0xf0,
+    0x87, 0xef, 0x29, 0x00, 0xf0, 0x36, 0x04, 0x0e, 0x04, 0x00, 0x00, 0xc0, 0xe8, 0x00, 0x24, 0x15,
+    0x00, 0x00, 0x00, 0x04, 0x22, 0x70, 0xa4, 0x00, 0x00, 0x00, 0x80, 0x12, 0x00, 0x2a, 0x06, 0x00,
+    0x00, 0x80, 0xe3, 0x06, 0xea, 0xcb, 0xe7, 0x15, 0x00, 0x30, 0x3b, 0x22, 0x35, 0x06, 0xae, 0x00,
+    0x20, 0x6a, 0x91, 0x43, 0xf5, 0xae, 0x7e, 0xad, 0x56, 0x08, 0x85, 0x90, 0xd7, 0xef, 0x0e, 0xdd,
+    0x3a, 0xc9, 0x3e, 0xec, 0x8b, 0x00, 0x00, 0x58, 0x21, 0x84, 0xde, 0x56, 0x05, 0x00, 0xca, 0x05,
+    0x59, 0xd7, 0x00, 0x00, 0x00, 0x40, 0xf8, 0xc0, 0x26, 0x07, 0x00, 0x00, 0x80, 0x04, 0x08, 0x10,
+    0xc7, 0xda, 0x36, 0xc5, 0x39, 0xb4, 0x93, 0x97, 0x76, 0xc5, 0xdf, 0x66, 0x4a, 0x9d, 0xfb, 0x31,
+    0xd3, 0xdd, 0x83, 0x98, 0xe7, 0xdc, 0xa1, 0x65, 0xf2, 0x1e, 0xec, 0x30, 0x27, 0x94, 0x03, 0x00,
+    0x00, 0x80, 0x38, 0x01, 0xfc, 0x06, 0x00, 0x00, 0x00, 0x02, 0xa3, 0xb0, 0xdf, 0x00, 0x00, 0x00,
+    0x70, 0x1a, 0x80, 0x2d, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x07, 0xa0, 0xbe, 0x56, 0x10, 0x00, 0x2c,
+    0x3a, 0x42, 0x8d, 0x4e, 0xba, 0x00, 0x00, 0x82, 0x11, 0xa8, 0x32, 0x3f, 0xce, 0xb7, 0x55, 0x09,
+    0xd5, 0xa0, 0x19, 0x73, 0x37, 0xd5, 0x2e, 0x48, 0x58, 0xcc, 0x0e, 0x01, 0xc0, 0xb7, 0x21, 0x08,
+    0x5f, 0x3c, 0x06, 0x00, 0x48, 0x07, 0xc1, 0xc3, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x41, 0x62, 0x00,
+    0x00, 0x00, 0x80, 0x14, 0x10, 0x80, 0x31, 0x00, 0x00, 0x00, 0x20, 0x37, 0x40, 0x83, 0x00, 0x00,
+    0x00, 0xc0, 0x15, 0x80, 0xae, 0x73, 0xa5, 0x05, 0x00, 0x0d, 0x8e, 0xa8, 0x93, 0x2b, 0x6d, 0xbd,
+    0x90, 0x58, 0x47, 0xd6, 0xfc, 0x8f, 0x83, 0xe8, 0xe5, 0x49, 0xef, 0xe8, 0xcd, 0x7c, 0x2c, 0x39,
+    0xd0, 0x01, 0xea, 0x22, 0x28, 0x00, 0x10, 0x56, 0x88, 0x35, 0x08, 0x00, 0x00, 0x00, 0xf3, 0x30,
+    0x6e, 0x37, 0x00, 0x00, 0x00, 0x14, 0x3d, 0x70, 0xcd, 0x01, 0x00, 0x00, 0x40, 0xe9, 0x81, 0x69,
+    0x73, 0x08, 0x0e, 0x72, 0x0f, 0xed, 0x44, 0x94, 0x43, 0xf0, 0x93, 0xa4, 0x4c, 0xa7, 0x33, 0x2d,
+    0x93, 0x9b, 0x5c, 0xb6, 0x39, 0x8f, 0x62, 0xf5, 0xba, 0x6b, 0x3c, 0xce, 0x01, 0x05, 0x01, 0x00,
+    0x00, 0x30, 0x3e, 0x86, 0x90, 0x04, 0x00, 0x00, 0x00, 0xa1, 0x08, 0xc6, 0x2d, 0x00, 0x00, 0x00,
+    0xa0, 0x05, 0x60, 0x86, 0x01, 0x00, 0x00, 0xe0, 0xc0, 0x01, 0x9f, 0x72, 0x1b, 0x05, 0x00, 0x0c,
+    0x8f, 0xac, 0x8c, 0x21, 0x2b, 0x00, 0x88, 0x5c, 0xc4, 0x58, 0xed, 0xb1, 0xbf, 0xae, 0x25, 0x42,
+    0x3c, 0x64, 0x00, 0x5c, 0x49, 0x37, 0x4f, 0x8a, 0x19, 0x83, 0x34, 0x00, 0x00, 0x5a, 0x48, 0xc1,
+    0x17, 0x74, 0x01, 0x80, 0x92, 0x41, 0xb4, 0x33, 0x00, 0x00, 0x00, 0x10, 0x3f, 0x70, 0x1a, 0x00,
+    0x00, 0x00, 0x40, 0x05, 0x84, 0x8a, 0x0d, 0x00, 0x00, 0x00, 0x49, 0x10, 0x0c, 0x8d, 0x13, 0xed,
+    0x0d, 0x73, 0x6a, 0xa7, 0x1e, 0xed, 0x7b, 0x01, 0xc0, 0xa4, 0x22, 0x21, 0x64, 0xc4, 0xfb, 0x18,
+    0xb1, 0xcf, 0x69, 0x45, 0xb7, 0xe6, 0xba, 0xd9, 0x65, 0x52, 0x46, 0x07, 0x00, 0x00, 0x00, 0x91,
+    0x02, 0xb6, 0xba, 0x8b, 0x05, 0x00, 0x9c, 0x07, 0x12, 0xc7, 0x01, 0x00, 0x00, 0xc0, 0xf0, 0x01,
+    0x21, 0x6f, 0x89, 0x03, 0x00, 0xcb, 0x8e, 0xc0, 0xa2, 0x51, 0x2e, 0x00, 0x80, 0x62, 0x84, 0xab,
+    0xac, 0x8e, 0xeb, 0x6c, 0x65, 0x42, 0x14, 0xe8, 0xc1, 0xbc, 0x4f, 0x35, 0x0c, 0xd2, 0x1f, 0x47,
+    0x4c, 0x00, 0xf0, 0x71, 0x48, 0xc4, 0xd7, 0x98, 0x01, 0x00, 0xf2, 0x41, 0xa8, 0x2a, 0x00, 0x00,
+    0x00, 0x0c, 0x44, 0xf0, 0xcc, 0x00, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x1e, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x0e, 0x0c, 0x24, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0xd1, 0x3c, 0x56, 0x01, 0x40, 0x93,
+    0x23, 0xd5, 0x64, 0x19, 0x0b, 0x00, 0xa4, 0x16, 0x61, 0x35, 0xe3, 0xe4, 0xc8, 0x7a, 0x7d, 0x12,
+    0x53, 0xfa, 0x3d, 0xd7, 0x50, 0x2e, 0x84, 0xe8, 0xbb, 0x33, 0x0c, 0x00, 0x84, 0x16, 0x82, 0x20,
+    0x0e, 0x2b, 0x00, 0xc0, 0x44, 0x90, 0xa2, 0x0d, 0x00, 0x00, 0x00, 0x85, 0x0f, 0x00, 0x6c, 0x00,
+    0x00, 0x00, 0x50, 0x7c, 0xc0, 0xda, 0x3c, 0x80, 0x07, 0xda, 0x53, 0x3b, 0x96, 0x64, 0xc1, 0xbb,
+    0xf2, 0xa8, 0xd3, 0x39, 0x4e, 0x8b, 0xe5, 0xa7, 0x97, 0x71, 0x8e, 0xc2, 0x58, 0xd5, 0x2e, 0x35,
+    0xaf, 0x73, 0xb2, 0x41, 0x00, 0x00, 0x00, 0x8c, 0x90, 0x71, 0xe6, 0x00, 0x00, 0x00, 0x40, 0x30,
+    0x82, 0x76, 0x0c, 0x00, 0x00, 0x00, 0xa8, 0x01, 0xe4, 0x60, 0x00, 0x00, 0x00, 0x38, 0x72, 0x40,
+    0x8b, 0xbc, 0x27, 0x01, 0x00, 0xd3, 0x23, 0x0a, 0xe3, 0xb7, 0x0a, 0x00, 0xa2, 0x17, 0x51, 0x57,
+    0x53, 0xed, 0x21, 0x6c, 0x8d, 0x50, 0x14, 0x99, 0x01, 0x47, 0xd3, 0xed, 0x93, 0xba, 0xc8, 0x56,
+    0x10, 0x00, 0x80, 0x17, 0x82, 0xf6, 0xe5, 0x61, 0x00, 0xa0, 0x6c, 0x10, 0x45, 0x0c, 0x00, 0x00,
+    0x00, 0x04, 0x10, 0x80, 0x2b, 0x00, 0x00, 0x00, 0x50, 0x03, 0x60, 0x33, 0x03, 0x00, 0x00, 0x40,
+    0x22, 0x04, 0xf2, 0x62, 0x13, 0x5b, 0x92, 0x1c, 0xdb, 0x71, 0x43, 0x0b, 0x5b, 0x00, 0x30, 0xad,
+    0x48, 0x14, 0x59, 0xf9, 0xbe, 0x4a, 0x0c, 0x84, 0x96, 0xd1, 0xfb, 0xf9, 0xa9, 0x76, 0x9a, 0xc4,
+    0xda, 0x01, 0x00, 0x00, 0x40, 0xac, 0x8c, 0x3d, 0x6f, 0x8d, 0x02, 0x00, 0x27, 0x82, 0x44, 0x70,
+    0x00, 0x00, 0x00, 0x30, 0x7e, 0x80, 0xa3, 0x4b, 0xb6, 0x00, 0xc0, 0xc2, 0x23, 0x80, 0x68, 0x7f,
+    0x0b, 0x00, 0x20, 0x19, 0x99, 0x2a, 0xdf, 0xe2, 0xa7, 0x5a, 0x9d, 0x10, 0xfc, 0xf9, 0x2e, 0x4f,
+    0x54, 0x2d, 0x83, 0x28, 0xca, 0xd9, 0x14, 0x00, 0x7c, 0x1d, 0x72, 0xf1, 0x2d, 0x68, 0x00, 0x80,
+    0x84, 0x90, 0x92, 0x08, 0x00, 0x00, 0x00, 0x43, 0x11, 0x68, 0x49, 0x00, 0x00, 0x00, 0x48, 0x05,
+    0x60, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x92, 0x03, 0x8a, 0x09, 0x00, 0x00, 0x00, 0x5c, 0x02, 0x48,
+    0x2c, 0x47, 0x4f, 0x00, 0xd0, 0xe8, 0xc8, 0x33, 0x99, 0xbc, 0x02, 0x00, 0xc9, 0x45, 0x3a, 0xcd,
+    0x5f, 0xb9, 0xd1, 0x5e, 0xa0, 0xa4, 0x99, 0x76, 0xd1, 0x31, 0x95, 0x13, 0x21, 0x57, 0x6f, 0x89,
+    0x03, 0x00, 0xe1, 0x85, 0xec, 0x8b, 0xe5, 0x12, 0x00, 0x30, 0x13, 0x24, 0x55, 0x03, 0x00, 0x00,
+    0x40, 0xf1, 0x03, 0x4c, 0x05, 0x00, 0x00, 0x00, 0x56, 0x40, 0xb8, 0xc8, 0x00, 0x00, 0x00, 0xa0,
+    0xfc, 0x00, 0xb4, 0x79, 0xfa, 0x76, 0xac, 0xc7, 0x76, 0x24, 0xc8, 0xce, 0xf6, 0x56, 0x51, 0xa8,
+    0x43, 0x9f, 0xf6, 0xcc, 0x87, 0x30, 0xeb, 0x9c, 0xb6, 0x31, 0xd0, 0x7d, 0x86, 0x9e, 0xe7, 0x84,
+    0x84, 0x00, 0x00, 0x00, 0x18, 0x23, 0xc3, 0x14, 0x01, 0x00, 0x00, 0x80, 0x70, 0x14, 0xb5, 0x1a,
+    0x00, 0x00, 0x00, 0xd0, 0x03, 0xa8, 0xc0, 0x00, 0x00, 0x00, 0x70, 0xe8, 0x00, 0xd0, 0xf8, 0xfc,
+    0x01, 0x00, 0xc6, 0x47, 0xde, 0xc5, 0x57, 0x15, 0x00, 0x44, 0x30, 0xd2, 0xae, 0xd6, 0xda, 0x43,
+    0xd8, 0x22, 0x25, 0x33, 0x32, 0x06, 0xae, 0xa7, 0x1b, 0x28, 0x95, 0x95, 0xab, 0x25, 0x00, 0x00,
+    0x31, 0x84, 0xf7, 0xbb, 0xca, 0x00, 0x40, 0xe9, 0x20, 0xf8, 0x16, 0x00, 0x00, 0x00, 0x88, 0x20,
+    0x80, 0x7c, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x40, 0x0e, 0x06, 0x00, 0x00, 0x80, 0x64, 0x08, 0x18,
+    0xc5, 0x9f, 0xb5, 0x25, 0x38, 0xb7, 0xa3, 0x7e, 0x36, 0xae, 0x00, 0x60, 0x62, 0x11, 0x42, 0xb2,
+    0x04, 0xde, 0x9e, 0x58, 0x08, 0x51, 0xa3, 0x51, 0x74, 0x9a, 0xed, 0x36, 0x29, 0xcd, 0x7b, 0x56,
+    0x00, 0x80, 0x68, 0x21, 0x62, 0x5f, 0x6f, 0x06, 0x00, 0xce, 0x04, 0x99, 0xdc, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0xc1, 0xf6, 0x36, 0xee, 0x00, 0x80, 0xa5, 0x47, 0x0a, 0x05, 0x00, 0x00, 0x00, 0xc4,
+    0x80, 0xd0, 0x84, 0x8e, 0xb6, 0x00, 0x00, 0x9a, 0x11, 0x9c, 0x72, 0x17, 0x1e, 0x9b, 0x15, 0x0a,
+    0x25, 0x9f, 0xe3, 0x72, 0x4c, 0xd5, 0x34, 0xc8, 0xc2, 0x9c, 0x65, 0x01, 0xc0, 0xe7, 0x21, 0x14,
+    0x5f, 0x9c, 0x06, 0x00, 0xc8, 0x08, 0x69, 0x58, 0x00, 0x00, 0x00, 0x30, 0x18, 0x85, 0x9e, 0x05,
+    0x00, 0x00, 0x80, 0x74, 0x00, 0x04, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x3a, 0xd0, 0x9e, 0x00, 0x00,
+    0x00, 0xc0, 0x2d, 0x80, 0x31, 0xb2, 0x78, 0x04, 0x00, 0xcd, 0x8e, 0x3c, 0x93, 0x3f, 0x2b, 0x00,
+    0x90, 0x5e, 0x44, 0xd0, 0x1c, 0x97, 0x3b, 0xee, 0x15, 0x4a, 0xdf, 0x69, 0x2f, 0x9d, 0x5d, 0xb9,
+    0x11, 0x72, 0xfb, 0xaa, 0x3f, 0x00, 0x10, 0x62, 0xc8, 0xee, 0xd8, 0x77, 0x01, 0x00, 0x53, 0x41,
+    0xae, 0x33, 0x00, 0x00, 0x00, 0x14, 0x40, 0x90, 0x9f, 0x00, 0x00, 0x00, 0x60, 0x0d, 0x00, 0xa0,
+    0x0b, 0x00, 0x00, 0x00, 0x0a, 0x10, 0xa4, 0x16, 0x00, 0x00, 0x00, 0x80, 0x01, 0x01, 0xd7, 0xbc,
+    0x78, 0x6f, 0xcf, 0x73, 0x3b, 0x8b, 0x63, 0x07, 0x1b, 0x00, 0xa8, 0xd4, 0x21, 0x51, 0x9b, 0xe7,
+    0xf4, 0x98, 0x79, 0xce, 0xee, 0xf8, 0xf5, 0x3e, 0x4c, 0xef, 0x83, 0x0e, 0xc3, 0x5d, 0x00, 0x00,
+    0x8c, 0x12, 0x12, 0xc4, 0xf5, 0x27, 0x00, 0x00, 0x45, 0x10, 0xfa, 0x0b, 0x00, 0x00, 0x00, 0xc7,
+    0x0e, 0xcc, 0x87, 0xa3, 0x18, 0x00, 0x60, 0x7e, 0xe4, 0x5a, 0x2c, 0x54, 0x01, 0x40, 0x14, 0x23,
+    0xcf, 0x6a, 0x92, 0xdd, 0x74, 0xad, 0x52, 0xaa, 0x23, 0x87, 0xe0, 0x86, 0xba, 0x85, 0x52, 0x95,
+    0xb9, 0x9c, 0x02, 0x00, 0x30, 0x43, 0xea, 0xbf, 0xe1, 0x0c, 0x00, 0x94, 0x0f, 0xc2, 0x50, 0x01,
+    0x00, 0x00, 0x80, 0x10, 0x02, 0x93, 0x09, 0x00, 0x00, 0x00, 0xea, 0x00, 0xe0, 0x5b, 0x00, 0x00,
+    0x00, 0x48, 0x88, 0x80, 0x42, 0x4c, 0x4f, 0x01, 0x80, 0x83, 0x23, 0x6f, 0x67, 0x6b, 0x0a, 0x00,
+    0xa6, 0x16, 0xd1, 0x25, 0x5f, 0xe1, 0x74, 0x8a, 0x89, 0x90, 0x33, 0x5a, 0x47, 0x2f, 0xdc, 0x8e,
+    0x93, 0x76, 0xbe, 0x8e, 0x08, 0x00, 0x88, 0x17, 0x92, 0x01, 0xae, 0x75, 0x00, 0xe0, 0x54, 0x10,
+    0x6b, 0x0d, 0x00, 0x00, 0x00, 0x46, 0x10, 0x20, 0x6a, 0x00, 0x00, 0x00, 0x58, 0x7c, 0x20, 0x27,
+    0x01, 0x00, 0x00, 0x40, 0x1c, 0x00, 0x0b, 0x68, 0x46, 0x0b, 0x00, 0x20, 0x1a, 0x41, 0x28, 0x8b,
+    0xdf, 0x49, 0x58, 0xa5, 0x4e, 0xe9, 0x79, 0x2d, 0x87, 0x55, 0x6d, 0x83, 0xe8, 0xcd, 0x91, 0x37,
+    0x69, 0x7c, 0x9f, 0x73, 0xf1, 0xbd, 0x6b, 0x00, 0x80, 0x94, 0x10, 0xf0, 0x0c, 0x00, 0x00, 0x00,
+    0x29, 0x01, 0x30, 0x5d, 0x00, 0x00, 0x00, 0x40, 0x76, 0x40, 0x46, 0x01, 0x00, 0x00, 0x80, 0x6b,
+    0x00, 0x0d, 0x63, 0xad, 0x07, 0x00, 0x1a, 0x1e, 0xc1, 0x26, 0xb3, 0x55, 0x00, 0x20, 0xc1, 0x08,
+    0x96, 0x19, 0x2d, 0xef, 0xdc, 0x4b, 0x84, 0x2a, 0xd4, 0x7f, 0x7a, 0xc9, 0x72, 0x24, 0xe4, 0x02,
+    0x16, 0x8c, 0x00, 0x20, 0xcc, 0x90, 0x28, 0xb2, 0x52, 0x03, 0x00, 0xe6, 0x82, 0x3c, 0x63, 0x00,
+    0x00, 0x00, 0x28, 0x82, 0xc0, 0xad, 0x01, 0x00, 0x00, 0xc0, 0x2a, 0x00, 0x78, 0x15, 0x00, 0x00,
+    0x00, 0x94, 0x20, 0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xa3, 0x59, 0xe4, 0x02, 0x80,
+    0x07, 0x47, 0x08, 0xc6, 0x45, 0x15, 0x00, 0x50, 0x2a, 0x72, 0xa5, 0x8e, 0xd1, 0x5d, 0x33, 0xfb,
+    0xa4, 0xfb, 0x31, 0x00, 0x7e, 0xa4, 0x1e, 0x08, 0xf1, 0x87, 0x43, 0x0c, 0x00, 0x18, 0x27, 0xe4,
+    0xb2, 0x5b, 0x9a, 0x00, 0x00, 0x9a, 0x20, 0xc4, 0x17, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x38, 0x03,
+    0x3b, 0x19, 0x00, 0xc0, 0x00, 0xc9, 0xaf, 0x18, 0xa6, 0x02, 0x80, 0x48, 0x46, 0x1a, 0xd5, 0xb5,
+    0x3a, 0xa6, 0x5a, 0xa6, 0x74, 0x48, 0x6e, 0xc1, 0x25, 0x75, 0x13, 0xa5, 0x8d, 0xf3, 0xa0, 0x05,
+    0x00, 0xa0, 0x86, 0xa0, 0x80, 0x0b, 0x1a, 0x00, 0x28, 0x21, 0x24, 0x56, 0x02, 0x00, 0x00, 0x00,
+    0x31, 0x04, 0x1a, 0x16, 0x00, 0x00, 0x00, 0x54, 0x02, 0x08, 0xaf, 0x00, 0x00, 0x00, 0x90, 0x14,
+    0x01, 0x61, 0xd8, 0x82, 0x02, 0x00, 0x27, 0x47, 0x06, 0xce, 0x01, 0x14, 0x00, 0x4c, 0x2e, 0xd2,
+    0x4e, 0xb6, 0xc4, 0xdf, 0x15, 0x1b, 0x21, 0x5e, 0xb4, 0x8e, 0xce, 0xba, 0x5d, 0x27, 0xa1, 0x80,
+    0x75, 0x16, 0x00, 0x10, 0x31, 0x24, 0x15, 0xbc, 0x00, 0x01, 0xc0, 0xb9, 0x20, 0xe3, 0x19, 0x00,
+    0x00, 0x00, 0x0c, 0x21, 0x30, 0xc9, 0x00, 0x00, 0x00, 0xb0, 0xfc, 0x80, 0x25, 0x03, 0x00, 0x00,
+    0x80, 0x58, 0x00, 0x74, 0xcf, 0x35, 0x16, 0x00, 0x40, 0x35, 0x62, 0x4c, 0x1e, 0xba, 0x3d, 0xac,
+    0x52, 0x1d, 0xbf, 0xf3, 0x5a, 0xee, 0xac, 0x1a, 0x07, 0xd1, 0x9e, 0x1b, 0xf1, 0x52, 0xfb, 0x40,
+    0x07, 0xe4, 0x8b, 0xdc, 0x00, 0x00, 0x39, 0x21, 0xa7, 0x1c, 0x00, 0x00, 0x00, 0xd2, 0x02, 0x40,
+    0xb9, 0x00, 0x00, 0x00, 0x80, 0xf0, 0x80, 0x9e, 0x02, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x1a, 0xc3,
+    0xf7, 0x0b, 0x00, 0x34, 0x3d, 0x72, 0x4e, 0x46, 0xaa, 0x00, 0x40, 0x8a, 0x91, 0x0c, 0x73, 0x50,
+    0x4e, 0xb6, 0xd7, 0x08, 0x15, 0xa9, 0x35, 0xf5, 0xa4, 0xe5, 0x4a, 0xa8, 0x1c, 0x0c, 0x2f, 0x01,
+    0x40, 0xa8, 0x21, 0xc0, 0xe4, 0x2d, 0x07, 0x00, 0x4c, 0x06, 0xb1, 0xbb, 0x00, 0x00, 0x00, 0x50,
+    0x08, 0xc1, 0x17, 0x04, 0x00, 0x00, 0x80, 0x75, 0x00, 0x90, 0x27, 0x00, 0x00, 0x00, 0x28, 0x42,
+    0xe0, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x26, 0x33, 0xa3, 0x05, 0x00, 0x4f, 0x8e, 0x0c,
+    0x8a, 0xff, 0x28, 0x00, 0xa0, 0x56, 0x44, 0x51, 0x5d, 0xa8, 0xbb, 0x69, 0x06, 0x4a, 0x24, 0x64,
+    0x1b, 0x5c, 0x58, 0xbd, 0x10, 0x7a, 0x14, 0x17, 0x25, 0x00, 0x30, 0x52, 0x48, 0xaf, 0x17, 0x8c,
+    0x01, 0x00, 0x54, 0x41, 0xf8, 0x2e, 0x00, 0x00, 0x00, 0x1c, 0x3d, 0x50, 0xea, 0x01, 0x00, 0x00,
+    0x80, 0x09, 0x02, 0x52, 0xb1, 0x47, 0x05, 0x00, 0xd1, 0x8c, 0x90, 0xa8, 0x0f, 0x74, 0x62, 0xb4,
+    0x4e, 0xc7, 0x92, 0x6c, 0x83, 0x6f, 0xea, 0x36, 0x4a, 0xc0, 0xe7, 0xe9, 0x0b, 0x00, 0xc0, 0x0d,
+    0x79, 0x02, 0x53, 0x34, 0x00, 0x50, 0x46, 0x48, 0xef, 0x03, 0x00, 0x00, 0x00, 0x82, 0x08, 0x26,
+    0x31, 0x00, 0x00, 0x00, 0xa8, 0x05, 0x70, 0x4f, 0x01, 0x00, 0x00, 0x20, 0x31, 0x82, 0x6c, 0x70,
+    0xc1, 0x04, 0x00, 0x8e, 0x8e, 0x80, 0x9a, 0x7d, 0x26, 0x00, 0x98, 0x5e, 0xa4, 0xa3, 0x9c, 0x8c,
+    0x1b, 0x2d, 0x46, 0x42, 0xa4, 0xe8, 0x18, 0x7d, 0x77, 0x3b, 0x4f, 0x52, 0x09, 0x6f, 0x36, 0x00,
+    0x20, 0x66, 0x48, 0x45, 0xf8, 0x20, 0x02, 0x80, 0x93, 0x41, 0x26, 0x31, 0x00, 0x00, 0x00, 0x18,
+    0x43, 0xe0, 0x7b, 0x01, 0x00, 0x00, 0x60, 0x01, 0x02, 0x6e, 0x07, 0x00, 0x00, 0x00, 0xf1, 0x00,
+    0x44, 0x9d, 0x6f, 0x2b, 0x00, 0x80, 0x6c, 0xc4, 0x8f, 0xcc, 0x68, 0xfb, 0x47, 0xb5, 0x3a, 0x5a,
+    0x67, 0xb7, 0xbc, 0x5e, 0xb5, 0x0e, 0x9a, 0x42, 0x4f, 0xe5, 0xd9, 0xf8, 0x85, 0x0e, 0xce, 0x97,
+    0xc6, 0x01, 0x00, 0x92, 0x42, 0xfe, 0x3d, 0x00, 0x00, 0x00, 0xa4, 0x06, 0xa0, 0x70, 0x01, 0x00,
+    0x00, 0x00, 0xe9, 0x81, 0x74, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x02, 0x5c, 0x7f, 0x03, 0x0d, 0x00,
+    0x68, 0x7c, 0xe4, 0x9f, 0x3c, 0x53, 0x01, 0x80, 0x24, 0x23, 0xc8, 0x65, 0x7b, 0x1c, 0x5c, 0x2f,
+    0x12, 0x7a, 0x53, 0xcb, 0xea, 0x64, 0xcb, 0x99, 0x10, 0x64, 0x38, 0x86, 0x02, 0x80, 0x70, 0x43,
+    0x1c, 0xca, 0x1b, 0x0f, 0x00, 0x98, 0x0d, 0xd2, 0x5b, 0x01, 0x00, 0x00, 0xa0, 0x18, 0x82, 0x82,
+    0x09, 0x00, 0x00, 0x00, 0x2b, 0x01, 0x2c, 0x49, 0x00, 0x00, 0x00, 0x50, 0x86, 0x60, 0xd1, 0x01,
+    0x00, 0x00, 0x00, 0x3c, 0x00, 0xec, 0x65, 0xe0, 0x0a, 0x00, 0x1e, 0x1d, 0x59, 0x10, 0x0b, 0x4f,
+    0x00, 0x40, 0xb1, 0x88, 0xae, 0x1a, 0x5a, 0xcf, 0xd8, 0x2c, 0x94, 0x8a, 0xc8, 0x57, 0xb8, 0xc2,
+    0x7a, 0x22, 0x14, 0x33, 0xce, 0x5e, 0x00, 0x60, 0xac, 0x10, 0xde, 0x2f, 0x96, 0x03, 0x00, 0xe8,
+    0x82, 0x64, 0x5c, 0x00, 0x00, 0x00, 0x38, 0x7c, 0xc0, 0xb1, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00,
+    0xa7, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x21, 0x18, 0x14, 0xf7, 0x53, 0x00, 0x10, 0xd1, 0x88, 0x66,
+    0xba, 0x23, 0x07, 0x2d, 0x0b, 0x75, 0x50, 0xc9, 0x42, 0xb8, 0xaa, 0x6e, 0xa4, 0xb4, 0x83, 0x7e,
+    0xc6, 0x8d, 0x0d, 0xe4, 0x9c, 0x3c, 0xf0, 0x4b, 0x03, 0x00, 0xa5, 0x84, 0x40, 0x2f, 0x00, 0x00,
+    0x00, 0x20, 0x8a, 0xe0, 0x55, 0x03, 0x00, 0x00, 0x80, 0x6a, 0x00, 0x3a, 0x14, 0x00, 0x00, 0x00,
+    0x92, 0x23, 0x68, 0x00, 0x8f, 0x46, 0x00, 0xe0, 0xec, 0x88, 0x94, 0xb9, 0x54, 0x02, 0x80, 0x09,
+    0x46, 0x82, 0xca, 0xed, 0xb8, 0xdd, 0x62, 0x25, 0x64, 0x88, 0x16, 0xd1, 0x71, 0xb7, 0xfb, 0xa4,
+    0x1a, 0x71, 0xf2, 0x03, 0x00, 0xa2, 0x86, 0x8c, 0x85, 0x77, 0x23, 0x00, 0x38, 0x1b, 0xc4, 0xdc,
+    0x02, 0x00, 0x00, 0x80, 0x41, 0x04, 0x50, 0x16, 0x00, 0x00, 0x00, 0x96, 0x20, 0x48, 0x84, 0x00,
+    0x00, 0x00, 0x10, 0x13, 0xc0, 0xb4, 0x79, 0xa3, 0x02, 0x00, 0xe8, 0x46, 0x4e, 0xc8, 0xbd, 0x15,
+    0x00, 0x54, 0x2c, 0x62, 0x73, 0x8e, 0xcb, 0x3f, 0x56, 0xf3, 0xa0, 0x6b, 0xb4, 0x79, 0x5e, 0xa3,
+    0x9f, 0x28, 0x65, 0x7d, 0x6b, 0x1d, 0x00, 0x20, 0x2b, 0xe4, 0x1e, 0x04, 0x00, 0x00, 0x40, 0x7a,
+    0x18, 0xe9, 0x16, 0x00, 0x00, 0x00, 0x10, 0x1f, 0xe0, 0x5b, 0x00, 0x00, 0x00, 0xe0, 0x26, 0x00,
+    0x7d, 0x07, 0x00, 0x00, 0x80, 0xe6, 0x07, 0x28, 0xca, 0x1e, 0x15, 0x00, 0x48, 0x33, 0xf2, 0x55,
+    0x26, 0xc4, 0xf3, 0xf3, 0x2a, 0x21, 0x4b, 0x35, 0xb1, 0x9e, 0xb7, 0xdc, 0x09, 0xb1, 0x88, 0x85,
+    0x2a, 0x00, 0x08, 0x39, 0xe4, 0xa8, 0xbc, 0xfa, 0x00, 0x80, 0xe9, 0x20, 0x89, 0x13, 0x00, 0x00,
+    0x00, 0x0a, 0x22, 0x18, 0xab, 0x00, 0x00, 0x00, 0xb0, 0x16, 0x80, 0x42, 0x04, 0x00, 0x00, 0x00,
+    0x85, 0x08, 0x56, 0x1f, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x80, 0x56, 0x7e, 0xa5, 0x00, 0xe0, 0xd9,
+    0x11, 0xd1, 0xf0, 0xc5, 0x04, 0x00, 0x54, 0x8b, 0x84, 0xab, 0x2b, 0xf6, 0xd4, 0xcd, 0x44, 0x09,
+    0x8c, 0x9c, 0x86, 0xbb, 0xac, 0x37, 0x42, 0xeb, 0xe3, 0x21, 0x07, 0x00, 0x46, 0x0b, 0x89, 0x04,
+    0x3f, 0x3f, 0x00, 0x80, 0x32, 0x08, 0xa3, 0x05, 0x00, 0x00, 0x80, 0xe3, 0x07, 0xa4, 0x13, 0x00,
+    0x00, 0x00, 0xb4, 0x01, 0xa0, 0xa6, 0x01, 0x00, 0x00, 0x80, 0x19, 0x02, 0x2e, 0xb1, 0x35, 0x05,
+    0x00, 0x51, 0x8d, 0xbc, 0xa3, 0xe9, 0x2f, 0x00, 0xb0, 0x52, 0x44, 0x97, 0x1c, 0x85, 0xe7, 0xea,
+    0x56, 0x4a, 0x92, 0xe8, 0xc4, 0x7c, 0x26, 0xc1, 0xce, 0x19, 0x05, 0x37, 0x35, 0x00, 0x50, 0x4e,
+    0x48, 0x5e, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x28, 0xe8, 0x38, 0x00, 0x00, 0x00, 0xa8, 0x07, 0xb0,
+    0x39, 0x01, 0x00, 0x00, 0x20, 0x41, 0x82, 0x91, 0x6f, 0xfb, 0x03, 0x00, 0x0e, 0x8f, 0x34, 0x98,
+    0x49, 0x24, 0x00, 0x98, 0x62, 0xc4, 0xaa, 0x6c, 0x8f, 0xb7, 0x2d, 0x66, 0x4a, 0x65, 0x68, 0x08,
+    0x5d, 0x76, 0x3b, 0x10, 0x32, 0x1a, 0x1f, 0x47, 0x00, 0x20, 0x6e, 0x48, 0x66, 0xf8, 0x47, 0x02,
+    0x80, 0xd3, 0x41, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x18, 0x45, 0xf0, 0x99, 0x00, 0x00, 0x00, 0x80,
+    0x05, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x8b, 0x10, 0xf8, 0x46, 0x00, 0x00, 0x00, 0x88, 0x0b,
+    0x40, 0xc7, 0x9c, 0x44, 0x01, 0x00, 0x84, 0x23, 0xd0, 0xe3, 0x6f, 0x0a, 0x00, 0xaa, 0x16, 0x91,
+    0x38, 0xdf, 0xe5, 0x4f, 0xab, 0x7d, 0xd0, 0x50, 0xfa, 0x49, 0x87, 0xd8, 0x6f, 0x94, 0x1e, 0xbf,
+    0x63, 0x0f, 0x00, 0x90, 0x16, 0xe2, 0x29, 0x46, 0x4a, 0x00, 0x20, 0x45, 0x10, 0x5e, 0x0b, 0x00,
+    0x00, 0x00, 0xc8, 0x0f, 0x44, 0x31, 0x00, 0x00, 0x00, 0x70, 0x15, 0xc0, 0x7b, 0x03, 0x00, 0x00,
+    0x40, 0x03, 0x04, 0x29, 0xe5, 0x87, 0x0a, 0x00, 0x24, 0x1a, 0x21, 0x27, 0xbb, 0xdf, 0xa0, 0x78,
+    0x99, 0x0e, 0xad, 0x7a, 0x5a, 0x47, 0x5c, 0x0e, 0x85, 0x6c, 0xc5, 0x2f, 0xb6, 0x30, 0x85, 0x9d,
+    0xe3, 0x56, 0x76, 0x80, 0x00, 0xc0, 0x7c, 0x10, 0x55, 0x08, 0x00, 0x00, 0x00, 0x45, 0x11, 0x2c,
+    0x5e, 0x00, 0x00, 0x00, 0x58, 0x0d, 0xa0, 0x00, 0x02, 0x00, 0x00, 0x80, 0x52, 0x04, 0x71, 0x10,
+    0x00, 0x00, 0x00, 0xe0, 0x02, 0xe8, 0x25, 0xfb, 0x4c, 0x00, 0xf0, 0xf0, 0x48, 0x51, 0x38, 0x50,
+    0x02, 0x00, 0xca, 0x45, 0xf8, 0xd5, 0x45, 0xbb, 0x01, 0x67, 0xa3, 0x54, 0x47, 0x96, 0xc3, 0x81,
+    0xd6, 0x23, 0x21, 0x54, 0x72, 0x19, 0x04, 0x00, 0xe3, 0x85, 0x2c, 0x85, 0xe5, 0x21, 0x00, 0x40,
+    0x1b, 0xc4, 0xb8, 0x02, 0x00, 0x00, 0xc0, 0x01, 0x04, 0x38, 0x0d, 0x00, 0x00, 0x00, 0x5a, 0x01,
+    0x88, 0xbf, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x01, 0xe9, 0x01, 0x00, 0x00, 0x00, 0x19, 0x10, 0x4c,
+    0xc4, 0x97, 0x14, 0x00, 0x44, 0x36, 0xc2, 0x82, 0xc6, 0xb4, 0x00, 0xc0, 0x52, 0x91, 0x67, 0xb2,
+    0x19, 0x4e, 0xad, 0x9b, 0x29, 0x15, 0xa3, 0x09, 0xf4, 0x4a, 0x05, 0x3d, 0x28, 0x1b, 0xcc, 0xd8,
+    0x00, 0x40, 0x49, 0x21, 0xf7, 0xdd, 0x48, 0x04, 0x00, 0x54, 0x04, 0xd1, 0x98, 0x00, 0x00, 0x00,
+    0x90, 0x24, 0xc1, 0x83, 0x17, 0xb6, 0x01, 0x00, 0xa7, 0x47, 0xae, 0xcb, 0xca, 0x11, 0x00, 0x4c,
+    0x32, 0xc2, 0x55, 0x0e, 0xc7, 0x45, 0x16, 0x3b, 0xa5, 0x20, 0xf4, 0x7e, 0x6e, 0xba, 0x5d, 0x08,
+    0x39, 0x91, 0x25, 0x27, 0x00, 0x10, 0x39, 0xa4, 0x37, 0xcc, 0x29, 0x01, 0xc0, 0xf9, 0x20, 0xb5,
+    0x11, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x70, 0x7a, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0xe9, 0x04,
+    0x00, 0x00, 0x80, 0x65, 0x08, 0x4a, 0x25, 0x00, 0x00, 0x00, 0xc4, 0x06, 0x00, 0x58, 0xc6, 0x99,
+    0x00, 0x00, 0xca, 0x11, 0xbe, 0xf1, 0xfe, 0x04, 0x00, 0x95, 0x8b, 0xac, 0x9b, 0xfb, 0x72, 0xbb,
+    0xd5, 0x40, 0x48, 0x33, 0x4d, 0xa9, 0x53, 0xee, 0x47, 0x4a, 0xd7, 0x5f, 0x13, 0x08, 0x00, 0xc8,
+    0x0b, 0xd1, 0x1f, 0x5b, 0x35, 0x00, 0x90, 0x26, 0x88, 0x9e, 0x05, 0x00, 0x00, 0x00, 0x04, 0x08,
+    0xa6, 0x1a, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x20, 0x99, 0x01, 0x00, 0x00, 0xa0, 0x09, 0x82, 0x4b,
+    0x01, 0x00, 0x00, 0x00, 0x33, 0x20, 0xe0, 0x94, 0xe9, 0x29, 0x00, 0x90, 0x6a, 0x84, 0x8a, 0x4c,
+    0x73, 0x73, 0xda, 0x75, 0x3a, 0xcf, 0x6a, 0x71, 0xfd, 0x72, 0xb9, 0x14, 0x5a, 0x19, 0xb3, 0xdb,
+    0x6e, 0x17, 0x7a, 0x8e, 0x61, 0xf9, 0x0b, 0x02, 0x00, 0x13, 0x42, 0x5c, 0x19, 0x00, 0x00, 0x00,
+    0x14, 0x46, 0x00, 0x98, 0x01, 0x00, 0x00, 0x60, 0x3d, 0x00, 0x9e, 0x07, 0x00, 0x00, 0x00, 0x8a,
+    0x11, 0x10, 0x44, 0x00, 0x00, 0x00, 0x80, 0x0d, 0xe0, 0x7b, 0xfc, 0x14, 0x01, 0xc0, 0xd3, 0x23,
+    0xfa, 0x60, 0x03, 0x09, 0x00, 0xa8, 0x17, 0x29, 0x58, 0x5f, 0xed, 0x24, 0x9c, 0x91, 0xd0, 0x21,
+    0xb9, 0x0e, 0x07, 0x5a, 0xaf, 0x94, 0xd6, 0xca, 0x60, 0x12, 0x00, 0x8c, 0x18, 0x42, 0x1e, 0x6e,
+    0x8e, 0x00, 0x00, 0x75, 0x90, 0x63, 0x0a, 0x00, 0x00, 0x00, 0x47, 0x10, 0x98, 0x40, 0x00, 0x00,
+    0x00, 0x68, 0x07, 0x80, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x53, 0x04, 0xdf, 0x0b, 0x00, 0x00, 0x00,
+    0xe4, 0x00, 0x38, 0x0f, 0x1b, 0x51, 0x00, 0x10, 0xdd, 0x48, 0xd4, 0x19, 0xa0, 0x02, 0x00, 0x6b,
+    0x45, 0xc8, 0xc9, 0x7b, 0xb8, 0xbc, 0x6e, 0xa7, 0xa4, 0x8d, 0x66, 0xd2, 0xc9, 0x16, 0xfc, 0x20,
+    0x8f, 0xb0, 0x7c, 0x03, 0x00, 0x65, 0x85, 0xe0, 0x7c, 0x1b, 0x19, 0x00, 0x50, 0x13, 0x44, 0x54,
+    0x02, 0x00, 0x00, 0x40, 0xa2, 0x04, 0xd7, 0xdc, 0x5c, 0x05, 0x00, 0x1c, 0x1f, 0x21, 0x2d, 0xf3,
+    0x45, 0x00, 0x30, 0xcd, 0x48, 0x53, 0x19, 0x15, 0x1f, 0x54, 0x0c, 0x95, 0x3a, 0xd0, 0xe6, 0x79,
+    0xe7, 0x76, 0x22, 0x04, 0x55, 0x86, 0xa9, 0x00, 0x40, 0xec, 0x10, 0xe9, 0x30, 0xb6, 0x04, 0x00,
+    0x27, 0x84, 0xf4, 0x35, 0x00, 0x00, 0x00, 0x30, 0x8e, 0x80, 0x74, 0x02, 0x00, 0x00, 0x00, 0x2b,
+    0x00, 0x72, 0x12, 0x00, 0x00, 0x00, 0x16, 0x22, 0x50, 0x9a, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x40,
+    0x29, 0x79, 0x3a, 0x02, 0x00, 0x48, 0x47, 0x5c, 0xc6, 0x1a, 0x13, 0x00, 0x54, 0x2f, 0x12, 0x6c,
+    0xd6, 0xcb, 0x23, 0x57, 0x0b, 0x21, 0xee, 0x74, 0xb0, 0x9e, 0xbd, 0x5f, 0x29, 0xc5, 0x80, 0x0f,
+    0x22, 0x00, 0x20, 0x31, 0x44, 0xa3, 0xcc, 0xff, 0x00, 0x40, 0xaa, 0x20, 0x14, 0x16, 0x00, 0x00,
+    0x00, 0x90, 0x20, 0xd0, 0x74, 0x00, 0x00, 0x00, 0xe0, 0x32, 0x00, 0xc7, 0x05, 0x00, 0x00, 0x80,
+    0x46, 0x08, 0xac, 0x17, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x10, 0x54, 0x9e, 0xa6, 0x00, 0x40, 0xb2,
+    0x11, 0xd9, 0xf1, 0x94, 0xfd, 0x2d, 0x17, 0xea, 0x9c, 0xab, 0xe9, 0xf5, 0xd4, 0xe5, 0x54, 0x68,
+    0x71, 0x2c, 0x78, 0x3f, 0x64, 0xf8, 0x39, 0x9b, 0xe5, 0x56, 0x08, 0x00, 0xcc, 0x08, 0x21, 0x2e,
+    0x00, 0x00, 0x00, 0x50, 0x1c, 0x05, 0xd2, 0x06, 0x00, 0x00, 0x80, 0x15, 0x01, 0x70, 0x1d, 0x00,
+    0x00, 0x00, 0x28, 0x47, 0xa0, 0x16, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x67, 0xb1, 0xac, 0x03,
+    0x00, 0x8f, 0x8f, 0xf8, 0x82, 0x47, 0x23, 0x00, 0xa0, 0x60, 0x64, 0x5e, 0x2d, 0xb4, 0xbb, 0x6f,
+    0x56, 0x42, 0x96, 0xe4, 0x3a, 0x5c, 0x67, 0x3d, 0x53, 0x42, 0x31, 0x97, 0x50, 0x00, 0x30, 0x66,
+    0x48, 0x99, 0x18, 0x4f, 0x02, 0x00, 0xf4, 0x41, 0xee, 0x26, 0x00, 0x00, 0x00, 0x1c, 0x42, 0x20,
+    0x2d, 0x01, 0x00, 0x00, 0xa0, 0x25, 0x80, 0x25, 0x09, 0x00, 0x00, 0x00, 0x8c, 0x11, 0x5c, 0x3a,
+    0x00, 0x00, 0x00, 0x90, 0x05, 0x60, 0x32, 0x4c, 0x3d, 0x01, 0x40, 0x84, 0x23, 0x70, 0x66, 0xa2,
+    0x09, 0x00, 0x2c, 0x16, 0xe1, 0x27, 0x5b, 0xe2, 0x16, 0xbb, 0xa1, 0xd2, 0x35, 0xfa, 0x4c, 0x57,
+    0x5e, 0x10, 0x84, 0xea, 0xc2, 0x85, 0x0e, 0x00, 0x94, 0x16, 0x32, 0x04, 0x9e, 0x79, 0x00, 0x40,
+    0x55, 0x90, 0x10, 0x09, 0x00, 0x00, 0x00, 0xc9, 0x12, 0xc8, 0x6d, 0xdd, 0x0b, 0x00, 0x70, 0x7e,
+    0xa4, 0x07, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x08, 0x77, 0x65, 0xa3, 0x08, 0x00, 0x26, 0x1a, 0x31,
+    0x29, 0x17, 0xe1, 0x75, 0x89, 0xa5, 0x92, 0xfd, 0x99, 0x3a, 0xa7, 0xdc, 0x6e, 0x84, 0x7a, 0xcc,
+    0x98, 0x16, 0x00, 0x88, 0x1e, 0x82, 0x1d, 0xfe, 0x97, 0x00, 0xe0, 0x8c, 0x90, 0x13, 0x03, 0x00,
+    0x00, 0x00, 0x06, 0x52, 0x18, 0x5d, 0x00, 0x00, 0x00, 0x60, 0x07, 0x20, 0x2c, 0x02, 0x00, 0x00,
+    0xc0, 0x52, 0x04, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x62, 0x04, 0xe8, 0x1c, 0x17, 0x40, 0x00, 0x00,
+    0xed, 0x48, 0xba, 0x58, 0x48, 0x02, 0x80, 0x0a, 0x46, 0x22, 0xcd, 0x6e, 0x39, 0xe5, 0x6a, 0xa2,
+    0x24, 0xa1, 0xce, 0xd6, 0xe9, 0xf7, 0x33, 0x25, 0x4a, 0xb0, 0x7b, 0x04, 0x00, 0x64, 0x86, 0x10,
+    0x98, 0xd7, 0x23, 0x00, 0x48, 0x17, 0x84, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x22, 0x04, 0xff, 0x0f,
+    0x00, 0x00, 0x00, 0xdc, 0x06, 0x80, 0xa3, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x41, 0x0d, 0x04, 0x00,
+    0x00, 0x80, 0x59, 0x00, 0x6a, 0xca, 0x97, 0x14, 0x00, 0x48, 0x37, 0x12, 0x30, 0xa6, 0xaa, 0x00,
+    0xe0, 0x4a, 0x11, 0x7e, 0xb5, 0xc1, 0xee, 0xbb, 0xdc, 0x0a, 0x59, 0x8f, 0xe3, 0xef, 0x0e, 0x0d,
+    0x41, 0x69, 0xb6, 0xdc, 0x10, 0x01, 0x80, 0x29, 0x21, 0xe0, 0xdc, 0xf4, 0x03, 0x00, 0xd6, 0x04,
+    0x51, 0x73, 0x00, 0x00, 0x00, 0xa0, 0x20, 0xc1, 0x71, 0x04, 0x00, 0x00, 0x00, 0x18, 0x01, 0xf0,
+    0xc2, 0xcb, 0x0a, 0x00, 0x3c, 0x3f, 0x12, 0x09, 0xde, 0x8a, 0x00, 0x80, 0x8a, 0x11, 0x63, 0x75,
+    0xbf, 0xce, 0xb4, 0x99, 0x09, 0x95, 0x92, 0xeb, 0xf0, 0x98, 0xf5, 0x4e, 0x29, 0xdb, 0x7c, 0x5b,
+    0x01, 0xc0, 0xa8, 0x21, 0xce, 0x62, 0x78, 0x09, 0x00, 0x50, 0x08, 0x81, 0x8e, 0x00, 0x00, 0x00,
+    0x70, 0x0c, 0xc1, 0x4f, 0x05, 0x00, 0x00, 0x80, 0xb6, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x30,
+    0x47, 0xc0, 0x08, 0x01, 0x00, 0x00, 0x40, 0x1e, 0x80, 0x96, 0x70, 0xd0, 0x04, 0x00, 0x51, 0x8e,
+    0x24, 0x96, 0xb1, 0x22, 0x00, 0xb0, 0x5a, 0xe4, 0xa2, 0xec, 0x8a, 0xeb, 0xec, 0x96, 0x4a, 0xbc,
+    0xe8, 0x30, 0xfd, 0x7b, 0xc1, 0x10, 0x0a, 0x0f, 0x0b, 0x3d, 0x00, 0x50, 0x5e, 0xc8, 0x46, 0x98,
+    0x23, 0x02, 0x00, 0x75, 0x41, 0xf2, 0x22, 0x00, 0x00, 0x00, 0x24, 0x4c, 0xe0, 0x49, 0x00, 0x00,
+    0x00, 0xe0, 0x05, 0x80, 0xf4, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x20, 0x34, 0x00, 0x00, 0x00,
+    0xa0, 0x03, 0x80, 0xa8, 0xdc, 0x10, 0x01, 0xc0, 0x54, 0x23, 0xe7, 0x64, 0xdc, 0x7b, 0xf9, 0x30,
+    0xd5, 0x79, 0x3e, 0x0b, 0xe7, 0x8b, 0xdb, 0x91, 0x50, 0xc5, 0x59, 0xf9, 0x7e, 0x1b, 0xf1, 0x73,
+    0xb0, 0xc3, 0x1d, 0x13, 0x00, 0x9c, 0x12, 0x72, 0xa6, 0x01, 0x00, 0x00, 0x80, 0x25, 0x00, 0x3d,
+    0x08, 0x00, 0x00, 0x00, 0x8b, 0x11, 0x40, 0x50, 0x00, 0x00, 0x00, 0x88, 0x13, 0x60, 0x4d, 0xec,
+    0xd9, 0x00, 0x00, 0xc4, 0x23, 0xb3, 0xe2, 0xbf, 0x08, 0x00, 0xaa, 0x18, 0xc1, 0x32, 0x43, 0xe5,
+    0x73, 0xab, 0x8d, 0xd2, 0x8f, 0x5a, 0x5c, 0x8f, 0xdf, 0xef, 0x84, 0x12, 0xc2, 0xe7, 0x12, 0x00,
+    0x90, 0x1a, 0xb2, 0x6b, 0x9e, 0x9a, 0x00, 0x20, 0x65, 0x90, 0x5a, 0x0a, 0x00, 0x00, 0x00, 0xc8,
+    0x10, 0x44, 0x46, 0x00, 0x00, 0x00, 0x70, 0x1d, 0x20, 0x32, 0x02, 0x00, 0x00, 0x40, 0x43, 0x04,
+    0x29, 0x13, 0x00, 0x00, 0x00, 0xe6, 0x01, 0xe8, 0x28, 0x03, 0x51, 0x00, 0x20, 0xe1, 0x88, 0x92,
+    0x58, 0x87, 0x02, 0x80, 0x4b, 0x45, 0x16, 0xd6, 0x15, 0xbb, 0xf5, 0x72, 0x2c, 0xc4, 0x40, 0xe6,
+    0xc1, 0x97, 0x35, 0x0c, 0x25, 0xe4, 0xf2, 0x5c, 0x04, 0x00, 0xe6, 0x84, 0x2c, 0x79, 0x95, 0x17,
+    0x00, 0x58, 0x15, 0x04, 0xc8, 0x01, 0x00, 0x00, 0x80, 0x92, 0x04, 0x27, 0x12, 0x00, 0x00, 0x00,
+    0xe0, 0x04, 0x18, 0xff, 0xf2, 0x09, 0x00, 0xf0, 0x00, 0x09, 0x1c, 0x78, 0x25, 0x02, 0x00, 0x4a,
+    0x46, 0xea, 0xd4, 0x85, 0x7a, 0x87, 0x66, 0x27, 0x44, 0x4b, 0xae, 0xc3, 0x51, 0xd6, 0x43, 0xa5,
+    0xba, 0x73, 0xc3, 0x05, 0x00, 0xe3, 0x86, 0x94, 0x8c, 0x95, 0x26, 0x00, 0x40, 0x23, 0xe4, 0xf3,
+    0x01, 0x00, 0x00, 0xc0, 0x41, 0x04, 0x7f, 0x17, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xa8, 0x5a, 0x00,
+    0x00, 0x00, 0xc0, 0x20, 0x81, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x99, 0x00, 0x64, 0xc1, 0x7e, 0x12,
+    0x00, 0x44, 0x3a, 0x82, 0x4a, 0xbe, 0x7a, 0x00, 0xc0, 0x72, 0x91, 0x97, 0xb2, 0x31, 0x8e, 0xb5,
+    0x9b, 0x2a, 0x49, 0xa2, 0x81, 0x74, 0xdf, 0x05, 0x45, 0xa9, 0x4c, 0xfc, 0x02, 0x01, 0x40, 0x89,
+    0x21, 0xcc, 0x61, 0x48, 0x09, 0x00, 0x54, 0x06, 0xf1, 0x84, 0x00, 0x00, 0x00, 0x90, 0x34, 0x41,
+    0x0c, 0x02, 0x00, 0x00, 0x80, 0x37, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x38, 0x41, 0x10, 0x04,
+    0x01, 0x00, 0x00, 0x80, 0x16, 0x80, 0x85, 0xf2, 0x32, 0x04, 0x00, 0x93, 0x8d, 0x4c, 0x92, 0xf7,
+    0x6d, 0x7c, 0xc2, 0x56, 0xa7, 0xf4, 0x0c, 0x9b, 0x17, 0x6e, 0x57, 0x42, 0xcf, 0xe7, 0x64, 0x7c,
+    0xed, 0x44, 0xd0, 0x91, 0x0e, 0xcb, 0x4c, 0x00, 0x70, 0x4e, 0x88, 0x48, 0x07, 0x00, 0x00, 0x00,
+    0xb6, 0x00, 0x86, 0x1f, 0x00, 0x00, 0x00, 0x2c, 0x47, 0x00, 0x44, 0x01, 0x00, 0x00, 0x20, 0x56,
+    0x00, 0x83, 0xb0, 0x8c, 0x02, 0x00, 0x50, 0x8f, 0x30, 0x8a, 0xa9, 0x21, 0x00, 0xa8, 0x64, 0x04,
+    0xc2, 0xdc, 0x91, 0x8b, 0xac, 0x46, 0x4a, 0x63, 0x6a, 0x71, 0x3d, 0x7b, 0x3f, 0x14, 0xf2, 0x0b,
+    0x5f, 0x4f, 0x00, 0x40, 0x6e, 0x88, 0xd3, 0x39, 0x8c, 0x02, 0x80, 0xb4, 0x41, 0x3c, 0x27, 0x00,
+    0x00, 0x00, 0x20, 0x44, 0x80, 0x33, 0x01, 0x00, 0x00, 0xc0, 0x7d, 0x00, 0x35, 0x07, 0x00, 0x00,
+    0x00, 0x4d, 0x11, 0x5c, 0x55, 0x00, 0x00, 0x00, 0x98, 0x09, 0xa0, 0x9d, 0xcc, 0x3b, 0x01, 0x80,
+    0x94, 0x23, 0x8d, 0xe1, 0x85, 0x09, 0x00, 0xae, 0x15, 0xd1, 0x58, 0xab, 0xec, 0xf1, 0xcb, 0xb5,
+    0xd0, 0x0c, 0x39, 0x0d, 0x5f, 0xd9, 0x50, 0x94, 0xd2, 0xcb, 0xf7, 0x11, 0x00, 0x98, 0x14, 0xc2,
+    0xf8, 0xb5, 0x73, 0x00, 0x60, 0x5d, 0x10, 0x14, 0x07, 0x00, 0x00, 0x00, 0x8a, 0x12, 0x70, 0x4a,
+    0x00, 0x00, 0x00, 0x80, 0x15, 0xe0, 0xbe, 0x03, 0x00, 0x00, 0xc0, 0x13, 0x04, 0x55, 0xe0, 0x86,
+    0x08, 0x00, 0xa8, 0x19, 0xe9, 0x4f, 0x23, 0xe7, 0x04, 0x98, 0xa1, 0x8e, 0x31, 0x19, 0x0f, 0x17,
+    0x59, 0x2f, 0x95, 0xf2, 0xcf, 0x2d, 0xb8, 0xeb, 0x8c, 0x9c, 0xd3, 0x36, 0x4e, 0x9c, 0x00, 0x00,
+    0x95, 0x90, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x47, 0x11, 0x0c, 0x66, 0x00, 0x00, 0x00, 0x68, 0x0f,
+    0xe0, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x93, 0x04, 0xf0, 0x12, 0x00, 0x00, 0x00, 0xe4, 0x02, 0xe0,
+    0x00, 0x0b, 0x46, 0x00, 0x10, 0xed, 0xc8, 0xf4, 0x58, 0xa6, 0x01, 0x00, 0xeb, 0x45, 0x88, 0xca,
+    0xd8, 0xf8, 0xd9, 0x6e, 0x2b, 0xf4, 0x85, 0x86, 0xd0, 0xed, 0x16, 0x1c, 0xa5, 0x7d, 0x71, 0x4f,
+    0x04, 0x00, 0x65, 0x86, 0x58, 0x89, 0x4f, 0x27, 0x00, 0x50, 0x1b, 0x24, 0xed, 0x01, 0x00, 0x00,
+    0x40, 0xe2, 0x04, 0x46, 0x0b, 0x00, 0x00, 0x00, 0x5e, 0x01, 0x38, 0xb2, 0x00, 0x00, 0x00, 0xe0,
+    0x08, 0x41, 0xac, 0x04, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x80, 0xc9, 0x71, 0x10, 0x00, 0x4c, 0x37,
+    0x42, 0x42, 0x76, 0xb0, 0x00, 0x00, 0x63, 0x91, 0xbd, 0xb3, 0x67, 0xce, 0xb7, 0x9d, 0x09, 0xc5,
+    0xa1, 0x25, 0x73, 0xc2, 0x14, 0x43, 0xe7, 0x39, 0xac, 0x34, 0x01, 0xc0, 0x49, 0x21, 0x7d, 0x1f,
+    0x00, 0x00, 0x00, 0x58, 0x03, 0x38, 0x79, 0x00, 0x00, 0x00, 0xb0, 0x20, 0x41, 0x1b, 0x05, 0x00,
+    0x00, 0x80, 0x78, 0x01, 0xd6, 0xbe, 0xbd, 0x03, 0x00, 0x40, 0x3e, 0x42, 0x27, 0x26, 0x82, 0x00,
+    0xa0, 0x9a, 0x91, 0xdc, 0xf2, 0x33, 0xce, 0xa8, 0x5a, 0x29, 0x05, 0xaa, 0xbf, 0xf5, 0xdd, 0xfd,
+    0x52, 0x28, 0x3f, 0x4c, 0x4c, 0x01, 0x00, 0xc9, 0x21, 0xbd, 0xe7, 0x93, 0x0a, 0x00, 0x52, 0x07,
+    0xf1, 0x90, 0x00, 0x00, 0x00, 0x80, 0x14, 0x41, 0x3c, 0x05, 0x00, 0x00, 0x00, 0x17, 0x02, 0xde,
+    0x15, 0x00, 0x00, 0x00, 0x34, 0x46, 0xf0, 0x6e, 0x01, 0x00, 0x00, 0x60, 0x2e, 0x00, 0x54, 0xb2,
+    0xc3, 0x04, 0x00, 0x92, 0x8e, 0x40, 0x83, 0x95, 0x23, 0x00, 0xb8, 0x58, 0xc4, 0x64, 0x9d, 0xb3,
+    0x0f, 0x30, 0xe7, 0x42, 0x48, 0xe4, 0x3d, 0xfc, 0x69, 0xc3, 0x51, 0xb2, 0x30, 0x5b, 0x4a, 0x00,
+    0x60, 0x56, 0x48, 0x2a, 0x58, 0x0f, 0x02, 0x80, 0x95, 0x41, 0x1a, 0x1c, 0x00, 0x00, 0x00, 0x28,
+    0x4b, 0xc0, 0x32, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x00, 0xdd, 0x0d, 0x00, 0x00, 0x00, 0x8f, 0x10,
+    0xf4, 0x80, 0xdf, 0x21, 0x00, 0xa0, 0x68, 0x24, 0x2c, 0x9d, 0x8c, 0xff, 0x4f, 0x96, 0x3a, 0xd8,
+    0xe4, 0x3d, 0xfc, 0x63, 0x3d, 0x55, 0x12, 0x43, 0x47, 0xe4, 0xaa, 0x37, 0x76, 0x4e, 0xea, 0x78,
+    0x76, 0x02, 0x00, 0x74, 0x42, 0xec, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x46, 0x70, 0xb5, 0x01, 0x00,
+    0x00, 0xa0, 0x45, 0x80, 0xd6, 0x09, 0x00, 0x00, 0x00, 0xb2, 0x01, 0x88, 0x7d, 0x71, 0x20, 0x00,
+    0x88, 0x78, 0x64, 0x62, 0xdc, 0xb0, 0x00, 0x80, 0x05, 0x23, 0x56, 0xe5, 0x70, 0x7c, 0x6b, 0x37,
+    0x16, 0x32, 0x41, 0x53, 0xe7, 0x16, 0x0b, 0x92, 0x52, 0xea, 0x38, 0x4d, 0x02, 0x80, 0x52, 0x43,
+    0x84, 0xc5, 0x7c, 0x14, 0x00, 0xa8, 0x0e, 0x42, 0xda, 0x00, 0x00, 0x00, 0x20, 0x79, 0x82, 0x2a,
+    0x07, 0x00, 0x00, 0x00, 0xef, 0x00, 0xb8, 0x50, 0x00, 0x00, 0x00, 0x70, 0x86, 0x80, 0x92, 0x02,
+    0x00, 0x00, 0x00, 0x4d, 0x00, 0x66, 0x64, 0xfb, 0x07, 0x00, 0x26, 0x1c, 0x01, 0x1d, 0xc7, 0x53,
+    0x00, 0x80, 0xb5, 0x88, 0xd3, 0x99, 0x31, 0x9f, 0xdb, 0xee, 0x84, 0xe4, 0xd1, 0x28, 0x7a, 0xb4,
+    0x8a, 0x22, 0x94, 0x1c, 0x16, 0x9b, 0x00, 0xe0, 0xac, 0x10, 0xc8, 0xf0, 0x44, 0x01, 0x00, 0xec,
+    0x81, 0xec, 0x3a, 0x00, 0x00, 0x00, 0x58, 0x92, 0x60, 0x91, 0x02, 0x00, 0x00, 0x40, 0xcc, 0x00,
+    0x91, 0x1d, 0x00, 0x00, 0x00, 0xa0, 0x1f, 0x58, 0x13, 0x3f, 0x3f, 0x00, 0x50, 0xd1, 0x08, 0x54,
+    0x19, 0x0c, 0x2f, 0x4d, 0xcd, 0x94, 0x3e, 0xd5, 0xd9, 0x7a, 0xe7, 0x7e, 0x2a, 0x14, 0x27, 0xe6,
+    0xac, 0x4f, 0x80, 0xec, 0x9c, 0x08, 0x74, 0x6f, 0x05, 0x00, 0xe9, 0x83, 0x74, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x8c, 0x40, 0xd5, 0x02, 0x00, 0x00, 0x80, 0x1b, 0x01, 0xb7, 0x06, 0x00, 0x00, 0x00,
+    0x9a, 0x23, 0xd8, 0xc0, 0x00, 0x00, 0x00, 0x30, 0x1b, 0x00, 0x0f, 0xf9, 0x41, 0x02, 0x00, 0x69,
+    0x47, 0x38, 0xc0, 0x86, 0x10, 0x00, 0x5c, 0x2d, 0x92, 0xb2, 0x16, 0xda, 0x19, 0x98, 0x7b, 0x25,
+    0x2a, 0x32, 0x1e, 0x6e, 0xb4, 0x21, 0x09, 0x55, 0x99, 0xb3, 0x26, 0x00, 0x30, 0x2d, 0xe4, 0x33,
+    0x2c, 0x21, 0x01, 0xc0, 0xda, 0x20, 0xda, 0x0d, 0x00, 0x00, 0x00, 0x14, 0x26, 0x48, 0x9f, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x42, 0x06, 0x00, 0x00, 0x80, 0x67, 0x08, 0x20, 0x13, 0x00, 0x00,
+    0x00, 0xd4, 0x80, 0x50, 0x02, 0xbe, 0x86, 0x00, 0x80, 0xaa, 0x11, 0x4c, 0x74, 0xde, 0x05, 0x00,
+    0x99, 0x8a, 0x9c, 0x93, 0x03, 0x71, 0x8e, 0xf5, 0x56, 0x49, 0x15, 0xcd, 0x9b, 0xf7, 0xe6, 0xe8,
+    0x49, 0xd9, 0x63, 0xe7, 0x09, 0x00, 0x50, 0x0a, 0xc1, 0xe7, 0x72, 0x0b, 0x00, 0xd0, 0x26, 0x08,
+    0x0d, 0x05, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x14, 0xbd, 0x94, 0x0e, 0x00, 0x44, 0x3d, 0xb2, 0x26,
+    0x6e, 0x46, 0x00, 0xc0, 0x8a, 0x11, 0xae, 0x72, 0x35, 0x8e, 0xb2, 0x5b, 0x0b, 0xa9, 0x9f, 0x31,
+    0xf3, 0x56, 0x05, 0x4b, 0x09, 0x8c, 0xbc, 0x39, 0x01, 0x40, 0xb9, 0x21, 0x13, 0x63, 0x8f, 0x0a,
+    0x00, 0xd4, 0x07, 0x81, 0x58, 0x00, 0x00, 0x00, 0x90, 0x40, 0x01, 0x4d, 0x04, 0x00, 0x00, 0x80,
+    0x97, 0x00, 0xd0, 0x23, 0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x61, 0x01, 0x00, 0x00, 0x80, 0x2e,
+    0x80, 0xf8, 0x71, 0xd1, 0x03, 0x00, 0x53, 0x8e, 0x28, 0x8c, 0x49, 0x27, 0x00, 0xc0, 0x5c, 0xc4,
+    0xe3, 0xac, 0x97, 0x9f, 0x6d, 0x87, 0x42, 0x55, 0x69, 0x47, 0xfd, 0x72, 0xc5, 0x11, 0x7a, 0x0e,
+    0x3f, 0x4e, 0x00, 0x70, 0x5a, 0x88, 0xd4, 0x98, 0x7e, 0x01, 0x00, 0x16, 0x41, 0xb0, 0x1c, 0x00,
+    0x00, 0x00, 0x2c, 0x4a, 0xb0, 0x4b, 0x01, 0x00, 0x00, 0x20, 0x6e, 0x00, 0xb9, 0x0d, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0xac, 0x89, 0xeb, 0x1e, 0x00, 0xa8, 0x6a, 0xe4, 0x99, 0xac, 0x7c, 0x03, 0xa1,
+    0x76, 0x3a, 0xb7, 0x6a, 0x6b, 0x5d, 0x70, 0xbf, 0x15, 0x02, 0x17, 0x97, 0xd9, 0xa6, 0x45, 0x7a,
+    0x8e, 0x12, 0xda, 0xc4, 0x02, 0x80, 0x14, 0x42, 0xa6, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x47, 0x00,
+    0x86, 0x01, 0x00, 0x00, 0xc0, 0x95, 0x00, 0x7e, 0x0c, 0x00, 0x00, 0x00, 0xf3, 0x01, 0xbc, 0x8e,
+    0x79, 0x21, 0x00, 0x90, 0x78, 0x24, 0xee, 0xcb, 0xf3, 0x00, 0xc0, 0xe5, 0x22, 0x23, 0xeb, 0x9f,
+    0xbd, 0x7f, 0x39, 0x58, 0xa2, 0x22, 0x9b, 0xe1, 0x19, 0x1b, 0x96, 0x50, 0xa7, 0x39, 0x86, 0x02,
+    0x00, 0xf3, 0x42, 0xee, 0xc4, 0x56, 0x13, 0x00, 0xac, 0x0e, 0x42, 0xd7, 0x00, 0x00, 0x00, 0x40,
+    0x69, 0x82, 0x69, 0x0a, 0x00, 0x00, 0x00, 0x70, 0x03, 0x90, 0x57, 0x00, 0x00, 0x00, 0x78, 0x88,
+    0x80, 0xd5, 0x01, 0x00, 0x00, 0x40, 0x1d, 0x00, 0x0a, 0x60, 0x5b, 0x08, 0x00, 0x28, 0x1b, 0x71,
+    0x3d, 0x63, 0x57, 0x00, 0x90, 0xad, 0x48, 0x3e, 0xf9, 0x10, 0xcf, 0x58, 0x8f, 0x95, 0xa2, 0xd1,
+    0x2e, 0xfa, 0xbe, 0x8e, 0x9f, 0x94, 0x40, 0x4e, 0x9f, 0x00, 0x00, 0xad, 0x90, 0x34, 0xaf, 0x86,
+    0x02, 0x00, 0xad, 0x82, 0x5c, 0x52, 0x00, 0x00, 0x00, 0x90, 0x11, 0x60, 0xb1, 0xdb, 0xc5, 0x00,
+    0x40, 0xe4, 0x23, 0xdb, 0x61, 0x39, 0x03, 0x00, 0x2c, 0x19, 0x99, 0x2a, 0xd3, 0xe2, 0xbf, 0xba,
+    0xb9, 0x50, 0xec, 0x99, 0x2b, 0x3f, 0x52, 0xd0, 0x94, 0x46, 0xca, 0xdc, 0x14, 0x00, 0x94, 0x1c,
+    0xf2, 0x34, 0x9e, 0xac, 0x00, 0x40, 0x85, 0x10, 0x57, 0x03, 0x00, 0x00, 0x00, 0x49, 0x54, 0x28,
+    0x50, 0x00, 0x00, 0x00, 0x78, 0x0b, 0x20, 0xed, 0x01, 0x00, 0x00, 0x80, 0x53, 0x04, 0x43, 0x17,
+    0x00, 0x00, 0x00, 0x68, 0x03, 0x08, 0x1b, 0x3f, 0x39, 0x00, 0x30, 0xe9, 0x08, 0x9a, 0xf8, 0x44,
+    0x02, 0x00, 0xec, 0x45, 0xd6, 0xcd, 0x62, 0xb9, 0xd4, 0x76, 0x29, 0x04, 0x9a, 0x26, 0xd6, 0xe9,
+    0x57, 0x24, 0xa1, 0xed, 0xb0, 0xf0, 0x04, 0x00, 0xe7, 0x85, 0x48, 0x93, 0x93, 0x1f, 0x00, 0x60,
+    0x13, 0xe4, 0xc0, 0x01, 0x00, 0x00, 0xc0, 0xb2, 0x04, 0xf7, 0x14, 0x00, 0x00, 0x00, 0x62, 0x07,
+    0x58, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x30, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x10, 0xdc,
+    0xc4, 0x2d, 0x0f, 0x00, 0x54, 0x36, 0x92, 0x43, 0x6e, 0xb8, 0x31, 0x4c, 0x43, 0x1d, 0x66, 0xf5,
+    0xb4, 0x7e, 0xb6, 0x1f, 0x0b, 0x19, 0x8d, 0x1b, 0x6e, 0xea, 0x23, 0x3f, 0x27, 0x0e, 0x4d, 0x67,
+    0x01, 0x40, 0x1a, 0x21, 0x03, 0x09, 0x00, 0x00, 0x00, 0x10, 0x24, 0x68, 0xd0, 0x00, 0x00, 0x00,
+    0xe0, 0x4e, 0xc0, 0x66, 0x06, 0x00, 0x00, 0x80, 0x19, 0x01, 0xd8, 0xc5, 0xd9, 0x0e, 0x00, 0x48,
+    0x3d, 0xb2, 0xed, 0x3d, 0x70, 0x00, 0xe0, 0x7a, 0x11, 0x87, 0xb5, 0xca, 0x4e, 0xbc, 0x5c, 0x2c,
+    0x51, 0x91, 0x91, 0xf0, 0x6b, 0x0d, 0x4d, 0x28, 0xde, 0x8c, 0x51, 0x01, 0x80, 0x89, 0x21, 0x31,
+    0xe3, 0x2d, 0x0a, 0x00, 0xd6, 0x07, 0xa9, 0x66, 0x00, 0x00, 0x00, 0xa0, 0x38, 0x41, 0x78, 0x05,
+    0x00, 0x00, 0x00, 0xd8, 0x01, 0x18, 0x24, 0x00, 0x00, 0x00, 0x3c, 0x45, 0x30, 0x23, 0x01, 0x00,
+    0x00, 0xa0, 0x16, 0x80, 0xf1, 0xaf, 0x21, 0x04, 0x00, 0xd4, 0x8d, 0x74, 0x9a, 0xaf, 0x27, 0x00,
+    0xc8, 0x58, 0x64, 0xa1, 0xdc, 0x88, 0x67, 0xac, 0xd7, 0x4a, 0xda, 0x68, 0x35, 0x9d, 0x75, 0x47,
+    0x50, 0x9a, 0x21, 0x07, 0x50, 0x00, 0x80, 0x5a, 0xc8, 0xe9, 0x97, 0xb7, 0x01, 0x80, 0x76, 0x41,
+    0xbe, 0x29, 0x00, 0x00, 0x00, 0xc8, 0x09, 0x90, 0xc5, 0x6d, 0x49, 0x00, 0x20, 0xfa, 0x91, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x20, 0x98, 0x85, 0x99, 0x07, 0x00, 0xb0, 0x66, 0x64, 0xa7, 0x2c,
+    0x87, 0x23, 0xe8, 0xf6, 0x42, 0x7b, 0x67, 0x93, 0xfc, 0x3c, 0xc1, 0x53, 0x32, 0x2f, 0x23, 0x58,
+    0x00, 0x50, 0x76, 0x88, 0xdd, 0x58, 0xbd, 0x02, 0x00, 0x35, 0x42, 0x7e, 0x2d, 0x00, 0x00, 0x00,
+    0xbc, 0x06, 0xf0, 0xc9, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x02, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0xf4,
+    0x01, 0xb4, 0x8a, 0xed, 0x19, 0x00, 0x98, 0x76, 0x04, 0x38, 0xdc, 0x07, 0x01, 0x00, 0x06, 0x23,
+    0xb2, 0xe6, 0xa3, 0x3c, 0x66, 0x3b, 0x15, 0x82, 0x4e, 0x5b, 0xeb, 0xfd, 0x2b, 0x96, 0xd2, 0x7c,
+    0x18, 0x82, 0x02, 0x80, 0x13, 0x43, 0x26, 0xcc, 0x78, 0x12, 0x00, 0xb0, 0x0a, 0xe2, 0xd9, 0x00,
+    0x00, 0x00, 0x60, 0x61, 0x82, 0xa8, 0x0a, 0x00, 0x00, 0x00, 0xf1, 0x03, 0x10, 0x59, 0x00, 0x00,
+    0x00, 0x80, 0x84, 0xa0, 0xee, 0x01, 0x00, 0x00, 0x80, 0x1d, 0x00, 0x77, 0x62, 0x77, 0x07, 0x00,
+    0xaa, 0x1b, 0x59, 0x1c, 0x83, 0xd8, 0xb4, 0xa0, 0xa5, 0x4e, 0xb8, 0x7a, 0x5a, 0x97, 0xda, 0xaf,
+    0x85, 0x34, 0xc7, 0x9a, 0xb7, 0x53, 0x92, 0xa0, 0x63, 0x88, 0x56, 0xb5, 0x00, 0x20, 0x95, 0x90,
+    0xd2, 0x2d, 0x24, 0x00, 0x00, 0x2e, 0x85, 0x28, 0x68, 0x00, 0x00, 0x00, 0x98, 0x13, 0x80, 0x3f,
+    0x9c, 0xc3, 0x00, 0x80, 0xe4, 0x23, 0x54, 0xde, 0x6d, 0x06, 0x00, 0x2e, 0x18, 0x51, 0x57, 0xf7,
+    0xeb, 0x4f, 0xcb, 0xc9, 0x92, 0x13, 0xf9, 0x04, 0x1f, 0xd4, 0xf0, 0x84, 0x9c, 0xce, 0x0b, 0x16,
+    0x00, 0x98, 0x19, 0x02, 0x3d, 0x3e, 0xa9, 0x00, 0x60, 0x85, 0x10, 0xf1, 0x05, 0x00, 0x00, 0x00,
+    0xca, 0x13, 0x28, 0x5c, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x20, 0xa5, 0x01, 0x00, 0x00, 0xc0, 0x63,
+    0x04, 0xdf, 0x14, 0x00, 0x00, 0x00, 0xea, 0x01, 0x80, 0xfd, 0xe2, 0x40, 0x00, 0x40, 0xe1, 0x88,
+    0x5b, 0x79, 0x2e, 0x02, 0x80, 0xac, 0x45, 0x34, 0xca, 0x93, 0xf8, 0xc4, 0x7a, 0xae, 0x54, 0x8c,
+    0xb6, 0xd3, 0xdd, 0x77, 0x0c, 0xa5, 0x31, 0x72, 0x09, 0x05, 0x00, 0xe8, 0x85, 0xd4, 0x82, 0x95,
+    0x20, 0x00, 0x68, 0x19, 0xc4, 0xa6, 0x02, 0x00, 0x00, 0x80, 0xac, 0x00, 0xfa, 0xda, 0x7b, 0x01,
+    0x00, 0x22, 0x20, 0xe1, 0x52, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00,
+    0x8b, 0x36, 0x1c, 0xca, 0x0c, 0xb8, 0x38, 0x6e, 0xb0, 0x83, 0x74, 0xb6, 0xc7, 0x39, 0x13, 0x44,
+    0xa5, 0x54, 0xf3, 0xca, 0x05, 0x00, 0xa5, 0x87, 0x44, 0x8e, 0x47, 0x6c, 0x95, 0x51, 0x25, 0xe7,
+    0x2b, 0x03, 0x00, 0x00, 0xc0, 0x7b, 0x00, 0x75, 0x09, 0x00, 0x00, 0x00, 0x9c, 0x23, 0x68, 0xc7,
+    0x00, 0x00, 0x00, 0x40, 0x23, 0x40, 0x75, 0x98, 0x63, 0x01, 0x80, 0x89, 0x47, 0x2a, 0xc2, 0x9d,
+    0x0e, 0x00, 0x60, 0x31, 0x62, 0x67, 0x1e, 0xc9, 0xfd, 0xb5, 0x5b, 0xa1, 0xf5, 0x34, 0xb1, 0xee,
+    0xbb, 0xa2, 0x29, 0x51, 0x88, 0xd5, 0x28, 0x00, 0x38, 0x33, 0xc4, 0xe3, 0xcc, 0x47, 0x01, 0x00,
+    0xbb, 0x20, 0x1a, 0x0d, 0x00, 0x00, 0x00, 0x96, 0x26, 0x48, 0xae, 0x00, 0x00, 0x00, 0x10, 0x43,
+    0x80, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x68, 0x08, 0x48, 0x27, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x70,
+    0x27, 0x06, 0x75, 0x00, 0xa0, 0xc2, 0x91, 0x65, 0x71, 0x42, 0x05, 0x00, 0x9a, 0x8a, 0xc0, 0xab,
+    0xa1, 0xf5, 0x9e, 0xfd, 0x5c, 0xe8, 0x7b, 0x6c, 0x80, 0x37, 0x29, 0x19, 0x42, 0x95, 0x68, 0x6a,
+    0x0b, 0x00, 0xd2, 0x09, 0x41, 0xe9, 0x72, 0x23, 0x00, 0xe0, 0x56, 0x88, 0x94, 0x06, 0x00, 0x00,
+    0x80, 0x59, 0x01, 0x8e, 0xc1, 0xe3, 0x07, 0x00, 0x48, 0x3f, 0x52, 0xde, 0xe5, 0x5e, 0x00, 0xe0,
+    0x8a, 0x11, 0x57, 0x75, 0xaa, 0x0e, 0xa8, 0xdc, 0x2c, 0x2d, 0x91, 0x07, 0xf0, 0x14, 0x0d, 0x51,
+    0x68, 0xf5, 0x8c, 0x6f, 0x01, 0x80, 0xa9, 0x21, 0x5a, 0xe4, 0xe4, 0x0a, 0x00, 0xd6, 0x08, 0x11,
+    0x53, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x01, 0x15, 0x06, 0x00, 0x00, 0x00, 0x18, 0x02, 0x38, 0x0a,
+    0x00, 0x00, 0x00, 0x3c, 0x47, 0xe1, 0x6f, 0x01, 0x00, 0x00, 0xa0, 0x26, 0x00, 0xb7, 0x2f, 0xf3,
+    0x03, 0x00, 0x54, 0x8e, 0xa8, 0x90, 0x11, 0x1d, 0x00, 0xc8, 0x5c, 0x24, 0xa5, 0x9c, 0x89, 0x1f,
+    0xac, 0xf7, 0x4a, 0x98, 0x68, 0x2c, 0xbd, 0x79, 0x47, 0x11, 0xb2, 0x24, 0x4b, 0x51, 0x00, 0x80,
+    0x62, 0x08, 0x67, 0xf8, 0x47, 0x02, 0x80, 0xb6, 0x41, 0x0e, 0x2b, 0x00, 0x00, 0x00, 0xc8, 0x0b,
+    0xf0, 0x95, 0x01, 0x00, 0x00, 0x20, 0x0a, 0x82, 0x60, 0x07, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x10,
+    0x83, 0x00, 0x00, 0x00, 0xb0, 0x6a, 0x23, 0x99, 0x9c, 0x77, 0x23, 0xdc, 0x16, 0x3b, 0x18, 0xe7,
+    0x67, 0x1c, 0x2c, 0xc1, 0x54, 0xea, 0x3a, 0xab, 0xe0, 0x5b, 0x55, 0x7e, 0x0e, 0xe8, 0xb8, 0xc9,
+    0x9e, 0x22, 0x75, 0x72, 0xa4, 0x37, 0x00, 0x00, 0x00, 0xbc, 0x08, 0x20, 0x55, 0x00, 0x00, 0x00,
+    0xc0, 0x41, 0x82, 0xbe, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x02, 0x28, 0x83, 0x75, 0x10, 0x00, 0x98,
+    0x7a, 0x04, 0x0e, 0x3c, 0xc9, 0x00, 0x00, 0x26, 0x23, 0x2e, 0x66, 0x78, 0xbc, 0x55, 0x3b, 0x16,
+    0xba, 0x4f, 0x77, 0xea, 0x43, 0x2b, 0x9e, 0x12, 0x91, 0x98, 0x9b, 0x02, 0x80, 0x53, 0x43, 0xe6,
+    0xcf, 0xff, 0x15, 0x00, 0xb0, 0x0c, 0x72, 0xc5, 0x00, 0x00, 0x00, 0x60, 0x71, 0x02, 0x34, 0x0b,
+    0x00, 0x00, 0x00, 0x71, 0x04, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x88, 0xe0, 0xd7, 0x02, 0x00,
+    0x00, 0x80, 0x3d, 0x00, 0x71, 0xe2, 0x24, 0x07, 0x00, 0xaa, 0x1c, 0x81, 0x0f, 0xf3, 0x4e, 0x00,
+    0xa0, 0xad, 0x08, 0xbf, 0x1a, 0x5a, 0x5f, 0xd9, 0xef, 0x85, 0x24, 0xc8, 0x51, 0x78, 0xbd, 0x92,
+    0x22, 0x84, 0x89, 0x96, 0xb7, 0x00, 0x20, 0xa5, 0x90, 0x46, 0xaf, 0x1f, 0x03, 0x00, 0xae, 0x85,
+    0x08, 0x6a, 0x00, 0x00, 0x00, 0x98, 0x17, 0xa0, 0xe9, 0x03, 0x00, 0x00, 0x80, 0x04, 0x1c, 0x8b,
+    0x5d, 0x7c, 0x05, 0x00, 0x2e, 0x19, 0xb9, 0x52, 0xa3, 0xe8, 0x2a, 0xc9, 0xd1, 0x0e, 0x12, 0x59,
+    0xfc, 0x7e, 0xce, 0x30, 0x85, 0x0a, 0xd0, 0xd9, 0x17, 0x00, 0x98, 0x1b, 0xf2, 0x4c, 0x56, 0xb2,
+    0x00, 0x60, 0x95, 0x10, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x4a, 0x14, 0x9c, 0x66, 0x00, 0x00, 0x00,
+    0x80, 0x23, 0x60, 0x15, 0x03, 0x00, 0x00, 0x40, 0x5d, 0x00, 0x14, 0xdf, 0x99, 0x07, 0x00, 0x28,
+    0x1d, 0xa1, 0x16, 0x53, 0x2b, 0x00, 0x90, 0xbd, 0x88, 0x4c, 0x99, 0x13, 0xaf, 0x57, 0x0f, 0x96,
+    0xa6, 0xd0, 0x16, 0x7a, 0xd8, 0x8e, 0x23, 0x54, 0x4d, 0xd6, 0xa4, 0x00, 0x00, 0xcd, 0x90, 0x2c,
+    0x31, 0xef, 0x04, 0x00, 0xad, 0x83, 0xfc, 0x57, 0x00, 0x00, 0x00, 0x90, 0x19, 0x40, 0xf0, 0x02,
+    0x00, 0x00, 0x40, 0x24, 0x04, 0xf4, 0x11, 0x00, 0x00, 0x00, 0xee, 0x01, 0x28, 0x04, 0x01, 0x00,
+    0x00, 0x60, 0xd9, 0x86, 0x19, 0x79, 0xd6, 0xc6, 0x9b, 0x4d, 0x76, 0xdc, 0xcd, 0xb1, 0x78, 0x4e,
+    0x82, 0xaa, 0x23, 0x80, 0x76, 0xc8, 0x75, 0xb0, 0x04, 0x1d, 0xd3, 0x31, 0x9a, 0x2d, 0x4f, 0x2a,
+    0xe5, 0x78, 0x78, 0x00, 0x00, 0x00, 0x78, 0x13, 0x20, 0x3d, 0x03, 0x00, 0x00, 0x00, 0xad, 0x00,
+    0x95, 0x5f, 0x14, 0x01, 0x00, 0x26, 0x1f, 0xb9, 0xfe, 0x4e, 0x29, 0x00, 0x80, 0xcd, 0x08, 0x78,
+    0x39, 0x16, 0xc7, 0xd1, 0xae, 0x85, 0xee, 0xd3, 0x5e, 0x3a, 0xa6, 0x8a, 0xa8, 0xd4, 0x27, 0xbe,
+    0xaa, 0x00, 0xe0, 0xdc, 0x10, 0x4f, 0x74, 0xc9, 0x05, 0x00, 0x6c, 0x83, 0xc4, 0x2c, 0x00, 0x00,
+    0x00, 0x58, 0x9e, 0xc0, 0xe5, 0x02, 0x00, 0x00, 0x40, 0x2c, 0x01, 0x65, 0x0a, 0x00, 0x00, 0x00,
+    0xa0, 0x22, 0xd0, 0xc8, 0x00, 0x00, 0x00, 0x60, 0x13, 0x80, 0x95, 0xb8, 0xb8, 0x01, 0x80, 0x4a,
+    0x47, 0x0c, 0xc2, 0x3f, 0x12, 0x00, 0x68, 0x2c, 0xf2, 0xaf, 0x56, 0xd6, 0x1b, 0xf6, 0x83, 0x21,
+    0x18, 0x32, 0x1e, 0x9e, 0xb4, 0xe4, 0x08, 0x61, 0xa2, 0x2d, 0x2e, 0x00, 0x48, 0x2b, 0x44, 0xfb,
+    0xdb, 0xf2, 0x00, 0x80, 0x7b, 0x21, 0xa6, 0x1a, 0x00, 0x00, 0x00, 0x66, 0x06, 0xb0, 0xeb, 0x00,
+    0x00, 0x00, 0x20, 0x05, 0x81, 0x51, 0xf7, 0x48, 0x01, 0x80, 0x6b, 0x46, 0xb8, 0xd3, 0x71, 0xf9,
+    0xb9, 0x71, 0xb5, 0xb3, 0x44, 0x3e, 0xbe, 0x09, 0x33, 0x54, 0xa1, 0x2c, 0x34, 0x2a, 0xfe, 0x60,
+    0x26, 0xe7, 0xc8, 0x94, 0x55, 0xed, 0xa0, 0x58, 0x27, 0xc7, 0x7b, 0x00, 0x00, 0x00, 0x80, 0x22,
+    0x15, 0x06, 0x1b, 0x00, 0x00, 0x00, 0x60, 0x09, 0xd8, 0xcf, 0x00, 0x00, 0x00, 0x50, 0x1b, 0x80,
+    0xa8, 0xd7, 0xcb, 0x01, 0x00, 0x6a, 0x47, 0xf6, 0xc2, 0x31, 0x05, 0x00, 0x64, 0x30, 0xb2, 0x53,
+    0xb6, 0xc4, 0xa9, 0xd5, 0x8b, 0xa5, 0xff, 0xb3, 0x6d, 0xde, 0xaa, 0x23, 0x09, 0x81, 0x94, 0xe9,
+    0x29, 0x00, 0x40, 0x35, 0x44, 0x5e, 0x8c, 0x4e, 0x01, 0x40, 0xfb, 0x20, 0x9b, 0x16, 0x00, 0x00,
+    0x00, 0xe4, 0x06, 0xa0, 0xaa, 0x00, 0x00, 0x00, 0x10, 0x0d, 0xc1, 0x1f, 0x05, 0x00, 0x00, 0x80,
+    0x9b, 0x00, 0x9e, 0x40, 0x00, 0x00, 0x00, 0x58, 0xb7, 0x81, 0x3e, 0x8e, 0xad, 0x00, 0x60, 0x9b,
+    0x91, 0x60, 0xb3, 0x25, 0x8e, 0x91, 0xe0, 0xea, 0x3c, 0xa2, 0x8b, 0x73, 0xfe, 0x2c, 0x43, 0x69,
+    0x74, 0x7c, 0x67, 0x6f, 0x95, 0x5a, 0x39, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x5e, 0x05, 0xb8, 0xd1,
+    0x00, 0x00, 0x00, 0x40, 0x2f, 0x80, 0x87, 0x07, 0x00, 0x00, 0x80, 0xe9, 0x07, 0xa0, 0xbe, 0xc8,
+    0x07, 0x00, 0x60, 0x34, 0x02, 0x58, 0xd6, 0xc2, 0x03, 0xb3, 0x73, 0x21, 0xf7, 0x74, 0x86, 0x2e,
+    0x9d, 0x62, 0x2a, 0xf1, 0x8a, 0xb7, 0x6b, 0x8c, 0x39, 0x39, 0xa7, 0x24, 0x6d, 0x80, 0x01, 0x00,
+    0xeb, 0x20, 0x75, 0x09, 0x00, 0x00, 0x00, 0x16, 0x28, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x10, 0x4f,
+    0xc0, 0xbd, 0x06, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x52, 0xc4, 0x0b, 0x0d, 0x00, 0x54, 0x3b, 0xd2,
+    0x00, 0x36, 0x84, 0x00, 0x40, 0x6b, 0x91, 0x7f, 0xb5, 0xaf, 0x6e, 0xae, 0x5f, 0x0c, 0xf1, 0x90,
+    0x03, 0x71, 0xac, 0x25, 0x49, 0x09, 0x13, 0xdd, 0x73, 0x01, 0x40, 0x6a, 0x21, 0x03, 0xe1, 0xa4,
+    0x08, 0x00, 0x5c, 0x0c, 0x09, 0xd6, 0x00, 0x00, 0x00, 0x30, 0x37, 0x40, 0xce, 0x06, 0x00, 0x00,
+    0x00, 0x49, 0x08, 0xde, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x80, 0x30, 0xd1, 0x05, 0x4e, 0x00, 0xe0,
+    0xa2, 0x91, 0x9e, 0x74, 0x1d, 0x5e, 0x13, 0x9c, 0xed, 0x44, 0x91, 0x6b, 0x6f, 0xa1, 0x0c, 0x57,
+    0x68, 0x13, 0x6d, 0x95, 0x0b, 0xa2, 0xd9, 0x39, 0x89, 0xe5, 0x7a, 0xfb, 0x6a, 0x56, 0xca, 0xb1,
+    0xe2, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0xc3, 0x06, 0x00, 0x00, 0x80, 0xfa, 0x00, 0x2a, 0xbc,
+    0x38, 0x0d, 0x00, 0x50, 0x3c, 0x52, 0x02, 0x02, 0x00, 0x00, 0x20, 0x8b, 0x0d, 0x9f, 0xb2, 0x22,
+    0xbe, 0xa9, 0x9e, 0x2c, 0x89, 0x9e, 0x89, 0x72, 0xe0, 0x1c, 0x4b, 0x48, 0xaf, 0xfc, 0x56, 0x01,
+    0x00, 0xba, 0x21, 0x6a, 0x63, 0xe6, 0x0a, 0x00, 0x5a, 0x08, 0x99, 0xbb, 0x00, 0x00, 0x00, 0x20,
+    0x3b, 0xc0, 0xb3, 0x04, 0x00, 0x00, 0x80, 0x88, 0x08, 0x12, 0x2d, 0x00, 0x00, 0x00, 0xdc, 0x05,
+    0x60, 0x01, 0x02, 0x00, 0x00, 0xc0, 0xc2, 0x8d, 0xa4, 0xf1, 0x19, 0x05, 0x00, 0x1b, 0x8d, 0x5c,
+    0x9a, 0x03, 0x71, 0x83, 0x04, 0x59, 0x87, 0x20, 0xfd, 0xa4, 0x97, 0x6c, 0x29, 0x4a, 0x9d, 0x63,
+    0x40, 0xbb, 0xb3, 0x54, 0xcb, 0x19, 0x11, 0xe3, 0x1f, 0x00, 0xf0, 0x2e, 0x88, 0x9a, 0x06, 0x00,
+    0x00, 0x00, 0x9a, 0x01, 0xdc, 0x38, 0x00, 0x00, 0x00, 0x4c, 0x40, 0xb0, 0xed, 0x75, 0x23, 0x00,
+    0x00, 0xab, 0x11, 0x8a, 0xf2, 0xfa, 0xfd, 0x87, 0xdd, 0xeb, 0x94, 0xa7, 0xa3, 0x73, 0x77, 0x14,
+    0x55, 0x27, 0x60, 0x5c, 0x66, 0xb3, 0xd6, 0xd9, 0x39, 0x8b, 0xe9, 0x55, 0x7c, 0x78, 0xd8, 0xc7,
+    0x29, 0x35, 0x00, 0x00, 0x00, 0xb0, 0x44, 0x41, 0x47, 0x06, 0x00, 0x00, 0x80, 0x98, 0x02, 0xca,
+    0x38, 0x00, 0x00, 0x00, 0xd8, 0x06, 0xb0, 0x1d, 0xbe, 0x5f, 0x00, 0xa0, 0xe2, 0x91, 0x88, 0xaf,
+    0xa6, 0x03, 0x00, 0x9a, 0x8b, 0xcc, 0xab, 0x59, 0xf5, 0x56, 0xfd, 0x64, 0x28, 0x87, 0xcc, 0x86,
+    0x97, 0x2c, 0x59, 0x4a, 0x98, 0x68, 0xb8, 0x0b, 0x00, 0xd2, 0x0b, 0x89, 0x10, 0xff, 0x4b, 0x00,
+    0xe0, 0x66, 0x08, 0xba, 0x06, 0x00, 0x00, 0x80, 0xd9, 0x01, 0xe4, 0x30, 0x00, 0x00, 0x00, 0x48,
+    0x43, 0x30, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x77, 0x2e, 0x58, 0x02, 0x00, 0x57, 0x8d,
+    0xc4, 0xa1, 0x4b, 0x2e, 0x00, 0xe0, 0x6e, 0xa4, 0x8b, 0x6c, 0x7a, 0x33, 0x64, 0xc8, 0x3a, 0xcb,
+    0x68, 0xf0, 0x7c, 0x44, 0x4d, 0x0f, 0x8a, 0x2e, 0xbb, 0xdc, 0x3e, 0xb4, 0x56, 0xce, 0x68, 0xb7,
+    0xd1, 0x00, 0x00, 0x98, 0x42, 0xc2, 0x37, 0x00, 0x00, 0x00, 0xd4, 0x08, 0x40, 0xd6, 0x4d, 0x5d,
+    0x00, 0x80, 0xea, 0x11, 0x6f, 0x0f, 0x00, 0x00, 0x00, 0x99, 0x0c, 0xec, 0x94, 0xe5, 0x70, 0x22,
+    0xf5, 0x66, 0x89, 0xe7, 0x6c, 0x8c, 0x6b, 0xe2, 0x68, 0x3a, 0xdd, 0x65, 0xfe, 0x0a, 0x00, 0x50,
+    0x0e, 0x39, 0x1e, 0xf7, 0xd9, 0x53, 0xd4, 0x46, 0xce, 0x1b, 0x06, 0x00, 0x00, 0x00, 0xf9, 0x01,
+    0xa4, 0x1f, 0x00, 0x00, 0x00, 0x44, 0x45, 0x90, 0x83, 0x01, 0x00, 0x00, 0xe0, 0x36, 0x00, 0xe7,
+    0x0f, 0x00, 0x00, 0x00, 0x56, 0x6e, 0x3c, 0x8a, 0xb1, 0x25, 0x00, 0xd8, 0x6a, 0xa4, 0xcd, 0x9c,
+    0x86, 0xc7, 0x23, 0xd8, 0x3a, 0x5e, 0x69, 0x53, 0xbd, 0x79, 0xcb, 0x51, 0xba, 0x1c, 0x1b, 0xda,
+    0xd6, 0xa5, 0x5e, 0xce, 0xf4, 0xf8, 0xae, 0x01, 0x80, 0x97, 0x41, 0x28, 0x35, 0x00, 0x00, 0x00,
+    0xd0, 0x0d, 0x70, 0xa6, 0x01, 0x00, 0x00, 0x60, 0x0a, 0x82, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x98,
+    0x6d, 0x58, 0x92, 0xb1, 0x6e, 0x78, 0xeb, 0x60, 0x27, 0x3b, 0x9d, 0x98, 0x13, 0xa0, 0xb8, 0x3a,
+    0x49, 0xe3, 0x74, 0xdb, 0xed, 0x4e, 0xcf, 0x99, 0x4e, 0x83, 0xe4, 0x1b, 0xc6, 0x42, 0x4e, 0x8f,
+    0x06, 0x00, 0x00, 0x80, 0xb8, 0x02, 0x0a, 0x3b, 0x00, 0x00, 0x00, 0xd8, 0x07, 0xc0, 0x16, 0x46,
+    0x53, 0x00, 0xa0, 0xea, 0x11, 0x06, 0xaf, 0x19, 0x03, 0x00, 0xda, 0x8b, 0x78, 0xab, 0x1d, 0x75,
+    0x2b, 0xfd, 0x66, 0xe8, 0x84, 0xcc, 0x83, 0xe7, 0x2a, 0x69, 0x4a, 0x9b, 0x68, 0xd6, 0x0b, 0x00,
+    0x52, 0x0c, 0x09, 0x18, 0x9f, 0x51, 0x00, 0xe0, 0x6a, 0x08, 0xc6, 0x06, 0x00, 0x00, 0x80, 0xf9,
+    0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x48, 0x44, 0x10, 0x10, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00,
+    0x6a, 0xee, 0x46, 0x02, 0x00, 0x97, 0x8d, 0xe0, 0x9d, 0xf1, 0x2a, 0x00, 0xe0, 0x70, 0x24, 0x8d,
+    0xdc, 0x79, 0x97, 0x63, 0xd8, 0x3a, 0xe0, 0x68, 0x20, 0x7d, 0x65, 0xcd, 0x0f, 0x82, 0x30, 0x6f,
+    0xdd, 0xd1, 0xb4, 0x5a, 0x4e, 0xb5, 0x97, 0x66, 0x01, 0x00, 0xb8, 0x42, 0x0c, 0x39, 0x00, 0x00,
+    0x00, 0xd4, 0x09, 0x90, 0xc8, 0x35, 0x4b, 0x00, 0x80, 0xf2, 0x11, 0xd9, 0x0e, 0x00, 0x00, 0x00,
+    0xd9, 0x0c, 0xb0, 0x94, 0x8b, 0x70, 0xdd, 0xf4, 0x68, 0xc9, 0xda, 0x5c, 0x84, 0x43, 0xdd, 0x78,
+    0x3a, 0x52, 0xe6, 0x50, 0x0b, 0x00, 0xd0, 0x0e, 0x49, 0x20, 0xfb, 0xdb, 0x8d, 0xd6, 0x4a, 0x4e,
+    0x68, 0x06, 0x00, 0x00, 0x00, 0x19, 0x02, 0x24, 0x18, 0x00, 0x00, 0x00, 0x44, 0x46, 0x10, 0x9a,
+    0x01, 0x00, 0x00, 0xe0, 0x3e, 0x80, 0xbb, 0x0f, 0x00, 0x00, 0x00, 0x96, 0x6e, 0xd0, 0x86, 0xcd,
+    0x21, 0x00, 0xd8, 0x6c, 0x04, 0xc8, 0x4c, 0x85, 0x67, 0x23, 0xe8, 0x3a, 0x97, 0x69, 0x68, 0x3d,
+    0x81, 0x4b, 0x52, 0x72, 0x1c, 0x3f, 0xda, 0x09, 0xa6, 0x62, 0x4e, 0x53, 0x99, 0x20, 0x02, 0x80,
+    0xb7, 0x41, 0x64, 0x35, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0xf0, 0x80, 0x01, 0x00, 0x00, 0x60, 0x12,
+    0x02, 0xb8, 0x05, 0x00, 0x00, 0x00, 0x39, 0x20, 0xfc, 0x78, 0x00, 0x00, 0x00, 0xc0, 0x6e, 0x00,
+    0x80, 0xec, 0x69, 0x43, 0x51, 0x17, 0x3b, 0xd0, 0x69, 0xa5, 0xfc, 0xe2, 0x44, 0xd6, 0x59, 0x1c,
+    0x93, 0xdd, 0xc7, 0x78, 0x7e, 0x8e, 0x81, 0xfa, 0x2e, 0x5f, 0x3b, 0x36, 0x72, 0xde, 0x36, 0x00,
+    0x00, 0x00, 0xc4, 0x16, 0xd0, 0xe5, 0x01, 0x00, 0x00, 0xc0, 0x46, 0x00, 0x68, 0x30, 0xfb, 0x01,
+    0x00, 0x95, 0x8f, 0x28, 0x74, 0x99, 0x13, 0x00, 0xd0, 0x60, 0x44, 0x57, 0xed, 0xa5, 0x4b, 0xe7,
+    0x47, 0x43, 0x09, 0x64, 0xfd, 0xfb, 0x42, 0xc9, 0x53, 0x52, 0x45, 0xeb, 0x5f, 0x00, 0x90, 0x66,
+    0x08, 0xf4, 0xb8, 0xb1, 0x02, 0x00, 0x77, 0x43, 0xc6, 0x36, 0x00, 0x00, 0x00, 0xcc, 0x10, 0xc0,
+    0x08, 0x01, 0x00, 0x00, 0x40, 0x2a, 0x82, 0x54, 0x0a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xe4, 0x72,
+    0xb3, 0x11, 0x00, 0xb8, 0x6e, 0x44, 0xca, 0x6c, 0x35, 0x01, 0x00, 0x97, 0x23, 0x7b, 0x64, 0xcd,
+    0x5b, 0x19, 0x43, 0xd7, 0xe9, 0x46, 0xcf, 0xe9, 0xc4, 0x6b, 0x82, 0x90, 0x91, 0x39, 0xef, 0xce,
+    0xa8, 0xf5, 0x72, 0xe4, 0xbf, 0x5b, 0x0e, 0x00, 0xc0, 0x16, 0x12, 0xd0, 0x01, 0x00, 0x00, 0xa0,
+    0x56, 0x80, 0xc0, 0x2d, 0x6b, 0x01, 0x00, 0xd4, 0x8f, 0x6c, 0x15, 0x00, 0x00, 0x00, 0xd0, 0x01,
+    0x81, 0x94, 0x03, 0x00, 0x00, 0x40, 0x46, 0x03, 0x11, 0xe5, 0x01, 0xdc, 0x1d, 0xbd, 0xda, 0x99,
+    0x33, 0x13, 0xdf, 0xca, 0x35, 0xa2, 0x4e, 0xb3, 0xf9, 0xe9, 0x02, 0x00, 0xd4, 0x43, 0x78, 0xc8,
+    0x5e, 0x77, 0xf7, 0xb5, 0x93, 0xd3, 0xaf, 0x01, 0x00, 0x00, 0x40, 0x8e, 0x00, 0x5d, 0x03, 0x00,
+    0x00, 0x00, 0xd1, 0x51, 0x1c, 0x6b, 0x00, 0x00, 0x00, 0xb8, 0x11, 0x40, 0xe0, 0x03, 0x00, 0x00,
+    0x80, 0xb5, 0x03, 0xc7, 0xe0, 0x45, 0x07, 0x00, 0xb6, 0x1b, 0x51, 0x30, 0xcf, 0xe0, 0xac, 0x08,
+    0xbe, 0x8e, 0x6c, 0x5a, 0x59, 0xe7, 0xde, 0xb2, 0x84, 0x10, 0xc7, 0x9b, 0xf6, 0x92, 0xa9, 0x99,
+    0x43, 0x69, 0x56, 0x9d, 0x00, 0xe0, 0x75, 0x10, 0x68, 0x0d, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x08,
+    0x55, 0x00, 0x00, 0x00, 0x98, 0x86, 0x60, 0x28, 0x02, 0x00, 0x00, 0x40, 0x1e, 0x00, 0x0f, 0x1e,
+    0x00, 0x00, 0x00, 0x30, 0x1c, 0x90, 0x1a, 0xdf, 0x56, 0x00, 0xd0, 0xc9, 0x48, 0x73, 0xfa, 0x22,
+    0xff, 0x31, 0xb1, 0x75, 0x94, 0xc7, 0xd0, 0xb7, 0x74, 0x9e, 0xa0, 0x74, 0xa2, 0x9e, 0xcd, 0x87,
+    0x90, 0x95, 0x9c, 0x53, 0xae, 0xc3, 0x01, 0x00, 0xf1, 0x85, 0xf0, 0x7b, 0x00, 0x00, 0x00, 0xb0,
+    0x13, 0x23, 0x00, 0xcc, 0x27, 0x00, 0x40, 0xf5, 0x23, 0x14, 0xdc, 0x43, 0x03, 0x00, 0xb4, 0x18,
+    0x51, 0x54, 0x67, 0xe8, 0x0f, 0xf9, 0xd5, 0x4e, 0xf9, 0xd8, 0xf4, 0x16, 0x4a, 0x12, 0x75, 0x72,
+    0xd1, 0x51, 0xb8, 0xf7, 0xa4, 0x9a, 0x43, 0x48, 0xbe, 0xb3, 0x79, 0xc0, 0xe5, 0x1c, 0xe0, 0x0d,
+    0x00, 0x00, 0x00, 0x73, 0x04, 0xc0, 0x27, 0x00, 0x00, 0x00, 0x90, 0x8c, 0x02, 0xf4, 0x02, 0x00,
+    0x00, 0x00, 0x4e, 0x00, 0x9e, 0xdc, 0x4b, 0x04, 0x00, 0x2e, 0x1c, 0xf9, 0x27, 0x87, 0x42, 0x00,
+    0xc0, 0xe9, 0x88, 0x22, 0x59, 0xf3, 0x7e, 0xc5, 0xf0, 0x75, 0x7e, 0xd1, 0x79, 0x7a, 0xfc, 0x9a,
+    0xa1, 0x94, 0x67, 0xbe, 0xbc, 0xa5, 0x6a, 0xc5, 0x1c, 0x77, 0xf0, 0x2f, 0x04, 0x00, 0xf0, 0x85,
+    0x90, 0x75, 0x00, 0x00, 0x00, 0xa8, 0x17, 0x60, 0x48, 0x03, 0x00, 0x00, 0x00, 0x05, 0x04, 0x8e,
+    0x0b, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x18, 0xde, 0x00, 0x00, 0x00, 0x90, 0xd5, 0x40, 0x38, 0xb9,
+    0xf3, 0x3e, 0x3d, 0xcf, 0x76, 0x32, 0xcc, 0x52, 0xf7, 0x05, 0x8d, 0xa9, 0x13, 0x75, 0x36, 0xc0,
+    0x15, 0x0a, 0xfd, 0x9c, 0x2e, 0x32, 0xe8, 0x5d, 0x8b, 0x2d, 0xe5, 0xf4, 0x71, 0x00, 0x00, 0x00,
+    0x90, 0x25, 0x40, 0x77, 0x7b, 0x62, 0x00, 0xc0, 0x9d, 0x20, 0x6f, 0x1e, 0x00, 0x00, 0x00, 0x2c,
+    0x1e, 0xe0, 0xfd, 0xf2, 0x2d, 0x00, 0xb0, 0xe1, 0x48, 0x74, 0x59, 0x02, 0x87, 0x43, 0x10, 0x76,
+    0x6a, 0xd3, 0x94, 0xba, 0xd1, 0x96, 0x26, 0x54, 0x38, 0x86, 0xb5, 0x39, 0x4d, 0xd5, 0x9c, 0xd2,
+    0xb3, 0x6b, 0x05, 0x00, 0xef, 0x83, 0xc4, 0x6b, 0x00, 0x00, 0x00, 0xa0, 0x21, 0xe0, 0x3b, 0x02,
+    0x00, 0x00, 0xc0, 0x44, 0x04, 0x51, 0x15, 0x00, 0x00, 0x00, 0x72, 0x01, 0x70, 0xef, 0x00, 0x00,
+    0x00, 0x80, 0xe5, 0x00, 0xa3, 0xb8, 0x93, 0x02, 0x80, 0x6e, 0x46, 0x94, 0xd3, 0xea, 0xb8, 0x5a,
+    0x89, 0xae, 0xd3, 0x3f, 0x26, 0xc1, 0x2b, 0xf5, 0x0c, 0x25, 0x1e, 0xb5, 0x76, 0x0e, 0x8d, 0xec,
+    0xe4, 0x7c, 0x77, 0x9d, 0x15, 0x00, 0x88, 0x31, 0x84, 0xee, 0x6b, 0x57, 0x00, 0x80, 0xad, 0x20,
+    0xf3, 0x1e, 0x00, 0x00, 0x00, 0x2a, 0x20, 0x80, 0xd9, 0x00, 0x00, 0x00, 0xa0, 0xc9, 0x80, 0x90,
+    0xda, 0x36, 0xef, 0xbe, 0xcf, 0x76, 0x76, 0xc7, 0x49, 0x37, 0x10, 0x92, 0xa9, 0xe3, 0x8c, 0xbe,
+    0xc5, 0xf5, 0x2b, 0xdd, 0x1c, 0x90, 0x32, 0xcd, 0xfd, 0x54, 0x6e, 0xe7, 0x10, 0x71, 0x00, 0x00,
+    0x00, 0x98, 0x25, 0x80, 0x40, 0x03, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x77, 0xdc, 0x18, 0x04, 0x00,
+    0xae, 0x1c, 0xc9, 0x1b, 0xf3, 0x33, 0x00, 0xc0, 0xed, 0x08, 0x27, 0x59, 0xf3, 0xa6, 0xc4, 0x10,
+    0x76, 0x06, 0xd1, 0x4c, 0x3a, 0xee, 0x9a, 0xa2, 0x64, 0x6a, 0x7e, 0xbd, 0xed, 0x6a, 0xcd, 0x9c,
+    0xe7, 0x30, 0xaa, 0x04, 0x00, 0x30, 0x86, 0xa4, 0x76, 0x00, 0x00, 0x00, 0xa8, 0x19, 0x80, 0x19,
+    0x03, 0x00, 0x00, 0x00, 0x15, 0x04, 0x7b, 0x0f, 0x00, 0x00, 0x00, 0x74, 0x01, 0x18, 0xd8, 0x00,
+    0x00, 0x00, 0x90, 0xd9, 0x00, 0x27, 0x79, 0xe2, 0xee, 0x2c, 0xef, 0x76, 0x90, 0xcb, 0xec, 0x76,
+    0x6b, 0x8c, 0xaa, 0x23, 0x7d, 0xd6, 0xc5, 0xd1, 0x0e, 0x05, 0x1d, 0x39, 0x32, 0xf4, 0xbd, 0x94,
+    0x6d, 0x25, 0x3d, 0x78, 0x00, 0x00, 0x00, 0x90, 0x27, 0xa0, 0x8f, 0x7b, 0x8c, 0x00, 0xc0, 0xad,
+    0x20, 0xac, 0x1d, 0x00, 0x00, 0x00, 0xac, 0x1e, 0x40, 0xf5, 0xfa, 0x1c, 0x00, 0xb0, 0xe5, 0x88,
+    0x64, 0x59, 0xfc, 0x86, 0x40, 0x30, 0x76, 0x3a, 0xd3, 0x37, 0xfa, 0x91, 0x96, 0x27, 0x84, 0x38,
+    0x5e, 0xb6, 0x0b, 0x4e, 0xdd, 0x9c, 0x41, 0xb4, 0xce, 0x05, 0x00, 0x2f, 0x84, 0x90, 0x6c, 0x00,
+    0x00, 0x00, 0xa0, 0x23, 0x60, 0xb0, 0x01, 0x00, 0x00, 0xc0, 0x54, 0x04, 0x72, 0x18, 0x00, 0x00,
+    0x00, 0xf2, 0x01, 0xc8, 0xee, 0x00, 0x00, 0x00, 0x80, 0xe9, 0x00, 0x6a, 0x98, 0x68, 0x02, 0x80,
+    0x8e, 0x46, 0x8e, 0xd3, 0xc6, 0xf8, 0x29, 0x89, 0xaf, 0x13, 0x42, 0x06, 0xc3, 0x33, 0xf6, 0x14,
+    0x25, 0x21, 0xb5, 0x7c, 0xde, 0x92, 0x2c, 0xe5, 0x68, 0x7c, 0x55, 0x1b, 0x00, 0x88, 0x33, 0x44,
+    0xf8, 0xeb, 0x76, 0x00, 0x80, 0xbd, 0x20, 0x9d, 0x1d, 0x00, 0x00, 0x00, 0xaa, 0x20, 0x08, 0xd3,
+    0x00, 0x00, 0x00, 0xa0, 0xcd, 0x80, 0x78, 0x9a, 0x25, 0x77, 0xaf, 0xef, 0x76, 0x22, 0xc7, 0xe6,
+    0x36, 0xc5, 0x91, 0xaa, 0x63, 0x8e, 0xee, 0xc8, 0x2b, 0x2f, 0xe5, 0x1c, 0xd5, 0x72, 0xf3, 0xed,
+    0x73, 0xae, 0xe7, 0x5c, 0x73, 0x00, 0x00, 0x00, 0x98, 0x27, 0x00, 0x81, 0x03, 0x00, 0x00, 0x00,
+    0x6e, 0x00, 0x44, 0x5c, 0xc9, 0x03, 0x00, 0x2e, 0x1d, 0x79, 0x0e, 0x0f, 0x1e, 0x00, 0xc0, 0xf1,
+    0x08, 0x2a, 0x99, 0xf2, 0x6e, 0xc3, 0x30, 0x76, 0x5e, 0xd0, 0xf8, 0xf9, 0xc7, 0x9a, 0xa3, 0x34,
+    0x6d, 0x6e, 0xbe, 0x5f, 0x6b, 0xd5, 0x1c, 0x46, 0xb1, 0x0b, 0x05, 0x00, 0x70, 0x86, 0xb8, 0x77,
+    0x00, 0x00, 0x00, 0xa8, 0x1b, 0xc0, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x25, 0x04, 0x9c, 0x12, 0x00,
+    0x00, 0x00, 0xf4, 0x01, 0x80, 0xd3, 0x00, 0x00, 0x00, 0x90, 0xdd, 0x00, 0x0f, 0x79, 0xca, 0x02,
+    0x00, 0x0f, 0x47, 0x00, 0xcb, 0x9b, 0x16, 0x00, 0x8c, 0x2b, 0x02, 0x85, 0x16, 0xcb, 0x4f, 0x12,
+    0x0d, 0x1d, 0x3f, 0xb2, 0xfb, 0xbd, 0x9a, 0xad, 0x25, 0xb5, 0x7e, 0x00, 0x00, 0x00, 0x90, 0x29,
+    0xe0, 0xa3, 0x1b, 0xa7, 0x00, 0xc0, 0xbd, 0x20, 0xc2, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x1f, 0x58,
+    0xec, 0x00, 0x00, 0x00, 0xb0, 0xe9, 0xc0, 0x51, 0xd9, 0xf4, 0x06, 0x3c, 0x50, 0x76, 0xe0, 0xd2,
+    0xb6, 0x39, 0x34, 0x96, 0xa8, 0x13, 0x39, 0x96, 0xb7, 0x07, 0x4f, 0xe5, 0x9c, 0x9b, 0x34, 0x1b,
+    0xae, 0x11, 0x6f, 0xe4, 0x98, 0x6d, 0x00, 0x00, 0x00, 0xa0, 0x25, 0x80, 0xdf, 0x00, 0x00, 0x00,
+    0xc0, 0x64, 0x14, 0xeb, 0x1a, 0x00, 0x00, 0x00, 0x72, 0x02, 0x20, 0xee, 0x00, 0x00, 0x00, 0x80,
+    0xed, 0x00, 0x2b, 0x78, 0x34, 0x02, 0x80, 0xae, 0x46, 0x8e, 0xd3, 0xab, 0xb8, 0xfa, 0x88, 0xb0,
+    0x33, 0x43, 0xf6, 0xc3, 0xab, 0xf6, 0x1c, 0xa5, 0x1f, 0x35, 0x81, 0xfe, 0x96, 0x6c, 0x05, 0x01,
+    0x81, 0xe7, 0x1f, 0x00, 0x88, 0x35, 0x44, 0xfe, 0xdb, 0x89, 0x00, 0x80, 0xcd, 0x20, 0xea, 0x1b,
+    0x00, 0x00, 0x00, 0x2a, 0x21, 0x68, 0xcd, 0x00, 0x00, 0x00, 0xa0, 0xd1, 0xc0, 0x59, 0x5a, 0x0e,
+    0x77, 0x88, 0x0f, 0x77, 0xda, 0xc6, 0x89, 0xf6, 0x6e, 0x91, 0xab, 0xb3, 0x8f, 0x4e, 0xcc, 0xef,
+    0x31, 0xed, 0x1c, 0x0e, 0xb3, 0x10, 0xde, 0x86, 0xee, 0xe7, 0x14, 0x76, 0x83, 0x05, 0x00, 0x98,
+    0x29, 0x44, 0xb6, 0x03, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xf9, 0xdb, 0x49, 0x03, 0x00, 0xae, 0x1d,
+    0xf1, 0xff, 0x00, 0x00, 0x00, 0xc0, 0xf5, 0x40, 0x2c, 0xd9, 0xf1, 0xd6, 0xc1, 0x50, 0x76, 0x80,
+    0xcf, 0x77, 0xf9, 0x85, 0x9a, 0xa4, 0x34, 0x70, 0x76, 0xbf, 0xdd, 0x6b, 0xdd, 0x9c, 0x95, 0xb1,
+    0x59, 0x05, 0x00, 0xb0, 0x86, 0xc0, 0x78, 0x00, 0x00, 0x00, 0xa8, 0x1d, 0x20, 0x9b, 0x02, 0x00,
+    0x00, 0x00, 0x35, 0x04, 0x24, 0x15, 0x00, 0x00, 0x00, 0x74, 0x02, 0x08, 0xd0, 0x00, 0x00, 0x00,
+    0x90, 0xe1, 0x40, 0xf0, 0xb8, 0xab, 0x02, 0x00, 0x2f, 0x47, 0x88, 0xca, 0x56, 0x16, 0x00, 0x8c,
+    0x2c, 0xf2, 0x8b, 0x96, 0xcf, 0xe3, 0x14, 0x15, 0x21, 0x42, 0x32, 0x00, 0xde, 0x9e, 0xed, 0x25,
+    0x21, 0x85, 0x4b, 0x01, 0x00, 0x90, 0x2b, 0xa4, 0xb3, 0xeb, 0xb8, 0x00, 0xc0, 0xcd, 0x20, 0x9c,
+    0x1b, 0x00, 0x00, 0x00, 0xac, 0x1f, 0x70, 0xe3, 0x00, 0x00, 0x00, 0xb0, 0xed, 0x00, 0x3c, 0xb9,
+    0xea, 0x5e, 0x35, 0x70, 0x76, 0x68, 0xd2, 0x1a, 0x39, 0xb0, 0x95, 0xa9, 0x03, 0x3a, 0x16, 0xb9,
+    0x33, 0x50, 0xed, 0x1c, 0xdf, 0x34, 0x54, 0xce, 0x69, 0xaf, 0xe4, 0x0c, 0x6f, 0x91, 0x03, 0x00,
+    0xa0, 0x27, 0x24, 0x9d, 0x03, 0x00, 0x00, 0x40, 0x5e, 0x00, 0xa6, 0x1d, 0x00, 0x00, 0x00, 0x30,
+    0x1e, 0xa8, 0xfc, 0xc6, 0x3e, 0x00, 0xd0, 0xd9, 0x08, 0x71, 0x7a, 0x12, 0x9f, 0x19, 0x31, 0x76,
+    0x6c, 0xc8, 0x7e, 0xf8, 0xd3, 0x9e, 0x24, 0x64, 0xa3, 0x56, 0xd0, 0x3f, 0x93, 0xb5, 0x20, 0xad,
+    0x30, 0x7a, 0x04, 0x00, 0xf1, 0x86, 0x28, 0x80, 0xbb, 0x12, 0x00, 0xb0, 0x1b, 0xa4, 0x38, 0x03,
+    0x00, 0x00, 0x40, 0x35, 0x04, 0x41, 0x07, 0x00, 0x00, 0x00, 0x76, 0x40, 0xb8, 0xc8, 0x00, 0x00,
+    0x00, 0xa0, 0xd5, 0x00, 0x32, 0x9a, 0xef, 0x02, 0x80, 0x2f, 0x47, 0x98, 0xc6, 0x2f, 0xf6, 0x05,
+    0x91, 0xac, 0xd3, 0x90, 0x36, 0xcf, 0x23, 0x34, 0xf5, 0xa4, 0x3f, 0xf3, 0x27, 0xfe, 0x93, 0x2e,
+    0xe8, 0x14, 0x79, 0xeb, 0x0f, 0x00, 0x98, 0x2b, 0xe4, 0xe2, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x00,
+    0x96, 0xdb, 0x71, 0x02, 0x00, 0x2e, 0x1e, 0xa9, 0xf0, 0x00, 0x00, 0x00, 0xc0, 0xf9, 0x00, 0x2d,
+    0x39, 0xef, 0x06, 0xbf, 0x70, 0x76, 0x7e, 0xce, 0xd8, 0x78, 0x27, 0x9a, 0xa5, 0x63, 0x73, 0xc6,
+    0xc0, 0xaf, 0x6c, 0xe5, 0x1c, 0xd6, 0x31, 0x97, 0x8d, 0x34, 0xf0, 0xe6, 0xec, 0x79, 0x00, 0x00,
+    0x00, 0xa8, 0x1f, 0x60, 0x46, 0x02, 0x00, 0x00, 0x00, 0x45, 0x04, 0x4f, 0x17, 0x00, 0x00, 0x00,
+    0xf4, 0x02, 0x68, 0xcd, 0x00, 0x00, 0x00, 0x90, 0xe5, 0xc0, 0xc7, 0x78, 0x82, 0x02, 0x00, 0x4f,
+    0x47, 0x1c, 0xca, 0x26, 0x16, 0x00, 0x8c, 0x2d, 0xf2, 0x91, 0x26, 0xd3, 0xb1, 0x16, 0x1d, 0x21,
+    0x42, 0x72, 0x02, 0xae, 0xa1, 0x2d, 0x26, 0x45, 0x8b, 0x77, 0x14, 0x00, 0x90, 0x2d, 0x04, 0xc0,
+    0x4b, 0xc5, 0x00, 0xc0, 0xdd, 0x20, 0x31, 0x1a, 0x00, 0x00, 0x00, 0x2c, 0x20, 0xb8, 0xda, 0x00,
+    0x00, 0x00, 0xb0, 0xf1, 0x40, 0x23, 0xf9, 0xdd, 0x0e, 0x2b, 0x90, 0x76, 0xde, 0xd1, 0x6c, 0x78,
+    0xd7, 0x94, 0xaa, 0x83, 0x3b, 0xde, 0xba, 0x6b, 0x51, 0xf5, 0x1c, 0x12, 0xb5, 0x7c, 0x4e, 0x8c,
+    0xef, 0xe4, 0xd4, 0x70, 0xe5, 0x09, 0x00, 0xa0, 0x29, 0xe4, 0xd0, 0x03, 0x00, 0x00, 0x40, 0x6e,
+    0x00, 0x7c, 0x1d, 0x00, 0x00, 0x00, 0xb0, 0x1e, 0x48, 0xf3, 0x4e, 0x35, 0x00, 0xd0, 0xdd, 0x08,
+    0x6e, 0xba, 0x0e, 0x87, 0x10, 0x51, 0x76, 0x4e, 0xc8, 0x5d, 0x78, 0xc0, 0x9e, 0x25, 0x44, 0xa2,
+    0x86, 0xd0, 0x8d, 0x93, 0xbd, 0x20, 0x2e, 0x31, 0xe3, 0x04, 0x00, 0x31, 0x87, 0x64, 0x80, 0xf9,
+    0x13, 0x00, 0xb0, 0x1d, 0xa4, 0xe1, 0x02, 0x00, 0x00, 0x40, 0x45, 0x04, 0xec, 0x0d, 0x00, 0x00,
+    0x00, 0xf6, 0x00, 0xf8, 0xc4, 0x00, 0x00, 0x00, 0xa0, 0xd9, 0xc0, 0xff, 0xf9, 0xc5, 0x02, 0x80,
+    0x4f, 0x47, 0x6e, 0xc6, 0xe1, 0x75, 0x77, 0x90, 0xad, 0x33, 0x91, 0xa6, 0xd1, 0xe5, 0x35, 0xfd,
+    0xa4, 0x69, 0x33, 0x39, 0xce, 0x9c, 0x6e, 0x08, 0x51, 0x7c, 0x57, 0x16, 0x00, 0x98, 0x2d, 0xe4,
+    0x06, 0x04, 0x00, 0x00, 0x00, 0x9e, 0x18, 0x12, 0x1b, 0x00, 0x00, 0x00, 0xae, 0x1e, 0x58, 0xe0,
+    0x00, 0x00, 0x00, 0xc0, 0xfd, 0x40, 0x2c, 0xd9, 0xeb, 0x2e, 0xbb, 0x90, 0x76, 0x58, 0xcd, 0x15,
+    0x78, 0x9d, 0x99, 0xa6, 0xc3, 0x76, 0x76, 0xc2, 0xbd, 0x6d, 0xed, 0x9c, 0x07, 0x72, 0xc6, 0x7d,
+    0x6b, 0x30, 0xe7, 0x60, 0x7b, 0x00, 0x00, 0x00, 0xa8, 0x21, 0x00, 0xdd, 0x01, 0x00, 0x00, 0x00,
+    0x55, 0x04, 0x26, 0x19, 0x00, 0x00, 0x00, 0x74, 0x03, 0x28, 0xcb, 0x00, 0x00, 0x00, 0x90, 0xe9,
+    0x40, 0x96, 0xb8, 0x4e, 0x02, 0x00, 0x6f, 0x47, 0xc2, 0xc9, 0xff, 0x15, 0x00, 0x8c, 0x2e, 0xa2,
+    0x96, 0x96, 0xd5, 0xc5, 0x17, 0x25, 0xa1, 0x40, 0xf2, 0x03, 0x8e, 0xa3, 0x6d, 0x26, 0x21, 0x91,
+    0xf9, 0x1c, 0x00, 0x90, 0x2f, 0xc4, 0xc9, 0x1b, 0xce, 0x00, 0xc0, 0xed, 0x20, 0x75, 0x18, 0x00,
+    0x00, 0x00, 0xac, 0x20, 0xb0, 0x28, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x82, 0x94, 0x06, 0x00, 0x00,
+    0x80, 0xad, 0x07, 0x30, 0xc8, 0x6b, 0x76, 0xc2, 0x80, 0xb5, 0x43, 0x8a, 0x96, 0xbd, 0x00, 0xa0,
+    0x5c, 0x91, 0xe9, 0xb1, 0xe6, 0x7d, 0x95, 0xea, 0x07, 0xb1, 0xa9, 0xc9, 0xf4, 0x05, 0x7d, 0x29,
+    0x69, 0x99, 0x8b, 0x76, 0x00, 0x00, 0x5d, 0x21, 0xcb, 0x5f, 0x66, 0x03, 0x00, 0xf2, 0x03, 0xb9,
+    0xe9, 0x00, 0x00, 0x00, 0x80, 0xf9, 0x00, 0x4a, 0x57, 0x49, 0x01, 0x80, 0x0e, 0x47, 0x4c, 0xd3,
+    0x51, 0x18, 0x00, 0x88, 0x33, 0x32, 0x40, 0xde, 0xc0, 0xcb, 0xf4, 0x34, 0x21, 0x09, 0xb5, 0x85,
+    0xde, 0x9e, 0x2c, 0x06, 0x31, 0x8d, 0xef, 0x29, 0x00, 0x88, 0x3b, 0x24, 0x03, 0xbc, 0xa6, 0x00,
+    0x80, 0xfd, 0x20, 0x8f, 0x13, 0x00, 0x00, 0x00, 0xaa, 0x22, 0x60, 0x93, 0x00, 0x00, 0x00, 0xb0,
+    0x0b, 0x80, 0x10, 0x06, 0x00, 0x00, 0x00, 0xed, 0x06, 0x18, 0xce, 0x8b, 0x14, 0x00, 0x7c, 0x3b,
+    0x82, 0x32, 0x16, 0xad, 0x00, 0x80, 0x74, 0x91, 0x86, 0xf4, 0x99, 0xee, 0xb8, 0x29, 0x28, 0x85,
+    0x9c, 0x3b, 0x72, 0x19, 0x75, 0x45, 0x68, 0xfc, 0x0b, 0xdb, 0x00, 0xc0, 0x7c, 0x21, 0x2a, 0xe1,
+    0x98, 0x02, 0x00, 0x70, 0x05, 0x21, 0xd3, 0x00, 0x00, 0x00, 0x70, 0xf9, 0x00, 0x83, 0x01, 0x00,
+    0x00, 0x80, 0x1e, 0x10, 0xfc, 0x33, 0x00, 0x00, 0x00, 0x70, 0x40, 0xf0, 0x49, 0x76, 0xb9, 0x3f,
+    0x2d, 0xac, 0x1d, 0x08, 0x33, 0xd0, 0x4d, 0x2c, 0xe6, 0xe9, 0xac, 0x9e, 0x27, 0x71, 0xc6, 0x5b,
+    0x3d, 0x47, 0x8b, 0x6c, 0x7a, 0x0b, 0x22, 0xdc, 0x39, 0x53, 0x1f, 0x00, 0x00, 0x00, 0xea, 0x08,
+    0x98, 0x52, 0x00, 0x00, 0x00, 0x40, 0x19, 0xc1, 0xae, 0x06, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x4c,
+    0x32, 0x00, 0x00, 0x00, 0x64, 0x3b, 0xc0, 0x16, 0xce, 0x82, 0x00, 0xc0, 0xe3, 0x11, 0x5a, 0x72,
+    0x78, 0x05, 0x00, 0xe3, 0x8b, 0x5c, 0xa6, 0xa1, 0xf5, 0x04, 0x46, 0x4b, 0x69, 0x8f, 0x2c, 0x81,
+    0x2b, 0x69, 0xab, 0x49, 0x9e, 0xe5, 0xd4, 0x08, 0x00, 0x64, 0x0c, 0x39, 0xf4, 0xee, 0x34, 0x00,
+    0x70, 0x3f, 0x08, 0x97, 0x05, 0x00, 0x00, 0x00, 0x4b, 0x08, 0xca, 0x1a, 0x00, 0x00, 0x00, 0xf0,
+    0x01, 0xb0, 0x96, 0x01, 0x00, 0x00, 0x60, 0xf3, 0x01, 0xc7, 0xb1, 0x71, 0x05, 0x00, 0xa0, 0x8d,
+    0x70, 0xa1, 0xf7, 0x2d, 0x00, 0x28, 0x59, 0xc4, 0x7d, 0x9c, 0x7d, 0xc3, 0xa7, 0x0a, 0x42, 0x99,
+    0x6a, 0x59, 0x5d, 0x5b, 0xdf, 0x4a, 0x9a, 0xeb, 0xfa, 0x25, 0x00, 0x40, 0x5b, 0xc8, 0x34, 0xd8,
+    0x5c, 0x01, 0x80, 0x1c, 0x41, 0x9c, 0x39, 0x00, 0x00, 0x00, 0x60, 0x3f, 0x50, 0xbd, 0x3d, 0x2e,
+    0x00, 0xa0, 0xcb, 0x11, 0xc4, 0xb4, 0x07, 0x06, 0x00, 0x22, 0x8d, 0x40, 0x8f, 0x77, 0x6f, 0xbc,
+    0x3c, 0x4f, 0xa8, 0x3f, 0xfd, 0xa1, 0x77, 0x28, 0x9b, 0x41, 0x1e, 0xe4, 0x11, 0x0b, 0x00, 0x62,
+    0x0f, 0xc9, 0x00, 0x83, 0x2b, 0x00, 0x60, 0x43, 0xc8, 0xae, 0x03, 0x00, 0x00, 0x80, 0xca, 0x08,
+    0x04, 0x2c, 0x00, 0x00, 0x00, 0xec, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x40, 0xc3, 0x81, 0xf1,
+    0x72, 0x97, 0x04, 0x00, 0x1f, 0x8f, 0x88, 0x8c, 0xe5, 0x2a, 0x00, 0x20, 0x5f, 0x44, 0x1e, 0xfd,
+    0xa7, 0x8b, 0x6f, 0x1a, 0x4a, 0x63, 0xe7, 0xa3, 0x9c, 0x4e, 0xdd, 0x11, 0x92, 0x05, 0x63, 0x3f,
+    0x00, 0x30, 0x63, 0x48, 0x7b, 0xb8, 0x04, 0x01, 0x00, 0x7c, 0x41, 0x12, 0x33, 0x00, 0x00, 0x00,
+    0x5c, 0x3f, 0x80, 0xac, 0x00, 0x00, 0x00, 0xa0, 0x0f, 0x80, 0xf5, 0x0b, 0x00, 0x00, 0x00, 0x5c,
+    0x10, 0x10, 0x92, 0xd3, 0x6d, 0xb8, 0x0a, 0x6d, 0x27, 0xae, 0xcc, 0x65, 0x01, 0x80, 0x89, 0x22,
+    0xf0, 0xe7, 0x70, 0x3c, 0x09, 0xd7, 0xcf, 0x69, 0x24, 0x27, 0xe0, 0xa2, 0x09, 0x7b, 0x90, 0xf9,
+    0x07, 0x00, 0x00, 0x80, 0x5a, 0x02, 0x22, 0xb8, 0x1f, 0x08, 0x00, 0xe8, 0x08, 0x12, 0x8e, 0x01,
+    0x00, 0x00, 0x20, 0xe3, 0x01, 0x29, 0x70, 0x65, 0x03, 0x00, 0x5e, 0x8f, 0x28, 0x92, 0x93, 0x2b,
+    0x00, 0x18, 0x61, 0xc4, 0x34, 0xed, 0xab, 0x07, 0x2f, 0x6a, 0x4a, 0x75, 0x64, 0x09, 0xdc, 0x4a,
+    0xdb, 0x4d, 0x82, 0x36, 0x8b, 0x50, 0x00, 0x20, 0x67, 0x08, 0xad, 0x57, 0xaf, 0x01, 0x80, 0x1b,
+    0x42, 0x90, 0x27, 0x00, 0x00, 0x00, 0x58, 0x43, 0xb0, 0x24, 0x01, 0x00, 0x00, 0x80, 0x17, 0x80,
+    0x4c, 0x0c, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0xbc, 0x8b, 0xef, 0x29, 0x00, 0x00, 0x6f, 0x44, 0x03,
+    0xad, 0x64, 0x01, 0x40, 0xd9, 0x22, 0x0c, 0xe4, 0x0a, 0xbc, 0x4f, 0xd5, 0x10, 0xa2, 0x55, 0x7f,
+    0xeb, 0x58, 0xfb, 0x5a, 0x52, 0x8e, 0x77, 0x71, 0x01, 0x00, 0xfa, 0x42, 0x3e, 0xc3, 0x56, 0x0d,
+    0x00, 0xe4, 0x09, 0x22, 0xc3, 0x01, 0x00, 0x00, 0x00, 0x03, 0x02, 0x3b, 0x0d, 0x00, 0x00, 0x00,
+    0x9d, 0x0e, 0x78, 0xa5, 0xbf, 0x2f, 0x00, 0x10, 0x6b, 0xc4, 0x71, 0xac, 0x73, 0x8b, 0xe0, 0x89,
+    0x3a, 0xe5, 0x69, 0x14, 0x7d, 0x4a, 0x59, 0x0d, 0xc2, 0x26, 0x67, 0xdc, 0x10, 0x15, 0x7f, 0xce,
+    0x07, 0xd8, 0x6b, 0x01, 0x00, 0x3b, 0x42, 0xf6, 0x0c, 0x00, 0x00, 0x00, 0x54, 0x47, 0xc1, 0x8f,
+    0x01, 0x00, 0x00, 0x60, 0x27, 0x80, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x0e, 0x28, 0x92, 0x15,
+    0x1f, 0x00, 0xf8, 0x7a, 0x44, 0x64, 0xbc, 0x54, 0x01, 0x00, 0x09, 0x23, 0xc2, 0x68, 0x38, 0xbd,
+    0x7c, 0x53, 0x11, 0xfa, 0x3c, 0xa3, 0xe5, 0xa4, 0xea, 0x92, 0x10, 0x5e, 0xb8, 0x36, 0x02, 0x80,
+    0x39, 0x43, 0x12, 0xc5, 0xdb, 0x09, 0x00, 0xe0, 0x0c, 0x82, 0x87, 0x01, 0x00, 0x00, 0xe0, 0x02,
+    0x82, 0x21, 0x07, 0x00, 0x00, 0x00, 0xbd, 0x00, 0xb4, 0x57, 0x00, 0x00, 0x00, 0xe0, 0x84, 0xe0,
+    0x8a, 0x6c, 0x68, 0xdb, 0x4c, 0x78, 0x3b, 0xd8, 0x64, 0xbc, 0x0a, 0x00, 0xcc, 0x14, 0xd9, 0x41,
+    0xef, 0xe4, 0x15, 0xb9, 0x82, 0x8e, 0x2b, 0x79, 0x09, 0xcf, 0x52, 0xf8, 0x83, 0x34, 0x41, 0x00,
+    0x00, 0x00, 0xd4, 0x93, 0x41, 0xd3, 0x95, 0x5a, 0x00, 0x40, 0x4f, 0x10, 0x42, 0x0c, 0x00, 0x00,
+    0x00, 0x59, 0x0f, 0x38, 0x7c, 0x45, 0x13, 0x00, 0xf0, 0x7c, 0xa4, 0x8b, 0x1c, 0x5b, 0x01, 0xc0,
+    0x18, 0x23, 0x97, 0xe9, 0x3c, 0xdd, 0x5f, 0xd1, 0x53, 0x62, 0x23, 0x4b, 0xe0, 0x62, 0xda, 0x72,
+    0xd2, 0xf6, 0x19, 0xc4, 0x02, 0x00, 0x59, 0x43, 0xaa, 0xbd, 0x9b, 0x0d, 0x00, 0xdc, 0x11, 0x02,
+    0x08, 0x01, 0x00, 0x00, 0xc0, 0x22, 0x02, 0x0a, 0x0b, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xd0, 0x5f,
+    0x00, 0x00, 0x00, 0xd8, 0x80, 0x00, 0x47, 0x2c, 0x3f, 0x01, 0x00, 0x88, 0x23, 0xde, 0x67, 0xd4,
+    0x0a, 0x00, 0x4a, 0x17, 0x21, 0x21, 0x23, 0xe1, 0xec, 0xaa, 0x8a, 0x10, 0xb0, 0xfa, 0x5e, 0x37,
+    0xdd, 0xf7, 0x92, 0x10, 0xbe, 0x6e, 0x0d, 0x00, 0xd0, 0x18, 0xb2, 0x23, 0x66, 0x78, 0x00, 0x20,
+    0x57, 0x10, 0xb0, 0x0d, 0x00, 0x00, 0x00, 0x58, 0x10, 0x5c, 0x64, 0x00, 0x00, 0x00, 0xe8, 0x76,
+    0x80, 0x23, 0xcd, 0x77, 0x01, 0x80, 0x68, 0x23, 0x40, 0xe3, 0x53, 0x1b, 0xc9, 0xce, 0xd4, 0x69,
+    0x4e, 0xdf, 0xe8, 0x92, 0xca, 0x6e, 0x90, 0x5e, 0x59, 0xfc, 0xde, 0xbc, 0x18, 0x74, 0x5c, 0xc0,
+    0xfd, 0x0b, 0x00, 0xd8, 0x12, 0x42, 0xb8, 0x01, 0x00, 0x00, 0x60, 0x2f, 0x00, 0xd6, 0x0b, 0x00,
+    0x00, 0x00, 0x9a, 0x0e, 0xbc, 0x8b, 0xe7, 0x16, 0x00, 0xf8, 0x7c, 0x64, 0x65, 0x3c, 0x53, 0x01,
+    0x00, 0x19, 0x23, 0x7a, 0x68, 0x1d, 0xdd, 0x71, 0xd3, 0x11, 0xaa, 0x3e, 0x1b, 0xe6, 0xc5, 0xea,
+    0x96, 0xd0, 0x8b, 0xb8, 0x69, 0x02, 0x80, 0x59, 0x43, 0x02, 0xc6, 0xf2, 0x0a, 0x00, 0xe0, 0x0d,
+    0x52, 0x72, 0x01, 0x00, 0x00, 0xe0, 0x0a, 0x02, 0x97, 0x08, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x10,
+    0x50, 0x00, 0x00, 0x00, 0xe0, 0x86, 0x00, 0x83, 0x2c, 0x60, 0x01, 0x40, 0x88, 0x23, 0x42, 0x64,
+    0x4d, 0x0a, 0x00, 0x4c, 0x15, 0x31, 0x44, 0x6f, 0xe6, 0xe4, 0xb9, 0x86, 0x12, 0x30, 0xb9, 0x0e,
+    0x77, 0x56, 0x18, 0x84, 0xd2, 0x42, 0x00, 0x00, 0x00, 0xd4, 0x94, 0xd1, 0xe2, 0x1d, 0x6c, 0x00,
+    0x40, 0x57, 0x10, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x99, 0x0f, 0x74, 0x76, 0x00, 0x00, 0x00, 0xf0,
+    0x7e, 0xa0, 0x85, 0x0c, 0x59, 0x01, 0xc0, 0x28, 0x23, 0x64, 0xe9, 0xfd, 0x5c, 0x34, 0x51, 0x54,
+    0x1a, 0x23, 0x57, 0xe0, 0x71, 0xda, 0x76, 0x52, 0x2e, 0x5a, 0xf6, 0x02, 0x00, 0x79, 0x43, 0xec,
+    0xbd, 0xc5, 0x0d, 0x00, 0xdc, 0x12, 0xe2, 0xc1, 0x00, 0x00, 0x00, 0xc0, 0x2a, 0x82, 0x8b, 0x0c,
+    0x00, 0x00, 0x00, 0x3c, 0x01, 0x9c, 0x5d, 0x00, 0x00, 0x00, 0xd8, 0x82, 0x00, 0x2c, 0xec, 0x2a,
+    0x01, 0x00, 0x98, 0x23, 0xab, 0xe7, 0x8d, 0x0a, 0x00, 0xca, 0x17, 0xb1, 0x21, 0xb3, 0xe1, 0x37,
+    0xab, 0x8e, 0x10, 0xb0, 0x1a, 0x60, 0x6f, 0xde, 0x17, 0x93, 0xde, 0xbf, 0x45, 0x0f, 0x00, 0xd0,
+    0x19, 0xd2, 0x2a, 0xde, 0x81, 0x00, 0x20, 0x5f, 0x10, 0x23, 0x0d, 0x00, 0x00, 0x00, 0x98, 0x10,
+    0xc8, 0x5e, 0x00, 0x00, 0x00, 0xe8, 0x78, 0x60, 0x19, 0xed, 0x6f, 0x01, 0x80, 0x78, 0x23, 0xe9,
+    0xe2, 0xff, 0x7a, 0x66, 0x4e, 0xd5, 0xa9, 0x4d, 0x27, 0xe9, 0xdd, 0xca, 0x72, 0x10, 0x81, 0xd9,
+    0x0f, 0x6f, 0xc9, 0x38, 0x74, 0x98, 0xc0, 0xb7, 0x0c, 0x00, 0xd8, 0x13, 0xf2, 0xda, 0x01, 0x00,
+    0x00, 0x60, 0x37, 0x00, 0xc4, 0x0b, 0x00, 0x00, 0x00, 0xda, 0x0e, 0x84, 0x84, 0x99, 0x07, 0x00,
+    0xf8, 0x7e, 0xe4, 0x66, 0x1c, 0x52, 0x01, 0x00, 0x29, 0x23, 0x14, 0xe8, 0xeb, 0x3c, 0x5a, 0x53,
+    0x12, 0x2a, 0x40, 0x7b, 0xe6, 0xdd, 0xea, 0x9a, 0x10, 0xb5, 0x78, 0x94, 0x02, 0x80, 0x79, 0x43,
+    0xbc, 0xc6, 0xb8, 0x0b, 0x00, 0xe0, 0x0e, 0xb2, 0x57, 0x01, 0x00, 0x00, 0xe0, 0x12, 0x82, 0xdc,
+    0x09, 0x00, 0x00, 0x00, 0x3d, 0x01, 0x44, 0x49, 0x00, 0x00, 0x00, 0xe0, 0x88, 0xc0, 0x77, 0xec,
+    0x54, 0x01, 0x40, 0x98, 0x23, 0xb8, 0x63, 0xe4, 0x09, 0x00, 0xcc, 0x15, 0xa1, 0x46, 0xe3, 0xe7,
+    0xa4, 0xba, 0x8a, 0x92, 0x31, 0x59, 0x11, 0x9f, 0x58, 0x38, 0x84, 0xb2, 0xc4, 0x7d, 0x07, 0x00,
+    0xd4, 0x15, 0xc2, 0xef, 0xdd, 0x78, 0x00, 0x40, 0x5f, 0x90, 0xb3, 0x0b, 0x00, 0x00, 0x00, 0xd9,
+    0x0f, 0x14, 0x70, 0x00, 0x00, 0x00, 0xf0, 0x80, 0x80, 0x7e, 0x3c, 0x56, 0x01, 0xc0, 0x38, 0x23,
+    0x16, 0xe9, 0xa3, 0xdc, 0xed, 0xd0, 0xd4, 0xe9, 0x22, 0x63, 0xe0, 0x80, 0xda, 0x7a, 0x52, 0x5b,
+    0xba, 0x1d, 0x67, 0x27, 0x99, 0x73, 0x28, 0xbe, 0xe3, 0x0d, 0x00, 0xdc, 0x13, 0x62, 0x45, 0x00,
+    0x00, 0x00, 0xc0, 0x32, 0x8a, 0xcf, 0x0d, 0x00, 0x00, 0x00, 0x7c, 0x01, 0xf8, 0x5b, 0x00, 0x00,
+    0x00, 0xd8, 0x84, 0xa0, 0x0d, 0xfc, 0x11, 0x01, 0x00, 0xa8, 0x23, 0x84, 0xe7, 0x51, 0x0a, 0x00,
+    0x4a, 0x18, 0xf9, 0x21, 0xfb, 0xe1, 0x55, 0xab, 0x92, 0x90, 0xae, 0xba, 0x5f, 0x17, 0xdf, 0x37,
+    0x93, 0xac, 0xc1, 0xf2, 0x10, 0x00, 0xd0, 0x1a, 0xe2, 0x2f, 0xce, 0x88, 0x00, 0x20, 0x67, 0x90,
+    0x67, 0x0c, 0x00, 0x00, 0x00, 0xd8, 0x10, 0x7c, 0x11, 0x00, 0x00, 0x00, 0xf0, 0x01, 0xe1, 0xcb,
+    0x02, 0x00, 0x00, 0x40, 0xd7, 0x03, 0x5c, 0x68, 0x28, 0x0b, 0x00, 0x44, 0x1c, 0x91, 0x14, 0x2f,
+    0x55, 0x00, 0x70, 0xae, 0x48, 0x67, 0x3a, 0x4c, 0x77, 0x59, 0xb6, 0x83, 0xec, 0xcc, 0xf6, 0xf8,
+    0x8b, 0xc6, 0xa2, 0x94, 0x07, 0xc6, 0x6c, 0x00, 0xc0, 0xa6, 0x10, 0xc6, 0x0f, 0x00, 0x00, 0x00,
+    0xfb, 0x61, 0x84, 0x5d, 0x00, 0x00, 0x00, 0xd0, 0x78, 0x20, 0xe2, 0x03, 0x00, 0x00, 0xc0, 0x07,
+    0x04, 0x43, 0x63, 0x89, 0x0a, 0x00, 0xc8, 0x19, 0xb1, 0x3c, 0x13, 0xe5, 0x99, 0x99, 0x96, 0x90,
+    0x0c, 0x7a, 0x36, 0x67, 0x57, 0xf7, 0x84, 0xc2, 0xc6, 0xc6, 0x15, 0x00, 0xcc, 0x1c, 0x92, 0x3a,
+    0x16, 0x62, 0x00, 0x00, 0x7f, 0x10, 0xb7, 0x09, 0x00, 0x00, 0x00, 0xd7, 0x10, 0xe4, 0x57, 0x00,
+    0x00, 0x00, 0xe8, 0x0b, 0xc0, 0x19, 0x02, 0x00, 0x00, 0x00, 0x57, 0x04, 0x46, 0xe3, 0x2d, 0x0a,
+    0x00, 0x42, 0x1d, 0x01, 0x1a, 0x3b, 0x4c, 0x00, 0x60, 0xb2, 0x08, 0x47, 0x9a, 0x49, 0x37, 0xda,
+    0x75, 0x94, 0x8c, 0xc9, 0x90, 0xf8, 0xcd, 0xc2, 0x22, 0x54, 0x35, 0x06, 0x5a, 0x00, 0xa0, 0xb6,
+    0x10, 0xd5, 0xef, 0x14, 0x04, 0x00, 0x3a, 0x83, 0x48, 0x5a, 0x00, 0x00, 0x00, 0xc8, 0x80, 0xc0,
+    0x48, 0x03, 0x00, 0x00, 0x80, 0x17, 0x04, 0xaf, 0xe3, 0x93, 0x0a, 0x00, 0x46, 0x1a, 0x51, 0x45,
+    0x77, 0xe1, 0x2a, 0x83, 0xaa, 0xce, 0x15, 0x39, 0x04, 0xdf, 0xd4, 0xf6, 0x93, 0xee, 0xd3, 0xd7,
+    0x39, 0x16, 0xca, 0x9d, 0xb3, 0xf3, 0xfd, 0x70, 0x00, 0xe0, 0xa6, 0x90, 0xda, 0x0e, 0x00, 0x00,
+    0x00, 0xbc, 0x01, 0x90, 0x5a, 0x00, 0x00, 0x00, 0xd8, 0x86, 0xc0, 0xea, 0x7b, 0xf2, 0x00, 0x00,
+    0xb8, 0x23, 0x66, 0xe7, 0x21, 0x0a, 0x00, 0xca, 0x18, 0xb1, 0x21, 0xd7, 0xe1, 0x3d, 0xab, 0x96,
+    0xd2, 0xaa, 0xfa, 0x5e, 0x47, 0xdf, 0x57, 0x93, 0x80, 0xc3, 0x87, 0x12, 0x00, 0xd0, 0x1b, 0x42,
+    0x33, 0xae, 0x8d, 0x00, 0x20, 0x6f, 0x10, 0x73, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x11, 0x48, 0x2d,
+    0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0xa3, 0x02, 0x00, 0x00, 0x40, 0xe7, 0x03, 0xcf, 0x67, 0xb6,
+    0x0a, 0x00, 0xc4, 0x1c, 0xd9, 0x11, 0x3b, 0x52, 0x00, 0x70, 0xb2, 0x88, 0x60, 0x7a, 0x4e, 0xcf,
+    0x5b, 0xd6, 0x83, 0xb2, 0xcd, 0x4d, 0xb9, 0xb6, 0xc6, 0xa3, 0x84, 0x0b, 0xa6, 0x74, 0x00, 0xc0,
+    0xae, 0x90, 0x90, 0xb0, 0xe7, 0x01, 0x00, 0x3b, 0x82, 0xb8, 0x5c, 0x00, 0x00, 0x00, 0xd0, 0x7a,
+    0x40, 0x98, 0x03, 0x00, 0x00, 0xc0, 0x17, 0x04, 0x4f, 0xe3, 0x81, 0x0a, 0x00, 0x48, 0x1a, 0xe9,
+    0x37, 0x1f, 0xe2, 0xb6, 0x97, 0x9a, 0xce, 0x17, 0x1a, 0x39, 0xf7, 0x57, 0x17, 0x85, 0xb2, 0xc7,
+    0xb3, 0xb6, 0x3f, 0xcd, 0x9d, 0x53, 0x3e, 0xa6, 0x65, 0x00, 0x00, 0x87, 0x90, 0x6b, 0x08, 0x00,
+    0x00, 0x00, 0x17, 0x11, 0xe8, 0x5f, 0x00, 0x00, 0x00, 0xe8, 0x0d, 0xe0, 0xf0, 0x01, 0x00, 0x00,
+    0x00, 0x67, 0x04, 0xad, 0x62, 0x90, 0x09, 0x00, 0xc2, 0x1d, 0xb9, 0x16, 0xcb, 0x49, 0x00, 0x60,
+    0xb6, 0xc8, 0x56, 0x3a, 0x52, 0xf7, 0xdd, 0x95, 0x94, 0x80, 0xc9, 0x90, 0xf8, 0xd0, 0xc2, 0x23,
+    0x04, 0x46, 0x7e, 0x72, 0x00, 0xa0, 0xbe, 0x90, 0x1b, 0xb0, 0x4e, 0x04, 0x00, 0x7a, 0x83, 0xbc,
+    0x55, 0x00, 0x00, 0x00, 0xc8, 0x82, 0xe0, 0x0c, 0x01, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x66, 0x18,
+    0x00, 0x00, 0x00, 0x3c, 0x21, 0xf0, 0x1a, 0x67, 0x53, 0x00, 0x30, 0xd6, 0xc8, 0x08, 0x1a, 0xe8,
+    0x02, 0x00, 0x74, 0x45, 0xa8, 0xc8, 0x2d, 0x78, 0xae, 0xb6, 0xa0, 0xa4, 0xa5, 0xe6, 0xd3, 0x6b,
+    0x54, 0xf6, 0xa0, 0xb5, 0xaf, 0x9a, 0x03, 0x00, 0x77, 0x85, 0xd0, 0x7d, 0x45, 0x0a, 0x00, 0xe0,
+    0x0f, 0x84, 0xcb, 0x02, 0x00, 0x00, 0xc0, 0x46, 0x04, 0x21, 0xde, 0x55, 0x06, 0x00, 0x40, 0x1e,
+    0x59, 0x3a, 0xbf, 0x4f, 0x00, 0x50, 0xca, 0x88, 0x07, 0xd9, 0x09, 0x1f, 0x57, 0xd5, 0x94, 0x32,
+    0xd5, 0xee, 0x3a, 0xfa, 0xbe, 0x9b, 0x14, 0x2a, 0xc6, 0x9f, 0x00, 0x80, 0xe6, 0x10, 0xa9, 0x71,
+    0x88, 0x04, 0x00, 0xb9, 0x83, 0x78, 0x51, 0x00, 0x00, 0x00, 0xc0, 0x8a, 0x60, 0xfb, 0x01, 0x00,
+    0x00, 0x80, 0x2f, 0x00, 0xfe, 0x13, 0x00, 0x00, 0x00, 0xba, 0x1f, 0xc0, 0x38, 0xdf, 0x50, 0x00,
+    0x20, 0xea, 0x88, 0x7a, 0xf8, 0x7a, 0x02, 0x80, 0xb3, 0x45, 0xc2, 0xd2, 0x82, 0x3a, 0xee, 0xb2,
+    0x1f, 0xa4, 0x72, 0x66, 0xcc, 0x8d, 0x36, 0x26, 0x25, 0x86, 0xf0, 0xea, 0x03, 0x00, 0xb6, 0x85,
+    0xe8, 0x89, 0x65, 0x17, 0x00, 0xd8, 0x13, 0xa4, 0xdb, 0x02, 0x00, 0x00, 0x80, 0xe6, 0x03, 0x2b,
+    0x1a, 0x00, 0x00, 0x00, 0x3e, 0x21, 0xa8, 0x1a, 0xbb, 0x53, 0x00, 0x40, 0xd6, 0xc8, 0x93, 0x19,
+    0xf4, 0x36, 0xa4, 0xf4, 0x74, 0x0c, 0xd1, 0xdd, 0x39, 0xc4, 0xba, 0x29, 0x64, 0x43, 0x56, 0xbb,
+    0x6d, 0x6f, 0xf6, 0x1c, 0x0c, 0x72, 0x44, 0x03, 0x00, 0x78, 0x84, 0x70, 0x35, 0x00, 0x00, 0x00,
+    0xb8, 0x8a, 0xa0, 0x38, 0x03, 0x00, 0x00, 0x40, 0x7f, 0x00, 0x8e, 0x0e, 0x00, 0x00, 0x00, 0xb8,
+    0x23, 0x68, 0x0f, 0x0b, 0x46, 0x00, 0x10, 0xf2, 0x08, 0xa0, 0x98, 0x3e, 0x02, 0x00, 0xd3, 0x45,
+    0x10, 0xd3, 0xbb, 0xba, 0xfe, 0xae, 0xa5, 0x74, 0x4b, 0x3e, 0xc4, 0x87, 0x16, 0x26, 0x21, 0xb4,
+    0x72, 0x37, 0x04, 0x00, 0x35, 0x86, 0xbc, 0x82, 0xe9, 0x23, 0x00, 0xd0, 0x1d, 0x24, 0x80, 0x02,
+    0x00, 0x00, 0x40, 0x26, 0x04, 0x83, 0x0d, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x40, 0xb3, 0x00, 0x00,
+    0x00, 0xe0, 0x0d, 0xc1, 0xbe, 0x58, 0x8d, 0x02, 0x80, 0xd1, 0x46, 0x1a, 0xcf, 0xfc, 0x15, 0x00,
+    0xa0, 0x2c, 0x42, 0x45, 0xe6, 0xc1, 0xbb, 0xb5, 0x0d, 0x25, 0x4b, 0x75, 0xb9, 0x6e, 0xb4, 0xf2,
+    0x07, 0xb5, 0x7e, 0xb9, 0x1d, 0x00, 0xb8, 0x2d, 0x44, 0x1c, 0x4c, 0xb3, 0x00, 0x00, 0x8f, 0x20,
+    0x0e, 0x16, 0x00, 0x00, 0x00, 0xb6, 0x22, 0x10, 0xe6, 0xc2, 0x24, 0x00, 0x00, 0xf6, 0xc8, 0xcc,
+    0x19, 0x76, 0x02, 0x80, 0x72, 0x46, 0xe8, 0xc7, 0x06, 0x78, 0x8d, 0xaa, 0xa7, 0x14, 0xa8, 0x16,
+    0xd7, 0xcb, 0xf7, 0xe5, 0x24, 0xbe, 0xb1, 0x50, 0x05, 0x00, 0x74, 0x87, 0x78, 0x8d, 0xd9, 0x24,
+    0x00, 0xc8, 0x1f, 0x64, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x66, 0x04, 0x8f, 0x13, 0x00, 0x00, 0x00,
+    0xfc, 0x01, 0xc8, 0x97, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x41, 0x8f, 0xd9, 0x55, 0x02, 0x00, 0x71,
+    0x47, 0x44, 0xc3, 0x26, 0x13, 0x00, 0x9c, 0x2e, 0xa2, 0x93, 0x46, 0xd4, 0xbf, 0x97, 0x05, 0x21,
+    0xb9, 0x73, 0x6e, 0x5e, 0xb8, 0x71, 0x29, 0xb1, 0x85, 0x97, 0x21, 0x00, 0xb0, 0x2f, 0xa4, 0x73,
+    0x5c, 0xe5, 0x00, 0xc0, 0xae, 0x20, 0x6e, 0x16, 0x00, 0x00, 0x00, 0xb4, 0x1f, 0xa8, 0xba, 0x00,
+    0x00, 0x00, 0xf0, 0x0d, 0x81, 0xd4, 0x58, 0x99, 0x02, 0x00, 0xd2, 0x46, 0x18, 0xcb, 0x8c, 0x16,
+    0x00, 0xa4, 0x28, 0x02, 0x8b, 0xc6, 0xcf, 0x51, 0xd6, 0x55, 0xa1, 0x3d, 0x32, 0xfd, 0xed, 0x94,
+    0xf3, 0xe7, 0x38, 0x91, 0x07, 0x1b, 0x00, 0xc0, 0x25, 0xe4, 0x06, 0x01, 0x00, 0x00, 0xc0, 0x65,
+    0x14, 0x57, 0xdb, 0xcb, 0x02, 0x00, 0x7a, 0x04, 0xd1, 0x6e, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x41,
+    0x3f, 0x58, 0xeb, 0x01, 0x80, 0xb0, 0x47, 0x70, 0xc4, 0x94, 0x11, 0x00, 0x98, 0x2f, 0x02, 0x9a,
+    0x26, 0xd6, 0xdd, 0x77, 0x35, 0x21, 0x57, 0xb2, 0x1f, 0xde, 0xb3, 0x70, 0x29, 0xc1, 0x99, 0x4d,
+    0x26, 0x00, 0xa8, 0x33, 0x84, 0x21, 0x8c, 0x27, 0x01, 0x80, 0xfe, 0x20, 0x21, 0x12, 0x00, 0x00,
+    0x00, 0xb2, 0x21, 0x98, 0x8b, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x40, 0x15, 0x05, 0x00, 0x00, 0x00,
+    0x8f, 0x08, 0x12, 0xc5, 0xe0, 0x13, 0x00, 0x8c, 0x37, 0xb2, 0x6e, 0x8e, 0xa4, 0x00, 0x00, 0x6d,
+    0x11, 0x2a, 0xb2, 0x13, 0x1e, 0xb0, 0xad, 0x28, 0xdd, 0xaa, 0x3d, 0xf6, 0xec, 0x95, 0x41, 0xc8,
+    0xff, 0xcb, 0xf6, 0x00, 0xc0, 0x7d, 0x21, 0x0b, 0xe2, 0x45, 0x07, 0x00, 0xf8, 0x04, 0x89, 0xad,
+    0x00, 0x00, 0x00, 0xb0, 0x19, 0x81, 0xd0, 0x56, 0x50, 0x00, 0x00, 0xd0, 0x47, 0x30, 0xce, 0x6e,
+    0x13, 0x00, 0x94, 0x34, 0x52, 0x3b, 0xd6, 0xbc, 0x49, 0x52, 0x45, 0x1d, 0x33, 0xb5, 0xb5, 0x2e,
+    0xbe, 0x6f, 0x07, 0x15, 0x91, 0xc5, 0x2c, 0x00, 0xa0, 0x3d, 0xc4, 0x6b, 0xfc, 0x29, 0x01, 0x40,
+    0x0e, 0x21, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0xb0, 0x23, 0x40, 0xb6, 0x00, 0x00, 0x00, 0xe0, 0x13,
+    0x40, 0x88, 0x04, 0x00, 0x00, 0x80, 0x2e, 0x08, 0x64, 0xca, 0x9b, 0x10, 0x00, 0x88, 0x3c, 0x32,
+    0x16, 0x0e, 0x94, 0x00, 0xe0, 0x7c, 0x91, 0x83, 0x74, 0x9e, 0xfe, 0xbd, 0x6c, 0x28, 0xb9, 0x9e,
+    0xa9, 0xf3, 0xd1, 0x8d, 0x4d, 0x69, 0x3b, 0x7c, 0x1f, 0x01, 0x80, 0x8d, 0x21, 0x93, 0x64, 0x1c,
+    0x08, 0x00, 0xf6, 0x05, 0x91, 0xae, 0x00, 0x00, 0x00, 0xa0, 0x01, 0xc1, 0x0d, 0x05, 0x00, 0x00,
+    0x80, 0x8f, 0x08, 0x86, 0xc6, 0x94, 0x14, 0x00, 0x90, 0x37, 0xa2, 0x4b, 0xbe, 0xaa, 0x00, 0x20,
+    0x4d, 0x91, 0x6b, 0xf4, 0x84, 0x3e, 0xb4, 0xee, 0x0a, 0xa1, 0x92, 0xa9, 0xf0, 0x29, 0x9d, 0x41,
+    0x89, 0x90, 0xbc, 0xdf, 0x00, 0x00, 0x3e, 0x21, 0xbc, 0xdc, 0x32, 0x05, 0x00, 0xfa, 0x04, 0x11,
+    0x6b, 0x00, 0x00, 0x00, 0xc0, 0x25, 0x81, 0xf6, 0x17, 0x8c, 0x01, 0x80, 0xd0, 0x47, 0xfe, 0xc3,
+    0x52, 0x11, 0x00, 0x98, 0x30, 0x02, 0x9a, 0x1e, 0xd5, 0x05, 0x77, 0x3d, 0xa1, 0x52, 0x72, 0x1d,
+    0x7e, 0xb3, 0xb0, 0x29, 0x81, 0x9d, 0x2b, 0x2a, 0x00, 0xa8, 0x35, 0x44, 0x2b, 0xbc, 0x2d, 0x01,
+    0x80, 0x0e, 0x21, 0xae, 0x0f, 0x00, 0x00, 0x00, 0x32, 0x22, 0x38, 0xa6, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0xc0, 0x8c, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x08, 0xf8, 0xc3, 0x29, 0x13, 0x00, 0x8c, 0x38,
+    0x62, 0x64, 0x8e, 0x98, 0x00, 0x00, 0x75, 0x91, 0x2b, 0x32, 0x18, 0x5e, 0xb2, 0xed, 0x28, 0xf5,
+    0xaa, 0x61, 0x76, 0x09, 0x96, 0x43, 0x28, 0x0c, 0x0c, 0x02, 0x01, 0xc0, 0x8d, 0x21, 0xfe, 0x62,
+    0x70, 0x08, 0x00, 0x78, 0x05, 0x81, 0xa9, 0x00, 0x00, 0x00, 0xb0, 0x1d, 0xc1, 0x66, 0x06, 0x00,
+    0x00, 0x00, 0xf0, 0x07, 0xe8, 0xcd, 0x26, 0x13, 0x00, 0x94, 0x35, 0x12, 0x36, 0x3e, 0xb8, 0x01,
+    0x4f, 0x4d, 0x9d, 0x22, 0xb5, 0xb2, 0xfe, 0xbd, 0xaf, 0x07, 0xe5, 0x93, 0xb1, 0xee, 0x01, 0xa3,
+    0x3f, 0xa7, 0x6a, 0x6c, 0x2c, 0x01, 0x40, 0x1e, 0x21, 0x98, 0x19, 0x00, 0x00, 0x00, 0xfc, 0x02,
+    0x80, 0x8b, 0x00, 0x00, 0x00, 0xd0, 0x09, 0x81, 0xfb, 0xb8, 0xb8, 0x01, 0x00, 0xb1, 0x47, 0x66,
+    0xc2, 0xf4, 0x11, 0x00, 0x9c, 0x30, 0x52, 0x8c, 0xae, 0xd2, 0x5f, 0x97, 0x15, 0x25, 0xf2, 0xb3,
+    0x79, 0xce, 0xba, 0xf1, 0x29, 0x35, 0x89, 0x35, 0x26, 0x00, 0xb0, 0x33, 0xe4, 0xab, 0x0c, 0x1a,
+    0x01, 0xc0, 0xce, 0x20, 0x06, 0x15, 0x00, 0x00, 0x00, 0xb4, 0x20, 0x98, 0x85, 0x00, 0x00, 0x00,
+    0xf0, 0x15, 0x01, 0xca, 0x78, 0x88, 0x02, 0x00, 0x12, 0x47, 0xbe, 0xc7, 0x04, 0x14, 0x00, 0xa4,
+    0x2a, 0x12, 0x90, 0x8e, 0xd1, 0xd5, 0xd6, 0x65, 0xa1, 0x61, 0x32, 0x24, 0x2e, 0xaf, 0x73, 0x28,
+    0x19, 0x93, 0x41, 0x1d, 0x00, 0xc0, 0x29, 0x24, 0xbe, 0x0b, 0xd5, 0x00, 0x40, 0xaf, 0x20, 0xf6,
+    0x0c, 0x00, 0x00, 0x00, 0x38, 0x25, 0x08, 0xf4, 0xfe, 0x1e, 0x00, 0x10, 0xfe, 0xc8, 0x73, 0xb8,
+    0x24, 0x02, 0x00, 0x33, 0x46, 0xfe, 0xd2, 0x4c, 0x7a, 0xa5, 0xae, 0x28, 0xc4, 0x49, 0x66, 0xc3,
+    0x5d, 0x16, 0x3e, 0xa5, 0x20, 0xb4, 0xb0, 0x05, 0x00, 0xf5, 0x86, 0x58, 0x86, 0x41, 0x26, 0x00,
+    0xd0, 0x23, 0xc4, 0x89, 0x01, 0x00, 0x00, 0x40, 0x56, 0x04, 0xac, 0x17, 0x00, 0x00, 0x00, 0x7e,
+    0x02, 0xa0, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x19, 0x41, 0x57, 0x58, 0x48, 0x02, 0x80, 0x31, 0x47,
+    0x42, 0xcb, 0x70, 0x11, 0x00, 0xa0, 0x2f, 0x72, 0x45, 0x66, 0xc3, 0x81, 0xb6, 0x25, 0xa5, 0x58,
+    0x75, 0xc8, 0x6e, 0xc0, 0xb2, 0x28, 0x65, 0x83, 0xeb, 0x21, 0x00, 0xb8, 0x33, 0x64, 0x77, 0x0c,
+    0x29, 0x01, 0x00, 0xbf, 0x20, 0x82, 0x14, 0x00, 0x00, 0x00, 0x36, 0x24, 0xb0, 0xbe, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x01, 0xb1, 0x39, 0x59, 0x02, 0x80, 0xd2, 0x46, 0xf6, 0xc5, 0x4d, 0xf6, 0x38,
+    0xa9, 0xaa, 0x43, 0xa2, 0xde, 0xd5, 0xb3, 0xf7, 0xfd, 0xa0, 0xcd, 0x32, 0x09, 0xbe, 0x85, 0x34,
+    0xe8, 0x24, 0x8d, 0xd5, 0x25, 0x00, 0xc8, 0x25, 0x44, 0x83, 0x03, 0x00, 0x00, 0x80, 0x6f, 0x00,
+    0xe6, 0x10, 0x00, 0x00, 0x00, 0xba, 0x21, 0x58, 0x13, 0x07, 0x26, 0x00, 0x20, 0xfa, 0x88, 0x44,
+    0x98, 0x2f, 0x02, 0x80, 0x33, 0x46, 0xdc, 0xd0, 0x10, 0xba, 0xce, 0xb2, 0xa3, 0x44, 0x81, 0xae,
+    0xcf, 0x53, 0x37, 0x46, 0xa1, 0x62, 0xf1, 0x0d, 0x05, 0x00, 0xb6, 0x86, 0x04, 0x98, 0x57, 0x25,
+    0x00, 0xd8, 0x1b, 0xe4, 0x7d, 0x02, 0x00, 0x00, 0x80, 0x26, 0x04, 0xb4, 0x0c, 0x00, 0x00, 0x00,
+    0x3e, 0x23, 0xd8, 0x17, 0x53, 0x4f, 0x00, 0x40, 0xe6, 0x08, 0xc1, 0x38, 0x53, 0x02, 0x80, 0x74,
+    0x45, 0x50, 0xd2, 0x52, 0x7a, 0xe4, 0xba, 0x2d, 0x94, 0x4c, 0x5e, 0xc5, 0x8d, 0x76, 0x16, 0x25,
+    0x8a, 0xf2, 0xd8, 0x03, 0x00, 0x78, 0x85, 0x14, 0x7c, 0x03, 0x1f, 0x00, 0xe8, 0x17, 0xc4, 0x95,
+    0x01, 0x00, 0x00, 0x00, 0xb7, 0x04, 0xec, 0x1c, 0x00, 0x00, 0x00, 0x42, 0x20, 0x28, 0x0d, 0x13,
+    0x44, 0x00, 0x60, 0xca, 0x08, 0x50, 0xfa, 0x37, 0x1f, 0xc8, 0x35, 0x75, 0x26, 0xc9, 0x66, 0x38,
+    0xca, 0xc2, 0xa8, 0x14, 0x90, 0x3e, 0xc1, 0x00, 0xa0, 0xe6, 0x90, 0xe4, 0xf0, 0xd4, 0x04, 0x00,
+    0xba, 0x84, 0x2c, 0x1c, 0x00, 0x00, 0x00, 0xc8, 0x8c, 0x82, 0x46, 0x03, 0x00, 0x00, 0xc0, 0x5f,
+    0x00, 0xf2, 0x0d, 0x00, 0x00, 0x00, 0xbc, 0x23, 0xd0, 0x04, 0x4f, 0x44, 0x00, 0x30, 0xea, 0x48,
+    0x41, 0xb9, 0xfa, 0x01, 0x00, 0x14, 0x46, 0xa2, 0xc8, 0x72, 0xb8, 0xd1, 0xb6, 0x25, 0x64, 0xa9,
+    0x06, 0xd8, 0xa1, 0x57, 0x1e, 0xa5, 0xb1, 0x70, 0x79, 0x04, 0x00, 0xb7, 0x86, 0x2c, 0x91, 0xa3,
+    0x27, 0x00, 0xe0, 0x19, 0xc4, 0x70, 0x02, 0x00, 0x00, 0xc0, 0x96, 0x04, 0xe4, 0x15, 0x00, 0x00,
+    0x00, 0xc0, 0x20, 0x28, 0x34, 0x53, 0x49, 0x00, 0x50, 0xde, 0x08, 0xa0, 0xf8, 0xad, 0x02, 0x00,
+    0x75, 0x45, 0xfa, 0xd3, 0xaf, 0xfa, 0xf4, 0xbe, 0x20, 0x24, 0x62, 0x36, 0xc6, 0xb1, 0x93, 0x0e,
+    0xa1, 0x9e, 0xf1, 0xc2, 0x04, 0x00, 0xf9, 0x84, 0x68, 0x79, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00,
+    0x10, 0x02, 0x00, 0x00, 0x40, 0x47, 0x04, 0xa3, 0x20, 0x00, 0x00, 0x00, 0xc4, 0xdf, 0x00, 0x08,
+    0x73, 0x44, 0x00, 0x70, 0xca, 0x48, 0x01, 0x5a, 0x35, 0x5f, 0x53, 0x96, 0x94, 0x82, 0xd0, 0xfe,
+    0x39, 0xe8, 0xc6, 0x29, 0x74, 0x33, 0xb6, 0xa9, 0x00, 0xc0, 0xde, 0x90, 0x45, 0xb3, 0xde, 0x04,
+    0x00, 0xbb, 0x83, 0x34, 0x4a, 0x00, 0x00, 0x00, 0xd0, 0x86, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xc0,
+    0x77, 0x04, 0xb3, 0xe2, 0x9a, 0x09, 0x00, 0x48, 0x1d, 0x61, 0x11, 0x8b, 0x44, 0x00, 0x90, 0xb2,
+    0xc8, 0x53, 0x7a, 0x4e, 0xdf, 0x5d, 0xd7, 0x85, 0x86, 0xc9, 0xae, 0x78, 0xd8, 0xce, 0xa3, 0xd4,
+    0x57, 0x16, 0x83, 0x00, 0x00, 0xb7, 0x10, 0xf6, 0x2f, 0x4a, 0x04, 0x00, 0x3d, 0x83, 0x38, 0x31,
+    0x00, 0x00, 0x00, 0xe0, 0x98, 0x80, 0x61, 0x03, 0x00, 0x00, 0x40, 0x18, 0x04, 0x7e, 0x61, 0x76,
+    0x08, 0x00, 0xcc, 0x19, 0xb9, 0x46, 0xc3, 0xe3, 0x36, 0xb6, 0xaa, 0x8e, 0x22, 0x19, 0x0c, 0x17,
+    0x59, 0x38, 0x95, 0x40, 0xd3, 0x47, 0x39, 0x9b, 0xd5, 0x9d, 0x03, 0x1f, 0xa6, 0x9b, 0x00, 0x40,
+    0x9f, 0x10, 0x37, 0x0e, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x40, 0x2f, 0x00, 0x00, 0x00, 0xf0, 0x90,
+    0x80, 0xf7, 0x9b, 0xf9, 0x00, 0xc0, 0xb8, 0x23, 0x78, 0xe4, 0x18, 0x07, 0x00, 0xd0, 0x18, 0x29,
+    0x22, 0xa7, 0xe1, 0x31, 0xdb, 0x9a, 0x90, 0x9c, 0x1a, 0x5a, 0xe7, 0x5b, 0x99, 0x94, 0xf8, 0xc3,
+    0xe1, 0x12, 0x00, 0xdc, 0x1b, 0xa2, 0x4b, 0x26, 0xa6, 0x00, 0x80, 0x6f, 0x90, 0x13, 0x09, 0x00,
+    0x00, 0x00, 0x9b, 0x12, 0x74, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0xc5, 0x5c, 0x1b, 0x01,
+    0x40, 0x89, 0x23, 0xf9, 0x61, 0x35, 0x0a, 0x00, 0x54, 0x16, 0x99, 0x4e, 0x77, 0xea, 0xca, 0xfb,
+    0x86, 0x10, 0xa5, 0xd9, 0x27, 0x77, 0x56, 0x5a, 0x84, 0x68, 0xc6, 0x3e, 0x13, 0x00, 0xe4, 0x14,
+    0x22, 0x05, 0xd6, 0x26, 0x00, 0xc0, 0x47, 0x90, 0x17, 0x08, 0x00, 0x00, 0x00, 0x5d, 0x11, 0x4c,
+    0x7a, 0x00, 0x00, 0x00, 0x10, 0x81, 0x80, 0x1e, 0xec, 0x0c, 0x01, 0xc0, 0x39, 0x23, 0x81, 0xe7,
+    0x8b, 0x3c, 0x24, 0xd9, 0xd2, 0x71, 0x43, 0x1f, 0xe8, 0x97, 0x1b, 0xab, 0x90, 0xe9, 0x78, 0xc4,
+    0xae, 0x03, 0x9b, 0x73, 0xe8, 0xcd, 0x10, 0x14, 0x00, 0xec, 0x0f, 0xd2, 0x0a, 0x01, 0x00, 0x00,
+    0x40, 0x23, 0x82, 0x29, 0xb1, 0x96, 0x04, 0x00, 0xe4, 0x8e, 0x74, 0x85, 0x45, 0x1f, 0x00, 0x48,
+    0x5b, 0x64, 0x2e, 0x1d, 0xa9, 0x73, 0xaf, 0xfb, 0x42, 0xb1, 0x64, 0x4e, 0xfc, 0x69, 0x67, 0x12,
+    0x7a, 0x2f, 0xcf, 0x45, 0x00, 0x80, 0x5f, 0x48, 0x2d, 0x18, 0x4f, 0x02, 0x80, 0xbe, 0x41, 0x88,
+    0x17, 0x00, 0x00, 0x00, 0x70, 0x4d, 0x70, 0x8e, 0x01, 0x00, 0x00, 0x20, 0x14, 0x02, 0xaa, 0x70,
+    0x34, 0x04, 0x00, 0x26, 0x8d, 0x34, 0xa1, 0xb9, 0x2f, 0x00, 0x58, 0x57, 0x24, 0x90, 0xac, 0x85,
+    0x73, 0x2c, 0xac, 0x4a, 0x1b, 0x6a, 0x11, 0xdd, 0x26, 0x6b, 0xcf, 0x89, 0x10, 0x3f, 0x4e, 0x00,
+    0xa0, 0x53, 0xc8, 0x98, 0x07, 0x00, 0x00, 0x80, 0xff, 0x00, 0x80, 0x13, 0x00, 0x00, 0x00, 0x78,
+    0x49, 0x70, 0xeb, 0x6d, 0x6d, 0x00, 0x60, 0xe4, 0x11, 0x00, 0x72, 0x29, 0x03, 0x00, 0xa8, 0x8c,
+    0xcc, 0x90, 0xa3, 0x70, 0x79, 0x6d, 0x4f, 0x08, 0x49, 0xdd, 0xa9, 0x73, 0xac, 0x5c, 0x4a, 0x9e,
+    0x62, 0xf3, 0x09, 0x00, 0x6e, 0x0e, 0x41, 0x28, 0xd7, 0x55, 0x00, 0xc0, 0x3b, 0xc8, 0x0e, 0x04,
+    0x00, 0x00, 0x80, 0x6d, 0x09, 0x64, 0x23, 0x00, 0x00, 0x00, 0x80, 0x43, 0x90, 0x5b, 0xa6, 0x86,
+    0x00, 0xa0, 0xcc, 0x11, 0xb3, 0x30, 0xd1, 0x04, 0x00, 0x6a, 0x8b, 0x8c, 0xa6, 0x17, 0x75, 0xdf,
+    0x7d, 0x45, 0x28, 0xde, 0xfc, 0x98, 0x93, 0x2d, 0x3d, 0x42, 0x31, 0x63, 0xbd, 0x09, 0x00, 0xf2,
+    0x0a, 0x71, 0x10, 0x27, 0x2d, 0x00, 0xe0, 0x27, 0x88, 0xfd, 0x03, 0x00, 0x00, 0x80, 0xce, 0x08,
+    0x46, 0x38, 0x00, 0x00, 0x00, 0x88, 0x41, 0x70, 0x0f, 0xc6, 0x84, 0x00, 0xe0, 0xa4, 0x11, 0x71,
+    0xf3, 0x15, 0x7e, 0x71, 0xac, 0xe9, 0x60, 0xa2, 0x21, 0x74, 0xc7, 0x8d, 0x57, 0x68, 0x80, 0x9c,
+    0x6e, 0xa3, 0x97, 0xdd, 0x39, 0x4b, 0xe7, 0x42, 0x0a, 0x00, 0x76, 0x08, 0xd1, 0x71, 0x00, 0x00,
+    0x00, 0xa0, 0x15, 0xc1, 0x73, 0xf8, 0x26, 0x02, 0x00, 0x92, 0x47, 0x3a, 0xc1, 0x2e, 0x0e, 0x00,
+    0xa4, 0x2e, 0xe2, 0x98, 0x36, 0xd5, 0xd1, 0xd7, 0x85, 0xa5, 0x4c, 0xb2, 0x1f, 0xfe, 0xb1, 0x73,
+    0x09, 0xd9, 0x99, 0x51, 0x25, 0x00, 0xc0, 0x31, 0x04, 0x2c, 0x0c, 0x38, 0x01, 0x40, 0xef, 0x20,
+    0xe3, 0x0a, 0x00, 0x00, 0x00, 0x38, 0x27, 0x28, 0xb3, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x41, 0x48,
+    0xf8, 0x14, 0x02, 0x00, 0xb3, 0x46, 0x38, 0xcf, 0x77, 0x16, 0x00, 0xac, 0x2c, 0xb2, 0x47, 0xbe,
+    0xc2, 0x33, 0x16, 0x5e, 0xa5, 0x37, 0xf5, 0xae, 0x1e, 0xad, 0xf5, 0x27, 0xc9, 0x88, 0x55, 0x27,
+    0x00, 0xd0, 0x2b, 0xa4, 0x01, 0x5c, 0x82, 0x00, 0xc0, 0x8f, 0x20, 0xcb, 0x07, 0x00, 0x00, 0x00,
+    0x3c, 0x25, 0x70, 0xec, 0x66, 0x2c, 0x00, 0x30, 0xf6, 0xc8, 0xe5, 0x78, 0x65, 0x01, 0x00, 0x74,
+    0x46, 0x1e, 0xc8, 0x21, 0x78, 0x9f, 0xb6, 0x28, 0xe4, 0xa1, 0x3e, 0xd3, 0x73, 0x55, 0x36, 0xa5,
+    0xa4, 0xb1, 0x3b, 0x05, 0x00, 0x77, 0x87, 0xf8, 0x94, 0xed, 0x2b, 0x00, 0xe0, 0x1f, 0x64, 0xb0,
+    0x01, 0x00, 0x00, 0xc0, 0xc6, 0x04, 0x69, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x22, 0x18, 0x29, 0xa3,
+    0x3e, 0x00, 0x50, 0xea, 0x48, 0x33, 0x78, 0x40, 0x02, 0x00, 0xd5, 0x45, 0xda, 0xd2, 0x73, 0xfa,
+    0xe8, 0xbe, 0x23, 0x64, 0x73, 0xfe, 0xcd, 0x59, 0x97, 0x26, 0x21, 0x9d, 0xb1, 0xf3, 0x04, 0x00,
+    0xb9, 0x85, 0x2c, 0x8e, 0xb9, 0x1d, 0x00, 0xf0, 0x15, 0x04, 0xf5, 0x01, 0x00, 0x00, 0x40, 0x77,
+    0x04, 0x53, 0x19, 0x00, 0x00, 0x00, 0x44, 0x21, 0xb8, 0x07, 0xa3, 0x41, 0x00, 0x70, 0xd6, 0x48,
+    0x89, 0x39, 0xec, 0xf6, 0x18, 0xf6, 0x74, 0x7e, 0xd1, 0x1c, 0x7a, 0xe1, 0xc6, 0x2c, 0x44, 0x45,
+    0xa6, 0xbc, 0x5d, 0xd0, 0xf6, 0x9c, 0xc6, 0x73, 0x36, 0x05, 0x00, 0x7b, 0x84, 0xc0, 0x2a, 0x00,
+    0x00, 0x00, 0xd0, 0x8c, 0x40, 0x25, 0x4c, 0xfb, 0x00, 0x00, 0xd9, 0x23, 0xf2, 0xdf, 0x61, 0x06,
+    0x00, 0xd2, 0x17, 0x19, 0x4d, 0xb3, 0xea, 0xd3, 0xeb, 0xc6, 0xd2, 0x1e, 0xf9, 0x0a, 0xd7, 0xd6,
+    0xd9, 0x84, 0x0c, 0xce, 0xec, 0x13, 0x00, 0xe0, 0x19, 0x02, 0x1f, 0xae, 0xa2, 0x00, 0xa0, 0x7f,
+    0x10, 0xcb, 0x04, 0x00, 0x00, 0x00, 0xdc, 0x13, 0x0c, 0x4e, 0x00, 0x00, 0x00, 0x08, 0x89, 0xe0,
+    0x1b, 0x5c, 0x06, 0x01, 0x80, 0x69, 0x23, 0xcd, 0x66, 0x65, 0x0a, 0x00, 0xd6, 0x16, 0x91, 0x23,
+    0x53, 0xe1, 0x13, 0x0b, 0xb3, 0xd2, 0xa7, 0x1a, 0x63, 0xdf, 0xdd, 0x1a, 0x94, 0xa6, 0xc4, 0xc5,
+    0x13, 0x00, 0xe8, 0x16, 0x82, 0x17, 0x46, 0x68, 0x00, 0xe0, 0x4f, 0x10, 0xdc, 0x02, 0x00, 0x00,
+    0x00, 0xde, 0x12, 0xd4, 0x70, 0x5f, 0x0e, 0x00, 0x18, 0x7d, 0xc4, 0x68, 0xbc, 0x9d, 0x00, 0x00,
+    0x4a, 0x23, 0xdc, 0x63, 0xe8, 0xbb, 0x37, 0xdb, 0x14, 0xa2, 0x4f, 0xd3, 0xe8, 0x5c, 0x2a, 0x9f,
+    0x12, 0xfd, 0x58, 0xbd, 0x02, 0x80, 0xdb, 0x43, 0xbe, 0xca, 0x50, 0x16, 0x00, 0xf0, 0x10, 0x12,
+    0x92, 0x00, 0x00, 0x00, 0x60, 0x6b, 0x82, 0x7f, 0x06, 0x00, 0x00, 0x00, 0x60, 0x11, 0x98, 0x91,
+    0x15, 0x1c, 0x00, 0x28, 0x77, 0x84, 0x06, 0x7c, 0x0a, 0x01, 0x80, 0xfa, 0x22, 0x31, 0x69, 0x29,
+    0x3d, 0x6f, 0x5f, 0x12, 0x62, 0x3b, 0x53, 0xe7, 0xb2, 0x4b, 0x97, 0x12, 0xd3, 0xd8, 0x85, 0x02,
+    0x80, 0xfc, 0x42, 0xb6, 0xc9, 0x79, 0x11, 0x00, 0xf8, 0x0b, 0xa2, 0xf5, 0x00, 0x00, 0x00, 0xa0,
+    0x43, 0x82, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xe2, 0x10, 0xe8, 0x83, 0x71, 0x20, 0x00, 0x38, 0x6d,
+    0x04, 0xaa, 0x5c, 0x63, 0x01, 0x00, 0x8b, 0x22, 0xe6, 0x68, 0x14, 0xfd, 0x6f, 0xe3, 0x16, 0x6a,
+    0x24, 0x57, 0xe0, 0x9c, 0x69, 0x7f, 0x90, 0xf1, 0x39, 0xa4, 0x02, 0x80, 0x5d, 0x42, 0xe8, 0x08,
+    0x00, 0x00, 0x00, 0x68, 0x47, 0x21, 0x05, 0xae, 0x6c, 0x00, 0x80, 0xf4, 0x91, 0xaf, 0x2f, 0xdf,
+    0x02, 0x00, 0x29, 0x8c, 0x98, 0xa6, 0x35, 0xf5, 0xc5, 0x75, 0x65, 0xa9, 0x8b, 0xdc, 0x82, 0x27,
+    0xea, 0x7c, 0x42, 0xa5, 0x67, 0x9b, 0x0a, 0x00, 0x70, 0x0d, 0x59, 0x13, 0xeb, 0x53, 0x00, 0xd0,
+    0x43, 0x88, 0xde, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x16, 0x20, 0x00, 0x00, 0x00, 0x84, 0x45,
+    0x10, 0x09, 0x46, 0x80, 0x00, 0xc0, 0xbc, 0x11, 0xf0, 0x32, 0xb0, 0x04, 0x00, 0xab, 0x8b, 0xa4,
+    0x91, 0x9d, 0x70, 0x85, 0x85, 0x5b, 0xc9, 0x55, 0xcd, 0xb3, 0x6f, 0x70, 0x1d, 0x4a, 0x77, 0x62,
+    0xf3, 0x09, 0x00, 0xf4, 0x0b, 0x69, 0x15, 0xb3, 0x40, 0x00, 0xf0, 0x2b, 0x08, 0xd8, 0x00, 0x00,
+    0x00, 0x00, 0x8f, 0x09, 0x5e, 0x35, 0x00, 0x00, 0x00, 0x8c, 0x3f, 0x40, 0x30, 0x7e, 0x45, 0x00,
+    0x00, 0xad, 0x91, 0xcb, 0xb1, 0xd7, 0xed, 0x88, 0xad, 0xea, 0x28, 0xa7, 0x15, 0xf4, 0x05, 0x95,
+    0x51, 0xc9, 0x92, 0x4c, 0x6d, 0x3b, 0xd0, 0xfd, 0x39, 0x6e, 0xe5, 0x47, 0x0b, 0x00, 0xf8, 0x08,
+    0x89, 0x53, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x41, 0xde, 0x98, 0x78, 0x01, 0x80, 0x92, 0x47, 0x36,
+    0xbf, 0x33, 0x0f, 0x00, 0xa8, 0x30, 0xc2, 0x8e, 0x2e, 0xd1, 0x63, 0xf6, 0x2d, 0xa1, 0xc9, 0xb3,
+    0x73, 0x8e, 0xb8, 0xb4, 0x29, 0xb5, 0x8d, 0x53, 0x29, 0x00, 0xc8, 0x31, 0xa4, 0xbe, 0xbc, 0x36,
+    0x01, 0x80, 0xcf, 0x20, 0xdf, 0x0e, 0x00, 0x00, 0x00, 0xba, 0x24, 0x18, 0x90, 0x00, 0x00, 0x00,
+    0x20, 0x12, 0x81, 0x3e, 0x58, 0x00, 0x02, 0x80, 0xf3, 0x46, 0xba, 0xc8, 0xd0, 0x14, 0x00, 0xb0,
+    0x29, 0xa2, 0x90, 0xa6, 0xd1, 0xf9, 0x36, 0x76, 0x21, 0x5a, 0xb2, 0x1c, 0x5e, 0xa9, 0x36, 0x08,
+    0xc1, 0x9f, 0xa9, 0x2a, 0x00, 0xd8, 0x27, 0x44, 0xe9, 0xcb, 0xa8, 0x00, 0x00, 0xf9, 0x23, 0xe4,
+    0xde, 0x2c, 0x05, 0x00, 0xd2, 0x18, 0xa1, 0x4c, 0x9f, 0xe9, 0xf5, 0xea, 0xce, 0x92, 0x10, 0x79,
+    0x00, 0xc7, 0xd1, 0x19, 0x85, 0x82, 0xd0, 0x74, 0x16, 0x00, 0xe0, 0x1b, 0xe2, 0x2c, 0xde, 0xab,
+    0x00, 0xa0, 0x8f, 0x90, 0xba, 0x01, 0x00, 0x00, 0x00, 0x5c, 0x54, 0x34, 0x2f, 0x00, 0x00, 0x00,
+    0x08, 0x8d, 0xc0, 0x05, 0x4c, 0xf8, 0x00, 0x80, 0x89, 0x23, 0xdb, 0x64, 0x28, 0x08, 0x00, 0xd6,
+    0x17, 0xe9, 0x22, 0x23, 0xe1, 0xfb, 0x0a, 0xbb, 0x12, 0xa7, 0x1a, 0x66, 0x97, 0xe0, 0x5a, 0x84,
+    0x4e, 0xc5, 0x1c, 0x14, 0x00, 0xe8, 0x18, 0x92, 0x3a, 0xae, 0x93, 0x00, 0xe0, 0x5f, 0x90, 0x79,
+    0x0c, 0x00, 0x00, 0x00, 0x23, 0x10, 0x20, 0x8b, 0x1f, 0x0f, 0x00, 0x40, 0x6d, 0x44, 0x67, 0x5c,
+    0x6c, 0xd3, 0x5a, 0xbb, 0x3a, 0xa3, 0x69, 0xf3, 0xfc, 0x39, 0xe5, 0x54, 0xaa, 0x29, 0xa7, 0xde,
+    0x20, 0x77, 0x83, 0x4e, 0x5c, 0xd9, 0xd6, 0x76, 0x08, 0x5e, 0x72, 0x48, 0x0f, 0x00, 0x00, 0x00,
+    0x80, 0x47, 0x60, 0x25, 0x76, 0x41, 0x00, 0xa0, 0xec, 0x91, 0x88, 0x6f, 0x6e, 0x03, 0x00, 0x6a,
+    0x8c, 0x6c, 0xa2, 0xd3, 0xf3, 0x62, 0x7d, 0x4d, 0x28, 0xf6, 0x6c, 0x9b, 0xc7, 0x2c, 0x7d, 0x4a,
+    0x94, 0xe3, 0x96, 0x0a, 0x00, 0xf2, 0x0c, 0x41, 0x37, 0xd3, 0x53, 0x00, 0xe0, 0x37, 0xc8, 0x8d,
+    0x03, 0x00, 0x00, 0x80, 0x4e, 0x09, 0xc8, 0x19, 0x00, 0x00, 0x00, 0x88, 0x45, 0xe0, 0x0e, 0xd6,
+    0x7d, 0x00, 0xe0, 0xc4, 0x11, 0xac, 0xb1, 0xcc, 0x04, 0x00, 0xac, 0x8a, 0xac, 0xa4, 0x7b, 0xf4,
+    0xb9, 0x8d, 0x5f, 0xc8, 0x98, 0x8c, 0x8a, 0x97, 0xac, 0x1d, 0x42, 0x17, 0xe8, 0xc6, 0x0a, 0x00,
+    0x76, 0x0a, 0xe9, 0xef, 0x06, 0x14, 0x00, 0x40, 0x02, 0x09, 0xa1, 0xf7, 0x2d, 0x01, 0x80, 0x54,
+    0x46, 0xd4, 0xd2, 0x07, 0xba, 0x7a, 0xba, 0xb4, 0xa4, 0x42, 0xfe, 0xbe, 0xdb, 0x73, 0x4e, 0x21,
+    0x6d, 0xf4, 0xe8, 0x05, 0x00, 0x38, 0x87, 0x94, 0x8c, 0xbd, 0xeb, 0xee, 0xe8, 0x25, 0x47, 0xaa,
+    0x00, 0x00, 0x00, 0x40, 0x78, 0x14, 0xb3, 0xdf, 0x63, 0x07, 0x00, 0xcc, 0x1c, 0x21, 0x1e, 0x67,
+    0x35, 0x00, 0xb0, 0xc2, 0x48, 0x14, 0xf9, 0x07, 0x37, 0x57, 0xf8, 0x95, 0xe4, 0xd4, 0xf7, 0x7a,
+    0xea, 0xd6, 0x23, 0xd4, 0x2d, 0x26, 0xa3, 0x00, 0x40, 0xcf, 0x90, 0x3a, 0xb2, 0x0b, 0x05, 0x00,
+    0x3f, 0x83, 0xd4, 0x5b, 0x00, 0x00, 0x00, 0x18, 0x83, 0x00, 0x53, 0xdc, 0x68, 0x00, 0x00, 0x7a,
+    0x23, 0xc5, 0xe2, 0xff, 0xba, 0x68, 0x5a, 0xd6, 0xe1, 0x4b, 0x17, 0xe7, 0x9c, 0x29, 0xab, 0x92,
+    0x70, 0x19, 0x0c, 0xd7, 0xc7, 0x3b, 0x74, 0xd0, 0xca, 0xd1, 0xb6, 0xaf, 0xf0, 0x93, 0x73, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x82, 0x7b, 0x10, 0x00, 0x00, 0x00, 0xa5, 0x6f, 0x4c, 0x7a, 0x6d,
+    0x18, 0x00, 0x50, 0x65, 0x04, 0x07, 0x2d, 0x99, 0x5f, 0xe8, 0x7b, 0x42, 0xc6, 0xe7, 0xca, 0x5c,
+    0x58, 0x69, 0x54, 0x22, 0x1e, 0x03, 0x57, 0x00, 0x90, 0x6b, 0x88, 0xeb, 0x19, 0xc4, 0x02, 0x00,
+    0xdf, 0x41, 0x70, 0x1a, 0x00, 0x00, 0x00, 0x74, 0x4b, 0x20, 0x46, 0x00, 0x00, 0x00, 0x40, 0x34,
+    0x8a, 0x69, 0x30, 0xd5, 0x03, 0x00, 0x67, 0x8e, 0xf8, 0x88, 0x9f, 0x22, 0x00, 0x60, 0x57, 0xc4,
+    0x28, 0x6d, 0xa4, 0x9f, 0x6d, 0x0c, 0x43, 0xc6, 0xe4, 0x5e, 0x9c, 0x6c, 0x6d, 0x11, 0xda, 0x41,
+    0x1b, 0x57, 0x00, 0xb0, 0x57, 0x48, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x32, 0x08, 0x6c, 0xbc, 0xbb,
+    0x08, 0x00, 0xa4, 0x33, 0x22, 0x92, 0xbe, 0xcb, 0x69, 0xd0, 0xad, 0x9d, 0x0a, 0xb2, 0xef, 0xbd,
+    0x9a, 0xb3, 0x0a, 0x9d, 0xa5, 0x63, 0xf1, 0xc6, 0xc1, 0x3b, 0x47, 0x6d, 0x9c, 0x62, 0x0f, 0x4f,
+    0x3f, 0x39, 0x20, 0x5f, 0xe4, 0x06, 0x00, 0x4c, 0x1d, 0x39, 0x15, 0x4f, 0x26, 0x00, 0xb0, 0xc6,
+    0xc8, 0x0f, 0x19, 0x06, 0xff, 0x55, 0x18, 0x96, 0x60, 0xd4, 0x9d, 0xfa, 0xbb, 0xd6, 0x24, 0x24,
+    0x32, 0x0e, 0xa6, 0x00, 0x40, 0xd7, 0x10, 0x8a, 0xf2, 0x5e, 0x05, 0x00, 0x7f, 0x83, 0xec, 0x52,
+    0x00, 0x00, 0x00, 0x18, 0x85, 0xa0, 0x4c, 0xcc, 0x57, 0x00, 0x00, 0x8a, 0x23, 0x38, 0x62, 0x83,
+    0x0a, 0x00, 0xda, 0x16, 0x91, 0x4a, 0xab, 0xe6, 0x75, 0x29, 0xaf, 0x52, 0x8f, 0x79, 0x1e, 0x3f,
+    0xd2, 0x5b, 0x94, 0xac, 0xca, 0xdd, 0xf6, 0xde, 0xf0, 0x94, 0x33, 0xf5, 0x01, 0x00, 0x00, 0xa0,
+    0xfc, 0x81, 0x13, 0xef, 0xac, 0x02, 0x00, 0xea, 0x8c, 0x18, 0x9f, 0x47, 0xf2, 0x8d, 0x7c, 0x51,
+    0x07, 0xfb, 0xec, 0x96, 0xfb, 0x28, 0x9d, 0x4a, 0xfa, 0xe3, 0x29, 0x9b, 0x4f, 0xf2, 0xcd, 0x99,
+    0x42, 0x37, 0x5c, 0x00, 0xe0, 0x3f, 0x08, 0xf7, 0x02, 0x00, 0x00, 0x80, 0x8e, 0x09, 0x46, 0xc1,
+    0xbb, 0x0e, 0x00, 0x9c, 0x3a, 0xb2, 0x11, 0x6e, 0x79, 0x00, 0x80, 0x65, 0x11, 0xaf, 0x74, 0x92,
+    0x2e, 0xb5, 0x71, 0x0c, 0xc5, 0x92, 0x63, 0x71, 0xaf, 0xb5, 0x47, 0xa9, 0x0c, 0x1d, 0x61, 0x01,
+    0xc0, 0x6e, 0x21, 0x85, 0x1a, 0x00, 0x00, 0x00, 0x48, 0x21, 0xe8, 0xef, 0x02, 0x21, 0x00, 0x90,
+    0xd2, 0x88, 0x2d, 0xba, 0x14, 0x27, 0x28, 0xd7, 0x76, 0x06, 0xc8, 0xa3, 0x77, 0x5d, 0xce, 0x2b,
+    0x24, 0x9e, 0xc6, 0xcc, 0x19, 0x0f, 0xf7, 0x1c, 0xd3, 0xb1, 0x98, 0x6d, 0x4b, 0x3d, 0xe5, 0xa4,
+    0x79, 0xd3, 0x18, 0x00, 0x30, 0x77, 0x04, 0x32, 0x6c, 0x33, 0x00, 0xc0, 0x2a, 0x23, 0x27, 0xe4,
+    0x0a, 0x1c, 0x50, 0xe1, 0x58, 0x12, 0x4f, 0xbb, 0xe8, 0xf3, 0x59, 0x97, 0x10, 0xdc, 0xb8, 0xa5,
+    0x02, 0x00, 0x7d, 0x43, 0x1e, 0xcb, 0x7a, 0x16, 0x00, 0xfc, 0x0e, 0xd2, 0x22, 0x01, 0x00, 0x00,
+    0x60, 0x1c, 0x82, 0x14, 0xf1, 0xff, 0x00, 0x00, 0x68, 0x8e, 0x58, 0x86, 0xa9, 0x27, 0x00, 0x68,
+    0x5d, 0x04, 0x25, 0xfd, 0x98, 0x3b, 0xa5, 0xcc, 0x3a, 0xa3, 0xe6, 0xaf, 0x9c, 0x63, 0xef, 0x51,
+    0x22, 0x2a, 0x9b, 0xdb, 0x0e, 0xc4, 0x57, 0x4e, 0x55, 0x07, 0x00, 0x00, 0x80, 0x12, 0x08, 0x9a,
+    0xbb, 0x39, 0x09, 0x00, 0xa8, 0x34, 0xc2, 0x73, 0x56, 0xc4, 0x2b, 0xef, 0x4d, 0x9d, 0xf3, 0xf3,
+    0x51, 0x7e, 0x9b, 0xb4, 0x2a, 0xcd, 0x90, 0xcd, 0x6d, 0xdf, 0xca, 0x39, 0xe7, 0x1a, 0xed, 0x7b,
+    0x01, 0x80, 0x0f, 0x21, 0xd2, 0x09, 0x00, 0x00, 0x00, 0xba, 0x26, 0xf0, 0x02, 0xa7, 0x37, 0x00,
+    0x70, 0xee, 0xc8, 0xfb, 0x17, 0x95, 0x01, 0x00, 0xb6, 0x45, 0xe0, 0xd2, 0x49, 0xba, 0xcb, 0xc6,
+    0x32, 0xd4, 0x48, 0x3e, 0xc4, 0x33, 0xd6, 0x26, 0xa5, 0x47, 0x74, 0x99, 0x05, 0x00, 0xfb, 0x85,
+    0xf0, 0x60, 0x00, 0x00, 0x00, 0x20, 0x87, 0x00, 0xba, 0x5b, 0x7f, 0x00, 0x40, 0x5a, 0x23, 0x20,
+    0x68, 0xc4, 0x0b, 0x00, 0xdc, 0x1b, 0xb9, 0x1f, 0x3b, 0xde, 0x4b, 0x39, 0xb3, 0x90, 0x90, 0x5a,
+    0x4a, 0xd7, 0x4d, 0xfc, 0x83, 0xb2, 0xc7, 0x8c, 0x36, 0x53, 0xf5, 0x95, 0x13, 0xd9, 0x7d, 0x54,
+    0x00, 0xc0, 0xe4, 0x11, 0x3e, 0x10, 0x00, 0x00, 0x00, 0xeb, 0x6c, 0x30, 0x90, 0xe3, 0x6f, 0x10,
+    0x85, 0x65, 0x69, 0x31, 0xdd, 0x9a, 0xef, 0x62, 0x6d, 0x3a, 0xcd, 0xe3, 0xd8, 0x0a, 0x00, 0x74,
+    0x0e, 0x31, 0x2f, 0xd3, 0xdc, 0x27, 0xf3, 0x3f, 0x0e, 0xcf, 0x03, 0x00, 0x00, 0x80, 0x91, 0x08,
+    0xb0, 0x43, 0x00, 0x00, 0x00, 0xa0, 0xba, 0x91, 0x0d, 0x36, 0x93, 0x00, 0xa0, 0x7d, 0x91, 0x7d,
+    0x34, 0x5d, 0xae, 0x92, 0x72, 0xeb, 0xd0, 0x9b, 0x55, 0xf3, 0xcb, 0xbd, 0x49, 0x89, 0xa5, 0xcc,
+    0x6e, 0xc7, 0x11, 0x6f, 0x39, 0xfa, 0x1a, 0x00, 0x00, 0x00, 0xca, 0x20, 0x70, 0xec, 0x76, 0x1f,
+    0x00, 0xa0, 0xd6, 0x48, 0xa7, 0xb9, 0xf9, 0xb6, 0xa8, 0x57, 0x75, 0xf2, 0xcf, 0x20, 0x79, 0x4b,
+    0xd2, 0xab, 0x63, 0x46, 0x6e, 0xbb, 0x4f, 0x2f, 0xef, 0x1c, 0xa3, 0xf4, 0x12, 0x5e, 0x0d, 0x7e,
+    0xe4, 0x28, 0x1a, 0x00, 0x00, 0x00, 0xe8, 0x9c, 0x00, 0xff, 0xdb, 0xcb, 0x00, 0xc0, 0xc9, 0x23,
+    0xc3, 0xde, 0xd5, 0x04, 0x00, 0x58, 0x17, 0xc9, 0x4b, 0xf7, 0xe8, 0xf5, 0x1a, 0xcf, 0x90, 0x16,
+    0x19, 0x09, 0xf7, 0x54, 0xbb, 0x94, 0x8a, 0xd1, 0xd1, 0x16, 0x00, 0xec, 0x18, 0x92, 0x56, 0x01,
+    0x00, 0x00, 0x80, 0x24, 0x82, 0xd1, 0xae, 0xed, 0x01, 0x00, 0xa9, 0x8d, 0x80, 0x9d, 0x23, 0x2c,
+    0x00, 0x70, 0x71, 0xc4, 0x7d, 0xfc, 0x77, 0xab, 0xe4, 0xdc, 0x42, 0x84, 0xea, 0x6c, 0x9d, 0x63,
+    0x71, 0x10, 0x1a, 0x20, 0xb7, 0xda, 0xa6, 0xd5, 0x5b, 0x0e, 0x23, 0x97, 0xf7, 0x00, 0x00, 0xb3,
+    0x47, 0x06, 0x3f, 0x00, 0x00, 0x00, 0xac, 0x34, 0x20, 0x3e, 0xc6, 0xbd, 0x27, 0x13, 0x9e, 0x25,
+    0x97, 0x74, 0x4a, 0x1e, 0x74, 0xf5, 0xe9, 0xcc, 0x90, 0x83, 0x2c, 0x00, 0xd0, 0x3b, 0xa4, 0xc4,
+    0xec, 0x7b, 0x7b, 0xd8, 0x0f, 0x39, 0x9d, 0x0b, 0x00, 0x00, 0x00, 0xc6, 0x22, 0x78, 0x0b, 0x01,
+    0x00, 0x00, 0x80, 0xee, 0x46, 0x03, 0x98, 0x17, 0x02, 0x80, 0x16, 0x46, 0x8a, 0xd1, 0x53, 0x39,
+    0x3d, 0xca, 0xae, 0xd3, 0x72, 0x5e, 0xce, 0x7d, 0xf7, 0x2e, 0x21, 0x8a, 0x72, 0xbd, 0xad, 0x4d,
+    0xfc, 0xe5, 0x78, 0x60, 0x00, 0x00, 0x00, 0x28, 0x85, 0x20, 0xac, 0xdb, 0x68, 0x00, 0x80, 0x6a,
+    0x23, 0xdd, 0xe5, 0x6b, 0x0b, 0x00, 0xde, 0x15, 0x71, 0x40, 0x0b, 0xe4, 0xb2, 0x48, 0xb3, 0x8e,
+    0x25, 0xb9, 0xfc, 0x96, 0xc8, 0xdc, 0x73, 0x3a, 0xd3, 0xb4, 0x78, 0x0d, 0xf9, 0x92, 0xb3, 0xf6,
+    0x85, 0x58, 0x00, 0xe0, 0xec, 0x11, 0xd0, 0xae, 0x63, 0x01, 0x00, 0xec, 0x8b, 0xe4, 0xa5, 0x4b,
+    0x74, 0x4c, 0x8d, 0x69, 0x28, 0x84, 0x4c, 0x7f, 0xcf, 0xa7, 0x6d, 0x4a, 0x01, 0xe9, 0xa7, 0x0b,
+    0x00, 0xf6, 0x0c, 0x41, 0x8f, 0x00, 0x00, 0x00, 0x40, 0x16, 0x01, 0x5f, 0x37, 0xf1, 0x00, 0x80,
+    0xf4, 0x46, 0xe0, 0xcc, 0x2e, 0x14, 0x00, 0xb8, 0x39, 0x52, 0x3e, 0x9e, 0xbb, 0x1f, 0x72, 0x76,
+    0x1d, 0x54, 0xb5, 0xca, 0x2e, 0xbe, 0x78, 0x08, 0xa9, 0x90, 0x91, 0x6d, 0xf1, 0xea, 0x2f, 0x07,
+    0x6c, 0x0b, 0x18, 0x00, 0x80, 0xe9, 0x23, 0x9f, 0x1e, 0x00, 0x00, 0x00, 0xd6, 0x1a, 0x60, 0x1d,
+    0x9f, 0xdd, 0xbb, 0x08, 0xd3, 0xce, 0x35, 0x1a, 0x15, 0x5f, 0xac, 0x1a, 0x75, 0x4a, 0xc9, 0xdd,
+    0xb6, 0x24, 0xe9, 0x9e, 0xc3, 0x64, 0xf6, 0xc0, 0x37, 0xef, 0x8f, 0x1c, 0x5d, 0x03, 0x00, 0x00,
+    0x00, 0xa3, 0x51, 0xa0, 0x83, 0x00, 0x00, 0x00, 0x40, 0x79, 0x83, 0xe5, 0xbb, 0xeb, 0x00, 0x40,
+    0x1b, 0x23, 0x89, 0x68, 0x96, 0xfc, 0x15, 0xe5, 0xd7, 0x89, 0x3a, 0x17, 0xe7, 0x91, 0x7b, 0x9b,
+    0xd0, 0x3f, 0x99, 0xe0, 0x96, 0x2a, 0x1e, 0x73, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x94, 0x43, 0x00,
+    0xd4, 0xed, 0x29, 0x00, 0x40, 0xbd, 0x91, 0x82, 0xf2, 0x6a, 0x05, 0x00, 0x2f, 0x8b, 0x98, 0xa0,
+    0xd5, 0x71, 0x23, 0xa4, 0x5b, 0xe7, 0x96, 0x8c, 0x84, 0x83, 0x68, 0xfe, 0x49, 0xe2, 0x69, 0x81,
+    0x5c, 0xb3, 0xfc, 0xc9, 0xa1, 0xf5, 0xf2, 0x21, 0x00, 0x70, 0xfa, 0xc8, 0x23, 0x07, 0x00, 0x00,
+    0x00, 0x16, 0x06, 0xda, 0xd2, 0xf8, 0x39, 0x82, 0xc6, 0x35, 0xf4, 0x3d, 0xbe, 0xbc, 0x3d, 0xd2,
+    0x3e, 0x9d, 0xa1, 0xf4, 0xf7, 0x05, 0x00, 0xbb, 0x86, 0x04, 0x35, 0x00, 0x00, 0x00, 0x20, 0x8d,
+    0x80, 0xa9, 0xeb, 0x73, 0x00, 0x40, 0x8a, 0x23, 0x53, 0x65, 0xe2, 0x08, 0x00, 0x5c, 0x1d, 0xe1,
+    0x1e, 0xab, 0xdd, 0xf7, 0x38, 0xbf, 0x0e, 0xaa, 0x5a, 0x68, 0x57, 0x61, 0x5c, 0x84, 0x9c, 0xc8,
+    0xdd, 0x76, 0x82, 0xf5, 0x98, 0x53, 0x9f, 0x01, 0x00, 0x00, 0xc0, 0xfc, 0x81, 0xef, 0x0e, 0x00,
+    0x00, 0x00, 0xab, 0x0d, 0x9c, 0x8d, 0xf7, 0xed, 0xbb, 0x83, 0x6b, 0x67, 0x10, 0xdd, 0x82, 0x6b,
+    0x4d, 0x9d, 0x3a, 0x17, 0xe5, 0xbc, 0x9b, 0xd6, 0xf4, 0xcf, 0x21, 0x33, 0x8f, 0xe1, 0x97, 0xf8,
+    0x4b, 0x0e, 0x0d, 0x08, 0x00, 0x00, 0x00, 0xb4, 0x07, 0x84, 0xbc, 0x5d, 0x0c, 0x00, 0xb4, 0x32,
+    0x42, 0x84, 0xe6, 0xc7, 0x8d, 0x50, 0x86, 0x1d, 0xb0, 0x73, 0x68, 0x6e, 0xb1, 0xf7, 0x09, 0xb5,
+    0x93, 0x39, 0xee, 0xf2, 0xe2, 0x33, 0xe7, 0x05, 0x02, 0x00, 0x00, 0x40, 0x49, 0x04, 0x2e, 0x5d,
+    0xf8, 0x01, 0x00, 0x54, 0x1c, 0x61, 0x20, 0xf7, 0x50, 0x00, 0xf0, 0xb6, 0x88, 0x0f, 0x1a, 0x1b,
+    0x4f, 0x3f, 0xda, 0x75, 0x9e, 0xc9, 0x90, 0xf8, 0xb5, 0xe6, 0xa0, 0x84, 0xa1, 0xde, 0xc9, 0xcd,
+    0xcc, 0xa7, 0x1c, 0xe5, 0x6e, 0xd7, 0x00, 0x00, 0xe7, 0x8f, 0x58, 0x6e, 0x00, 0x00, 0x00, 0x60,
+    0x63, 0x80, 0x29, 0x0d, 0x9b, 0x9f, 0x64, 0x6c, 0x3b, 0xa0, 0x63, 0x9a, 0xbb, 0x04, 0x6d, 0xd4,
+    0x59, 0x4c, 0xd7, 0xe1, 0x80, 0xb1, 0x6f, 0x8e, 0x63, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x28, 0x26,
+    0xba, 0xd2, 0x06, 0x00, 0xa4, 0x39, 0x92, 0x40, 0xd6, 0x74, 0x00, 0xc0, 0xdd, 0x91, 0xe9, 0xb1,
+    0xd7, 0x9d, 0x8d, 0x33, 0xec, 0x10, 0xaa, 0x49, 0xf6, 0xfb, 0xc5, 0x47, 0xe9, 0x8d, 0x5c, 0x6f,
+    0xe7, 0x58, 0x9f, 0x39, 0x51, 0x18, 0x00, 0x00, 0x00, 0x4c, 0x20, 0xb8, 0xe9, 0x00, 0x00, 0x00,
+    0xb0, 0xde, 0x80, 0xc2, 0xb8, 0xcc, 0x26, 0x2b, 0xd8, 0x76, 0x6a, 0xd0, 0xc4, 0x17, 0x00, 0xd4,
+    0x2a, 0xc2, 0x58, 0x96, 0xc0, 0xb7, 0x50, 0x07, 0x1d, 0x35, 0x73, 0x23, 0x3e, 0x93, 0xff, 0xe4,
+    0x40, 0x7d, 0x00, 0x00, 0x00, 0x40, 0x7d, 0xe0, 0xa9, 0x0b, 0x96, 0x00, 0x40, 0x3b, 0x23, 0xf6,
+    0x67, 0x5d, 0xbc, 0xf5, 0xe4, 0xd8, 0xe9, 0x3a, 0x67, 0xe5, 0x4d, 0x7a, 0xa3, 0x50, 0x38, 0xb9,
+    0xe7, 0x3e, 0x34, 0x5e, 0x73, 0xa4, 0x13, 0x00, 0x00, 0x00, 0x94, 0x45, 0x21, 0xd2, 0x9d, 0x13,
+    0x00, 0x40, 0xcd, 0x91, 0x7a, 0xb1, 0x9f, 0x04, 0x00, 0xaf, 0x8b, 0x64, 0xa1, 0x9f, 0xf1, 0xcd,
+    0xa3, 0x5f, 0x47, 0x9a, 0x7c, 0x8b, 0x1b, 0x6d, 0x1e, 0x4a, 0x42, 0xea, 0xb2, 0x9c, 0xdf, 0xfc,
+    0xca, 0x09, 0xe5, 0x00, 0x00, 0x00, 0x70, 0x02, 0x41, 0xad, 0x06, 0x00, 0x00, 0x00, 0x56, 0x06,
+    0x32, 0xd2, 0x47, 0xb9, 0xf0, 0xc5, 0xb7, 0x13, 0x36, 0x76, 0xb6, 0x1d, 0xce, 0x4e, 0x9d, 0xec,
+    0xf4, 0x45, 0x0e, 0x5a, 0x3b, 0xe7, 0xfc, 0x72, 0xe9, 0x0b, 0x00, 0x48, 0x75, 0xa4, 0x52, 0xfc,
+    0xa2, 0x00, 0x80, 0xcb, 0x23, 0xc7, 0xe3, 0xa7, 0x5b, 0x16, 0xe7, 0xd8, 0x11, 0x52, 0x37, 0xeb,
+    0x49, 0x8b, 0x93, 0xd2, 0x24, 0xb9, 0xe1, 0x36, 0xb3, 0x5e, 0x73, 0xbe, 0x2c, 0x00, 0x00, 0x00,
+    0x98, 0x41, 0x30, 0xcb, 0x01, 0x00, 0x00, 0x60, 0xc5, 0x81, 0x4d, 0x31, 0x6a, 0x05, 0x00, 0xf0,
+    0x8d, 0xc0, 0x9f, 0xd5, 0x2e, 0x00, 0xa8, 0x57, 0x64, 0xbf, 0xcc, 0x89, 0x7f, 0xa6, 0x1e, 0x42,
+    0x67, 0x66, 0x54, 0x5c, 0x34, 0x7f, 0x4a, 0x82, 0xf1, 0x00, 0x00, 0x00, 0x80, 0xfe, 0xc0, 0x17,
+    0xd7, 0xa2, 0x00, 0x80, 0x96, 0x46, 0x2c, 0xcf, 0x66, 0xf8, 0xb0, 0xc9, 0xb2, 0xb3, 0x74, 0xe6,
+    0xc7, 0x73, 0xf2, 0x4e, 0x9d, 0x6d, 0xf2, 0xd9, 0xed, 0x73, 0xfc, 0xe6, 0x4c, 0x74, 0x00, 0x00,
+    0x00, 0x50, 0x75, 0x03, 0x38, 0xfc, 0x05, 0x01, 0xc0, 0xfb, 0x22, 0x74, 0x68, 0x63, 0xdc, 0xea,
+    0x68, 0xd8, 0x19, 0x26, 0x03, 0xe3, 0x6d, 0x9b, 0x8b, 0xd2, 0x98, 0x3a, 0x31, 0x2f, 0x3b, 0xdf,
+    0x72, 0x4e, 0x36, 0x00, 0x00, 0x00, 0x9c, 0x41, 0xb0, 0x9f, 0x01, 0x00, 0x00, 0x80, 0x9d, 0x01,
+    0x64, 0xb4, 0x2b, 0xee, 0x55, 0x31, 0xee, 0xa0, 0x8c, 0xe3, 0x6c, 0xf1, 0xb2, 0x55, 0x27, 0x44,
+    0x0d, 0x9b, 0x5f, 0xdf, 0xde, 0x39, 0x5c, 0x5c, 0x49, 0x02, 0x00, 0xd2, 0x1d, 0xe9, 0x07, 0x01,
+    0x00, 0x00, 0xe0, 0xf6, 0x46, 0xed, 0x58, 0xe7, 0x9e, 0xc3, 0x59, 0x76, 0xc4, 0xd3, 0x49, 0x3a,
+    0x88, 0xe2, 0xa5, 0xa4, 0x4b, 0x76, 0xb9, 0x63, 0xad, 0xdf, 0x1c, 0x0b, 0x0a, 0x00, 0x00, 0x00,
+    0xa6, 0x10, 0x1c, 0x71, 0x00, 0x00, 0x00, 0x58, 0x73, 0x60, 0x41, 0xcc, 0x4a, 0x01, 0x00, 0x8c,
+    0x23, 0xb4, 0x67, 0x91, 0x0b, 0x00, 0x6a, 0x16, 0x09, 0x33, 0x5f, 0xe4, 0x98, 0xaa, 0x8b, 0xd0,
+    0x96, 0x99, 0x16, 0x3f, 0xcf, 0xbf, 0x92, 0x96, 0x39, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x50, 0xb7,
+    0x01, 0x00, 0x00, 0xa0, 0xad, 0x01, 0x95, 0xb3, 0xfe, 0x1d, 0x56, 0xf2, 0xec, 0xcc, 0x9c, 0x1b,
+    0x71, 0xe7, 0xbb, 0x55, 0x67, 0x9b, 0xdc, 0x79, 0x07, 0x20, 0xcf, 0x39, 0xfb, 0x1c, 0x00, 0x00,
+    0x00, 0xd4, 0x1d, 0x80, 0x03, 0x23, 0x37, 0x00, 0xf0, 0xc2, 0x48, 0x22, 0x1a, 0x18, 0x77, 0x38,
+    0x3a, 0x76, 0x44, 0xc9, 0xa8, 0x38, 0xd3, 0xe6, 0x23, 0xb4, 0xa7, 0x26, 0xcd, 0x79, 0xcf, 0xbf,
+    0x1c, 0xab, 0x0c, 0x00, 0x00, 0x00, 0xa7, 0x10, 0x88, 0x65, 0x00, 0x00, 0x00, 0x60, 0x69, 0xc0,
+    0x0a, 0x9d, 0x7d, 0x01, 0x40, 0x9c, 0x23, 0xf5, 0x62, 0x0d, 0xbb, 0x92, 0xec, 0xd5, 0x19, 0x53,
+    0x03, 0xe9, 0x81, 0xb9, 0x7b, 0x0e, 0xf6, 0x76, 0x18, 0x00, 0x80, 0x94, 0x47, 0x82, 0x3e, 0x00,
+    0x00, 0x00, 0xb8, 0x3e, 0x00, 0x3a, 0xe6, 0xb8, 0x39, 0x70, 0x9e, 0x9d, 0xb3, 0x34, 0x66, 0x8e,
+    0x85, 0xb8, 0xe9, 0x90, 0x93, 0xb1, 0xee, 0x85, 0xeb, 0x39, 0x07, 0x2b, 0x02, 0x00, 0x00, 0x80,
+    0x39, 0x04, 0xea, 0x1b, 0x00, 0x00, 0x00, 0x56, 0x1d, 0x18, 0x0b, 0xeb, 0x4d, 0x00, 0x00, 0xe7,
+    0x88, 0xdf, 0xd9, 0xdc, 0x02, 0x80, 0xba, 0x45, 0x6a, 0xcd, 0x74, 0xb9, 0xd1, 0xea, 0x23, 0xc4,
+    0x64, 0xd6, 0xc5, 0x2f, 0xf4, 0xb7, 0xa4, 0x87, 0x0d, 0x00, 0x00, 0x00, 0x68, 0x10, 0x68, 0x6a,
+    0x00, 0x00, 0x00, 0x68, 0x6d, 0x20, 0xd5, 0x0c, 0x77, 0x13, 0x8b, 0x4c, 0x3b, 0x12, 0x67, 0x09,
+    0xdc, 0xbd, 0xee, 0xd5, 0x09, 0x27, 0x67, 0xdf, 0xc4, 0xc8, 0x77, 0x4e, 0x34, 0x07, 0x00, 0x00,
+    0x00, 0x95, 0x07, 0x0a, 0xbe, 0x6e, 0x0a, 0x00, 0xbc, 0x31, 0xb2, 0x89, 0xa6, 0xc5, 0x63, 0x8d,
+    0x96, 0x9d, 0x37, 0xf2, 0x1b, 0x3e, 0xae, 0x39, 0x09, 0x35, 0xaa, 0x7f, 0x73, 0x02, 0xf4, 0x31,
+    0x47, 0xe1, 0x02, 0x00, 0x00, 0xc0, 0x39, 0x04, 0xed, 0x18, 0x00, 0x00, 0x00, 0xd8, 0x1a, 0xe8,
+    0x3d, 0xe7, 0x5a, 0x00, 0x10, 0xeb, 0xc8, 0xb2, 0x58, 0xba, 0xf6, 0x18, 0x9b, 0x75, 0x2c, 0xd5,
+    0xb5, 0x7a, 0xae, 0xee, 0x9f, 0x04, 0xb3, 0x01, 0x00, 0x00, 0x20, 0xed, 0x01, 0xb8, 0x0e, 0x00,
+    0x00, 0x00, 0xee, 0x0f, 0x08, 0x8e, 0xe5, 0x6d, 0xcc, 0x9b, 0x69, 0x47, 0x1b, 0x6d, 0x8c, 0x9b,
+    0x16, 0x7e, 0x3a, 0x17, 0x65, 0xc7, 0x9b, 0xf1, 0xfa, 0xce, 0x49, 0x6f, 0x00, 0x00, 0x00, 0x60,
+    0x12, 0xc1, 0xe4, 0x06, 0x00, 0x00, 0x80, 0x75, 0x07, 0x2e, 0xc1, 0xf1, 0x11, 0x00, 0xc0, 0x3a,
+    0xb2, 0x74, 0xce, 0xb5, 0x00, 0xa0, 0x76, 0x11, 0x7d, 0x33, 0x6c, 0x9e, 0xba, 0x3a, 0x09, 0xdd,
+    0x98, 0x6f, 0xf1, 0x1a, 0xfd, 0x2f, 0xa9, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x04, 0xd4, 0x19,
+    0x00, 0x00, 0x00, 0xda, 0x1b, 0x98, 0x30, 0xff, 0x5a, 0x00, 0x20, 0xd7, 0x08, 0xbd, 0x99, 0xf2,
+    0x0e, 0x99, 0x9b, 0x75, 0xce, 0xc9, 0x15, 0xb8, 0x5f, 0xf2, 0x1e, 0x84, 0xc9, 0x01, 0x00, 0x00,
+    0x40, 0xed, 0x01, 0xc4, 0x6e, 0x49, 0x01, 0x00, 0xaf, 0x8c, 0x90, 0xa2, 0x3f, 0xf1, 0x1c, 0xa3,
+    0x67, 0x47, 0x85, 0x8c, 0x81, 0xb3, 0x68, 0x5e, 0x42, 0x9f, 0xea, 0xee, 0xdc, 0x0b, 0xfd, 0xcc,
+    0x59, 0xa1, 0x00, 0x00, 0x00, 0x70, 0x12, 0x01, 0x24, 0x06, 0x00, 0x00, 0x00, 0xd6, 0x06, 0xf4,
+    0xcd, 0x3c, 0x15, 0x00, 0xc4, 0x3b, 0xa2, 0x2a, 0xb6, 0xac, 0x29, 0xc2, 0x6e, 0x1d, 0x5d, 0x35,
+    0xc3, 0x7e, 0xb9, 0x3b, 0x28, 0x79, 0x69, 0x00, 0x00, 0x00, 0x48, 0x7d, 0x60, 0x72, 0x03, 0x00,
+    0x00, 0x80, 0x0b, 0x04, 0x5b, 0xe3, 0x5c, 0x1b, 0xdb, 0xe6, 0xda, 0xf1, 0x41, 0x5b, 0x5f, 0x00,
+    0x80, 0xa3, 0x08, 0x54, 0xb9, 0xf9, 0xce, 0xc0, 0xde, 0x73, 0x78, 0x12, 0x00, 0x00, 0x00, 0x98,
+    0x45, 0xc0, 0xb3, 0x01, 0x00, 0x00, 0x60, 0xe5, 0x81, 0xd6, 0xaf, 0x03, 0x04, 0x00, 0xf0, 0x8e,
+    0x6c, 0x9c, 0x25, 0x2d, 0x00, 0xa8, 0x5f, 0x44, 0xe5, 0x8c, 0x9c, 0xe3, 0xae, 0x5e, 0x4a, 0x1c,
+    0x66, 0x5a, 0x5c, 0x49, 0x7f, 0x4c, 0x3a, 0xb2, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x41, 0x4a, 0x06,
+    0x00, 0x00, 0x80, 0x16, 0x07, 0xca, 0xca, 0xde, 0x15, 0x00, 0xc8, 0x36, 0x62, 0x6d, 0xb6, 0xb8,
+    0x00, 0xe0, 0x6e, 0x11, 0x78, 0x72, 0x14, 0x9e, 0xa2, 0xfc, 0x07, 0xd5, 0x70, 0x00, 0x00, 0x00,
+    0x50, 0x7d, 0xe0, 0x7f, 0x03, 0x00, 0x00, 0xc0, 0x3b, 0x03, 0xa4, 0xe8, 0x40, 0xbc, 0xb0, 0x68,
+    0xda, 0xb1, 0x1e, 0x8f, 0xde, 0x21, 0x99, 0x9b, 0xce, 0xaa, 0x7a, 0x3f, 0xc7, 0x45, 0x5f, 0x73,
+    0xa6, 0x20, 0x00, 0x00, 0x00, 0x9c, 0x45, 0xe0, 0x84, 0x01, 0x00, 0x00, 0x80, 0xbd, 0x01, 0x02,
+    0x73, 0xd3, 0x04, 0x00, 0x31, 0x8f, 0x48, 0x8a, 0xcd, 0x2a, 0x00, 0xb0, 0x5d, 0x04, 0x58, 0xcd,
+    0xb3, 0x3f, 0xf0, 0x1e, 0x4a, 0x5f, 0x19, 0x00, 0x00, 0x00, 0xd2, 0x1f, 0xb0, 0xcd, 0x00, 0x00,
+    0x00, 0xe0, 0x06, 0x41, 0xc9, 0x18, 0xcd, 0x66, 0xad, 0xd9, 0x76, 0x3e, 0xcf, 0xda, 0x16, 0x00,
+    0xe0, 0x29, 0xf2, 0x58, 0xc6, 0xc0, 0x7d, 0xb1, 0xff, 0x1c, 0x68, 0x0d, 0x00, 0x00, 0x00, 0x6b,
+    0x0f, 0x7c, 0x7a, 0x43, 0x1b, 0x00, 0x80, 0x79, 0x04, 0xdd, 0xbc, 0x66, 0x01, 0x40, 0x0d, 0x23,
+    0x3f, 0xe7, 0xdc, 0x1c, 0x6e, 0x75, 0x53, 0x0a, 0x30, 0xbb, 0xe2, 0x59, 0xfa, 0x67, 0x12, 0xb9,
+    0x04, 0x00, 0x00, 0x00, 0x94, 0x08, 0x32, 0x31, 0x00, 0x00, 0x00, 0xb4, 0x39, 0x60, 0x49, 0x3e,
+    0xa6, 0x00, 0x40, 0xbe, 0x11, 0x5f, 0x33, 0xa9, 0x05, 0x00, 0xb7, 0x8b, 0xcc, 0x93, 0x0f, 0x71,
+    0x5b, 0xe5, 0x41, 0x28, 0x76, 0x03, 0x00, 0x00, 0x80, 0xfa, 0x03, 0x6d, 0x1a, 0x00, 0x00, 0x00,
+    0x5e, 0x1a, 0xa8, 0x44, 0x3b, 0xe1, 0x53, 0x44, 0xd7, 0x8e, 0xdd, 0xd8, 0xe2, 0xce, 0xbd, 0xfc,
+    0x74, 0x7a, 0xd5, 0x25, 0x7a, 0x4b, 0xfa, 0x9b, 0xd3, 0xad, 0x00, 0x00, 0x00, 0xe0, 0x34, 0x02,
+    0x0f, 0x0c, 0x00, 0x00, 0x00, 0x2c, 0x0e, 0x54, 0x93, 0x61, 0x21, 0x00, 0x88, 0x7b, 0x04, 0x50,
+    0x2c, 0x54, 0x01, 0x80, 0xfd, 0x22, 0xab, 0xea, 0x9f, 0x3d, 0x84, 0x77, 0x11, 0x3a, 0xc1, 0x00,
+    0x00, 0x00, 0x90, 0x02, 0xc1, 0xf7, 0x05, 0x00, 0x00, 0x00, 0x57, 0x08, 0xc6, 0xc5, 0xff, 0x75,
+    0xec, 0xcc, 0xb7, 0xd3, 0x6f, 0xc6, 0xae, 0x00, 0x00, 0x57, 0x91, 0xe8, 0x72, 0x1a, 0x9e, 0x96,
+    0x3d, 0x28, 0x31, 0x69, 0x00, 0x00, 0x00, 0x58, 0x7d, 0xc0, 0xae, 0x1b, 0xa7, 0x00, 0x00, 0xdc,
+    0x23, 0xaf, 0x66, 0x22, 0x0b, 0x00, 0xea, 0x18, 0xe1, 0x39, 0xf7, 0xe5, 0xc2, 0xaa, 0x9f, 0x92,
+    0x79, 0x19, 0x15, 0x5f, 0xd3, 0x5f, 0x93, 0xc2, 0x1c, 0x00, 0x00, 0x00, 0xa0, 0x45, 0x40, 0x82,
+    0x01, 0x00, 0x00, 0xa0, 0xd5, 0x01, 0xd6, 0xb1, 0xdb, 0x04, 0x00, 0x32, 0x8e, 0xb0, 0x9a, 0x77,
+    0x2c, 0x00, 0xb8, 0x5f, 0x04, 0x9e, 0xbc, 0x8a, 0x7f, 0x2c, 0x1f, 0x42, 0xf7, 0x1a, 0x00, 0x00,
+    0x00, 0x54, 0x20, 0xd8, 0xc6, 0x00, 0x00, 0x00, 0xf0, 0xd6, 0xc0, 0x1d, 0x7a, 0x00, 0x8f, 0x0e,
+    0xda, 0x76, 0x1a, 0xc6, 0x74, 0x76, 0x70, 0xe5, 0xa8, 0xc3, 0xac, 0x96, 0xd2, 0x51, 0xd3, 0xe7,
+    0xa0, 0xfb, 0x0b, 0x00, 0x00, 0x00, 0x6c, 0x0e, 0xc0, 0x8d, 0x47, 0x1a, 0x00, 0x88, 0x7d, 0x84,
+    0x4e, 0xac, 0x52, 0x01, 0x80, 0x0d, 0x23, 0x78, 0x6a, 0x86, 0xfd, 0x78, 0xf7, 0x11, 0x3a, 0xb5,
+    0x00, 0x00, 0x00, 0x90, 0x06, 0xc1, 0x88, 0x05, 0x00, 0x00, 0x00, 0x77, 0x08, 0x18, 0xc5, 0x72,
+    0x15, 0x00, 0xcc, 0x38, 0x42, 0x66, 0xce, 0xa6, 0x00, 0x00, 0x5f, 0x91, 0x0c, 0x73, 0x2f, 0x4e,
+    0xa1, 0x7d, 0x28, 0x6d, 0x66, 0x00, 0x00, 0x00, 0x58, 0x7f, 0x80, 0x85, 0x9b, 0x54, 0x00, 0x00,
+    0xec, 0x23, 0x6d, 0x66, 0x07, 0x0b, 0x00, 0x6a, 0x19, 0x09, 0x39, 0x5f, 0xe4, 0x9f, 0xa9, 0xa3,
+    0x12, 0x72, 0xb9, 0x14, 0xef, 0xd3, 0x7f, 0x93, 0xf8, 0x0d, 0x00, 0x00, 0x00, 0xa0, 0x46, 0xd1,
+    0x7c, 0x01, 0x00, 0x00, 0xa0, 0xdd, 0x81, 0x4d, 0xf1, 0x6e, 0x04, 0x00, 0x72, 0x8e, 0x98, 0x9a,
+    0xc9, 0x2b, 0x00, 0xb8, 0x61, 0x84, 0x9c, 0x0c, 0x8c, 0x7b, 0x2d, 0x2f, 0x42, 0x04, 0x1a, 0x00,
+    0x00, 0x00, 0xd4, 0x20, 0xa8, 0xba, 0x00, 0x00, 0x00, 0xf0, 0xda, 0x00, 0x11, 0xfa, 0xf2, 0x02,
+    0x00, 0xfa, 0x46, 0x42, 0xc5, 0xc9, 0x75, 0x9e, 0xe4, 0xa9, 0xb3, 0xad, 0x46, 0xd4, 0x71, 0xd4,
+    0xef, 0xa0, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0xac, 0x0e, 0x30, 0x87, 0xad, 0x0e, 0x00, 0x88, 0x7f,
+    0x64, 0x4d, 0x5c, 0x51, 0x01, 0x80, 0x1d, 0x23, 0x21, 0x6a, 0x53, 0xdd, 0x5c, 0x77, 0x12, 0xb2,
+    0xa6, 0x00, 0x00, 0x00, 0x90, 0x0a, 0xc1, 0x22, 0x05, 0x00, 0x00, 0x00, 0x97, 0x08, 0x40, 0xc4,
+    0xb8, 0x14, 0x00, 0xcc, 0x39, 0x72, 0x5d, 0x4e, 0x9f, 0x00, 0x00, 0x67, 0x91, 0x30, 0xb3, 0x43,
+    0xde, 0xaa, 0xbd, 0x28, 0xf5, 0x62, 0x00, 0x00, 0x00, 0x58, 0x81, 0xe0, 0x58, 0x03, 0x00, 0x00,
+    0x00, 0xfc, 0x03, 0x1f, 0x66, 0xe6, 0x0a, 0x00, 0xea, 0x19, 0x71, 0x37, 0x13, 0xe2, 0xda, 0xa7,
+    0xa7, 0x4e, 0x6b, 0xb9, 0x14, 0xaf, 0xd4, 0x9f, 0x93, 0x04, 0x2f, 0x00, 0x00, 0x00, 0xb4, 0x3c,
+    0xc0, 0x16, 0xfe, 0x7c, 0x00, 0x40, 0xd6, 0x91, 0x51, 0x33, 0x67, 0x05, 0x00, 0x77, 0x8c, 0x24,
+    0x93, 0x75, 0xf1, 0xb3, 0xe5, 0x47, 0xa9, 0x17, 0x03, 0x00, 0x00, 0x80, 0x2a, 0x04, 0xe4, 0x15,
+    0x00, 0x00, 0x00, 0xde, 0x1b, 0xe0, 0x3f, 0x13, 0x5c, 0x00, 0x40, 0xe3, 0x48, 0x8d, 0xb8, 0xa2,
+    0x02, 0x80, 0x5c, 0x45, 0xd4, 0xd5, 0xbb, 0xba, 0xb0, 0xfa, 0x1e, 0xa4, 0x79, 0x01, 0x00, 0x00,
+    0x80, 0xdd, 0x81, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x31, 0x10, 0x7c, 0x89, 0x01, 0x2a, 0x00, 0xb0,
+    0x65, 0x84, 0x35, 0x7d, 0xa0, 0xb3, 0xe5, 0x5e, 0x3a, 0xa2, 0x12, 0x00, 0x00, 0x00, 0xd2, 0x21,
+    0x00, 0x99, 0x00, 0x00, 0x00, 0xe0, 0x16, 0x81, 0x65, 0x78, 0x79, 0x02, 0x80, 0x59, 0x47, 0xb2,
+    0xca, 0x17, 0x13, 0x00, 0xe0, 0x2d, 0x32, 0x6a, 0xb6, 0xca, 0x5d, 0xb6, 0x1f, 0x25, 0xc4, 0x0b,
+    0x00, 0x00, 0x00, 0x6b, 0x10, 0x34, 0x65, 0x00, 0x00, 0x00, 0x80, 0x81, 0xa0, 0xb8, 0x2c, 0x57,
+    0x01, 0x40, 0x4d, 0x23, 0xa6, 0xe6, 0xe6, 0xdb, 0x9f, 0x74, 0xd5, 0x91, 0x2c, 0x97, 0xe2, 0xb3,
+    0xfa, 0x77, 0x92, 0xd4, 0x05, 0x00, 0x00, 0x80, 0xb6, 0x07, 0x26, 0xc0, 0xe1, 0x0c, 0x00, 0xc8,
+    0x3b, 0x62, 0x6a, 0x1e, 0xab, 0x00, 0xe0, 0x96, 0x91, 0x4f, 0x32, 0x27, 0x4e, 0xb3, 0x3c, 0x29,
+    0x7d, 0x5c, 0x00, 0x00, 0x00, 0x50, 0x87, 0x80, 0x92, 0x02, 0x00, 0x00, 0xc0, 0x8b, 0x03, 0x93,
+    0x67, 0x1c, 0x0b, 0x00, 0xe8, 0x1c, 0x79, 0x0e, 0x93, 0x51, 0x00, 0x90, 0xaf, 0x88, 0xbd, 0x3a,
+    0x5e, 0x37, 0x5a, 0xff, 0x83, 0xa4, 0x2e, 0x00, 0x00, 0x00, 0xb0, 0x3c, 0xe0, 0xdb, 0x01, 0x00,
+    0x00, 0x20, 0x0e, 0x82, 0x29, 0xf1, 0x3a, 0x05, 0x00, 0xf6, 0x8c, 0x4c, 0xa4, 0x5f, 0xf2, 0x7f,
+    0xdb, 0x4d, 0xc7, 0xfb, 0x01, 0x00, 0x00, 0x40, 0x4a, 0x04, 0xe8, 0x11, 0x00, 0x00, 0x00, 0x5c,
+    0x23, 0x88, 0x07, 0x73, 0x4a, 0x00, 0x30, 0xef, 0x48, 0x3b, 0x79, 0x4c, 0x02, 0x00, 0xdc, 0x45,
+    0xbe, 0xcd, 0x92, 0xf9, 0xe2, 0xf6, 0xa4, 0xb4, 0x60, 0x01, 0x00, 0x00, 0x60, 0x15, 0x82, 0xe0,
+    0x0b, 0x00, 0x00, 0x00, 0x70, 0x10, 0x58, 0x95, 0xfb, 0x29, 0x00, 0xa8, 0x6b, 0x84, 0xc9, 0xfc,
+    0x6e, 0x01, 0x80, 0xbe, 0x22, 0x7a, 0x65, 0x57, 0x5c, 0x5b, 0x7f, 0x4f, 0xe2, 0xb8, 0x00, 0x00,
+    0x00, 0xd0, 0xfa, 0x00, 0xa4, 0xd7, 0x20, 0x01, 0x00, 0x99, 0x47, 0x58, 0xcd, 0x36, 0x15, 0x00,
+    0xdc, 0x33, 0x32, 0x46, 0xd6, 0xc2, 0x6d, 0x95, 0x2f, 0xa5, 0x81, 0x0a, 0x00, 0x00, 0x00, 0x2a,
+    0x11, 0x88, 0x4d, 0x00, 0x00, 0x00, 0x78, 0x73, 0xc0, 0xe0, 0xac, 0x52, 0x01, 0x00, 0xad, 0x23,
+    0x6c, 0x61, 0xdb, 0x09, 0x00, 0x72, 0x16, 0xc9, 0x57, 0x7b, 0xec, 0xb5, 0xeb, 0x83, 0x10, 0xbb,
+    0x05, 0x00, 0x00, 0x00, 0xb6, 0x07, 0xae, 0x36, 0x00, 0x00, 0x00, 0xc4, 0x42, 0x10, 0x24, 0x6e,
+    0xa6, 0x00, 0xc0, 0xa6, 0x91, 0x2f, 0x74, 0x08, 0xae, 0x17, 0xfb, 0xe9, 0xc0, 0x30, 0x00, 0x00,
+    0x00, 0x48, 0x8b, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x7b, 0x04, 0x2b, 0xe0, 0x8c, 0x08, 0x00,
+    0x66, 0x1e, 0x69, 0x24, 0x2b, 0x47, 0x00, 0x80, 0xbf, 0x08, 0xc3, 0x79, 0x36, 0x97, 0xdd, 0xbe,
+    0x94, 0x1a, 0x28, 0x00, 0x00, 0x00, 0xac, 0x43, 0x20, 0x63, 0x01, 0x00, 0x00, 0x00, 0x16, 0x82,
+    0x6a, 0xb2, 0x17, 0x05, 0x00, 0xb5, 0x8d, 0xa4, 0x97, 0xf3, 0x2b, 0x00, 0xd0, 0x59, 0x44, 0xac,
+    0x4c, 0x8b, 0x07, 0xec, 0xff, 0x49, 0xe9, 0x16, 0x00, 0x00, 0x00, 0xda, 0x1f, 0x48, 0xe7, 0x00,
+    0x00, 0x00, 0x20, 0xf7, 0x80, 0xac, 0x99, 0xa1, 0x02, 0x80, 0x9b, 0x46, 0x2a, 0xc8, 0xfa, 0x37,
+    0x79, 0xf2, 0xa6, 0xc4, 0x23, 0x01, 0x00, 0x00, 0x40, 0x2d, 0x02, 0x30, 0x09, 0x00, 0x00, 0x00,
+    0xaf, 0x0e, 0x48, 0x99, 0x7f, 0x27, 0x00, 0xa0, 0x77, 0x04, 0x23, 0xac, 0x31, 0x01, 0x40, 0xde,
+    0x22, 0xf6, 0x6a, 0x9e, 0x7d, 0x80, 0xfd, 0x10, 0x12, 0xb3, 0x00, 0x00, 0x00, 0xc0, 0xfa, 0x40,
+    0x29, 0x06, 0x00, 0x00, 0x80, 0x78, 0x08, 0x4c, 0xc4, 0x9d, 0x14, 0x00, 0xd8, 0x35, 0x02, 0x79,
+    0x06, 0xb7, 0x00, 0x60, 0x47, 0x11, 0x3f, 0x03, 0x00, 0x00, 0x00, 0xa9, 0x51, 0x44, 0x40, 0x00,
+    0x00, 0x00, 0x70, 0x91, 0x60, 0xe7, 0xeb, 0xf1, 0x00, 0xc0, 0xdc, 0x23, 0x42, 0x64, 0xac, 0x08,
+    0x00, 0x70, 0x18, 0x51, 0x39, 0xe7, 0xe6, 0x9a, 0xdb, 0x9b, 0x90, 0x60, 0x04, 0x00, 0x00, 0x80,
+    0x95, 0x08, 0x34, 0x29, 0x00, 0x00, 0x00, 0xc0, 0x43, 0xc0, 0x43, 0xde, 0x9c, 0x00, 0xa0, 0xbe,
+    0x91, 0xbe, 0xf2, 0x3a, 0x05, 0x00, 0x7a, 0x8b, 0x34, 0x95, 0x7b, 0xf1, 0x95, 0xfd, 0x41, 0x09,
+    0xd3, 0x02, 0x00, 0x00, 0x40, 0x0b, 0x04, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x64, 0x1f, 0xa8, 0x35,
+    0x7f, 0x53, 0x00, 0x70, 0xd7, 0xc8, 0xeb, 0x78, 0xee, 0x1e, 0x45, 0xfe, 0x74, 0xc8, 0x1c, 0x00,
+    0x00, 0x00, 0xa8, 0x46, 0x10, 0x19, 0x01, 0x00, 0x00, 0xe0, 0xdd, 0x81, 0xb5, 0x32, 0x77, 0x04,
+    0x00, 0x34, 0x8f, 0x40, 0x83, 0x15, 0x25, 0x00, 0xc8, 0x5d, 0xc4, 0x5b, 0x2d, 0xb4, 0x6f, 0xb0,
+    0x2f, 0x4a, 0xb1, 0x15, 0x00, 0x00, 0x00, 0xd8, 0x1f, 0x28, 0xad, 0x00, 0x00, 0x00, 0x10, 0x13,
+    0x81, 0x80, 0x38, 0x8c, 0x02, 0x00, 0xdb, 0x46, 0x5e, 0xcd, 0x72, 0x15, 0x00, 0xec, 0x29, 0x12,
+    0xf5, 0x00, 0x00, 0x00, 0xc0, 0x4d, 0x82, 0x13, 0xef, 0x21, 0x03, 0x00, 0xb3, 0x8f, 0x0c, 0x90,
+    0x0f, 0x22, 0x00, 0xc0, 0x63, 0x04, 0xe6, 0xbc, 0x99, 0xbb, 0x6c, 0x7f, 0x42, 0xe9, 0x0d, 0x00,
+    0x00, 0x00, 0xd6, 0x22, 0xa0, 0x98, 0x00, 0x00, 0x00, 0x00, 0x13, 0x41, 0xe1, 0x98, 0x53, 0x02,
+    0x80, 0x1a, 0x47, 0x22, 0xca, 0xcb, 0x13, 0x00, 0xe8, 0x2e, 0x22, 0x53, 0x36, 0xc6, 0x99, 0xf6,
+    0x0f, 0xa5, 0x1a, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x8c, 0x64, 0x00, 0x00, 0x00, 0x90, 0x7f,
+    0x80, 0xd5, 0x6c, 0x4a, 0x01, 0xc0, 0x6d, 0x23, 0x3a, 0xe3, 0x65, 0x9b, 0xd9, 0x78, 0xd4, 0x19,
+    0x42, 0x00, 0x00, 0x00, 0xa0, 0x1e, 0xc5, 0x3b, 0x04, 0x00, 0x00, 0x80, 0x97, 0x07, 0x96, 0xc8,
+    0x3f, 0x0f, 0x00, 0xd0, 0x3d, 0x72, 0x09, 0x96, 0x90, 0x00, 0x20, 0x7f, 0x11, 0x5a, 0xf5, 0xc9,
+    0x1e, 0xbf, 0xfe, 0x28, 0xed, 0x52, 0x00, 0x00, 0x00, 0x60, 0x81, 0x60, 0x49, 0x02, 0x00, 0x00,
+    0x40, 0x5c, 0x04, 0xcf, 0x61, 0x02, 0x0a, 0x00, 0xec, 0x1b, 0x29, 0x2e, 0x6b, 0x4f, 0x00, 0xb0,
+    0xab, 0x08, 0xae, 0x03, 0x00, 0x00, 0x00, 0x57, 0x09, 0xc0, 0xb9, 0xbb, 0x08, 0x00, 0xcc, 0x3f,
+    0xa2, 0x3c, 0x76, 0x86, 0x00, 0x00, 0x97, 0x91, 0x90, 0xf3, 0x54, 0xce, 0xa5, 0x3d, 0x0a, 0xd9,
+    0x21, 0x00, 0x00, 0x00, 0x58, 0x8d, 0xe2, 0x32, 0x02, 0x00, 0x00, 0x00, 0x5c, 0x04, 0xb0, 0xe2,
+    0xaa, 0x08, 0x00, 0xea, 0x1c, 0x59, 0x25, 0xa3, 0x4a, 0x00, 0xa0, 0xbf, 0xc8, 0x45, 0xd9, 0x18,
+    0xf7, 0xda, 0x5f, 0x94, 0x38, 0x2b, 0x00, 0x00, 0x00, 0xb4, 0x42, 0x40, 0x70, 0x01, 0x00, 0x00,
+    0x40, 0x06, 0x82, 0x4b, 0xf3, 0x16, 0x05, 0x00, 0xf7, 0x8d, 0xcc, 0x8a, 0xf9, 0xeb, 0xc9, 0xe1,
+    0x53, 0xe7, 0x0e, 0x02, 0x00, 0x00, 0xc0, 0xdb, 0x03, 0xef, 0xe2, 0xc2, 0x05, 0x00, 0x68, 0x1f,
+    0x51, 0x03, 0xcb, 0x46, 0x00, 0x90, 0xc3, 0x88, 0x9c, 0xba, 0x5c, 0x6f, 0x5b, 0x9f, 0x94, 0x0c,
+    0x27, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x50, 0xe8, 0x00, 0x00, 0x00, 0x20, 0x36, 0x02, 0xc5, 0xf0,
+    0xe3, 0x04, 0x00, 0x36, 0x8e, 0x48, 0x93, 0x3d, 0x24, 0x00, 0xd8, 0x57, 0xe4, 0xc0, 0x01, 0x00,
+    0x00, 0x80, 0xbb, 0x04, 0x6c, 0x1b, 0x00, 0x00, 0x00, 0x66, 0x20, 0xa0, 0x1c, 0x6f, 0x42, 0x00,
+    0x80, 0xcf, 0x08, 0xbd, 0x19, 0x1b, 0xd7, 0xc7, 0x3e, 0x75, 0x76, 0x20, 0x00, 0x00, 0x00, 0xc0,
+    0x46, 0xa0, 0x1b, 0xbe, 0x7d, 0x00, 0xa0, 0xd6, 0x11, 0x27, 0xb2, 0x63, 0x04, 0x00, 0x3a, 0x8c,
+    0xd8, 0x93, 0x75, 0xf1, 0xad, 0xfd, 0x47, 0xa8, 0x99, 0x02, 0x00, 0x00, 0x40, 0x3b, 0x04, 0xca,
+    0x14, 0x00, 0x00, 0x00, 0xe4, 0x20, 0x98, 0x33, 0xd7, 0x4f, 0x00, 0x70, 0xe3, 0x48, 0x87, 0x58,
+    0xa2, 0x02, 0x00, 0x5e, 0x45, 0x40, 0x20, 0x00, 0x00, 0x00, 0xbc, 0x3e, 0xb0, 0x14, 0x56, 0x22,
+    0x00, 0x80, 0xfe, 0x91, 0x24, 0x70, 0x58, 0x04, 0x00, 0x79, 0x8c, 0x48, 0xa8, 0xed, 0xf4, 0x38,
+    0xf5, 0x4b, 0x29, 0x3e, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x04, 0xfc, 0x09, 0x00, 0x00, 0x00, 0xe2,
+    0x23, 0x80, 0x09, 0xb7, 0x4b, 0x00, 0x60, 0xe7, 0x08, 0xfa, 0xb8, 0x09, 0x02, 0x80, 0x9d, 0x45,
+    0x76, 0x1a, 0x00, 0x00, 0x00, 0xb8, 0x4c, 0xf0, 0x9b, 0x01, 0x00, 0x00, 0x60, 0x0e, 0x82, 0xad,
+    0xb1, 0x1b, 0x04, 0x00, 0x38, 0x8d, 0xa4, 0x9a, 0x5b, 0xf0, 0x5b, 0xeb, 0x55, 0x47, 0xdf, 0x01,
+    0x00, 0x00, 0x00, 0x7c, 0x04, 0x9d, 0x60, 0xcc, 0x06, 0x00, 0xea, 0x1d, 0xe9, 0x1f, 0x03, 0x42,
+    0x00, 0xa0, 0xc7, 0x48, 0x32, 0xf9, 0x13, 0x8f, 0xd9, 0x9f, 0x84, 0x4e, 0x27, 0x00, 0x00, 0x00,
+    0xb4, 0x44, 0x60, 0x26, 0x01, 0x00, 0x00, 0x40, 0x16, 0x02, 0x1a, 0xb3, 0xd8, 0x04, 0x00, 0x77,
+    0x8e, 0xec, 0x85, 0x0f, 0x28, 0x00, 0xe0, 0x57, 0x84, 0xfc, 0x01, 0x00, 0x00, 0xc0, 0xfb, 0x03,
+    0x50, 0x1f, 0x00, 0x00, 0x00, 0x68, 0x20, 0xa0, 0x01, 0xa3, 0x44, 0x00, 0x90, 0xcb, 0x88, 0x63,
+    0xda, 0x39, 0x87, 0x46, 0xdf, 0x74, 0xec, 0x1f, 0x00, 0x00, 0x00, 0xb0, 0x43, 0x00, 0x24, 0x00,
+    0x00, 0x00, 0x20, 0x46, 0x0a, 0x5f, 0xf0, 0x86, 0x04, 0x00, 0xb6, 0x8e, 0x10, 0x8c, 0xcf, 0x1c,
+    0x00, 0xd8, 0x5b, 0x64, 0x80, 0x01, 0x00, 0x00, 0x80, 0xdb, 0x04, 0xdf, 0x17, 0x00, 0x00, 0x00,
+    0x66, 0x21, 0xe0, 0x18, 0xd7, 0x40, 0x00, 0x80, 0xd7, 0xc8, 0x90, 0x79, 0xe8, 0xc6, 0x89, 0x7e,
+    0x75, 0xe4, 0x1b, 0x00, 0x00, 0x00, 0xc0, 0x48, 0x60, 0xf5, 0xb5, 0x55, 0x00, 0xa0, 0xe6, 0x91,
+    0xdd, 0x31, 0xe1, 0x03, 0x00, 0xba, 0x8c, 0x4c, 0x92, 0xdf, 0x70, 0x6d, 0xfd, 0x4b, 0x88, 0x44,
+    0x02, 0x00, 0x00, 0x40, 0x5b, 0x04, 0xe7, 0x0f, 0x00, 0x00, 0x00, 0xe4, 0x21, 0xe8, 0x2e, 0x67,
+    0x4a, 0x00, 0x70, 0xeb, 0x88, 0x35, 0xf8, 0x5c, 0x02, 0x00, 0x9e, 0x45, 0x50, 0x1f, 0x00, 0x00,
+    0x00, 0xbc, 0x40, 0x80, 0xcf, 0x01, 0x00, 0x00, 0x80, 0x0e, 0x02, 0x11, 0x30, 0x3e, 0x04, 0x00,
+    0xf9, 0x8c, 0xa4, 0xa3, 0xd5, 0xf1, 0xfe, 0xf2, 0x4f, 0xc7, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x4b,
+    0x04, 0x2e, 0xe0, 0x80, 0x08, 0x00, 0xec, 0x1d, 0x91, 0x11, 0xef, 0x31, 0x00, 0xb0, 0xbb, 0xc8,
+    0x9d, 0x02, 0x00, 0x00, 0x00, 0xd7, 0x09, 0x86, 0x2b, 0x00, 0x00, 0x00, 0xcc, 0x43, 0x40, 0x2d,
+    0x56, 0x7f, 0x00, 0x00, 0xb7, 0x11, 0xe1, 0xb2, 0x89, 0x05, 0x00, 0x3d, 0x8b, 0x14, 0x34, 0x00,
+    0x00, 0x00, 0x80, 0x93, 0x80, 0xbb, 0x0b, 0x60, 0x00, 0x40, 0xdd, 0x23, 0x88, 0xe3, 0x54, 0x07,
+    0x00, 0xf4, 0x19, 0x71, 0x22, 0x9f, 0xe0, 0x41, 0xfa, 0x9b, 0x90, 0x00, 0x04, 0x00, 0x00, 0x80,
+    0xd6, 0x08, 0x76, 0x1a, 0x00, 0x00, 0x00, 0xc8, 0x44, 0x20, 0x56, 0x46, 0x8c, 0x00, 0xe0, 0xde,
+    0x91, 0x18, 0xb0, 0x6c, 0x04, 0x00, 0x7c, 0x8b, 0xb0, 0x3d, 0x00, 0x00, 0x00, 0x78, 0x83, 0x20,
+    0x46, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x04, 0x13, 0xe0, 0x68, 0x08, 0x00, 0x72, 0x1a, 0x01, 0x41,
+    0x13, 0x5f, 0x00, 0xe0, 0xa3, 0x48, 0x5d, 0x02, 0x00, 0x00, 0x00, 0xb6, 0x08, 0xfa, 0xbe, 0x93,
+    0x0f, 0x00, 0xd8, 0x3c, 0x52, 0x17, 0x4e, 0x54, 0x00, 0x60, 0x7f, 0x11, 0xf9, 0x03, 0x00, 0x00,
+    0x00, 0xee, 0x13, 0x88, 0x4d, 0x00, 0x00, 0x00, 0x98, 0x89, 0xe0, 0x4e, 0x1c, 0xf8, 0x00, 0x00,
+    0x7e, 0x23, 0x23, 0xe5, 0x63, 0x0a, 0x00, 0xfa, 0x16, 0xe1, 0x61, 0x00, 0x00, 0x00, 0x00, 0x2b,
+    0x81, 0x0c, 0x07, 0x00, 0x00, 0x80, 0xda, 0x07, 0xc8, 0xc6, 0xf2, 0x0d, 0x00, 0xe8, 0x34, 0x42,
+    0x3f, 0xde, 0xbd, 0xa9, 0xf2, 0x3f, 0xa1, 0x7f, 0x06, 0x00, 0x00, 0x00, 0xed, 0x11, 0x88, 0x29,
+    0x00, 0x00, 0x00, 0x90, 0x8b, 0x60, 0x98, 0x7c, 0x01, 0x01, 0xc0, 0xcd, 0x23, 0x8c, 0x5f, 0x37,
+    0x08, 0x00, 0x78, 0x17, 0x61, 0x78, 0x00, 0x00, 0x00, 0xf0, 0x0a, 0xc1, 0xbb, 0x05, 0x00, 0x00,
+    0x00, 0x7a, 0x08, 0x02, 0xc0, 0xa1, 0x10, 0x00, 0xe4, 0x35, 0x62, 0x73, 0xb6, 0xb2, 0x00, 0xc0,
+    0x4f, 0x11, 0x39, 0x00, 0x00, 0x00, 0x00, 0xac, 0x51, 0x88, 0x7a, 0x4f, 0x1b, 0x00, 0xb0, 0x7b,
+    0x64, 0x1a, 0x9c, 0x8a, 0x00, 0xc0, 0x0e, 0x23, 0x03, 0x03, 0x00, 0x00, 0x00, 0x5c, 0xa8, 0xc8,
+    0x85, 0x00, 0x00, 0x00, 0x30, 0x17, 0xc1, 0x82, 0x78, 0xdd, 0x01, 0x00, 0x1c, 0x47, 0xea, 0xc8,
+    0x2f, 0x13, 0x00, 0xf4, 0x2e, 0x82, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x02, 0x29, 0x0d, 0x00,
+    0x00, 0x00, 0xf5, 0x0f, 0x24, 0x8d, 0x9b, 0x1a, 0x00, 0xd0, 0x6b, 0x04, 0x71, 0xec, 0x72, 0xb3,
+    0xdf, 0x8f, 0x3a, 0x22, 0x08, 0x00, 0x00, 0x00, 0x5a, 0xa4, 0x60, 0x39, 0x00, 0x00, 0x00, 0x20,
+    0x1b, 0x41, 0xfc, 0xf8, 0xc0, 0x01, 0x80, 0xbb, 0x47, 0xe6, 0xbd, 0x27, 0x0f, 0x00, 0xf0, 0x2f,
+    0x42, 0xe9, 0x00, 0x00, 0x00, 0xe0, 0x1d, 0x82, 0x73, 0x09, 0x00, 0x00, 0x00, 0x34, 0x11, 0xb0,
+    0x7f, 0xdd, 0x20, 0x00, 0xc8, 0x6d, 0x64, 0xc5, 0xdc, 0x49, 0x01, 0x80, 0xaf, 0x22, 0x9d, 0xdd,
+    0x80, 0x05, 0x00, 0x6c, 0x1f, 0x61, 0x02, 0x6f, 0x1b, 0x00, 0xb0, 0xc7, 0x88, 0x6a, 0x03, 0x00,
+    0x00, 0x80, 0xd9, 0x08, 0x02, 0xc3, 0x19, 0x0e, 0x00, 0xe0, 0x39, 0x22, 0x3b, 0x66, 0x8a, 0x00,
+    0xa0, 0x7f, 0x91, 0x71, 0x05, 0x00, 0x00, 0x00, 0x30, 0x13, 0xc0, 0x60, 0x00, 0x00, 0x00, 0xa8,
+    0x81, 0xe0, 0x66, 0x0c, 0xcc, 0x00, 0x80, 0x6e, 0x23, 0x07, 0x63, 0x3d, 0x1b, 0xb7, 0xfe, 0xd4,
+    0x91, 0x15, 0x00, 0x00, 0x00, 0x20, 0x1f, 0x01, 0xbb, 0x38, 0x63, 0x01, 0x80, 0xdb, 0x47, 0xcc,
+    0xbc, 0xe3, 0x0d, 0x00, 0xf0, 0x30, 0x82, 0xdc, 0x00, 0x00, 0x00, 0xe0, 0x25, 0x02, 0xe7, 0x06,
+    0x00, 0x00, 0x00, 0x74, 0x11, 0x2c, 0x7f, 0x41, 0x20, 0x00, 0xc8, 0x6f, 0xe4, 0x9f, 0xac, 0x28,
+    0x01, 0x80, 0xbf, 0x22, 0x62, 0xdc, 0x64, 0x03, 0x00, 0xec, 0x1f, 0xe9, 0xfe, 0x66, 0x14, 0x00,
+    0xb0, 0xcb, 0x88, 0x80, 0x02, 0x00, 0x00, 0x80, 0xf9, 0x08, 0xb2, 0xc1, 0xf3, 0x0c, 0x00, 0xe0,
+    0x3a, 0x62, 0x2e, 0x3e, 0x79, 0x00, 0xa0, 0x87, 0x91, 0x05, 0x05, 0x00, 0x00, 0x00, 0x70, 0x13,
+    0x18, 0x57, 0x00, 0x00, 0x00, 0xa8, 0x83, 0xe0, 0x63, 0x3c, 0xc3, 0x00, 0x80, 0x7e, 0x23, 0x71,
+    0x62, 0xce, 0x0a, 0x00, 0x7e, 0x15, 0x29, 0x0d, 0xa3, 0x17, 0x00, 0x70, 0xff, 0xc8, 0x7a, 0xd7,
+    0x95, 0x01, 0x00, 0x3e, 0x46, 0x80, 0x19, 0x00, 0x00, 0x00, 0xbc, 0x45, 0x10, 0x56, 0x00, 0x00,
+    0x00, 0x80, 0x36, 0x8a, 0xcd, 0xaf, 0xee, 0x03, 0x00, 0x39, 0x8e, 0x04, 0x8f, 0x2f, 0x20, 0x00,
+    0xf0, 0x59, 0x04, 0x5d, 0x03, 0x00, 0x00, 0x80, 0x0d, 0x04, 0x86, 0x5f, 0xb3, 0x01, 0x00, 0xf6,
+    0x19, 0x81, 0x25, 0x00, 0x00, 0x00, 0x30, 0x23, 0x05, 0x04, 0x38, 0x6c, 0x01, 0x00, 0x7c, 0x47,
+    0x34, 0xc4, 0xa8, 0x0c, 0x00, 0xf4, 0x31, 0x72, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x76, 0x02, 0x87,
+    0x09, 0x00, 0x00, 0x00, 0xb5, 0x10, 0x1c, 0x8c, 0x4d, 0x17, 0x00, 0xd0, 0x71, 0x64, 0x38, 0xec,
+    0x48, 0x01, 0xc0, 0xbf, 0x22, 0x16, 0x20, 0x00, 0x00, 0x00, 0x6e, 0x20, 0xf8, 0xeb, 0x22, 0x2e,
+    0x00, 0xc0, 0xcb, 0x48, 0xcc, 0x02, 0x00, 0x00, 0x80, 0xd7, 0x08, 0xb2, 0xbe, 0x27, 0x0f, 0x00,
+    0xe4, 0x39, 0x12, 0x27, 0x1e, 0x69, 0x00, 0xc0, 0x6f, 0x91, 0x94, 0x0c, 0x00, 0x00, 0x00, 0x76,
+    0x10, 0xf8, 0x7c, 0x3d, 0x03, 0x00, 0xd8, 0x69, 0xc4, 0xe4, 0x7b, 0x92, 0x00, 0x00, 0xce, 0x23,
+    0x4e, 0xe1, 0xd5, 0x04, 0x00, 0x7a, 0x19, 0x51, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x41, 0xfb,
+    0x03, 0x00, 0x00, 0x80, 0x7a, 0x08, 0xba, 0xc5, 0xe0, 0x0a, 0x00, 0xe8, 0x39, 0x32, 0x10, 0x86,
+    0x9a, 0x00, 0xe0, 0x67, 0x11, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x77, 0x10, 0xb8, 0x74, 0x0d, 0x15,
+    0x00, 0xe0, 0x67, 0xe4, 0x1e, 0x01, 0x00, 0x00, 0xc0, 0x7b, 0x04, 0x02, 0x5f, 0x32, 0x07, 0x00,
+    0x72, 0x1d, 0xc1, 0x08, 0x8f, 0x25, 0x00, 0xe0, 0xbb, 0x88, 0xc5, 0x05, 0x00, 0x00, 0x00, 0x5b,
+    0x08, 0x04, 0x3e, 0x00, 0x00, 0x00, 0xec, 0xb5, 0x91, 0xe0, 0xad, 0x2a, 0x00, 0x00, 0xef, 0x11,
+    0x47, 0x30, 0x68, 0x01, 0x00, 0xfd, 0x8c, 0x48, 0x12, 0x00, 0x00, 0x00, 0x80, 0xa1, 0x00, 0x83,
+    0x01, 0x00, 0x00, 0x40, 0x4d, 0x04, 0xa4, 0x62, 0xf8, 0x04, 0x00, 0x74, 0x1d, 0x89, 0x01, 0x7f,
+    0x47, 0x00, 0xf0, 0xb7, 0x88, 0xf4, 0x06, 0x00, 0x00, 0x80, 0x5b, 0x08, 0xd8, 0xb9, 0x9f, 0x09,
+    0x00, 0xf0, 0x34, 0x02, 0x51, 0x00, 0x00, 0x00, 0xe0, 0x45, 0x8a, 0x46, 0xef, 0x54, 0x03, 0x00,
+    0xf9, 0x8e, 0xf0, 0x7e, 0x77, 0x05, 0x00, 0xf0, 0x5f, 0x64, 0x94, 0x02, 0x00, 0x00, 0x80, 0x3d,
+    0x04, 0xc9, 0x1e, 0x00, 0x00, 0x00, 0x76, 0xdb, 0xf8, 0xe5, 0x00, 0x00, 0x00, 0x80, 0xfb, 0x00,
+    0xf8, 0x07, 0x00, 0x00, 0x80, 0x9e, 0x36, 0xda, 0x0d, 0x00, 0x00, 0x00, 0xd4, 0x45, 0xd1, 0x24,
+    0xce, 0x43, 0x00, 0x40, 0xdf, 0x91, 0xa9, 0x6f, 0x0d, 0x04, 0x00, 0xbf, 0x8b, 0xd8, 0x63, 0x00,
+    0x00, 0x00, 0xb8, 0x87, 0x80, 0x97, 0xfb, 0x8d, 0x00, 0x00, 0x5f, 0x23, 0xf7, 0xdd, 0xe9, 0x05,
+    0x00, 0x72, 0x1e, 0x79, 0xf3, 0x00, 0x00, 0x00, 0xe0, 0xc3, 0x40, 0x6a, 0x04, 0x00, 0x00, 0x00,
+    0x9b, 0x08, 0x14, 0x3d, 0x00, 0x00, 0x00, 0xec, 0xb7, 0x61, 0xb3, 0x01, 0x00, 0x00, 0x00, 0xff,
+    0x81, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x7d, 0x0d, 0x54, 0x87, 0x55, 0x0c, 0x00, 0xd0, 0x79, 0xc4,
+    0xcc, 0x9b, 0xe4, 0x00, 0xc0, 0xff, 0x22, 0x69, 0x15, 0x00, 0x00, 0x00, 0x6e, 0x22, 0xc0, 0xe4,
+    0xde, 0x20, 0x00, 0xc0, 0xdb, 0xc8, 0x4d, 0xd7, 0x35, 0x01, 0x80, 0xbc, 0x47, 0x62, 0x3a, 0x00,
+    0x00, 0x00, 0xf8, 0x31, 0x50, 0xdf, 0x00, 0x00, 0x00, 0xc0, 0x2e, 0x82, 0x22, 0x0f, 0x00, 0x00,
+    0x00, 0x3b, 0x6e, 0xd0, 0x65, 0x00, 0x00, 0x00, 0xc0, 0x81, 0xc0, 0xd8, 0x03, 0x00, 0x00, 0x40,
+    0x6f, 0x03, 0x2d, 0x21, 0x00, 0x00, 0x00, 0xf4, 0xde, 0xc8, 0xeb, 0x62, 0x30, 0x00, 0xf0, 0xc3,
+    0x88, 0x33, 0x04, 0x00, 0x00, 0x80, 0xbb, 0x08, 0x00, 0xb9, 0xb3, 0x07, 0x00, 0xf0, 0x37, 0x02,
+    0xc5, 0xfd, 0x31, 0x00, 0x20, 0xf7, 0x91, 0x08, 0x0e, 0x00, 0x00, 0x00, 0xbe, 0x0c, 0x10, 0x23,
+    0x00, 0x00, 0x00, 0xb0, 0x8d, 0xa2, 0xbc, 0x03, 0x00, 0x00, 0xc0, 0x9e, 0x03, 0x5b, 0x17, 0x00,
+    0x00, 0x00, 0xf0, 0x20, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xd0, 0xdf, 0x00, 0x16, 0x08, 0x00, 0x00,
+    0x00, 0xdd, 0x37, 0x18, 0xb9, 0x7b, 0x09, 0x00, 0xfc, 0x31, 0x42, 0xa1, 0x00, 0x00, 0x00, 0xe0,
+    0x36, 0x8a, 0x32, 0xae, 0xc9, 0x01, 0x00, 0x3c, 0x8e, 0xa8, 0x6c, 0x00, 0x00, 0x00, 0xc8, 0x7f,
+    0xa0, 0x62, 0x03, 0x00, 0x00, 0x80, 0x3f, 0x03, 0x76, 0x1d, 0x00, 0x00, 0x00, 0x76, 0x1d, 0x88,
+    0xa7, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x41, 0x82, 0x07, 0x00, 0x00, 0x80, 0x1e, 0x07, 0x82, 0x3e,
+    0x00, 0x00, 0x00, 0xe8, 0x3f, 0x20, 0xba, 0x1d, 0x30, 0x00, 0xe0, 0x97, 0x11, 0x25, 0x2e, 0xa1,
+    0x01, 0x00, 0x7c, 0x8e, 0x20, 0x67, 0x00, 0x00, 0x00, 0xc8, 0x81, 0xa0, 0x47, 0x03, 0x00, 0x00,
+    0x80, 0x4f, 0x03, 0xe0, 0x1c, 0x00, 0x00, 0x00, 0xf6, 0x1d, 0x18, 0x90, 0x00, 0x00, 0x00, 0x80,
+    0x0f, 0x01, 0x71, 0x07, 0x00, 0x00, 0x80, 0x3e, 0x07, 0xc4, 0x3b, 0x00, 0x00, 0x00, 0xe8, 0x40,
+    0xa0, 0xac, 0x01, 0x00, 0x00, 0xe0, 0x9f, 0x81, 0x11, 0xae, 0x69, 0x01, 0x00, 0xbc, 0x8e, 0x54,
+    0x60, 0x00, 0x00, 0x00, 0xc8, 0x83, 0x40, 0x32, 0x03, 0x00, 0x00, 0x80, 0x5f, 0x03, 0x2f, 0x1c,
+    0x00, 0x00, 0x00, 0x76, 0x1e, 0x68, 0x73, 0x00, 0x00, 0x00, 0x80, 0x13, 0x81, 0x60, 0x07, 0x00,
+    0x00, 0x80, 0x5e, 0x07, 0x4c, 0x38, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x40, 0xa0, 0x01, 0x00, 0x00,
+    0xe0, 0xa7, 0x01, 0xf8, 0xad, 0x18, 0x01, 0x00, 0xfc, 0x8e, 0x14, 0x58, 0x00, 0x00, 0x00, 0xc8,
+    0x85, 0x40, 0x20, 0x03, 0x00, 0x00, 0x80, 0x6f, 0x03, 0x45, 0x1b, 0x00, 0x00, 0x00, 0xf6, 0x1e,
+    0x08, 0x4c, 0x00, 0x00, 0x00, 0x80, 0x17, 0x81, 0x51, 0x07, 0x00, 0x00, 0x80, 0x7e, 0x07, 0xf6,
+    0x33, 0x00, 0x00, 0x00, 0xe8, 0x42, 0x60, 0x95, 0x01, 0x00, 0x00, 0xe0, 0xaf, 0x01, 0xd1, 0x6d,
+    0x44, 0x00, 0x00, 0x3c, 0x8f, 0xb8, 0x4d, 0x00, 0x00, 0x00, 0xc8, 0x87, 0xe0, 0x13, 0x03, 0x00,
+    0x00, 0x80, 0x7f, 0x03, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x76, 0x1f, 0xc0, 0xe7, 0x00, 0x00, 0x00,
+    0xd0, 0xf3, 0x40, 0xcf, 0x05, 0x00, 0x00, 0x00, 0x7d, 0x08, 0x80, 0x31, 0x00, 0x00, 0x00, 0xfc,
+    0x36, 0x90, 0xb3, 0x01, 0x00, 0x00, 0x80, 0xef, 0x01, 0x19, 0x08, 0x00, 0x00, 0x00, 0x39, 0x11,
+    0x50, 0x61, 0x00, 0x00, 0x00, 0xf0, 0x71, 0x80, 0x1c, 0x03, 0x00, 0x00, 0xc0, 0xfe, 0x03, 0x98,
+    0x1c, 0x00, 0x00, 0x00, 0xfa, 0x1e, 0xb0, 0x9d, 0x00, 0x00, 0x00, 0xa0, 0x13, 0x41, 0x11, 0x06,
+    0x00, 0x00, 0x80, 0xff, 0x06, 0x4c, 0x35, 0x00, 0x00, 0x00, 0xf0, 0x3e, 0x80, 0xbb, 0x00, 0x00,
+    0x00, 0x20, 0x2f, 0x02, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0x0e, 0x30, 0x5d, 0x00, 0x00, 0x00,
+    0xd8, 0x81, 0x20, 0x82, 0x03, 0x00, 0x00, 0x40, 0xef, 0x03, 0xe5, 0x0e, 0x00, 0x00, 0x00, 0xf4,
+    0x22, 0x40, 0xbf, 0x00, 0x00, 0x00, 0xf0, 0xe3, 0x80, 0x7c, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x07,
+    0x38, 0x07, 0x00, 0x00, 0x00, 0xe4, 0x46, 0x91, 0x7d, 0x01, 0x00, 0x00, 0xc0, 0xd7, 0x81, 0xae,
+    0x0a, 0x00, 0x00, 0x00, 0x7b, 0x10, 0x98, 0x6d, 0x00, 0x00, 0x00, 0xe8, 0x7f, 0xc0, 0xd8, 0x00,
+    0x00, 0x00, 0x80, 0x6e, 0x14, 0x9a, 0x17, 0x00, 0x00, 0x00, 0xfe, 0x1c, 0xc8, 0xc7, 0x00, 0x00,
+    0x00, 0xc0, 0x03, 0x01, 0xe8, 0x05, 0x00, 0x00, 0x00, 0x7f, 0x07, 0x0a, 0x26, 0x00, 0x00, 0x00,
+    0xec, 0x42, 0x60, 0xa7, 0x01, 0x00, 0x00, 0xa0, 0x07, 0x82, 0xb0, 0x0b, 0x00, 0x00, 0x00, 0xbf,
+    0x0e, 0x34, 0x5f, 0x00, 0x00, 0x00, 0xe0, 0x83, 0xe0, 0xe9, 0x02, 0x00, 0x00, 0x80, 0xcf, 0x03,
+    0x17, 0x10, 0x00, 0x00, 0x00, 0xf6, 0x21, 0x08, 0xca, 0x00, 0x00, 0x00, 0xd0, 0x07, 0xc1, 0xca,
+    0x05, 0x00, 0x00, 0x80, 0x7f, 0x07, 0x82, 0x2c, 0x00, 0x00, 0x00, 0xf0, 0x42, 0x30, 0x6e, 0x01,
+    0x00, 0x00, 0xc0, 0xef, 0x01, 0x1b, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x11, 0xa4, 0x5e, 0x00, 0x00,
+    0x00, 0xe8, 0x85, 0xc0, 0xdf, 0x02, 0x00, 0x00, 0xc0, 0xcf, 0x03, 0x58, 0x14, 0x00, 0x00, 0x00,
+    0xf8, 0x21, 0x80, 0xb2, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0x00, 0x86, 0x01, 0x00, 0x00, 0x80, 0xbd,
+    0x28, 0x44, 0x2b, 0x00, 0x00, 0x00, 0xf4, 0x43, 0xc0, 0x6b, 0x01, 0x00, 0x00, 0xe0, 0xef, 0x81,
+    0xe9, 0x08, 0x00, 0x00, 0x00, 0x3c, 0x11, 0x40, 0x56, 0x00, 0x00, 0x00, 0xf0, 0x7f, 0x60, 0x5b,
+    0x02, 0x00, 0x00, 0x40, 0x4f, 0x04, 0x71, 0x16, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0x58, 0x74, 0x00,
+    0x00, 0x00, 0xc0, 0x17, 0x81, 0x23, 0x05, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x4e, 0x1e, 0x00, 0x00,
+    0x00, 0xf4, 0x45, 0x20, 0x60, 0x01, 0x00, 0x00, 0xe0, 0xff, 0x81, 0xd2, 0x04, 0x00, 0x00, 0x00,
+    0xbc, 0x11, 0x10, 0x4d, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x40, 0x28, 0x01, 0x00, 0x00, 0x40, 0x6f,
+    0x14, 0x6f, 0x15, 0x00, 0x00, 0x00, 0x7e, 0x20, 0xb8, 0x8c, 0x00, 0x00, 0x00, 0xe0, 0x0b, 0x01,
+    0x28, 0x05, 0x00, 0x00, 0x80, 0x3f, 0x08, 0xea, 0x1e, 0x00, 0x00, 0x00, 0xf8, 0x43, 0x50, 0x39,
+    0x01, 0x00, 0x00, 0xe0, 0x17, 0x82, 0x43, 0x06, 0x00, 0x00, 0x00, 0x3e, 0x11, 0xb4, 0x48, 0x00,
+    0x00, 0x00, 0xf8, 0x87, 0x00, 0x08, 0x01, 0x00, 0x00, 0x80, 0x5f, 0x04, 0x4a, 0x10, 0x00, 0x00,
+    0x00, 0x7e, 0x22, 0xb0, 0x6d, 0x00, 0x00, 0x00, 0xf0, 0x17, 0x41, 0x7e, 0x02, 0x00, 0x00, 0x80,
+    0xdf, 0x08, 0x72, 0x03, 0x00, 0x00, 0x00, 0xfc, 0x47, 0x01
+};
+
+#endif /* ECLIPSE_INFO_MODERN_COMPACT_H */
@@ -32,13 +32,17 @@
 #  define ECLIPSE_ATTR           /* nothing */
 #endif
 
+#ifndef ECLIPSE_CONST
+#  define ECLIPSE_CONST          const   /* constexpr under SarosCatalog.h */
+#endif
+
 #define ECLIPSE_MODERN_COUNT       4657u
 #define ECLIPSE_MODERN_SAROS_FIRST 110u
 #define ECLIPSE_MODERN_SAROS_LAST  173u
 
 /* eclipse_times_modern[] — sorted int64_t timestamps, 8 bytes each.
  * Size: 37,256 bytes */
-static const uint8_t eclipse_times_modern[37256u] ECLIPSE_ATTR = {
+static ECLIPSE_CONST uint8_t eclipse_times_modern[37256u] ECLIPSE_ATTR = {
     0xf6, 0x69, 0x5e, 0x04, 0xf7, 0xff, 0xff, 0xff, 0x36, 0x38, 0x48, 0x26, 0xf7, 0xff, 0xff, 0xff,
     0x45, 0x06, 0x32, 0x48, 0xf7, 0xff, 0xff, 0xff, 0xa7, 0xd4, 0x1b, 0x6a, 0xf7, 0xff, 0xff, 0xff,
     0xa6, 0xa3, 0x05, 0x8c, 0xf7, 0xff, 0xff, 0xff, 0x52, 0x18, 0x8e, 0xa0, 0xf7, 0xff, 0xff, 0xff,
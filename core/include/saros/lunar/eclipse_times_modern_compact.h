@@ -0,0 +1,1211 @@
+/*
+ * Auto-generated by build_compact_db.py — DO NOT EDIT
+ *
+ * Sorted timestamps, frame-of-reference packed in blocks of 32.
+ * Saros range : 110–173
+ * Eclipses    : 4657
+ * Flash usage : 18,491 bytes (18.1 KB)
+ *
+ * Usage: #define SAROS_USE_COMPACT in the lunar implementation unit, which
+ * then includes this header instead of the raw one.  ECLIPSE_USE_PROGMEM
+ * works as for the raw headers.
+ */
+
+#ifndef ECLIPSE_TIMES_MODERN_COMPACT_H
+#define ECLIPSE_TIMES_MODERN_COMPACT_H
+
+#include <stdint.h>
+
+#ifdef ECLIPSE_USE_PROGMEM
+#  include <avr/pgmspace.h>
+#  define ECLIPSE_READ_BYTE(p)   pgm_read_byte(p)
+#  define ECLIPSE_READ_WORD(p)   pgm_read_word(p)
+#  define ECLIPSE_READ_DWORD(p)  pgm_read_dword(p)
+#  define ECLIPSE_ATTR           PROGMEM
+#else
+#  define ECLIPSE_READ_BYTE(p)   (*(const uint8_t  *)(p))
+#  define ECLIPSE_READ_WORD(p)   (*(const uint16_t *)(p))
+#  define ECLIPSE_READ_DWORD(p)  (*(const uint32_t *)(p))
+#  define ECLIPSE_ATTR           /* nothing */
+#endif
+
+#define ECLIPSE_MODERN_COUNT       4657u
+#define ECLIPSE_MODERN_SAROS_FIRST 110u
+#define ECLIPSE_MODERN_SAROS_LAST  173u
+#define ECLIPSE_MODERN_BLOCK_SIZE  32u
+#define ECLIPSE_MODERN_BLOCKS      146u
+
+/* eclipse_times_modern_base[] — int64_t time of the first eclipse of each block (skip index).
+ * Size: 1,168 bytes */
+static const uint8_t eclipse_times_modern_base[1168u] ECLIPSE_ATTR = {
+    0xf6, 0x69, 0x5e, 0x04, 0xf7, 0xff, 0xff, 0xff, 0x56, 0xc8, 0x16, 0x95, 0xf8, 0xff, 0xff, 0xff,
+    0x14, 0xb3, 0xbc, 0x1c, 0xf9, 0xff, 0xff, 0xff, 0x15, 0x32, 0x27, 0x7d, 0xf9, 0xff, 0xff, 0xff,
+    0x88, 0xb8, 0x71, 0xcd, 0xf9, 0xff, 0xff, 0xff, 0xde, 0x91, 0x81, 0x17, 0xfa, 0xff, 0xff, 0xff,
+    0x95, 0x4e, 0x55, 0x5b, 0xfa, 0xff, 0xff, 0xff, 0xc1, 0xe2, 0xbf, 0x9a, 0xfa, 0xff, 0xff, 0xff,
+    0xc2, 0x23, 0xc0, 0xdc, 0xfa, 0xff, 0xff, 0xff, 0x78, 0xe5, 0x6d, 0x19, 0xfb, 0xff, 0xff, 0xff,
+    0xff, 0xc9, 0xc8, 0x50, 0xfb, 0xff, 0xff, 0xff, 0xef, 0xc7, 0x3a, 0x87, 0xfb, 0xff, 0xff, 0xff,
+    0x9f, 0x89, 0xab, 0xbd, 0xfb, 0xff, 0xff, 0xff, 0x91, 0x8f, 0x32, 0xf3, 0xfb, 0xff, 0xff, 0xff,
+    0x37, 0x11, 0x52, 0x24, 0xfc, 0xff, 0xff, 0xff, 0x88, 0xbb, 0x86, 0x54, 0xfc, 0xff, 0xff, 0xff,
+    0xc3, 0xda, 0x51, 0x87, 0xfc, 0xff, 0xff, 0xff, 0xa7, 0xa4, 0xf0, 0xb4, 0xfc, 0xff, 0xff, 0xff,
+    0xbd, 0xd6, 0x7f, 0xe1, 0xfc, 0xff, 0xff, 0xff, 0x79, 0xe5, 0x8e, 0x0a, 0xfd, 0xff, 0xff, 0xff,
+    0x7f, 0xbb, 0xc1, 0x32, 0xfd, 0xff, 0xff, 0xff, 0x7d, 0x5d, 0xff, 0x59, 0xfd, 0xff, 0xff, 0xff,
+    0x49, 0x13, 0xbc, 0x7d, 0xfd, 0xff, 0xff, 0xff, 0xc1, 0x8e, 0x78, 0xa1, 0xfd, 0xff, 0xff, 0xff,
+    0x78, 0xd0, 0x4c, 0xc4, 0xfd, 0xff, 0xff, 0xff, 0x86, 0xaf, 0x36, 0xe6, 0xfd, 0xff, 0xff, 0xff,
+    0x65, 0x8d, 0x20, 0x08, 0xfe, 0xff, 0xff, 0xff, 0xe3, 0x9c, 0x1f, 0x29, 0xfe, 0xff, 0xff, 0xff,
+    0x14, 0xaa, 0x36, 0x49, 0xfe, 0xff, 0xff, 0xff, 0x0e, 0x70, 0xa1, 0x67, 0xfe, 0xff, 0xff, 0xff,
+    0x3c, 0x89, 0xce, 0x86, 0xfe, 0xff, 0xff, 0xff, 0x5c, 0xd3, 0xfa, 0xa5, 0xfe, 0xff, 0xff, 0xff,
+    0xfe, 0xef, 0x4e, 0xc5, 0xfe, 0xff, 0xff, 0xff, 0x29, 0x15, 0x7d, 0xe4, 0xfe, 0xff, 0xff, 0xff,
+    0x87, 0x81, 0xfd, 0x01, 0xff, 0xff, 0xff, 0xff, 0x23, 0xf4, 0x7d, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xb4, 0xd7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x11, 0xf5, 0x57, 0x5a, 0xff, 0xff, 0xff, 0xff,
+    0x98, 0x69, 0xf0, 0x76, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xbf, 0x5f, 0x93, 0xff, 0xff, 0xff, 0xff,
+    0xc9, 0xd6, 0xf7, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x89, 0xcc, 0x8d, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0x52, 0xea, 0x25, 0xe9, 0xff, 0xff, 0xff, 0xff, 0x06, 0x81, 0xbc, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x9c, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xec, 0x2e, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0xaa, 0x08, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xcd, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0x9e, 0x90, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x6d, 0x55, 0xa6, 0x00, 0x00, 0x00, 0x00,
+    0xd6, 0xc4, 0x18, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0xf4, 0xda, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x5c, 0xce, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x65, 0x0a, 0x92, 0x0f, 0x01, 0x00, 0x00, 0x00,
+    0x84, 0xe9, 0xa8, 0x28, 0x01, 0x00, 0x00, 0x00, 0x5c, 0x24, 0x9a, 0x41, 0x01, 0x00, 0x00, 0x00,
+    0x33, 0xec, 0x8b, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x7c, 0xa3, 0x73, 0x01, 0x00, 0x00, 0x00,
+    0x33, 0x80, 0x93, 0x8c, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x59, 0x84, 0xa5, 0x01, 0x00, 0x00, 0x00,
+    0x14, 0xdb, 0x85, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x74, 0xa4, 0x8d, 0xd7, 0x01, 0x00, 0x00, 0x00,
+    0x6a, 0xf5, 0xba, 0xef, 0x01, 0x00, 0x00, 0x00, 0x6b, 0x1e, 0xc3, 0x07, 0x02, 0x00, 0x00, 0x00,
+    0x67, 0x4f, 0xf1, 0x1f, 0x02, 0x00, 0x00, 0x00, 0xca, 0x90, 0xf7, 0x37, 0x02, 0x00, 0x00, 0x00,
+    0x15, 0x9c, 0x15, 0x4f, 0x02, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x71, 0x65, 0x02, 0x00, 0x00, 0x00,
+    0x8d, 0xa2, 0x9e, 0x7d, 0x02, 0x00, 0x00, 0x00, 0xae, 0xd4, 0xbc, 0x94, 0x02, 0x00, 0x00, 0x00,
+    0xc2, 0xb5, 0xea, 0xac, 0x02, 0x00, 0x00, 0x00, 0xf5, 0x1f, 0x08, 0xc4, 0x02, 0x00, 0x00, 0x00,
+    0x3f, 0xa1, 0x1f, 0xdd, 0x02, 0x00, 0x00, 0x00, 0xd5, 0x9a, 0x7b, 0xf3, 0x02, 0x00, 0x00, 0x00,
+    0xdf, 0x73, 0x2f, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x45, 0x98, 0x5c, 0x25, 0x03, 0x00, 0x00, 0x00,
+    0x5f, 0x7a, 0x8b, 0x3d, 0x03, 0x00, 0x00, 0x00, 0x4b, 0xc8, 0x7b, 0x56, 0x03, 0x00, 0x00, 0x00,
+    0x3a, 0xe6, 0xbf, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x78, 0x45, 0x9b, 0x87, 0x03, 0x00, 0x00, 0x00,
+    0xe2, 0x1a, 0x8b, 0xa0, 0x03, 0x00, 0x00, 0x00, 0xc7, 0x5e, 0x66, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x36, 0x52, 0x41, 0xd4, 0x03, 0x00, 0x00, 0x00, 0x38, 0x57, 0x04, 0xef, 0x03, 0x00, 0x00, 0x00,
+    0x1b, 0xd0, 0xc8, 0x09, 0x04, 0x00, 0x00, 0x00, 0x12, 0xdf, 0xb3, 0x24, 0x04, 0x00, 0x00, 0x00,
+    0x58, 0x46, 0x77, 0x3f, 0x04, 0x00, 0x00, 0x00, 0xb2, 0x9f, 0x68, 0x58, 0x04, 0x00, 0x00, 0x00,
+    0xf0, 0xc7, 0x2c, 0x73, 0x04, 0x00, 0x00, 0x00, 0x19, 0xcf, 0xef, 0x8d, 0x04, 0x00, 0x00, 0x00,
+    0x25, 0x8e, 0x9d, 0xa9, 0x04, 0x00, 0x00, 0x00, 0x62, 0x32, 0x62, 0xc4, 0x04, 0x00, 0x00, 0x00,
+    0x8f, 0xde, 0x0f, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x69, 0xe4, 0xd3, 0xfa, 0x04, 0x00, 0x00, 0x00,
+    0x66, 0x3d, 0x97, 0x15, 0x05, 0x00, 0x00, 0x00, 0x2c, 0xb8, 0x71, 0x2f, 0x05, 0x00, 0x00, 0x00,
+    0x45, 0x10, 0x74, 0x49, 0x05, 0x00, 0x00, 0x00, 0x1a, 0xde, 0x36, 0x64, 0x05, 0x00, 0x00, 0x00,
+    0xda, 0xde, 0xfb, 0x7e, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x07, 0xc0, 0x99, 0x05, 0x00, 0x00, 0x00,
+    0x67, 0x76, 0x6d, 0xb5, 0x05, 0x00, 0x00, 0x00, 0x93, 0x09, 0x48, 0xcf, 0x05, 0x00, 0x00, 0x00,
+    0xb2, 0xe8, 0xf5, 0xea, 0x05, 0x00, 0x00, 0x00, 0xef, 0xd2, 0xcf, 0x04, 0x06, 0x00, 0x00, 0x00,
+    0xb3, 0x64, 0x94, 0x1f, 0x06, 0x00, 0x00, 0x00, 0xb1, 0x22, 0x57, 0x3a, 0x06, 0x00, 0x00, 0x00,
+    0xe0, 0x46, 0x32, 0x54, 0x06, 0x00, 0x00, 0x00, 0xed, 0xee, 0xdf, 0x6f, 0x06, 0x00, 0x00, 0x00,
+    0x49, 0x6c, 0x8d, 0x8b, 0x06, 0x00, 0x00, 0x00, 0x8a, 0x72, 0x24, 0xa8, 0x06, 0x00, 0x00, 0x00,
+    0x61, 0xc8, 0xd1, 0xc3, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x8c, 0x69, 0xe0, 0x06, 0x00, 0x00, 0x00,
+    0x07, 0x15, 0xc3, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x16, 0xd3, 0x43, 0x1b, 0x07, 0x00, 0x00, 0x00,
+    0xa9, 0x2f, 0xc4, 0x38, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x95, 0x1e, 0x56, 0x07, 0x00, 0x00, 0x00,
+    0x12, 0x45, 0x73, 0x75, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x84, 0x72, 0x96, 0x07, 0x00, 0x00, 0x00,
+    0x57, 0x4a, 0x5c, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x47, 0x10, 0x19, 0xdc, 0x07, 0x00, 0x00, 0x00,
+    0xc8, 0x80, 0x99, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc7, 0x17, 0x56, 0x24, 0x08, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xa9, 0x4a, 0x08, 0x00, 0x00, 0x00, 0x87, 0x43, 0x39, 0x70, 0x08, 0x00, 0x00, 0x00,
+    0x90, 0x8e, 0x76, 0x97, 0x08, 0x00, 0x00, 0x00, 0x2f, 0xb9, 0x6e, 0xc1, 0x08, 0x00, 0x00, 0x00,
+    0xb6, 0x67, 0x7f, 0xea, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x39, 0x8e, 0x13, 0x09, 0x00, 0x00, 0x00,
+    0xef, 0x77, 0x34, 0x3f, 0x09, 0x00, 0x00, 0x00, 0x39, 0x0e, 0x17, 0x6a, 0x09, 0x00, 0x00, 0x00,
+    0xb3, 0x0b, 0x8f, 0x97, 0x09, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x45, 0xc4, 0x09, 0x00, 0x00, 0x00,
+    0xf2, 0xd7, 0x91, 0xf3, 0x09, 0x00, 0x00, 0x00, 0x7f, 0xc2, 0xdc, 0x22, 0x0a, 0x00, 0x00, 0x00,
+    0xda, 0x3d, 0x28, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x75, 0x57, 0xde, 0x85, 0x0a, 0x00, 0x00, 0x00,
+    0x6e, 0x28, 0x4f, 0xbc, 0x0a, 0x00, 0x00, 0x00, 0xd0, 0x9d, 0xc0, 0xf2, 0x0a, 0x00, 0x00, 0x00,
+    0xeb, 0x10, 0x06, 0x2b, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x3e, 0xb3, 0x67, 0x0b, 0x00, 0x00, 0x00,
+    0x5b, 0x16, 0x71, 0xac, 0x0b, 0x00, 0x00, 0x00, 0x42, 0x70, 0xa6, 0xfd, 0x0b, 0x00, 0x00, 0x00,
+    0x65, 0x13, 0x64, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0xcc, 0xe5, 0xe3, 0x0c, 0x00, 0x00, 0x00,
+    0x14, 0x25, 0xef, 0x78, 0x0d, 0x00, 0x00, 0x00, 0xb6, 0x88, 0xb5, 0x52, 0x0e, 0x00, 0x00, 0x00
+};
+
+/* eclipse_times_modern_frame[] — uint32 per block: payload byte offset << 8 | offset width.
+ * Size: 584 bytes */
+static const uint8_t eclipse_times_modern_frame[584u] ECLIPSE_ATTR = {
+    0x21, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x1f, 0x75, 0x01, 0x00,
+    0x1f, 0xee, 0x01, 0x00, 0x1e, 0x67, 0x02, 0x00, 0x1e, 0xdc, 0x02, 0x00, 0x1f, 0x51, 0x03, 0x00,
+    0x1e, 0xca, 0x03, 0x00, 0x1e, 0x3f, 0x04, 0x00, 0x1e, 0xb4, 0x04, 0x00, 0x1e, 0x29, 0x05, 0x00,
+    0x1e, 0x9e, 0x05, 0x00, 0x1e, 0x13, 0x06, 0x00, 0x1e, 0x88, 0x06, 0x00, 0x1e, 0xfd, 0x06, 0x00,
+    0x1e, 0x72, 0x07, 0x00, 0x1e, 0xe7, 0x07, 0x00, 0x1e, 0x5c, 0x08, 0x00, 0x1e, 0xd1, 0x08, 0x00,
+    0x1e, 0x46, 0x09, 0x00, 0x1e, 0xbb, 0x09, 0x00, 0x1e, 0x30, 0x0a, 0x00, 0x1e, 0xa5, 0x0a, 0x00,
+    0x1e, 0x1a, 0x0b, 0x00, 0x1e, 0x8f, 0x0b, 0x00, 0x1e, 0x04, 0x0c, 0x00, 0x1d, 0x79, 0x0c, 0x00,
+    0x1d, 0xea, 0x0c, 0x00, 0x1d, 0x5b, 0x0d, 0x00, 0x1d, 0xcc, 0x0d, 0x00, 0x1d, 0x3d, 0x0e, 0x00,
+    0x1d, 0xae, 0x0e, 0x00, 0x1d, 0x1f, 0x0f, 0x00, 0x1d, 0x90, 0x0f, 0x00, 0x1d, 0x01, 0x10, 0x00,
+    0x1d, 0x72, 0x10, 0x00, 0x1d, 0xe3, 0x10, 0x00, 0x1d, 0x54, 0x11, 0x00, 0x1d, 0xc5, 0x11, 0x00,
+    0x1d, 0x36, 0x12, 0x00, 0x1d, 0xa7, 0x12, 0x00, 0x1d, 0x18, 0x13, 0x00, 0x1d, 0x89, 0x13, 0x00,
+    0x1d, 0xfa, 0x13, 0x00, 0x1d, 0x6b, 0x14, 0x00, 0x1d, 0xdc, 0x14, 0x00, 0x1d, 0x4d, 0x15, 0x00,
+    0x1d, 0xbe, 0x15, 0x00, 0x1d, 0x2f, 0x16, 0x00, 0x1d, 0xa0, 0x16, 0x00, 0x1d, 0x11, 0x17, 0x00,
+    0x1d, 0x82, 0x17, 0x00, 0x1d, 0xf3, 0x17, 0x00, 0x1d, 0x64, 0x18, 0x00, 0x1d, 0xd5, 0x18, 0x00,
+    0x1d, 0x46, 0x19, 0x00, 0x1d, 0xb7, 0x19, 0x00, 0x1d, 0x28, 0x1a, 0x00, 0x1d, 0x99, 0x1a, 0x00,
+    0x1d, 0x0a, 0x1b, 0x00, 0x1d, 0x7b, 0x1b, 0x00, 0x1d, 0xec, 0x1b, 0x00, 0x1d, 0x5d, 0x1c, 0x00,
+    0x1d, 0xce, 0x1c, 0x00, 0x1d, 0x3f, 0x1d, 0x00, 0x1d, 0xb0, 0x1d, 0x00, 0x1d, 0x21, 0x1e, 0x00,
+    0x1d, 0x92, 0x1e, 0x00, 0x1d, 0x03, 0x1f, 0x00, 0x1d, 0x74, 0x1f, 0x00, 0x1d, 0xe5, 0x1f, 0x00,
+    0x1d, 0x56, 0x20, 0x00, 0x1d, 0xc7, 0x20, 0x00, 0x1d, 0x38, 0x21, 0x00, 0x1d, 0xa9, 0x21, 0x00,
+    0x1d, 0x1a, 0x22, 0x00, 0x1d, 0x8b, 0x22, 0x00, 0x1d, 0xfc, 0x22, 0x00, 0x1d, 0x6d, 0x23, 0x00,
+    0x1d, 0xde, 0x23, 0x00, 0x1d, 0x4f, 0x24, 0x00, 0x1d, 0xc0, 0x24, 0x00, 0x1d, 0x31, 0x25, 0x00,
+    0x1d, 0xa2, 0x25, 0x00, 0x1d, 0x13, 0x26, 0x00, 0x1d, 0x84, 0x26, 0x00, 0x1d, 0xf5, 0x26, 0x00,
+    0x1d, 0x66, 0x27, 0x00, 0x1d, 0xd7, 0x27, 0x00, 0x1d, 0x48, 0x28, 0x00, 0x1d, 0xb9, 0x28, 0x00,
+    0x1d, 0x2a, 0x29, 0x00, 0x1d, 0x9b, 0x29, 0x00, 0x1d, 0x0c, 0x2a, 0x00, 0x1d, 0x7d, 0x2a, 0x00,
+    0x1d, 0xee, 0x2a, 0x00, 0x1d, 0x5f, 0x2b, 0x00, 0x1d, 0xd0, 0x2b, 0x00, 0x1d, 0x41, 0x2c, 0x00,
+    0x1d, 0xb2, 0x2c, 0x00, 0x1d, 0x23, 0x2d, 0x00, 0x1d, 0x94, 0x2d, 0x00, 0x1d, 0x05, 0x2e, 0x00,
+    0x1d, 0x76, 0x2e, 0x00, 0x1d, 0xe7, 0x2e, 0x00, 0x1d, 0x58, 0x2f, 0x00, 0x1d, 0xc9, 0x2f, 0x00,
+    0x1d, 0x3a, 0x30, 0x00, 0x1d, 0xab, 0x30, 0x00, 0x1d, 0x1c, 0x31, 0x00, 0x1d, 0x8d, 0x31, 0x00,
+    0x1d, 0xfe, 0x31, 0x00, 0x1d, 0x6f, 0x32, 0x00, 0x1d, 0xe0, 0x32, 0x00, 0x1d, 0x51, 0x33, 0x00,
+    0x1e, 0xc2, 0x33, 0x00, 0x1e, 0x37, 0x34, 0x00, 0x1e, 0xac, 0x34, 0x00, 0x1e, 0x21, 0x35, 0x00,
+    0x1e, 0x96, 0x35, 0x00, 0x1e, 0x0b, 0x36, 0x00, 0x1e, 0x80, 0x36, 0x00, 0x1e, 0xf5, 0x36, 0x00,
+    0x1e, 0x6a, 0x37, 0x00, 0x1e, 0xdf, 0x37, 0x00, 0x1e, 0x54, 0x38, 0x00, 0x1e, 0xc9, 0x38, 0x00,
+    0x1e, 0x3e, 0x39, 0x00, 0x1e, 0xb3, 0x39, 0x00, 0x1e, 0x28, 0x3a, 0x00, 0x1e, 0x9d, 0x3a, 0x00,
+    0x1e, 0x12, 0x3b, 0x00, 0x1e, 0x87, 0x3b, 0x00, 0x1e, 0xfc, 0x3b, 0x00, 0x1e, 0x71, 0x3c, 0x00,
+    0x1e, 0xe6, 0x3c, 0x00, 0x1e, 0x5b, 0x3d, 0x00, 0x1e, 0xd0, 0x3d, 0x00, 0x1f, 0x45, 0x3e, 0x00,
+    0x1f, 0xbe, 0x3e, 0x00, 0x1f, 0x37, 0x3f, 0x00, 0x1f, 0xb0, 0x3f, 0x00, 0x20, 0x29, 0x40, 0x00,
+    0x20, 0xa5, 0x40, 0x00, 0x21, 0x21, 0x41, 0x00
+};
+
+/* eclipse_times_modern_packed[] — per block, the offsets of eclipses 1..31 from the block's
+ * base, LSB-first at the block's width; each block starts on a byte.
+ * Size: 16,739 bytes */
+static const uint8_t eclipse_times_modern_packed[16739u] ECLIPSE_ATTR = {
+    0x40, 0xce, 0xe9, 0x21, 0x9e, 0x38, 0xa7, 0x87, 0xc4, 0xaa, 0xf5, 0x96, 0x81, 0xcd, 0x39, 0x3d,
+    0xc4, 0xe5, 0xfa, 0xc2, 0x09, 0x33, 0x21, 0x32, 0xd5, 0xc1, 0x5c, 0x86, 0xaf, 0x47, 0x6d, 0xbd,
+    0x65, 0x46, 0x72, 0xa0, 0xd2, 0x6c, 0x6e, 0x06, 0xc0, 0x15, 0xb3, 0x92, 0xb5, 0xdb, 0xa6, 0x51,
+    0xa4, 0xd7, 0xbd, 0xcf, 0x1e, 0x10, 0x83, 0x4e, 0x22, 0x21, 0x27, 0xa0, 0xd3, 0x43, 0xf5, 0xfb,
+    0x39, 0x8b, 0x4f, 0x6f, 0xd5, 0x23, 0x11, 0xe5, 0xf5, 0x55, 0x92, 0x12, 0xdc, 0xc4, 0x7c, 0x4b,
+    0xe3, 0xc2, 0x09, 0x57, 0xf3, 0x5b, 0xb4, 0x30, 0x98, 0x9c, 0x29, 0xf2, 0x36, 0xc8, 0xd4, 0xe4,
+    0x16, 0x23, 0xad, 0x50, 0x95, 0x55, 0x62, 0x4f, 0xf9, 0x51, 0xcf, 0x5a, 0x40, 0x3a, 0xbb, 0x0d,
+    0xa7, 0x55, 0xa8, 0xcb, 0x2c, 0xff, 0xc2, 0x97, 0x4d, 0xee, 0x87, 0x70, 0x4d, 0xb1, 0x64, 0x62,
+    0x5e, 0x31, 0x3c, 0x06, 0x34, 0x5b, 0x61, 0x0d, 0x41, 0x73, 0x88, 0x14, 0xff, 0xf2, 0x70, 0x15,
+    0x15, 0x31, 0xc4, 0x1a, 0x86, 0xce, 0xe9, 0x21, 0xfd, 0x0d, 0x26, 0x28, 0x46, 0x23, 0x4b, 0x2f,
+    0xcd, 0x38, 0x72, 0x36, 0x08, 0xd3, 0x5a, 0x37, 0x21, 0xfd, 0xad, 0x3c, 0xa6, 0x83, 0x97, 0x3d,
+    0xfd, 0x9c, 0xd3, 0x43, 0xd8, 0xeb, 0x0f, 0x4a, 0xf5, 0xe0, 0xf7, 0x4a, 0x98, 0x0a, 0xe2, 0x4b,
+    0x38, 0x9c, 0x33, 0x51, 0xb8, 0xab, 0x5a, 0x58, 0x99, 0x62, 0x43, 0x59, 0x86, 0x79, 0x96, 0x5e,
+    0x3d, 0x09, 0x80, 0x5f, 0xd2, 0x1a, 0xbc, 0x65, 0xc3, 0x79, 0xf8, 0x6b, 0x5f, 0xa6, 0xe1, 0x6c,
+    0xdf, 0xe4, 0xcb, 0x6d, 0x8e, 0x68, 0x1d, 0x73, 0x28, 0xbb, 0xf0, 0x74, 0x56, 0x6f, 0x44, 0x7a,
+    0x2f, 0x44, 0x2d, 0x7b, 0x2c, 0x49, 0x80, 0x80, 0x5b, 0xde, 0x69, 0x81, 0x63, 0x6f, 0x3c, 0x06,
+    0x38, 0xc0, 0x92, 0x03, 0x5b, 0xf5, 0x03, 0xc2, 0x8d, 0x29, 0xac, 0x61, 0x2a, 0x4a, 0xf3, 0xd0,
+    0x3e, 0x42, 0xa4, 0xf8, 0xed, 0xc4, 0x55, 0xd6, 0x5f, 0x88, 0x35, 0x80, 0xc7, 0xad, 0x1b, 0xf2,
+    0x6d, 0x4b, 0xce, 0x54, 0x74, 0x7a, 0x08, 0x12, 0xca, 0x04, 0x65, 0x47, 0xf4, 0x90, 0xd2, 0x8f,
+    0xcd, 0x4f, 0x8d, 0x75, 0x2c, 0xbd, 0xb0, 0xed, 0x3c, 0x62, 0x18, 0x0b, 0x72, 0xb6, 0x85, 0x8e,
+    0xad, 0x5b, 0xc2, 0x80, 0x2b, 0x4f, 0x2b, 0xf3, 0xb2, 0x67, 0xc9, 0x0a, 0xe8, 0x3b, 0x1c, 0x9d,
+    0x1e, 0xea, 0xc7, 0x40, 0x28, 0x37, 0x11, 0xf2, 0x95, 0xf3, 0x8e, 0xe3, 0xcb, 0x60, 0x78, 0x9a,
+    0xe8, 0x40, 0x13, 0xc2, 0xd4, 0xcf, 0x79, 0x0b, 0x6b, 0xe5, 0x4f, 0x94, 0x0d, 0xbb, 0xbe, 0xf4,
+    0xda, 0xa9, 0x05, 0x7e, 0x01, 0xa6, 0xf8, 0x52, 0x85, 0x5d, 0x3e, 0x93, 0x43, 0x21, 0xe5, 0xe3,
+    0xc2, 0xb8, 0x09, 0x8f, 0x31, 0xd4, 0x2e, 0xd6, 0x48, 0x3b, 0xa2, 0x95, 0xf4, 0x68, 0x7d, 0x4e,
+    0x98, 0x4c, 0x0f, 0x29, 0xa1, 0x13, 0xdb, 0x19, 0xbf, 0x2f, 0x62, 0xcd, 0x1f, 0x77, 0x05, 0x88,
+    0x33, 0xed, 0x1f, 0x04, 0x2f, 0x88, 0x1e, 0x2a, 0xe5, 0xdb, 0x39, 0x61, 0xbf, 0x93, 0xa0, 0x82,
+    0xf6, 0x1d, 0x52, 0x2f, 0x24, 0x78, 0xad, 0x73, 0x60, 0x30, 0xd7, 0x3a, 0xde, 0xd2, 0x2b, 0xb2,
+    0x99, 0x93, 0x56, 0x38, 0x7d, 0x58, 0x4b, 0x79, 0x81, 0xb3, 0x1d, 0x1d, 0x0e, 0xef, 0xa4, 0xda,
+    0x59, 0x79, 0xee, 0xb2, 0xff, 0x41, 0x70, 0x9c, 0x74, 0xa1, 0x1e, 0x96, 0xf4, 0x30, 0x80, 0xaa,
+    0x24, 0xb9, 0xd9, 0xeb, 0xa0, 0xc4, 0x67, 0xc6, 0x57, 0xfa, 0x11, 0x88, 0x3d, 0x01, 0x57, 0xcf,
+    0xea, 0x80, 0x76, 0x10, 0x1e, 0x83, 0x80, 0xc5, 0xc9, 0x01, 0x98, 0xf0, 0x01, 0xd1, 0x76, 0x2c,
+    0xd6, 0xf8, 0x22, 0x62, 0x72, 0x58, 0x0d, 0x7c, 0x4e, 0x66, 0x01, 0x11, 0x29, 0x0d, 0xa9, 0x71,
+    0x95, 0x3f, 0x53, 0x62, 0xcd, 0xd6, 0x80, 0xeb, 0xa6, 0x37, 0x03, 0x93, 0x23, 0xd6, 0x15, 0x10,
+    0x1a, 0x36, 0x4e, 0x0f, 0x1d, 0xac, 0x52, 0x8b, 0xd2, 0xf8, 0x4b, 0x50, 0xb7, 0xdc, 0x10, 0xa9,
+    0x61, 0xb1, 0xfc, 0xd4, 0xd1, 0x23, 0xd3, 0x6b, 0x16, 0xc4, 0x06, 0xa6, 0x6f, 0xf4, 0x11, 0x1b,
+    0xd0, 0x46, 0xac, 0xa1, 0x3c, 0xc9, 0xd9, 0x22, 0x01, 0xb7, 0x6e, 0x62, 0x81, 0xae, 0x3c, 0xe8,
+    0xe6, 0xcb, 0x5e, 0xa4, 0x7b, 0xa0, 0x4f, 0x69, 0x67, 0x5d, 0x48, 0xf0, 0x38, 0x3d, 0x14, 0x2d,
+    0xf4, 0x25, 0xb6, 0x9c, 0x9b, 0x16, 0x01, 0xe2, 0xc8, 0xea, 0x80, 0x35, 0xda, 0x74, 0x60, 0xfc,
+    0x67, 0x72, 0xcc, 0x86, 0x40, 0x20, 0x31, 0x34, 0xf9, 0x48, 0xc7, 0xb5, 0x58, 0x03, 0x41, 0xc4,
+    0xe4, 0x84, 0xfc, 0xd5, 0x3c, 0x80, 0x84, 0x88, 0xd4, 0x59, 0x6f, 0x5c, 0x35, 0xbc, 0xbe, 0x65,
+    0xc9, 0xf8, 0x14, 0x6b, 0x9a, 0x7f, 0xad, 0x9b, 0x47, 0x21, 0x26, 0x67, 0xc5, 0x0d, 0xd8, 0xe5,
+    0x77, 0xa7, 0x87, 0xc9, 0x8c, 0xd4, 0xe2, 0x6a, 0x52, 0xef, 0x88, 0xb4, 0x04, 0x91, 0xb6, 0xe9,
+    0xe7, 0xa7, 0x91, 0xfc, 0xe2, 0x2a, 0x32, 0x2b, 0xd3, 0x9b, 0x2b, 0x61, 0x03, 0x5f, 0x5b, 0x7d,
+    0xc4, 0x4c, 0x62, 0x72, 0x76, 0x48, 0xe1, 0xd6, 0x1d, 0x3f, 0x5c, 0x84, 0xeb, 0x61, 0xbc, 0xf2,
+    0xb6, 0x4b, 0x97, 0xfd, 0x19, 0x97, 0xa0, 0x4f, 0xc0, 0xaa, 0xf6, 0x03, 0x6a, 0x93, 0xea, 0xc0,
+    0x94, 0xdb, 0x74, 0xa0, 0xc2, 0x65, 0x72, 0xac, 0x51, 0x40, 0x20, 0xe6, 0x0a, 0xf9, 0x08, 0x18,
+    0xb1, 0x58, 0xe3, 0x52, 0xc2, 0xe4, 0xfc, 0xc5, 0xd5, 0x3c, 0xcc, 0x84, 0x88, 0x14, 0xcb, 0x63,
+    0x5c, 0x35, 0x0b, 0xbe, 0x65, 0x5d, 0xd0, 0x14, 0x6b, 0x33, 0x5d, 0xad, 0x1b, 0x18, 0x1d, 0x26,
+    0x37, 0x0f, 0x0c, 0xd8, 0xf1, 0x7b, 0xa7, 0x87, 0x8f, 0x55, 0xd4, 0x22, 0x20, 0x54, 0xef, 0x28,
+    0xb7, 0x02, 0x91, 0xbe, 0xa6, 0xe7, 0xa7, 0x0e, 0xd8, 0xe2, 0x2a, 0xd1, 0x25, 0xd3, 0x9b, 0x55,
+    0x5f, 0x03, 0x3b, 0x1f, 0x7d, 0xc4, 0xc8, 0x7c, 0x09, 0xf2, 0x3f, 0x99, 0x9c, 0x0d, 0x51, 0xb5,
+    0x75, 0x1f, 0xee, 0x16, 0xe1, 0x5c, 0x0a, 0xaf, 0xfc, 0x60, 0xcb, 0x65, 0x7f, 0x73, 0x24, 0xe8,
+    0x03, 0x90, 0x29, 0x69, 0x04, 0xe8, 0xc1, 0xa9, 0x02, 0xa1, 0x27, 0x8f, 0xa1, 0x12, 0xed, 0x71,
+    0xd1, 0x90, 0x92, 0xc7, 0x58, 0x9a, 0x10, 0x6b, 0x7c, 0x50, 0x2f, 0x47, 0xe4, 0x64, 0x6a, 0x25,
+    0xc7, 0x88, 0x9e, 0x93, 0x61, 0x5a, 0x44, 0x4a, 0x6d, 0x6c, 0x3c, 0x06, 0xcd, 0x50, 0x3b, 0xf3,
+    0x2f, 0x50, 0xac, 0xc9, 0x50, 0x72, 0xf9, 0xf4, 0xaf, 0x59, 0x80, 0x4a, 0x06, 0x03, 0x42, 0x69,
+    0xd5, 0xe9, 0xa1, 0xf9, 0x83, 0x29, 0x53, 0x7d, 0x51, 0xcf, 0x69, 0x10, 0xd0, 0x04, 0x85, 0xb7,
+    0x93, 0xd7, 0x82, 0xd8, 0x17, 0x73, 0x75, 0x93, 0x2f, 0xbd, 0xb2, 0x46, 0x6b, 0x67, 0xe5, 0x04,
+    0x9f, 0x34, 0x40, 0x2e, 0xc4, 0x5a, 0x77, 0xa0, 0x9c, 0x0d, 0x56, 0x72, 0x5b, 0x37, 0xbc, 0x44,
+    0xbc, 0xa3, 0xfa, 0x76, 0xe5, 0x21, 0x70, 0x60, 0x04, 0x01, 0x3b, 0x10, 0xeb, 0xc0, 0xdf, 0xda,
+    0x74, 0x40, 0x48, 0xca, 0x63, 0x20, 0x1f, 0x9b, 0x1c, 0xc2, 0x20, 0x10, 0x08, 0x8b, 0x61, 0x3e,
+    0x62, 0xea, 0x2c, 0xd6, 0x60, 0x2b, 0x32, 0x39, 0x93, 0x77, 0x35, 0xcf, 0xcb, 0xcb, 0xe7, 0xb4,
+    0x7e, 0x89, 0x48, 0x19, 0xb7, 0xc7, 0x55, 0xd1, 0x0e, 0x5c, 0x16, 0xad, 0x4c, 0xb1, 0x76, 0x09,
+    0xdd, 0xba, 0x19, 0xea, 0x61, 0x72, 0xde, 0xaa, 0x01, 0xe1, 0xcf, 0x75, 0x7a, 0xe8, 0xb8, 0x4d,
+    0x2d, 0x96, 0x13, 0xf5, 0x8e, 0xd0, 0x80, 0x26, 0x68, 0xc9, 0x22, 0x44, 0x8a, 0x12, 0xa0, 0x9f,
+    0xd2, 0x1b, 0x8d, 0xab, 0x19, 0xa4, 0x4c, 0x2f, 0xa5, 0x96, 0x0d, 0x9c, 0xce, 0xf4, 0x11, 0xa7,
+    0xe8, 0x23, 0xd6, 0x73, 0x6d, 0x72, 0xb6, 0x1b, 0x9b, 0xd6, 0x8d, 0xcc, 0x48, 0x84, 0x03, 0x6b,
+    0x83, 0xe8, 0x80, 0xe8, 0xd0, 0x74, 0x30, 0xea, 0xbd, 0x2b, 0x50, 0x97, 0xf1, 0x18, 0x2e, 0x9d,
+    0x24, 0xc7, 0x78, 0xe4, 0x03, 0xc2, 0xcc, 0x80, 0x8f, 0x28, 0x22, 0x85, 0x35, 0xbd, 0x3c, 0x4b,
+    0x4e, 0x47, 0x33, 0xcd, 0xa3, 0x5a, 0xdf, 0x01, 0x15, 0x9c, 0x1d, 0x52, 0x4a, 0x16, 0x71, 0x95,
+    0x16, 0x84, 0x96, 0xb5, 0xfa, 0x3a, 0xac, 0xf5, 0xc5, 0xb4, 0x6e, 0x6c, 0x79, 0x96, 0x9c, 0xfd,
+    0x26, 0x60, 0x17, 0xf9, 0x9d, 0x1e, 0xee, 0x2a, 0x49, 0x8b, 0x29, 0x1f, 0xbd, 0x63, 0xcc, 0x6a,
+    0x29, 0xd9, 0x1f, 0x63, 0x82, 0x52, 0xe1, 0x39, 0xa4, 0x1f, 0x59, 0xf9, 0x29, 0x74, 0x7a, 0xb8,
+    0xaa, 0x1e, 0xb2, 0xf4, 0x1e, 0x0b, 0xd4, 0xc0, 0xaa, 0xaa, 0x1e, 0x71, 0x4e, 0xee, 0x81, 0xac,
+    0xd9, 0x13, 0x67, 0x03, 0x8e, 0x03, 0xe9, 0xc0, 0x7b, 0xa4, 0x54, 0xf1, 0x5c, 0xc2, 0x63, 0x84,
+    0x86, 0x95, 0x1c, 0x1b, 0x8a, 0x0f, 0x88, 0x5c, 0x36, 0x1e, 0x23, 0xe7, 0x12, 0xd6, 0xfc, 0x54,
+    0x30, 0x39, 0x92, 0x93, 0x34, 0x8f, 0x1f, 0x46, 0xad, 0xb4, 0x09, 0xd7, 0x39, 0x79, 0xe8, 0x20,
+    0x52, 0xe1, 0xe3, 0x70, 0x95, 0x54, 0x85, 0x76, 0x46, 0x5c, 0x3e, 0xac, 0x8d, 0x88, 0xb6, 0x6e,
+    0x10, 0x9a, 0x96, 0x5c, 0xd3, 0x0b, 0x40, 0xc8, 0xe2, 0x9c, 0x1e, 0x22, 0x70, 0x4b, 0x8b, 0xe5,
+    0x5a, 0xbd, 0x63, 0xb4, 0x15, 0xcf, 0x49, 0x08, 0x60, 0x82, 0x96, 0xb4, 0x3c, 0xa4, 0x16, 0x5e,
+    0xf9, 0x29, 0x94, 0xad, 0x98, 0x4b, 0x88, 0xaf, 0xf4, 0x0e, 0xb9, 0xd7, 0xc0, 0xd4, 0x61, 0x1e,
+    0xb1, 0x87, 0xb8, 0x27, 0x8d, 0xe9, 0x74, 0x58, 0x03, 0x04, 0xc6, 0xe8, 0x40, 0x52, 0x7b, 0x54,
+    0xd1, 0x13, 0xbb, 0x63, 0xbc, 0xf9, 0x95, 0x1c, 0x85, 0x63, 0x0e, 0x48, 0xde, 0x01, 0x1e, 0x83,
+    0xe6, 0x19, 0xd6, 0x60, 0xda, 0x2a, 0x39, 0x67, 0x27, 0x35, 0x0f, 0x18, 0x07, 0xad, 0x04, 0xec,
+    0xdd, 0x39, 0x4d, 0xe3, 0x1b, 0x52, 0x14, 0x36, 0x71, 0x15, 0xdf, 0xa4, 0x76, 0x06, 0x60, 0x2c,
+    0xac, 0x81, 0x1f, 0xb7, 0x6e, 0x22, 0x33, 0x96, 0x5c, 0x42, 0xab, 0x05, 0xf8, 0xf9, 0xf2, 0x0f,
+    0x2e, 0x0b, 0xa7, 0x87, 0x21, 0xa7, 0xd2, 0x22, 0x77, 0xf0, 0xce, 0x19, 0xc9, 0x57, 0x82, 0x12,
+    0x5b, 0x3d, 0xa4, 0x1e, 0x2d, 0xf8, 0xa9, 0x25, 0x77, 0x98, 0xfb, 0xcc, 0xb6, 0xf4, 0x6a, 0x3c,
+    0xd2, 0xc0, 0x53, 0xf1, 0x1e, 0x31, 0xa7, 0x77, 0x27, 0xfd, 0xc4, 0x7b, 0x58, 0x03, 0xb9, 0x4b,
+    0xea, 0xc0, 0xb5, 0xea, 0x54, 0x71, 0x20, 0xbd, 0x63, 0xe4, 0x6e, 0x9b, 0x1c, 0x23, 0x42, 0x0f,
+    0x88, 0xde, 0xec, 0xe3, 0x62, 0xd6, 0x84, 0xc7, 0x24, 0x0c, 0x8b, 0x35, 0x31, 0xc7, 0x4b, 0x0e,
+    0x5f, 0xe0, 0xac, 0xd4, 0x6c, 0xd3, 0x39, 0x89, 0x68, 0x1c, 0x52, 0xf9, 0xe5, 0x6f, 0x15, 0x56,
+    0x67, 0x76, 0xd6, 0x8b, 0x32, 0xac, 0x25, 0x4f, 0xb1, 0x6e, 0x86, 0xa8, 0x96, 0x9c, 0x20, 0x63,
+    0x05, 0x38, 0x7e, 0xf8, 0x0f, 0x4a, 0xd8, 0xa1, 0x87, 0xff, 0xd2, 0xd2, 0xa2, 0x17, 0x0c, 0xcf,
+    0xa9, 0x02, 0x45, 0x82, 0xf6, 0x75, 0x3d, 0xa4, 0xfd, 0xc2, 0xf7, 0x29, 0x83, 0x0a, 0x5e, 0x4b,
+    0xbb, 0x0d, 0xe6, 0x2e, 0xcb, 0x2c, 0xbd, 0xfb, 0x57, 0x34, 0xf0, 0x98, 0x7c, 0x47, 0x3c, 0x32,
+    0xd5, 0x49, 0x03, 0x02, 0xe9, 0xe9, 0x00, 0x9f, 0xab, 0x74, 0x80, 0x9b, 0xc6, 0x63, 0xe4, 0xca,
+    0x97, 0x1c, 0xf0, 0x24, 0x0f, 0xc8, 0x34, 0x5b, 0x3e, 0x12, 0x73, 0x84, 0xc7, 0xdc, 0x86, 0x89,
+    0x35, 0x4f, 0x37, 0x4b, 0x4e, 0xb6, 0x69, 0xcd, 0xc3, 0xc1, 0xe8, 0x01, 0x89, 0xfd, 0x7b, 0x4e,
+    0x17, 0x1c, 0x87, 0x94, 0x25, 0x8a, 0x5c, 0xf5, 0x13, 0xa9, 0x65, 0x21, 0xb1, 0x6b, 0x67, 0x0d,
+    0xb5, 0xc3, 0xda, 0x8b, 0x7b, 0xeb, 0x76, 0x46, 0x73, 0xc9, 0xfd, 0xae, 0x02, 0x76, 0x4f, 0x1d,
+    0x00, 0xe1, 0x54, 0x74, 0x7a, 0x38, 0xc6, 0x3b, 0x2d, 0x36, 0xfc, 0xf1, 0x8e, 0x73, 0x3a, 0x26,
+    0xa8, 0xf8, 0xf0, 0x43, 0x5a, 0xa9, 0x8f, 0x9f, 0xf6, 0xe0, 0x8c, 0xab, 0x87, 0x07, 0x62, 0x6e,
+    0x7c, 0x10, 0xd3, 0x5b, 0xde, 0x4f, 0x03, 0x03, 0xcc, 0xd7, 0xe8, 0xc0, 0x11, 0x54, 0x1a, 0xe1,
+    0xe8, 0x16, 0x55, 0x5c, 0xd6, 0xf1, 0x18, 0xbd, 0xe5, 0x24, 0xc7, 0xc0, 0x4c, 0xa9, 0x42, 0x27,
+    0xe1, 0xb8, 0x28, 0xb8, 0xe0, 0x31, 0xbb, 0x94, 0x61, 0x8d, 0x7b, 0xba, 0x92, 0x83, 0xb1, 0xa6,
+    0x1c, 0xdd, 0x89, 0xd0, 0x4a, 0x48, 0x0c, 0x9e, 0x53, 0x0f, 0xb4, 0x21, 0xe5, 0x79, 0x08, 0x8f,
+    0xb9, 0x51, 0x68, 0x67, 0x78, 0x4d, 0xc3, 0x1a, 0xa9, 0x60, 0xeb, 0x46, 0x68, 0xc4, 0xf2, 0xe5,
+    0x82, 0x5a, 0x80, 0x28, 0x43, 0xff, 0xa0, 0xd1, 0x76, 0x7a, 0x38, 0x4a, 0x2a, 0x2d, 0x96, 0x83,
+    0x4c, 0x99, 0x05, 0x45, 0x3b, 0xa7, 0x7f, 0x90, 0x09, 0xca, 0xdb, 0xeb, 0x90, 0x56, 0xf1, 0x3b,
+    0xb2, 0x67, 0xf0, 0x77, 0xed, 0x0b, 0x7c, 0x98, 0xeb, 0x5f, 0xb7, 0xf4, 0x02, 0x41, 0x8f, 0x7f,
+    0x03, 0x1b, 0x53, 0x1a, 0xd1, 0x28, 0x33, 0x55, 0xfc, 0xea, 0xef, 0x18, 0x00, 0xaa, 0xa5, 0x8a,
+    0x82, 0xcf, 0xe3, 0xd2, 0x5f, 0x87, 0xc7, 0xcc, 0x96, 0x8a, 0x35, 0x1d, 0x5d, 0xe1, 0xd0, 0xa6,
+    0xf5, 0x72, 0x74, 0xff, 0x45, 0x2b, 0xe5, 0x30, 0x7c, 0x4e, 0x1b, 0xc7, 0x87, 0xd4, 0x42, 0x11,
+    0x02, 0x86, 0x36, 0x07, 0x8f, 0x7d, 0x86, 0x6d, 0x67, 0x87, 0xed, 0xc3, 0xda, 0x06, 0x07, 0x91,
+    0x17, 0x30, 0xd2, 0xf2, 0x05, 0x23, 0x5c, 0x80, 0xe9, 0xab, 0x00, 0xa1, 0x6e, 0x70, 0x7a, 0x18,
+    0xd5, 0x95, 0x56, 0xc6, 0x86, 0x4c, 0x99, 0xe8, 0x01, 0x3d, 0xe7, 0x51, 0x74, 0x09, 0x2a, 0xcd,
+    0x08, 0x91, 0x16, 0xd3, 0x3d, 0xb2, 0x71, 0x13, 0x79, 0xed, 0xc6, 0x91, 0x98, 0x1b, 0x45, 0xc7,
+    0xf4, 0x02, 0x39, 0x97, 0xea, 0x00, 0x21, 0xc2, 0x74, 0xe0, 0x82, 0xdc, 0x2b, 0x70, 0xd3, 0x99,
+    0x0e, 0x33, 0xa1, 0x25, 0xc7, 0x47, 0x77, 0x03, 0x12, 0x8d, 0x8b, 0x8f, 0xb4, 0x62, 0x85, 0x27,
+    0xed, 0x76, 0x61, 0x0d, 0x5f, 0xa3, 0x92, 0x43, 0xc6, 0x45, 0xf3, 0xf0, 0x68, 0x78, 0x40, 0xbb,
+    0x13, 0x07, 0xd1, 0x95, 0xae, 0x21, 0x25, 0x73, 0x08, 0x57, 0xed, 0x7f, 0x69, 0x59, 0x47, 0x38,
+    0x43, 0x17, 0xff, 0x79, 0x0b, 0x76, 0xcd, 0xcc, 0xba, 0x75, 0xe7, 0x59, 0x72, 0xc9, 0xa5, 0x7f,
+    0xdd, 0xfe, 0x74, 0x9a, 0x27, 0x1c, 0x87, 0x1e, 0x4a, 0x91, 0x4c, 0x8b, 0xcd, 0x7f, 0xbb, 0xe3,
+    0x48, 0x94, 0x29, 0x59, 0x0a, 0xef, 0x58, 0xce, 0xaf, 0x3d, 0xa4, 0x90, 0xb9, 0xf7, 0x69, 0xb1,
+    0x9f, 0xb8, 0x3a, 0x64, 0xb3, 0xbc, 0x02, 0xa8, 0x79, 0xac, 0x41, 0x64, 0x67, 0xa5, 0x60, 0x85,
+    0xf5, 0x37, 0x94, 0xb6, 0xa4, 0x11, 0xa8, 0x0e, 0x52, 0x45, 0x9a, 0x6f, 0x34, 0xe2, 0x3a, 0xb9,
+    0x9b, 0x14, 0x90, 0x95, 0x2a, 0x36, 0x47, 0x8e, 0xcb, 0x2d, 0x3a, 0x1e, 0x03, 0x9d, 0x7c, 0xff,
+    0x0c, 0x23, 0x86, 0x43, 0xb6, 0xa9, 0xca, 0x11, 0x07, 0x37, 0xad, 0x94, 0xc8, 0x36, 0x63, 0x05,
+    0xe0, 0x78, 0x5c, 0xde, 0x7f, 0x06, 0x98, 0x26, 0x58, 0x3c, 0x26, 0x4b, 0x9f, 0x9d, 0x49, 0xaf,
+    0x69, 0x75, 0x80, 0xcd, 0x42, 0x5e, 0x40, 0x5e, 0xcb, 0x37, 0xb8, 0x64, 0x01, 0xb6, 0x73, 0xa7,
+    0x87, 0x39, 0x48, 0x96, 0x23, 0x70, 0xdd, 0x1f, 0xf9, 0xfb, 0x91, 0x56, 0xc6, 0x25, 0x4c, 0x99,
+    0x1e, 0xd5, 0x3b, 0xa7, 0x2e, 0xe3, 0xae, 0xfa, 0x9f, 0x56, 0xba, 0x02, 0xa0, 0xee, 0xe8, 0x40,
+    0x1d, 0xe0, 0x74, 0x60, 0xcf, 0x25, 0x55, 0xc0, 0xc4, 0xf0, 0x18, 0x01, 0x44, 0x25, 0x07, 0x5d,
+    0xdf, 0x03, 0x12, 0xed, 0x88, 0x8f, 0xc8, 0x03, 0x38, 0x2e, 0x98, 0xe1, 0x78, 0x0c, 0x58, 0x46,
+    0x58, 0x93, 0x64, 0xc0, 0xe4, 0x78, 0x46, 0xd2, 0x3c, 0x11, 0x02, 0xb5, 0x52, 0xa3, 0x5e, 0xe7,
+    0x74, 0x9b, 0x80, 0x48, 0xc5, 0xe7, 0xc3, 0x55, 0xbb, 0xc7, 0x5a, 0x16, 0x34, 0x22, 0xd1, 0x65,
+    0x61, 0x0e, 0x8f, 0x85, 0x68, 0x68, 0x67, 0x0f, 0xb7, 0xc3, 0x9a, 0x4d, 0x6c, 0xeb, 0x56, 0xbe,
+    0x66, 0xc9, 0xd9, 0xa5, 0x58, 0x80, 0xbe, 0x0d, 0x00, 0x61, 0x79, 0x73, 0x7a, 0xb8, 0x81, 0x2c,
+    0x2d, 0xbe, 0x26, 0xf5, 0x8e, 0x78, 0xe1, 0xa5, 0x24, 0x2d, 0x08, 0xcf, 0x19, 0xd3, 0x60, 0x82,
+    0x02, 0xed, 0x43, 0xea, 0xc0, 0x9a, 0xd4, 0x74, 0xc0, 0xab, 0x8b, 0x46, 0x14, 0xb4, 0x4e, 0x15,
+    0xb9, 0xd7, 0x3b, 0x06, 0x6f, 0xb3, 0xc9, 0x51, 0x32, 0xf5, 0x80, 0x3c, 0xec, 0x3e, 0x2e, 0x88,
+    0x4b, 0x78, 0x0c, 0x28, 0xaf, 0x58, 0x63, 0xca, 0xbc, 0xe4, 0x40, 0xe6, 0xd5, 0x3c, 0x80, 0x59,
+    0x1f, 0x90, 0x49, 0xea, 0x72, 0x44, 0x03, 0x4e, 0x2b, 0x39, 0xcf, 0x79, 0x4e, 0x92, 0x7a, 0x88,
+    0xd4, 0x03, 0x4a, 0x5c, 0xd5, 0xa8, 0x0e, 0x8f, 0xc1, 0x50, 0x6b, 0x67, 0x62, 0x8d, 0xc4, 0x9a,
+    0xaf, 0x64, 0xeb, 0x76, 0x40, 0x80, 0xc9, 0xfd, 0x82, 0x37, 0x76, 0xcd, 0x03, 0x24, 0xa0, 0xa4,
+    0x82, 0x43, 0x28, 0x8e, 0x6f, 0x1f, 0x4a, 0x26, 0x85, 0x8b, 0x2a, 0x52, 0xca, 0x23, 0x2a, 0xed,
+    0x97, 0xe9, 0x3a, 0xab, 0x74, 0x02, 0xe2, 0xfa, 0xea, 0x40, 0x66, 0xdf, 0x74, 0xa0, 0xae, 0x3d,
+    0x55, 0x90, 0x13, 0xf2, 0x18, 0xbd, 0xd6, 0x26, 0xc7, 0xe8, 0x01, 0x04, 0x82, 0x30, 0x99, 0x8f,
+    0x78, 0x4a, 0x8e, 0x27, 0x71, 0xd5, 0x8f, 0x4b, 0x1f, 0x43, 0x1e, 0x73, 0xa5, 0x29, 0xd6, 0x4c,
+    0xa6, 0x32, 0x39, 0x87, 0x4e, 0x35, 0x8f, 0x39, 0x15, 0x42, 0xf4, 0x45, 0x51, 0x2b, 0xf1, 0x02,
+    0x7c, 0x4e, 0x0f, 0xb5, 0x88, 0x94, 0x16, 0x71, 0x5c, 0xf5, 0x62, 0xc2, 0x65, 0xe9, 0xa5, 0x13,
+    0x5d, 0x65, 0xef, 0xda, 0xd9, 0xbe, 0x44, 0xb1, 0x06, 0xbb, 0xde, 0xba, 0x5d, 0x2e, 0x61, 0x72,
+    0xdb, 0x4b, 0x81, 0xdd, 0xde, 0xaa, 0x05, 0x78, 0x39, 0x1b, 0x10, 0xaa, 0x44, 0xa7, 0x87, 0xae,
+    0xcc, 0xd4, 0xe2, 0x36, 0x54, 0xef, 0x88, 0x0e, 0x0f, 0x59, 0x02, 0x37, 0xc3, 0xe8, 0x80, 0x49,
+    0xbd, 0x74, 0xd0, 0x80, 0xc4, 0x2b, 0x5c, 0xc3, 0x96, 0x0e, 0x61, 0xd1, 0x8f, 0xc4, 0x23, 0x02,
+    0x8f, 0xa1, 0xc5, 0x53, 0x72, 0xbc, 0x1e, 0x3b, 0x20, 0x03, 0xdc, 0xf8, 0x08, 0x0f, 0x5f, 0x78,
+    0xa2, 0x43, 0xc6, 0xac, 0xb0, 0x19, 0xd2, 0x2e, 0x98, 0x44, 0x61, 0x4d, 0x44, 0xcc, 0x92, 0x13,
+    0x2c, 0x4e, 0xf3, 0xdc, 0xe8, 0x77, 0x40, 0xa3, 0x4d, 0x08, 0x11, 0x68, 0x49, 0x7c, 0xc4, 0xee,
+    0x70, 0x48, 0x51, 0x40, 0xc5, 0x55, 0x10, 0x12, 0x5a, 0x16, 0xa2, 0x20, 0xd1, 0xb5, 0x87, 0xd7,
+    0x82, 0x55, 0x64, 0x0b, 0x6b, 0xfb, 0xe4, 0xad, 0xdb, 0xa6, 0x80, 0x25, 0x37, 0xa4, 0x0f, 0xd8,
+    0x4d, 0x0f, 0xa6, 0x79, 0x98, 0x21, 0x3d, 0xe0, 0xbd, 0x71, 0x7a, 0x18, 0x34, 0x2a, 0x2d, 0x02,
+    0xa6, 0x74, 0xe9, 0x00, 0xc8, 0xae, 0x74, 0x60, 0xc6, 0xcf, 0x2b, 0xfc, 0xa3, 0xa4, 0x11, 0x14,
+    0x57, 0x52, 0x45, 0xcc, 0xf8, 0x8e, 0x01, 0x90, 0x5f, 0x72, 0x1c, 0x61, 0x3a, 0x20, 0x91, 0x7f,
+    0xf9, 0x88, 0x99, 0x69, 0x78, 0x52, 0x27, 0xe6, 0xb8, 0x84, 0x2e, 0xe1, 0x31, 0xc4, 0xfd, 0x61,
+    0x4d, 0xb0, 0xc6, 0x92, 0xa3, 0x22, 0x56, 0xf3, 0xf0, 0x34, 0x79, 0x40, 0x42, 0x1a, 0xb4, 0x92,
+    0x7f, 0x9e, 0xe7, 0x14, 0x43, 0x72, 0x48, 0xb5, 0x9a, 0xc6, 0x55, 0xe8, 0x90, 0x5a, 0x16, 0x40,
+    0xfd, 0x3b, 0xa6, 0x08, 0xb0, 0x9d, 0x49, 0x89, 0x0c, 0x6b, 0x95, 0x11, 0xae, 0x5b, 0x3d, 0xa9,
+    0x25, 0x87, 0x05, 0xa4, 0xe6, 0x55, 0x62, 0x5b, 0x80, 0xbf, 0xcc, 0xff, 0xe0, 0x34, 0x70, 0x7a,
+    0x48, 0x67, 0x35, 0x2d, 0x02, 0xa6, 0x61, 0xea, 0x40, 0x38, 0xa1, 0xa5, 0x30, 0xb4, 0xfa, 0x37,
+    0xf4, 0xea, 0xa4, 0x11, 0xaa, 0x4e, 0x53, 0x05, 0x3a, 0xfc, 0x8e, 0x81, 0x34, 0x6d, 0x72, 0x80,
+    0x0b, 0x3c, 0x20, 0x70, 0xbc, 0xbb, 0x89, 0xc3, 0x67, 0xa9, 0xd2, 0x42, 0xf5, 0xb8, 0x04, 0xd2,
+    0xe1, 0x31, 0xf0, 0xb1, 0x62, 0xcd, 0x6a, 0xeb, 0x92, 0xa3, 0x09, 0x16, 0x0e, 0xf5, 0x77, 0x2f,
+    0x47, 0xed, 0x70, 0xb4, 0xd2, 0x5d, 0xc1, 0xe7, 0xf4, 0x2b, 0x7e, 0x48, 0x19, 0x26, 0xc7, 0x55,
+    0xc3, 0x4d, 0x1d, 0x17, 0xfe, 0x14, 0x02, 0xf6, 0xea, 0x07, 0x8f, 0x29, 0x84, 0x6d, 0x67, 0x06,
+    0x02, 0xc4, 0xda, 0xb1, 0xe6, 0x25, 0x77, 0x53, 0x42, 0xe4, 0x09, 0xbf, 0xb4, 0x7c, 0x13, 0x07,
+    0x17, 0xe0, 0x02, 0x2f, 0x40, 0x68, 0x17, 0x9c, 0x1e, 0x02, 0x40, 0x1b, 0xac, 0x41, 0x1f, 0x4e,
+    0xa5, 0x60, 0xd4, 0xec, 0x37, 0xdc, 0x73, 0xa3, 0x11, 0x2a, 0x85, 0x51, 0x45, 0xbd, 0x17, 0x8f,
+    0x81, 0xb0, 0x49, 0x72, 0xfc, 0x47, 0x45, 0x23, 0xbf, 0x29, 0xbb, 0xc9, 0x84, 0x39, 0xa9, 0x82,
+    0x64, 0xe0, 0xb8, 0xdc, 0xf2, 0xe0, 0x31, 0xaa, 0x46, 0x61, 0x8d, 0x36, 0xb8, 0xfd, 0x03, 0xbd,
+    0x17, 0x0e, 0xcd, 0xde, 0x27, 0x47, 0x0a, 0x9e, 0xb4, 0x92, 0xa7, 0x5b, 0xe7, 0x84, 0xe0, 0x75,
+    0x48, 0x01, 0x88, 0xcb, 0x58, 0x6c, 0xdf, 0x1d, 0x17, 0xb1, 0x85, 0x01, 0x56, 0x7c, 0x0e, 0x8f,
+    0xd5, 0x6b, 0x66, 0x67, 0xb0, 0xa1, 0xc3, 0x5a, 0x2e, 0x4c, 0xeb, 0xe6, 0xcc, 0x9a, 0xd5, 0x41,
+    0x2c, 0x0b, 0x79, 0xf0, 0x87, 0x2c, 0xdf, 0x8e, 0x96, 0x05, 0xd8, 0x25, 0xf4, 0x0f, 0x02, 0xf7,
+    0x14, 0xac, 0x41, 0xf0, 0x49, 0xa5, 0xc0, 0x3b, 0xec, 0x37, 0x38, 0x33, 0xa3, 0x11, 0xdd, 0x7d,
+    0x51, 0xc5, 0xe9, 0x12, 0x8f, 0x41, 0x7c, 0x49, 0x72, 0x60, 0x2f, 0x45, 0x23, 0xaf, 0x15, 0xbb,
+    0x49, 0x05, 0x37, 0xa9, 0x12, 0x91, 0xdf, 0xb8, 0xf8, 0xad, 0xe0, 0x31, 0x96, 0x40, 0x61, 0x0d,
+    0x4e, 0xb1, 0xfd, 0x53, 0xb6, 0x17, 0x0e, 0xe1, 0x86, 0x27, 0x47, 0xeb, 0x98, 0xb4, 0xd2, 0x3d,
+    0x57, 0xe7, 0x14, 0x58, 0x75, 0x48, 0xa1, 0x6c, 0xcb, 0x58, 0x95, 0xcb, 0x1d, 0xd7, 0xd5, 0x84,
+    0x01, 0x76, 0xf5, 0x0c, 0x8f, 0x05, 0x61, 0x66, 0x67, 0x0d, 0x89, 0xc3, 0x1a, 0xbe, 0x4a, 0xeb,
+    0x06, 0x85, 0x99, 0xd5, 0xc5, 0x1e, 0x0b, 0x79, 0x1e, 0x6d, 0x2c, 0x9f, 0x7b, 0x96, 0x05, 0xb8,
+    0x75, 0xf2, 0x0f, 0x02, 0x9a, 0x0f, 0xac, 0x81, 0x0a, 0x46, 0xa5, 0xd0, 0xbf, 0xeb, 0x37, 0x14,
+    0xf5, 0xa2, 0x11, 0xbd, 0x78, 0x51, 0x85, 0x10, 0x0e, 0x8f, 0x71, 0x73, 0x49, 0x72, 0xa0, 0x23,
+    0x45, 0x23, 0x73, 0x00, 0xbb, 0x89, 0x45, 0x35, 0xa9, 0x52, 0xb4, 0xde, 0xb8, 0xb0, 0x74, 0xe0,
+    0x31, 0x51, 0x3a, 0x61, 0xcd, 0x54, 0xc0, 0x92, 0xf3, 0xbb, 0x6a, 0xff, 0xf4, 0xec, 0x85, 0x43,
+    0xfc, 0xcd, 0xc9, 0x11, 0x16, 0x25, 0xad, 0x74, 0xd3, 0xd4, 0x39, 0x69, 0x37, 0x1d, 0x52, 0xd0,
+    0xd6, 0x32, 0x96, 0xce, 0x6d, 0xc7, 0x35, 0x2d, 0x61, 0x80, 0x7d, 0xd8, 0xc2, 0x63, 0x69, 0x98,
+    0xd9, 0x59, 0xf8, 0xdb, 0xb0, 0x66, 0x83, 0xd2, 0xba, 0xb1, 0x19, 0x66, 0x75, 0xd7, 0xc3, 0x42,
+    0x1e, 0x46, 0x15, 0xcb, 0xc7, 0x8e, 0x65, 0x01, 0x02, 0xdd, 0xcc, 0xea, 0x00, 0x26, 0x61, 0x3a,
+    0x00, 0x62, 0x5b, 0x0a, 0x78, 0xeb, 0xbf, 0x21, 0x33, 0x98, 0x46, 0x72, 0xf6, 0xa6, 0xca, 0xce,
+    0x10, 0x8f, 0xe1, 0x91, 0x37, 0x39, 0x1c, 0x66, 0x0f, 0xa8, 0xbd, 0x82, 0x37, 0x49, 0xe1, 0x96,
+    0x2a, 0xef, 0xce, 0xc7, 0x45, 0xa7, 0x8a, 0xc7, 0xbc, 0xbd, 0xc5, 0xda, 0x1b, 0x00, 0x93, 0xd3,
+    0xdf, 0xad, 0x79, 0x85, 0x62, 0xe1, 0x90, 0xfc, 0x88, 0x39, 0xaa, 0x27, 0xd2, 0x4a, 0x6f, 0xae,
+    0xcf, 0x79, 0xc3, 0x80, 0x48, 0x65, 0x28, 0xe4, 0xea, 0x8e, 0x68, 0xc7, 0x85, 0x7f, 0x43, 0xc0,
+    0x3b, 0xe2, 0xf0, 0xf8, 0x36, 0x6d, 0x3b, 0xcf, 0xa1, 0x11, 0x6b, 0xe0, 0x11, 0xd7, 0x4d, 0x55,
+    0x7f, 0xc9, 0x5d, 0x89, 0x88, 0xbc, 0x3f, 0x63, 0xcb, 0x07, 0xa0, 0x17, 0xea, 0x00, 0x59, 0x57,
+    0x3a, 0x3c, 0x68, 0xf6, 0x0a, 0x40, 0xe4, 0xd2, 0x21, 0x2b, 0x9a, 0x46, 0x28, 0x31, 0xa5, 0x4a,
+    0x0a, 0x13, 0x8f, 0xc1, 0xdc, 0x31, 0x39, 0x66, 0x10, 0x0f, 0xa8, 0xaf, 0x35, 0x1f, 0x05, 0xe1,
+    0x88, 0xa7, 0x89, 0x73, 0xc7, 0xc5, 0x07, 0x87, 0xc7, 0xb8, 0xd5, 0xc4, 0xda, 0x9f, 0xda, 0x92,
+    0x03, 0x23, 0xad, 0x79, 0x9b, 0xc7, 0x1e, 0xb0, 0x54, 0x0f, 0x21, 0xb2, 0x74, 0xd0, 0xca, 0xb1,
+    0x8a, 0xcf, 0xf9, 0x9b, 0x74, 0x48, 0x75, 0x4c, 0xe4, 0x2a, 0xb7, 0xb3, 0x96, 0x95, 0xdf, 0x26,
+    0xba, 0xb2, 0x72, 0x2e, 0xf8, 0x15, 0x0e, 0x1e, 0xcf, 0xa7, 0x6c, 0x67, 0x73, 0xda, 0x61, 0x3d,
+    0xe5, 0xe1, 0xba, 0x11, 0x78, 0x2e, 0xb9, 0x34, 0x36, 0x60, 0x07, 0x03, 0x41, 0xac, 0x61, 0x0a,
+    0xb2, 0x52, 0xd8, 0x0e, 0xfc, 0x8d, 0x7d, 0x95, 0x34, 0x22, 0xf1, 0x1b, 0x55, 0x1a, 0x59, 0x79,
+    0x8c, 0x44, 0x34, 0xc9, 0xc1, 0x9a, 0x45, 0x3f, 0xb6, 0xa1, 0xd1, 0x08, 0x8b, 0x6b, 0x37, 0x39,
+    0x0c, 0x95, 0xaa, 0x7e, 0x12, 0xc7, 0xb5, 0xfb, 0x8a, 0xc7, 0x1e, 0xa4, 0xc2, 0x9a, 0x1c, 0x80,
+    0xc3, 0x03, 0x79, 0xbb, 0x7f, 0x55, 0x80, 0xe1, 0x70, 0x0a, 0x4e, 0x39, 0x5e, 0xcb, 0xd2, 0x4a,
+    0x24, 0xea, 0xce, 0x79, 0x2a, 0x78, 0x48, 0x0b, 0x43, 0x66, 0xac, 0x02, 0x8a, 0xc7, 0x35, 0x93,
+    0x32, 0xc0, 0x05, 0x35, 0xf1, 0x38, 0x39, 0x3b, 0x3b, 0xe7, 0xa5, 0x0f, 0xeb, 0x10, 0xbe, 0xd6,
+    0xdd, 0x71, 0xf8, 0xc6, 0xab, 0x54, 0xb4, 0xfa, 0xe4, 0xb3, 0x90, 0x07, 0xa4, 0x3e, 0xe9, 0xa0,
+    0x5b, 0x57, 0x3a, 0x70, 0x17, 0xf3, 0x8a, 0x71, 0x7c, 0x34, 0x12, 0xc6, 0x24, 0x55, 0x8a, 0x6c,
+    0x77, 0x8c, 0x5d, 0x7a, 0xc9, 0x31, 0x92, 0x73, 0x40, 0xaa, 0x69, 0xf9, 0x88, 0x14, 0x31, 0x3c,
+    0x19, 0xbb, 0x95, 0x2a, 0x73, 0x2c, 0xc7, 0x25, 0x82, 0x81, 0xc7, 0x7c, 0xef, 0xc3, 0x5a, 0x7b,
+    0xb9, 0x92, 0x93, 0xf3, 0xaa, 0x79, 0xb8, 0x18, 0x1e, 0x90, 0x03, 0x59, 0x39, 0xfa, 0x64, 0xd0,
+    0xca, 0xf9, 0x21, 0xcf, 0xe9, 0x20, 0x72, 0x48, 0x59, 0xdf, 0xe2, 0x2a, 0x22, 0xa3, 0x96, 0xfd,
+    0xc9, 0x21, 0xba, 0xc1, 0xd4, 0xef, 0xd8, 0xae, 0x5c, 0x3b, 0xdb, 0x27, 0x0c, 0xeb, 0x61, 0xf7,
+    0xd6, 0x9d, 0x2e, 0x69, 0xc9, 0xc5, 0x44, 0x01, 0xfb, 0xd0, 0x8c, 0x9a, 0x07, 0xdb, 0x8c, 0xea,
+    0xa0, 0xa4, 0x69, 0x3a, 0x20, 0xd9, 0xf5, 0x8a, 0x48, 0x6b, 0xd3, 0x11, 0x1b, 0x03, 0x49, 0x1e,
+    0xb7, 0xf4, 0x8a, 0x69, 0xa0, 0xc9, 0x39, 0xad, 0x7e, 0x40, 0x2d, 0x3a, 0xf9, 0x88, 0x9b, 0x6e,
+    0x3c, 0xb1, 0xdc, 0x2f, 0xab, 0xf2, 0x79, 0xdb, 0xd5, 0x13, 0xf1, 0xc9, 0xf4, 0xef, 0xc5, 0x9a,
+    0xff, 0xf7, 0x92, 0x03, 0x10, 0xad, 0x79, 0xf5, 0x7b, 0x1f, 0xb0, 0xae, 0x0e, 0x21, 0xba, 0x72,
+    0xcb, 0x47, 0xfa, 0xd6, 0x6d, 0xe9, 0xf6, 0x85, 0x48, 0xe7, 0x23, 0xe3, 0x6a, 0xe6, 0xf5, 0x96,
+    0x15, 0x10, 0x25, 0xba, 0xd8, 0xfc, 0x2e, 0x98, 0x50, 0x02, 0x23, 0xc3, 0x03, 0x07, 0x68, 0xb2,
+    0xac, 0xd6, 0x9d, 0xf9, 0x86, 0xc9, 0x07, 0x25, 0x01, 0x3b, 0x3d, 0xdd, 0x9a, 0x07, 0xd6, 0x0b,
+    0xea, 0x00, 0xbe, 0x73, 0x3a, 0x4c, 0xfd, 0x56, 0x0a, 0xfd, 0x1a, 0xc0, 0xc1, 0x19, 0x91, 0x46,
+    0xec, 0x32, 0xa6, 0x8a, 0x1f, 0x27, 0x8f, 0x41, 0xae, 0x2e, 0x39, 0x26, 0x1f, 0x10, 0x28, 0x2b,
+    0x87, 0x37, 0xa9, 0x2d, 0x96, 0x2a, 0x9a, 0x76, 0xc7, 0x05, 0xc4, 0x92, 0xc7, 0x70, 0x57, 0xc3,
+    0x1a, 0x44, 0x2a, 0x93, 0xd3, 0x4d, 0xa6, 0x79, 0x35, 0xac, 0xf8, 0x4f, 0xc6, 0x32, 0x1c, 0x16,
+    0x5e, 0x2d, 0x47, 0x62, 0x97, 0x5a, 0x89, 0x16, 0xe3, 0x39, 0x07, 0x11, 0x11, 0xe9, 0x09, 0x5c,
+    0x5c, 0x6d, 0x27, 0xf1, 0xb8, 0xaa, 0x37, 0x07, 0x98, 0x35, 0x33, 0x1e, 0xcf, 0x3b, 0x69, 0x67,
+    0x42, 0x5c, 0x62, 0x4d, 0x53, 0xdc, 0xba, 0x47, 0xef, 0x2e, 0x79, 0x72, 0xc3, 0x90, 0x07, 0x6f,
+    0x25, 0xe8, 0x40, 0x2f, 0x60, 0x3a, 0xd0, 0xc1, 0xee, 0x0a, 0x81, 0xda, 0xd2, 0xf1, 0xb6, 0xf4,
+    0x48, 0xaa, 0xea, 0xa2, 0x8a, 0xb9, 0xf5, 0x8e, 0xe9, 0x65, 0x26, 0x39, 0x9e, 0xb4, 0x0e, 0x08,
+    0x31, 0x0b, 0x1f, 0x69, 0xc6, 0x85, 0x27, 0x20, 0xed, 0x65, 0xc5, 0xa0, 0x7e, 0xc7, 0xc8, 0x6d,
+    0xc2, 0x5a, 0x7d, 0xa6, 0x92, 0x83, 0xca, 0xa6, 0x79, 0x02, 0x5a, 0x1d, 0xb0, 0x7d, 0x0a, 0x21,
+    0x46, 0xef, 0xc1, 0xc7, 0x12, 0x2b, 0x5a, 0xe9, 0x50, 0xd4, 0x39, 0x71, 0x06, 0x0e, 0xa9, 0x86,
+    0x36, 0x5c, 0x65, 0x1c, 0xcf, 0xb2, 0xf3, 0x2c, 0x44, 0x17, 0x1c, 0xa5, 0x05, 0xcf, 0x6e, 0x5c,
+    0x64, 0xe4, 0xf0, 0xec, 0x1c, 0x50, 0x2d, 0xac, 0xbb, 0xa6, 0x5a, 0x37, 0xbe, 0x7c, 0x25, 0x07,
+    0x42, 0x02, 0xe9, 0x80, 0x51, 0x57, 0x3a, 0xec, 0x3e, 0xf9, 0x0d, 0xa3, 0xb1, 0x34, 0xb2, 0xfe,
+    0x18, 0x55, 0xa2, 0xc1, 0x78, 0x4c, 0xe4, 0x46, 0xc9, 0x91, 0xa6, 0x78, 0x40, 0x5c, 0xb3, 0xf8,
+    0x68, 0x6e, 0x5c, 0x37, 0x55, 0xc3, 0x94, 0x2a, 0x25, 0x20, 0xc7, 0xc5, 0x8c, 0x80, 0xc7, 0xe8,
+    0x9d, 0xc3, 0xda, 0xb0, 0xb1, 0x92, 0xcb, 0x6e, 0xaa, 0x79, 0xab, 0xce, 0x1d, 0x90, 0x85, 0x2a,
+    0x1c, 0xf2, 0x6a, 0x2a, 0xc7, 0x76, 0x00, 0x5a, 0xf9, 0xda, 0xe3, 0x39, 0x3f, 0x86, 0x0d, 0x29,
+    0x58, 0x6d, 0x5c, 0x25, 0x47, 0xcf, 0xb2, 0x20, 0xb6, 0x1d, 0x37, 0xd8, 0xd5, 0x00, 0x97, 0x96,
+    0xc1, 0x63, 0xb3, 0x1f, 0xed, 0xec, 0xd0, 0x34, 0xac, 0xe5, 0x15, 0x5b, 0x37, 0x3d, 0xa6, 0x25,
+    0x07, 0xc4, 0xe4, 0xc2, 0x40, 0x1c, 0x77, 0x35, 0x04, 0x4d, 0x59, 0x0a, 0xb9, 0x6e, 0xbf, 0x71,
+    0x6e, 0x96, 0x46, 0x52, 0xbb, 0xa4, 0x0a, 0x64, 0x07, 0x8f, 0x69, 0x95, 0x3d, 0x3f, 0x60, 0xbe,
+    0xd2, 0x28, 0xc8, 0x5e, 0x37, 0x0d, 0xe0, 0x96, 0x2a, 0x03, 0x41, 0xc7, 0xc5, 0xc8, 0x86, 0xc7,
+    0x2c, 0x2d, 0xc4, 0x5a, 0x66, 0x12, 0x89, 0xdb, 0x2c, 0x74, 0x78, 0x2d, 0xac, 0xf7, 0xef, 0xfd,
+    0x2a, 0x1c, 0xda, 0xf3, 0x2c, 0x47, 0x66, 0x0b, 0x5a, 0x89, 0xa8, 0xeb, 0x39, 0x57, 0x48, 0x0e,
+    0x29, 0x50, 0xae, 0x52, 0x65, 0xb9, 0x9f, 0xb1, 0x42, 0x63, 0x1d, 0x77, 0x4e, 0xf3, 0x00, 0x23,
+    0xa0, 0xc0, 0xe3, 0x7f, 0x87, 0xed, 0x2c, 0x17, 0x35, 0xac, 0x1f, 0x1c, 0x0e, 0xb7, 0xe7, 0x04,
+    0x1c, 0x07, 0xf3, 0xdf, 0xe9, 0xc0, 0xdb, 0x5d, 0x3a, 0x50, 0x90, 0xf4, 0x8a, 0xb6, 0x20, 0xd3,
+    0x81, 0x4c, 0x00, 0x49, 0xe8, 0x0b, 0xa6, 0x8a, 0x19, 0xef, 0x8e, 0x51, 0x8d, 0x33, 0x39, 0x50,
+    0xe7, 0x0e, 0x28, 0x03, 0x30, 0x1f, 0xd5, 0xae, 0x89, 0x27, 0xe3, 0x19, 0x66, 0xa5, 0xa4, 0x7c,
+    0xc7, 0xb6, 0x93, 0xc5, 0x1a, 0x52, 0xc4, 0x92, 0x33, 0xf9, 0xad, 0x79, 0x27, 0x9d, 0x1e, 0x90,
+    0x9f, 0x0e, 0x21, 0x02, 0xb8, 0xc8, 0x47, 0xa6, 0x30, 0x5a, 0xa9, 0xdf, 0xe8, 0x39, 0x77, 0x93,
+    0x0f, 0x29, 0xa2, 0x56, 0x5c, 0x55, 0xe5, 0xda, 0xb2, 0xd8, 0x1a, 0x44, 0x97, 0x14, 0xdb, 0x05,
+    0x27, 0xb7, 0x5c, 0xe4, 0x87, 0x68, 0xed, 0x4c, 0x60, 0x40, 0xac, 0xf1, 0xf1, 0x5a, 0x77, 0x36,
+    0xea, 0x25, 0x07, 0x55, 0xd8, 0xea, 0x80, 0xae, 0x65, 0x3a, 0x90, 0x54, 0x5b, 0x0a, 0x03, 0xf6,
+    0xbf, 0x91, 0xa0, 0x98, 0x46, 0x84, 0xe7, 0xa6, 0x8a, 0x1b, 0x20, 0x8f, 0x59, 0x81, 0x35, 0x39,
+    0xdf, 0xd9, 0x0f, 0x08, 0x46, 0x31, 0x1f, 0xed, 0x94, 0xf2, 0x26, 0x12, 0xa0, 0x52, 0x05, 0xe9,
+    0x00, 0xb9, 0x7c, 0xe1, 0xf0, 0x98, 0x0c, 0xc6, 0x58, 0x7b, 0xc6, 0x5f, 0x72, 0x45, 0xc9, 0x35,
+    0x6f, 0xca, 0xf3, 0x03, 0xae, 0x8a, 0x85, 0x43, 0x73, 0x29, 0xe6, 0x58, 0xcd, 0x4a, 0x2b, 0x9f,
+    0x87, 0x3e, 0x27, 0x39, 0x0e, 0x22, 0xcd, 0xd3, 0x8f, 0xab, 0x2f, 0xc6, 0x5b, 0x56, 0xc3, 0xbe,
+    0xe3, 0x32, 0x5c, 0x20, 0xe0, 0x26, 0xb2, 0x78, 0x3c, 0xe1, 0xad, 0x9d, 0xa7, 0xf3, 0x89, 0xb5,
+    0xcf, 0x67, 0xeb, 0x06, 0xce, 0x42, 0xe8, 0xc0, 0x71, 0x7e, 0x35, 0x20, 0x7b, 0x54, 0x0a, 0x14,
+    0x4d, 0xbf, 0x91, 0x0f, 0x8c, 0x46, 0x02, 0xcb, 0xa2, 0x4a, 0x44, 0x0b, 0x8f, 0xe9, 0xb9, 0x24,
+    0x39, 0xb6, 0x26, 0xe8, 0xc7, 0x4d, 0x2a, 0x1a, 0x81, 0x7b, 0xeb, 0x26, 0xcb, 0x6a, 0x52, 0x35,
+    0xcf, 0xdd, 0xb8, 0xea, 0x14, 0xf0, 0x18, 0x51, 0x4f, 0x58, 0xe3, 0xec, 0x56, 0x72, 0x9a, 0x0f,
+    0x0e, 0x6f, 0x36, 0xd2, 0xfe, 0x69, 0xd9, 0x85, 0x43, 0xe1, 0xe3, 0xe4, 0x08, 0xba, 0x47, 0x2b,
+    0xd7, 0xa5, 0x3a, 0x27, 0xb2, 0xca, 0x21, 0x5d, 0xbd, 0x87, 0xab, 0x25, 0xc9, 0x32, 0x76, 0xc7,
+    0xb4, 0xe3, 0xe6, 0x5a, 0x18, 0x60, 0x60, 0x49, 0x78, 0xcc, 0x2c, 0x9a, 0x9d, 0xe1, 0x95, 0x86,
+    0x75, 0x1d, 0x4b, 0xeb, 0x06, 0x7a, 0x17, 0xea, 0xa0, 0x80, 0x6e, 0x3a, 0x6c, 0x65, 0xf3, 0x0a,
+    0xce, 0x85, 0xd3, 0x91, 0xbf, 0xf9, 0x48, 0xf8, 0x09, 0xf5, 0x4a, 0x3f, 0xae, 0x98, 0xa9, 0xa4,
+    0x33, 0x39, 0x57, 0x97, 0x0f, 0x08, 0x57, 0x23, 0x1f, 0x01, 0xdf, 0x8c, 0x27, 0x20, 0xf5, 0x65,
+    0xb5, 0xef, 0x69, 0xbb, 0xc2, 0x40, 0x3e, 0x19, 0x28, 0xa5, 0x58, 0x23, 0xc9, 0x5e, 0x72, 0x54,
+    0x50, 0x35, 0x4f, 0xec, 0xea, 0x03, 0xbe, 0x58, 0x21, 0xc4, 0x67, 0x42, 0xf9, 0x48, 0xd1, 0xbb,
+    0x2d, 0x1d, 0xa3, 0x8a, 0x67, 0xc0, 0x25, 0x22, 0x05, 0x1a, 0x88, 0xab, 0x5f, 0xfb, 0x5b, 0xd6,
+    0xca, 0x87, 0xe8, 0x1a, 0xf2, 0xbb, 0xe0, 0xf0, 0xe5, 0x8b, 0x0c, 0xa6, 0x1a, 0xa0, 0x49, 0xdf,
+    0xd6, 0xf5, 0xb7, 0x53, 0xeb, 0x06, 0x05, 0x89, 0xe8, 0x80, 0xf9, 0x5c, 0x3a, 0xc8, 0x54, 0xf0,
+    0x0a, 0xa8, 0xd0, 0xd2, 0x81, 0xb7, 0xf9, 0x48, 0xaa, 0x76, 0xa3, 0x4a, 0x65, 0xf3, 0x8e, 0x91,
+    0xaa, 0x29, 0x39, 0x44, 0x8a, 0x0e, 0xc8, 0xe3, 0x19, 0x1f, 0x0d, 0x39, 0x85, 0x27, 0x8b, 0x23,
+    0x66, 0xb5, 0xfb, 0x46, 0xbb, 0x72, 0x68, 0xf0, 0x58, 0xc8, 0x53, 0x58, 0x73, 0xd2, 0x56, 0x72,
+    0x8c, 0xed, 0x34, 0xaf, 0xd5, 0xb5, 0x03, 0xea, 0x3c, 0x21, 0x44, 0xb6, 0x74, 0xf8, 0xd8, 0x03,
+    0x44, 0x2b, 0x8b, 0x40, 0x3b, 0xe7, 0xe1, 0xbf, 0x21, 0xcd, 0xce, 0x88, 0xab, 0x66, 0x0d, 0x5a,
+    0x56, 0xf6, 0x87, 0xe8, 0xa2, 0xea, 0xb5, 0x60, 0x42, 0x83, 0x8b, 0xac, 0xb7, 0xa5, 0x9d, 0xb5,
+    0x6b, 0x85, 0x75, 0x56, 0x6f, 0xeb, 0x06, 0xc6, 0xc4, 0xea, 0xa0, 0xec, 0x71, 0x3a, 0x20, 0xc9,
+    0xf5, 0x0a, 0x81, 0x98, 0xd3, 0x61, 0xef, 0x91, 0x46, 0x8a, 0x9f, 0xa7, 0x8a, 0xfd, 0x1c, 0x8f,
+    0x61, 0x96, 0x35, 0x39, 0x63, 0x00, 0x10, 0xe8, 0xca, 0x2d, 0x1f, 0x31, 0x0c, 0x8e, 0xa7, 0x7e,
+    0xcb, 0x52, 0x45, 0x67, 0xfa, 0xb8, 0xc8, 0x2c, 0xf2, 0x98, 0x9b, 0x97, 0x58, 0x4b, 0x91, 0x65,
+    0x72, 0x3e, 0x24, 0x35, 0x8f, 0x0c, 0x05, 0x04, 0x46, 0x28, 0x21, 0xc4, 0xe5, 0x09, 0xe6, 0x28,
+    0x8e, 0x52, 0x2b, 0x39, 0x75, 0x3d, 0x67, 0x2b, 0x31, 0x22, 0x65, 0xa1, 0x8c, 0xab, 0x5a, 0x20,
+    0x5c, 0xf6, 0x80, 0x9a, 0xe8, 0x4a, 0x2f, 0x20, 0xe0, 0x03, 0xc5, 0x78, 0xfc, 0xed, 0xac, 0x9d,
+    0x4f, 0xfe, 0x89, 0xf5, 0x0d, 0x79, 0xeb, 0x06, 0x17, 0x3a, 0xe9, 0x80, 0x24, 0x58, 0x3a, 0xec,
+    0x86, 0x58, 0x8a, 0x0b, 0x37, 0xbf, 0x31, 0x15, 0x98, 0x46, 0xfa, 0x63, 0xa3, 0x8a, 0xad, 0x1e,
+    0x8f, 0x89, 0x17, 0x2a, 0x39, 0xdc, 0x27, 0x0f, 0x08, 0x4b, 0x1c, 0x1f, 0xf1, 0x78, 0xeb, 0xa6,
+    0xa0, 0xbb, 0x52, 0xb5, 0x71, 0xe3, 0xb8, 0xb0, 0xaa, 0xf0, 0x18, 0x0c, 0x71, 0x58, 0xa3, 0x92,
+    0x58, 0x72, 0xb6, 0x43, 0x35, 0x8f, 0x1a, 0xe9, 0xfe, 0x4d, 0x65, 0x85, 0x43, 0xcb, 0x66, 0xe5,
+    0x28, 0xd0, 0x40, 0x2b, 0x5f, 0xd6, 0x3c, 0x67, 0x16, 0xb5, 0x21, 0x85, 0xfc, 0x8e, 0xab, 0x59,
+    0xfe, 0x59, 0x36, 0x3c, 0xb9, 0xe3, 0x12, 0x6e, 0x1b, 0xe0, 0x1f, 0x39, 0x78, 0x6c, 0x42, 0xa7,
+    0x9d, 0xf7, 0xa2, 0x86, 0x35, 0x5d, 0x72, 0xeb, 0x06, 0x9b, 0x17, 0xc3, 0x20, 0x6c, 0x44, 0x1d,
+    0x70, 0xd8, 0xb2, 0x06, 0x63, 0xef, 0x4a, 0x91, 0x6b, 0x02, 0x38, 0x72, 0xf7, 0xd1, 0x88, 0xa1,
+    0xcf, 0x54, 0xb1, 0xa8, 0xe3, 0x31, 0x61, 0xfa, 0x25, 0x47, 0x56, 0x2c, 0xfd, 0x28, 0x96, 0x46,
+    0xa3, 0xb4, 0x5f, 0xde, 0x74, 0xd5, 0x4e, 0xaa, 0xbc, 0x6a, 0x1f, 0x17, 0xc0, 0x1f, 0x1e, 0x2b,
+    0x18, 0x13, 0x6b, 0x82, 0x1b, 0x4c, 0x4e, 0x9a, 0xc4, 0xe1, 0x99, 0x93, 0xe2, 0x3f, 0xfb, 0xc0,
+    0x70, 0xd8, 0xe5, 0xb7, 0x1c, 0x37, 0x1f, 0x6a, 0x65, 0x5a, 0x8f, 0xe7, 0xfc, 0x61, 0x44, 0xa4,
+    0xd9, 0x80, 0x4a, 0x35, 0xb3, 0x28, 0xae, 0xca, 0x52, 0xd2, 0xd8, 0x4c, 0x05, 0x8f, 0xfb, 0x4a,
+    0x74, 0x80, 0xd9, 0x52, 0xe3, 0x31, 0x86, 0x83, 0x76, 0x06, 0x10, 0x20, 0xe8, 0xe0, 0x2d, 0x7d,
+    0x35, 0xcc, 0xea, 0x53, 0x0a, 0xd6, 0x49, 0xbf, 0xd1, 0xf8, 0x88, 0x46, 0x78, 0xf2, 0xa2, 0x8a,
+    0x8d, 0xf7, 0x8e, 0x21, 0x20, 0x26, 0x39, 0x97, 0xbb, 0xe7, 0x87, 0x0d, 0xd9, 0x01, 0x49, 0xef,
+    0x45, 0xa3, 0x47, 0x43, 0xdd, 0xb4, 0x83, 0x4e, 0xaa, 0xc0, 0x55, 0x1b, 0x17, 0x5d, 0xfe, 0x1d,
+    0x13, 0x4e, 0x09, 0x6b, 0xa0, 0xb0, 0x4a, 0x4e, 0x9e, 0xc3, 0xe1, 0xc9, 0x67, 0xd9, 0xbf, 0x60,
+    0xbb, 0x70, 0x68, 0x55, 0x9a, 0x1c, 0xed, 0xd1, 0x68, 0x25, 0xe2, 0x4d, 0xe7, 0x74, 0xbb, 0x38,
+    0xa4, 0x09, 0xd1, 0x70, 0xb5, 0xb2, 0x5c, 0xc6, 0x42, 0x38, 0x75, 0x5c, 0xb6, 0x23, 0x03, 0x1c,
+    0x25, 0x02, 0x8f, 0x1d, 0xac, 0xb3, 0x73, 0xd4, 0xb8, 0xb0, 0x06, 0x8c, 0xe2, 0xc1, 0xe0, 0x45,
+    0x14, 0x1d, 0xf8, 0xf3, 0xaf, 0x86, 0x8d, 0xb8, 0x4a, 0xc1, 0x96, 0xea, 0x37, 0xae, 0x21, 0xd2,
+    0x48, 0x4a, 0x5d, 0x54, 0x69, 0x03, 0xe4, 0x31, 0x8d, 0xa6, 0x24, 0x87, 0x32, 0x0d, 0xfd, 0xac,
+    0xf6, 0x45, 0xa3, 0x2c, 0x8b, 0xdd, 0x54, 0xe6, 0x50, 0xaa, 0x9e, 0x05, 0x1c, 0x97, 0x6c, 0x15,
+    0x1e, 0xe3, 0x9a, 0x0a, 0x6b, 0x21, 0x2b, 0x24, 0x8e, 0x36, 0x67, 0xc9, 0x11, 0x36, 0x38, 0x3c,
+    0x1c, 0x7d, 0xfb, 0xe7, 0x5f, 0x17, 0x0e, 0x73, 0x4b, 0x94, 0xa3, 0x36, 0x20, 0xad, 0xb4, 0x4b,
+    0xed, 0x9c, 0x21, 0x34, 0x87, 0x14, 0x11, 0x54, 0xa9, 0x72, 0x34, 0xc5, 0xd5, 0x5f, 0x6e, 0x19,
+    0xab, 0x72, 0xdf, 0x71, 0xe5, 0x56, 0x0c, 0xb0, 0x75, 0x39, 0x3c, 0x06, 0x14, 0xd8, 0xe9, 0xc0,
+    0xb5, 0x72, 0x3a, 0x78, 0xd0, 0x56, 0x8a, 0xa0, 0x02, 0xc0, 0x31, 0xaa, 0x91, 0x46, 0x5a, 0xa9,
+    0xa5, 0x8a, 0xa1, 0x2a, 0x8f, 0xd1, 0xbe, 0x2c, 0x39, 0xde, 0x21, 0x10, 0xa8, 0x3c, 0x3e, 0x1a,
+    0x7d, 0xb4, 0xe2, 0x23, 0x38, 0x0a, 0xde, 0x84, 0x46, 0x58, 0xaa, 0x2a, 0x7c, 0x1d, 0x57, 0x32,
+    0x49, 0x1e, 0xab, 0x62, 0x0c, 0x6b, 0x44, 0x91, 0x4c, 0xae, 0x2c, 0x98, 0xe6, 0x19, 0xe7, 0xe1,
+    0x3f, 0x2a, 0xca, 0x70, 0xb8, 0x97, 0xb2, 0x1c, 0x73, 0x41, 0x6a, 0xe5, 0x3a, 0x87, 0xe7, 0xdc,
+    0x04, 0x43, 0xa4, 0xcd, 0x73, 0x71, 0x15, 0xa1, 0x85, 0xc6, 0x0a, 0xf8, 0x6c, 0x59, 0xd2, 0x18,
+    0x8f, 0x8b, 0x01, 0x70, 0x80, 0x15, 0x2d, 0xe3, 0x71, 0x8e, 0x8c, 0x76, 0x06, 0x3a, 0x1f, 0xe9,
+    0x60, 0xf4, 0x55, 0x3a, 0x88, 0x65, 0x58, 0x8a, 0xe6, 0x61, 0x5e, 0x51, 0x86, 0xe5, 0x37, 0xd6,
+    0xd8, 0xd2, 0x08, 0x83, 0x6a, 0x54, 0x79, 0xbb, 0xe2, 0x31, 0x57, 0x3c, 0x25, 0x67, 0x1a, 0xe1,
+    0x01, 0x25, 0x39, 0xe3, 0x23, 0xc2, 0x79, 0xdd, 0xf4, 0xf6, 0x52, 0xaa, 0xe4, 0xbd, 0x1c, 0x17,
+    0x7c, 0xfe, 0x1d, 0x13, 0x82, 0x0f, 0x6b, 0x11, 0xbf, 0x4a, 0x0e, 0xac, 0xac, 0xe6, 0xb9, 0x8a,
+    0xdc, 0x3f, 0x4e, 0xed, 0x0e, 0xc8, 0xf1, 0x14, 0x0e, 0xc3, 0x71, 0x95, 0x23, 0xaf, 0xfd, 0xac,
+    0x74, 0xc8, 0xf2, 0x9c, 0xc8, 0xc7, 0x86, 0xf4, 0x42, 0x38, 0xae, 0xe6, 0x01, 0x68, 0xd9, 0xf9,
+    0xd4, 0x8e, 0xbb, 0xed, 0x6c, 0x80, 0xc9, 0xba, 0xe0, 0xb1, 0x8d, 0x95, 0x76, 0x06, 0x53, 0x36,
+    0xea, 0xa0, 0x9c, 0x6b, 0x3a, 0xc4, 0x35, 0xf4, 0x0a, 0x9a, 0x0f, 0xc0, 0x41, 0x0c, 0x8d, 0x46,
+    0xfa, 0x00, 0xa7, 0x0a, 0x52, 0x02, 0x8f, 0x51, 0x02, 0x34, 0x39, 0x7b, 0x95, 0x0f, 0x68, 0xa5,
+    0x25, 0x1f, 0xd9, 0x44, 0xf2, 0xa6, 0x25, 0x9d, 0xf1, 0x24, 0x77, 0x4d, 0xaa, 0x52, 0xc0, 0x1f,
+    0x97, 0x04, 0x0b, 0x1e, 0x1b, 0x3e, 0x16, 0x6b, 0xbd, 0xbd, 0x4b, 0xae, 0x64, 0xaf, 0xe6, 0xb5,
+    0x2e, 0x7d, 0xc0, 0x84, 0xba, 0x70, 0x58, 0xda, 0xb9, 0x1c, 0x6d, 0xcb, 0x69, 0x65, 0xe3, 0x98,
+    0xe7, 0x04, 0xc4, 0x43, 0xa4, 0xe5, 0x2a, 0x71, 0xb5, 0x74, 0x7d, 0xcb, 0x92, 0x5a, 0x76, 0xdc,
+    0x09, 0x26, 0xa2, 0xfb, 0xdc, 0x7c, 0x80, 0x27, 0x60, 0xe2, 0x71, 0xf6, 0x9c, 0x76, 0x06, 0x9e,
+    0x78, 0xe8, 0x60, 0xa2, 0x6c, 0x3a, 0x30, 0xd3, 0xee, 0x0a, 0xce, 0xa5, 0xbf, 0x81, 0xec, 0x87,
+    0x46, 0xb6, 0x76, 0x1e, 0x49, 0xa6, 0x80, 0x54, 0x09, 0x09, 0xe0, 0x31, 0x3a, 0x05, 0x25, 0xc7,
+    0x36, 0xe6, 0x01, 0xe5, 0xa1, 0xe1, 0x23, 0x42, 0x01, 0xf1, 0x54, 0x06, 0x53, 0xaa, 0xd8, 0x8b,
+    0x1b, 0x97, 0x9f, 0x23, 0x1e, 0xa3, 0x24, 0x08, 0x6b, 0x2b, 0x89, 0x4b, 0x2e, 0x8a, 0x92, 0xe6,
+    0x39, 0xd0, 0x78, 0x40, 0x32, 0xc8, 0x70, 0xe8, 0x8d, 0x83, 0x10, 0x6d, 0xc1, 0x93, 0x63, 0xb5,
+    0x36, 0xad, 0x84, 0xc2, 0xe9, 0x9c, 0x81, 0xbe, 0x87, 0xd4, 0x30, 0x19, 0xae, 0xc2, 0xd0, 0x69,
+    0x59, 0x9e, 0x29, 0xa2, 0x9b, 0xd7, 0x67, 0x80, 0xc3, 0x2b, 0xe1, 0xf1, 0xdd, 0x7c, 0x76, 0x06,
+    0xef, 0x30, 0xea, 0x60, 0x37, 0x59, 0x3a, 0x20, 0x88, 0xf6, 0x0a, 0x26, 0x9e, 0xbf, 0xd1, 0x05,
+    0x5f, 0x3a, 0x42, 0xfd, 0xd2, 0x48, 0x10, 0xb6, 0x54, 0x29, 0x1e, 0xe1, 0x31, 0x9d, 0x76, 0x26,
+    0xa7, 0x80, 0xdf, 0x01, 0x49, 0x5c, 0xe7, 0xa3, 0xf1, 0x1d, 0xf1, 0xa4, 0xc4, 0x5b, 0xaa, 0x7a,
+    0x02, 0x1e, 0x97, 0xb3, 0x70, 0xed, 0xfa, 0xbb, 0xc3, 0x63, 0x60, 0x7e, 0x62, 0x8d, 0x3c, 0x70,
+    0xc9, 0x51, 0x9c, 0xd6, 0xbc, 0xa9, 0x75, 0x0f, 0x88, 0x22, 0x87, 0x10, 0xd3, 0x71, 0x97, 0x23,
+    0x5f, 0x0d, 0xad, 0x84, 0xa0, 0xf8, 0x9c, 0x88, 0x79, 0x87, 0xd4, 0x44, 0x41, 0xae, 0xd6, 0x2f,
+    0x6c, 0xd9, 0xd3, 0x59, 0xa2, 0xab, 0x66, 0x80, 0x80, 0xc5, 0x5e, 0x5d, 0x70, 0x2a, 0x19, 0x3c,
+    0x06, 0xdb, 0x72, 0xe8, 0xa0, 0xfc, 0x5b, 0x3a, 0x28, 0x0e, 0xf0, 0x8a, 0xf7, 0xcb, 0xd2, 0x51,
+    0x8f, 0xf8, 0x48, 0x26, 0x62, 0xa3, 0x8a, 0x00, 0xef, 0x8e, 0x61, 0x62, 0x29, 0x39, 0xaa, 0x78,
+    0x0e, 0x68, 0x53, 0x18, 0x1f, 0xf9, 0x11, 0x85, 0x27, 0xdc, 0x18, 0x66, 0x35, 0xcd, 0xdb, 0xb8,
+    0xa8, 0xe0, 0x68, 0x17, 0x68, 0x02, 0x1e, 0xfb, 0xd5, 0x0a, 0x6b, 0x93, 0xae, 0x4a, 0x4e, 0xf2,
+    0x9e, 0xe6, 0xb5, 0x2b, 0x76, 0x40, 0x74, 0x29, 0x84, 0x38, 0xee, 0x0c, 0x1f, 0xef, 0x6a, 0x68,
+    0xa5, 0x16, 0xd2, 0xb6, 0x64, 0x82, 0xec, 0x9c, 0x8b, 0x56, 0xc4, 0xd3, 0xa0, 0xde, 0x90, 0x32,
+    0x21, 0xc4, 0xd5, 0xa6, 0x03, 0x2d, 0xbb, 0x93, 0x42, 0x74, 0x7b, 0xee, 0x5a, 0xf0, 0x8c, 0xbb,
+    0x45, 0x06, 0xb3, 0x65, 0xe8, 0x20, 0x06, 0x6b, 0x3a, 0x58, 0xbb, 0xee, 0x0a, 0x0b, 0x25, 0xd3,
+    0xf1, 0x3a, 0xf4, 0x48, 0x62, 0xe5, 0xf1, 0x0a, 0xd9, 0x0e, 0x8f, 0x21, 0x2d, 0x17, 0x33, 0x72,
+    0xa9, 0x24, 0x27, 0x73, 0xef, 0x01, 0xf1, 0x1a, 0xe0, 0xa3, 0xdb, 0x2b, 0xf1, 0x14, 0x6f, 0xb9,
+    0xac, 0xb8, 0x24, 0x6a, 0xd7, 0x0f, 0xc6, 0x27, 0xe3, 0xd7, 0x09, 0x6b, 0x39, 0x11, 0x88, 0x0d,
+    0x74, 0x67, 0xc9, 0x75, 0xed, 0xd2, 0x3c, 0x1c, 0xfa, 0x0e, 0xd8, 0x31, 0x85, 0x10, 0xc1, 0x84,
+    0xe1, 0x63, 0x1a, 0xf0, 0xb6, 0x8c, 0x97, 0x1f, 0x9e, 0x34, 0x95, 0x87, 0xd4, 0xca, 0x1b, 0xae,
+    0xd6, 0xeb, 0x68, 0x59, 0x48, 0x3c, 0xa2, 0xcb, 0xbf, 0xd1, 0x82, 0x2f, 0x9d, 0x2f, 0xf2, 0xfe,
+    0x18, 0x80, 0x06, 0xae, 0x10, 0x27, 0x00, 0x78, 0x2e, 0x1d, 0xc4, 0xf8, 0x40, 0x84, 0x27, 0x62,
+    0xe9, 0xd0, 0x63, 0xce, 0x2b, 0xd2, 0xbc, 0x4b, 0x87, 0xeb, 0xff, 0x23, 0xd9, 0xa0, 0xca, 0x2b,
+    0x3b, 0xbf, 0x62, 0x66, 0xc9, 0xc5, 0xe4, 0xf0, 0x03, 0x3a, 0x20, 0xc2, 0xc1, 0x7c, 0x64, 0xeb,
+    0x1c, 0x9e, 0x36, 0xe3, 0x98, 0xd5, 0x3d, 0x59, 0xed, 0x1a, 0xd1, 0xf8, 0x64, 0x4b, 0x58, 0x62,
+    0xed, 0x9e, 0x20, 0xb1, 0x81, 0x61, 0x2b, 0x39, 0x5f, 0xc9, 0x9a, 0xc7, 0x8e, 0xe3, 0x01, 0xdf,
+    0xd5, 0x10, 0x22, 0x25, 0x72, 0x7c, 0xf4, 0x42, 0xd9, 0x96, 0xe4, 0x45, 0xc5, 0x73, 0x02, 0xec,
+    0x90, 0xca, 0xba, 0xb8, 0xd2, 0xfa, 0xac, 0xb8, 0xea, 0x5c, 0xae, 0x65, 0x0f, 0x1d, 0x88, 0x2e,
+    0xc3, 0x9f, 0x0b, 0x06, 0x1c, 0x0b, 0xeb, 0x40, 0x9e, 0x66, 0x3a, 0xb0, 0x76, 0x5b, 0x8a, 0x1d,
+    0x10, 0xc0, 0x71, 0x47, 0x98, 0x46, 0x38, 0x6f, 0xa7, 0xca, 0xbc, 0x1a, 0x8f, 0x41, 0x3b, 0x38,
+    0x39, 0x52, 0xb7, 0x0f, 0xc8, 0x60, 0x5c, 0x1a, 0x6d, 0xc8, 0xe7, 0x23, 0x7d, 0x39, 0xde, 0x34,
+    0x0e, 0x34, 0x9e, 0xde, 0x57, 0x4b, 0x15, 0x13, 0xf8, 0xe3, 0xea, 0x70, 0xc6, 0x63, 0x08, 0xf2,
+    0x62, 0xed, 0x36, 0x89, 0xc9, 0xe5, 0xb1, 0xd6, 0xbc, 0x07, 0x95, 0xfc, 0x97, 0x79, 0xfe, 0x01,
+    0xdd, 0xd9, 0xc2, 0xe1, 0x18, 0x1f, 0x73, 0x8c, 0xf8, 0xa5, 0x95, 0xc0, 0x66, 0x9f, 0x53, 0xd0,
+    0x0a, 0x91, 0xf6, 0x3f, 0xc8, 0xd5, 0xf2, 0xa1, 0x1a, 0xeb, 0x3b, 0xbf, 0x65, 0x01, 0xae, 0x3b,
+    0x6e, 0x0a, 0x1e, 0x02, 0x06, 0x7f, 0x11, 0xea, 0x80, 0xed, 0x71, 0x3a, 0x38, 0x48, 0xf3, 0x8a,
+    0x57, 0x84, 0xd3, 0x61, 0x80, 0x91, 0x46, 0x60, 0xbf, 0x1f, 0x89, 0x98, 0xc3, 0x54, 0x89, 0x13,
+    0xe5, 0x31, 0x6a, 0xbf, 0x25, 0xa7, 0x9d, 0x07, 0x02, 0xad, 0x4a, 0xe2, 0x23, 0xf0, 0xd2, 0xf1,
+    0x44, 0xba, 0xbc, 0xac, 0x3c, 0xef, 0x1e, 0x97, 0x3c, 0x2d, 0x1e, 0x4b, 0xb2, 0xfa, 0x64, 0x6d,
+    0x20, 0x62, 0x2d, 0x1b, 0x89, 0xc9, 0x1d, 0x32, 0xd4, 0xbc, 0x1b, 0xc9, 0x0f, 0xb8, 0xd8, 0x85,
+    0x10, 0x19, 0xd3, 0x96, 0xa3, 0xe9, 0x9d, 0x7c, 0x4c, 0xbb, 0xa8, 0x95, 0x22, 0xe8, 0xdb, 0x52,
+    0xeb, 0xc6, 0x73, 0xc6, 0xfe, 0x21, 0xd2, 0x7a, 0xb0, 0xb8, 0xfa, 0xa3, 0xb8, 0x65, 0x27, 0xc4,
+    0x89, 0xee, 0x07, 0x90, 0x0b, 0x06, 0xee, 0xb9, 0x26, 0xe0, 0xf9, 0x06, 0x1d, 0xf4, 0xdd, 0x3c,
+    0x04, 0xbd, 0xa7, 0xe9, 0xc0, 0xd7, 0xb8, 0x2b, 0xc6, 0x6c, 0x4c, 0x87, 0x64, 0xc9, 0x23, 0x89,
+    0x04, 0xc7, 0x2b, 0xa9, 0xbf, 0x62, 0xa6, 0x4d, 0x96, 0xe4, 0x50, 0xe5, 0x3c, 0xa0, 0xe2, 0x0c,
+    0x7c, 0x64, 0x97, 0x20, 0x9e, 0x8c, 0x52, 0x97, 0xd5, 0x37, 0x33, 0xed, 0xc2, 0xf6, 0xf8, 0x64,
+    0xb8, 0x20, 0x61, 0x6d, 0x40, 0xfc, 0xb0, 0xe9, 0x5a, 0x2c, 0xb9, 0xe8, 0x57, 0x9a, 0xb7, 0x49,
+    0xdc, 0x01, 0xd5, 0x96, 0x10, 0xa2, 0x91, 0x26, 0x7c, 0xbc, 0x8d, 0xdd, 0x96, 0x3d, 0xd7, 0xc3,
+    0xf3, 0x55, 0xf0, 0x90, 0x2a, 0xf7, 0xc2, 0xd5, 0x7c, 0xb1, 0xcb, 0x9a, 0xe1, 0xa2, 0x65, 0x81,
+    0x9b, 0x88, 0x6e, 0x16, 0x48, 0x0b, 0x06, 0x4f, 0xe6, 0xe8, 0xe0, 0xef, 0x5b, 0x3a, 0x84, 0x7f,
+    0x56, 0x8a, 0x36, 0x39, 0x5e, 0x71, 0x47, 0xea, 0x37, 0x86, 0x06, 0xd2, 0x88, 0x66, 0x75, 0x54,
+    0xd1, 0x37, 0xe0, 0x31, 0xec, 0x5b, 0x25, 0xe7, 0x0f, 0xd7, 0x01, 0xe5, 0x1a, 0x49, 0xa3, 0x91,
+    0x7e, 0x7c, 0xa4, 0x73, 0xa7, 0x9b, 0xc4, 0xf2, 0xc2, 0x13, 0xb9, 0x64, 0xa9, 0x7a, 0x82, 0x6e,
+    0x5c, 0xbf, 0x76, 0x78, 0x0c, 0x0f, 0x2d, 0xac, 0xf9, 0x89, 0x2c, 0xb9, 0x86, 0x7f, 0x9a, 0x07,
+    0x03, 0x70, 0xff, 0x52, 0xd9, 0xc2, 0x21, 0xcf, 0x9a, 0x72, 0xc4, 0xc8, 0xa1, 0x95, 0xdb, 0xfa,
+    0x9d, 0x93, 0xf3, 0xdf, 0x90, 0x86, 0xb4, 0xc5, 0xd5, 0xe5, 0xaf, 0x19, 0x0b, 0xb8, 0xa1, 0x65,
+    0xd5, 0xb0, 0x3a, 0xee, 0xc2, 0xbc, 0x01, 0x06, 0x35, 0x8b, 0xea, 0xc0, 0x0c, 0x5b, 0x3a, 0xcc,
+    0xbb, 0xf7, 0x8a, 0x55, 0x0c, 0xd3, 0xd1, 0x00, 0x9c, 0x46, 0xae, 0xf6, 0xa5, 0x8a, 0x40, 0x69,
+    0x5e, 0x61, 0x75, 0xe3, 0x31, 0xb8, 0x86, 0x26, 0x47, 0xf1, 0xec, 0x01, 0xe1, 0x08, 0xe7, 0x23,
+    0x5c, 0x61, 0xf1, 0xf4, 0xc2, 0xc9, 0xac, 0x1e, 0xfa, 0x1e, 0x17, 0x29, 0x94, 0xed, 0x52, 0x2c,
+    0xc3, 0x63, 0xaa, 0xdb, 0x62, 0x0d, 0xba, 0x73, 0xc9, 0xe1, 0x63, 0xd7, 0x3c, 0x5b, 0x94, 0x0f,
+    0xd8, 0x6e, 0x88, 0x10, 0x2f, 0x2f, 0x98, 0xe3, 0xc6, 0xb2, 0x7c, 0xc4, 0x29, 0xa2, 0x95, 0x92,
+    0x49, 0xdb, 0xd2, 0x08, 0xec, 0x73, 0xa6, 0x85, 0x1e, 0xd2, 0x6a, 0x20, 0xb9, 0x6a, 0x94, 0xb3,
+    0x65, 0x6b, 0xdd, 0x89, 0x6e, 0x02, 0xb3, 0x0b, 0x06, 0xd2, 0x52, 0xea, 0x20, 0xed, 0x6d, 0x3a,
+    0x18, 0x6c, 0xf4, 0x8a, 0xb9, 0x7f, 0xd3, 0xd1, 0x4b, 0xfe, 0x48, 0xe8, 0xdc, 0xf4, 0x0a, 0x21,
+    0x14, 0x8f, 0xe1, 0x3b, 0x18, 0x33, 0x5d, 0x4e, 0x26, 0x07, 0xfd, 0xfc, 0x01, 0x51, 0xdd, 0xe3,
+    0x23, 0x09, 0xc2, 0xf1, 0xf4, 0x2c, 0xbd, 0xac, 0xa4, 0xc8, 0x6d, 0xd7, 0xa2, 0xc5, 0x27, 0x43,
+    0xac, 0x15, 0x6b, 0xd5, 0xf4, 0x4b, 0xae, 0x6b, 0x54, 0xce, 0xe1, 0x9e, 0xd5, 0xbc, 0xb2, 0xbd,
+    0x0f, 0x78, 0x7d, 0x86, 0x10, 0x41, 0x5e, 0xe5, 0xa3, 0x1d, 0xf2, 0xb6, 0x9c, 0x1b, 0x2c, 0x9e,
+    0xc0, 0x84, 0x88, 0x14, 0x08, 0xeb, 0x95, 0xca, 0x41, 0xc5, 0xd5, 0x87, 0xef, 0x2d, 0xab, 0xfb,
+    0x48, 0x74, 0x37, 0xac, 0x5d, 0xf0, 0xb6, 0x07, 0x46, 0x06, 0x5e, 0x8f, 0xc3, 0x20, 0x0d, 0x48,
+    0x1d, 0xf8, 0xf9, 0xae, 0x86, 0x79, 0x62, 0xe9, 0x00, 0x47, 0x6d, 0x29, 0xfa, 0x3a, 0xfe, 0x46,
+    0x7e, 0x6c, 0x1a, 0x09, 0xa6, 0x95, 0x2a, 0x6e, 0x62, 0x3c, 0x26, 0x62, 0xc8, 0xe4, 0xc0, 0x6d,
+    0xa1, 0x1f, 0x49, 0xa7, 0x07, 0xd4, 0x5a, 0x29, 0x8d, 0xda, 0x9d, 0x77, 0x13, 0x84, 0x56, 0xa9,
+    0x92, 0xfd, 0x7a, 0x5c, 0xfa, 0x26, 0x78, 0x8c, 0x75, 0x59, 0xac, 0x65, 0x73, 0x92, 0x38, 0xfe,
+    0xa7, 0x25, 0x17, 0x1f, 0xea, 0xf0, 0xa8, 0x6e, 0xf0, 0x1f, 0x5b, 0x52, 0x38, 0x5c, 0x9a, 0x5e,
+    0x8e, 0x0a, 0x28, 0xb4, 0x52, 0xff, 0xe5, 0x73, 0x16, 0xbc, 0x1d, 0xd2, 0xd9, 0x80, 0xa5, 0x4a,
+    0x7e, 0x44, 0x63, 0x91, 0xf7, 0xb5, 0x2c, 0x05, 0x6e, 0xc7, 0x05, 0xff, 0xf5, 0xe8, 0x40, 0x84,
+    0x65, 0x3a, 0x70, 0x71, 0xf1, 0x0a, 0x72, 0xfd, 0xd2, 0x41, 0xb5, 0x91, 0x46, 0x34, 0xdc, 0x1f,
+    0x09, 0xbf, 0x72, 0x54, 0x11, 0x8c, 0xe3, 0x31, 0x8d, 0x10, 0x25, 0x27, 0x5f, 0xec, 0x01, 0x31,
+    0x8e, 0xe2, 0x23, 0xd0, 0x05, 0xf1, 0xf4, 0x6b, 0x59, 0xaa, 0x6c, 0x8c, 0x98, 0x55, 0xe5, 0x72,
+    0xe3, 0x4a, 0x9c, 0xa6, 0x5d, 0xb7, 0xd7, 0x78, 0x6c, 0xa1, 0x25, 0xac, 0x71, 0xc8, 0x2e, 0xb9,
+    0xc8, 0x61, 0x9a, 0x27, 0x55, 0xe6, 0x01, 0xaf, 0x9a, 0x10, 0xa2, 0x6a, 0x9b, 0x72, 0xe4, 0xc9,
+    0x8a, 0x8f, 0xf5, 0x90, 0xb4, 0xd2, 0xb5, 0xbc, 0x73, 0xfa, 0x45, 0x1d, 0x52, 0xaa, 0xbb, 0xb8,
+    0x9a, 0x18, 0xa2, 0x65, 0x09, 0xc1, 0x89, 0x6e, 0x2d, 0xa8, 0x01, 0x06, 0x43, 0x5d, 0xc3, 0xa0,
+    0xa6, 0x9d, 0x35, 0x34, 0x0f, 0x58, 0x0a, 0x1b, 0x44, 0xc0, 0xe1, 0x5d, 0x8e, 0x46, 0x62, 0xc1,
+    0xa7, 0x8a, 0x10, 0x0c, 0x8f, 0xd9, 0x91, 0xfd, 0x37, 0x33, 0xd2, 0x26, 0x87, 0x7a, 0x20, 0xfd,
+    0x64, 0xf4, 0x3e, 0xa0, 0xad, 0x36, 0x69, 0x04, 0xfb, 0xc7, 0x9b, 0x7a, 0xf8, 0x4a, 0x15, 0x01,
+    0xe9, 0xe3, 0x02, 0x42, 0xc7, 0x63, 0x36, 0x6d, 0x62, 0x8d, 0x66, 0xb5, 0xc4, 0xdd, 0xf0, 0x31,
+    0x39, 0xd8, 0x1f, 0x87, 0x07, 0xd8, 0x8f, 0xff, 0x8a, 0x16, 0xc3, 0xa1, 0x7f, 0xfa, 0x72, 0x6c,
+    0x09, 0xa9, 0x95, 0xef, 0x90, 0x9e, 0xf3, 0x99, 0x42, 0x8c, 0x56, 0x0d, 0x23, 0x52, 0x96, 0x29,
+    0xa5, 0x6a, 0xc1, 0x15, 0x57, 0xa9, 0xa2, 0x6a, 0xac, 0xbe, 0x6d, 0xc7, 0x05, 0x3b, 0x23, 0xe9,
+    0xa0, 0xca, 0x56, 0x3a, 0xbc, 0xa1, 0xf2, 0x0a, 0xe9, 0x66, 0xbf, 0xb1, 0x18, 0x5b, 0x3a, 0x8a,
+    0xb9, 0xd1, 0x48, 0x0e, 0xf8, 0x23, 0x11, 0x53, 0x92, 0x2a, 0xeb, 0x99, 0x3b, 0xa6, 0x9d, 0xbb,
+    0xe4, 0x7c, 0xb4, 0x39, 0xa0, 0xdc, 0xa1, 0x7c, 0x04, 0x1e, 0x1a, 0x9e, 0x8c, 0x15, 0x4a, 0x15,
+    0xd3, 0xa4, 0xe3, 0xb2, 0x88, 0xbd, 0x63, 0xdc, 0x2c, 0x62, 0x8d, 0xe0, 0x52, 0xc9, 0xf5, 0x03,
+    0xd6, 0x3c, 0x3c, 0xf2, 0x0e, 0xc8, 0x26, 0x15, 0x0e, 0x7d, 0xdc, 0x10, 0xa2, 0xa3, 0xac, 0x72,
+    0xbc, 0x8a, 0x8b, 0x8f, 0x4d, 0x12, 0xb4, 0xd2, 0x17, 0xc5, 0x73, 0x3e, 0xa4, 0x1c, 0xd2, 0xa5,
+    0xa2, 0xb8, 0x0a, 0xac, 0xa9, 0x65, 0x7d, 0x12, 0x88, 0xee, 0x90, 0xd8, 0x01, 0x06, 0x31, 0xac,
+    0xc1, 0xa0, 0x66, 0x13, 0x1d, 0x4c, 0xff, 0xb1, 0x06, 0xb7, 0x7e, 0x4a, 0xf1, 0x77, 0xf6, 0x37,
+    0xd6, 0x2b, 0xd1, 0x48, 0x65, 0x83, 0x54, 0xc1, 0x42, 0xac, 0x30, 0xdb, 0x36, 0x3c, 0xe6, 0x6c,
+    0xba, 0xdf, 0xe0, 0x71, 0x93, 0x1c, 0xf5, 0x5f, 0xf4, 0x63, 0x9c, 0x13, 0x8d, 0x9a, 0x28, 0x77,
+    0x93, 0x7a, 0x33, 0xa9, 0x1a, 0x72, 0x72, 0x5c, 0x44, 0x4e, 0x78, 0x8c, 0xb1, 0x4e, 0xa7, 0x6d,
+    0x45, 0x85, 0x35, 0x79, 0x39, 0x12, 0xf7, 0xe6, 0xb7, 0xe4, 0x06, 0xee, 0x1b, 0x1e, 0x17, 0xcb,
+    0xfd, 0xc3, 0x54, 0x0c, 0x87, 0xf4, 0x02, 0xca, 0xf1, 0xd7, 0x9d, 0x56, 0x8a, 0xf4, 0x74, 0xce,
+    0x4e, 0x58, 0x30, 0x7a, 0x15, 0xa3, 0x54, 0x17, 0xae, 0x66, 0xec, 0x37, 0x72, 0xc7, 0x05, 0x4e,
+    0xd6, 0xea, 0xa0, 0x1c, 0x6a, 0x3a, 0xfc, 0x9b, 0x5a, 0x0a, 0x9c, 0xdf, 0x5e, 0xb1, 0x9c, 0x01,
+    0x38, 0x6e, 0xbb, 0x4d, 0x47, 0x04, 0x5b, 0x1a, 0xf9, 0x51, 0x9c, 0x2a, 0xad, 0x8a, 0x3c, 0xa6,
+    0xd7, 0xd3, 0xe4, 0x50, 0x08, 0x40, 0x20, 0xe1, 0xae, 0x7c, 0x14, 0xeb, 0xcc, 0x9b, 0xd8, 0x34,
+    0xc7, 0x93, 0xa5, 0x4c, 0xa9, 0x52, 0x11, 0x61, 0x56, 0x04, 0x1a, 0x90, 0x4b, 0x19, 0x11, 0x8f,
+    0xb1, 0xf5, 0x8b, 0xb5, 0x9c, 0x11, 0x26, 0x17, 0x34, 0x5a, 0xf3, 0xea, 0x25, 0xf2, 0x9f, 0x96,
+    0xf0, 0x07, 0x64, 0x70, 0x0b, 0x87, 0x6c, 0x76, 0x08, 0x31, 0xb3, 0x88, 0x39, 0x56, 0x5a, 0xd3,
+    0x4a, 0x88, 0x8b, 0xcf, 0xe9, 0x99, 0x86, 0x48, 0x0d, 0xa9, 0xe3, 0x6a, 0x4a, 0xf9, 0x96, 0x05,
+    0xfa, 0xd3, 0x26, 0xc0, 0xe3, 0x3d, 0x1d, 0xe8, 0x0a, 0x44, 0x04, 0xf7, 0xc2, 0xe9, 0x00, 0x56,
+    0xca, 0x2b, 0x80, 0x35, 0x4e, 0x47, 0xbb, 0xdf, 0x23, 0xa9, 0xe3, 0xd3, 0x2b, 0xe6, 0xbd, 0x62,
+    0xa6, 0x55, 0xc7, 0xe4, 0x74, 0xcc, 0x3e, 0x20, 0xa7, 0x26, 0x1b, 0xb4, 0x24, 0x8e, 0x8f, 0x88,
+    0x90, 0xc6, 0xd3, 0x4a, 0xf4, 0xb2, 0x72, 0x8c, 0xb4, 0x5d, 0xb2, 0x25, 0x9f, 0x8c, 0x1e, 0x4c,
+    0xac, 0x21, 0xd7, 0x25, 0xb6, 0xd1, 0xf4, 0x25, 0x17, 0x29, 0x2b, 0xe7, 0xfe, 0x56, 0x6a, 0x5e,
+    0x14, 0xd5, 0x07, 0x9c, 0x8f, 0x42, 0x88, 0x0d, 0x61, 0xf2, 0x11, 0xe5, 0x79, 0x5b, 0x66, 0x6c,
+    0x14, 0xcf, 0x6f, 0x50, 0x44, 0x6a, 0x96, 0xf6, 0x4a, 0x27, 0xe1, 0xe1, 0x6a, 0x4f, 0xf8, 0x65,
+    0x05, 0xb6, 0x62, 0xe8, 0xa0, 0xf1, 0x5b, 0x3a, 0xdc, 0xfa, 0xef, 0x8a, 0xda, 0xc2, 0xd2, 0x91,
+    0xb6, 0xf9, 0x48, 0xba, 0xae, 0xa2, 0x8a, 0x81, 0x17, 0x5e, 0xb1, 0xb6, 0xe0, 0x31, 0x75, 0xc2,
+    0x24, 0xe7, 0xa8, 0xdc, 0x01, 0xc9, 0x51, 0xe1, 0xa3, 0x4e, 0xd3, 0xf0, 0x34, 0xb4, 0xbc, 0xac,
+    0x14, 0xda, 0x1b, 0xd7, 0x58, 0x2e, 0xed, 0xea, 0x85, 0xbe, 0x63, 0x83, 0xec, 0x9e, 0xac, 0xf3,
+    0x2e, 0xac, 0x3d, 0x10, 0x2a, 0xb9, 0xa1, 0x86, 0x9a, 0xc7, 0x0c, 0xd6, 0x01, 0x01, 0xd9, 0x10,
+    0xe2, 0x17, 0x29, 0x7c, 0x14, 0x41, 0xa1, 0x95, 0x20, 0x66, 0xdb, 0x12, 0x2d, 0xb3, 0x73, 0xd2,
+    0xd5, 0x10, 0x4f, 0xc9, 0x68, 0x43, 0x5a, 0xb2, 0x12, 0x57, 0x13, 0x8b, 0xb3, 0x2c, 0xa1, 0x1b,
+    0xd1, 0x05, 0x39, 0x30, 0xea, 0x60, 0x00, 0x98, 0x35, 0xf0, 0x34, 0x4e, 0x87, 0x22, 0xf7, 0x4a,
+    0x01, 0x4c, 0x02, 0x38, 0xf4, 0x38, 0xd2, 0xc8, 0x80, 0xca, 0x54, 0x41, 0xf7, 0xe4, 0x31, 0x9e,
+    0xdf, 0x25, 0xa7, 0xc5, 0x2e, 0xfd, 0xbc, 0xec, 0x40, 0xa0, 0x95, 0xda, 0x68, 0xf4, 0x76, 0x8a,
+    0x8f, 0x76, 0x75, 0x79, 0x93, 0x01, 0x45, 0xa9, 0xda, 0xb7, 0x7c, 0x5c, 0xa6, 0xb0, 0x78, 0x6c,
+    0xc5, 0x47, 0xac, 0xd1, 0x2a, 0x31, 0x39, 0xe4, 0x0b, 0x87, 0x87, 0xbb, 0x51, 0xf3, 0xe0, 0x7a,
+    0xf1, 0x5f, 0x5d, 0x61, 0x38, 0xec, 0x47, 0x5c, 0x8e, 0x5a, 0x16, 0xb5, 0xd2, 0xc5, 0xc9, 0x73,
+    0xfa, 0x22, 0x22, 0x52, 0x85, 0x51, 0xa5, 0x7a, 0x84, 0x16, 0x57, 0xb5, 0xfe, 0x68, 0x6c, 0xbd,
+    0xe8, 0x96, 0x05, 0xdd, 0xfd, 0xe8, 0x60, 0xcc, 0x72, 0x3a, 0xd0, 0x76, 0xef, 0x8a, 0x87, 0x79,
+    0xd3, 0xe1, 0x51, 0xf2, 0x48, 0x32, 0x5b, 0xa5, 0x0a, 0x43, 0x7a, 0x5e, 0x39, 0xc4, 0xe0, 0x31,
+    0x77, 0xb7, 0x62, 0x86, 0x2d, 0xab, 0xe4, 0x58, 0x9a, 0x3e, 0x20, 0x91, 0x29, 0x7c, 0x94, 0x37,
+    0x2e, 0x9e, 0x98, 0x5e, 0x97, 0x95, 0x90, 0x6f, 0xed, 0x82, 0x60, 0xc3, 0x63, 0x06, 0x3d, 0x9f,
+    0x2c, 0x84, 0x30, 0xac, 0x2d, 0x2c, 0x2f, 0xb9, 0x22, 0x5d, 0x9a, 0xb7, 0x8c, 0xec, 0x01, 0xab,
+    0x83, 0x10, 0x62, 0x9e, 0x5e, 0x7c, 0x6c, 0xef, 0xa8, 0x95, 0x6f, 0xdf, 0xdb, 0xf2, 0xfd, 0xa9,
+    0x73, 0xda, 0x10, 0x11, 0x4f, 0x82, 0x2f, 0x44, 0xaa, 0x2a, 0x0b, 0x57, 0xeb, 0x6f, 0xb6, 0x6c,
+    0xe9, 0x13, 0xd1, 0x05, 0xf6, 0x04, 0xea, 0xc0, 0x69, 0x7c, 0x35, 0x10, 0x8e, 0x4b, 0x07, 0xbc,
+    0x36, 0x4b, 0x21, 0x40, 0xf5, 0x37, 0xc0, 0x6b, 0xd2, 0x08, 0x09, 0xb9, 0x54, 0x19, 0xfb, 0xdf,
+    0x31, 0xef, 0x51, 0x26, 0x87, 0x4d, 0x0c, 0xfd, 0x34, 0x84, 0x3c, 0xa0, 0x23, 0x1d, 0x69, 0x34,
+    0x56, 0x96, 0x8f, 0x52, 0xeb, 0x77, 0x13, 0x1b, 0x3a, 0xa9, 0xda, 0x64, 0x7c, 0x5c, 0x99, 0xcb,
+    0x77, 0x2c, 0xcd, 0x5c, 0xac, 0x29, 0x5b, 0x2c, 0x39, 0x5b, 0x50, 0x87, 0x07, 0x90, 0x5d, 0xf3,
+    0x68, 0x0e, 0xf0, 0x1f, 0x69, 0xaa, 0x07, 0xcc, 0x7b, 0x0a, 0x87, 0x0d, 0x91, 0xcb, 0xf1, 0xe3,
+    0x89, 0x56, 0x66, 0x1c, 0x7b, 0x4e, 0xcc, 0xd7, 0x43, 0x1a, 0xd4, 0x19, 0x57, 0x51, 0xd4, 0x68,
+    0x2c, 0x7d, 0xcf, 0x96, 0x05, 0x9a, 0x59, 0xea, 0x40, 0xab, 0x67, 0x3a, 0x58, 0x41, 0xf5, 0x8a,
+    0xe2, 0x64, 0xd3, 0x41, 0xe8, 0xff, 0x48, 0xdc, 0x54, 0xa7, 0x0a, 0x26, 0x9a, 0x5e, 0xd1, 0x9e,
+    0xde, 0x31, 0x5e, 0xca, 0x62, 0xa6, 0x0d, 0xdd, 0xe4, 0x24, 0xe6, 0x3c, 0x20, 0x42, 0xdf, 0x7c,
+    0x54, 0x66, 0x2d, 0x9e, 0x62, 0xd3, 0x98, 0xd5, 0x3e, 0x9a, 0xed, 0xfa, 0xc0, 0xc2, 0x63, 0xaa,
+    0x53, 0x9f, 0x6c, 0xcc, 0x58, 0xac, 0xa1, 0x2e, 0x2f, 0xb9, 0xe7, 0xc5, 0x9a, 0x27, 0xb5, 0xf5,
+    0x01, 0x4d, 0xb2, 0x10, 0xa2, 0x3d, 0xb1, 0x7c, 0xfc, 0x49, 0xa6, 0x95, 0x0e, 0x82, 0xdb, 0xf2,
+    0x3d, 0xba, 0x78, 0x2e, 0x81, 0x21, 0x52, 0x3a, 0xa6, 0xb8, 0x5a, 0x79, 0xbf, 0x65, 0x43, 0x65,
+    0x88, 0x6e, 0x90, 0xd3, 0x0b, 0x06, 0xaf, 0x87, 0xc3, 0xe0, 0x7c, 0x57, 0x1d, 0x14, 0xb1, 0xb3,
+    0x86, 0x8d, 0xc9, 0xe9, 0x40, 0xa5, 0x63, 0x29, 0xe4, 0xe2, 0x00, 0x07, 0x18, 0x50, 0x1a, 0x81,
+    0x02, 0x9d, 0x2a, 0x7a, 0xa5, 0x3c, 0x66, 0x30, 0xce, 0xe4, 0x7c, 0x7b, 0xa5, 0x1f, 0x5d, 0x1a,
+    0x08, 0xc4, 0x53, 0x24, 0x8d, 0x24, 0x66, 0x79, 0x53, 0x77, 0x62, 0xa9, 0xa2, 0x19, 0x7d, 0x5c,
+    0xb5, 0x1a, 0x79, 0x6c, 0xc7, 0x49, 0xac, 0xa1, 0xfb, 0x97, 0xb8, 0x08, 0x5d, 0x26, 0x87, 0x3e,
+    0xe2, 0xf0, 0x74, 0x39, 0x6a, 0x1e, 0x43, 0x4e, 0xfe, 0xcb, 0x63, 0x0c, 0x87, 0x90, 0x0c, 0xcc,
+    0x51, 0x14, 0xa5, 0x56, 0x36, 0xea, 0x7a, 0xce, 0x69, 0x5b, 0x44, 0x5a, 0x59, 0xab, 0x54, 0xf3,
+    0x56, 0xe3, 0xaa, 0xdc, 0x41, 0x8d, 0x05, 0xeb, 0x32, 0xc2, 0x00, 0x12, 0x7a, 0x35, 0xc0, 0x08,
+    0x57, 0x0a, 0x12, 0x51, 0xbf, 0xe1, 0x7f, 0x92, 0x46, 0xf6, 0xa3, 0xa3, 0x0a, 0xb1, 0x0b, 0x8f,
+    0x99, 0xc7, 0xf5, 0x37, 0xcd, 0xa1, 0xe7, 0xc7, 0xfd, 0x49, 0x1a, 0x1d, 0x2d, 0xea, 0xa6, 0xb6,
+    0xd1, 0x52, 0xb5, 0xcf, 0xdd, 0xb8, 0xc4, 0xbd, 0xa2, 0xd8, 0xb3, 0x23, 0x1e, 0xa3, 0x23, 0xd6,
+    0x69, 0x18, 0x70, 0x61, 0xad, 0xb5, 0x82, 0xc4, 0x71, 0x11, 0x39, 0x3c, 0x3d, 0x91, 0xfb, 0x57,
+    0xc1, 0x16, 0x0e, 0x7d, 0x18, 0x95, 0xa3, 0x20, 0x0e, 0xad, 0xd4, 0x2f, 0xba, 0x9b, 0xe1, 0x1c,
+    0x9e, 0xb3, 0x36, 0x02, 0x8c, 0xce, 0x54, 0x2a, 0x55, 0x8a, 0xae, 0x19, 0x7b, 0xf4, 0xd7, 0x71,
+    0x73, 0xe3, 0x0d, 0xb0, 0xf4, 0x09, 0x3c, 0x06, 0x9a, 0xb8, 0x26, 0x40, 0xf8, 0xe3, 0x21, 0xc0,
+    0xd9, 0x4c, 0x87, 0xdb, 0xc7, 0x5d, 0x81, 0x76, 0x60, 0x3a, 0x92, 0x55, 0x1e, 0x49, 0x28, 0x2e,
+    0x5e, 0x71, 0xa4, 0x15, 0x33, 0xff, 0xc0, 0x24, 0x67, 0x13, 0x76, 0xe9, 0x6c, 0xdf, 0x3b, 0x20,
+    0xf4, 0xf7, 0x1a, 0xf4, 0xb8, 0x83, 0x8f, 0x1e, 0x6f, 0xc3, 0x93, 0xaa, 0xf2, 0xb2, 0x1a, 0x6a,
+    0xa4, 0x5d, 0xcd, 0x2c, 0x9f, 0x0c, 0x73, 0xf8, 0xb0, 0xc5, 0xb7, 0xc8, 0xb9, 0xf7, 0x58, 0x9a,
+    0xe7, 0xaf, 0xd9, 0x01, 0x73, 0x90, 0x10, 0xa2, 0x02, 0x22, 0x7c, 0xec, 0xbd, 0xdc, 0x96, 0xa9,
+    0xdc, 0xc3, 0xb3, 0x92, 0xea, 0x90, 0xc2, 0xfe, 0xb9, 0xd2, 0x3e, 0x5f, 0xb8, 0xca, 0xf7, 0x76,
+    0x59, 0x5b, 0x20, 0xb4, 0x2c, 0x37, 0x0e, 0xd1, 0x05, 0x4e, 0x34, 0xea, 0x00, 0xd5, 0x6d, 0x3a,
+    0xa4, 0xf0, 0xf3, 0x0a, 0xbd, 0x14, 0xc0, 0x61, 0x08, 0x70, 0x3a, 0xba, 0xb4, 0xd1, 0x88, 0xd2,
+    0xf0, 0x23, 0xa9, 0x9e, 0x9b, 0x2a, 0x61, 0x2c, 0x3c, 0x46, 0xfe, 0xca, 0xe4, 0x98, 0x11, 0x3f,
+    0x20, 0x6b, 0x7f, 0x7c, 0x64, 0xd0, 0xca, 0x9b, 0x5e, 0xc7, 0xc6, 0xd3, 0xbc, 0xf4, 0xb2, 0xd2,
+    0xfa, 0x7e, 0x5c, 0x50, 0x43, 0x78, 0xac, 0xbd, 0x55, 0xac, 0x5d, 0x74, 0x2f, 0xb9, 0x82, 0xb1,
+    0x9a, 0x57, 0x1a, 0xf6, 0x01, 0xbf, 0xf3, 0xc2, 0x21, 0xa0, 0x18, 0x42, 0x34, 0xb5, 0x5c, 0x8e,
+    0x66, 0x95, 0xf2, 0xd1, 0x05, 0x9f, 0x56, 0x96, 0x4e, 0x79, 0xce, 0xc0, 0x43, 0x44, 0x4a, 0xd9,
+    0x12, 0x57, 0x35, 0xcc, 0xb7, 0x6c, 0x88, 0x1a, 0xd1, 0x05, 0x2c, 0x7c, 0xc2, 0x60, 0xd2, 0x22,
+    0x1d, 0x5c, 0xa2, 0xad, 0x06, 0xbf, 0x08, 0x4b, 0xe1, 0x93, 0xe5, 0x37, 0xc2, 0xb9, 0xd2, 0x48,
+    0x31, 0x6c, 0x54, 0xf1, 0x09, 0xe2, 0x31, 0x66, 0x8c, 0xfe, 0x06, 0x60, 0xa8, 0xe4, 0x54, 0x6e,
+    0x9f, 0x9f, 0x8d, 0x00, 0x69, 0x44, 0x6f, 0xaf, 0x9b, 0x74, 0x32, 0x4a, 0xd5, 0xb7, 0x9a, 0xe3,
+    0x32, 0xe3, 0xbe, 0x63, 0xeb, 0x27, 0x3b, 0x2d, 0xc8, 0x3f, 0xac, 0x41, 0xfa, 0x8e, 0xb8, 0xd6,
+    0x52, 0x25, 0x47, 0xe0, 0xe6, 0xf0, 0xa8, 0x2c, 0xee, 0x5f, 0x3e, 0x53, 0x38, 0x6c, 0x8b, 0x55,
+    0x8e, 0x8c, 0xf2, 0xb3, 0xf2, 0xff, 0xc9, 0x73, 0xd2, 0x28, 0x1b, 0xd2, 0x56, 0x64, 0xa5, 0x6a,
+    0xad, 0x33, 0x63, 0xf5, 0x29, 0x3b, 0x2e, 0xcc, 0xb4, 0x01, 0x06, 0xbc, 0x04, 0xea, 0x00, 0xbf,
+    0x84, 0x35, 0x5c, 0x1d, 0x4c, 0x07, 0x6e, 0x15, 0x4b, 0x21, 0x0a, 0xd3, 0x2b, 0x22, 0x50, 0xff,
+    0x46, 0x50, 0x39, 0x1a, 0x69, 0xbd, 0x99, 0x2a, 0x1e, 0xc3, 0x3b, 0x06, 0x61, 0xd2, 0xe4, 0x94,
+    0x16, 0x3c, 0xa0, 0x08, 0xc5, 0x7c, 0xa4, 0xe1, 0xbf, 0x9b, 0x90, 0x2e, 0xc5, 0x53, 0x21, 0x3c,
+    0xa9, 0xfa, 0x8c, 0x7c, 0x5c, 0x08, 0xe5, 0x77, 0x4c, 0x09, 0x5b, 0xac, 0xd5, 0xfd, 0x2c, 0x39,
+    0x7d, 0xdc, 0x9a, 0xf7, 0x49, 0x81, 0xff, 0x0e, 0xa2, 0x3d, 0x60, 0x84, 0x57, 0x38, 0x14, 0x18,
+    0x5c, 0x8e, 0x13, 0x81, 0xb4, 0x12, 0x68, 0xd2, 0x73, 0x4e, 0xe8, 0x1f, 0xd2, 0xfc, 0xa8, 0xb8,
+    0xea, 0xa1, 0x4b, 0x63, 0xef, 0x1d, 0xb7, 0x2c, 0xf4, 0x4d, 0xc7, 0x05, 0xd3, 0xdd, 0xc3, 0xe0,
+    0xe7, 0x8e, 0x35, 0xc0, 0xe0, 0x5a, 0x8a, 0x3a, 0x0a, 0xc0, 0x31, 0xd4, 0x95, 0x46, 0x08, 0x63,
+    0xa7, 0x8a, 0x3b, 0x0e, 0x8f, 0x99, 0x2d, 0x01, 0x38, 0xbc, 0xaa, 0xe8, 0x67, 0x01, 0x5e, 0x1a,
+    0xe9, 0x04, 0xf1, 0x26, 0xa7, 0xd6, 0x52, 0x35, 0xb7, 0xfb, 0xb8, 0x48, 0xc5, 0xa3, 0xd8, 0x14,
+    0x2f, 0x1e, 0xab, 0x90, 0xde, 0x69, 0x81, 0xdf, 0x62, 0x4d, 0x1c, 0xad, 0xc4, 0x21, 0x29, 0x3a,
+    0x3c, 0x71, 0x7c, 0xfc, 0x47, 0xc2, 0x16, 0x0e, 0xb3, 0xa2, 0x98, 0xe3, 0xf3, 0x2c, 0xad, 0x8c,
+    0x1f, 0xfa, 0x9c, 0x49, 0xaf, 0x61, 0xb4, 0x02, 0x09, 0x91, 0x82, 0xa6, 0x2a, 0xd5, 0x46, 0xa0,
+    0x1a, 0x5b, 0x24, 0xda, 0x71, 0xcd, 0x04, 0x11, 0xf0, 0xd7, 0x3f, 0x3c, 0x06, 0x1a, 0x6f, 0xc2,
+    0x00, 0x27, 0x26, 0x1d, 0xc8, 0xbc, 0xae, 0x06, 0xa6, 0xeb, 0x4a, 0xb1, 0x9e, 0xed, 0x37, 0xb8,
+    0xbf, 0xd1, 0x08, 0x05, 0x96, 0x54, 0x89, 0xd2, 0xdc, 0x31, 0x22, 0x1c, 0xff, 0xc6, 0xd8, 0xbd,
+    0xe4, 0x90, 0x09, 0x9e, 0x9f, 0x2a, 0x34, 0x07, 0x64, 0x9e, 0x25, 0x8d, 0xa4, 0xc9, 0x75, 0x13,
+    0x02, 0x4c, 0xa9, 0x72, 0x1e, 0x74, 0x5c, 0x5b, 0xd5, 0x77, 0x0c, 0xe1, 0x43, 0xac, 0x01, 0xd5,
+    0x2a, 0x39, 0xeb, 0x46, 0x87, 0x67, 0x8c, 0x72, 0xff, 0xc2, 0xab, 0xc2, 0xe1, 0x60, 0xaf, 0x72,
+    0xbc, 0xbe, 0xa0, 0x95, 0x6d, 0x32, 0x9e, 0x73, 0x90, 0x0b, 0x8c, 0xd2, 0xba, 0x1c, 0x52, 0x6e,
+    0xa7, 0xb8, 0xaa, 0x6e, 0x3e, 0x63, 0x03, 0xdf, 0x39, 0xae, 0xcf, 0xdd, 0x01, 0x06, 0x30, 0xf7,
+    0xea, 0x00, 0x92, 0x69, 0x3a, 0x64, 0x97, 0xf7, 0x0a, 0xa3, 0x24, 0xc0, 0x81, 0x2a, 0x6e, 0x3a,
+    0xbe, 0x99, 0xd2, 0x08, 0xe7, 0xf5, 0x54, 0x19, 0x52, 0xe2, 0x31, 0xb7, 0x13, 0x27, 0x07, 0x49,
+    0xf5, 0x01, 0x3d, 0xb4, 0xe7, 0xa3, 0x54, 0x9d, 0xf1, 0xb4, 0x6c, 0x5a, 0xaa, 0xc8, 0xa9, 0x1f,
+    0xd7, 0x56, 0x36, 0x1e, 0xcb, 0xab, 0x16, 0x6b, 0x8e, 0x5c, 0x4c, 0xee, 0x86, 0xb1, 0xe6, 0x4d,
+    0x92, 0xe4, 0x3f, 0x46, 0xfa, 0x0f, 0x88, 0x65, 0x17, 0x0e, 0x9b, 0xb9, 0x10, 0x62, 0xa3, 0x17,
+    0x73, 0x24, 0xea, 0xa6, 0x95, 0xd7, 0x30, 0x9f, 0x13, 0xab, 0x0f, 0x91, 0xa2, 0x5c, 0xc7, 0x55,
+    0xe3, 0x0a, 0x2e, 0x9b, 0xbf, 0x4b, 0x74, 0xc3, 0xfb, 0x10, 0xf0, 0x8f, 0x4c, 0x3c, 0x06, 0x7b,
+    0x81, 0xe9, 0x60, 0xd3, 0x58, 0x3a, 0xf8, 0xc3, 0xf3, 0x0a, 0x5b, 0x8d, 0xbf, 0x31, 0x55, 0x5e,
+    0x3a, 0xec, 0x0b, 0x20, 0xc9, 0x46, 0xaa, 0x54, 0xf1, 0xe4, 0xdc, 0x31, 0x21, 0x3a, 0x26, 0x27,
+    0xc4, 0xd0, 0x01, 0x3d, 0x32, 0xe6, 0xa3, 0x90, 0xeb, 0xf0, 0x04, 0x76, 0xc7, 0xac, 0x68, 0xa7,
+    0x1d, 0x17, 0xa8, 0x5b, 0xed, 0xb2, 0x0b, 0xbf, 0x63, 0xf3, 0x5e, 0x62, 0xad, 0x71, 0x5c, 0xc9,
+    0xd9, 0x54, 0xd6, 0x3c, 0x6a, 0x23, 0x0f, 0x88, 0xa7, 0x86, 0x10, 0x8f, 0xad, 0xe3, 0x63, 0x89,
+    0x0b, 0xad, 0x34, 0x2e, 0xf3, 0x9c, 0x43, 0x68, 0x87, 0x94, 0xda, 0x2b, 0xae, 0x9a, 0xc2, 0x6b,
+    0xd9, 0xd3, 0x08, 0xa2, 0x1b, 0xd1, 0x7b, 0x80, 0x03, 0x14, 0x5d, 0xb0, 0x2d, 0xb9, 0x45, 0x06,
+    0x7e, 0x74, 0xe8, 0x40, 0xe3, 0x59, 0x3a, 0x7c, 0x55, 0xf0, 0x8a, 0x6d, 0xbb, 0xd2, 0xb1, 0xab,
+    0xfa, 0x48, 0x86, 0xc2, 0xf0, 0xca, 0xac, 0x02, 0x8f, 0xa1, 0xb4, 0x17, 0x33, 0x19, 0xdb, 0x24,
+    0x47, 0xd7, 0xd9, 0x01, 0x49, 0xb2, 0xe1, 0xa3, 0x1d, 0xcd, 0xf0, 0x24, 0x6e, 0xbd, 0xac, 0xac,
+    0x81, 0x69, 0x97, 0x12, 0xb9, 0x27, 0x73, 0x7c, 0x0c, 0x6b, 0x9a, 0x71, 0x4a, 0x0e, 0x15, 0xa4,
+    0xe6, 0x8d, 0x7b, 0x75, 0xc0, 0x0e, 0x38, 0x84, 0x18, 0x40, 0x0b, 0x1f, 0xcf, 0xae, 0xb6, 0xa5,
+    0xb9, 0x6b, 0xe7, 0x3c, 0x62, 0x22, 0x9e, 0xca, 0xc6, 0x86, 0xb4, 0xbc, 0x26, 0xae, 0x1a, 0x39,
+    0x67, 0x59, 0xf2, 0x32, 0xa2, 0xdb, 0x4c, 0xd3, 0x82, 0xc7, 0x6e, 0x2e, 0xf2, 0x1e, 0x31, 0x80,
+    0x06, 0x61, 0x43, 0xea, 0xc0, 0x35, 0x68, 0x3a, 0x90, 0xd4, 0xf4, 0x8a, 0x47, 0x67, 0xd3, 0x01,
+    0x4c, 0xfe, 0x48, 0x7c, 0x3e, 0xa7, 0xca, 0x43, 0x9a, 0x5e, 0x39, 0xd4, 0x15, 0x33, 0xdb, 0xd1,
+    0x26, 0x27, 0xf6, 0xe7, 0x01, 0xcd, 0x78, 0xe6, 0x23, 0x2c, 0x70, 0xf1, 0x44, 0x83, 0xc4, 0xac,
+    0x34, 0xe4, 0x6c, 0x17, 0x19, 0xce, 0x27, 0xb3, 0x44, 0x16, 0x6b, 0x51, 0xb7, 0x89, 0x4d, 0xeb,
+    0x76, 0xc9, 0x11, 0x2b, 0xd6, 0x3c, 0x9f, 0xa3, 0x0f, 0xb8, 0xb2, 0x85, 0x10, 0x39, 0x59, 0xe5,
+    0xe3, 0x4b, 0xe2, 0xb6, 0x74, 0x97, 0x2d, 0x9e, 0xb2, 0x62, 0x88, 0xb4, 0xe6, 0x26, 0xae, 0xf2,
+    0xcf, 0x6f, 0xd9, 0x0d, 0x14, 0xa2, 0x6b, 0x07, 0xf4, 0x82, 0x51, 0x01, 0x2f, 0xb2, 0x18, 0x89,
+    0x80, 0x06, 0xac, 0xa0, 0x26, 0x00, 0x26, 0x24, 0x1d, 0x88, 0x0a, 0x4e, 0x87, 0x37, 0x17, 0x5e,
+    0xa1, 0xbf, 0x6a, 0x3a, 0xe0, 0x30, 0x1f, 0x09, 0x5f, 0x5e, 0x5e, 0x71, 0x41, 0x19, 0x33, 0xde,
+    0x4f, 0x25, 0x27, 0x4a, 0xf4, 0x01, 0x3d, 0x64, 0xe2, 0xa3, 0x7f, 0x46, 0xf1, 0xb4, 0xa5, 0xc2,
+    0xac, 0x98, 0x73, 0x6a, 0x97, 0x67, 0xf1, 0x27, 0xd3, 0x90, 0x40, 0x6c, 0x1e, 0x2e, 0x4c, 0x0e,
+    0x09, 0x93, 0xe6, 0xb1, 0xdf, 0x7b, 0x40, 0x3c, 0x1c, 0x84, 0xb8, 0x4f, 0x1a, 0x1f, 0xdb, 0x8b,
+    0xb7, 0x65, 0xdb, 0x26, 0xf1, 0x1c, 0x90, 0x40, 0xa4, 0x3b, 0x04, 0xaf, 0x34, 0x0b, 0x24, 0xae,
+    0xea, 0x48, 0x6b, 0x59, 0x6e, 0x57, 0xa2, 0x4b, 0x7f, 0xda, 0x82, 0x73, 0x1e, 0x30, 0xf2, 0x51,
+    0x37, 0x80, 0x06, 0x29, 0xb1, 0xc2, 0x20, 0x87, 0x6f, 0x35, 0xac, 0x08, 0x59, 0x0a, 0x7e, 0x38,
+    0xbf, 0xc1, 0xb3, 0x98, 0x46, 0x84, 0x99, 0xa3, 0x0a, 0x11, 0x1b, 0x8f, 0x91, 0x04, 0xf6, 0x37,
+    0x4c, 0x65, 0x25, 0xa7, 0x43, 0xfd, 0xfc, 0xa8, 0xf8, 0x48, 0x23, 0xc6, 0x7e, 0xdd, 0x04, 0x07,
+    0x56, 0xaa, 0xac, 0xd6, 0x1c, 0xd7, 0x9a, 0x0a, 0x1e, 0x2b, 0xd9, 0x0f, 0x6b, 0x4a, 0x09, 0x24,
+    0x6e, 0x60, 0x5e, 0xc9, 0x8d, 0xb1, 0x39, 0x3c, 0xb0, 0xac, 0xfb, 0xa7, 0x04, 0x15, 0x0e, 0x75,
+    0xdd, 0x95, 0x63, 0xb4, 0xfe, 0xac, 0x34, 0x52, 0xf4, 0x9c, 0x09, 0xd6, 0x86, 0xf4, 0x43, 0x5e,
+    0xa9, 0x92, 0x71, 0xcd, 0xd8, 0xd7, 0xdc, 0x8e, 0xab, 0xba, 0x6f, 0x80, 0xff, 0xd3, 0xe0, 0x31,
+    0x1f, 0xa1, 0x76, 0x06, 0xb6, 0x5d, 0xc3, 0x20, 0x8b, 0x4a, 0x1d, 0xc4, 0x30, 0xb2, 0x06, 0x0e,
+    0x0e, 0x4b, 0xc1, 0x9d, 0x01, 0x38, 0x36, 0xed, 0xd1, 0x08, 0x68, 0xdd, 0x54, 0xa9, 0x98, 0xe1,
+    0x31, 0x01, 0x6f, 0x26, 0xc7, 0xd2, 0x23, 0xfd, 0xdc, 0x01, 0x3f, 0x20, 0x1d, 0xf2, 0x68, 0x94,
+    0xf5, 0xca, 0x9b, 0xa6, 0xb8, 0x49, 0x55, 0x37, 0xfd, 0xe3, 0xe2, 0xd8, 0xc1, 0x63, 0x9e, 0xd2,
+    0x62, 0xad, 0x3b, 0xa5, 0xc4, 0x5d, 0x4d, 0x2f, 0x39, 0xd8, 0x2c, 0x87, 0xd7, 0x23, 0x8a, 0xff,
+    0xdc, 0xe6, 0xc2, 0x61, 0x51, 0xef, 0x72, 0x8c, 0x2b, 0xa7, 0x95, 0x22, 0x83, 0x9e, 0x33, 0xb6,
+    0x0e, 0x91, 0xfa, 0xa5, 0x29, 0x55, 0x80, 0xa7, 0xb8, 0x2a, 0xf4, 0x4d, 0x63, 0xa1, 0x80, 0x3b,
+    0xee, 0x43, 0xef, 0x01, 0x06, 0x2a, 0x0c, 0xe9, 0x20, 0x6e, 0x73, 0x3a, 0x2c, 0xaa, 0xef, 0x8a,
+    0x0d, 0x01, 0xc0, 0x91, 0x0a, 0x87, 0x46, 0xf8, 0x8f, 0xa5, 0x8a, 0xa2, 0x03, 0x8f, 0xc1, 0xe1,
+    0x2b, 0x39, 0x5a, 0x92, 0x0f, 0x48, 0x15, 0x10, 0x1f, 0x61, 0x18, 0xef, 0xa6, 0xeb, 0x60, 0xf1,
+    0x24, 0x50, 0x51, 0xaa, 0x08, 0x06, 0x1d, 0x17, 0x6a, 0x28, 0x1e, 0xfb, 0x14, 0x0b, 0x6b, 0x2b,
+    0xf9, 0x4b, 0x2e, 0xb6, 0x94, 0xe6, 0x51, 0xb2, 0x7b, 0x40, 0x30, 0xcc, 0x70, 0x58, 0x6e, 0x83,
+    0x10, 0xc5, 0xb8, 0x94, 0x23, 0xfc, 0x49, 0xad, 0xdc, 0xc1, 0xea, 0x9c, 0xc2, 0x69, 0x88, 0x74,
+    0x32, 0x17, 0xae, 0x6a, 0x12, 0x6d, 0xd9, 0x7e, 0x28, 0xa2, 0xab, 0x61, 0x6d, 0x80, 0xf9, 0x28,
+    0xe2, 0x31, 0xaf, 0x7d, 0x76, 0x06, 0xa5, 0x44, 0xe9, 0xc0, 0x46, 0x58, 0x3a, 0xa4, 0x56, 0xf3,
+    0x0a, 0xae, 0x57, 0xbf, 0xa1, 0x14, 0x59, 0x3a, 0xe6, 0x70, 0xd2, 0x48, 0x20, 0x83, 0x54, 0x39,
+    0x84, 0xe0, 0x31, 0x8e, 0xa8, 0x25, 0xa7, 0xf6, 0xd6, 0x01, 0x89, 0x0e, 0xe5, 0xa3, 0xa5, 0xcc,
+    0xf0, 0x04, 0x84, 0x5a, 0xaa, 0x6c, 0x3e, 0x1c, 0xd7, 0x15, 0x1b, 0x1e, 0x7b, 0xda, 0x0d, 0x6b,
+    0xe3, 0x24, 0x4b, 0xce, 0x3f, 0xa7, 0xe6, 0xa5, 0xc2, 0x78, 0x40, 0xdf, 0x30, 0x84, 0x08, 0xe9,
+    0xac, 0x1c, 0x7f, 0x36, 0x68, 0xa5, 0xaa, 0x96, 0xe7, 0xfc, 0xfd, 0x37, 0xa4, 0x1b, 0xae, 0x71,
+    0xb5, 0x22, 0x49, 0xcb, 0x76, 0x70, 0x12, 0x5d, 0x0b, 0xa1, 0x03, 0x9c, 0xe0, 0xdd, 0x82, 0x1b,
+    0x0f, 0xe0, 0x71, 0x12, 0xb4, 0x76, 0x06, 0x9f, 0x06, 0xeb, 0x60, 0x78, 0x6c, 0x3a, 0xec, 0x79,
+    0xf7, 0x0a, 0x2c, 0x7d, 0xd3, 0x51, 0xac, 0x97, 0x46, 0x2c, 0x64, 0xa7, 0xca, 0xa8, 0x28, 0x8f,
+    0x49, 0xf0, 0x35, 0x39, 0x2d, 0x1d, 0x10, 0xa8, 0x94, 0x2f, 0x1f, 0xc5, 0xbb, 0x8e, 0x27, 0xba,
+    0xb7, 0x52, 0xc5, 0xee, 0xc4, 0xac, 0x2e, 0x19, 0x20, 0x17, 0xac, 0x34, 0x1e, 0x1b, 0xfb, 0x16,
+    0x6b, 0x4d, 0x71, 0x4c, 0xce, 0xc1, 0xb0, 0xe6, 0x41, 0x2c, 0x80, 0x40, 0x9d, 0x35, 0x84, 0xc8,
+    0xd2, 0xc6, 0x1c, 0x8f, 0xe1, 0x69, 0x25, 0xf7, 0xcb, 0xe7, 0xb4, 0x56, 0x44, 0xa4, 0x66, 0xed,
+    0x71, 0xb5, 0x76, 0x80, 0xcb, 0xe6, 0x02, 0x14, 0xdd, 0xea, 0x91, 0x17, 0x9c, 0x85, 0x1a, 0x8f,
+    0x0d, 0xab, 0xb5, 0xb3, 0xfd, 0x4c, 0xb1, 0x06, 0x6d, 0xc4, 0xea, 0x20, 0xe2, 0x69, 0x3a, 0x98,
+    0xb6, 0xf6, 0x0a, 0x1f, 0x26, 0xc0, 0x71, 0x68, 0x6e, 0x3a, 0x6c, 0x2d, 0xd2, 0x88, 0x23, 0xf6,
+    0x54, 0x71, 0xd2, 0xe0, 0x31, 0x79, 0x11, 0x27, 0x87, 0x0d, 0xf0, 0x01, 0x55, 0x9a, 0xe7, 0xa3,
+    0xcf, 0x8a, 0xf1, 0x74, 0xe8, 0x58, 0xaa, 0xe4, 0x81, 0x1f, 0x17, 0x65, 0x2f, 0x1e, 0xdb, 0x29,
+    0x16, 0x6b, 0xcb, 0x3c, 0x4c, 0x0e, 0x0e, 0xb0, 0xe6, 0xb9, 0x3d, 0x7f, 0x40, 0x2e, 0xbc, 0x70,
+    0x28, 0x60, 0x85, 0x10, 0xb9, 0x51, 0x98, 0x63, 0x34, 0x38, 0xad, 0x2c, 0xb7, 0xf7, 0x9c, 0xab,
+    0x81, 0x88, 0x34, 0xae, 0x33, 0xae, 0x22, 0x67, 0x70, 0xd9, 0x5b, 0x43, 0xa2, 0x7b, 0x81, 0x87,
+    0x80, 0x5d, 0x18, 0xe2, 0x31, 0x54, 0xce, 0x76, 0x06, 0x74, 0x57, 0xe9, 0x60, 0x66, 0x6e, 0x3a,
+    0x14, 0xcb, 0xf1, 0x8a, 0xa9, 0x45, 0xd3, 0xd1, 0x4e, 0x92, 0x46, 0x58, 0x69, 0xa4, 0x4a, 0x1e,
+    0x2c, 0x8f, 0x71, 0x15, 0x29, 0x39, 0x5e, 0xfc, 0x0f, 0x48, 0xea, 0x0e, 0x1f, 0xc1, 0x83, 0x8b,
+    0x27, 0xd8, 0xbb, 0x52, 0x65, 0x13, 0xc1, 0xac, 0xce, 0x92, 0x1c, 0x57, 0x65, 0x40, 0x1e, 0x1b,
+    0x87, 0x0a, 0x6b, 0x82, 0x35, 0x4c, 0xae, 0x2d, 0x97, 0xe6, 0x39, 0x1e, 0x7c, 0x40, 0xbd, 0x26,
+    0x84, 0xe8, 0xb4, 0xab, 0x1c, 0x29, 0xd8, 0x69, 0xe5, 0x6c, 0x7c, 0xe7, 0xdc, 0x45, 0x3f, 0xa4,
+    0x72, 0x75, 0x71, 0x95, 0x11, 0x54, 0xcb, 0x2e, 0x24, 0x14, 0x5d, 0xc2, 0xbc, 0x16, 0x5c, 0xf6,
+    0x15, 0x8f, 0x0f, 0x14, 0xb4, 0x73, 0x67, 0x0a, 0xb1, 0x06, 0x99, 0x24, 0xe9, 0x00, 0xbc, 0x72,
+    0x3a, 0x28, 0x49, 0xf0, 0x0a, 0xb6, 0xf7, 0xbf, 0x81, 0x14, 0x6e, 0x3a, 0x5c, 0x30, 0xd1, 0x48,
+    0xf2, 0xab, 0x54, 0x89, 0x6d, 0xe1, 0x31, 0x8b, 0x77, 0x25, 0x87, 0x62, 0xf3, 0x01, 0xd9, 0x69,
+    0xe2, 0x23, 0xb1, 0x55, 0xf1, 0x44, 0x74, 0x55, 0xaa, 0x26, 0x99, 0x1c, 0x57, 0x9d, 0x38, 0x1e,
+    0x83, 0xf9, 0x09, 0x6b, 0x0d, 0x2b, 0x4c, 0x6e, 0x0e, 0x93, 0xe6, 0x3d, 0x2e, 0x7c, 0x40, 0x22,
+    0xcd, 0x70, 0x48, 0x40, 0x83, 0x10, 0xb5, 0xea, 0x94, 0x63, 0x42, 0x48, 0xad, 0x64, 0x0a, 0xec,
+    0x9c, 0xd3, 0x4f, 0x88, 0xf4, 0x80, 0x1d, 0xae, 0xd6, 0x7b, 0x6c, 0xd9, 0x78, 0x3f, 0xa2, 0x4b,
+    0xe7, 0x6d, 0x80, 0x5b, 0x21, 0xe2, 0xb1, 0x1b, 0x87, 0x76, 0x06, 0xdf, 0x9e, 0xe9, 0x00, 0x99,
+    0x56, 0x3a, 0x68, 0xce, 0xf4, 0x0a, 0x66, 0xc8, 0xd2, 0xe1, 0x78, 0x98, 0x46, 0xe4, 0x4b, 0xa4,
+    0x8a, 0x80, 0x13, 0x8f, 0x41, 0x48, 0x2e, 0x39, 0x92, 0xf6, 0x0e, 0x48, 0x86, 0x2b, 0x1f, 0xd9,
+    0xa3, 0x87, 0x27, 0xc7, 0xd7, 0x52, 0x85, 0x1b, 0xca, 0xac, 0x90, 0xe0, 0x1c, 0x17, 0xa2, 0x1b,
+    0x1e, 0x33, 0x1c, 0x10, 0x6b, 0xe2, 0x3b, 0x4b, 0xee, 0x62, 0xad, 0xe6, 0xa9, 0x9a, 0x79, 0x40,
+    0xd6, 0x39, 0x84, 0x08, 0xe8, 0xb2, 0x1c, 0x33, 0x18, 0x68, 0x25, 0x67, 0xae, 0xe7, 0x9c, 0x19,
+    0x38, 0xa4, 0xbb, 0xfe, 0x71, 0x15, 0x1d, 0x4c, 0xcb, 0xbe, 0x6e, 0x13, 0x5d, 0x76, 0xb1, 0x03,
+    0x6c, 0xdb, 0xdf, 0x82, 0xad, 0x90, 0xe0, 0x31, 0x88, 0xb9, 0x76, 0x06, 0xfe, 0xb5, 0xea, 0x60,
+    0xa5, 0x6d, 0x3a, 0x88, 0x09, 0xf6, 0x0a, 0x77, 0x7f, 0xd3, 0x41, 0xd5, 0x94, 0x46, 0x6a, 0x8b,
+    0x20, 0x89, 0x16, 0xe1, 0x54, 0x41, 0x96, 0xe4, 0x31, 0xf1, 0x71, 0x26, 0x07, 0xee, 0x03, 0x02,
+    0xb1, 0x90, 0xe4, 0xa3, 0x6d, 0xda, 0xf1, 0x14, 0x36, 0xc0, 0xac, 0x0c, 0x0f, 0x20, 0x97, 0xe3,
+    0x26, 0x1e, 0x53, 0x58, 0x16, 0x6b, 0xda, 0x3e, 0x4c, 0x2e, 0xb8, 0xae, 0xe6, 0xb9, 0x39, 0x7f,
+    0x40, 0xaa, 0x36, 0x84, 0xf8, 0xae, 0xc1, 0x1c, 0x47, 0x1c, 0xe6, 0x63, 0xa9, 0x3d, 0xad, 0xcc,
+    0xc8, 0xf6, 0x9c, 0x8e, 0x87, 0x88, 0xd4, 0x84, 0x35, 0xae, 0xb6, 0xa4, 0x6f, 0xd9, 0x47, 0x6f,
+    0xa2, 0xbb, 0xa7, 0xee, 0x82, 0x4f, 0x61, 0xe3, 0xb1, 0xe7, 0x18, 0x46, 0x06, 0xde, 0xc0, 0xea,
+    0x40, 0x68, 0x5f, 0x3a, 0x68, 0x0a, 0xf8, 0x8a, 0x6b, 0x2e, 0xd3, 0xa1, 0xc3, 0x0d, 0x49, 0x4a,
+    0xba, 0xa6, 0xca, 0x84, 0x7e, 0x5e, 0xb1, 0x6f, 0xe2, 0x31, 0x66, 0xdc, 0x26, 0x07, 0x73, 0xec,
+    0x01, 0xbd, 0xfc, 0xe7, 0xa3, 0xc6, 0x69, 0xf1, 0xe4, 0x88, 0xcc, 0xac, 0x9a, 0xc8, 0x6c, 0x97,
+    0xb7, 0x27, 0x1e, 0x13, 0x80, 0xfc, 0x64, 0xbb, 0xdd, 0x62, 0x4d, 0x73, 0x7d, 0xc9, 0x51, 0x10,
+    0xd7, 0x3c, 0x67, 0xbe, 0x0f, 0xb8, 0x39, 0x87, 0x10, 0xab, 0x25, 0xe6, 0xe3, 0x83, 0xd5, 0xb6,
+    0xcc, 0x21, 0xfb, 0x9c, 0x4a, 0xf0, 0x87, 0xd4, 0xa2, 0x44, 0xae, 0x56, 0x4e, 0x6e, 0x59, 0x2b,
+    0x69, 0xa2, 0xfb, 0xf3, 0xf1, 0x82, 0xaf, 0x9f, 0x2f, 0xf2, 0xc3, 0xd8, 0x76, 0x06, 0x4f, 0x04,
+    0xc2, 0x40, 0x05, 0x79, 0x35, 0xb4, 0x4c, 0x56, 0x0a, 0x78, 0x50, 0xbf, 0x71, 0xf2, 0x8e, 0x46,
+    0x4e, 0xb6, 0xa3, 0x8a, 0x3e, 0xfa, 0x8e, 0xf9, 0xba, 0xf5, 0x37, 0x33, 0x65, 0x25, 0x07, 0x2d,
+    0xee, 0xfc, 0xdc, 0x07, 0x49, 0x23, 0x5b, 0x38, 0xdd, 0xe4, 0x05, 0x58, 0xaa, 0xce, 0xab, 0x1b,
+    0x17, 0xbc, 0x15, 0x1e, 0x63, 0x9a, 0x0b, 0x6b, 0x6a, 0xcf, 0x23, 0xce, 0xbc, 0xc9, 0xe1, 0x0d,
+    0xa9, 0xdb, 0xbf, 0x2d, 0xb5, 0x70, 0x68, 0xd0, 0xa5, 0x1c, 0xbf, 0x61, 0x68, 0xe5, 0x42, 0x7b,
+    0xe7, 0xfc, 0x8e, 0x00, 0xa3, 0x8a, 0xfc, 0x86, 0xb4, 0x62, 0x4b, 0xa9, 0xa2, 0x96, 0xcd, 0xd8,
+    0x56, 0x9d, 0x8e, 0x8b, 0xa9, 0x6f, 0x80, 0x4d, 0xd0, 0xdf, 0x31, 0x45, 0xa4, 0x76, 0x06, 0xd8,
+    0x13, 0xc4, 0xe0, 0x65, 0x93, 0x35, 0xec, 0x4b, 0x5b, 0x8a, 0xb5, 0x1e, 0xc0, 0x51, 0x39, 0x98,
+    0x46, 0x84, 0x89, 0xa7, 0x4a, 0xc3, 0x21, 0x8f, 0x29, 0xf9, 0xff, 0x37, 0xd8, 0xf6, 0x26, 0x07,
+    0xff, 0x22, 0xfd, 0x58, 0xef, 0x4a, 0x23, 0x48, 0x52, 0xde, 0x34, 0xa6, 0x59, 0xaa, 0x44, 0xf6,
+    0x1f, 0x57, 0xe9, 0x36, 0x1e, 0x33, 0x71, 0x17, 0x6b, 0x2b, 0xc1, 0x25, 0x8e, 0x4b, 0x8d, 0xc9,
+    0x15, 0xbe, 0x39, 0x3c, 0x8d, 0xa5, 0xfc, 0x37, 0x2d, 0x17, 0x0e, 0x35, 0x0c, 0x99, 0xe3, 0xb7,
+    0x36, 0xad, 0x24, 0xcf, 0xfa, 0x9c, 0x00, 0x78, 0x88, 0x14, 0x53, 0x5b, 0xa9, 0x1e, 0x26, 0xd5,
+    0x58, 0xb5, 0xfd, 0x8e, 0xeb, 0xf3, 0x85, 0x80, 0x6b, 0xe2, 0xe2, 0xb1, 0xb4, 0xc8, 0x76, 0x06,
+    0x0e, 0x0d, 0xc2, 0xc0, 0x3a, 0x1e, 0x1d, 0x48, 0x8e, 0xb1, 0x06, 0x01, 0xb4, 0x4a, 0x21, 0xc7,
+    0xf3, 0x37, 0x70, 0x01, 0xd2, 0xc8, 0x0f, 0x7a, 0x54, 0xf1, 0xb9, 0xe4, 0x31, 0x1d, 0xd1, 0x24,
+    0x07, 0xda, 0x1c, 0xfd, 0xe8, 0xb2, 0x45, 0x23, 0x03, 0xd2, 0xdd, 0x84, 0xdc, 0x50, 0xaa, 0x5e,
+    0xb1, 0x1c, 0xd7, 0x07, 0x24, 0x1e, 0x3b, 0x15, 0x0b, 0x6b, 0xe2, 0xba, 0x4b, 0x0e, 0x27, 0xbf,
+    0xe1, 0x0d, 0xee, 0xdd, 0xbf, 0x0a, 0xc2, 0x70, 0xa8, 0x01, 0xa6, 0x1c, 0x9b, 0xaa, 0x69, 0xe5,
+    0x1c, 0x6a, 0xe7, 0xa4, 0x0f, 0x3e, 0xa4, 0x66, 0x96, 0x4a, 0x55, 0x68, 0x27, 0xae, 0x4a, 0xf3,
+    0xcc, 0xd8, 0xba, 0x0f, 0x8f, 0x6b, 0x42, 0x64, 0x80, 0x7b, 0xad, 0xe2, 0xf1, 0xb5, 0x6b, 0x76,
+    0x06, 0xc6, 0x22, 0xe9, 0x60, 0x45, 0x71, 0x35, 0xf4, 0xa8, 0x57, 0x8a, 0x78, 0x58, 0xbf, 0xb1,
+    0x8e, 0x8f, 0x46, 0xf6, 0x53, 0xa4, 0x0a, 0x82, 0xee, 0x8e, 0xd1, 0xc8, 0x2d, 0x39, 0x1f, 0xae,
+    0xe7, 0xa7, 0xbe, 0xd1, 0x01, 0x59, 0x4e, 0x48, 0x23, 0xb6, 0x87, 0xdd, 0x24, 0x66, 0x4e, 0xaa,
+    0xb2, 0x56, 0x1d, 0x17, 0x4a, 0xe4, 0x1d, 0x6b, 0x0b, 0x12, 0x6b, 0x5d, 0x7d, 0x4a, 0x6e, 0x05,
+    0xd2, 0xe1, 0xe5, 0x60, 0xdc, 0xbf, 0x1c, 0xa6, 0x70, 0x98, 0x78, 0xab, 0x1c, 0x7f, 0x0a, 0x68,
+    0x25, 0x22, 0x8d, 0xe7, 0xd4, 0xb0, 0x38, 0xa4, 0x20, 0x58, 0x71, 0x35, 0x64, 0x76, 0xc6, 0x7e,
+    0x50, 0x74, 0x5c, 0x3a, 0x9e, 0x03, 0xfc, 0xe3, 0xff, 0x8e, 0x53, 0x11, 0xb5, 0x73, 0x50, 0xd3,
+    0xb0, 0x06, 0xed, 0xd2, 0xc2, 0xc0, 0x89, 0x2e, 0x1d, 0x54, 0xd7, 0xad, 0x06, 0x71, 0x2d, 0x4b,
+    0x51, 0x0c, 0xe8, 0x37, 0x5a, 0x1c, 0xd3, 0x48, 0x77, 0x7b, 0x54, 0x59, 0xe8, 0xe2, 0x31, 0xd3,
+    0x88, 0x25, 0x27, 0x47, 0xfe, 0xfc, 0x38, 0x14, 0x49, 0x23, 0xb8, 0x8f, 0xdd, 0xb4, 0xc8, 0x54,
+    0xaa, 0x86, 0x38, 0x1d, 0x57, 0xad, 0x02, 0x1e, 0x4b, 0x5a, 0x11, 0x6b, 0x65, 0x07, 0x24, 0x2e,
+    0x61, 0x5c, 0xc9, 0x31, 0xf6, 0x39, 0x3c, 0x81, 0xb7, 0xfb, 0x87, 0xaa, 0x14, 0x0e, 0xef, 0x1b,
+    0x96, 0xa3, 0x1e, 0xfd, 0xac, 0x24, 0x19, 0xf5, 0x9c, 0x65, 0xe4, 0x86, 0x74, 0xfe, 0x5d, 0xa9,
+    0xb2, 0xbe, 0xc7, 0xd5, 0x3d, 0xbf, 0x19, 0x4b, 0xb0, 0xda, 0x71, 0x9d, 0x37, 0x0e, 0xf0, 0x3a,
+    0x1a, 0x3c, 0x06, 0xf0, 0xed, 0xe8, 0x60, 0x76, 0x63, 0x3a, 0xc0, 0x4a, 0x56, 0x8a, 0x26, 0x69,
+    0xbf, 0x41, 0xab, 0x91, 0x46, 0x30, 0x84, 0xa3, 0xca, 0x95, 0x18, 0x8f, 0x91, 0xba, 0x28, 0x39,
+    0x5b, 0x43, 0x0f, 0x88, 0x4e, 0x42, 0x1a, 0x85, 0xc3, 0xe2, 0x23, 0xab, 0x5a, 0xdd, 0x74, 0x89,
+    0x59, 0xaa, 0x0c, 0x88, 0x1b, 0x97, 0xfc, 0x31, 0x1e, 0xab, 0x98, 0x09, 0x6b, 0x9f, 0x94, 0x4b,
+    0xae, 0x94, 0x99, 0xe6, 0xb5, 0xd5, 0xdc, 0xbf, 0x56, 0xbe, 0x70, 0x98, 0x92, 0xa6, 0x1c, 0x41,
+    0xfa, 0x68, 0x25, 0x62, 0x7a, 0xe7, 0x8c, 0xc6, 0x39, 0xa4, 0xd1, 0x78, 0x71, 0xd5, 0xa3, 0x42,
+    0xcb, 0xba, 0x10, 0x77, 0xdc, 0xff, 0x54, 0x03, 0x1c, 0xc7, 0x08, 0x8f, 0x23, 0x96, 0xb4, 0x33,
+    0x8d, 0xcd, 0xb0, 0x06, 0x94, 0x4a, 0xe8, 0xe0, 0x53, 0x89, 0x35, 0x4c, 0x21, 0x4d, 0x87, 0xca,
+    0x71, 0x4a, 0xd1, 0x51, 0xf0, 0x37, 0xae, 0xfc, 0xd0, 0x88, 0x18, 0x72, 0x54, 0x89, 0x7f, 0xdf,
+    0x31, 0xd6, 0xe7, 0x24, 0x67, 0x7e, 0xe0, 0x01, 0xf9, 0x54, 0x46, 0xa3, 0x48, 0x5a, 0xdd, 0xc4,
+    0xbf, 0x51, 0xaa, 0xa2, 0x53, 0x1b, 0x97, 0xc9, 0x17, 0x1e, 0xf3, 0x25, 0x08, 0x6b, 0x28, 0x3b,
+    0x4b, 0xae, 0x94, 0xc0, 0xe1, 0x71, 0x84, 0xd2, 0x3c, 0x5f, 0x55, 0xfb, 0x47, 0x89, 0x18, 0x0e,
+    0xd7, 0x7a, 0x93, 0xa3, 0xd2, 0x2c, 0xad, 0xfc, 0x72, 0xe9, 0x9c, 0xc6, 0x7d, 0x87, 0x34, 0xcd,
+    0x18, 0xae, 0xe2, 0xab, 0xcc, 0x58, 0x6d, 0x1c, 0x2d, 0x4b, 0x99, 0xd6, 0x71, 0xe1, 0xcb, 0x0c,
+    0x70, 0x9a, 0x18, 0x3c, 0x06, 0x6e, 0x31, 0xe9, 0x60, 0xef, 0x71, 0x3a, 0x8c, 0x47, 0xf0, 0x0a,
+    0x99, 0xea, 0xbf, 0x71, 0xec, 0x8a, 0x46, 0x52, 0x31, 0xa5, 0x0a, 0x6e, 0x14, 0x8f, 0x29, 0x18,
+    0x2a, 0x39, 0xa9, 0xe3, 0x0f, 0x88, 0x51, 0x07, 0x1f, 0x29, 0xac, 0xf0, 0x26, 0x96, 0x93, 0xf1,
+    0x14, 0x2c, 0x4d, 0xaa, 0xe2, 0xc9, 0x1d, 0x17, 0xba, 0x1a, 0x1e, 0xab, 0x70, 0x0d, 0x6b, 0x1e,
+    0xd6, 0x4b, 0xce, 0xa2, 0x9a, 0xe6, 0x6d, 0x89, 0x7b, 0x40, 0xd8, 0xc5, 0x70, 0x18, 0xc7, 0xa8,
+    0x1c, 0x37, 0x23, 0x6a, 0xe5, 0xcc, 0x61, 0xe7, 0x84, 0x84, 0x42, 0xa4, 0x65, 0xe7, 0x70, 0xf5,
+    0x07, 0x65, 0xcb, 0x96, 0xa9, 0x77, 0xdc, 0xce, 0x42, 0xa2, 0xcb, 0x70, 0x69, 0x80, 0x93, 0xd7,
+    0xe2, 0x31, 0x69, 0x6b, 0x76, 0x06, 0x92, 0x8e, 0xe8, 0xa0, 0x13, 0x59, 0x3a, 0x9c, 0x92, 0xf0,
+    0x8a, 0x35, 0x41, 0xbf, 0x81, 0x80, 0x58, 0x3a, 0x82, 0x75, 0xd1, 0x88, 0x07, 0x71, 0x54, 0x81,
+    0x62, 0xdd, 0x31, 0x6a, 0x4c, 0x25, 0xe7, 0x6e, 0xcc, 0x01, 0xe1, 0x70, 0xe3, 0xa3, 0xec, 0xa3,
+    0xf0, 0xa4, 0xda, 0x51, 0xaa, 0x54, 0xd5, 0x1b, 0x17, 0x58, 0xf7, 0x1d, 0x43, 0x77, 0x0c, 0x6b,
+    0xd8, 0x88, 0x4a, 0x8e, 0xcc, 0xa3, 0xe6, 0xc9, 0x12, 0x76, 0x40, 0xf8, 0xb0, 0x70, 0x98, 0xcd,
+    0x85, 0x10, 0xe5, 0x37, 0x94, 0x23, 0xea, 0x06, 0xad, 0xb4, 0x8a, 0xed, 0x9c, 0x9d, 0xea, 0x86,
+    0x74, 0xc8, 0x22, 0xae, 0xd6, 0x65, 0x68, 0x59, 0x5c, 0x0d, 0xa2, 0xbb, 0x98, 0x6d, 0x80, 0x95,
+    0x7c, 0xdf, 0xb1, 0xaa, 0x97, 0x76, 0x06, 0x97, 0xdb, 0xea, 0x80, 0xa6, 0x6c, 0x3a, 0x88, 0xbc,
+    0xf6, 0x0a, 0xeb, 0x34, 0xc0, 0xa1, 0x4e, 0x70, 0x3a, 0x86, 0x3e, 0xd2, 0xc8, 0xfe, 0xf9, 0x54,
+    0x61, 0xcf, 0xe1, 0x31, 0xb1, 0x08, 0x27, 0xa7, 0xd2, 0xf5, 0x01, 0x71, 0x3c, 0xe7, 0x23, 0x73,
+    0xa1, 0xf1, 0xe4, 0x61, 0x59, 0xaa, 0x02, 0x27, 0x99, 0xd5, 0xd9, 0xf2, 0xe3, 0x6a, 0xf8, 0xc6,
+    0x63, 0xa6, 0xb5, 0x62, 0xcd, 0x6d, 0x8d, 0xc9, 0x45, 0xaa, 0xd5, 0x3c, 0xc9, 0xfd, 0x0f, 0xe8,
+    0x31, 0x85, 0x10, 0xf9, 0x72, 0x98, 0x23, 0xbc, 0x3e, 0xad, 0x5c, 0xaf, 0xf7, 0x9c, 0xbf, 0x9f,
+    0x88, 0x94, 0x5f, 0x34, 0xae, 0xaa, 0xb0, 0x70, 0xd9, 0xca, 0x51, 0xa2, 0xeb, 0xa5, 0x86, 0x80,
+    0xb5, 0xc9, 0x5e, 0xb0, 0xb5, 0x4e, 0x3c, 0x06, 0x0c, 0xa9, 0xe9, 0xa0, 0xa4, 0x5a, 0x3a, 0xe8,
+    0x1e, 0xf4, 0x8a, 0xc2, 0x05, 0xd3, 0x11, 0x47, 0x00, 0x49, 0x1c, 0xab, 0xa5, 0x8a, 0x50, 0xe8,
+    0x8e, 0x89, 0xcf, 0x32, 0x39, 0xe1, 0xa5, 0x0e, 0x48, 0x2b, 0x32, 0x1f, 0x89, 0x3c, 0x88, 0xa7,
+    0xaf, 0x30, 0x66, 0xb5, 0xfc, 0x5a, 0xbb, 0xc6, 0xa8, 0xef, 0xd8, 0x9c, 0xa3, 0x58, 0x63, 0x9a,
+    0x57, 0x72, 0x09, 0xaa, 0x35, 0x4f, 0x32, 0xcd, 0x03, 0x2e, 0xba, 0x21, 0x44, 0x1e, 0xfe, 0xf8,
+    0x48, 0x21, 0x44, 0x2b, 0xef, 0x6e, 0xb6, 0xa5, 0xd9, 0x9d, 0xe7, 0x2c, 0x90, 0x3c, 0xa4, 0xb8,
+    0x5a, 0x71, 0x15, 0x46, 0x64, 0xcb, 0x56, 0x37, 0x10, 0xdd, 0x6c, 0x59, 0x17, 0x6c, 0x9e, 0x6f,
+    0x91, 0x93, 0xdc, 0xb5, 0xf3, 0x4a, 0xe9, 0xb0, 0x06, 0xf5, 0xa1, 0xe9, 0x80, 0xf3, 0x55, 0x3a,
+    0xd8, 0xab, 0xf4, 0x0a, 0x8a, 0xda, 0xd2, 0xb1, 0xda, 0x05, 0x49, 0x02, 0x9a, 0xa4, 0x0a, 0x38,
+    0x07, 0x8f, 0x81, 0xe3, 0x2e, 0x39, 0x7d, 0xf8, 0x0e, 0x48, 0x9a, 0x26, 0x1f, 0xd1, 0xd9, 0x88,
+    0xa7, 0x0b, 0x15, 0x66, 0x35, 0xa5, 0xf0, 0xb8, 0x08, 0x80, 0xef, 0xd8, 0x74, 0xa3, 0x58, 0x7b,
+    0x4b, 0x56, 0x72, 0x56, 0xc1, 0x35, 0x8f, 0xd1, 0xc6, 0x03, 0x6e, 0x39, 0x22, 0x44, 0xcd, 0xeb,
+    0xf8, 0x98, 0x61, 0x40, 0x2b, 0x61, 0x60, 0x3d, 0x67, 0x7a, 0xca, 0x21, 0x3d, 0x2d, 0x8e, 0xab,
+    0x3a, 0xa2, 0x5a, 0xb6, 0x0a, 0x91, 0xe8, 0xca, 0xcc, 0xb8, 0xe0, 0x42, 0x34, 0x78, 0x6c, 0x65,
+    0x75, 0x91, 0x91, 0x42, 0xb5, 0x33, 0xf0, 0xef, 0xb0, 0x06, 0x60, 0xd6, 0xe9, 0x60, 0x34, 0x56,
+    0x3a, 0x44, 0x9c, 0xf5, 0x8a, 0xc0, 0xd0, 0xd2, 0x11, 0x0c, 0x9a, 0x46, 0x5a, 0x9e, 0xa4, 0x8a,
+    0x0b, 0x16, 0x8f, 0x31, 0x9c, 0x2f, 0x39, 0xeb, 0x0a, 0x0f, 0x48, 0x06, 0x2f, 0x1f, 0x3d, 0x57,
+    0x88, 0xa7, 0x55, 0x52, 0x66, 0xe5, 0xf5, 0xea, 0xb8, 0x1e, 0xc6, 0xf0, 0x98, 0x04, 0x8f, 0x58,
+    0xdb, 0x28, 0x5a, 0x72, 0x24, 0x8e, 0x35, 0x0f, 0x4e, 0xd1, 0x03, 0x82, 0xf1, 0x21, 0x44, 0xdc,
+    0xb3, 0xe5, 0x28, 0xba, 0x40, 0x2b, 0x51, 0xd5, 0x3d, 0x27, 0x5c, 0xc6, 0x21, 0x15, 0xd5, 0x90,
+    0xab, 0xc6, 0x89, 0x5a, 0xf6, 0x9f, 0x9c, 0xe8, 0x0a, 0xaa, 0xb8, 0x60, 0xa5, 0x31, 0x78, 0xac,
+    0xbf, 0xaf, 0x9d, 0x99, 0x17, 0x87, 0xf5, 0xdc, 0x82, 0xeb, 0x06, 0xfd, 0xc5, 0xe9, 0xe0, 0xec,
+    0x71, 0x3a, 0xa8, 0xc8, 0x56, 0x8a, 0x75, 0x4c, 0x5e, 0x71, 0x12, 0xff, 0x37, 0x08, 0x20, 0xd2,
+    0x48, 0xaa, 0xb1, 0x54, 0xf9, 0x3d, 0xe5, 0x31, 0xe8, 0x76, 0x25, 0x07, 0x0c, 0x07, 0x02, 0xc5,
+    0xa9, 0xe1, 0xa3, 0x5a, 0x38, 0xde, 0x64, 0x90, 0x51, 0xaa, 0x3e, 0x4d, 0x1e, 0x17, 0x21, 0x2f,
+    0x1e, 0x4b, 0xe8, 0x0e, 0x6b, 0x8c, 0x3c, 0x4c, 0xee, 0xbd, 0x9d, 0xe6, 0x85, 0x88, 0x7d, 0x40,
+    0xff, 0xc4, 0x70, 0xc8, 0xf5, 0xb1, 0x1c, 0x01, 0x28, 0x6a, 0x65, 0xf8, 0x81, 0xe7, 0xdc, 0xff,
+    0x42, 0xa4, 0xac, 0x54, 0x71, 0x95, 0xe4, 0x68, 0xcb, 0xca, 0xea, 0x78, 0x5c, 0x3c, 0x68, 0x03,
+    0xfc, 0xc6, 0x1b, 0x8f, 0x03, 0xc5, 0xb3, 0xb3, 0x28, 0x3a, 0xb1, 0x06, 0xc2, 0x5a, 0xea, 0xc0,
+    0x00, 0x74, 0x3a, 0x38, 0x86, 0x57, 0x0a, 0x2d, 0x34, 0xc0, 0x21, 0xf6, 0x90, 0x46, 0xdc, 0xe2,
+    0xa6, 0x0a, 0x11, 0x23, 0x8f, 0x71, 0x83, 0x31, 0x39, 0x68, 0x1a, 0x10, 0x48, 0x16, 0x21, 0x1f,
+    0xc1, 0xc0, 0xf1, 0x26, 0x7c, 0xc6, 0x52, 0xa5, 0xf6, 0xf3, 0xb8, 0xb8, 0x4f, 0xf2, 0xd8, 0xab,
+    0x7b, 0x58, 0xc3, 0xc1, 0x65, 0x72, 0xf4, 0xe5, 0x34, 0x6f, 0xe9, 0x1d, 0xff, 0x41, 0x53, 0x86,
+    0x43, 0x17, 0xd2, 0xe5, 0xd8, 0x68, 0x53, 0x2b, 0x97, 0xbd, 0x3c, 0xa7, 0x64, 0x2c, 0x22, 0x2d,
+    0xae, 0x8b, 0xab, 0x26, 0xd0, 0x5b, 0x96, 0xb8, 0xc2, 0xe3, 0xa2, 0x2d, 0x1e, 0xe0, 0x98, 0xce,
+    0x78, 0x5c, 0xa4, 0xa7, 0x9d, 0x1d, 0xc7, 0x89, 0x75, 0x6b, 0x73, 0xeb, 0x06, 0xbd, 0xf7, 0xc2,
+    0x80, 0x0a, 0xcf, 0x52, 0x44, 0x67, 0xfa, 0x0d, 0x86, 0xd0, 0x34, 0x62, 0xf4, 0x20, 0x55, 0xfa,
+    0xcd, 0x78, 0x4c, 0x93, 0x6b, 0xc9, 0xa1, 0xba, 0x3f, 0x3f, 0xae, 0x6c, 0xd2, 0xc8, 0x56, 0x65,
+    0x37, 0x5d, 0xbd, 0x95, 0x2a, 0xfd, 0x54, 0xc7, 0x25, 0xca, 0x82, 0xc7, 0x50, 0x6e, 0xc4, 0xda,
+    0x6c, 0xc2, 0x92, 0x43, 0x12, 0x74, 0x78, 0xfa, 0x99, 0xf7, 0xcf, 0x74, 0x29, 0x1c, 0x1a, 0xdf,
+    0x2c, 0x47, 0x3f, 0xfd, 0x59, 0x49, 0x77, 0xec, 0x39, 0x7f, 0xea, 0x0d, 0x29, 0x58, 0xbf, 0x52,
+    0x75, 0x1b, 0x9d, 0xb1, 0x89, 0xb1, 0x1d, 0xd7, 0x65, 0xe8, 0x00, 0x2f, 0xc5, 0xc1, 0xe3, 0x46,
+    0x5c, 0xed, 0x3c, 0xec, 0x38, 0xac, 0xa5, 0x9f, 0x5b, 0xf7, 0xed, 0x0c, 0x1c, 0x07, 0x63, 0x30,
+    0xea, 0x60, 0xaf, 0x5e, 0x3a, 0xd8, 0xc3, 0xf5, 0x8a, 0xc2, 0x27, 0xd3, 0x01, 0xbc, 0x04, 0x49,
+    0xca, 0x89, 0xa6, 0x8a, 0xf0, 0xb0, 0xc9, 0x59, 0x28, 0x77, 0x40, 0x5f, 0xe8, 0xf9, 0xc8, 0x92,
+    0x4b, 0x3c, 0x09, 0xb3, 0x32, 0x2b, 0xf5, 0xfc, 0xda, 0xf5, 0x81, 0x84, 0xc7, 0xf0, 0x59, 0xc5,
+    0x1a, 0x62, 0xe0, 0x92, 0xb3, 0x45, 0xad, 0x79, 0xb0, 0x03, 0x1f, 0x90, 0x95, 0x0c, 0x21, 0xc2,
+    0x3f, 0xca, 0x47, 0x6b, 0xa3, 0x6d, 0xe9, 0x18, 0xed, 0x39, 0xd1, 0xc3, 0x0f, 0xa9, 0x57, 0x65,
+    0x5c, 0x0d, 0x12, 0xdc, 0xb2, 0x39, 0x44, 0x44, 0x17, 0x18, 0xe2, 0x05, 0xa7, 0x0a, 0x5d, 0xe4,
+    0xaf, 0xa2, 0xed, 0x2c, 0xf8, 0x3e, 0xac, 0x51, 0xf2, 0x5b, 0xf7, 0x36, 0xe3, 0x25, 0x07, 0x30,
+    0x3e, 0xea, 0x40, 0x8a, 0x64, 0x3a, 0xdc, 0x38, 0xf5, 0x0a, 0xa4, 0xe7, 0xbf, 0x61, 0x35, 0x90,
+    0x46, 0xf4, 0xa4, 0xa6, 0xca, 0xb2, 0xff, 0x8e, 0xd1, 0x6e, 0x34, 0x39, 0xf6, 0x5e, 0x0f, 0x08,
+    0x66, 0x2c, 0x1f, 0x69, 0x69, 0xf1, 0xa6, 0xcf, 0xeb, 0xc7, 0x25, 0xc8, 0x7f, 0xc7, 0x72, 0xf0,
+    0xc5, 0x5a, 0x71, 0xdd, 0x92, 0x3b, 0xd7, 0xad, 0x79, 0x40, 0x11, 0x1f, 0xd0, 0x4b, 0x2c, 0x1c,
+    0x6a, 0xe1, 0x2e, 0xc7, 0xe0, 0x50, 0x5a, 0xd9, 0xd4, 0xea, 0x39, 0x11, 0x4e, 0x10, 0xa9, 0xe4,
+    0x59, 0x5c, 0x2d, 0x95, 0xdd, 0xb2, 0xb8, 0x4e, 0x44, 0x17, 0x7f, 0xfd, 0x00, 0x8f, 0xcc, 0xc3,
+    0x63, 0x86, 0x55, 0xed, 0x5c, 0x5a, 0x49, 0xac, 0x6b, 0xb4, 0x5a, 0xf7, 0x99, 0x08, 0x26, 0x07,
+    0x71, 0xf8, 0xc3, 0x40, 0x60, 0x95, 0x35, 0xf0, 0xb1, 0x5a, 0x0a, 0xcb, 0x22, 0xc0, 0x81, 0x74,
+    0x97, 0x46, 0x50, 0x5d, 0xa7, 0x4a, 0xb9, 0x28, 0x8f, 0xf1, 0xb6, 0x35, 0x39, 0xc3, 0x54, 0xe9,
+    0xa7, 0x0b, 0x4d, 0x1a, 0xd9, 0x57, 0xf3, 0xa6, 0xff, 0xb4, 0x52, 0x25, 0xc5, 0x00, 0xb9, 0xec,
+    0x9f, 0xf1, 0x58, 0x20, 0xb7, 0x58, 0xfb, 0x7f, 0x2e, 0x71, 0x8e, 0x4a, 0xf9, 0x6f, 0xf6, 0x2e,
+    0x1c, 0xa6, 0x9b, 0x31, 0xc7, 0x3b, 0x79, 0x5a, 0xf9, 0x83, 0xf2, 0x39, 0xc3, 0x17, 0x11, 0x69,
+    0x2f, 0xb7, 0x52, 0x6d, 0x2d, 0xa9, 0xb1, 0x98, 0x22, 0x1e, 0xb7, 0x7b, 0x02, 0x01, 0x37, 0xac,
+    0xc6, 0xe3, 0x6b, 0x66, 0xed, 0x3c, 0x66, 0x53, 0xac, 0x89, 0x71, 0x5b, 0xb7, 0x22, 0x5a, 0x1c,
+    0x07, 0x04, 0xbe, 0xe9, 0xc0, 0x7b, 0x74, 0x3a, 0x1c, 0xb8, 0xf1, 0x0a, 0x60, 0x97, 0xd3, 0x11,
+    0x43, 0xf7, 0x48, 0x12, 0x3b, 0x78, 0xcc, 0xca, 0x84, 0xc9, 0x51, 0xa7, 0x7d, 0x40, 0xff, 0xe3,
+    0xf8, 0x48, 0xf7, 0x62, 0x3c, 0xdd, 0x5a, 0x30, 0xab, 0x30, 0x0c, 0xdb, 0xf5, 0x09, 0x8d, 0xc7,
+    0x82, 0x8a, 0xc3, 0x9a, 0x0e, 0x14, 0x93, 0x03, 0x65, 0xa6, 0x79, 0x11, 0x82, 0x1f, 0x70, 0xf4,
+    0x06, 0x21, 0x72, 0x37, 0xc9, 0xc7, 0x8f, 0x59, 0x44, 0x7a, 0xc0, 0x0e, 0x57, 0xd5, 0x95, 0xb7,
+    0x6c, 0xff, 0x19, 0xd1, 0x4d, 0x58, 0x74, 0xc1, 0x46, 0xff, 0x17, 0x79, 0x9a, 0x49, 0x3b, 0x73,
+    0x2e, 0x12, 0xeb, 0xb1, 0xcc, 0xd6, 0xfd, 0x2b, 0x77, 0xc9, 0x17, 0x4a, 0x02, 0xfb, 0xa0, 0x8a,
+    0x9a, 0x07, 0x06, 0x6b, 0xe8, 0xc0, 0x99, 0x47, 0xa5, 0xf0, 0x38, 0xee, 0x37, 0xe4, 0x0c, 0xa3,
+    0x11, 0x58, 0x95, 0x51, 0x45, 0xcc, 0x12, 0x8f, 0xd1, 0xfa, 0x49, 0x72, 0x24, 0x1d, 0x45, 0x23,
+    0x26, 0x2d, 0xbb, 0x89, 0xd5, 0x36, 0xa9, 0xf2, 0x4c, 0xe0, 0xb8, 0xc8, 0xdc, 0xe0, 0x31, 0xe8,
+    0x3e, 0x61, 0x8d, 0x12, 0xcc, 0x92, 0xf3, 0x10, 0xe0, 0xf0, 0xdc, 0x61, 0xdb, 0x3f, 0x1b, 0x7f,
+    0xe1, 0x10, 0x6f, 0x79, 0x72, 0x14, 0xc5, 0x4a, 0x2b, 0xdd, 0x55, 0x75, 0x4e, 0x65, 0x74, 0x87,
+    0x14, 0xc9, 0x73, 0xc7, 0xa5, 0x79, 0x61, 0x80, 0x0d, 0x88, 0xc3, 0x63, 0xe2, 0x94, 0xd9, 0xd9,
+    0x4d, 0xe8, 0xb0, 0x36, 0x9a, 0xd2, 0xba, 0xf1, 0x9f, 0x66, 0x75, 0xe9, 0xc3, 0x42, 0x1e, 0x0e,
+    0x22, 0xcb, 0x07, 0x32, 0x65, 0x01, 0x02, 0xda, 0x9e, 0xea, 0x80, 0x41, 0xbd, 0x74, 0x20, 0xd9,
+    0xfa, 0x37, 0x58, 0xeb, 0xa5, 0x11, 0xf5, 0x52, 0x53, 0x05, 0xa5, 0x0b, 0x8f, 0x91, 0x7c, 0x6d,
+    0x72, 0x60, 0xf5, 0x3c, 0x20, 0x84, 0xe3, 0xbb, 0x49, 0x9b, 0x6d, 0xa9, 0xc2, 0x44, 0xf7, 0xb8,
+    0xd8, 0x51, 0xe2, 0x31, 0x7f, 0xc9, 0x62, 0xcd, 0x84, 0xf5, 0x92, 0x13, 0xb2, 0x5b, 0xf3, 0xf0,
+    0x83, 0xe2, 0x3f, 0x24, 0x5e, 0xe1, 0x90, 0x7b, 0x07, 0x73, 0x94, 0x07, 0x47, 0x2b, 0x5d, 0x1c,
+    0x7d, 0x4e, 0x82, 0xe4, 0x87, 0x14, 0xef, 0x82, 0x5c, 0x25, 0xae, 0x85, 0x80, 0x69, 0xd6, 0xc2,
+    0x63, 0x98, 0x68, 0xdb, 0x59, 0x0a, 0x0d, 0xb1, 0xf6, 0x6a, 0xe2, 0xba, 0x29, 0x1a, 0x5f, 0x72,
+    0xf5, 0x5d, 0x2d, 0x5f, 0x19, 0xc4, 0x05, 0x98, 0x08, 0x0f, 0x10, 0x02, 0xc5, 0xb4, 0xea, 0x00,
+    0x68, 0xbe, 0x74, 0x20, 0x5f, 0xfb, 0x37, 0xe8, 0x2b, 0xa6, 0x11, 0x10, 0x5b, 0x53, 0x05, 0x60,
+    0x10, 0x8f, 0xe1, 0xbf, 0x6d, 0x72, 0x8c, 0x54, 0x3d, 0x20, 0xdd, 0xb6, 0xa5, 0x4a, 0xe7, 0xe1,
+    0xe3, 0xb2, 0xbe, 0x89, 0xc7, 0x2c, 0x58, 0x8b, 0x35, 0xd3, 0xe4, 0x4b, 0xce, 0x0e, 0x70, 0xcd,
+    0x13, 0x89, 0x8b, 0xff, 0x0c, 0xd0, 0x30, 0x47, 0xdc, 0x75, 0xb4, 0xd2, 0x4f, 0xd6, 0xe7, 0x84,
+    0xd5, 0x7e, 0x48, 0x2d, 0x6c, 0xc8, 0x55, 0xd9, 0x5d, 0x08, 0x98, 0x72, 0x33, 0x3c, 0x06, 0x66,
+    0xb6, 0x9d, 0x55, 0x36, 0x11, 0x6b, 0x9b, 0x23, 0xae, 0x5b, 0x73, 0xf7, 0x25, 0x87, 0xf2, 0xd6,
+    0xf2, 0xe5, 0x4c, 0x5c, 0x80, 0x0f, 0x05, 0x01, 0xa1, 0x18, 0x72, 0x7a, 0xd8, 0xf7, 0x48, 0x2d,
+    0x02, 0xfb, 0xbe, 0xac, 0x41, 0xcc, 0xa6, 0xa5, 0x40, 0x36, 0x06, 0x38, 0xf4, 0x53, 0xa5, 0x11,
+    0x48, 0xe0, 0x53, 0xc5, 0x60, 0x1b, 0x8f, 0xa1, 0x5f, 0x2b, 0x8d, 0x50, 0x73, 0xf2, 0x26, 0xec,
+    0xa1, 0xa5, 0x8a, 0x2f, 0xf9, 0xe3, 0x82, 0x1f, 0x8f, 0xc7, 0xb4, 0x1f, 0x8b, 0x35, 0xb3, 0xce,
+    0x25, 0x0e, 0x38, 0x52, 0xfe, 0x03, 0xcc, 0x17, 0x0e, 0xfd, 0xa8, 0x31, 0x47, 0x53, 0xf7, 0xb4,
+    0x52, 0x75, 0xca, 0xe7, 0x44, 0x08, 0x56, 0x63, 0x25, 0x9d, 0x77, 0x5c, 0x38, 0x63, 0x08, 0x98,
+    0x1c, 0x5a, 0x3c, 0x86, 0xfd, 0xb1, 0x9d, 0xb5, 0xd9, 0x13, 0x6b, 0x3d, 0x7f, 0x5a, 0x1d, 0x02,
+    0x06, 0x91, 0x47, 0x82, 0xe1, 0xf2, 0xe1, 0x33, 0x5b, 0x80, 0xdc, 0xa1, 0x01, 0xe1, 0xaa, 0x73,
+    0x7a, 0x08, 0xee, 0x68, 0x39, 0x02, 0x6c, 0xc1, 0xe9, 0x80, 0x86, 0xaf, 0x74, 0xf0, 0x92, 0xd3,
+    0x2b, 0x58, 0x70, 0x97, 0x0e, 0x73, 0x09, 0x3c, 0x06, 0x3f, 0x82, 0xc9, 0x51, 0xc8, 0xef, 0x80,
+    0x54, 0x28, 0xe5, 0x23, 0x8c, 0x53, 0xe2, 0x89, 0xa7, 0x09, 0xb3, 0x72, 0x87, 0xf3, 0xb8, 0xfc,
+    0xc4, 0x8a, 0x35, 0x13, 0xdb, 0x4a, 0x0e, 0xad, 0x73, 0xcd, 0xd3, 0x83, 0xe5, 0x01, 0xc5, 0x31,
+    0x22, 0x44, 0xd2, 0xb7, 0x9e, 0xd3, 0xaa, 0xd5, 0x21, 0xc5, 0x4a, 0x1b, 0x57, 0x9d, 0x66, 0x6b,
+    0x59, 0x91, 0x70, 0x44, 0x17, 0x67, 0x99, 0x0b, 0xa6, 0x2e, 0x3e, 0xac, 0xe1, 0xd1, 0xb5, 0x6e,
+    0x09, 0x7f, 0x97, 0xdc, 0x46, 0x0a, 0x60, 0xd7, 0x81, 0xb0, 0xe6, 0xdd, 0xba, 0x4c, 0x7d, 0x0c,
+    0xef, 0xff, 0xe0, 0x25, 0x75, 0x7a, 0x18, 0x09, 0x39, 0x2d, 0x02, 0x17, 0x6c, 0xea, 0x80, 0xfa,
+    0xc8, 0x74, 0x80, 0x56, 0x93, 0x46, 0x14, 0x3f, 0x4d, 0x15, 0x3f, 0x2f, 0x3c, 0x06, 0xa7, 0xa2,
+    0xc9, 0x71, 0xd3, 0xf8, 0x80, 0x88, 0x82, 0xe5, 0x23, 0x17, 0xf1, 0x8f, 0x8b, 0x28, 0x05, 0x1e,
+    0x93, 0xad, 0x30, 0xd6, 0x68, 0x50, 0x2e, 0x39, 0x14, 0xc7, 0x35, 0x8f, 0x14, 0xfa, 0x72, 0xd4,
+    0xff, 0x49, 0x2b, 0xb5, 0x7c, 0x7b, 0x4e, 0xbd, 0x24, 0x88, 0xd4, 0xa1, 0x66, 0x5c, 0xd5, 0xed,
+    0xba, 0x65, 0x15, 0x7c, 0xc4, 0x63, 0x49, 0xac, 0xda, 0x19, 0x5d, 0x2f, 0xb1, 0xf6, 0x12, 0xd6,
+    0xba, 0xbd, 0x15, 0x61, 0x72, 0xd6, 0x6a, 0x80, 0x9d, 0x90, 0x4a, 0xcb, 0x27, 0x0d, 0x71, 0x01,
+    0x92, 0x24, 0x03, 0x84, 0x82, 0xd8, 0xe9, 0x61, 0x77, 0x0d, 0xb5, 0x08, 0x28, 0xd0, 0x3b, 0x02,
+    0x5e, 0x36, 0xea, 0x00, 0x30, 0xc0, 0x74, 0x50, 0xb2, 0xd6, 0x2b, 0x9c, 0x93, 0x99, 0x0e, 0x36,
+    0x3b, 0x90, 0xc4, 0x71, 0xb3, 0xc9, 0x41, 0xf8, 0xee, 0x80, 0x24, 0x8f, 0xe7, 0x23, 0x7f, 0x70,
+    0xe2, 0x49, 0xb3, 0x27, 0xb3, 0xd2, 0x7c, 0x2b, 0xd6, 0x40, 0x20, 0x2e, 0x39, 0x92, 0xa8, 0x35,
+    0xcf, 0xb9, 0xc3, 0x07, 0x34, 0x36, 0x86, 0x10, 0xad, 0x5e, 0xca, 0x47, 0xb4, 0xf8, 0x87, 0xd4,
+    0x46, 0x61, 0x5c, 0x05, 0x97, 0xb9, 0x65, 0x19, 0xea, 0x10, 0x5d, 0x2c, 0x20, 0x2f, 0x18, 0xee,
+    0xd1, 0x45, 0xa6, 0xa6, 0xde, 0xba, 0xa5, 0x87, 0x5e, 0x72, 0xc7, 0xb7, 0x80, 0x5d, 0x20, 0xc2,
+    0x9a, 0x67, 0x81, 0x3e, 0xf5, 0x1d, 0x08, 0xa7, 0x87, 0xa5, 0x15, 0xd4, 0xa2, 0x66, 0x32, 0xef,
+    0xe8, 0x49, 0x74, 0x4a, 0x02, 0xac, 0xdb, 0xe9, 0x00, 0x28, 0x1b, 0xe0, 0x80, 0x0a, 0x89, 0x46,
+    0x7c, 0xfa, 0x4d, 0x15, 0x02, 0x13, 0x3c, 0x46, 0x45, 0x8e, 0xc9, 0x91, 0xbe, 0xc4, 0x9b, 0x38,
+    0xd0, 0x94, 0x2a, 0x4b, 0x36, 0x8f, 0x8b, 0x44, 0x2f, 0x1e, 0xe3, 0x10, 0x1f, 0xd6, 0x6c, 0x11,
+    0x31, 0x39, 0x97, 0x95, 0xe1, 0x10, 0xec, 0xc8, 0x72, 0x24, 0x7f, 0x53, 0x2b, 0x31, 0x69, 0x77,
+    0x4e, 0xa3, 0xbc, 0x88, 0xd4, 0xd6, 0x3a, 0x5c, 0xe5, 0x68, 0x78, 0x80, 0xa1, 0xff, 0xc4, 0x63,
+    0x1e, 0x5a, 0xda, 0x59, 0xf7, 0x27, 0xb1, 0xa6, 0x12, 0xd9, 0xba, 0xe1, 0x42, 0x0d, 0x79, 0x86,
+    0xc1, 0x2d, 0x9f, 0xac, 0x97, 0x05, 0x18, 0xae, 0x0e, 0x10, 0xae, 0x39, 0xa7, 0x87, 0xce, 0xb0,
+    0xd3, 0xe2, 0x4f, 0x8f, 0x5a, 0x89, 0x78, 0x26, 0x65, 0x02, 0x03, 0xa0, 0xe8, 0x40, 0x69, 0xae,
+    0x74, 0x40, 0x7a, 0x1c, 0x55, 0xd4, 0xb5, 0xee, 0x18, 0x7f, 0x53, 0x25, 0x87, 0xea, 0x99, 0x03,
+    0xd2, 0x9b, 0x8d, 0x8f, 0xd8, 0x68, 0x38, 0x2e, 0xac, 0xac, 0x77, 0x4c, 0x89, 0x6f, 0x58, 0xd3,
+    0x46, 0xa6, 0xe4, 0x1c, 0x02, 0xd5, 0x3c, 0x67, 0x79, 0x1d, 0x90, 0x64, 0x02, 0xad, 0xd4, 0x82,
+    0xdc, 0x39, 0xed, 0x8d, 0x1b, 0x52, 0x6a, 0x21, 0x71, 0x15, 0x62, 0x88, 0x96, 0x35, 0x5d, 0xa5,
+    0x9d, 0x6d, 0x72, 0x0b, 0x6b, 0x2f, 0x7a, 0xad, 0x1b, 0x5e, 0x94, 0x25, 0x17, 0xbc, 0x03, 0xd8,
+    0x0d, 0x02, 0x5b, 0x80, 0x91, 0xf5, 0xfe, 0x20, 0x8c, 0x72, 0x7a, 0x98, 0x9e, 0x27, 0x2d, 0x6a,
+    0x0e, 0xf2, 0x8e, 0x7f, 0xa5, 0x3b, 0x67, 0x1c, 0x5c, 0x09, 0xaa, 0x3c, 0xf3, 0x90, 0x02, 0x7f,
+    0x8e, 0xea, 0x40, 0xb3, 0xef, 0xdf, 0xd0, 0x71, 0x95, 0x46, 0xbc, 0x8c, 0x4d, 0x15, 0xe5, 0x10,
+    0x3c, 0x86, 0xb5, 0xb8, 0xc9, 0xa1, 0x9d, 0xf2, 0x80, 0x9c, 0xac, 0x96, 0x2a, 0x0d, 0x72, 0x8f,
+    0x0b, 0xfe, 0x22, 0x1e, 0x63, 0x47, 0x2c, 0xd6, 0xb4, 0x43, 0x2f, 0x39, 0x2d, 0x0a, 0xcc, 0x51,
+    0xe7, 0x1e, 0xad, 0xb4, 0x9a, 0xf2, 0x39, 0x91, 0xd3, 0x1f, 0x52, 0x80, 0xe7, 0x71, 0xd5, 0xa1,
+    0x18, 0x02, 0x96, 0x5d, 0x0a, 0x8f, 0x59, 0x9e, 0x6d, 0x67, 0xda, 0x2a, 0xc4, 0x5a, 0x2e, 0x88,
+    0xeb, 0x16, 0x74, 0xd5, 0xf2, 0x91, 0x27, 0x5c, 0x80, 0x6b, 0xe8, 0x00, 0xa1, 0x00, 0x71, 0x7a,
+    0xc8, 0xcf, 0x46, 0x2d, 0xae, 0x36, 0xa6, 0x95, 0xfe, 0x2c, 0x53, 0xa6, 0x97, 0x4c, 0xcf, 0xa9,
+    0x94, 0x5e, 0x82, 0x02, 0xc5, 0x57, 0xe8, 0x80, 0xb5, 0xb1, 0xdf, 0x60, 0x9d, 0x89, 0x46, 0x6c,
+    0xbb, 0x46, 0x15, 0x01, 0xe5, 0x3b, 0x86, 0xb1, 0x3e, 0xc9, 0xb1, 0x99, 0x53, 0xaa, 0xf0, 0x5d,
+    0x36, 0x2e, 0x97, 0x54, 0x78, 0xcc, 0x2d, 0x45, 0x58, 0xe3, 0xf9, 0xb0, 0xe4, 0xf4, 0xfa, 0x85,
+    0x43, 0x05, 0xd4, 0xc9, 0x91, 0xca, 0x1f, 0xad, 0xf4, 0x99, 0xd5, 0x39, 0x99, 0xe2, 0x1c, 0x52,
+    0xa3, 0x83, 0x06, 0x58, 0x3a, 0x08, 0x3c, 0xb6, 0x78, 0xa1, 0x9d, 0x95, 0x6d, 0x0b, 0x6b, 0x33,
+    0x9b, 0xad, 0x1b, 0x73, 0xab, 0x90, 0xf7, 0x4c, 0xc5, 0xf2, 0x79, 0x48, 0x59, 0x80, 0x35, 0x14,
+    0xff, 0x60, 0x94, 0x72, 0x7a, 0xc8, 0x5b, 0x23, 0x2d, 0xe2, 0x3d, 0xa2, 0x95, 0xa5, 0x71, 0x52,
+    0x66, 0xa5, 0xdf, 0xce, 0xf9, 0x5a, 0x5b, 0x82, 0x02, 0xe9, 0x44, 0x80, 0xc3, 0x45, 0x24, 0x1a,
+    0x11, 0xb8, 0x35, 0x55, 0xb8, 0x47, 0xf0, 0x18, 0xc9, 0x13, 0x26, 0x07, 0xa3, 0x1d, 0x6f, 0x22,
+    0x03, 0x4e, 0xaa, 0x90, 0xc7, 0x3d, 0x2e, 0xac, 0x66, 0x78, 0xcc, 0xd0, 0x8a, 0x58, 0xf3, 0xb1,
+    0x18, 0x0e, 0x0d, 0x5a, 0x2c, 0x47, 0x06, 0x22, 0xb5, 0x12, 0x43, 0x74, 0xe7, 0x74, 0x4e, 0x8a,
+    0x48, 0x45, 0xac, 0x76, 0x5c, 0xb1, 0x59, 0x07, 0x18, 0xa1, 0x53, 0x3c, 0xe6, 0xc7, 0xa1, 0x9d,
+    0xf1, 0x08, 0x13, 0x6b, 0xc1, 0x42, 0xad, 0x9b, 0x2f, 0xe1, 0x90, 0xa7, 0x93, 0xd7, 0xf2, 0x9d,
+    0xec, 0x59, 0x80, 0x42, 0xb6, 0x00, 0xe1, 0x46, 0x75, 0x7a, 0x78, 0x00, 0xa2, 0x56, 0x8e, 0x77,
+    0x49, 0x99, 0xdb, 0x32, 0x3d, 0x67, 0x5d, 0x78, 0x09, 0x4a, 0x94, 0xfe, 0x90, 0x02, 0x00, 0x81,
+    0xe8, 0x40, 0xa6, 0xbd, 0x74, 0xc0, 0x80, 0xc0, 0x2b, 0x98, 0xc1, 0x96, 0x0e, 0x52, 0x24, 0x25,
+    0xc7, 0x50, 0xa8, 0x03, 0xd2, 0xda, 0x8b, 0x8f, 0x64, 0x71, 0x85, 0x27, 0xc5, 0x3f, 0xcc, 0x0a,
+    0x4f, 0xbc, 0x92, 0x33, 0xdc, 0x4d, 0xf3, 0x78, 0xe1, 0x76, 0x40, 0xad, 0x4c, 0x08, 0x11, 0xe5,
+    0x38, 0x7c, 0x14, 0xbb, 0x70, 0x48, 0x21, 0x56, 0xc4, 0x55, 0x93, 0x09, 0x5a, 0x16, 0xea, 0x12,
+    0xd1, 0xe5, 0xa4, 0xd6, 0x82, 0xf9, 0xec, 0xb6, 0x6e, 0xa5, 0xed, 0x95, 0xdc, 0x7b, 0x32, 0x60,
+    0x57, 0x3a, 0x97, 0xe6, 0x61, 0xfb, 0x4d, 0x7d, 0x6b, 0xc7, 0xe9, 0x61, 0x41, 0x98, 0xb4, 0x38,
+    0x86, 0xcb, 0x3b, 0x52, 0xa4, 0x97, 0x92, 0xa0, 0x72, 0x8f, 0x65, 0x9a, 0xbe, 0x43, 0x4a, 0xc4,
+    0x86, 0x9f, 0x02, 0xd1, 0x91, 0xe8, 0xc0, 0x38, 0xe0, 0x74, 0x70, 0x06, 0x23, 0x55, 0xa8, 0x56,
+    0xf0, 0x18, 0x65, 0xfc, 0x24, 0x87, 0xb8, 0xdf, 0x03, 0xc2, 0xcc, 0x82, 0x8f, 0x94, 0xe7, 0x38,
+    0x2e, 0x57, 0x5b, 0x78, 0xcc, 0xc9, 0x4f, 0x58, 0xc3, 0xa8, 0xb8, 0xe4, 0x00, 0x99, 0xd2, 0x3c,
+    0x70, 0xfc, 0xb4, 0x92, 0xdc, 0x49, 0xe7, 0xe4, 0x76, 0x80, 0x48, 0x19, 0xbd, 0xc2, 0x55, 0x9e,
+    0xbb, 0x5a, 0x16, 0xd5, 0x6a, 0x76, 0x96, 0x37, 0x3e, 0xac, 0x09, 0xd2, 0xb4, 0x6e, 0x59, 0x9e,
+    0x96, 0x1c, 0x1f, 0x8e, 0x05, 0x28, 0x33, 0xfa, 0x0f, 0xaa, 0x5a, 0xa7, 0x87, 0xe6, 0x5f, 0xd2,
+    0xa2, 0x86, 0x55, 0xef, 0x38, 0x4c, 0xc0, 0x73, 0xd2, 0x90, 0x97, 0xa0, 0x0a, 0xd6, 0x0e, 0xa9,
+    0xe0, 0x51, 0x7e, 0x8a, 0xc5, 0x20, 0xae, 0x02, 0x2f, 0x3b, 0xea, 0x80, 0x1c, 0xc3, 0x74, 0xf0,
+    0x3c, 0xd6, 0x2b, 0x2c, 0xe8, 0x99, 0x0e, 0x98, 0xd4, 0x26, 0xc7, 0xf4, 0xbe, 0x03, 0xa2, 0xba,
+    0x9d, 0x8f, 0x5c, 0x15, 0x8a, 0x27, 0x1f, 0x8f, 0xcc, 0x8a, 0x9e, 0xe3, 0x92, 0x23, 0x6c, 0x5a,
+    0xf3, 0x9c, 0x64, 0x7c, 0x40, 0x25, 0x62, 0x08, 0x51, 0x87, 0x03, 0x22, 0xe5, 0x4d, 0x17, 0x57,
+    0x71, 0xb8, 0x6e, 0x59, 0xab, 0x32, 0x44, 0xd7, 0xf9, 0xca, 0x0b, 0x46, 0xaa, 0xdd, 0xba, 0xb1,
+    0xd7, 0x5e, 0x72, 0xa0, 0xb1, 0x80, 0x9d, 0xbd, 0xc4, 0x9a, 0xa7, 0xda, 0x3e, 0xf5, 0x09, 0x64,
+    0x50, 0x8b, 0xd4, 0xd6, 0xbc, 0x63, 0xe5, 0xce, 0x29, 0x99, 0x9e, 0x04, 0x59, 0x0a, 0x9f, 0x42,
+    0xa4, 0xef, 0xcf, 0xf8, 0xe9, 0xd7, 0xea, 0xb8, 0xaa, 0xa3, 0xc5, 0xbc, 0x02, 0x40, 0x10, 0x7f,
+    0xc3, 0x3e, 0x42, 0x1a, 0x41, 0xc5, 0x29, 0x55, 0x7c, 0x14, 0xef, 0x18, 0x1e, 0x81, 0xbb, 0x49,
+    0xc6, 0x39, 0xa9, 0x12, 0x28, 0xf2, 0xb8, 0xe8, 0x99, 0xde, 0x31, 0x44, 0x9e, 0x62, 0x8d, 0x4d,
+    0x53, 0x38, 0x94, 0x75, 0xb2, 0x1c, 0xe1, 0xaa, 0xd0, 0x4a, 0xb9, 0x7d, 0x9e, 0x93, 0x40, 0xdb,
+    0x21, 0x75, 0x8e, 0x79, 0x80, 0x0d, 0x08, 0xc1, 0x63, 0x6b, 0xb5, 0xda, 0x99, 0xa6, 0xee, 0xb0,
+    0x66, 0xa4, 0x41, 0xe4, 0xdd, 0x1c, 0xb1, 0x7c, 0xbe, 0x19, 0x17, 0x20, 0x92, 0xf4, 0x3f, 0x68,
+    0xd7, 0x9c, 0x1e, 0x8a, 0xc0, 0xa3, 0x95, 0xf6, 0xc9, 0x52, 0x66, 0x85, 0x1f, 0xcf, 0x49, 0x72,
+    0x58, 0x82, 0x9a, 0x47, 0x95, 0xae, 0xd5, 0xb9, 0x8e, 0xec, 0x13, 0x3d, 0x5e, 0x4b, 0xb3, 0x17,
+    0xe6, 0x02, 0xdf, 0xaf, 0x7e, 0x83, 0xd5, 0x22, 0x1a, 0x01, 0x3f, 0x19, 0x55, 0xb0, 0x6a, 0xef,
+    0x18, 0x7d, 0xdc, 0x24, 0xc7, 0x88, 0x42, 0xa9, 0xa2, 0xe7, 0xd9, 0xb8, 0xa0, 0x84, 0xe0, 0x31,
+    0xd0, 0x1b, 0x61, 0x8d, 0xf6, 0x5e, 0x38, 0xd4, 0x1c, 0x9b, 0x1c, 0x09, 0xde, 0xd1, 0x4a, 0x49,
+    0x3d, 0x9d, 0x93, 0xed, 0xca, 0x21, 0x75, 0x1b, 0x66, 0x80, 0x5d, 0x7a, 0xc0, 0x63, 0xca, 0xf1,
+    0xd9, 0x99, 0x21, 0xb7, 0xb0, 0x86, 0x45, 0x2b, 0xe4, 0x79, 0x82, 0xb0, 0x7c, 0x69, 0x57, 0x16,
+    0xa0, 0x08, 0xb9, 0x3f, 0xf8, 0xd6, 0x9c, 0x1e, 0x6e, 0xf7, 0xa1, 0x95, 0x42, 0x5e, 0x52, 0xe6,
+    0x3f, 0xda, 0xce, 0x99, 0x66, 0x5a, 0x82, 0xbe, 0xe1, 0x3a, 0xa4, 0xcf, 0xe8, 0x8e, 0x2c, 0x28,
+    0xda, 0x5d, 0x9b, 0xa9, 0x1f, 0xe6, 0x02, 0x51, 0x5e, 0x80, 0x03, 0x51, 0x28, 0x1a, 0xd1, 0x5d,
+    0x35, 0x55, 0x6c, 0xb4, 0xf0, 0x18, 0xc5, 0x0a, 0x26, 0xc7, 0x43, 0x55, 0xa9, 0x12, 0x6f, 0xef,
+    0xb8, 0xec, 0x9c, 0xe3, 0x31, 0xec, 0xb5, 0x61, 0x8d, 0x4e, 0x66, 0x38, 0x14, 0xba, 0xb0, 0x1c,
+    0x65, 0xf0, 0xd4, 0x4a, 0xdc, 0xd1, 0x9d, 0xd3, 0xb3, 0x2b, 0x22, 0x55, 0xfe, 0x75, 0x80, 0xa1,
+    0x1f, 0xc5, 0x63, 0x2b, 0x52, 0xda, 0x59, 0x3a, 0x22, 0xb1, 0xe6, 0x7e, 0xda, 0xba, 0x45, 0x70,
+    0xb7, 0x7c, 0xc8, 0x48, 0x16, 0x60, 0x4d, 0x3a, 0x40, 0x78, 0xe4, 0x9c, 0x1e, 0xc2, 0xa5, 0xa8,
+    0x95, 0x38, 0x7d, 0x52, 0xa6, 0x3b, 0x47, 0xcf, 0x49, 0x90, 0x60, 0x82, 0x82, 0x4b, 0x3f, 0xa4,
+    0xcb, 0x31, 0x8f, 0xec, 0xce, 0x2e, 0x5e, 0x5b, 0x61, 0x2c, 0xe6, 0x02, 0x58, 0x66, 0x69, 0xc4,
+    0xd6, 0xe3, 0x54, 0xc1, 0x00, 0xc3, 0x63, 0x44, 0xf7, 0x9b, 0x1c, 0xe0, 0xae, 0xa5, 0x0a, 0xa3,
+    0xe8, 0xe3, 0x52, 0x8f, 0x8a, 0xc7, 0xa8, 0x6f, 0x8b, 0x35, 0x76, 0x05, 0x4c, 0x0e, 0x78, 0x0f,
+    0x73, 0xe4, 0x91, 0x49, 0x2b, 0x41, 0x19, 0x7d, 0x4e, 0xfd, 0x21, 0x88, 0x54, 0xea, 0x1d, 0x02,
+    0x16, 0xf6, 0x0d, 0x8f, 0x81, 0x9a, 0x6d, 0x67, 0x58, 0x6b, 0xc4, 0x5a, 0x7c, 0x87, 0xeb, 0xb6,
+    0x15, 0xd9, 0xf2, 0xc9, 0x16, 0x5c, 0x80, 0xf9, 0x27, 0x01, 0xe1, 0xcf, 0x71, 0x7a, 0x48, 0xd4,
+    0x33, 0x65, 0xd2, 0x74, 0xf5, 0x9c, 0xac, 0x0a, 0x26, 0xe8, 0xc7, 0x31, 0x44, 0x7a, 0x81, 0xf7,
+    0xc8, 0xae, 0xe7, 0xe5, 0xb5, 0x6a, 0x79, 0x62, 0x2e, 0xfd, 0x2a, 0xd3, 0x6b, 0xc7, 0x5d, 0x03,
+    0x03, 0x0e, 0x4c, 0xe8, 0x80, 0x12, 0xc1, 0x74, 0xf0, 0x7a, 0xbd, 0x2b, 0x64, 0x92, 0x92, 0x1c,
+    0xc6, 0x10, 0x0f, 0x08, 0x33, 0x0c, 0x3e, 0x02, 0x95, 0x1c, 0x9e, 0x1c, 0x45, 0x85, 0x35, 0xe7,
+    0xb3, 0x4a, 0xce, 0x88, 0x3a, 0xcd, 0xc3, 0x69, 0xd7, 0x01, 0x71, 0xe9, 0x1b, 0x52, 0x32, 0x11,
+    0x71, 0x55, 0x01, 0x73, 0x96, 0x45, 0x5e, 0x47, 0x74, 0x61, 0xe5, 0xb4, 0x6e, 0xf4, 0x2e, 0x96,
+    0xdc, 0x04, 0x19, 0x60, 0xb7, 0x88, 0x99, 0xe6, 0xc9, 0x68, 0xa7, 0x87, 0x2f, 0x1a, 0xd2, 0xa2,
+    0xa5, 0x36, 0xef, 0x78, 0x7f, 0x5a, 0x4a, 0x1a, 0x12, 0x3a, 0xa4, 0x34, 0xd3, 0xf8, 0xe9, 0x3d,
+    0x84, 0xb8, 0x9a, 0xd3, 0xb8, 0xbc, 0xce, 0xa3, 0x2c, 0xbd, 0xad, 0x7d, 0x34, 0x30, 0xf3, 0xb0,
+    0x47, 0x2c, 0x1d, 0x74, 0x20, 0x03, 0x88, 0x0d, 0xea, 0x40, 0x9c, 0xb5, 0x74, 0xb0, 0xcf, 0xd6,
+    0x2b, 0xb4, 0x0a, 0x99, 0x1c, 0xce, 0x2b, 0x0f, 0xc8, 0x9c, 0x59, 0x3e, 0xc2, 0xb6, 0x29, 0x9e,
+    0x0c, 0x86, 0x8b, 0x35, 0xc2, 0x18, 0x4b, 0x4e, 0x85, 0x77, 0xcd, 0x53, 0x82, 0xea, 0x01, 0xa1,
+    0x51, 0x1e, 0x52, 0x93, 0xc3, 0x71, 0xd5, 0x4e, 0xc8, 0x96, 0xe5, 0xf4, 0x47, 0x74, 0x71, 0xb9,
+    0x10, 0x6b, 0x35, 0x78, 0xad, 0x5b, 0xba, 0xf2, 0x25, 0xe7, 0xe1, 0x03, 0xd8, 0xe9, 0x55, 0xa7,
+    0x87, 0x4f, 0xdb, 0xd3, 0x62, 0x64, 0x2c, 0xef, 0x78, 0x46, 0x73, 0x4a, 0xf2, 0x79, 0x40, 0xa4,
+    0xa9, 0xf8, 0xf8, 0xa9, 0xc6, 0xce, 0xb8, 0xca, 0xe3, 0xc6, 0xbc, 0xba, 0xdf, 0x32, 0xbd, 0x2e,
+    0xea, 0x34, 0x70, 0x31, 0xec, 0x47, 0x5c, 0xac, 0x87, 0x20, 0x03, 0xf9, 0x0e, 0xea, 0xc0, 0x64,
+    0xe3, 0x74, 0x30, 0xc7, 0xcc, 0x2b, 0x38, 0x35, 0xf2, 0x18, 0xa0, 0x2b, 0x10, 0x08, 0x13, 0x26,
+    0x3e, 0x32, 0x50, 0x23, 0xd6, 0x54, 0xd0, 0x30, 0x39, 0xc0, 0x16, 0x35, 0x0f, 0xb8, 0xe1, 0x07,
+    0xd4, 0x5b, 0x88, 0x48, 0x35, 0x3c, 0xc5, 0x55, 0xd8, 0x9b, 0x5b, 0x16, 0x93, 0x32, 0xd1, 0x15,
+    0x6a, 0x51, 0xac, 0x99, 0x1f, 0xb5, 0x6e, 0xe8, 0x0b, 0x98, 0x5c, 0x55, 0x36, 0x60, 0x27, 0x13,
+    0x9e, 0x1e, 0xbe, 0x3d, 0x4f, 0x8b, 0xa8, 0x6f, 0xbd, 0xa3, 0xae, 0xa3, 0x29, 0xd9, 0x0a, 0x66,
+    0x82, 0xda, 0xff, 0xe7, 0xa7, 0xff, 0x69, 0xe2, 0x2a, 0x15, 0x02, 0xd3, 0x4b, 0x2e, 0x60, 0x03,
+    0xd3, 0xc1, 0x7b, 0xc4, 0xda, 0x4e, 0x09, 0xf2, 0xcb, 0x98, 0x9c, 0xad, 0xa7, 0xb1, 0x75, 0x03,
+    0x96, 0x27, 0xe9, 0xc0, 0x60, 0x5d, 0x1a, 0x91, 0x9f, 0x1a, 0x55, 0x9c, 0x9d, 0xf1, 0x18, 0x96,
+    0x3b, 0x25, 0x87, 0xaf, 0x93, 0xe3, 0x12, 0xd2, 0x81, 0xc7, 0x04, 0x79, 0x87, 0x35, 0x41, 0xde,
+    0x4a, 0xce, 0xd4, 0xaf, 0x72, 0xc4, 0xf6, 0xe5, 0x39, 0xbd, 0x2b, 0x1b, 0x52, 0x21, 0x67, 0xf0,
+    0x18, 0xe9, 0x97, 0x76, 0x66, 0x60, 0x35, 0xac, 0xc5, 0x92, 0xb6, 0x6e, 0xe3, 0xcd, 0x16, 0xe0,
+    0x94, 0xdc, 0x3f, 0x08, 0x7e, 0x9d, 0x1e, 0xba, 0xdc, 0x4b, 0x8b, 0x29, 0x45, 0x53, 0xe6, 0x46,
+    0xe0, 0xce, 0xb9, 0x35, 0x63, 0x82, 0xfe, 0x4a, 0x3c, 0xa4, 0x08, 0x2f, 0x78, 0xad, 0x82, 0x77,
+    0x98, 0xab, 0xfc, 0xbb, 0xf4, 0xbe, 0x85, 0xd2, 0xc0, 0x92, 0x30, 0x88, 0x35, 0x3b, 0x28, 0x9c,
+    0x2d, 0x0b, 0x43, 0xbc, 0x03, 0xf0, 0x40, 0xea, 0x00, 0x59, 0xbf, 0xa9, 0x42, 0x01, 0x04, 0x8f,
+    0xe1, 0x62, 0xd0, 0xe4, 0x00, 0x91, 0xf9, 0x80, 0x50, 0x66, 0xc1, 0x63, 0x20, 0x41, 0x8b, 0x35,
+    0xa2, 0x7c, 0x97, 0x1c, 0xac, 0xe0, 0xb4, 0x92, 0x77, 0x39, 0xcf, 0x49, 0xca, 0x1c, 0x22, 0x65,
+    0x03, 0x27, 0xae, 0xb2, 0x32, 0x4d, 0xac, 0x59, 0x5b, 0x6a, 0xdd, 0x7c, 0x57, 0x03, 0x84, 0x7a,
+    0xab, 0xd3, 0x43, 0xf5, 0x0b, 0xd4, 0x22, 0x19, 0xae, 0x9e, 0x93, 0xcb, 0x76, 0x09, 0x2a, 0x71,
+    0x0b, 0x22, 0xd5, 0x7f, 0x96, 0x9f, 0x9a, 0xc0, 0x64, 0x7a, 0xcd, 0x63, 0xd6, 0xc0, 0xa2, 0x7d,
+    0x3d, 0x69, 0xfc, 0x35, 0x88, 0x35, 0x61, 0x29, 0x39, 0xdb, 0x57, 0xbf, 0xd6, 0xed, 0x34, 0xd4,
+    0x95, 0x87, 0x4b, 0x72, 0xd9, 0xc3, 0x4c, 0x55, 0x17, 0xee, 0xa7, 0x4e, 0x0f, 0x01, 0xfd, 0x60,
+    0x69, 0x84, 0x69, 0xe7, 0xa8, 0xc2, 0xee, 0x16, 0x8f, 0x61, 0xd2, 0xab, 0xe4, 0xa0, 0x61, 0x88,
+    0xc7, 0x10, 0xe7, 0x0c, 0x6b, 0x2c, 0x0c, 0x2b, 0x47, 0x5a, 0xb1, 0x3c, 0x27, 0xd7, 0xeb, 0x86,
+    0x14, 0xa2, 0x4b, 0xed, 0x8c, 0xcd, 0xc9, 0xb0, 0xc6, 0x94, 0xf4, 0x1f, 0xb4, 0xdb, 0x9c, 0x1e,
+    0x3a, 0xe6, 0x99, 0x32, 0x71, 0x6e, 0xee, 0x9c, 0x1e, 0x66, 0x4c, 0x50, 0xe1, 0x2d, 0x0f, 0x29,
+    0x20, 0x25, 0x31, 0x17, 0xb3, 0xde, 0xd2, 0x0b, 0xc5, 0x93, 0x76, 0x16, 0x56, 0x83, 0x58, 0x83,
+    0xa3, 0x85, 0xb3, 0x99, 0x91, 0x11, 0xef, 0x3a, 0x05, 0x5a, 0x79, 0xb1, 0x75, 0xe9, 0xc2, 0x91,
+    0xce, 0xe9, 0x61, 0xe3, 0x45, 0x0f, 0x72, 0x29, 0xad, 0x24, 0xe9, 0x9c, 0x00, 0xa1, 0x5c, 0xed,
+    0xc7, 0x57, 0x4a, 0x35, 0x30, 0x41, 0x01, 0x67, 0x1d, 0x69, 0x84, 0x36, 0x5b, 0x1e, 0x43, 0x32,
+    0x49, 0xc9, 0x41, 0xed, 0x1a, 0x8f, 0x01, 0x4b, 0x18, 0xd6, 0x10, 0x5e, 0xef, 0x9c, 0x90, 0x51,
+    0x20, 0x52, 0x6a, 0xbd, 0xb3, 0x33, 0xfc, 0x84, 0xc4, 0x9a, 0x31, 0xba, 0xd6, 0x4d, 0x4b, 0x1d,
+    0x40, 0x48, 0x09, 0x3c, 0x3d, 0xe4, 0xf7, 0x68, 0x82, 0xb2, 0x8b, 0x77, 0x48, 0x6d, 0x90, 0x8a,
+    0xb9, 0x6e, 0xc1, 0x96, 0x5e, 0x42, 0xba, 0x87, 0xb5, 0xa5, 0xf3, 0x38, 0x9b, 0x28, 0x96, 0x2b,
+    0x2f, 0xbd, 0xe8, 0xb2, 0x17, 0x63, 0xa3, 0x2e, 0xe4, 0x0a, 0x9e, 0x1e, 0x0e, 0x9b, 0x41, 0x28,
+    0x5b, 0x80, 0xf1, 0x95, 0x4f, 0x71, 0x4c, 0x50, 0x68, 0x9e, 0x9a, 0x68, 0x03, 0x62, 0xdc, 0x95,
+    0x6b, 0x77, 0x0b, 0x7b, 0xa1, 0x82, 0xe9, 0x2d, 0xc7, 0x08, 0xfc, 0xca, 0xda, 0x4f, 0x93, 0x01,
+    0x1a, 0x99, 0x3c, 0x06, 0x10, 0x77, 0x92, 0x03, 0xf5, 0x26, 0x1e, 0x43, 0x99, 0x2e, 0xac, 0xb1,
+    0x16, 0xdb, 0x39, 0x21, 0x6f, 0x3f, 0xa4, 0xf8, 0x5a, 0x11, 0x6b, 0x3a, 0x94, 0x5a, 0x37, 0x1b,
+    0x14, 0x00, 0xa1, 0xe3, 0xf0, 0xf4, 0x50, 0x2b, 0x9b, 0x09, 0x0a, 0x2c, 0xd8, 0x21, 0x05, 0xf6,
+    0xb4, 0xf4, 0x02, 0xef, 0x3b, 0xac, 0xd5, 0x11, 0xc7, 0xd9, 0x6c, 0x48, 0x5c, 0x79, 0xe7, 0x1f,
+    0x97, 0xbd, 0xb9, 0xe1, 0xe9, 0xe1, 0xa5, 0x0f, 0x84, 0x92, 0xda, 0x12, 0x5f, 0x19, 0x88, 0x52,
+    0x13, 0xe5, 0x4d, 0x8a, 0xbb, 0xc2, 0x6f, 0x6e, 0x61, 0x15, 0xdf, 0x2f, 0xbd, 0x6f, 0xf7, 0x80,
+    0xdf, 0x41, 0xd2, 0xde, 0xb2, 0xb9, 0x83, 0xfe, 0x9a, 0xc8, 0x4d, 0x9c, 0xdd, 0x09, 0xf0, 0x31,
+    0xa7, 0xae, 0xd8, 0xca, 0x53, 0xce, 0x15, 0xe9, 0x01, 0xfc, 0x17, 0xe9, 0x00, 0x3c, 0xcc, 0x25,
+    0x07, 0x67, 0x25, 0x62, 0x0d, 0x77, 0x8e, 0x4a, 0x0e, 0x14, 0x1e, 0x87, 0x14, 0x39, 0x29, 0xc3,
+    0x1a, 0xd5, 0x92, 0xad, 0x1b, 0x3c, 0xc7, 0xe9, 0x21, 0xe7, 0xf2, 0xd2, 0x22, 0x20, 0xab, 0x0f,
+    0x29, 0x15, 0xf3, 0x4b, 0x2f, 0x1c, 0x69, 0x34, 0x30, 0x2f, 0xf3, 0x70, 0x36, 0x40, 0x6a, 0x97,
+    0x3d, 0x99, 0x8c, 0xd3, 0x43, 0x45, 0xcf, 0xbc, 0x44, 0xde, 0x88, 0xf9, 0x4a, 0x4b, 0xc0, 0x35,
+    0x51, 0xb7, 0x44, 0x1e, 0x52, 0x73, 0xc6, 0x5a, 0x58, 0x02, 0x41, 0x81, 0x5f, 0x4e, 0x50, 0xbd,
+    0x65, 0x29, 0xad, 0xa6, 0x66, 0xb1, 0x64, 0xe3, 0x6c, 0x97, 0x8c, 0x1f, 0x73, 0x4a, 0x21, 0x08,
+    0x74, 0x58, 0x98, 0x44, 0x7a, 0x94, 0x16, 0x6b, 0x81, 0xc6, 0x12, 0xa7, 0x87, 0x60, 0x8c, 0x90,
+    0x88, 0x21, 0x3f, 0xcd, 0x8e, 0xf3, 0xa4, 0xe8, 0x00, 0xae, 0x0f, 0x25, 0x07, 0x01, 0x92, 0x4b,
+    0x0e, 0x60, 0x7b, 0x87, 0x14, 0x76, 0x13, 0x71, 0x15, 0x32, 0xbe, 0xad, 0x1b, 0xfe, 0x81, 0xd2,
+    0x22, 0x09, 0xdf, 0x0e, 0x29, 0x6e, 0x64, 0x35, 0x30, 0x7c, 0xf4, 0x5a, 0x37, 0xcc, 0x94, 0x97,
+    0x3d, 0x86, 0x5e, 0xbc, 0x44, 0x4f, 0xad, 0xf8, 0x4a, 0x33, 0x35, 0x1f, 0x52, 0xc7, 0xd5, 0x44,
+    0x59, 0x1c, 0x69, 0x81, 0x5f, 0x82, 0x3a, 0xa6, 0x66, 0xc4, 0x7a, 0xe2, 0x6c, 0xc8, 0x03, 0x09,
+    0x74, 0x6a, 0xb7, 0x2e, 0x7b, 0xfc, 0x3b, 0x6b, 0x81, 0x67, 0x15, 0x90, 0x88, 0xd5, 0x47, 0xcc,
+    0x8e, 0xa8, 0xd0, 0xf2, 0x95, 0x61, 0x98, 0x18, 0x9d, 0xbe, 0x0c, 0x55, 0xa3, 0x57, 0xef, 0x79,
+    0xaa, 0xe6, 0x9a, 0xdc, 0xb7, 0x2c, 0x79, 0x02, 0xbf, 0x6f, 0xdc, 0x3e, 0xc5, 0xc5, 0xc7, 0x63,
+    0xcc, 0x1c, 0xf5, 0x25, 0x07, 0xce, 0x8d, 0xc4, 0x1a, 0xa0, 0xec, 0x1c, 0x52, 0x98, 0x33, 0x4e,
+    0x0f, 0xa1, 0x3a, 0xfd, 0x90, 0x82, 0x12, 0x22, 0xce, 0xc6, 0x1a, 0x6c, 0xbe, 0x12, 0x58, 0x72,
+    0x2d, 0x2c, 0xcf, 0x8b, 0xe3, 0x6c, 0xfc, 0x6d, 0x89, 0xf4, 0xb0, 0x94, 0x35, 0x3b, 0xd2, 0x41,
+    0x74, 0xe1, 0x04, 0xca, 0x73, 0x0b, 0x6b, 0x41, 0x22, 0x54, 0x1a, 0x6d, 0xb9, 0x22, 0x3d, 0xac,
+    0x5b, 0x3a, 0x8b
+};
+
+#endif /* ECLIPSE_TIMES_MODERN_COMPACT_H */
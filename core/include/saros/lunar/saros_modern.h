@@ -1,7 +1,7 @@
 /*
  * Auto-generated by build_db.py — DO NOT EDIT
  *
- * Saros series index records (174 bytes each).
+ * Saros series index records (194 bytes each).
  * Saros range : 110–173
  * Eclipses    : 4657
  * Flash usage : 12,416 bytes (12.1 KB)
@@ -32,15 +32,19 @@
 #  define ECLIPSE_ATTR           /* nothing */
 #endif
 
+#ifndef ECLIPSE_CONST
+#  define ECLIPSE_CONST          const   /* constexpr under SarosCatalog.h */
+#endif
+
 #define ECLIPSE_MODERN_COUNT       4657u
 #define ECLIPSE_MODERN_SAROS_FIRST 110u
 #define ECLIPSE_MODERN_SAROS_LAST  173u
 #define ECLIPSE_MODERN_SAROS_COUNT 64u
 
-/* saros_modern[] — 174-byte records, indexed by (saros_number - 110).
- * Layout: [0] uint8 count, [1] uint8 _pad, [2..173] uint16 indices[86]
+/* saros_modern[] — 194-byte records, indexed by (saros_number - 110).
+ * Layout: [0] uint8 count, [1] uint8 _pad, [2..193] uint16 indices[96]
  * Size: 12,416 bytes */
-static const uint8_t saros_modern[12416u] ECLIPSE_ATTR = {
+static ECLIPSE_CONST uint8_t saros_modern[12416u] ECLIPSE_ATTR = {
     0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00,
     0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2e, 0x00,
     0x37, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x63, 0x00, 0x71, 0x00, 0x7f, 0x00, 0x8d, 0x00,
@@ -32,6 +32,10 @@
 #  define ECLIPSE_ATTR           /* nothing */
 #endif
 
+#ifndef ECLIPSE_CONST
+#  define ECLIPSE_CONST          const   /* constexpr under SarosCatalog.h */
+#endif
+
 #define ECLIPSE_MODERN_COUNT       4612u
 #define ECLIPSE_MODERN_SAROS_FIRST 110u
 #define ECLIPSE_MODERN_SAROS_LAST  173u
@@ -46,7 +50,7 @@
  *   [8]   uint8   ecl_type  (solar_eclipse_type_t enum)
  *   [9]   uint8   sun_alt
  * Size: 46,120 bytes */
-static const uint8_t eclipse_info_modern[46120u] ECLIPSE_ATTR = {
+static ECLIPSE_CONST uint8_t eclipse_info_modern[46120u] ECLIPSE_ATTR = {
     0x9a, 0xfd, 0x00, 0xfe, 0xff, 0xff, 0x6e, 0x00, 0x0b, 0x00, 0x9d, 0xfd, 0xf9, 0xf8, 0xff, 0xff,
     0x6e, 0x01, 0x0a, 0x00, 0x9e, 0xfd, 0xf2, 0x01, 0xff, 0xff, 0x6e, 0x02, 0x0a, 0x00, 0x9e, 0xfd,
     0xc7, 0xfc, 0xff, 0xff, 0x6e, 0x03, 0x0a, 0x00, 0xca, 0x02, 0xaf, 0x00, 0xff, 0xff, 0x6f, 0x00,
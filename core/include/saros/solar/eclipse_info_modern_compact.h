@@ -0,0 +1,2147 @@
+/*
+ * Auto-generated by build_compact_db.py — DO NOT EDIT
+ *
+ * Bit-packed solar eclipse_info_t records (58 bits each).
+ * Saros range : 110–173
+ * Eclipses    : 4612
+ * Flash usage : 33,437 bytes (32.7 KB)
+ *
+ * Usage: #define SAROS_USE_COMPACT in the solar implementation unit, which
+ * then includes this header instead of the raw one.  ECLIPSE_USE_PROGMEM
+ * works as for the raw headers.
+ */
+
+#ifndef ECLIPSE_INFO_MODERN_COMPACT_H
+#define ECLIPSE_INFO_MODERN_COMPACT_H
+
+#include <stdint.h>
+
+#ifdef ECLIPSE_USE_PROGMEM
+#  include <avr/pgmspace.h>
+#  define ECLIPSE_READ_BYTE(p)   pgm_read_byte(p)
+#  define ECLIPSE_READ_WORD(p)   pgm_read_word(p)
+#  define ECLIPSE_READ_DWORD(p)  pgm_read_dword(p)
+#  define ECLIPSE_ATTR           PROGMEM
+#else
+#  define ECLIPSE_READ_BYTE(p)   (*(const uint8_t  *)(p))
+#  define ECLIPSE_READ_WORD(p)   (*(const uint16_t *)(p))
+#  define ECLIPSE_READ_DWORD(p)  (*(const uint32_t *)(p))
+#  define ECLIPSE_ATTR           /* nothing */
+#endif
+
+#define ECLIPSE_MODERN_COUNT       4612u
+#define ECLIPSE_MODERN_SAROS_FIRST 110u
+#define ECLIPSE_MODERN_SAROS_LAST  173u
+#define ECLIPSE_MODERN_INFO_BITS     58u
+#define ECLIPSE_MODERN_INFO_NULLABLE 0x04u
+
+/* Field layout, in the order of the raw 10-byte record:
+ *   latitude_deg10     bias   -880  width 11
+ *   longitude_deg10    bias  -1799  width 12
+ *   central_duration_s bias      0  width 10  (0 = n/a)
+ *   saros_number       bias    110  width  6
+ *   saros_pos          bias      0  width  7
+ *   ecl_type           bias      0  width  5
+ *   sun_alt            bias      0  width  7
+ * A field decodes to bias + stored value; for nullable fields stored 0 is
+ * 0xFFFF and bias + stored - 1 otherwise.  Read on every decode, so these
+ * two stay in RAM. */
+static const int32_t eclipse_info_modern_bias[7] = { -880, -1799, 0, 110, 0, 0, 0 };
+static const uint8_t eclipse_info_modern_width[7] = { 11, 12, 10, 6, 7, 5, 7 };
+
+/* eclipse_info_modern_packed[] — 58-bit records, LSB-first, same order as the times.
+ * Size: 33,437 bytes */
+static const uint8_t eclipse_info_modern_packed[33437u] ECLIPSE_ATTR = {
+    0x0a, 0x39, 0x28, 0x00, 0x00, 0xc0, 0x02, 0x34, 0x04, 0x00, 0x00, 0x00, 0x02, 0x0a, 0xe0, 0x90,
+    0x7c, 0x04, 0x00, 0x10, 0x28, 0x80, 0x43, 0x9c, 0x07, 0x00, 0x60, 0xa0, 0x00, 0x3a, 0xb6, 0x3d,
+    0x00, 0x02, 0xc0, 0x02, 0x2c, 0x44, 0x94, 0x01, 0x00, 0x08, 0x0a, 0xe0, 0x0f, 0xeb, 0x05, 0x40,
+    0x00, 0x2c, 0x80, 0x8f, 0xf3, 0x05, 0x80, 0x20, 0xa0, 0x00, 0x08, 0xc1, 0x3a, 0x00, 0x80, 0x82,
+    0x02, 0x10, 0x04, 0xe2, 0x00, 0x10, 0x02, 0x0a, 0x00, 0xe4, 0x18, 0x06, 0x20, 0x10, 0x28, 0x80,
+    0x40, 0xfc, 0x03, 0x00, 0xc0, 0xa0, 0x00, 0x09, 0xb1, 0x11, 0x00, 0x04, 0x81, 0x02, 0xf8, 0x78,
+    0xe8, 0x00, 0x08, 0x06, 0x0a, 0xe0, 0x61, 0x36, 0x03, 0x60, 0x00, 0x2c, 0xc0, 0x3e, 0x50, 0x15,
+    0x00, 0xe0, 0xa0, 0x00, 0x0d, 0xc9, 0x5a, 0x00, 0x84, 0x81, 0x02, 0xec, 0xd8, 0x47, 0x00, 0x08,
+    0x08, 0x0a, 0x70, 0x62, 0xc4, 0x00, 0x60, 0x08, 0x28, 0xc0, 0x3c, 0x6e, 0x0a, 0x00, 0x00, 0xa1,
+    0x00, 0x0f, 0xa1, 0x32, 0x00, 0x04, 0x82, 0x02, 0xd0, 0x58, 0x67, 0x01, 0x08, 0x0a, 0x0a, 0xf0,
+    0xe2, 0x51, 0x05, 0x60, 0x10, 0x28, 0x80, 0x3a, 0xa4, 0x1b, 0x00, 0x20, 0xa1, 0x00, 0x10, 0xc1,
+    0x09, 0x00, 0x84, 0x82, 0x02, 0xb0, 0x98, 0xc3, 0x00, 0x08, 0x0c, 0x0a, 0x60, 0xe3, 0xcb, 0x02,
+    0x60, 0x18, 0x28, 0x00, 0x38, 0xb2, 0x10, 0x00, 0x40, 0xa1, 0x00, 0x0f, 0xa1, 0x50, 0x00, 0x04,
+    0x83, 0x02, 0xe4, 0xc3, 0xef, 0x00, 0x20, 0x00, 0x0b, 0x30, 0xe2, 0x79, 0x00, 0x20, 0x38, 0x28,
+    0xc0, 0x8e, 0xf1, 0x00, 0x80, 0x81, 0xa0, 0x00, 0xd5, 0x08, 0x17, 0x00, 0x80, 0x85, 0x02, 0x10,
+    0x18, 0x9b, 0x01, 0x28, 0x00, 0x0b, 0xc0, 0x90, 0x66, 0x02, 0x40, 0x38, 0x28, 0x00, 0x40, 0x74,
+    0x06, 0x00, 0x22, 0xa0, 0x00, 0x18, 0xbe, 0x4e, 0x00, 0x02, 0x84, 0x02, 0xf8, 0x58, 0x2a, 0x01,
+    0x18, 0x0a, 0x0a, 0xb0, 0x0c, 0xbf, 0x05, 0x00, 0x60, 0x28, 0x80, 0x83, 0x63, 0x10, 0x80, 0x22,
+    0xa0, 0x00, 0x07, 0x01, 0x6c, 0x00, 0x04, 0x84, 0x02, 0x1c, 0xe4, 0x9e, 0x01, 0x20, 0x04, 0x0a,
+    0xd0, 0xe0, 0x54, 0x02, 0x20, 0x48, 0x28, 0x80, 0x8f, 0x13, 0x08, 0x80, 0xc1, 0xa0, 0x00, 0xc1,
+    0x98, 0x30, 0x00, 0x80, 0x86, 0x02, 0x60, 0xb8, 0x6f, 0x00, 0x28, 0x04, 0x0a, 0x10, 0x90, 0x08,
+    0x04, 0x40, 0x48, 0x28, 0xc0, 0x42, 0x28, 0x11, 0x00, 0x62, 0xa0, 0x00, 0x02, 0x96, 0x6c, 0x00,
+    0x02, 0x85, 0x02, 0xf0, 0xb8, 0x97, 0x01, 0x18, 0x0e, 0x0a, 0x70, 0x8b, 0x58, 0x00, 0x00, 0x70,
+    0x28, 0x40, 0x88, 0x87, 0x19, 0x80, 0x62, 0xa0, 0x00, 0xfa, 0xa8, 0x14, 0x00, 0x04, 0x85, 0x02,
+    0x3c, 0x44, 0x83, 0x00, 0x20, 0x08, 0x0a, 0x80, 0x5f, 0x37, 0x04, 0x20, 0x58, 0x28, 0x80, 0x38,
+    0x70, 0x01, 0x00, 0x03, 0xb0, 0x00, 0x38, 0xae, 0x3a, 0x00, 0x06, 0x84, 0x02, 0xbc, 0x02, 0x2e,
+    0x01, 0x00, 0x1e, 0x0a, 0xb0, 0xe2, 0xf2, 0x03, 0xa0, 0x20, 0x28, 0x40, 0x3c, 0x36, 0x16, 0x00,
+    0x61, 0xa1, 0x00, 0x10, 0xd1, 0x6c, 0x00, 0x88, 0x82, 0x02, 0xb8, 0xf7, 0x6a, 0x00, 0x08, 0x18,
+    0x0a, 0xb0, 0x8e, 0x0a, 0x05, 0xc0, 0x08, 0x28, 0x40, 0x8c, 0xc9, 0x03, 0x80, 0x21, 0xa1, 0x00,
+    0xa8, 0x80, 0x21, 0x00, 0x00, 0x88, 0x02, 0xcc, 0x78, 0x5d, 0x00, 0x28, 0x0a, 0x0a, 0x80, 0x8e,
+    0xc4, 0x02, 0x40, 0x60, 0x28, 0x00, 0x44, 0xe4, 0x11, 0x00, 0xc2, 0xa0, 0x00, 0xe6, 0xed, 0x62,
+    0x00, 0x82, 0x86, 0x02, 0xcc, 0xe3, 0xab, 0x00, 0x30, 0x04, 0x0a, 0x80, 0x62, 0x3e, 0x05, 0x60,
+    0x50, 0x28, 0xc0, 0x28, 0x26, 0x1a, 0x00, 0x20, 0xa2, 0x00, 0x39, 0x4e, 0x5f, 0x00, 0x0a, 0x83,
+    0x02, 0x74, 0x03, 0xc0, 0x01, 0x10, 0x1a, 0x0a, 0xf0, 0x10, 0x1b, 0x02, 0x80, 0x38, 0x28, 0x80,
+    0x77, 0xcd, 0x0e, 0x80, 0xc0, 0xa1, 0x00, 0xfb, 0x30, 0x05, 0x00, 0x8c, 0x81, 0x02, 0x7c, 0xf8,
+    0x9f, 0x00, 0x18, 0x16, 0x0a, 0x10, 0x0a, 0xfd, 0x03, 0x00, 0x90, 0x28, 0x80, 0x8f, 0x77, 0x0d,
+    0x80, 0xe2, 0xa0, 0x00, 0xd2, 0x48, 0x43, 0x00, 0x04, 0x87, 0x02, 0x20, 0x58, 0x7c, 0x00, 0x38,
+    0x00, 0x0b, 0xb0, 0x10, 0xb8, 0x06, 0x80, 0x40, 0x28, 0x00, 0x76, 0xff, 0x04, 0x80, 0xe0, 0xa1,
+    0x00, 0x02, 0x99, 0x4f, 0x00, 0x0c, 0x82, 0x02, 0x50, 0xb8, 0xb2, 0x01, 0x18, 0x18, 0x0a, 0x70,
+    0x0c, 0x80, 0x03, 0x00, 0x01, 0x2c, 0x40, 0x28, 0xfe, 0x05, 0x00, 0x60, 0xa2, 0x00, 0x40, 0xa6,
+    0x0b, 0x00, 0x0a, 0x84, 0x02, 0x20, 0xe3, 0x59, 0x00, 0x10, 0x1e, 0x0a, 0x20, 0xe1, 0xe1, 0x06,
+    0xe0, 0x08, 0x28, 0x80, 0x41, 0x0e, 0x11, 0x00, 0x22, 0xa1, 0x00, 0xd4, 0xed, 0x5d, 0x00, 0x02,
+    0x88, 0x02, 0x1c, 0x24, 0xa5, 0x00, 0x30, 0x0a, 0x0a, 0x90, 0x60, 0x0f, 0x04, 0x60, 0x68, 0x28,
+    0x40, 0x34, 0xb0, 0x04, 0x00, 0x24, 0xa0, 0x00, 0xa4, 0x58, 0x61, 0x00, 0x00, 0x8a, 0x02, 0xfc,
+    0xb8, 0x44, 0x01, 0x28, 0x12, 0x0a, 0xd0, 0x0b, 0xa6, 0x05, 0x40, 0x80, 0x28, 0x00, 0x87, 0x0f,
+    0x13, 0x80, 0x43, 0xa0, 0x00, 0x00, 0x59, 0x1c, 0x00, 0x08, 0x85, 0x02, 0x44, 0x17, 0xe0, 0x00,
+    0x08, 0x22, 0x0a, 0xb0, 0x90, 0x27, 0x00, 0xc0, 0x30, 0x28, 0xc0, 0x7f, 0x5f, 0x05, 0x80, 0xc1,
+    0xa1, 0x00, 0xdb, 0x18, 0x5e, 0x00, 0x10, 0x81, 0x02, 0xa4, 0x82, 0xec, 0x00, 0x00, 0x2a, 0x0a,
+    0xc0, 0x5f, 0xde, 0xd9, 0xa2, 0x50, 0xb4, 0x05, 0x2d, 0x7c, 0x0b, 0x00, 0x21, 0xa2, 0x00, 0x25,
+    0xce, 0x29, 0x00, 0x8e, 0x81, 0x02, 0xe0, 0xc3, 0x91, 0x01, 0x20, 0x16, 0x0a, 0x80, 0x5e, 0xce,
+    0x00, 0x20, 0x01, 0x2c, 0x00, 0x74, 0xaf, 0x04, 0x80, 0x40, 0xa2, 0x00, 0x0e, 0xb1, 0x4b, 0x00,
+    0x8c, 0x83, 0x02, 0xd4, 0x17, 0x6b, 0x01, 0x18, 0x1e, 0x0a, 0x50, 0x0e, 0x90, 0x03, 0x00, 0x19,
+    0x28, 0xc0, 0x2b, 0x68, 0x05, 0x00, 0xc0, 0xa2, 0x00, 0xb9, 0x1d, 0xe2, 0x33, 0x8a, 0x45, 0x83,
+    0xb0, 0x82, 0x07, 0x00, 0x10, 0x24, 0x0a, 0xe0, 0xe2, 0x6a, 0x00, 0xe0, 0x20, 0x28, 0xc0, 0x3b,
+    0xe4, 0x0e, 0x00, 0x82, 0xa1, 0x00, 0xf0, 0xc5, 0x57, 0x00, 0x92, 0x80, 0x02, 0x40, 0xf7, 0x79,
+    0x01, 0x08, 0x26, 0x0a, 0xf0, 0x10, 0x3f, 0x02, 0xc0, 0x40, 0x28, 0x00, 0x7b, 0x09, 0x0c, 0x80,
+    0x01, 0xa2, 0x00, 0xee, 0xa8, 0x13, 0x00, 0x10, 0x82, 0x02, 0xbc, 0x44, 0x77, 0x2b, 0x01, 0x2e,
+    0xa0, 0x71, 0x58, 0x71, 0x7b, 0xa3, 0x60, 0xb4, 0x89, 0x29, 0xa6, 0x11, 0x00, 0x61, 0xa2, 0x00,
+    0x36, 0x36, 0x53, 0x00, 0x8e, 0x82, 0x02, 0x90, 0xc3, 0x49, 0x00, 0x20, 0x1a, 0x0a, 0x80, 0x5f,
+    0x26, 0x03, 0x20, 0x11, 0x28, 0x80, 0x74, 0x99, 0x0e, 0x80, 0x80, 0xa2, 0x00, 0x0e, 0x21, 0x6c,
+    0x00, 0x8c, 0x84, 0x02, 0x90, 0xb7, 0x17, 0x00, 0x18, 0x22, 0x0a, 0x60, 0x8f, 0xe9, 0x05, 0x00,
+    0x29, 0x28, 0xc0, 0x6e, 0x8e, 0x8e, 0x14, 0x00, 0x03, 0x34, 0x5f, 0x3d, 0x0c, 0x3b, 0x8a, 0x46,
+    0xab, 0x88, 0x22, 0x6d, 0x00, 0x10, 0x28, 0x0a, 0xc0, 0xe3, 0xe7, 0x02, 0xe0, 0x30, 0x28, 0x80,
+    0x36, 0x68, 0x16, 0x00, 0xc2, 0xa1, 0x00, 0x02, 0xfe, 0x0c, 0x00, 0x92, 0x81, 0x02, 0xbc, 0x57,
+    0x88, 0x72, 0x09, 0x2a, 0x20, 0xd2, 0x0f, 0x92, 0x84, 0xc1, 0x50, 0x80, 0x44, 0x77, 0x3d, 0x13,
+    0x80, 0x41, 0xa2, 0x00, 0xfe, 0x98, 0x38, 0x00, 0x10, 0x83, 0x02, 0x90, 0x08, 0x63, 0x6a, 0x01,
+    0x32, 0x60, 0x14, 0xd4, 0x1c, 0xed, 0xa3, 0x70, 0x34, 0x0b, 0x31, 0x6e, 0xd5, 0x15, 0xa1, 0xd2,
+    0x1a, 0x40, 0xd6, 0x08, 0x00, 0x8e, 0x83, 0x02, 0x3c, 0x03, 0xc1, 0x00, 0x20, 0x1e, 0x0a, 0xb0,
+    0xe0, 0x80, 0x05, 0x20, 0x21, 0x28, 0x80, 0x7c, 0xd5, 0x21, 0x94, 0xc0, 0x02, 0x38, 0xe7, 0x48,
+    0x23, 0x20, 0x8c, 0x05, 0x70, 0x5c, 0x57, 0x90, 0x00, 0x18, 0x26, 0x0a, 0x40, 0x90, 0x23, 0x01,
+    0x00, 0x39, 0x28, 0x40, 0x9e, 0x26, 0x1a, 0x19, 0x40, 0x03, 0x54, 0x2b, 0xc5, 0x26, 0x42, 0x8a,
+    0x47, 0xbb, 0x2c, 0x43, 0x86, 0x01, 0x50, 0x00, 0x0b, 0xe0, 0x11, 0x91, 0xd2, 0x46, 0xb0, 0xb4,
+    0x4a, 0x8b, 0x9f, 0x12, 0xad, 0x03, 0x41, 0x12, 0xc4, 0xd8, 0x06, 0x00, 0x08, 0x88, 0x02, 0x54,
+    0xd8, 0xc9, 0x00, 0x48, 0x0a, 0x0a, 0x00, 0xdf, 0xbe, 0x55, 0x24, 0xb8, 0x00, 0x92, 0x32, 0x14,
+    0x1b, 0x0a, 0x83, 0x01, 0x22, 0xdc, 0xe5, 0x19, 0x00, 0x16, 0xc0, 0x02, 0x50, 0x77, 0xb2, 0x01,
+    0x18, 0x28, 0x0a, 0xf0, 0x16, 0x3b, 0xb6, 0x04, 0x41, 0xb4, 0x48, 0xb0, 0x28, 0xb2, 0x1b, 0x60,
+    0x03, 0x62, 0x1d, 0x25, 0x6c, 0x46, 0x0a, 0x48, 0xc3, 0x54, 0x43, 0x00, 0x01, 0x50, 0x02, 0x0a,
+    0x90, 0x17, 0x05, 0x28, 0x48, 0xb8, 0x34, 0x8e, 0x75, 0xcd, 0x07, 0xb3, 0x23, 0x01, 0x24, 0xb9,
+    0x30, 0x4e, 0x00, 0x88, 0x88, 0x02, 0x7c, 0x38, 0x32, 0x00, 0x48, 0x0c, 0x0a, 0x40, 0x5e, 0x01,
+    0x9c, 0x23, 0xc0, 0x80, 0xd5, 0x29, 0xda, 0x10, 0x0c, 0xa3, 0x01, 0x24, 0xe2, 0x1d, 0x65, 0x00,
+    0x96, 0x80, 0x02, 0x44, 0x37, 0x15, 0x01, 0x18, 0x2a, 0x0a, 0x90, 0x99, 0xff, 0x13, 0x05, 0x49,
+    0x34, 0xcd, 0xbe, 0x3a, 0x4a, 0x1e, 0x80, 0x03, 0x6e, 0x12, 0x15, 0xc1, 0x4a, 0x8a, 0x48, 0xc3,
+    0x7c, 0xa3, 0x7b, 0x00, 0x50, 0x04, 0x0a, 0x20, 0x9d, 0x9c, 0x8c, 0x49, 0xc0, 0x34, 0x11, 0x63,
+    0x2f, 0x9a, 0xb8, 0x43, 0x01, 0x30, 0xb0, 0x28, 0x25, 0x00, 0x08, 0x89, 0x00, 0xa0, 0xf8, 0x5a,
+    0x01, 0x48, 0x0e, 0x0a, 0xd0, 0x5c, 0x3a, 0xfa, 0x22, 0xc8, 0x00, 0x99, 0x20, 0x5e, 0xc6, 0x0d,
+    0xc3, 0x01, 0x26, 0xe9, 0xfd, 0x3f, 0x00, 0x16, 0x81, 0x02, 0x44, 0x97, 0x7b, 0x00, 0x18, 0x2c,
+    0x0a, 0x70, 0x9a, 0xae, 0x29, 0x05, 0x51, 0xb4, 0xcf, 0x42, 0x9c, 0x0c, 0x00, 0x09, 0xb0, 0x00,
+    0x2a, 0x6b, 0x89, 0x83, 0x80, 0x0e, 0xe0, 0x31, 0xd4, 0x58, 0x3c, 0x29, 0x24, 0x2d, 0x83, 0x8e,
+    0xe3, 0x06, 0x40, 0x19, 0x28, 0x80, 0x89, 0xf6, 0x48, 0x2b, 0x21, 0xd3, 0x50, 0x4f, 0x55, 0x42,
+    0xf5, 0x8e, 0x05, 0xd8, 0xb0, 0xc2, 0x4e, 0x01, 0x60, 0x00, 0x0b, 0xb0, 0xe3, 0x11, 0x04, 0x20,
+    0x02, 0x2c, 0x40, 0x22, 0xdc, 0x59, 0x22, 0x62, 0x52, 0x0c, 0x31, 0xde, 0x2f, 0x00, 0x12, 0x84,
+    0x03, 0xa0, 0xb6, 0x1a, 0x98, 0x08, 0x34, 0x00, 0xd7, 0x05, 0xec, 0xdd, 0xc3, 0x78, 0x80, 0x89,
+    0x7c, 0xbd, 0x06, 0x80, 0x65, 0xa0, 0x00, 0xd3, 0x9d, 0x80, 0x49, 0x86, 0x0b, 0x58, 0x8c, 0x06,
+    0x96, 0x49, 0x41, 0x16, 0x8d, 0xd4, 0x90, 0x9d, 0x00, 0x40, 0x0a, 0x28, 0xc0, 0xd2, 0x9e, 0x76,
+    0x23, 0xc0, 0x03, 0x82, 0x07, 0x35, 0xdc, 0x54, 0x8a, 0x49, 0xd3, 0xc4, 0x03, 0x34, 0x01, 0x50,
+    0x08, 0x0a, 0x50, 0x27, 0xf3, 0xfe, 0x4b, 0xd0, 0x34, 0x97, 0x47, 0xf5, 0x86, 0xc1, 0x83, 0x01,
+    0x3a, 0xb3, 0x28, 0x2c, 0x00, 0x98, 0x80, 0x02, 0xd4, 0x98, 0x5b, 0x00, 0x88, 0x02, 0x0a, 0x30,
+    0x0a, 0x48, 0x8b, 0x88, 0xa0, 0x00, 0x88, 0x92, 0x47, 0x39, 0x84, 0x24, 0xd1, 0x26, 0x78, 0x25,
+    0x59, 0x1d, 0x82, 0x0d, 0xe8, 0xdd, 0x80, 0xc8, 0x0e, 0x31, 0x20, 0x60, 0xb2, 0xdf, 0x64, 0x06,
+    0x60, 0x21, 0x28, 0x80, 0x73, 0xe1, 0x14, 0x92, 0x01, 0x03, 0x2c, 0x92, 0xc1, 0xbe, 0x50, 0x10,
+    0x46, 0x3b, 0x39, 0x24, 0x45, 0x01, 0x90, 0x04, 0x0a, 0x10, 0xb6, 0xad, 0x83, 0x09, 0xf8, 0x00,
+    0x63, 0x41, 0x85, 0xac, 0x96, 0x82, 0xd2, 0x36, 0xfa, 0x88, 0x2b, 0x00, 0x94, 0x82, 0x02, 0xf8,
+    0x8a, 0x2a, 0x3b, 0x13, 0x36, 0x6d, 0x66, 0xcf, 0x59, 0x2e, 0xf1, 0x68, 0x80, 0xcf, 0x2e, 0x4c,
+    0x01, 0x00, 0x46, 0xa0, 0x00, 0x2d, 0xb6, 0x5c, 0x00, 0x22, 0x81, 0x02, 0xbc, 0x63, 0x28, 0x14,
+    0x22, 0x2a, 0xe0, 0x82, 0x5f, 0xa4, 0x9b, 0x20, 0x51, 0x18, 0x8d, 0x4f, 0x97, 0x2e, 0x85, 0x80,
+    0x03, 0x86, 0x18, 0x18, 0x80, 0x48, 0x8c, 0x08, 0x98, 0x10, 0x18, 0x04, 0x01, 0x58, 0x0a, 0x0a,
+    0xf0, 0x5c, 0x52, 0x73, 0x64, 0xc8, 0x00, 0x4f, 0x5e, 0xde, 0xa5, 0x13, 0xa4, 0xd1, 0x52, 0x0c,
+    0x89, 0x27, 0x00, 0xa4, 0x81, 0x02, 0xb0, 0xcd, 0x6b, 0x8a, 0x02, 0x40, 0x40, 0x49, 0xd0, 0x8b,
+    0x10, 0xa6, 0xa8, 0xb4, 0x4e, 0x40, 0x70, 0x02, 0x00, 0xc5, 0xa0, 0x00, 0x01, 0xab, 0xa6, 0xd8,
+    0x04, 0x4e, 0xc3, 0x61, 0x53, 0xfa, 0x6a, 0x3c, 0x1c, 0x00, 0x54, 0x0c, 0xf7, 0x04, 0x80, 0x19,
+    0x28, 0xc0, 0x88, 0x6b, 0x0c, 0x80, 0x68, 0xa0, 0x00, 0x44, 0xf1, 0x53, 0x7f, 0x08, 0x0b, 0xe8,
+    0xa0, 0x16, 0x4b, 0x06, 0x48, 0x16, 0xe0, 0x13, 0x0a, 0x72, 0x04, 0xc0, 0x01, 0x2c, 0xc0, 0x3f,
+    0xa1, 0x66, 0x83, 0xa0, 0x03, 0x90, 0x11, 0xc8, 0x33, 0x4d, 0x0c, 0x09, 0xa0, 0x38, 0xd8, 0x6d,
+    0x00, 0x58, 0x0c, 0x0a, 0x00, 0xdd, 0x75, 0x79, 0x64, 0xd0, 0x80, 0x92, 0x56, 0x10, 0x38, 0x13,
+    0xc4, 0xd1, 0x56, 0x0a, 0xc1, 0x6d, 0x00, 0x24, 0x82, 0x02, 0xb0, 0x4d, 0xac, 0xb9, 0x02, 0x42,
+    0xc0, 0x69, 0x50, 0x08, 0x7d, 0xa6, 0xb0, 0x34, 0x50, 0x5f, 0xe2, 0x77, 0x2e, 0xe5, 0x00, 0x24,
+    0xdd, 0xad, 0x6c, 0x00, 0x1e, 0xc0, 0x02, 0xf0, 0x2c, 0x0c, 0x72, 0x13, 0x3a, 0xad, 0x27, 0x4c,
+    0x76, 0xb9, 0xf1, 0x78, 0x80, 0x90, 0x33, 0x68, 0x0a, 0x00, 0x86, 0xa0, 0x00, 0x19, 0x7e, 0x06,
+    0x00, 0x22, 0x82, 0x02, 0x74, 0xe6, 0xbc, 0xdc, 0x21, 0x2e, 0x60, 0x14, 0x56, 0xc6, 0xf5, 0x20,
+    0x61, 0x80, 0x51, 0x28, 0x78, 0x07, 0x00, 0x27, 0xa0, 0x00, 0xbc, 0x64, 0x6a, 0x07, 0x02, 0x0f,
+    0x60, 0xbe, 0x40, 0xbb, 0x47, 0x31, 0x26, 0x80, 0x02, 0x69, 0x20, 0xf6, 0x63, 0x39, 0x34, 0xc6,
+    0x72, 0xb1, 0x9a, 0x92, 0x61, 0x03, 0x58, 0x38, 0x41, 0x38, 0x4b, 0x90, 0x47, 0x63, 0x79, 0xb7,
+    0x12, 0x01, 0x68, 0x00, 0x0b, 0x50, 0x90, 0x2e, 0x04, 0x40, 0x2a, 0x28, 0x00, 0xd9, 0x8e, 0xd2,
+    0x2e, 0x40, 0x04, 0xa4, 0x0a, 0xb5, 0xa8, 0x6e, 0x8a, 0x4b, 0x1b, 0xe5, 0xa6, 0x02, 0xfd, 0x52,
+    0x10, 0x80, 0x83, 0xdd, 0x23, 0x04, 0xe0, 0x09, 0x28, 0x80, 0xdb, 0x10, 0xf4, 0x36, 0xc1, 0xd3,
+    0x84, 0xb4, 0x8c, 0xe0, 0x16, 0x0f, 0x08, 0x10, 0x61, 0x43, 0x11, 0x00, 0x60, 0x0a, 0x0a, 0xe0,
+    0xe0, 0xb9, 0x04, 0x20, 0x2a, 0x28, 0xc0, 0x7c, 0xe4, 0x02, 0x1b, 0x02, 0x03, 0x50, 0x21, 0x8d,
+    0xb5, 0x1e, 0x92, 0x06, 0x30, 0x89, 0x82, 0x96, 0x01, 0x70, 0x04, 0x0a, 0x60, 0x47, 0x8d, 0x1c,
+    0x20, 0xf8, 0x00, 0xe8, 0x16, 0x56, 0x70, 0x15, 0x83, 0x02, 0x2c, 0x97, 0x36, 0x9e, 0x4e, 0x16,
+    0x44, 0xcb, 0xec, 0x56, 0x38, 0x3d, 0x19, 0x38, 0x40, 0x56, 0x91, 0x02, 0x99, 0x04, 0x81, 0xb4,
+    0x16, 0x79, 0xcb, 0x08, 0x80, 0x26, 0xa0, 0x00, 0x00, 0x91, 0x17, 0x00, 0x24, 0x83, 0x02, 0x50,
+    0xcd, 0xa2, 0x24, 0x03, 0x46, 0xa0, 0x2a, 0xd1, 0x19, 0x58, 0xa7, 0xc0, 0x34, 0x13, 0x75, 0x1e,
+    0x28, 0x30, 0x25, 0x01, 0x46, 0xd5, 0x5d, 0x18, 0x00, 0x1e, 0x81, 0x02, 0x28, 0x04, 0x13, 0x00,
+    0xa0, 0x00, 0x0b, 0x60, 0xb9, 0xd0, 0x52, 0x4d, 0xf8, 0xb4, 0xa3, 0x2a, 0x55, 0xce, 0xc2, 0x23,
+    0x02, 0x46, 0xe2, 0xb0, 0x4f, 0x00, 0x18, 0x83, 0x02, 0x0c, 0xf8, 0x80, 0x00, 0x88, 0x0c, 0x0a,
+    0x90, 0xa4, 0x96, 0xe5, 0x85, 0xc8, 0x00, 0x97, 0x3a, 0x99, 0x03, 0x8c, 0xc4, 0x01, 0x50, 0xa6,
+    0x80, 0x3d, 0x00, 0x9c, 0x81, 0x02, 0xf4, 0x98, 0x1c, 0x00, 0x98, 0x00, 0x0b, 0xe0, 0xc2, 0x68,
+    0x32, 0x20, 0x00, 0x19, 0x2a, 0x24, 0xba, 0x85, 0x16, 0xa3, 0x02, 0x30, 0x34, 0xae, 0xe4, 0x5a,
+    0x96, 0x44, 0x0b, 0x7d, 0xb6, 0xc5, 0x58, 0x19, 0x3a, 0x00, 0x57, 0x8f, 0x8e, 0x9d, 0x04, 0x89,
+    0x34, 0x17, 0x7b, 0x7b, 0x00, 0x80, 0x46, 0xa0, 0x00, 0xf8, 0x40, 0x5c, 0x00, 0xa4, 0x83, 0x02,
+    0x00, 0x0d, 0x1a, 0x64, 0x03, 0x48, 0xe3, 0xba, 0xd1, 0xc1, 0xcc, 0xa7, 0xc8, 0xb4, 0xd4, 0x76,
+    0xf0, 0x3b, 0x30, 0x45, 0x01, 0x50, 0xd3, 0xc5, 0x5f, 0x00, 0x9e, 0x81, 0x02, 0x34, 0x84, 0x3f,
+    0x01, 0xa0, 0x02, 0x0a, 0x40, 0xbb, 0x9f, 0xb8, 0x4c, 0x00, 0xb5, 0xa5, 0x29, 0x89, 0x84, 0xbe,
+    0x43, 0x02, 0x46, 0xeb, 0xc8, 0x2a, 0x00, 0x98, 0x83, 0x02, 0xe4, 0xd7, 0x95, 0x01, 0x88, 0x0e,
+    0x0a, 0xb0, 0x29, 0x75, 0xdb, 0x84, 0xd0, 0x80, 0x19, 0x2f, 0xdf, 0xb5, 0x90, 0xe4, 0x01, 0x52,
+    0xad, 0x00, 0x16, 0x00, 0x1c, 0x82, 0x02, 0xe0, 0xb8, 0x3d, 0x01, 0x98, 0x02, 0x0a, 0x70, 0x3e,
+    0x35, 0x58, 0x20, 0x08, 0x19, 0x6c, 0x33, 0xaa, 0xb7, 0x17, 0xc3, 0x02, 0x36, 0xd6, 0x9d, 0x3e,
+    0x64, 0x16, 0x45, 0x3b, 0xad, 0x18, 0x58, 0x00, 0xa8, 0x00, 0x0b, 0x60, 0xd7, 0x48, 0xf9, 0x65,
+    0xf0, 0x80, 0x5e, 0x37, 0x66, 0xac, 0x12, 0x44, 0xd2, 0x5c, 0xf5, 0x65, 0x51, 0x00, 0x9a, 0x81,
+    0x02, 0xc0, 0x23, 0xc0, 0x00, 0x90, 0x10, 0x0a, 0x80, 0x32, 0x44, 0xad, 0x0e, 0x28, 0x81, 0xec,
+    0x49, 0xb3, 0xe9, 0xa0, 0x42, 0xd3, 0x5a, 0xd4, 0xc1, 0xcd, 0xc0, 0x94, 0x05, 0x60, 0x4d, 0x17,
+    0xdd, 0x00, 0x78, 0x08, 0x0a, 0xf0, 0x10, 0x9d, 0x02, 0x80, 0x12, 0x28, 0x80, 0xf1, 0xca, 0xd5,
+    0x2f, 0x21, 0xd4, 0x9e, 0xa5, 0xdc, 0x5b, 0xe6, 0x8e, 0x09, 0x28, 0xb5, 0x25, 0x28, 0xac, 0x60,
+    0x10, 0xcd, 0xf1, 0x5e, 0xa6, 0x03, 0x20, 0x42, 0x28, 0x40, 0xba, 0x76, 0xe5, 0x0e, 0x62, 0x03,
+    0x72, 0x96, 0xbc, 0x2f, 0x56, 0x12, 0x08, 0x50, 0xd1, 0x22, 0x7e, 0x01, 0x70, 0x0a, 0x0a, 0x20,
+    0xe3, 0x6c, 0x02, 0x60, 0x12, 0x28, 0x40, 0xe8, 0xf8, 0xd3, 0x81, 0x40, 0x64, 0xb2, 0x10, 0x51,
+    0x37, 0x63, 0x8c, 0x0b, 0xf0, 0x04, 0x16, 0x63, 0xb2, 0x59, 0x16, 0x8d, 0x35, 0x63, 0xe5, 0x05,
+    0xa0, 0x0a, 0x28, 0x80, 0x50, 0xe9, 0x19, 0x9b, 0xe1, 0x03, 0x86, 0xd2, 0xe8, 0x8a, 0x4c, 0x90,
+    0x49, 0x73, 0xf9, 0x17, 0xc1, 0x00, 0x68, 0x08, 0x0a, 0x60, 0x0e, 0x3a, 0x00, 0x40, 0x4a, 0x28,
+    0xc0, 0xc3, 0x30, 0x6c, 0x3f, 0xc0, 0x04, 0xb2, 0x31, 0x85, 0x82, 0x8b, 0x8a, 0x4d, 0x8b, 0x09,
+    0x87, 0xab, 0x02, 0x53, 0x18, 0xe0, 0x45, 0x5d, 0xf9, 0x00, 0xe0, 0x29, 0x28, 0xc0, 0x43, 0xb8,
+    0x00, 0x00, 0x6a, 0xa0, 0x00, 0xcf, 0xbb, 0x33, 0xb2, 0x04, 0x51, 0x9b, 0x9e, 0xb2, 0xd5, 0x3c,
+    0x3b, 0x28, 0xc0, 0x04, 0x9d, 0x90, 0x9d, 0x82, 0x49, 0x34, 0xcd, 0x79, 0xe5, 0x03, 0x80, 0x28,
+    0xa1, 0x00, 0x31, 0x53, 0x65, 0x29, 0x08, 0x0e, 0xf0, 0xe5, 0xf1, 0x1e, 0xa2, 0x49, 0x22, 0x60,
+    0xd5, 0x8b, 0x90, 0x03, 0xc0, 0x31, 0x28, 0x40, 0x8a, 0x99, 0x1b, 0x80, 0x69, 0xa0, 0x00, 0x5d,
+    0x2b, 0x2b, 0x08, 0x82, 0x91, 0xb9, 0x66, 0xc5, 0x44, 0xa2, 0x31, 0x30, 0x40, 0x14, 0x53, 0x31,
+    0x36, 0x67, 0x61, 0x34, 0x58, 0x8e, 0x5f, 0x0d, 0x80, 0x4a, 0xa0, 0x00, 0x05, 0xb5, 0xc9, 0x7b,
+    0x06, 0x10, 0x40, 0x5a, 0x43, 0x53, 0x3f, 0x41, 0x28, 0xcd, 0x85, 0xe0, 0xf3, 0x00, 0xa0, 0x29,
+    0x28, 0x00, 0x37, 0xdc, 0x11, 0x00, 0x49, 0xa1, 0x00, 0xf6, 0xba, 0x0c, 0x11, 0x81, 0x13, 0xb8,
+    0xea, 0x54, 0x3d, 0x4d, 0x2a, 0x38, 0xcd, 0xa6, 0x9a, 0x77, 0x08, 0x4c, 0x69, 0x80, 0xd8, 0x75,
+    0x3b, 0x16, 0x80, 0xc7, 0xa0, 0x00, 0x0d, 0xa9, 0x4b, 0x00, 0x28, 0x82, 0x02, 0x34, 0x4f, 0x3f,
+    0x92, 0x12, 0x46, 0xcd, 0xca, 0x4a, 0xfb, 0x70, 0xeb, 0xa8, 0x00, 0x94, 0x81, 0xb2, 0x6d, 0x08,
+    0x46, 0xd1, 0x42, 0xe0, 0xb5, 0x55, 0x00, 0x22, 0x85, 0x02, 0xcc, 0x8d, 0x12, 0x5d, 0x20, 0x3a,
+    0x60, 0x48, 0xc6, 0xff, 0x9c, 0x27, 0x91, 0x80, 0xd5, 0x31, 0xbc, 0x04, 0x00, 0xe7, 0xa0, 0x00,
+    0x1f, 0x3e, 0x45, 0x00, 0x26, 0x82, 0x02, 0x74, 0x0c, 0x17, 0x22, 0x08, 0x48, 0x86, 0x4a, 0x9a,
+    0xc9, 0xe5, 0xc6, 0xc8, 0x00, 0x13, 0x3a, 0x19, 0x0f, 0x9e, 0xa5, 0xd1, 0x66, 0xa0, 0xe8, 0x6b,
+    0x00, 0x20, 0xc0, 0x02, 0xf4, 0xd8, 0x2f, 0x00, 0xa8, 0x06, 0x0a, 0x30, 0xcc, 0xb1, 0xda, 0x68,
+    0x08, 0x81, 0x26, 0x3b, 0x80, 0x2b, 0x15, 0xa4, 0xd2, 0x5e, 0x5a, 0xc6, 0xdd, 0x73, 0x1a, 0x03,
+    0x39, 0x44, 0xe3, 0x6a, 0x00, 0x90, 0x16, 0x0a, 0x00, 0x2e, 0x8a, 0x55, 0x12, 0x40, 0x01, 0x2b,
+    0x4f, 0x27, 0xeb, 0xa6, 0xa2, 0xd3, 0x74, 0x8c, 0xe1, 0xd3, 0xc0, 0x14, 0x07, 0x98, 0x71, 0xb7,
+    0xc9, 0x00, 0x78, 0x0e, 0x0a, 0xa0, 0x10, 0x34, 0x02, 0x80, 0x2a, 0x28, 0x00, 0xf1, 0x02, 0xd7,
+    0x25, 0x81, 0x04, 0xb5, 0xb3, 0x0c, 0xdb, 0x9f, 0x0e, 0x0b, 0x58, 0x91, 0xa8, 0x50, 0x58, 0x60,
+    0x16, 0xe6, 0xa4, 0xdd, 0xbc, 0x02, 0x20, 0x5a, 0x28, 0x00, 0xeb, 0x08, 0xe9, 0x01, 0xc2, 0x03,
+    0x90, 0x57, 0xb4, 0xa7, 0x87, 0x92, 0x09, 0x60, 0x45, 0xa3, 0x76, 0x01, 0x70, 0x10, 0x0a, 0x50,
+    0x61, 0xc0, 0x01, 0x60, 0x2a, 0x28, 0x40, 0xb8, 0x0a, 0x34, 0x82, 0xa0, 0x64, 0xa6, 0xf3, 0xa9,
+    0xb8, 0x74, 0x0c, 0x0d, 0x58, 0x95, 0x92, 0x54, 0xee, 0x59, 0x1c, 0xcd, 0x06, 0x8a, 0x5e, 0x04,
+    0x00, 0x0a, 0x28, 0xc0, 0x8f, 0x8d, 0x14, 0x80, 0x8a, 0xa0, 0x00, 0x7c, 0x0c, 0x0c, 0xa1, 0x06,
+    0x11, 0x90, 0x3a, 0x04, 0x1a, 0x6c, 0x41, 0x2c, 0xed, 0x45, 0x6b, 0x88, 0xe9, 0xa7, 0x39, 0x80,
+    0xcc, 0x31, 0x9e, 0x17, 0x00, 0x89, 0xa1, 0x00, 0xce, 0xca, 0x33, 0x38, 0x81, 0x14, 0xa8, 0xde,
+    0xf4, 0x28, 0x8e, 0x2a, 0x3c, 0xcd, 0xe7, 0x16, 0xf8, 0x02, 0x4c, 0x79, 0x80, 0x5a, 0x78, 0x1d,
+    0x03, 0x80, 0x07, 0xa1, 0x00, 0x05, 0x99, 0x6a, 0x00, 0x28, 0x83, 0x02, 0xd0, 0x4e, 0xdc, 0x2a,
+    0x12, 0x4a, 0x0d, 0xcb, 0xcb, 0x6a, 0x8b, 0xe8, 0xb8, 0x80, 0x56, 0x8c, 0x6a, 0x38, 0x02, 0x86,
+    0x61, 0x58, 0xd5, 0x65, 0x02, 0x00, 0x22, 0x86, 0x02, 0x1c, 0xe4, 0xd5, 0x00, 0xb0, 0x00, 0x0b,
+    0xc0, 0xbd, 0x3b, 0x68, 0x80, 0xf8, 0x98, 0x66, 0x14, 0xf9, 0x9b, 0xa4, 0x84, 0x02, 0x58, 0x6b,
+    0x49, 0xb9, 0x64, 0x9c, 0x44, 0x7b, 0x28, 0xd8, 0x8c, 0x01, 0x98, 0x0c, 0x0a, 0xa0, 0xaa, 0x98,
+    0x9a, 0x20, 0x30, 0x99, 0xa8, 0x90, 0x66, 0xc5, 0x1e, 0x63, 0x03, 0x5e, 0x68, 0xd4, 0x5d, 0x7e,
+    0x96, 0x47, 0xc3, 0x8d, 0x22, 0x82, 0x00, 0x80, 0x04, 0x0a, 0xf0, 0x63, 0x77, 0x02, 0xa0, 0x2a,
+    0x28, 0x80, 0x0c, 0x33, 0x57, 0xad, 0x61, 0x34, 0xac, 0x3b, 0x11, 0x4f, 0x63, 0x90, 0x4b, 0x83,
+    0x0d, 0x19, 0x8a, 0x27, 0x6a, 0x10, 0x40, 0xd4, 0x0b, 0x1f, 0x03, 0x40, 0x6a, 0x28, 0x00, 0x87,
+    0x57, 0x03, 0x80, 0x0b, 0xb0, 0x00, 0xc2, 0x8a, 0x0e, 0x49, 0x01, 0x15, 0xa8, 0x9e, 0x54, 0x63,
+    0xb1, 0x2a, 0x3e, 0x6d, 0x28, 0x95, 0xae, 0xe8, 0x4b, 0x81, 0x00, 0x1b, 0x7a, 0xdd, 0x15, 0x80,
+    0x27, 0xa1, 0x00, 0xff, 0xb8, 0x40, 0x00, 0xa8, 0x83, 0x02, 0x7c, 0x4e, 0x46, 0xf8, 0x11, 0x4c,
+    0xad, 0x7a, 0x4c, 0x31, 0x31, 0xe7, 0xc0, 0x80, 0x58, 0x8c, 0x8a, 0xaf, 0x01, 0xa6, 0x01, 0x60,
+    0xd2, 0xfd, 0x49, 0x00, 0xa2, 0x86, 0x02, 0x2c, 0xc4, 0x47, 0x00, 0xb0, 0x02, 0x0a, 0x20, 0x40,
+    0x3d, 0x0d, 0x81, 0x00, 0x19, 0x69, 0x14, 0xf1, 0x31, 0xa6, 0xa4, 0x02, 0x58, 0xea, 0xf1, 0x95,
+    0x7d, 0x1c, 0x45, 0xdb, 0xfc, 0x97, 0xe8, 0x00, 0x98, 0x0e, 0x0a, 0xa0, 0xa7, 0x26, 0xa8, 0x20,
+    0x38, 0x25, 0xa8, 0xa4, 0x04, 0x79, 0x20, 0x83, 0x03, 0x68, 0x33, 0x74, 0xb5, 0x7f, 0x16, 0x48,
+    0xd3, 0xa1, 0x82, 0xb2, 0x01, 0x80, 0x06, 0x0a, 0xc0, 0xe3, 0xc8, 0x06, 0xa0, 0x32, 0x28, 0xc0,
+    0xf9, 0x20, 0x2f, 0xb2, 0x81, 0x04, 0xb4, 0x6f, 0xe1, 0xa6, 0x6c, 0x10, 0x4c, 0x93, 0x6d, 0x37,
+    0x06, 0x55, 0x6a, 0x12, 0x40, 0x45, 0x8b, 0x58, 0x00, 0x40, 0x72, 0x28, 0x80, 0x89, 0x65, 0x16,
+    0x80, 0x2b, 0xa0, 0x00, 0xbd, 0xb2, 0x59, 0x56, 0x81, 0x15, 0xa0, 0x36, 0xb4, 0xdb, 0xce, 0x2a,
+    0x40, 0xed, 0xb8, 0x13, 0x6e, 0xcd, 0x4b, 0x89, 0x00, 0x1b, 0x7c, 0x93, 0x0c, 0x80, 0x47, 0xa1,
+    0x00, 0xf7, 0x50, 0x16, 0x00, 0x28, 0x84, 0x02, 0x18, 0xce, 0x6f, 0xcb, 0x11, 0x4e, 0x6d, 0x3a,
+    0x4d, 0x0d, 0xee, 0xe5, 0xc8, 0x00, 0x9a, 0x89, 0x8e, 0x66, 0x05, 0xc6, 0x01, 0x66, 0xd1, 0xbd,
+    0x21, 0x00, 0x22, 0x87, 0x02, 0x38, 0x84, 0x79, 0x01, 0xb0, 0x04, 0x0a, 0xc0, 0xc1, 0x32, 0x7b,
+    0x81, 0x08, 0x19, 0xeb, 0x15, 0xf5, 0xc7, 0xa6, 0xc4, 0x02, 0x58, 0x3b, 0x52, 0xe3, 0x8d, 0x9c,
+    0x45, 0x1b, 0xd5, 0x97, 0x44, 0x00, 0x98, 0x10, 0x0a, 0x40, 0x0e, 0x0e, 0x01, 0x00, 0x03, 0x2c,
+    0x40, 0x94, 0xde, 0x32, 0x83, 0x00, 0x65, 0x9e, 0xde, 0xba, 0xc2, 0x88, 0x8c, 0x0e, 0xc8, 0x15,
+    0xf0, 0x32, 0x02, 0x5a, 0x22, 0x6d, 0xf7, 0x0a, 0x8d, 0x04, 0x00, 0x22, 0x28, 0x80, 0x8d, 0x33,
+    0x10, 0x80, 0xea, 0xa0, 0x00, 0x9c, 0x8b, 0x9b, 0xda, 0x86, 0x12, 0xb0, 0xaa, 0x46, 0xbd, 0xe1,
+    0x41, 0x32, 0x6d, 0xe6, 0xd7, 0x08, 0x22, 0xaa, 0x51, 0x80, 0x17, 0x2b, 0x82, 0x12, 0x00, 0xe9,
+    0xa1, 0x00, 0x2e, 0xa6, 0x34, 0x00, 0x2e, 0x81, 0x02, 0x04, 0x0b, 0xd1, 0x78, 0x05, 0x58, 0x80,
+    0x8a, 0xce, 0x4f, 0xa1, 0xab, 0x08, 0x35, 0x66, 0x4b, 0x94, 0x4c, 0x2e, 0x45, 0x02, 0x6e, 0xf9,
+    0x65, 0x0d, 0x00, 0x9e, 0x85, 0x02, 0xb8, 0xc3, 0x6f, 0x01, 0xa0, 0x12, 0x0a, 0xc0, 0xb6, 0x53,
+    0x73, 0x46, 0x40, 0xb5, 0xa8, 0x37, 0xb3, 0x0f, 0x93, 0x43, 0x03, 0x70, 0x12, 0x42, 0xe6, 0x24,
+    0x98, 0x07, 0xb0, 0x49, 0xd7, 0xa9, 0x01, 0x88, 0x1e, 0x0a, 0xf0, 0x10, 0x9c, 0x03, 0xc0, 0x1a,
+    0x28, 0x00, 0x0b, 0x89, 0x24, 0x07, 0x42, 0x64, 0xb2, 0x5f, 0xfc, 0xe8, 0x9a, 0x92, 0x0b, 0x68,
+    0xcd, 0x49, 0x00, 0x59, 0x72, 0x18, 0x4d, 0xc5, 0xde, 0x91, 0x05, 0x60, 0x4a, 0x28, 0x40, 0x3b,
+    0xca, 0x16, 0x00, 0x2c, 0xa0, 0x00, 0x32, 0xba, 0xa3, 0x0f, 0x82, 0x94, 0x79, 0xa2, 0x8c, 0x89,
+    0x3a, 0x32, 0x3c, 0xc0, 0x07, 0xbe, 0x3f, 0x0d, 0x68, 0x91, 0x34, 0xde, 0x2d, 0x76, 0x09, 0x00,
+    0xa8, 0xa0, 0x00, 0x2f, 0xae, 0x14, 0x00, 0x2a, 0x84, 0x02, 0x48, 0x2d, 0xaa, 0xab, 0x1b, 0x4c,
+    0x60, 0x8a, 0x9e, 0x76, 0x4c, 0x08, 0xd1, 0xb4, 0xda, 0x49, 0xe9, 0xfb, 0xab, 0x66, 0x01, 0x68,
+    0xa6, 0x70, 0x1e, 0x00, 0x24, 0x88, 0x02, 0xd8, 0x58, 0x3b, 0x00, 0xb8, 0x06, 0x0a, 0xe0, 0xac,
+    0xee, 0x08, 0x16, 0x68, 0x01, 0xaa, 0x2e, 0xcd, 0xd8, 0xaf, 0x42, 0xd4, 0xa0, 0x2c, 0xe1, 0x8d,
+    0xb4, 0x94, 0x09, 0xb8, 0x99, 0xfa, 0x89, 0x89, 0x78, 0x18, 0x4d, 0x42, 0x8e, 0x0a, 0x03, 0x80,
+    0x52, 0x28, 0x80, 0xd4, 0x7a, 0x03, 0x17, 0x21, 0xd5, 0xa0, 0xe6, 0x94, 0x1d, 0x3a, 0x8e, 0x0d,
+    0xe0, 0xe1, 0x47, 0x05, 0xcf, 0x60, 0x20, 0x00, 0x47, 0xdd, 0x34, 0x04, 0x20, 0x82, 0x28, 0x80,
+    0x43, 0x1e, 0x05, 0x00, 0x8b, 0xa0, 0x00, 0x32, 0x34, 0x61, 0x1f, 0x88, 0x91, 0xa9, 0xae, 0x51,
+    0x08, 0x5f, 0x4a, 0x30, 0xc0, 0xa5, 0x29, 0xcb, 0xa1, 0xc9, 0x69, 0x34, 0x18, 0x79, 0x3d, 0x0c,
+    0x80, 0x49, 0xa1, 0x00, 0xf6, 0xf8, 0x34, 0x00, 0x30, 0x81, 0x02, 0x74, 0xa8, 0xb1, 0x51, 0x08,
+    0x54, 0xe6, 0xc9, 0x36, 0x28, 0x40, 0xc9, 0xf8, 0x00, 0xa2, 0xf0, 0xa0, 0x4a, 0xa0, 0x65, 0xd2,
+    0x7a, 0xc0, 0x68, 0x03, 0x00, 0x20, 0x83, 0x02, 0x98, 0x38, 0x63, 0x01, 0xa8, 0x12, 0x0a, 0xb0,
+    0x30, 0x85, 0x84, 0x6f, 0x38, 0x01, 0x68, 0x8a, 0xfe, 0xa7, 0x24, 0x64, 0xd3, 0x70, 0xd6, 0x9c,
+    0x4d, 0xbd, 0x1a, 0x06, 0xc8, 0x89, 0xa2, 0x8f, 0x01, 0x90, 0x22, 0x0a, 0xc0, 0xe3, 0x8a, 0x05,
+    0xe0, 0x22, 0x28, 0x40, 0xb9, 0x86, 0x36, 0x57, 0xc0, 0x05, 0xa6, 0x83, 0x94, 0xc0, 0xc0, 0x8a,
+    0x51, 0xa3, 0xe2, 0x64, 0x67, 0xbb, 0x52, 0x28, 0x00, 0xd7, 0x6b, 0x84, 0x46, 0xe2, 0x69, 0x34,
+    0x4e, 0x36, 0x42, 0x01, 0x00, 0x6a, 0xa1, 0x00, 0x39, 0x9b, 0x56, 0x51, 0x04, 0x55, 0x7b, 0xa6,
+    0xf3, 0xb5, 0xa7, 0x38, 0x38, 0x00, 0xa8, 0x9d, 0xbf, 0x21, 0x84, 0x89, 0x00, 0xdd, 0x75, 0x1d,
+    0x07, 0x80, 0x28, 0xa2, 0x00, 0x0c, 0x31, 0x5f, 0x00, 0xac, 0x82, 0x02, 0xb8, 0x70, 0xfc, 0x84,
+    0x20, 0x48, 0x49, 0x8a, 0x47, 0xc0, 0x31, 0x29, 0xc9, 0x80, 0x57, 0xac, 0x58, 0x9a, 0x26, 0xc7,
+    0xd1, 0x6a, 0xdd, 0x75, 0x09, 0x00, 0xa6, 0x85, 0x02, 0xf4, 0x23, 0x3a, 0x00, 0xc0, 0x06, 0x0a,
+    0x30, 0xa1, 0x46, 0x9c, 0x21, 0x58, 0x19, 0xe7, 0xea, 0xfa, 0x34, 0x26, 0x03, 0x04, 0x92, 0xae,
+    0xb3, 0x00, 0x81, 0x16, 0x4a, 0xeb, 0x29, 0x63, 0x48, 0x01, 0x80, 0x0e, 0x0a, 0xc0, 0xe1, 0xc3,
+    0x02, 0xa0, 0x52, 0x28, 0xc0, 0xb1, 0x66, 0x09, 0xc1, 0x01, 0x05, 0x9a, 0x6d, 0x8a, 0x69, 0xa1,
+    0x10, 0x4e, 0xd3, 0x29, 0xb2, 0xab, 0x28, 0x6b, 0x1a, 0x80, 0x17, 0x0a, 0x97, 0x03, 0x40, 0x92,
+    0x28, 0x00, 0x90, 0x49, 0x0c, 0x80, 0xab, 0xa0, 0x00, 0x06, 0x13, 0xb5, 0x53, 0x81, 0x17, 0x90,
+    0x1a, 0x31, 0x76, 0xfa, 0x2a, 0x48, 0x30, 0x1b, 0x95, 0x50, 0x73, 0x4a, 0xa9, 0x00, 0x9c, 0x98,
+    0x61, 0xb3, 0x88, 0xc7, 0xd1, 0x48, 0xce, 0xd8, 0x49, 0x00, 0x28, 0x86, 0x02, 0x90, 0xcc, 0xb9,
+    0x1a, 0x11, 0x56, 0xcd, 0x59, 0x4e, 0xd6, 0xa4, 0xe1, 0xe8, 0x80, 0xa2, 0x6e, 0xb4, 0x39, 0x14,
+    0x46, 0x02, 0x76, 0xdc, 0xbd, 0x66, 0x00, 0x22, 0x89, 0x02, 0x20, 0xc4, 0xe2, 0x00, 0xb0, 0x0c,
+    0x0a, 0x30, 0xc2, 0xc3, 0x19, 0x82, 0x28, 0x19, 0x27, 0x22, 0xc9, 0x79, 0xa3, 0x44, 0x03, 0x62,
+    0xbc, 0x52, 0x45, 0x97, 0x9c, 0x47, 0xcb, 0x5d, 0xb7, 0x4b, 0x01, 0x98, 0x18, 0x0a, 0x30, 0x10,
+    0x86, 0x05, 0x00, 0x23, 0x28, 0xc0, 0x84, 0x16, 0x27, 0x88, 0x80, 0x65, 0x9c, 0xe2, 0x2b, 0x35,
+    0x9c, 0x8c, 0x10, 0x70, 0x8a, 0x6e, 0x1d, 0x05, 0x5a, 0x2a, 0xad, 0xf7, 0x93, 0x0e, 0x43, 0x0b,
+    0x42, 0x94, 0x45, 0x84, 0x07, 0x1c, 0x80, 0x6a, 0xa1, 0x00, 0x88, 0x52, 0x02, 0x0d, 0x87, 0x14,
+    0x58, 0xca, 0x0a, 0x0d, 0xbd, 0x42, 0x3a, 0xcd, 0x57, 0x44, 0x77, 0x60, 0xad, 0x71, 0x80, 0x9f,
+    0x28, 0xf0, 0x03, 0x00, 0x69, 0xa2, 0x00, 0x41, 0xce, 0x08, 0x00, 0x2e, 0x83, 0x02, 0xbc, 0x4c,
+    0x41, 0x18, 0x05, 0x60, 0x20, 0x5a, 0x40, 0xa8, 0x8e, 0xab, 0x28, 0xb5, 0xab, 0x5d, 0xfa, 0xa3,
+    0x27, 0xc5, 0x02, 0x72, 0x09, 0x16, 0xad, 0x1e, 0x9e, 0x47, 0x5b, 0x11, 0x23, 0x78, 0x00, 0xa0,
+    0x1a, 0x0a, 0x60, 0xe1, 0xc2, 0x03, 0x20, 0x03, 0x2c, 0x00, 0xc5, 0x7e, 0x41, 0x0f, 0x81, 0xd5,
+    0x9c, 0xd9, 0x8c, 0xad, 0x0a, 0x0e, 0x0f, 0x50, 0x72, 0x66, 0x04, 0x77, 0x61, 0x26, 0x80, 0x27,
+    0xde, 0x0a, 0x04, 0x20, 0x9a, 0x28, 0xc0, 0x40, 0x6a, 0x04, 0x00, 0xeb, 0xa0, 0x00, 0x12, 0x04,
+    0x69, 0x22, 0x08, 0x93, 0x59, 0x5e, 0x92, 0x0b, 0x23, 0x4a, 0x36, 0x80, 0xb6, 0x2b, 0x09, 0x32,
+    0xc9, 0x81, 0xb4, 0x1e, 0x75, 0x2b, 0x0b, 0x80, 0xa9, 0xa1, 0x00, 0x08, 0x61, 0x31, 0x00, 0xb0,
+    0x82, 0x02, 0x74, 0x08, 0x93, 0xa3, 0x08, 0x5a, 0xc6, 0x09, 0x41, 0x6e, 0xe9, 0xc9, 0x10, 0x81,
+    0xe9, 0xe7, 0x56, 0x47, 0xa0, 0xc5, 0xd2, 0x7c, 0xe4, 0xb1, 0x11, 0xc1, 0xa0, 0x04, 0xd8, 0x1c,
+    0x38, 0x0e, 0x01, 0xa8, 0x18, 0x0a, 0xe0, 0x24, 0xf2, 0x4c, 0x71, 0x50, 0x81, 0x24, 0xbe, 0x62,
+    0x07, 0x2f, 0xc4, 0xd3, 0x82, 0x07, 0xdc, 0x53, 0xe1, 0x9a, 0x07, 0x08, 0x96, 0x42, 0x5d, 0x01,
+    0x90, 0x28, 0x0a, 0x00, 0x64, 0x02, 0x05, 0xe0, 0x3a, 0x28, 0x40, 0xd8, 0x1e, 0x57, 0x4d, 0x20,
+    0x06, 0xa0, 0xc1, 0x83, 0xc6, 0xae, 0x0a, 0x53, 0xa3, 0x92, 0xc6, 0x6c, 0x51, 0x52, 0x2e, 0x40,
+    0x47, 0x5b, 0xb7, 0x78, 0xe1, 0x81, 0x18, 0x58, 0x2e, 0xb4, 0x18, 0x00, 0xca, 0xa1, 0x00, 0x20,
+    0x66, 0x19, 0x00, 0xb2, 0x80, 0x02, 0x24, 0xec, 0x36, 0xcf, 0x10, 0x5a, 0xa8, 0x19, 0x4c, 0xde,
+    0x50, 0xe0, 0xf8, 0x18, 0xa7, 0x60, 0xd0, 0xa6, 0x1a, 0x86, 0x02, 0x78, 0x50, 0x16, 0xa9, 0x45,
+    0x22, 0x4a, 0x9b, 0xf0, 0x03, 0x6a, 0x01, 0xb0, 0x10, 0x0a, 0xe0, 0x3f, 0x48, 0x24, 0x82, 0x38,
+    0x99, 0x24, 0x2a, 0xdd, 0xe7, 0xa0, 0x84, 0x03, 0x6c, 0xb0, 0xe2, 0x6b, 0x8e, 0x9c, 0x48, 0x03,
+    0x46, 0x77, 0x1c, 0x00, 0x98, 0x1c, 0x0a, 0xc0, 0x10, 0x9f, 0x00, 0x00, 0x33, 0x28, 0x00, 0x8c,
+    0x2e, 0x6f, 0x8c, 0xc0, 0xd5, 0x9c, 0x34, 0x2c, 0xe9, 0xa1, 0x8c, 0xd1, 0xc0, 0x8e, 0xee, 0x8f,
+    0x07, 0x5a, 0x2e, 0xcd, 0x57, 0x24, 0x37, 0x3e, 0x0c, 0x52, 0x00, 0x12, 0x7f, 0xc7, 0x05, 0x80,
+    0xaa, 0xa1, 0x00, 0xde, 0xa8, 0x50, 0x00, 0x34, 0xc0, 0x02, 0x6c, 0x48, 0xac, 0x66, 0x1c, 0x56,
+    0x00, 0xc9, 0x33, 0x8f, 0x76, 0x0c, 0xf9, 0xb4, 0x22, 0xf4, 0xc8, 0xab, 0xba, 0x06, 0x02, 0x86,
+    0xab, 0x40, 0x2f, 0x00, 0xa4, 0x8a, 0x02, 0xf0, 0x38, 0x99, 0x00, 0xb8, 0x10, 0x0a, 0x90, 0xb9,
+    0x89, 0x1b, 0x12, 0x90, 0x01, 0xe7, 0xde, 0x7e, 0x68, 0xa8, 0xe2, 0xd4, 0xa0, 0xda, 0xe9, 0xb5,
+    0x88, 0x14, 0x0c, 0xe0, 0x85, 0xb5, 0x66, 0x37, 0x78, 0x22, 0xa6, 0x06, 0x0b, 0x72, 0x03, 0x80,
+    0x7a, 0x28, 0x40, 0x8a, 0xb9, 0x19, 0x80, 0x4c, 0xa0, 0x00, 0x07, 0xfb, 0x24, 0x2b, 0x04, 0x97,
+    0x69, 0x82, 0x12, 0x7a, 0x4d, 0x38, 0x40, 0x66, 0xea, 0x96, 0x60, 0x66, 0x87, 0xa9, 0x80, 0x9e,
+    0x9a, 0x5f, 0x84, 0x95, 0xa8, 0xd2, 0x3a, 0xf4, 0x78, 0x32, 0x00, 0xac, 0x84, 0x02, 0x9c, 0x6f,
+    0x7c, 0x88, 0x20, 0x50, 0xe6, 0x78, 0x4b, 0xda, 0x06, 0x28, 0xe9, 0x00, 0x9d, 0xa7, 0x7e, 0x51,
+    0x22, 0x47, 0xd2, 0x86, 0xd1, 0xd5, 0x52, 0x00, 0xa6, 0x87, 0x02, 0x38, 0xe4, 0x49, 0x01, 0xc0,
+    0x0e, 0x0a, 0x90, 0x24, 0x4c, 0xb9, 0x23, 0x78, 0xb5, 0xa6, 0x13, 0xc5, 0x72, 0x29, 0x83, 0x04,
+    0xae, 0xad, 0x43, 0x3a, 0x82, 0x16, 0x4c, 0xf3, 0x31, 0x2a, 0x13, 0x03, 0x83, 0x16, 0x80, 0x35,
+    0xdf, 0xb4, 0x05, 0xa0, 0x72, 0x28, 0x00, 0x3a, 0x62, 0x0b, 0x00, 0x2d, 0xa0, 0x00, 0xf1, 0xd9,
+    0x06, 0x1d, 0x07, 0x16, 0x38, 0xfe, 0xed, 0x11, 0x3b, 0x43, 0x40, 0x2d, 0x19, 0xba, 0x9d, 0x10,
+    0xaf, 0x89, 0x80, 0xa2, 0x2c, 0xf6, 0x01, 0x00, 0xc9, 0xa2, 0x00, 0x36, 0x76, 0x6c, 0x00, 0xae,
+    0x84, 0x02, 0x60, 0x2f, 0x55, 0x32, 0x04, 0x66, 0x80, 0x59, 0xb3, 0xd6, 0x1e, 0xa9, 0x40, 0xb5,
+    0xa6, 0x85, 0x36, 0xc4, 0x1e, 0x25, 0x03, 0x7c, 0x11, 0xd5, 0x36, 0x01, 0x1e, 0x09, 0xc8, 0xa5,
+    0x42, 0x2f, 0x00, 0xa0, 0x20, 0x0a, 0x20, 0x63, 0x34, 0x04, 0x20, 0x1b, 0x28, 0x00, 0xc3, 0x28,
+    0xfb, 0x08, 0xe1, 0x65, 0x9a, 0x74, 0x6c, 0x3e, 0x20, 0x8e, 0x90, 0xb9, 0x92, 0x85, 0x01, 0x03,
+    0x62, 0x2c, 0xa0, 0x67, 0xe5, 0x92, 0x4e, 0x26, 0xb2, 0xb4, 0x92, 0x3a, 0x7c, 0x02, 0x00, 0x4b,
+    0xa1, 0x00, 0xf4, 0xed, 0x63, 0x00, 0x36, 0xc0, 0x02, 0x40, 0x8f, 0xa5, 0x89, 0x20, 0x52, 0xa6,
+    0x38, 0xcc, 0xc4, 0xe4, 0x27, 0xf1, 0x80, 0x9e, 0xa1, 0xe4, 0x07, 0x21, 0x67, 0xd2, 0x8a, 0xd1,
+    0xb5, 0x2e, 0x00, 0x26, 0x88, 0x02, 0x38, 0x04, 0xa8, 0x00, 0xc0, 0x10, 0x0a, 0x60, 0xa6, 0xd7,
+    0x65, 0x24, 0x80, 0xb5, 0x66, 0x17, 0x35, 0xab, 0x2a, 0xa3, 0x04, 0xa6, 0xbd, 0xdb, 0x10, 0x83,
+    0x96, 0x4c, 0xfb, 0xfd, 0x2a, 0x98, 0xea, 0x82, 0x18, 0x60, 0xa6, 0x5e, 0xf7, 0x02, 0xa0, 0x7a,
+    0x28, 0x40, 0x3c, 0x8e, 0x02, 0x00, 0x4d, 0xa0, 0x00, 0xd0, 0x01, 0xd3, 0x1e, 0x87, 0x16, 0x30,
+    0xf6, 0x4e, 0x82, 0x48, 0x43, 0x42, 0xad, 0xb9, 0x37, 0x48, 0x45, 0xaf, 0x91, 0x00, 0xe3, 0x2e,
+    0x78, 0x14, 0x00, 0xe9, 0xa2, 0x00, 0x2e, 0x8e, 0x41, 0x00, 0x2e, 0x85, 0x02, 0x70, 0x50, 0x8c,
+    0xdb, 0x03, 0x68, 0x20, 0x09, 0x2f, 0x7d, 0x04, 0xa8, 0x48, 0x35, 0xa5, 0x95, 0x1c, 0xf7, 0x1a,
+    0x45, 0x03, 0x80, 0xc4, 0x8c, 0x13, 0x11, 0x9e, 0x09, 0xe8, 0x8d, 0xa2, 0x44, 0x01, 0xa0, 0x22,
+    0x0a, 0x90, 0xe3, 0xf1, 0x01, 0x20, 0x23, 0x28, 0x80, 0xc6, 0xfc, 0x50, 0x07, 0x01, 0x66, 0x9a,
+    0x41, 0xc4, 0x9d, 0x2b, 0x0e, 0x91, 0xc1, 0x9a, 0xc5, 0x6b, 0x28, 0x62, 0x2e, 0xa0, 0x67, 0xe2,
+    0xc5, 0x2c, 0x27, 0xba, 0x34, 0x16, 0x38, 0x6c, 0x14, 0x00, 0x6b, 0xa1, 0x00, 0xfc, 0xcd, 0x3d,
+    0x00, 0xb6, 0x80, 0x02, 0xe4, 0xae, 0x09, 0x8f, 0x20, 0x54, 0x66, 0xa8, 0x4c, 0xc0, 0xe2, 0x27,
+    0xf9, 0x80, 0xa0, 0x9a, 0x40, 0x1a, 0x20, 0x87, 0xd2, 0x8e, 0xd4, 0x45, 0x0b, 0x00, 0xa6, 0x88,
+    0x02, 0x34, 0x04, 0x04, 0x00, 0xc0, 0x12, 0x0a, 0x50, 0xa8, 0x60, 0x1b, 0x25, 0x88, 0x35, 0x26,
+    0x19, 0x8d, 0x83, 0x2c, 0xc3, 0x04, 0x9c, 0xd0, 0x4b, 0x58, 0x85, 0x16, 0x4d, 0x03, 0x8e, 0x0b,
+    0x1c, 0xce, 0x82, 0x1a, 0x20, 0x27, 0x5e, 0x3f, 0x00, 0xa0, 0x82, 0x28, 0x40, 0x3e, 0xca, 0x15,
+    0x00, 0x6d, 0xa0, 0x00, 0xbb, 0xa1, 0x2e, 0x1e, 0x07, 0x17, 0x28, 0xde, 0xaf, 0xb6, 0x43, 0x43,
+    0x44, 0x2d, 0xea, 0xb5, 0xe5, 0x32, 0xaf, 0x99, 0x00, 0xe3, 0x61, 0x70, 0x6a, 0x0b, 0x09, 0xd3,
+    0x28, 0x24, 0x4e, 0x16, 0x00, 0xae, 0x85, 0x02, 0x94, 0xf1, 0x03, 0x7d, 0x03, 0x6a, 0xc0, 0xd8,
+    0x2a, 0x1b, 0xea, 0xa6, 0x50, 0xb5, 0xa3, 0xa6, 0x08, 0x8e, 0x16, 0x65, 0x03, 0x84, 0x7b, 0x24,
+    0xe0, 0x23, 0x1e, 0x0a, 0x00, 0x82, 0x22, 0x9a, 0x00, 0xa0, 0x24, 0x0a, 0xe0, 0xe3, 0xab, 0x06,
+    0x20, 0x2b, 0x28, 0x80, 0xcc, 0xd6, 0x26, 0x06, 0x21, 0x66, 0x98, 0x06, 0x44, 0x6d, 0x35, 0x8e,
+    0xd1, 0x99, 0xd6, 0xa5, 0x97, 0x4b, 0x62, 0x30, 0xa0, 0x77, 0xde, 0xcc, 0xfa, 0x27, 0xc2, 0x34,
+    0x59, 0x35, 0x2e, 0x0a, 0x00, 0x8b, 0xa1, 0x00, 0x06, 0x9e, 0x17, 0x00, 0x36, 0x81, 0x02, 0x90,
+    0x4e, 0x6b, 0x94, 0x20, 0x56, 0x46, 0xb8, 0xcc, 0xc6, 0x00, 0x28, 0x01, 0x01, 0x63, 0x93, 0x5e,
+    0x10, 0x1f, 0xa7, 0xd2, 0x90, 0xd8, 0xed, 0x58, 0x00, 0x26, 0x89, 0x02, 0xe8, 0x23, 0x2d, 0xb7,
+    0xc0, 0x14, 0xb2, 0x30, 0x2a, 0xf0, 0xd0, 0x25, 0x90, 0x35, 0xa5, 0x18, 0xe1, 0xd7, 0x2e, 0xe3,
+    0x04, 0x94, 0xe7, 0xd3, 0xaf, 0x87, 0x96, 0x4d, 0x0b, 0xe2, 0x6b, 0x60, 0xb5, 0x82, 0x1c, 0xc0,
+    0xc7, 0xdd, 0x98, 0x04, 0xa0, 0x8a, 0x28, 0x00, 0x40, 0xc8, 0x0c, 0x00, 0x8d, 0xa0, 0x00, 0xb2,
+    0x31, 0x0a, 0x1b, 0x87, 0x17, 0x28, 0xae, 0x10, 0x2b, 0x2d, 0x43, 0x46, 0xad, 0xba, 0xb4, 0x7c,
+    0xd8, 0xae, 0xa1, 0x80, 0xa3, 0x7d, 0x8a, 0x01, 0x0d, 0x29, 0xd3, 0x3c, 0x1a, 0x2e, 0x5b, 0x00,
+    0x2e, 0x46, 0x00, 0xc4, 0xd2, 0x7d, 0x20, 0x03, 0x6c, 0x40, 0xd8, 0x26, 0xbb, 0xd6, 0xa5, 0x58,
+    0xb5, 0xe2, 0xb7, 0x08, 0xc5, 0x11, 0x85, 0x03, 0x8a, 0x36, 0xcc, 0x3b, 0x38, 0x9e, 0x0a, 0x18,
+    0x7e, 0x42, 0xb3, 0x01, 0xa0, 0x26, 0x0a, 0x10, 0xe4, 0x53, 0x04, 0x20, 0x33, 0x28, 0xc0, 0xd4,
+    0xe8, 0x38, 0x05, 0x41, 0x66, 0x98, 0xc6, 0x7b, 0x4b, 0x3c, 0x0e, 0x52, 0x7b, 0x42, 0x86, 0x01,
+    0x67, 0x62, 0x32, 0xc0, 0x27, 0x5a, 0xb7, 0xc0, 0x28, 0xca, 0xb4, 0x9b, 0x32, 0x0e, 0x1c, 0x00,
+    0xab, 0xa1, 0x00, 0x10, 0xde, 0x61, 0x00, 0xb6, 0x81, 0x02, 0x4c, 0x6e, 0x8c, 0x9f, 0x20, 0x58,
+    0x46, 0x28, 0xcc, 0xe1, 0x4d, 0x28, 0x09, 0x01, 0x25, 0x8c, 0x62, 0x46, 0x1e, 0xc7, 0xd2, 0x92,
+    0xdd, 0x9d, 0x36, 0x00, 0xa6, 0x89, 0x02, 0x78, 0xe3, 0x99, 0xac, 0xc0, 0x16, 0xad, 0xf1, 0x2b,
+    0x8f, 0x9d, 0x26, 0x98, 0xb5, 0xa4, 0x16, 0xeb, 0xcf, 0x31, 0x03, 0x05, 0x8c, 0xff, 0xeb, 0x87,
+    0x8a, 0x16, 0x4e, 0x13, 0x06, 0x4c, 0xe0, 0xa0, 0x82, 0x1e, 0x40, 0x78, 0x5d, 0xf1, 0x01, 0xa0,
+    0x92, 0x28, 0x80, 0x41, 0xae, 0x03, 0x00, 0xad, 0xa0, 0x00, 0xb5, 0x39, 0xd6, 0x16, 0x07, 0x18,
+    0x20, 0x5a, 0xd1, 0xa0, 0x06, 0x43, 0x48, 0x50, 0x0b, 0x34, 0x19, 0x2d, 0xae, 0xa9, 0x80, 0xa3,
+    0x92, 0xfc, 0x54, 0x0d, 0x49, 0xd3, 0x4a, 0xcc, 0x95, 0xaf, 0x25, 0xae, 0x06, 0x38, 0x00, 0x14,
+    0xbd, 0xc5, 0x02, 0x6e, 0xc0, 0x27, 0xa3, 0x4c, 0xc4, 0xa4, 0x60, 0xb5, 0xe1, 0xc9, 0x54, 0xb8,
+    0x0c, 0xa5, 0x03, 0x92, 0xf7, 0xe3, 0x96, 0x4e, 0x1e, 0x0b, 0x28, 0x86, 0x22, 0x0d, 0x01, 0xa0,
+    0x28, 0x0a, 0x10, 0xe4, 0xef, 0x01, 0x20, 0x3b, 0x28, 0xc0, 0xde, 0xec, 0x6e, 0x04, 0x61, 0x66,
+    0x96, 0x82, 0x2b, 0x29, 0x40, 0x8e, 0x52, 0x5b, 0xda, 0x66, 0x6b, 0x80, 0x62, 0x34, 0xc0, 0x97,
+    0xd5, 0x97, 0x6d, 0x29, 0xd2, 0x34, 0xde, 0x2f, 0xcc, 0x11, 0x00, 0xcb, 0xa1, 0x00, 0x1a, 0x5e,
+    0x3b, 0x00, 0x36, 0x82, 0x02, 0x18, 0xee, 0xe9, 0xae, 0x20, 0x5a, 0x26, 0xf8, 0xca, 0xfc, 0xbb,
+    0x28, 0x11, 0x81, 0xe7, 0x85, 0x72, 0xb8, 0x1d, 0xe7, 0xd2, 0x94, 0x38, 0x86, 0x21, 0x81, 0x26,
+    0x0a, 0x90, 0xfc, 0xe2, 0xbc, 0x97, 0xc0, 0x18, 0x2d, 0x72, 0x2d, 0x2e, 0x6b, 0x27, 0xa0, 0x35,
+    0xa3, 0x13, 0xc5, 0x47, 0x35, 0x23, 0x05, 0x86, 0x17, 0x34, 0xd1, 0x8e, 0x96, 0x4e, 0x23, 0xfe,
+    0x6b, 0x5d, 0x94, 0x82, 0x20, 0xc0, 0x48, 0x5d, 0x5f, 0x06, 0xa0, 0x9a, 0x28, 0xc0, 0x42, 0x86,
+    0x16, 0x00, 0xcd, 0xa0, 0x00, 0xc1, 0xc1, 0xb1, 0x0f, 0x87, 0x18, 0x20, 0xe2, 0xb1, 0x17, 0xd6,
+    0x42, 0x4a, 0xcd, 0xfa, 0xb3, 0xaa, 0x3a, 0xad, 0xb1, 0x00, 0x64, 0xa4, 0x84, 0x6c, 0x0c, 0x69,
+    0xd3, 0x58, 0xab, 0xad, 0x84, 0x1f, 0x2e, 0x07, 0x48, 0x60, 0xa3, 0x3b, 0x00, 0xe0, 0x00, 0x0b,
+    0x10, 0x55, 0xf2, 0xbc, 0x09, 0xc0, 0x01, 0xdd, 0x7e, 0x68, 0x27, 0x8f, 0xa2, 0xd5, 0x84, 0x6e,
+    0x63, 0xbe, 0x1d, 0x14, 0x0f, 0x60, 0xfa, 0x8e, 0x88, 0x97, 0x79, 0x2e, 0xe0, 0x38, 0x91, 0x19,
+    0x09, 0x84, 0xaa, 0xb4, 0xc7, 0x8f, 0x29, 0x1a, 0x80, 0x0c, 0xa1, 0x00, 0xac, 0x4b, 0x94, 0x0f,
+    0x04, 0x9a, 0x51, 0xf2, 0x4c, 0x18, 0x06, 0x39, 0x4c, 0xed, 0x58, 0x9e, 0x5f, 0x66, 0x8a, 0xd9,
+    0x80, 0x9f, 0x43, 0x87, 0xed, 0xa7, 0x68, 0xd3, 0x82, 0xb5, 0x68, 0x1e, 0x00, 0xac, 0x87, 0x02,
+    0x8c, 0x58, 0x52, 0x00, 0xd8, 0x0a, 0x0a, 0xf0, 0x37, 0x18, 0x11, 0x83, 0x70, 0x9d, 0x20, 0x24,
+    0x71, 0x48, 0xa5, 0x64, 0x34, 0xa8, 0x02, 0x42, 0x39, 0x75, 0x1c, 0x4c, 0x5b, 0x3a, 0xb9, 0x35,
+    0xfe, 0x99, 0x2a, 0xa0, 0xb3, 0x89, 0x5f, 0x04, 0x02, 0x6b, 0x34, 0x49, 0xba, 0x5a, 0xe3, 0xa0,
+    0xa0, 0xd6, 0x88, 0x40, 0x1c, 0x6e, 0xe6, 0x0c, 0x15, 0xf8, 0xbd, 0x70, 0xaa, 0x4c, 0x5a, 0x3c,
+    0xcd, 0x48, 0xaf, 0x67, 0x3e, 0x0a, 0x8a, 0x00, 0xa5, 0x74, 0x35, 0x0f, 0x80, 0x8a, 0xa2, 0x00,
+    0x0e, 0x71, 0x34, 0x00, 0xb4, 0x83, 0x02, 0x58, 0x27, 0x35, 0x1c, 0x1c, 0x64, 0x60, 0x18, 0x49,
+    0x43, 0x8d, 0x0a, 0x31, 0x35, 0x69, 0xd1, 0xf8, 0x20, 0xb0, 0xe6, 0x02, 0x90, 0xc8, 0x62, 0x10,
+    0x2a, 0x24, 0x0e, 0x92, 0x49, 0x76, 0x2a, 0x61, 0xb8, 0x1e, 0x60, 0x21, 0x0e, 0xd5, 0x05, 0x80,
+    0x0b, 0x28, 0x40, 0x69, 0xf5, 0xeb, 0x21, 0x20, 0x07, 0x68, 0xcc, 0xc1, 0xe6, 0x2e, 0x0a, 0x57,
+    0x0b, 0xd2, 0x6e, 0x70, 0x22, 0x50, 0x3e, 0x00, 0xca, 0x38, 0xc5, 0xcb, 0xe7, 0xc1, 0x80, 0x64,
+    0x60, 0x70, 0xb6, 0x16, 0xca, 0xd2, 0x32, 0x3a, 0x3e, 0x41, 0x00, 0xb2, 0x84, 0x02, 0x8c, 0x8f,
+    0x77, 0x39, 0x10, 0x6a, 0x06, 0x49, 0x2f, 0x2d, 0x0d, 0xe4, 0x38, 0xb5, 0xa1, 0x86, 0x34, 0xd0,
+    0x2a, 0x86, 0x03, 0x82, 0xc3, 0xfc, 0x91, 0xa5, 0x22, 0x4e, 0x2b, 0xb6, 0x42, 0x99, 0x01, 0xb0,
+    0x20, 0x0a, 0xc0, 0xe2, 0xdc, 0x05, 0x60, 0x33, 0x28, 0xc0, 0xdf, 0x34, 0xf6, 0x0d, 0xe2, 0xd5,
+    0x82, 0x67, 0xcc, 0x83, 0xa1, 0x12, 0x12, 0xc8, 0xd6, 0x87, 0x42, 0xd0, 0x71, 0x32, 0x6d, 0xb9,
+    0xe3, 0x7d, 0xf6, 0x67, 0xb2, 0x00, 0x13, 0x1d, 0xea, 0xa6, 0x06, 0xcc, 0xd1, 0x28, 0xed, 0xfd,
+    0x33, 0x00, 0x3a, 0xc0, 0x02, 0xc8, 0xcb, 0x63, 0x45, 0x0a, 0x6c, 0x2d, 0x18, 0xc3, 0xbd, 0x8c,
+    0xcf, 0x58, 0x01, 0xde, 0x10, 0x3d, 0x21, 0xa6, 0xe5, 0xd3, 0x92, 0xe3, 0x42, 0x44, 0xa4, 0x20,
+    0x09, 0x68, 0x4a, 0x77, 0x52, 0x00, 0xa8, 0x2a, 0x0a, 0x70, 0x94, 0x82, 0x09, 0x41, 0x43, 0x00,
+    0x49, 0x7c, 0x58, 0x76, 0xbf, 0x61, 0x06, 0x84, 0xa0, 0x0c, 0xb2, 0x9a, 0x90, 0x53, 0x73, 0x4a,
+    0x4d, 0x36, 0xaf, 0x6a, 0x30, 0x00, 0x49, 0xaf, 0xf9, 0xf5, 0x41, 0xea, 0x98, 0x1b, 0x60, 0x0b,
+    0xa8, 0x83, 0x0b, 0x02, 0x1a, 0xeb, 0x78, 0x3b, 0x00, 0x38, 0x81, 0x02, 0xe4, 0x97, 0x45, 0xda,
+    0x01, 0x74, 0xc0, 0x65, 0x9a, 0xf7, 0x1b, 0xa2, 0x78, 0x19, 0xe0, 0xfd, 0xaa, 0xfa, 0x02, 0x05,
+    0x64, 0xa8, 0x61, 0x43, 0x96, 0x93, 0x9e, 0x0c, 0x50, 0x82, 0x87, 0xce, 0xce, 0xa1, 0x2e, 0x0d,
+    0x34, 0xe3, 0x96, 0x01, 0x20, 0x53, 0x04, 0x80, 0x2b, 0x5c, 0x18, 0x00, 0x0f, 0xb0, 0x00, 0x20,
+    0xac, 0xb7, 0x0c, 0x04, 0x9b, 0x31, 0xb6, 0x0a, 0xb9, 0xf8, 0x38, 0x50, 0x0d, 0x68, 0xa5, 0xc1,
+    0x01, 0x8b, 0xe9, 0x00, 0x61, 0x1e, 0x6d, 0x77, 0xaa, 0xa8, 0xd3, 0x90, 0xa5, 0x20, 0x3e, 0x00,
+    0xac, 0x88, 0x02, 0xd0, 0x18, 0xd8, 0x00, 0xd8, 0x0e, 0x0a, 0x60, 0x38, 0xf8, 0xf2, 0x83, 0x80,
+    0xb5, 0xe0, 0x0c, 0x91, 0xf5, 0xab, 0xa4, 0x04, 0xac, 0xf2, 0x69, 0xd8, 0x74, 0x1c, 0x4d, 0x5b,
+    0x3a, 0xb8, 0x3c, 0xfd, 0x99, 0x2e, 0xc0, 0xc5, 0x04, 0x07, 0x56, 0x01, 0x7b, 0x34, 0x8a, 0x7d,
+    0x31, 0x04, 0x80, 0x2e, 0xa0, 0x00, 0xf2, 0x6a, 0x34, 0x9e, 0x82, 0x5b, 0xeb, 0x89, 0x30, 0xa3,
+    0x34, 0x34, 0x58, 0x40, 0x47, 0x45, 0x06, 0xe5, 0x69, 0x01, 0x35, 0xa6, 0xb3, 0x54, 0x68, 0x29,
+    0x68, 0x02, 0x9e, 0xdc, 0x25, 0xe0, 0x0d, 0x2a, 0x4b, 0x23, 0x54, 0x85, 0x97, 0x31, 0xd0, 0x12,
+    0x20, 0xe3, 0x20, 0x55, 0x33, 0x6f, 0xa0, 0x81, 0x20, 0x29, 0xe3, 0x23, 0x23, 0x04, 0xd5, 0x94,
+    0x64, 0x1b, 0xa7, 0x95, 0x9a, 0x0c, 0x48, 0x4e, 0x2c, 0xf9, 0x48, 0x90, 0x3c, 0x86, 0xe7, 0xd6,
+    0x6b, 0x46, 0xe0, 0x8a, 0x80, 0x07, 0x3d, 0x6a, 0x06, 0x00, 0x6e, 0xa0, 0x00, 0x4e, 0x6e, 0xe5,
+    0x68, 0x80, 0x1d, 0x38, 0x29, 0xc6, 0x60, 0x5c, 0x28, 0x60, 0x06, 0x78, 0xc3, 0x94, 0xcc, 0x41,
+    0x09, 0x19, 0xec, 0xcf, 0x16, 0x38, 0xaa, 0x47, 0x03, 0x96, 0x37, 0xa2, 0x8e, 0x8b, 0x28, 0x4c,
+    0x3b, 0x65, 0x77, 0x7a, 0xd5, 0xcb, 0x16, 0x24, 0x51, 0x0b, 0x92, 0x03, 0xc0, 0x0b, 0x28, 0xc0,
+    0x18, 0x85, 0xc4, 0x02, 0xe1, 0x66, 0x86, 0x68, 0x0a, 0x89, 0x3a, 0x8e, 0x54, 0xeb, 0x59, 0xca,
+    0xa1, 0xd1, 0x62, 0x3c, 0xa0, 0x18, 0xc3, 0x83, 0xab, 0x2a, 0xf2, 0xb4, 0x65, 0x28, 0x94, 0x05,
+    0x00, 0x4b, 0xa2, 0x00, 0x51, 0xf6, 0xef, 0x50, 0x36, 0x44, 0x6b, 0x58, 0xce, 0x18, 0x1e, 0x21,
+    0x62, 0x2d, 0x78, 0xbf, 0x80, 0xe3, 0x2b, 0x31, 0x81, 0x68, 0x7e, 0xea, 0x8b, 0x1d, 0x67, 0xd3,
+    0x96, 0xd2, 0x0d, 0x34, 0x81, 0x26, 0x0c, 0xa0, 0x8d, 0x60, 0xcb, 0x44, 0xc0, 0x20, 0x8d, 0xf2,
+    0xdf, 0xdc, 0x05, 0xa0, 0x13, 0x28, 0xc0, 0xb9, 0x14, 0x64, 0xaa, 0x00, 0xd7, 0x72, 0x16, 0xf4,
+    0x04, 0x23, 0x8d, 0x16, 0xc0, 0x75, 0x91, 0xb0, 0x92, 0x5a, 0x42, 0xed, 0x59, 0xab, 0xe0, 0x86,
+    0x0a, 0xa2, 0x80, 0xe8, 0x79, 0xc5, 0x70, 0x85, 0xea, 0xd2, 0x24, 0x4e, 0x59, 0x41, 0x09, 0x34,
+    0x05, 0xf0, 0x34, 0x04, 0x8a, 0x01, 0x20, 0x01, 0x0b, 0xb0, 0xa2, 0x18, 0x89, 0x6e, 0xa8, 0x01,
+    0xa0, 0x28, 0x53, 0xb7, 0x1f, 0x24, 0xd5, 0x8c, 0x7a, 0xeb, 0x80, 0x7f, 0x1a, 0x0d, 0x50, 0x9e,
+    0x2c, 0x74, 0x0c, 0x90, 0x3e, 0x26, 0x18, 0xd6, 0xd3, 0x8b, 0xe0, 0x92, 0x98, 0x08, 0x3f, 0x14,
+    0x1a, 0x00, 0x8e, 0xa0, 0x00, 0x9c, 0xbe, 0xce, 0x5d, 0x00, 0x1e, 0xf8, 0xec, 0x05, 0x86, 0x35,
+    0x28, 0x62, 0xe6, 0x17, 0xc7, 0x84, 0xaa, 0x42, 0x11, 0x99, 0xeb, 0xc9, 0x70, 0xce, 0xae, 0x67,
+    0x03, 0x96, 0x85, 0xd2, 0xda, 0xa1, 0xa8, 0x4c, 0x6b, 0x6d, 0x16, 0xdb, 0x38, 0xcc, 0x18, 0xc0,
+    0xe1, 0x8b, 0x16, 0x01, 0xc0, 0x13, 0x28, 0x80, 0x2a, 0x71, 0x37, 0x02, 0x01, 0x67, 0x80, 0x24,
+    0xba, 0x53, 0x37, 0x0e, 0x55, 0xd3, 0x65, 0xeb, 0x13, 0xdd, 0x62, 0x3e, 0xe0, 0xc8, 0xbe, 0x22,
+    0x91, 0x2a, 0xfa, 0x34, 0xa7, 0x27, 0xf0, 0x17, 0x00, 0x6b, 0xa2, 0x00, 0x01, 0x1e, 0xc1, 0x56,
+    0xb6, 0x44, 0xbb, 0xbc, 0x4e, 0x36, 0x45, 0x21, 0x64, 0x0d, 0x48, 0x3b, 0x97, 0xb9, 0x2c, 0x39,
+    0x01, 0xa6, 0x82, 0xb4, 0x21, 0x1e, 0x87, 0xd3, 0x98, 0x8c, 0x7d, 0x97, 0x83, 0xa6, 0x0c, 0xd0,
+    0x15, 0xe0, 0xa7, 0x35, 0xc0, 0x22, 0x8d, 0x92, 0xe0, 0xa4, 0x03, 0xa0, 0x1b, 0x28, 0x00, 0xb4,
+    0x42, 0xf7, 0xac, 0x20, 0xd7, 0x68, 0x0b, 0xe4, 0xd0, 0x38, 0x0d, 0x17, 0xb0, 0x81, 0x91, 0x21,
+    0xae, 0x5a, 0x44, 0x6d, 0xda, 0xa9, 0x9b, 0xac, 0x0a, 0xaa, 0x80, 0x69, 0x7c, 0xc3, 0x68, 0x86,
+    0x0a, 0xd3, 0x34, 0x3b, 0x01, 0x9c, 0x06, 0xb4, 0x05, 0x10, 0x2d, 0x24, 0xe5, 0x00, 0x20, 0x03,
+    0x0a, 0x50, 0x24, 0xed, 0xdd, 0x6d, 0xb0, 0x01, 0x5f, 0x26, 0x79, 0x2e, 0x1c, 0x44, 0xd5, 0x84,
+    0x92, 0xcb, 0xcb, 0x69, 0x9a, 0x0d, 0x58, 0xbe, 0xcc, 0xaf, 0x39, 0x90, 0x40, 0xa0, 0x68, 0x55,
+    0x47, 0x51, 0xe1, 0x9a, 0x34, 0x8a, 0x40, 0x94, 0x11, 0x00, 0xae, 0xa0, 0x00, 0x9d, 0x86, 0x49,
+    0x55, 0x80, 0x1e, 0xa0, 0xe4, 0x65, 0xe9, 0x16, 0x28, 0x64, 0xe6, 0x47, 0xca, 0x7a, 0x48, 0x43,
+    0x19, 0x9d, 0x29, 0xc6, 0xbe, 0x64, 0xb2, 0x87, 0x03, 0x98, 0xcb, 0x12, 0x37, 0xb3, 0x28, 0x4d,
+    0x9b, 0xc9, 0xd5, 0x3d, 0x84, 0xcc, 0x1a, 0x00, 0x72, 0x0c, 0xad, 0x05, 0xc0, 0x1b, 0x28, 0x40,
+    0x3d, 0x71, 0x8e, 0x01, 0x21, 0x67, 0x7a, 0xe3, 0x51, 0xad, 0x33, 0x8e, 0x55, 0xc3, 0x7d, 0xcc,
+    0x88, 0xe6, 0x62, 0x40, 0x40, 0xa9, 0xba, 0xc0, 0x6d, 0x2a, 0x02, 0xb5, 0xe8, 0x27, 0x4c, 0x0e,
+    0x00, 0x8b, 0x22, 0x00, 0xae, 0xed, 0x17, 0x58, 0x36, 0x45, 0xeb, 0x3c, 0x6f, 0x92, 0x68, 0x21,
+    0x66, 0x0d, 0xb8, 0x36, 0xae, 0x6e, 0x2d, 0x41, 0x81, 0xa3, 0x89, 0xa6, 0x13, 0x1f, 0xa7, 0xd3,
+    0x98, 0x42, 0x25, 0xea, 0x87, 0x26, 0x0d, 0x00, 0x56, 0x40, 0x9d, 0x2a, 0xc0, 0x24, 0xa6, 0x32,
+    0xe1, 0x66, 0x01, 0xa0, 0x23, 0x28, 0xc0, 0xaa, 0x58, 0x4e, 0xae, 0x40, 0xd7, 0x5e, 0x04, 0xbc,
+    0x2b, 0x4c, 0x8d, 0x17, 0xa8, 0x5d, 0x31, 0x57, 0xcb, 0x5a, 0x46, 0xf0, 0x5a, 0xa8, 0x4a, 0xca,
+    0x0a, 0xb2, 0x00, 0x2a, 0x7e, 0xef, 0x00, 0x87, 0x2a, 0xd3, 0x42, 0x20, 0x71, 0xe6, 0x04, 0x34,
+    0x06, 0x20, 0x21, 0x64, 0x3d, 0x00, 0x20, 0x05, 0x0a, 0xb0, 0x25, 0xc1, 0x33, 0x6d, 0xb8, 0x81,
+    0x1d, 0x23, 0x7f, 0xc5, 0x18, 0x64, 0xd5, 0x7c, 0xac, 0x9b, 0xa6, 0x54, 0x1a, 0x0e, 0x68, 0xba,
+    0x6c, 0x28, 0x7b, 0x90, 0x42, 0x20, 0xf9, 0x54, 0xce, 0x25, 0xe2, 0xa2, 0xb4, 0x0b, 0x42, 0x00,
+    0x09, 0x00, 0xce, 0xa0, 0x00, 0xf2, 0x8d, 0x37, 0x00, 0x00, 0x9f, 0x02, 0x08, 0xc6, 0x4c, 0x0a,
+    0x28, 0x66, 0xe0, 0xe7, 0xcc, 0x7b, 0xc5, 0x43, 0x21, 0x35, 0xa7, 0xc4, 0x2e, 0xf7, 0xb4, 0xa7,
+    0x03, 0x98, 0x08, 0xb3, 0x13, 0xc0, 0xa8, 0x4d, 0xc3, 0x55, 0x15, 0x63, 0xb9, 0xcc, 0x1c, 0x40,
+    0x12, 0x0d, 0x41, 0x03, 0xc0, 0x23, 0x28, 0x80, 0x50, 0xa5, 0x85, 0x00, 0x41, 0x67, 0x72, 0xa7,
+    0x79, 0x06, 0x30, 0x0e, 0x56, 0xb3, 0x9d, 0x0d, 0x01, 0xea, 0x62, 0x42, 0xc0, 0xd9, 0xb6, 0x4d,
+    0x23, 0x2a, 0x0a, 0xb5, 0xe9, 0x44, 0x30, 0x62, 0x30, 0xab, 0x02, 0x24, 0x64, 0x55, 0x60, 0x56,
+    0xb6, 0x45, 0x0b, 0xe1, 0xcf, 0xb1, 0x8d, 0x21, 0x68, 0xed, 0xe7, 0xb1, 0xb6, 0xec, 0x2d, 0x49,
+    0x01, 0xe1, 0x92, 0x76, 0x49, 0x20, 0xc7, 0xd3, 0x9a, 0xf4, 0x7c, 0xcb, 0x8b, 0xa6, 0x0d, 0x28,
+    0xf6, 0x20, 0x9d, 0x23, 0xc0, 0x26, 0xa6, 0xd2, 0xe1, 0x2b, 0x06, 0xa0, 0x2b, 0x28, 0x40, 0x9e,
+    0x70, 0x85, 0xae, 0x60, 0xd7, 0x54, 0x01, 0x2c, 0x86, 0x5c, 0x0d, 0x18, 0xa0, 0x19, 0xb1, 0xcb,
+    0xe2, 0x5a, 0x48, 0x4d, 0x2b, 0x27, 0xfb, 0xde, 0x0a, 0xba, 0x80, 0x6a, 0x7e, 0x69, 0x75, 0x87,
+    0x4a, 0xd3, 0x50, 0x00, 0x11, 0xc0, 0x02, 0xb4, 0x06, 0x30, 0x0d, 0x44, 0x55, 0x01, 0x20, 0x07,
+    0x0a, 0x90, 0x26, 0xa1, 0x91, 0x6c, 0xc0, 0x01, 0x1c, 0x1f, 0x73, 0x78, 0x15, 0x84, 0xd5, 0x76,
+    0xc4, 0x13, 0x82, 0x40, 0x9a, 0x0e, 0x78, 0x92, 0x6c, 0x9f, 0xc0, 0x90, 0x44, 0x80, 0xd9, 0xd4,
+    0x5a, 0xf3, 0xe2, 0xaa, 0xb4, 0x0d, 0x43, 0x56, 0x00, 0x00, 0xee, 0x20, 0x00, 0xea, 0x7d, 0x15,
+    0x00, 0x80, 0x9f, 0x02, 0x58, 0xc6, 0x71, 0x1f, 0x28, 0x68, 0xc0, 0xe7, 0x4e, 0x76, 0x0b, 0x44,
+    0x29, 0x35, 0x65, 0xc5, 0x82, 0x4d, 0xb6, 0xc7, 0x03, 0x98, 0x3b, 0x13, 0x61, 0xc7, 0x28, 0x4e,
+    0xeb, 0x09, 0x15, 0xc6, 0xce, 0xcc, 0x1e, 0x60, 0xb2, 0x0d, 0xdd, 0x00, 0xc0, 0x2b, 0x28, 0xc0,
+    0x64, 0x33, 0x19, 0x01, 0x61, 0x07, 0x68, 0x71, 0xd9, 0x4f, 0x2e, 0x8e, 0x56, 0xab, 0xbd, 0x6e,
+    0x3e, 0xeb, 0x62, 0x44, 0x40, 0x5a, 0xb3, 0xd2, 0xc8, 0x29, 0x12, 0x35, 0xaa, 0x5f, 0x14, 0x95,
+    0x32, 0xcb, 0x02, 0x36, 0x22, 0x6d, 0x38, 0x52, 0x36, 0x46, 0x23, 0xa1, 0xb0, 0x10, 0xaf, 0x21,
+    0x6a, 0xcd, 0xf7, 0xac, 0xb4, 0x3a, 0x2e, 0x51, 0x81, 0x1e, 0x9e, 0x78, 0xdb, 0x21, 0xe7, 0xd3,
+    0x9a, 0xa6, 0xdc, 0xab, 0x8f, 0x26, 0x0e, 0x50, 0xae, 0xe1, 0xe9, 0x20, 0xc0, 0x28, 0xc6, 0x72,
+    0x62, 0xdd, 0x03, 0xa0, 0x33, 0x28, 0x40, 0x8d, 0xa4, 0x18, 0xad, 0x80, 0xd7, 0x46, 0x03, 0xac,
+    0xd0, 0x66, 0x8d, 0x18, 0xa0, 0xa1, 0x70, 0x41, 0xf2, 0x5a, 0x4a, 0xad, 0x3a, 0xa6, 0x9b, 0xcc,
+    0x0a, 0xc2, 0x80, 0x2a, 0x7b, 0xe9, 0x6d, 0x87, 0x6a, 0xd3, 0x5a, 0xdf, 0x78, 0x19, 0x01, 0x34,
+    0x87, 0x39, 0xa5, 0xf7, 0x8c, 0x01, 0xf8, 0x00, 0x0b, 0xd0, 0x0f, 0xa3, 0x02, 0x80, 0x24, 0x28,
+    0xc0, 0x9b, 0x42, 0xfa, 0xaf, 0x21, 0x07, 0x68, 0x6c, 0x74, 0xbc, 0x47, 0x90, 0x56, 0xc3, 0x6d,
+    0x8f, 0x3a, 0xb3, 0x68, 0x3c, 0x40, 0x5a, 0x31, 0x52, 0x20, 0x44, 0x1a, 0x81, 0x27, 0x54, 0xcb,
+    0xe3, 0x8e, 0xcb, 0xd2, 0x3e, 0x53, 0x31, 0xd8, 0xab, 0x38, 0x04, 0x90, 0x50, 0x37, 0xa4, 0x00,
+    0x08, 0x01, 0x0b, 0x30, 0x5e, 0x37, 0x06, 0x00, 0x00, 0x2a, 0x40, 0x6c, 0x4c, 0x0d, 0x83, 0xa2,
+    0x06, 0x7c, 0x04, 0x05, 0x17, 0x43, 0x14, 0x53, 0x2b, 0x7e, 0xec, 0x3d, 0x6a, 0x7b, 0x3e, 0x80,
+    0x39, 0xb6, 0xe0, 0x93, 0x8c, 0xea, 0x34, 0xa1, 0x4c, 0x9d, 0xc2, 0xcc, 0x0c, 0x02, 0x2a, 0xe5,
+    0x30, 0x58, 0x00, 0x3c, 0x83, 0x02, 0x9c, 0x17, 0x0e, 0x27, 0x10, 0x78, 0xe0, 0x25, 0x14, 0x8b,
+    0xca, 0xe2, 0x70, 0x35, 0xda, 0xfd, 0xce, 0x0b, 0x2e, 0x66, 0x34, 0xac, 0x05, 0x83, 0x55, 0x97,
+    0xa2, 0x51, 0xb3, 0x8a, 0x67, 0xc7, 0x3e, 0xb3, 0x2e, 0x40, 0xa4, 0xce, 0x03, 0xc1, 0x64, 0x6b,
+    0xb4, 0x13, 0x2a, 0x40, 0x0c, 0x00, 0x10, 0xb0, 0x00, 0x3b, 0x96, 0x5a, 0x00, 0x4a, 0xc0, 0x02,
+    0x7c, 0x31, 0x71, 0xce, 0x21, 0x6c, 0x8d, 0xe7, 0xa7, 0xa7, 0x50, 0x2e, 0x59, 0x01, 0xdc, 0xaa,
+    0x64, 0x71, 0x23, 0x07, 0xd4, 0x9e, 0x57, 0x94, 0x8b, 0x93, 0xa6, 0x0e, 0x70, 0x76, 0x42, 0x3d,
+    0x20, 0xc0, 0x2a, 0x06, 0x93, 0x67, 0x21, 0x08, 0xa0, 0x3b, 0x98, 0x49, 0x77, 0x9e, 0xaf, 0xa9,
+    0xa0, 0xd7, 0x36, 0x0a, 0x7c, 0xaa, 0x69, 0x0d, 0x19, 0x98, 0x05, 0xf0, 0x78, 0xfb, 0x5a, 0x4c,
+    0x2d, 0xca, 0xa5, 0x38, 0x9a, 0x0a, 0xca, 0x00, 0x6b, 0x74, 0x61, 0x06, 0x87, 0x8a, 0x63, 0x66,
+    0xc1, 0xd8, 0x63, 0x04, 0xb4, 0x87, 0x41, 0xc5, 0x77, 0x03, 0x01, 0xf8, 0x02, 0x0a, 0x50, 0x8f,
+    0xf0, 0x06, 0x80, 0x2c, 0x28, 0x00, 0x9a, 0x06, 0x92, 0xad, 0x41, 0x07, 0x60, 0x5d, 0x6c, 0x16,
+    0x3a, 0x10, 0x57, 0xb3, 0xb1, 0x6f, 0xad, 0x68, 0x68, 0x3e, 0x80, 0x0a, 0xb0, 0x24, 0x4d, 0x45,
+    0x22, 0x0d, 0xe9, 0x55, 0x8b, 0x36, 0x92, 0xeb, 0xd2, 0x46, 0x6d, 0xf1, 0x38, 0xb6, 0xb8, 0x04,
+    0xd0, 0x4c, 0x17, 0xbf, 0x01, 0x08, 0x03, 0x0a, 0xd0, 0xdd, 0x08, 0x04, 0x00, 0x08, 0x2a, 0x00,
+    0x74, 0x88, 0xc3, 0x83, 0xc2, 0x06, 0x7a, 0x0f, 0xc5, 0x66, 0x44, 0x94, 0x53, 0x03, 0xc2, 0xac,
+    0x66, 0x63, 0x7b, 0x40, 0xa0, 0x29, 0xb8, 0xb0, 0x71, 0x8c, 0xf2, 0xb4, 0x23, 0x4a, 0x01, 0x35,
+    0xcb, 0x2c, 0x02, 0x2c, 0xee, 0x48, 0x32, 0x00, 0xbc, 0x83, 0x02, 0xd8, 0xf7, 0x44, 0x01, 0x18,
+    0x01, 0x0b, 0xd0, 0x63, 0x3d, 0x02, 0x41, 0xe8, 0x01, 0x14, 0x47, 0x68, 0x00, 0x8b, 0xe3, 0xd5,
+    0x66, 0x3c, 0x8c, 0x8f, 0xb4, 0x18, 0x12, 0xd0, 0x72, 0x2b, 0xb4, 0x46, 0x8a, 0x48, 0xed, 0xca,
+    0x23, 0x07, 0x09, 0xcd, 0xc2, 0x80, 0x94, 0x2e, 0x11, 0x16, 0x91, 0xcd, 0xd1, 0x52, 0xae, 0x00,
+    0x0b, 0x00, 0xc0, 0x80, 0x02, 0xd8, 0xd8, 0xc4, 0x00, 0x28, 0x03, 0x0a, 0xc0, 0xc9, 0x56, 0x9e,
+    0x87, 0xb8, 0x35, 0x5d, 0x8b, 0x5c, 0x16, 0xb9, 0x84, 0x05, 0x68, 0xe4, 0xc2, 0x1d, 0x95, 0x9c,
+    0x50, 0x83, 0x2a, 0x90, 0x6b, 0x5b, 0x9a, 0x3c, 0x40, 0x5a, 0x0d, 0x5b, 0x95, 0x00, 0xb3, 0x18,
+    0x8d, 0x86, 0x79, 0x31, 0x82, 0x0e, 0x61, 0x3a, 0x5c, 0x99, 0x99, 0x8e, 0x02, 0x5f, 0x7b, 0x64,
+    0xd0, 0x10, 0x8e, 0x35, 0x66, 0x60, 0x06, 0xbd, 0xba, 0xc3, 0x6b, 0x39, 0xb5, 0xa6, 0x97, 0x62,
+    0xdb, 0x28, 0x48, 0x03, 0xac, 0xa7, 0x7d, 0x6b, 0x19, 0xaa, 0x8e, 0xc1, 0xad, 0x62, 0xf9, 0x1e,
+    0xd0, 0x20, 0x26, 0xa5, 0x5f, 0xec, 0x01, 0xe0, 0x13, 0x28, 0x00, 0x3b, 0xb8, 0x10, 0x00, 0xd2,
+    0xa0, 0x00, 0x53, 0xb2, 0x27, 0xac, 0x86, 0x1d, 0x58, 0x3d, 0xd1, 0x80, 0xaf, 0x40, 0x5e, 0x8d,
+    0x96, 0xbf, 0x89, 0x78, 0xa0, 0x01, 0x81, 0x6b, 0xba, 0x9c, 0x0b, 0x1a, 0xa9, 0x04, 0xa8, 0x60,
+    0x75, 0x35, 0x55, 0x2e, 0x4c, 0x3b, 0xc1, 0x85, 0x60, 0xf8, 0xe2, 0x14, 0x00, 0x44, 0xdd, 0x67,
+    0x04, 0x20, 0x14, 0x28, 0x00, 0x76, 0x49, 0x07, 0x00, 0x40, 0xa8, 0x00, 0x0e, 0x71, 0x09, 0x00,
+    0x4c, 0xc0, 0x02, 0xc4, 0x07, 0x5f, 0x47, 0x28, 0x6e, 0x80, 0x17, 0x51, 0x58, 0x4c, 0x44, 0x41,
+    0x35, 0x5e, 0xd1, 0xf6, 0x0c, 0xb5, 0x27, 0x04, 0x9c, 0x95, 0x5b, 0xe8, 0xc2, 0xa8, 0x4f, 0x5b,
+    0x82, 0x54, 0xb6, 0x86, 0xcc, 0x24, 0x00, 0x63, 0x0f, 0xc4, 0x00, 0xc0, 0x43, 0x3c, 0x40, 0x7b,
+    0xf1, 0x09, 0x80, 0x31, 0xa0, 0x00, 0x95, 0x36, 0x08, 0x17, 0x04, 0x1f, 0x08, 0x0d, 0x84, 0x2d,
+    0xb5, 0x38, 0x60, 0x4d, 0xe6, 0x47, 0x14, 0xf6, 0x8a, 0x29, 0x81, 0x2a, 0xaf, 0x0e, 0x21, 0xa3,
+    0xa8, 0xd4, 0xae, 0x92, 0x9a, 0x60, 0xce, 0xac, 0x0c, 0x78, 0x51, 0xb2, 0xbd, 0xea, 0xd8, 0x1e,
+    0x4d, 0x75, 0x0b, 0x63, 0x05, 0x00, 0x14, 0x28, 0xc0, 0x8b, 0xdb, 0x01, 0x80, 0x52, 0xa0, 0x00,
+    0xdf, 0x8c, 0xbe, 0x7e, 0x08, 0x5c, 0xbb, 0x75, 0x27, 0xdd, 0x84, 0x4b, 0x5a, 0x00, 0x16, 0x32,
+    0x6d, 0xc6, 0xc9, 0x11, 0x35, 0xe9, 0xef, 0x42, 0x4e, 0xa6, 0xe9, 0x03, 0xac, 0x13, 0xa1, 0x2c,
+    0x0b, 0xb0, 0x8b, 0xe9, 0xe8, 0x56, 0x7e, 0x3c, 0xe8, 0x12, 0x86, 0x04, 0x0c, 0x25, 0x06, 0x20,
+    0xf8, 0x29, 0x80, 0x8d, 0xa3, 0x1b, 0x80, 0x13, 0xb0, 0x00, 0x2f, 0x7c, 0xce, 0x56, 0x0d, 0x1a,
+    0x90, 0x5d, 0x2e, 0x63, 0xd6, 0x5a, 0x50, 0x0d, 0x99, 0x26, 0x6f, 0xa4, 0x09, 0xda, 0x00, 0xab,
+    0x5c, 0x17, 0x13, 0x85, 0xca, 0x63, 0x7c, 0xa4, 0x80, 0x99, 0x0c, 0xb4, 0x88, 0x51, 0x0d, 0x98,
+    0xb5, 0x01, 0xf8, 0x06, 0x0a, 0x30, 0x8e, 0x66, 0x01, 0x80, 0x3c, 0x28, 0x40, 0x8b, 0xea, 0x41,
+    0xa8, 0x81, 0x07, 0x48, 0x43, 0xcc, 0x38, 0x1d, 0x10, 0x98, 0x91, 0xf5, 0xaf, 0x5b, 0x2f, 0x68,
+    0x42, 0x26, 0x1b, 0x2d, 0xa1, 0xc0, 0x47, 0x32, 0x01, 0xab, 0x5a, 0x6d, 0x84, 0x98, 0x2b, 0xd3,
+    0x58, 0x64, 0xd1, 0xe6, 0xc5, 0xb8, 0x05, 0x20, 0x59, 0xd7, 0x77, 0x00, 0x08, 0x07, 0x0a, 0x50,
+    0xdd, 0x98, 0x06, 0x00, 0x18, 0x2a, 0x80, 0x43, 0x40, 0x15, 0x00, 0x33, 0xa0, 0x00, 0x10, 0x5a,
+    0xb1, 0x13, 0x0a, 0x1c, 0xd0, 0x31, 0x34, 0x8e, 0x10, 0x51, 0x52, 0x0d, 0xe7, 0x35, 0xe8, 0xe8,
+    0xec, 0x11, 0x81, 0xa7, 0xe7, 0x3a, 0x11, 0x2f, 0x0a, 0xd4, 0x9e, 0x1c, 0x95, 0x07, 0x13, 0xb3,
+    0x09, 0xd0, 0x94, 0xe6, 0x77, 0xf3, 0xf1, 0x12, 0xad, 0x52, 0x5e, 0xef, 0x06, 0x60, 0x14, 0x28,
+    0x40, 0xae, 0x15, 0xc1, 0x07, 0xe1, 0x07, 0x2c, 0xf9, 0xd8, 0x24, 0x2f, 0x8e, 0x58, 0x93, 0xe9,
+    0x32, 0x0c, 0xa7, 0x62, 0x4c, 0x00, 0x6a, 0x2a, 0xbc, 0x7c, 0x28, 0x32, 0x35, 0x2c, 0xb8, 0x34,
+    0xb0, 0x31, 0x4b, 0x03, 0x6a, 0x77, 0x5c, 0x86, 0x30, 0x36, 0x48, 0x5b, 0x01, 0x43, 0xc5, 0x00,
+    0x00, 0x07, 0x0a, 0x60, 0xe2, 0xde, 0x04, 0xa0, 0x1c, 0x28, 0x80, 0x49, 0x13, 0x46, 0x20, 0x22,
+    0xd7, 0x68, 0x90, 0x51, 0x14, 0xdd, 0x12, 0x17, 0x60, 0x85, 0x0d, 0x00, 0x8d, 0x72, 0x46, 0x8d,
+    0x7a, 0xb7, 0x66, 0xa9, 0x69, 0x02, 0x81, 0xac, 0x55, 0x24, 0x61, 0x03, 0x0c, 0x63, 0x40, 0x62,
+    0x95, 0xea, 0x14, 0x3a, 0x85, 0x49, 0xdd, 0xc2, 0xec, 0x00, 0x08, 0x80, 0x0a, 0xb0, 0x63, 0x61,
+    0x04, 0xe0, 0x0c, 0x28, 0x40, 0x13, 0x1b, 0xaa, 0x50, 0xa3, 0x06, 0x62, 0x57, 0x33, 0xe6, 0xa9,
+    0x96, 0x54, 0x1b, 0xfa, 0x09, 0x81, 0x38, 0x82, 0x38, 0xe0, 0x4a, 0x53, 0xca, 0xc2, 0xa0, 0xfa,
+    0x98, 0x61, 0x2b, 0x3c, 0x99, 0x04, 0x4d, 0x62, 0x54, 0x0d, 0xae, 0x4b, 0x00, 0x3e, 0x82, 0x02,
+    0x60, 0x43, 0x68, 0x01, 0x20, 0x11, 0x0a, 0xe0, 0x1e, 0x88, 0x4d, 0x69, 0xe8, 0x01, 0x8e, 0x0e,
+    0x37, 0xa4, 0x03, 0x24, 0x66, 0x62, 0xf8, 0x23, 0x35, 0x1d, 0x1a, 0x91, 0xa9, 0xe6, 0xca, 0x56,
+    0x45, 0x92, 0x4e, 0xe0, 0x2a, 0xd7, 0xf1, 0xed, 0xe6, 0xd2, 0x34, 0x18, 0x54, 0x1e, 0x51, 0x33,
+    0x8e, 0x01, 0x4e, 0xd9, 0x55, 0x66, 0x00, 0x42, 0x82, 0x02, 0x4c, 0x37, 0x13, 0x01, 0x00, 0x88,
+    0x0a, 0xc0, 0x10, 0xf6, 0x02, 0xc0, 0x14, 0x28, 0xc0, 0x8a, 0xe2, 0x62, 0x85, 0x22, 0x07, 0x70,
+    0x03, 0xcd, 0x00, 0x43, 0x14, 0x55, 0xa3, 0xe1, 0x8d, 0x69, 0x23, 0x7b, 0x46, 0x00, 0xda, 0x39,
+    0x10, 0x52, 0x8b, 0x0a, 0x35, 0x29, 0x46, 0xbf, 0xb4, 0xc0, 0x8c, 0x02, 0x38, 0xe2, 0xe9, 0xba,
+    0x7d, 0x3c, 0x45, 0xf3, 0x78, 0x37, 0x18, 0x01, 0x18, 0x07, 0x0a, 0x80, 0x5f, 0x5f, 0x06, 0x40,
+    0x00, 0x2a, 0x80, 0x3f, 0xac, 0x9b, 0x8c, 0x43, 0xd6, 0x64, 0xf0, 0x94, 0x25, 0xa4, 0x98, 0x13,
+    0x58, 0x6e, 0x6a, 0x8a, 0x0e, 0x8a, 0x4e, 0x0d, 0x6b, 0xb2, 0x1a, 0xb2, 0xcb, 0xda, 0x80, 0xdd,
+    0x18, 0x5d, 0xb3, 0x89, 0x2d, 0xd2, 0x56, 0xca, 0xe0, 0x0c, 0x00, 0x40, 0x82, 0x02, 0x70, 0xf8,
+    0x8e, 0x00, 0x28, 0x09, 0x0a, 0x20, 0x57, 0x30, 0x1e, 0x88, 0xd0, 0xb5, 0x58, 0x51, 0x4e, 0x38,
+    0xb6, 0xe4, 0x05, 0x50, 0xa3, 0xd3, 0x99, 0xa8, 0x1c, 0x12, 0xbc, 0xca, 0x6c, 0x8e, 0x6f, 0x9a,
+    0x42, 0x00, 0xcb, 0x19, 0xe0, 0x0c, 0x01, 0xcb, 0x18, 0x92, 0x44, 0x3d, 0x51, 0x86, 0x6e, 0x61,
+    0x5a, 0xae, 0x80, 0x13, 0x00, 0x82, 0xa0, 0x02, 0xfc, 0x78, 0x73, 0x00, 0x38, 0x05, 0x0a, 0x30,
+    0x47, 0x29, 0xa0, 0xd2, 0xb0, 0x01, 0x98, 0xc4, 0xb0, 0x70, 0xa6, 0x45, 0xd5, 0x7e, 0x9c, 0x1a,
+    0xea, 0x7f, 0xa0, 0x0e, 0xb8, 0xc2, 0x73, 0x31, 0x04, 0xa8, 0x40, 0xe6, 0x98, 0x8c, 0xf2, 0x9b,
+    0x41, 0x9b, 0x1c, 0xd5, 0x85, 0x71, 0x0a, 0x80, 0xaf, 0xa0, 0x00, 0xce, 0x20, 0x2d, 0x00, 0xc8,
+    0x84, 0x02, 0x14, 0x26, 0xe5, 0x16, 0x1a, 0x7c, 0x00, 0x52, 0x43, 0x90, 0x15, 0x00, 0x91, 0x01,
+    0x98, 0xfa, 0xea, 0xa4, 0x8b, 0x66, 0x94, 0xa2, 0xa4, 0x6a, 0x30, 0xa6, 0x24, 0x14, 0xc0, 0xce,
+    0xf5, 0xf3, 0xee, 0xb9, 0x36, 0xad, 0x66, 0x93, 0x18, 0x3a, 0x8d, 0x6b, 0x00, 0x95, 0x77, 0xbb,
+    0x0f, 0x80, 0xb0, 0xa0, 0x00, 0xd3, 0x3d, 0x1f, 0x00, 0x80, 0xa2, 0x02, 0x20, 0xc4, 0x23, 0x00,
+    0x30, 0x07, 0x0a, 0x00, 0x24, 0x6f, 0x7d, 0xa1, 0xd0, 0x01, 0x1b, 0x3e, 0x65, 0x73, 0x10, 0x65,
+    0xd5, 0x60, 0x92, 0x63, 0x36, 0xc3, 0x1e, 0xd2, 0x90, 0x56, 0x0e, 0xb5, 0xb9, 0xa2, 0x44, 0xcd,
+    0x9a, 0xd1, 0xe7, 0x0a, 0x2f, 0xab, 0x80, 0xcf, 0x80, 0xd8, 0x25, 0x1e, 0x6f, 0xd1, 0x48, 0xd8,
+    0x8d, 0x1d, 0x00, 0x46, 0x82, 0x02, 0xbc, 0x37, 0x0c, 0x01, 0x10, 0x82, 0x0a, 0x20, 0x91, 0x79,
+    0x6c, 0xe3, 0x98, 0x35, 0x19, 0x47, 0x21, 0xe2, 0x27, 0x06, 0x05, 0x8c, 0x99, 0xea, 0x69, 0x80,
+    0x22, 0x54, 0xc3, 0x8e, 0xed, 0x0a, 0xb4, 0xb2, 0x38, 0x20, 0x78, 0xc5, 0x3f, 0xca, 0x61, 0x93,
+    0x98, 0x15, 0x35, 0x52, 0x16, 0x00, 0xb0, 0xa0, 0x00, 0x12, 0xee, 0x69, 0x00, 0xca, 0x82, 0x02,
+    0x08, 0x57, 0xf7, 0xfe, 0x21, 0x76, 0x8d, 0xf5, 0x0f, 0xd1, 0x3b, 0x2d, 0x81, 0x81, 0x92, 0xf9,
+    0x32, 0x19, 0x2b, 0xa7, 0xd4, 0xb4, 0xf3, 0x92, 0xbf, 0x9b, 0x26, 0x11, 0xb0, 0x96, 0xc7, 0x9f,
+    0x50, 0xc0, 0x34, 0x06, 0xa5, 0x4c, 0xee, 0xc9, 0xa1, 0x63, 0x98, 0x18, 0x2a, 0xf0, 0x16, 0x80,
+    0x40, 0xa8, 0x00, 0x40, 0x76, 0x63, 0x00, 0xce, 0x81, 0x02, 0x84, 0xb2, 0x36, 0x3d, 0x34, 0x6e,
+    0xe0, 0x85, 0x2c, 0xee, 0x61, 0x68, 0x59, 0x35, 0x9d, 0xb0, 0xe0, 0xb0, 0x1b, 0xc8, 0x03, 0xb0,
+    0xa7, 0x1c, 0x5c, 0x0e, 0xaa, 0x10, 0x60, 0xc2, 0xe3, 0x60, 0x88, 0xd0, 0x28, 0x6d, 0x15, 0xe2,
+    0x7b, 0x00, 0xe0, 0x33, 0x28, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x52, 0xa1, 0x00, 0xe4, 0x00, 0x1b,
+    0x00, 0x86, 0x9f, 0x02, 0xcc, 0x30, 0xc1, 0x3a, 0x40, 0x66, 0xe0, 0x05, 0x3d, 0x2c, 0xf6, 0xa3,
+    0x21, 0xb5, 0x26, 0xa5, 0xb6, 0xa2, 0x2e, 0x29, 0x05, 0xb2, 0x6c, 0x35, 0x1b, 0x89, 0x2e, 0x4e,
+    0xd3, 0x65, 0xa4, 0xbb, 0x69, 0xe3, 0x1c, 0x80, 0x45, 0x5e, 0x7d, 0x01, 0x20, 0x34, 0x28, 0x00,
+    0x75, 0x61, 0x1a, 0x00, 0xc0, 0xa8, 0x00, 0x03, 0x51, 0x52, 0x00, 0x4c, 0x82, 0x02, 0x30, 0x09,
+    0xca, 0x6a, 0x28, 0x76, 0x60, 0xc6, 0xce, 0x8e, 0x02, 0x44, 0x61, 0x35, 0x56, 0xea, 0xd6, 0xa4,
+    0xaf, 0xa7, 0x04, 0xa8, 0x86, 0x4b, 0x48, 0xa7, 0xa8, 0x51, 0xcb, 0x72, 0x34, 0x2c, 0x7c, 0xcb,
+    0x2c, 0x60, 0x24, 0xa1, 0x3d, 0x0e, 0xc7, 0x63, 0xb4, 0x14, 0x75, 0x83, 0x19, 0x80, 0xb1, 0xa0,
+    0x00, 0xe7, 0x35, 0x20, 0x00, 0x04, 0xa1, 0x02, 0x1c, 0xe4, 0x69, 0x00, 0x40, 0x01, 0x0b, 0xe0,
+    0x92, 0x00, 0xc2, 0xe3, 0xa0, 0x35, 0xd9, 0x4f, 0x1d, 0x57, 0x27, 0x26, 0x05, 0x80, 0xa1, 0xaa,
+    0xc0, 0x7d, 0xa2, 0x14, 0xc4, 0x5a, 0x6e, 0x52, 0x79, 0xb2, 0x3a, 0xe0, 0x38, 0xc5, 0xae, 0x46,
+    0x61, 0x9b, 0x18, 0x96, 0x37, 0x54, 0x0d, 0x00, 0xd0, 0xa0, 0x00, 0x07, 0x8e, 0x3f, 0x00, 0x4a,
+    0x83, 0x02, 0x5c, 0x98, 0x64, 0xee, 0x21, 0x78, 0xed, 0xe4, 0x8b, 0x89, 0xf1, 0x2c, 0x89, 0x01,
+    0x11, 0x0a, 0xfb, 0x6f, 0x2b, 0xc7, 0xd4, 0xae, 0xba, 0xea, 0x9a, 0x9a, 0xa6, 0x11, 0xa0, 0xba,
+    0x28, 0x0b, 0x5a, 0xc0, 0x36, 0x86, 0xb5, 0xc8, 0x8b, 0xfe, 0xa1, 0x6b, 0x98, 0x59, 0x29, 0x8c,
+    0x18, 0x00, 0x11, 0xb0, 0x00, 0xa3, 0xe0, 0x32, 0x00, 0x82, 0xa1, 0x02, 0xfc, 0xf8, 0xe3, 0x00,
+    0x38, 0x09, 0x0a, 0x80, 0x4d, 0x89, 0x2a, 0xcf, 0xc0, 0x81, 0x16, 0x9f, 0xc0, 0x3a, 0x9c, 0x85,
+    0xd5, 0x6c, 0xf0, 0x22, 0x1d, 0x5c, 0xa0, 0x0f, 0xc8, 0x76, 0x71, 0xeb, 0x7a, 0xa8, 0x44, 0x00,
+    0x0a, 0x92, 0x12, 0xc6, 0x42, 0xab, 0x34, 0xd6, 0xa3, 0x69, 0x11, 0x9e, 0xef, 0x00, 0x20, 0xb9,
+    0x88, 0x43, 0x00, 0xc8, 0x85, 0x02, 0x68, 0xc3, 0xa4, 0x01, 0x18, 0x80, 0x0a, 0x70, 0xc3, 0x75,
+    0xb0, 0x01, 0xa1, 0x01, 0x17, 0xeb, 0x5a, 0x90, 0x93, 0xa6, 0xd4, 0x92, 0x8a, 0x7a, 0x55, 0xce,
+    0x24, 0x15, 0xd0, 0x6a, 0x35, 0xa9, 0x5b, 0xba, 0x3a, 0xcd, 0xe7, 0x8f, 0xba, 0xfc, 0x8d, 0x7b,
+    0x80, 0xd6, 0x7a, 0x71, 0x18, 0x80, 0xf0, 0xa0, 0x00, 0xd7, 0x65, 0x42, 0x00, 0x80, 0x23, 0x03,
+    0xf0, 0x63, 0xa9, 0x00, 0x30, 0x0b, 0x0a, 0xd0, 0xa4, 0xec, 0xe0, 0xa1, 0xe0, 0x81, 0x97, 0x38,
+    0xd9, 0xa0, 0x0f, 0xa5, 0xd5, 0x52, 0xbd, 0x8b, 0x61, 0xbb, 0x1e, 0x13, 0xb8, 0xce, 0x2d, 0x8b,
+    0x84, 0xa2, 0x48, 0x10, 0x3b, 0x52, 0x8f, 0xe5, 0x2c, 0xbb, 0x80, 0xd3, 0x84, 0xda, 0x8f, 0x19,
+    0xaf, 0xd1, 0x5c, 0xd2, 0x8d, 0x3e, 0x00, 0x46, 0x83, 0x02, 0x80, 0x17, 0xb7, 0x01, 0x10, 0x86,
+    0x0a, 0xa0, 0x10, 0x5e, 0x06, 0x00, 0x0d, 0x28, 0x00, 0x54, 0x26, 0xba, 0x90, 0xa3, 0xd6, 0x62,
+    0x57, 0xe5, 0xbf, 0x9c, 0x18, 0x15, 0xd8, 0xc5, 0xca, 0x5d, 0xf0, 0x89, 0x54, 0x2d, 0xeb, 0xbb,
+    0x5f, 0xfb, 0xc8, 0xf2, 0x00, 0xa6, 0x15, 0x59, 0x30, 0x83, 0x8d, 0x62, 0x58, 0xe8, 0x60, 0x11,
+    0x00, 0xc0, 0x83, 0x02, 0xf4, 0x37, 0x55, 0x00, 0x28, 0x0f, 0x0a, 0x20, 0x67, 0x57, 0x56, 0x87,
+    0xe8, 0xb5, 0xd0, 0x20, 0x36, 0xd9, 0xb2, 0x44, 0x06, 0x40, 0x69, 0xc4, 0x9b, 0xab, 0x9c, 0x53,
+    0xa3, 0x22, 0x2a, 0x99, 0x61, 0x9a, 0x48, 0x60, 0x7a, 0xa7, 0xf0, 0x8c, 0x01, 0xe3, 0x98, 0xd8,
+    0x14, 0x61, 0xb0, 0x88, 0xce, 0x61, 0x6c, 0xaa, 0x98, 0x3c, 0x00, 0xc4, 0x80, 0x02, 0x84, 0x82,
+    0x25, 0x00, 0x08, 0x88, 0x0a, 0xb0, 0x63, 0xde, 0x00, 0xe0, 0x2c, 0x28, 0x80, 0x45, 0xfb, 0x80,
+    0x35, 0x23, 0x07, 0x54, 0x2f, 0x12, 0xc6, 0x5a, 0x96, 0x56, 0x8b, 0x95, 0x2c, 0x9e, 0x23, 0x81,
+    0x40, 0x40, 0x1b, 0x41, 0x92, 0x19, 0xa3, 0x1a, 0x0d, 0xaa, 0x55, 0x48, 0x0e, 0x0e, 0xcd, 0xd2,
+    0x5a, 0x3c, 0xc6, 0x94, 0x8a, 0x3e, 0x04, 0xe0, 0xc0, 0x22, 0x5a, 0x00, 0x20, 0x19, 0x0a, 0x00,
+    0x8d, 0x6b, 0x04, 0x60, 0x08, 0x2a, 0x00, 0x10, 0xb3, 0x93, 0x09, 0xa4, 0x06, 0x5c, 0x7e, 0xd3,
+    0x1f, 0x5a, 0x1a, 0x53, 0x23, 0x1e, 0xea, 0xbd, 0x7c, 0x93, 0x56, 0x40, 0xcb, 0x53, 0x8b, 0x44,
+    0xea, 0xf2, 0xb4, 0x61, 0x3a, 0x32, 0x2a, 0x39, 0x0e, 0x02, 0x5c, 0xf4, 0x55, 0x3b, 0x00, 0x42,
+    0x84, 0x02, 0xcc, 0x23, 0x07, 0x00, 0x30, 0x0d, 0x0a, 0x10, 0xa4, 0xc5, 0x2d, 0xa2, 0xe8, 0x01,
+    0x95, 0x36, 0x57, 0x73, 0x0f, 0xc5, 0xd5, 0x4c, 0xca, 0x23, 0x40, 0xba, 0x9e, 0x13, 0xd0, 0x72,
+    0x4d, 0xb4, 0x6d, 0xa2, 0x4a, 0xcd, 0xaa, 0x52, 0x77, 0xeb, 0x2b, 0xc3, 0x80, 0x15, 0x82, 0x98,
+    0xc6, 0x16, 0xcf, 0xd1, 0x62, 0xd2, 0xa5, 0x17, 0x00, 0xc6, 0x83, 0x02, 0x68, 0xf7, 0x2a, 0x01,
+    0x10, 0x88, 0x0a, 0xd0, 0x90, 0x06, 0x04, 0x00, 0x15, 0x28, 0x40, 0x5d, 0x22, 0x90, 0x92, 0xc3,
+    0xd6, 0x60, 0x66, 0x4d, 0x23, 0x9e, 0x98, 0x15, 0xa8, 0x21, 0xcb, 0x7b, 0xef, 0x89, 0x56, 0x2d,
+    0xcb, 0x3d, 0x74, 0x31, 0xc8, 0xfa, 0x80, 0xe8, 0x17, 0xff, 0xc5, 0x81, 0xad, 0x62, 0x58, 0xc2,
+    0x29, 0x63, 0x0f, 0x40, 0x84, 0xb9, 0xcc, 0xd7, 0x6e, 0x01, 0x28, 0x11, 0x0a, 0x90, 0xed, 0x06,
+    0xcc, 0x86, 0xf0, 0xb5, 0x0c, 0x14, 0x8e, 0xf0, 0xb1, 0x64, 0x06, 0x3e, 0xa8, 0xdc, 0x68, 0xa6,
+    0x1c, 0x54, 0x83, 0x7e, 0xc9, 0x02, 0x53, 0x9a, 0x4a, 0x40, 0xea, 0xab, 0xb9, 0x92, 0x01, 0xeb,
+    0x98, 0xda, 0x08, 0x75, 0x46, 0x89, 0xee, 0x61, 0x6e, 0xb2, 0xb0, 0x17, 0x00, 0x44, 0x81, 0x02,
+    0x80, 0x22, 0x3f, 0x01, 0x08, 0x8a, 0x0a, 0x50, 0x63, 0x2d, 0x05, 0xe0, 0x34, 0x28, 0x40, 0x57,
+    0x03, 0xd4, 0x2e, 0x43, 0x07, 0x4e, 0xe1, 0xa1, 0xa0, 0x45, 0x16, 0x57, 0x6b, 0x7d, 0x6d, 0x07,
+    0xd1, 0x80, 0x42, 0x00, 0x7b, 0x3c, 0x76, 0x6e, 0xa4, 0x22, 0x01, 0x6c, 0x64, 0x4e, 0xa4, 0x11,
+    0xed, 0xd2, 0x5e, 0xd5, 0x7d, 0xe1, 0x9e, 0xbe, 0x04, 0x20, 0xa5, 0x62, 0x69, 0x01, 0x20, 0x1b,
+    0x0a, 0x60, 0x0c, 0x3e, 0x02, 0x60, 0x10, 0x2a, 0x80, 0x8c, 0x69, 0x04, 0x80, 0x14, 0xb0, 0x00,
+    0x50, 0xd4, 0xa5, 0x2e, 0x10, 0x1b, 0x70, 0x19, 0x0d, 0xba, 0x8d, 0x69, 0x4e, 0xed, 0xd7, 0xa8,
+    0x95, 0xd0, 0x4e, 0x62, 0x01, 0xad, 0x44, 0xc3, 0x29, 0xac, 0xeb, 0xd3, 0x90, 0xde, 0x08, 0x86,
+    0xe8, 0xb8, 0x08, 0x78, 0xf5, 0xd7, 0x54, 0x00, 0x08, 0x13, 0x0a, 0xa0, 0x8e, 0x92, 0x04, 0xc0,
+    0x3c, 0x28, 0xc0, 0x88, 0x84, 0x4e, 0x8a, 0xc2, 0x07, 0x48, 0xd4, 0xec, 0xa5, 0x3c, 0x94, 0x57,
+    0x23, 0x45, 0xef, 0x7d, 0xec, 0x7a, 0x50, 0xe0, 0x5a, 0x34, 0x65, 0x64, 0x89, 0x32, 0x35, 0xea,
+    0x4c, 0xb1, 0x05, 0xac, 0x2c, 0x03, 0x5e, 0xf5, 0x69, 0x65, 0x4f, 0xbc, 0x47, 0xa3, 0x49, 0xf7,
+    0x86, 0x01, 0x18, 0x11, 0x0a, 0x60, 0x5d, 0x75, 0x02, 0x40, 0x28, 0x2a, 0x40, 0x43, 0x9a, 0x06,
+    0x00, 0x74, 0xa0, 0x00, 0x98, 0x81, 0x98, 0x52, 0x8e, 0x5b, 0x7b, 0xb5, 0x35, 0x19, 0x88, 0x62,
+    0x58, 0xe0, 0x35, 0xae, 0x62, 0xc3, 0x27, 0x62, 0x35, 0xed, 0xfb, 0x30, 0x5a, 0x1e, 0x0b, 0x04,
+    0xaa, 0x6b, 0x74, 0x5f, 0x03, 0x36, 0x8b, 0x61, 0x59, 0x68, 0x07, 0x79, 0x00, 0x13, 0x2d, 0xa4,
+    0x5e, 0x1f, 0x03, 0xa0, 0x4c, 0x28, 0xc0, 0xa0, 0x3f, 0xd6, 0x17, 0xe2, 0xd7, 0x18, 0x2e, 0xa0,
+    0xa4, 0xc4, 0x12, 0x1a, 0xe8, 0x88, 0x73, 0x18, 0x79, 0x72, 0x52, 0x8d, 0x09, 0x24, 0xac, 0xf9,
+    0x68, 0x32, 0x81, 0xa8, 0xc0, 0x42, 0xe2, 0x05, 0xcc, 0x63, 0x74, 0xfd, 0x13, 0x62, 0x28, 0x3a,
+    0x88, 0xc9, 0xe9, 0x02, 0x91, 0x01, 0x10, 0x07, 0x0a, 0x30, 0x0a, 0x51, 0x02, 0x20, 0x30, 0x2a,
+    0x40, 0x8b, 0xb3, 0x09, 0x80, 0xf3, 0xa0, 0x00, 0xab, 0xe5, 0x2b, 0xa1, 0x8c, 0x1d, 0x10, 0x51,
+    0xe6, 0xab, 0xc7, 0x58, 0x5e, 0x2d, 0xd5, 0x39, 0xc8, 0xf9, 0x01, 0x12, 0x01, 0x6b, 0xdf, 0x2c,
+    0xf1, 0x96, 0xaa, 0x04, 0xb2, 0xcf, 0xe9, 0x59, 0x56, 0x34, 0x4c, 0x8b, 0xd5, 0xb5, 0xfd, 0xd6,
+    0xfa, 0x14, 0x40, 0x45, 0x0a, 0xdf, 0x02, 0x80, 0x74, 0x28, 0x40, 0x2f, 0x26, 0x00, 0x80, 0x61,
+    0xa8, 0x00, 0x39, 0x56, 0x5e, 0x00, 0xd2, 0x80, 0x02, 0xa0, 0xd1, 0xb5, 0xd3, 0x40, 0x6e, 0xa0,
+    0x85, 0xb0, 0xc2, 0x7c, 0xa6, 0x41, 0x35, 0x5d, 0xa7, 0xf4, 0x14, 0x3e, 0xa9, 0x05, 0xb2, 0xe0,
+    0xcc, 0x04, 0xbc, 0x2e, 0x50, 0x63, 0x86, 0xa3, 0x4f, 0xb1, 0xe3, 0x24, 0x00, 0x46, 0x67, 0x21,
+    0x46, 0x25, 0x54, 0xb4, 0x05, 0x38, 0xe2, 0x07, 0x00, 0x13, 0xa1, 0x00, 0xee, 0x79, 0x98, 0x30,
+    0x8a, 0x1f, 0xe8, 0x3c, 0x93, 0xb8, 0xf1, 0x50, 0x60, 0x4d, 0xd4, 0x3c, 0x02, 0xef, 0xeb, 0x49,
+    0x81, 0x69, 0xcb, 0xb4, 0x67, 0x24, 0xea, 0xd4, 0xa6, 0x39, 0x85, 0x67, 0xa4, 0x32, 0x0d, 0xa0,
+    0x75, 0xe7, 0xfd, 0x0e, 0xf1, 0x20, 0xcd, 0x56, 0x5d, 0xbe, 0x03, 0x60, 0x4c, 0x28, 0xc0, 0x74,
+    0xe5, 0x00, 0x00, 0xc1, 0xa8, 0x00, 0x0c, 0x61, 0x64, 0x00, 0x50, 0x82, 0x02, 0xe0, 0x46, 0x85,
+    0x6f, 0x39, 0x70, 0xcd, 0x15, 0x57, 0x94, 0x85, 0x8a, 0x69, 0x81, 0x54, 0xc0, 0x70, 0x43, 0x9f,
+    0xa8, 0xd5, 0xb4, 0xf8, 0x53, 0x49, 0x72, 0xac, 0x10, 0xd0, 0xee, 0x51, 0xdb, 0x02, 0xd8, 0x2e,
+    0xa6, 0xb5, 0x24, 0x02, 0x8a, 0x02, 0x54, 0x34, 0xd4, 0x78, 0x1f, 0x02, 0x80, 0x52, 0xa1, 0x00,
+    0xff, 0x25, 0x35, 0x00, 0x08, 0xa0, 0x02, 0xe0, 0x63, 0x16, 0x01, 0x50, 0x01, 0x0b, 0x10, 0x83,
+    0xb4, 0x18, 0x2c, 0xa9, 0x81, 0x8e, 0x45, 0x03, 0x09, 0x25, 0x47, 0xd5, 0x8e, 0x2c, 0x0a, 0xe5,
+    0x88, 0xa6, 0x13, 0x80, 0x06, 0x6d, 0x5e, 0x4f, 0xc0, 0x3e, 0xe6, 0xf7, 0x3d, 0x97, 0xbb, 0xa2,
+    0x8b, 0x98, 0x1c, 0x31, 0x3a, 0x10, 0x00, 0x91, 0xa0, 0x00, 0xa7, 0x78, 0x6a, 0x00, 0x82, 0xa3,
+    0x02, 0x90, 0x38, 0xac, 0x01, 0x38, 0x11, 0x0a, 0x20, 0x60, 0x71, 0xa0, 0xc8, 0xe0, 0x81, 0x4e,
+    0x52, 0x0e, 0xf1, 0x87, 0x05, 0xd6, 0x4a, 0xdf, 0x4b, 0x68, 0x0b, 0xa0, 0x11, 0xa0, 0xda, 0xec,
+    0x85, 0xc4, 0xa9, 0x4c, 0xc0, 0x0a, 0xa1, 0x29, 0x83, 0x46, 0xcb, 0x34, 0x9a, 0x47, 0x59, 0x87,
+    0xb3, 0x6f, 0x01, 0x5e, 0xa1, 0x10, 0x02, 0x00, 0xc8, 0x87, 0x02, 0xd0, 0xa2, 0x34, 0x01, 0x18,
+    0x88, 0x0a, 0xe0, 0x63, 0x9a, 0x03, 0x20, 0x15, 0x28, 0xc0, 0x21, 0x37, 0x51, 0x0e, 0x04, 0x07,
+    0x58, 0xc2, 0x6a, 0x29, 0x68, 0x9a, 0x54, 0xab, 0xd9, 0x2a, 0xb7, 0xfa, 0x93, 0x5c, 0x20, 0x5b,
+    0x4a, 0x2b, 0x55, 0xec, 0x0a, 0x35, 0xe8, 0x3c, 0x36, 0x8c, 0x3b, 0x6e, 0x02, 0x60, 0xe1, 0x66,
+    0x05, 0x61, 0xc2, 0x45, 0xcb, 0x54, 0xe3, 0x97, 0x01, 0x30, 0x13, 0x0a, 0x00, 0x19, 0x83, 0x9e,
+    0xa3, 0x00, 0x02, 0x89, 0x33, 0x4d, 0x31, 0x0f, 0x25, 0xd6, 0x42, 0xbf, 0xc3, 0xd0, 0xc3, 0x1e,
+    0x15, 0x70, 0x5e, 0x8c, 0x9d, 0x37, 0xa2, 0x50, 0x4d, 0xaa, 0x53, 0x8a, 0x94, 0x29, 0xdb, 0x80,
+    0x5c, 0x70, 0x4a, 0x06, 0x0e, 0x2f, 0xd2, 0x70, 0xd9, 0x7d, 0x16, 0x00, 0x46, 0x85, 0x02, 0x48,
+    0x77, 0x3f, 0x01, 0x10, 0x8e, 0x0c, 0x90, 0x90, 0xd5, 0x03, 0x00, 0x2d, 0x28, 0x40, 0x74, 0x80,
+    0x2e, 0x99, 0x23, 0xd7, 0x58, 0x74, 0xf5, 0x3a, 0xaf, 0x18, 0x17, 0x10, 0x81, 0x4c, 0x59, 0xff,
+    0x89, 0x5c, 0x0d, 0x8b, 0xbf, 0x94, 0xda, 0xc6, 0x12, 0x01, 0xab, 0x23, 0xb9, 0x63, 0x80, 0x0d,
+    0x03, 0x5c, 0x6b, 0x72, 0x6e, 0x30, 0xc0, 0x45, 0x73, 0x71, 0xd7, 0x40, 0x01, 0x28, 0x17, 0x0a,
+    0x60, 0xdf, 0xef, 0x00, 0x80, 0x08, 0x2a, 0xc0, 0x3f, 0xdc, 0x07, 0x00, 0x35, 0xa0, 0x00, 0x51,
+    0x88, 0x5c, 0xbf, 0x12, 0x1b, 0xe0, 0x08, 0xb5, 0x0a, 0x20, 0x72, 0x56, 0x4d, 0x38, 0xa2, 0xe9,
+    0x03, 0x68, 0x42, 0x0d, 0xa8, 0xde, 0x96, 0x4d, 0x03, 0x0c, 0x64, 0x88, 0xcc, 0x6b, 0x90, 0x2f,
+    0x3a, 0xc9, 0xd1, 0x39, 0xc3, 0x79, 0x00, 0x10, 0x0b, 0x0a, 0xe0, 0x8a, 0xed, 0x03, 0x20, 0x40,
+    0x2a, 0x80, 0x86, 0x9d, 0x0f, 0x80, 0x33, 0xa1, 0x00, 0x5c, 0x2e, 0x4f, 0x75, 0x8c, 0x1e, 0xa8,
+    0x04, 0x64, 0x73, 0x3e, 0x58, 0x62, 0x46, 0x34, 0x42, 0x40, 0x9c, 0x00, 0x22, 0xa5, 0xe8, 0xbc,
+    0x92, 0x7b, 0xa1, 0xea, 0x04, 0xa6, 0x53, 0xaa, 0x0b, 0x7b, 0x34, 0x4d, 0xb3, 0x35, 0x53, 0xae,
+    0xa1, 0xfb, 0x18, 0x60, 0x06, 0x0a, 0x72, 0x04, 0x80, 0x84, 0x28, 0x40, 0x2b, 0x22, 0x0a, 0x80,
+    0xa1, 0xa8, 0x00, 0x41, 0x1e, 0x14, 0x00, 0xd2, 0x81, 0x02, 0xbc, 0x92, 0x72, 0xec, 0x40, 0x72,
+    0x60, 0x75, 0x27, 0x5f, 0x48, 0xa6, 0x51, 0x35, 0xd8, 0xb5, 0xfe, 0x81, 0x40, 0xe9, 0x05, 0xb0,
+    0x65, 0x84, 0xaf, 0xcb, 0x2e, 0x51, 0xab, 0x4a, 0x24, 0x35, 0xc0, 0xe3, 0x28, 0x20, 0x76, 0x67,
+    0x52, 0x95, 0x26, 0x64, 0xb4, 0x90, 0x32, 0xf0, 0x0e, 0x00, 0x53, 0xa1, 0x00, 0xea, 0x88, 0x49,
+    0x00, 0x8a, 0xa0, 0x02, 0x34, 0x73, 0x6e, 0xf6, 0x50, 0x64, 0x0d, 0x54, 0xba, 0x1e, 0xab, 0xec,
+    0x59, 0x81, 0x64, 0xc1, 0xbe, 0x8f, 0x22, 0x2a, 0xd5, 0xa2, 0x33, 0x5d, 0x2a, 0x90, 0x32, 0x0e,
+    0xf0, 0x8d, 0xe6, 0x8b, 0xb3, 0xf0, 0x24, 0x4d, 0xf7, 0x5d, 0x21, 0x06, 0x60, 0x5c, 0x28, 0x40,
+    0x41, 0x6c, 0x05, 0x00, 0xd4, 0xa0, 0x00, 0xe3, 0x41, 0x13, 0x6e, 0x0e, 0x5d, 0x4b, 0xf1, 0xb5,
+    0x6f, 0xde, 0x62, 0x5e, 0x60, 0xd3, 0x33, 0xf0, 0x2a, 0x28, 0x7a, 0xb5, 0x2b, 0xfc, 0x20, 0xe2,
+    0x1a, 0x6b, 0x34, 0xa4, 0xa2, 0x04, 0x58, 0x02, 0xb6, 0x0c, 0x80, 0xf5, 0x89, 0x2f, 0xd5, 0x00,
+    0x19, 0x6d, 0x76, 0xdd, 0x7d, 0x02, 0xa0, 0x64, 0x28, 0x40, 0x7b, 0x5b, 0x16, 0x00, 0x42, 0xa8,
+    0x00, 0x05, 0x99, 0x69, 0x00, 0x54, 0x81, 0x02, 0xe8, 0xa1, 0xe2, 0xf0, 0x4a, 0x6e, 0x60, 0x53,
+    0xd6, 0x25, 0xb5, 0xc7, 0x61, 0x35, 0x5f, 0x89, 0xfe, 0x65, 0x9d, 0x29, 0x05, 0xa0, 0xab, 0x8b,
+    0x15, 0x04, 0xb0, 0x90, 0x41, 0x02, 0x2f, 0x5f, 0xd1, 0xe8, 0x26, 0x4d, 0x87, 0x0d, 0xcd, 0x06,
+    0x40, 0x34, 0x28, 0x80, 0x2d, 0xbc, 0x04, 0x80, 0x20, 0xa9, 0x00, 0x0f, 0xce, 0x11, 0x00, 0x4e,
+    0x85, 0x02, 0x38, 0xb9, 0x56, 0x88, 0x31, 0x7c, 0x84, 0xd0, 0x0b, 0x56, 0x1e, 0x60, 0x91, 0x99,
+    0x0f, 0x1a, 0x1b, 0xc8, 0x06, 0xa8, 0x64, 0x9c, 0xb5, 0x22, 0x4a, 0x99, 0x2a, 0x14, 0x88, 0x62,
+    0xaa, 0x57, 0x3b, 0xd2, 0x36, 0x4d, 0x57, 0xc8, 0x8b, 0x24, 0xf0, 0x6b, 0x80, 0x9b, 0x28, 0x1a,
+    0x07, 0x00, 0x32, 0xa2, 0x00, 0xa7, 0x38, 0x03, 0x00, 0x06, 0x23, 0x03, 0x08, 0x59, 0x79, 0x01,
+    0x48, 0x09, 0x0a, 0xf0, 0x4d, 0x55, 0xbe, 0x03, 0xd1, 0x81, 0xd4, 0x89, 0x94, 0x94, 0x97, 0x66,
+    0xd5, 0x56, 0x02, 0xfb, 0x52, 0x02, 0x25, 0x18, 0xb8, 0x86, 0xb0, 0x2f, 0x36, 0xbb, 0x46, 0x2d,
+    0xcb, 0x13, 0x9a, 0x15, 0x8f, 0xab, 0x00, 0x19, 0x86, 0x87, 0xcc, 0x9b, 0xb0, 0xd1, 0x50, 0xbf,
+    0x60, 0x11, 0x00, 0xcc, 0x85, 0x02, 0x80, 0x43, 0x99, 0x00, 0x28, 0x84, 0x0a, 0x00, 0x4d, 0x21,
+    0xf6, 0x43, 0x99, 0xb5, 0xcf, 0xdf, 0xd8, 0x84, 0xb4, 0x87, 0x05, 0x88, 0xf8, 0x2a, 0x96, 0x86,
+    0x28, 0x55, 0x83, 0x86, 0xd4, 0x31, 0x22, 0xca, 0x3a, 0x60, 0x78, 0x18, 0xc3, 0x23, 0xc2, 0x9b,
+    0xa0, 0x5d, 0x79, 0x5b, 0x0f, 0x80, 0x91, 0xa1, 0x00, 0xff, 0x08, 0x5e, 0x00, 0xd0, 0x83, 0x02,
+    0xa4, 0xe7, 0x75, 0xdb, 0x39, 0x76, 0xcd, 0xf4, 0x58, 0xd1, 0xf6, 0x8b, 0x81, 0x81, 0x09, 0xd6,
+    0x12, 0xa2, 0xa1, 0x08, 0xd6, 0xaa, 0xe4, 0x7b, 0xd7, 0x6b, 0x2c, 0x12, 0x78, 0xde, 0xd2, 0xc6,
+    0x06, 0xd8, 0x34, 0x40, 0x16, 0xa8, 0x8a, 0x7a, 0x03, 0x6c, 0x34, 0x1c, 0x75, 0x17, 0x00, 0x80,
+    0xb2, 0xa1, 0x00, 0xe6, 0x3d, 0x33, 0x00, 0x88, 0xa1, 0x02, 0x24, 0x04, 0x0b, 0x01, 0x50, 0x07,
+    0x0a, 0x20, 0x8a, 0x39, 0x81, 0x2b, 0xc1, 0x01, 0x4d, 0x5f, 0x79, 0x8c, 0x1b, 0xa7, 0xd5, 0x70,
+    0x32, 0xb2, 0xe1, 0x69, 0x26, 0x15, 0x80, 0x52, 0x2f, 0x97, 0x1f, 0xc0, 0x44, 0xa0, 0xe9, 0xbb,
+    0xe5, 0xa2, 0xa3, 0xa3, 0xb4, 0x9d, 0x38, 0xce, 0x12, 0x00, 0xf1, 0xa0, 0x00, 0xc0, 0x30, 0x57,
+    0x00, 0x02, 0xa5, 0x02, 0x10, 0xf8, 0x55, 0x01, 0x38, 0x17, 0x0a, 0x40, 0xe2, 0xfd, 0x05, 0xc0,
+    0xf8, 0x29, 0x80, 0x1f, 0x3c, 0xef, 0x82, 0x65, 0x06, 0x38, 0xac, 0xd4, 0x6d, 0x2b, 0x20, 0x93,
+    0x59, 0xf6, 0xc9, 0x96, 0xac, 0xaa, 0x52, 0xe0, 0xc9, 0xad, 0x02, 0x23, 0x4a, 0xe3, 0xb4, 0x5e,
+    0x11, 0x5b, 0x09, 0xc7, 0xcf, 0x01, 0x72, 0xa6, 0xe8, 0x62, 0x00, 0x48, 0x89, 0x02, 0xfc, 0x38,
+    0xdd, 0x00, 0x48, 0x0b, 0x0a, 0x70, 0xd1, 0xdf, 0xb3, 0x03, 0xd9, 0x81, 0x53, 0x75, 0x54, 0x8b,
+    0x95, 0x86, 0xd5, 0x4a, 0x33, 0xeb, 0xad, 0xff, 0xa4, 0x18, 0xb0, 0x6a, 0xaf, 0x60, 0x31, 0xbb,
+    0x48, 0x10, 0xfb, 0x16, 0x53, 0x1b, 0x8f, 0xb3, 0x80, 0xd9, 0x6f, 0xa7, 0xa3, 0x9c, 0xd0, 0xd1,
+    0x5c, 0xb5, 0x78, 0x57, 0x00, 0x4c, 0x86, 0x02, 0x58, 0x23, 0x0d, 0x00, 0x28, 0x86, 0x0a, 0x40,
+    0x62, 0xda, 0x06, 0x60, 0x05, 0x2c, 0x40, 0x35, 0xf1, 0x8d, 0x10, 0x85, 0xd6, 0x3e, 0x4d, 0x73,
+    0xe5, 0xd9, 0x9e, 0x16, 0xf8, 0xc5, 0x2b, 0x76, 0x11, 0xa2, 0x56, 0x0d, 0x5a, 0xd0, 0xf3, 0x2d,
+    0x28, 0xf3, 0x00, 0x24, 0x5c, 0x52, 0x05, 0x06, 0x8f, 0x62, 0x76, 0xed, 0x1d, 0x19, 0x00, 0xc6,
+    0x86, 0x02, 0xe0, 0x03, 0xd5, 0x00, 0x40, 0x11, 0x0a, 0x10, 0x1e, 0x7f, 0xe3, 0xe7, 0xe0, 0xb5,
+    0x90, 0x6e, 0xaf, 0xb3, 0x30, 0x26, 0x46, 0x0e, 0x6e, 0xbb, 0x52, 0x8b, 0xa2, 0x58, 0x9b, 0x52,
+    0x4f, 0xd4, 0xb2, 0xb1, 0x4a, 0x80, 0xc9, 0x4c, 0xc2, 0x10, 0x60, 0xdb, 0x00, 0x9a, 0x9e, 0x34,
+    0x41, 0x0e, 0xd0, 0xd1, 0x78, 0xd2, 0xf5, 0x49, 0x00, 0x4a, 0x87, 0x02, 0x7c, 0xb7, 0x33, 0x00,
+    0x20, 0x88, 0x0a, 0xc0, 0x90, 0xb8, 0x01, 0x40, 0x25, 0x28, 0x40, 0x32, 0x9e, 0x17, 0xad, 0x24,
+    0x07, 0x30, 0x8a, 0x7d, 0x11, 0x60, 0x1c, 0x57, 0x9b, 0x19, 0x89, 0xeb, 0x70, 0x99, 0x56, 0xe0,
+    0x29, 0x3f, 0x5a, 0x44, 0x01, 0x1b, 0x0d, 0xe9, 0xf0, 0x3c, 0x01, 0x90, 0xae, 0xd2, 0x76, 0xa0,
+    0xc9, 0x2d, 0xae, 0x44, 0x04, 0x98, 0x28, 0x43, 0xab, 0x00, 0x08, 0x96, 0x0a, 0xa0, 0x5f, 0x8c,
+    0x02, 0xe0, 0x64, 0x28, 0x80, 0x86, 0x19, 0x0f, 0x00, 0x03, 0xa8, 0x00, 0x44, 0x70, 0x14, 0x16,
+    0x16, 0x1a, 0xd0, 0xc0, 0xf3, 0x2d, 0xdf, 0x80, 0x4e, 0xed, 0xc8, 0xa4, 0x0e, 0xb8, 0xab, 0x52,
+    0x01, 0xe7, 0xc7, 0xc2, 0xe2, 0x2c, 0xad, 0xd3, 0x82, 0x0c, 0x94, 0x01, 0x35, 0xbf, 0x07, 0xe0,
+    0xb5, 0xa2, 0xe6, 0x00, 0x20, 0x27, 0x0a, 0xb0, 0xe3, 0xf8, 0x00, 0x20, 0x35, 0x28, 0x40, 0x56,
+    0xc5, 0x85, 0x0e, 0x84, 0x07, 0x48, 0x80, 0x51, 0x07, 0x4c, 0x9a, 0x56, 0x03, 0xad, 0x4d, 0x25,
+    0xea, 0x93, 0x64, 0x80, 0x3a, 0x39, 0x37, 0x6b, 0xec, 0x2a, 0x35, 0xea, 0x69, 0x2c, 0x44, 0x3c,
+    0xee, 0x02, 0x6a, 0x6a, 0x35, 0xdb, 0x73, 0xc2, 0x47, 0x9b, 0xb5, 0x42, 0xb4, 0x00, 0x30, 0x1b,
+    0x0a, 0xc0, 0x8c, 0x0d, 0x05, 0xa0, 0x20, 0x2a, 0x40, 0x8b, 0x33, 0x12, 0x80, 0x35, 0xa0, 0x00,
+    0xdf, 0x3c, 0x0d, 0x45, 0x94, 0x5a, 0xf3, 0x40, 0x0c, 0x1c, 0x77, 0x7b, 0x5c, 0x20, 0x17, 0xaf,
+    0x43, 0x1b, 0x88, 0x62, 0xb5, 0x67, 0x37, 0x59, 0x50, 0x9f, 0xec, 0x03, 0x9a, 0x60, 0xf1, 0xde,
+    0x0e, 0xbc, 0x8a, 0xe1, 0x65, 0xb9, 0xad, 0x0f, 0x18, 0x1d, 0x80, 0xf1, 0x0e, 0xc3, 0x00, 0x00,
+    0x4d, 0x28, 0xc0, 0x71, 0xba, 0x84, 0xa0, 0xa3, 0xd7, 0x36, 0xd6, 0xd5, 0x2d, 0x00, 0x18, 0x99,
+    0x02, 0xf4, 0xad, 0xb5, 0x40, 0x8a, 0x64, 0x0d, 0x1a, 0xbc, 0x1c, 0xf1, 0xc6, 0x32, 0x81, 0xe4,
+    0x37, 0x0f, 0x56, 0x80, 0x8d, 0x63, 0x6e, 0x6b, 0xc2, 0x50, 0x3a, 0xc0, 0x47, 0xfb, 0x49, 0xf7,
+    0x8f, 0x00, 0x28, 0x1f, 0x0a, 0xa0, 0x5d, 0x6c, 0x05, 0x80, 0x28, 0x2a, 0x80, 0x43, 0x0c, 0x19,
+    0x00, 0xb5, 0xa0, 0x00, 0xea, 0x50, 0xb9, 0xae, 0x12, 0x1d, 0xb0, 0x40, 0x36, 0x86, 0x49, 0x71,
+    0x5e, 0xcd, 0x15, 0x26, 0x41, 0xd9, 0x64, 0x62, 0x81, 0x67, 0x02, 0x73, 0x49, 0x08, 0x8c, 0x04,
+    0xac, 0xcf, 0x1b, 0x4c, 0x47, 0x3a, 0x4b, 0xdb, 0x2d, 0x48, 0x3e, 0xe8, 0x12, 0x13, 0xe0, 0x43,
+    0x0d, 0xec, 0x06, 0x20, 0x60, 0x2a, 0x00, 0x7c, 0x25, 0x1b, 0x80, 0xb3, 0xa1, 0x00, 0x10, 0x56,
+    0x19, 0x00, 0x8c, 0xa0, 0x02, 0x38, 0xc0, 0x78, 0x7d, 0x58, 0x6a, 0x20, 0x03, 0x53, 0x9b, 0x1a,
+    0x04, 0x42, 0xb5, 0x61, 0x89, 0x1e, 0x73, 0xb2, 0x6a, 0x05, 0x9a, 0x5f, 0xfb, 0x56, 0xc3, 0x34,
+    0x4f, 0x2b, 0x72, 0x0f, 0x37, 0x2d, 0xfd, 0x20, 0xc0, 0x47, 0x0b, 0x12, 0x01, 0x80, 0xa4, 0x28,
+    0x00, 0x8d, 0xef, 0x15, 0x80, 0xf4, 0xa0, 0x00, 0xa2, 0xf5, 0x60, 0x39, 0x90, 0x1e, 0x00, 0xb1,
+    0x64, 0x41, 0x0b, 0x69, 0x5c, 0x4d, 0x83, 0x3a, 0x5d, 0x45, 0x4f, 0x9a, 0x01, 0xe9, 0xd2, 0x8c,
+    0xa3, 0xaf, 0xcb, 0xd4, 0xa2, 0xe5, 0xe9, 0xdc, 0xef, 0x38, 0x0c, 0xb8, 0x65, 0x94, 0xdb, 0xc6,
+    0x09, 0x21, 0xed, 0x66, 0x0a, 0x30, 0x00, 0xc0, 0x74, 0x28, 0x80, 0x30, 0x74, 0x0b, 0x80, 0xa2,
+    0xa8, 0x00, 0x34, 0x7e, 0x23, 0x00, 0x56, 0x81, 0x02, 0xbc, 0xf3, 0x4c, 0x25, 0x51, 0x6c, 0xcd,
+    0x73, 0x2c, 0x85, 0xe2, 0xed, 0x79, 0x81, 0x99, 0xbe, 0xb8, 0xe2, 0x1f, 0xaa, 0xd5, 0x9e, 0xaa,
+    0x3c, 0xa3, 0x78, 0x32, 0x10, 0x90, 0x6a, 0x45, 0xe0, 0x1a, 0xf0, 0x2c, 0x86, 0xd7, 0xea, 0xed,
+    0xcd, 0x60, 0x7c, 0x18, 0x8d, 0x39, 0xc6, 0x14, 0x00, 0x54, 0xa1, 0x00, 0x8e, 0x59, 0x5f, 0x80,
+    0x0e, 0x5f, 0x9b, 0x6c, 0x17, 0x1f, 0x00, 0x60, 0x66, 0x0a, 0x30, 0x38, 0x8c, 0x50, 0x29, 0x9a,
+    0xb5, 0xe6, 0xeb, 0x8a, 0x97, 0x1c, 0xeb, 0x04, 0x8e, 0xf0, 0xb4, 0xb4, 0x01, 0xb6, 0x8e, 0xd1,
+    0x5d, 0xc9, 0xae, 0xe8, 0x00, 0x21, 0x2d, 0x48, 0x5d, 0xf2, 0x06, 0xa0, 0x84, 0x28, 0xc0, 0x75,
+    0xf7, 0x0b, 0x00, 0xc2, 0xa8, 0x00, 0x0e, 0xd9, 0x3b, 0x00, 0x54, 0x83, 0x02, 0x0c, 0x44, 0x53,
+    0xa0, 0x4a, 0x76, 0x60, 0x12, 0x59, 0x0b, 0x3c, 0xc4, 0x81, 0x35, 0x14, 0xa0, 0x7c, 0xb7, 0x8f,
+    0xa9, 0x05, 0x9c, 0x14, 0xcc, 0x05, 0x2f, 0xb0, 0x12, 0xc8, 0x7e, 0x4f, 0x8c, 0x3a, 0xe9, 0x2e,
+    0x8d, 0xe7, 0xa4, 0x19, 0x0e, 0x4c, 0x54, 0x80, 0xd3, 0x37, 0x90, 0x10, 0x80, 0xa0, 0xa9, 0x00,
+    0xe8, 0x3d, 0x40, 0x00, 0x4e, 0x87, 0x02, 0x18, 0x98, 0x9c, 0x01, 0x30, 0x84, 0x0a, 0x30, 0x8f,
+    0x80, 0x05, 0x80, 0x05, 0x2c, 0x00, 0x00, 0xcc, 0xd7, 0x89, 0xc5, 0x06, 0x2e, 0x6d, 0xbd, 0x08,
+    0x48, 0xa0, 0x54, 0xf3, 0x1d, 0xc8, 0x9d, 0x56, 0xab, 0x58, 0x80, 0xc9, 0x39, 0x30, 0xe3, 0x4c,
+    0xfb, 0xb4, 0x64, 0xed, 0x3c, 0x4a, 0xd7, 0x2f, 0x02, 0x7e, 0xbd, 0xe0, 0x59, 0x00, 0xc8, 0x8a,
+    0x02, 0xac, 0xb8, 0xbb, 0x00, 0x48, 0x11, 0x0a, 0x50, 0xdf, 0x9f, 0x7b, 0x03, 0xf1, 0x81, 0xcd,
+    0x36, 0xac, 0x29, 0x8e, 0xe6, 0xd5, 0x28, 0xeb, 0x9b, 0xb2, 0xeb, 0x24, 0x1a, 0x80, 0x16, 0x8c,
+    0x63, 0xd1, 0xba, 0x4e, 0xcd, 0x69, 0xa2, 0x8f, 0xc3, 0x8e, 0xcb, 0x80, 0xdc, 0x32, 0x8b, 0x44,
+    0x9b, 0x30, 0xd2, 0x76, 0xa1, 0x98, 0x49, 0x00, 0xcc, 0x87, 0x02, 0xe0, 0x62, 0x2a, 0x00, 0x28,
+    0x8c, 0x0a, 0xb0, 0x63, 0xe4, 0x06, 0x60, 0x1d, 0x28, 0x40, 0x41, 0x2f, 0x2a, 0x13, 0xe5, 0xd6,
+    0x3c, 0x73, 0x5a, 0x09, 0xda, 0x1e, 0x18, 0x60, 0x2d, 0xcc, 0x47, 0xf9, 0xa1, 0x5c, 0xed, 0x09,
+    0x47, 0x4a, 0x40, 0x27, 0x0b, 0x81, 0x2b, 0x58, 0x4e, 0x84, 0x00, 0xef, 0x02, 0x78, 0x7d, 0x4e,
+    0xcf, 0x19, 0x46, 0x48, 0x1b, 0x6d, 0x43, 0xa5, 0x00, 0x40, 0x17, 0x0a, 0x70, 0x0f, 0xf4, 0x03,
+    0xe0, 0xf8, 0x3d, 0x00, 0x80, 0x93, 0x13, 0x80, 0x16, 0xb0, 0x00, 0xe2, 0x95, 0x51, 0x00, 0x18,
+    0x9a, 0x02, 0x00, 0xce, 0x54, 0x69, 0x8a, 0x68, 0x2d, 0xd9, 0x39, 0x93, 0x5b, 0xc7, 0x42, 0x81,
+    0xa2, 0x3e, 0x97, 0x44, 0x80, 0xcd, 0x63, 0x7c, 0x3f, 0xe2, 0x05, 0x3a, 0xc0, 0x48, 0x1b, 0x5e,
+    0x97, 0x2a, 0x01, 0x28, 0x23, 0x0a, 0x40, 0xdd, 0x87, 0x00, 0x80, 0x38, 0x32, 0x00, 0x43, 0xb8,
+    0x04, 0x00, 0xf5, 0xa0, 0x00, 0x11, 0x39, 0x62, 0xa0, 0x12, 0x1e, 0x70, 0x44, 0x96, 0x7d, 0xd4,
+    0x70, 0x62, 0x4d, 0x04, 0x2a, 0x79, 0xeb, 0x62, 0x72, 0x81, 0x66, 0x06, 0x8d, 0xb5, 0x0f, 0xcc,
+    0x04, 0xaa, 0xf4, 0xc3, 0x6a, 0x57, 0x3a, 0x4c, 0xeb, 0xed, 0x29, 0x0c, 0x15, 0x13, 0x17, 0xc0,
+    0x95, 0x8e, 0x5c, 0x01, 0x20, 0x70, 0x32, 0x40, 0x78, 0x0b, 0x05, 0x80, 0xf3, 0xa1, 0x00, 0xfc,
+    0x75, 0x44, 0x00, 0x8c, 0xa1, 0x02, 0xec, 0x83, 0xd9, 0x00, 0x60, 0x03, 0x0a, 0xd0, 0x82, 0xb2,
+    0xdb, 0x62, 0xb9, 0x01, 0x4b, 0x68, 0x3d, 0x16, 0x13, 0x48, 0xd5, 0x72, 0xf6, 0x49, 0x02, 0xdf,
+    0xaa, 0x16, 0x58, 0x4e, 0xcf, 0x3d, 0x52, 0xd3, 0x40, 0xad, 0x89, 0xb9, 0x3c, 0x88, 0xf6, 0x93,
+    0x00, 0x60, 0x58, 0x56, 0xcc, 0x1e, 0xd2, 0xd2, 0x20, 0x21, 0x9e, 0x05, 0x00, 0xd2, 0x84, 0x02,
+    0x2c, 0x99, 0x3f, 0xdc, 0x40, 0x7e, 0x80, 0x82, 0x09, 0x8b, 0xee, 0xa2, 0x81, 0x35, 0x06, 0x0c,
+    0x05, 0x64, 0x38, 0xa9, 0x06, 0x9a, 0xc1, 0x8a, 0x32, 0xa8, 0x2e, 0x54, 0x5b, 0xaa, 0x49, 0x56,
+    0x9c, 0xe3, 0x34, 0x80, 0x17, 0x48, 0xd7, 0x5d, 0x26, 0x94, 0x34, 0x9f, 0x27, 0x0e, 0x08, 0x00,
+    0x13, 0xa2, 0x00, 0xb0, 0x70, 0x57, 0x00, 0x8a, 0x23, 0x03, 0xfc, 0x78, 0x1f, 0x01, 0x58, 0x09,
+    0x0a, 0x40, 0x52, 0xef, 0x06, 0x45, 0xc1, 0xb5, 0x0e, 0x85, 0x8a, 0x96, 0xb4, 0x27, 0x06, 0x48,
+    0x24, 0x8b, 0x28, 0x7d, 0xa8, 0x57, 0x73, 0xba, 0x90, 0x58, 0xbf, 0xc9, 0x44, 0x00, 0x1b, 0x17,
+    0xab, 0x85, 0xc0, 0xc3, 0x00, 0x1e, 0x8b, 0xb7, 0x8c, 0x89, 0x31, 0xd2, 0x54, 0xd1, 0xb8, 0x6f,
+    0x00, 0x50, 0x86, 0x02, 0xbc, 0xa3, 0x62, 0x00, 0x38, 0x80, 0x0a, 0xa0, 0xe0, 0x85, 0x02, 0xa0,
+    0x0d, 0x28, 0x80, 0x7a, 0x85, 0x0a, 0x00, 0xa6, 0xa6, 0x00, 0x72, 0x8b, 0x31, 0x9d, 0xa2, 0x5a,
+    0x2b, 0x3a, 0x2e, 0x4e, 0xe0, 0xb1, 0x52, 0x80, 0xe8, 0xcf, 0x13, 0x0e, 0x60, 0xfb, 0x80, 0x60,
+    0x89, 0x02, 0xb4, 0x0e, 0x50, 0xd2, 0x8a, 0xdb, 0xd5, 0x26, 0x00, 0x4a, 0x89, 0x02, 0x24, 0x44,
+    0x67, 0x01, 0x50, 0x11, 0x0a, 0xf0, 0x10, 0x50, 0x04, 0x20, 0xe9, 0x09, 0x00, 0x65, 0x85, 0x7b,
+    0x09, 0x47, 0xd6, 0x36, 0xbf, 0xa2, 0x11, 0x1e, 0xa6, 0x17, 0x60, 0x56, 0x50, 0xd6, 0x3a, 0xc1,
+    0x4e, 0x20, 0xca, 0x40, 0x27, 0xf4, 0xa5, 0xcb, 0x34, 0xdf, 0xa5, 0x0c, 0x29, 0x32, 0x91, 0x01,
+    0x68, 0xdb, 0x05, 0x59, 0x00, 0x4e, 0x88, 0x02, 0xcc, 0x57, 0x87, 0x00, 0x30, 0x88, 0x0a, 0x20,
+    0x10, 0x46, 0x01, 0x80, 0x15, 0x28, 0x40, 0x16, 0x9e, 0xe4, 0x8c, 0x05, 0x07, 0x2a, 0xcd, 0x8d,
+    0x39, 0x4e, 0xa0, 0x55, 0xa3, 0xc1, 0x27, 0x36, 0x99, 0xab, 0x5c, 0x60, 0x49, 0xc0, 0xcc, 0x6d,
+    0x4d, 0x0b, 0xb5, 0x68, 0xe1, 0xb2, 0x53, 0xdb, 0x6f, 0x02, 0x82, 0xd8, 0x41, 0x0c, 0x8f, 0xc8,
+    0x4b, 0xd3, 0x5c, 0xb8, 0x31, 0x01, 0x48, 0x15, 0x0a, 0x20, 0x63, 0x4d, 0x04, 0x00, 0x01, 0x06,
+    0x00, 0x2a, 0x40, 0x0c, 0x80, 0x26, 0xf6, 0x00, 0x79, 0xdc, 0x5e, 0xd6, 0x24, 0x1b, 0x50, 0x02,
+    0xea, 0x2e, 0x70, 0xba, 0x52, 0x2d, 0x19, 0xab, 0x33, 0xfe, 0x8d, 0xdb, 0x80, 0x1f, 0x0f, 0xf3,
+    0xed, 0x96, 0x70, 0xd2, 0x82, 0x9f, 0xb0, 0x67, 0x00, 0xcc, 0x88, 0x02, 0x04, 0x59, 0x84, 0x00,
+    0x58, 0x0b, 0x0a, 0xa0, 0xd4, 0x4b, 0x34, 0x45, 0xc9, 0x35, 0x8e, 0x69, 0x5e, 0x8e, 0xb1, 0x47,
+    0x06, 0x36, 0x46, 0xe3, 0xef, 0x7c, 0x28, 0x58, 0x73, 0xa2, 0xcf, 0xd9, 0xac, 0xc9, 0x46, 0x83,
+    0xea, 0x98, 0x38, 0xd3, 0xc0, 0xcb, 0x00, 0x5e, 0x76, 0xb7, 0xa4, 0x8c, 0x51, 0xd2, 0x62, 0xc6,
+    0xb0, 0x45, 0x00, 0xd0, 0x86, 0x02, 0x98, 0xc3, 0x8a, 0x01, 0x38, 0x82, 0x0a, 0x40, 0x61, 0x23,
+    0x00, 0xa0, 0x15, 0x28, 0xc0, 0x7c, 0x85, 0x00, 0x00, 0xc6, 0xa6, 0x00, 0x57, 0x6b, 0x0e, 0x9e,
+    0x22, 0x5b, 0x0b, 0x06, 0xae, 0x76, 0xe7, 0xb1, 0x54, 0x60, 0x88, 0xcf, 0x07, 0x34, 0x60, 0x03,
+    0x01, 0x23, 0x83, 0x4a, 0xca, 0x0e, 0x70, 0xd2, 0x8e, 0xe1, 0xb5, 0x03, 0x00, 0xca, 0x89, 0x02,
+    0x10, 0x24, 0xbe, 0x00, 0x50, 0x13, 0x0f, 0xe0, 0x90, 0xf4, 0x01, 0x20, 0xf1, 0x29, 0x80, 0x68,
+    0x0f, 0x33, 0x05, 0x67, 0xd6, 0x26, 0xdc, 0x92, 0xdc, 0x0d, 0x26, 0x18, 0x50, 0x32, 0x50, 0x52,
+    0x80, 0xc1, 0x50, 0xa0, 0x69, 0x42, 0xaa, 0x89, 0xa6, 0xd3, 0xb4, 0x5f, 0xa9, 0x3e, 0x01, 0x33,
+    0xb1, 0x01, 0x72, 0xd6, 0xc5, 0x2d, 0x00, 0xce, 0x88, 0x02, 0xac, 0x37, 0xbe, 0x01, 0x30, 0x8a,
+    0x0c, 0x70, 0x90, 0x28, 0x06, 0x80, 0x1d, 0x28, 0xc0, 0x20, 0x78, 0x56, 0x8e, 0x25, 0x07, 0x28,
+    0xeb, 0xcd, 0x9a, 0x4e, 0x20, 0x56, 0x73, 0xd5, 0xe7, 0xa0, 0xac, 0xab, 0x5e, 0x40, 0xc9, 0xc2,
+    0x9f, 0x4b, 0x4d, 0x13, 0x35, 0xeb, 0xde, 0x44, 0x6a, 0xda, 0x8f, 0x02, 0x82, 0x2f, 0xa2, 0x58,
+    0x9b, 0x48, 0x4c, 0x13, 0x31, 0x38, 0x8a, 0x00, 0x48, 0x17, 0x0a, 0x90, 0xe2, 0xf2, 0x01, 0x00,
+    0x09, 0x2a, 0x00, 0x2c, 0x6c, 0x01, 0x80, 0x46, 0xa6, 0x00, 0xc4, 0xf4, 0x3d, 0xc9, 0xa4, 0x1b,
+    0x30, 0x12, 0x49, 0x54, 0x3f, 0xba, 0x54, 0xed, 0x98, 0x2f, 0x11, 0x4c, 0x8d, 0xe3, 0x00, 0x61,
+    0xff, 0x66, 0xc4, 0x93, 0x90, 0xd2, 0x86, 0xa1, 0x80, 0x3f, 0x00, 0x4c, 0x89, 0x02, 0x00, 0x79,
+    0xa8, 0x01, 0x58, 0x0d, 0x0a, 0x90, 0x57, 0xab, 0x51, 0x45, 0xd1, 0x35, 0x0d, 0x47, 0x94, 0x85,
+    0xad, 0x67, 0x06, 0x1e, 0x6f, 0xf3, 0xc6, 0x7c, 0xa8, 0x58, 0x6b, 0x7a, 0xce, 0x58, 0x98, 0xc9,
+    0x48, 0xe0, 0x49, 0x9b, 0xc3, 0x10, 0xc1, 0xd3, 0x80, 0x5e, 0x61, 0x89, 0x78, 0x8f, 0x71, 0xd2,
+    0x6c, 0xbb, 0x90, 0x1b, 0x00, 0x50, 0x87, 0x02, 0x74, 0x63, 0xf1, 0x00, 0x38, 0x84, 0x0a, 0xe0,
+    0xe1, 0xc4, 0x04, 0xa0, 0x1d, 0x28, 0x40, 0x7f, 0x81, 0x12, 0x00, 0xe6, 0xa6, 0x00, 0x32, 0xeb,
+    0x5b, 0x9c, 0xa2, 0x5b, 0xe3, 0xe5, 0x0d, 0xdb, 0xe4, 0xb1, 0x56, 0x40, 0x78, 0x4e, 0x04, 0x62,
+    0x60, 0x0b, 0x01, 0xa5, 0x7d, 0x7e, 0x20, 0x0f, 0x90, 0xd2, 0x90, 0xe8, 0x95, 0x51, 0x00, 0x4a,
+    0x8a, 0x02, 0x08, 0xa3, 0x2e, 0xf0, 0x50, 0x15, 0x6d, 0xc1, 0x90, 0xaa, 0x06, 0x20, 0xf9, 0x29,
+    0xc0, 0x71, 0x29, 0x2b, 0x00, 0x87, 0x66, 0x0a, 0xf5, 0x82, 0xb7, 0x04, 0xa6, 0x98, 0x41, 0xfe,
+    0xef, 0x8d, 0xcd, 0xc1, 0x52, 0x40, 0xf9, 0xc3, 0x3f, 0x1e, 0xa7, 0xdb, 0xb4, 0x20, 0xaa, 0x6e,
+    0x55, 0x34, 0xd1, 0x01, 0x7c, 0xd4, 0x2d, 0x03, 0x00, 0x4e, 0x89, 0x02, 0x2c, 0x64, 0xfe, 0x00,
+    0x60, 0x09, 0x0a, 0xa0, 0x8a, 0x14, 0xe3, 0x63, 0xd1, 0x01, 0x09, 0x7f, 0x41, 0x5b, 0x13, 0xa8,
+    0xd5, 0x50, 0x04, 0xfa, 0x02, 0xed, 0x2a, 0x18, 0x50, 0x32, 0x71, 0x5d, 0x3c, 0xd3, 0x46, 0x50,
+    0xab, 0x37, 0x33, 0xf0, 0xf5, 0xab, 0x00, 0x21, 0x9d, 0x50, 0x4d, 0x28, 0x32, 0xd3, 0x52, 0x01,
+    0xe6, 0x68, 0x00, 0x52, 0x86, 0x02, 0x80, 0xd8, 0xab, 0x01, 0x40, 0x84, 0x0a, 0x80, 0x0b, 0xa7,
+    0x04, 0xa0, 0x99, 0x29, 0xc0, 0x43, 0x7d, 0xc7, 0x2e, 0x09, 0x07, 0x84, 0x0e, 0x8a, 0x2d, 0x84,
+    0xae, 0x55, 0x2b, 0x02, 0xad, 0x7d, 0x1c, 0xe3, 0x3a, 0xc0, 0x48, 0xbc, 0xb9, 0x1d, 0x24, 0xac,
+    0xb4, 0xe2, 0x29, 0xee, 0x05, 0x00, 0x73, 0xa2, 0x00, 0x3d, 0x46, 0x42, 0x00, 0xd6, 0x83, 0x02,
+    0xc8, 0x56, 0x84, 0x57, 0x51, 0x76, 0xed, 0x22, 0x0a, 0xbf, 0x05, 0xe0, 0xa1, 0x29, 0xc0, 0xe7,
+    0x98, 0x47, 0x1f, 0x4a, 0xd6, 0x98, 0x52, 0xab, 0xe5, 0x61, 0xb2, 0x12, 0x58, 0x8a, 0x47, 0x56,
+    0x53, 0xf0, 0x36, 0xc0, 0x37, 0x53, 0xfd, 0x83, 0x64, 0xa4, 0xb4, 0x9d, 0x2c, 0x88, 0x18, 0x00,
+    0xf4, 0xa1, 0x00, 0xd3, 0x00, 0x16, 0x00, 0x8e, 0xa1, 0x02, 0x9c, 0x18, 0x96, 0x00, 0x68, 0x09,
+    0x0a, 0x70, 0x60, 0x11, 0x02, 0x80, 0xc1, 0x29, 0xc0, 0xbf, 0x44, 0x4e, 0xa5, 0x08, 0xd7, 0x6e,
+    0x76, 0x63, 0x0f, 0x75, 0x2c, 0x16, 0x10, 0x26, 0xb3, 0x01, 0x30, 0xd8, 0x44, 0xc0, 0x59, 0x9e,
+    0xad, 0xec, 0x03, 0xac, 0x34, 0xa4, 0x82, 0x25, 0x4c, 0x9b, 0xb2, 0x42, 0x06, 0x99, 0xd8, 0x53,
+    0x3b, 0xd4, 0x45, 0x7b, 0x20, 0x44, 0x18, 0x01, 0x48, 0x80, 0x0a, 0x40, 0x5d, 0x83, 0x00, 0xc0,
+    0xa9, 0x29, 0x80, 0xc1, 0xc2, 0x64, 0x85, 0x49, 0x66, 0x8c, 0xf1, 0x33, 0xc1, 0x88, 0x30, 0x15,
+    0x38, 0x62, 0xd1, 0xf5, 0xf0, 0xe9, 0x38, 0x6d, 0x28, 0x2a, 0x56, 0x73, 0x4d, 0x7c, 0x00, 0xa1,
+    0x74, 0x65, 0x12, 0x80, 0x73, 0xa2, 0x00, 0x0e, 0x09, 0x1c, 0x00, 0xd8, 0x82, 0x02, 0x30, 0xc3,
+    0x24, 0x0a, 0x59, 0x76, 0x00, 0x12, 0x60, 0xed, 0xa4, 0x04, 0x72, 0x35, 0xd1, 0x86, 0x8a, 0x73,
+    0xbb, 0x2a, 0x06, 0x92, 0x62, 0x44, 0x65, 0xc8, 0x34, 0x52, 0xb3, 0x02, 0x8e, 0x37, 0x3b, 0xfd,
+    0x2c, 0x40, 0xb8, 0x2a, 0x22, 0x09, 0x8a, 0xd4, 0xb4, 0xd7, 0x7d, 0xaf, 0x0f, 0x80, 0xb4, 0xa1,
+    0x00, 0x16, 0xde, 0x46, 0x00, 0x90, 0xa1, 0x02, 0x90, 0xa3, 0x04, 0x01, 0x70, 0x01, 0x0b, 0x20,
+    0x8c, 0xe7, 0x01, 0xa0, 0xa1, 0x29, 0xc0, 0x56, 0xd5, 0x7b, 0x2b, 0x29, 0x07, 0x7a, 0xe0, 0xd1,
+    0x85, 0x79, 0x2e, 0x56, 0x23, 0x1a, 0x4e, 0xbc, 0xd9, 0xe2, 0x3c, 0x40, 0x39, 0x39, 0x49, 0x2b,
+    0x23, 0xb4, 0xa0, 0xa3, 0x2b, 0x50, 0x18, 0x00, 0x93, 0x22, 0x00, 0x38, 0xde, 0x19, 0x00, 0x56,
+    0x84, 0x02, 0xd0, 0xb7, 0xd8, 0x50, 0x51, 0x78, 0x4d, 0xf2, 0x09, 0x78, 0x03, 0xe0, 0xa9, 0x29,
+    0x40, 0xf5, 0xae, 0x59, 0x1f, 0x6a, 0xd6, 0x96, 0x05, 0x0b, 0xc4, 0x5d, 0x32, 0x13, 0x30, 0x56,
+    0xe8, 0xb9, 0x5a, 0xf0, 0x38, 0xe0, 0x27, 0x4e, 0xcd, 0x09, 0x65, 0xac, 0x34, 0xa0, 0x2a, 0x1a,
+    0x0e, 0x00, 0x14, 0xa2, 0x00, 0xc9, 0x08, 0x60, 0x00, 0x0e, 0xa2, 0x02, 0xc0, 0x18, 0xbb, 0x01,
+    0x68, 0x0b, 0x0a, 0x20, 0xe1, 0x83, 0x06, 0x80, 0xc9, 0x29, 0x80, 0xb0, 0x8a, 0x45, 0xa2, 0x28,
+    0xd7, 0x64, 0x7a, 0x33, 0xd8, 0x6e, 0xac, 0x16, 0x10, 0x86, 0x92, 0x44, 0x4f, 0xd8, 0x46, 0x63,
+    0xda, 0x1d, 0x30, 0x1a, 0x04, 0xb4, 0xb4, 0x24, 0xa6, 0xd7, 0x08, 0x9d, 0xd2, 0x02, 0x2e, 0x70,
+    0xc8, 0xa9, 0x39, 0x54, 0x46, 0x8b, 0x0c, 0x84, 0x87, 0x00, 0x48, 0x82, 0x0a, 0x80, 0xdd, 0x06,
+    0x05, 0xc0, 0xb1, 0x29, 0x00, 0xc4, 0xe2, 0xb7, 0x89, 0x69, 0x66, 0x86, 0xe2, 0x43, 0x1e, 0x9f,
+    0xb0, 0x15, 0x20, 0xb6, 0xd1, 0x5e, 0x1a, 0xea, 0x3a, 0xcd, 0x48, 0x29, 0x47, 0xf1, 0x4d, 0x84,
+    0x80, 0xe2, 0x74, 0x09, 0x08, 0x80, 0x93, 0xa2, 0x00, 0x0f, 0x31, 0x68, 0x00, 0x58, 0x83, 0x02,
+    0xa4, 0x63, 0x4d, 0x1b, 0x59, 0x78, 0x80, 0xc1, 0xdf, 0x05, 0x5b, 0x04, 0x7a, 0x35, 0xcd, 0x8d,
+    0x44, 0x0a, 0xbb, 0x4a, 0x06, 0x92, 0x6f, 0x9c, 0x42, 0xc0, 0xb4, 0x52, 0x93, 0x3a, 0x8e, 0xa0,
+    0xe8, 0xfc, 0x2e, 0x60, 0x48, 0x2d, 0xfd, 0xbd, 0x89, 0xdc, 0xb4, 0x5a, 0x7b, 0x23, 0x05, 0x80,
+    0xd4, 0xa1, 0x00, 0x0c, 0x8e, 0x23, 0x00, 0x10, 0xa2, 0x02, 0xb4, 0xe3, 0x75, 0x00, 0x70, 0x03,
+    0x0a, 0xd0, 0x0c, 0x2a, 0x06, 0xa0, 0xa9, 0x29, 0x40, 0x69, 0x51, 0x54, 0x28, 0x49, 0x07, 0x6e,
+    0xbc, 0x79, 0xce, 0x70, 0xae, 0x56, 0x1b, 0x26, 0x8f, 0x3a, 0x8f, 0xe2, 0x3e, 0xe0, 0xa9, 0xb6,
+    0xd3, 0x28, 0x22, 0xbc, 0x18, 0xe4, 0x5b, 0x80, 0xed, 0x02, 0xb3, 0x02, 0x28, 0x30, 0xae, 0x61,
+    0x00, 0xd6, 0x84, 0x02, 0xe4, 0x38, 0x1e, 0x3c, 0x51, 0x7a, 0x6d, 0xe1, 0x89, 0x25, 0x01, 0xe0,
+    0xb1, 0x29, 0x40, 0x04, 0xcb, 0x4f, 0x1f, 0x8a, 0xd6, 0x92, 0xba, 0x8a, 0xa1, 0x59, 0xb2, 0x13,
+    0x18, 0x3a, 0x49, 0x1f, 0x62, 0xf0, 0x3a, 0x00, 0x38, 0xc9, 0x99, 0x7e, 0x65, 0xb4, 0x34, 0x22,
+    0x29, 0xca, 0x03, 0x00, 0x34, 0xa2, 0x00, 0xbf, 0x58, 0x39, 0x00, 0x8e, 0xa2, 0x02, 0xdc, 0xb8,
+    0x1b, 0x01, 0x68, 0x0d, 0x0a, 0xd0, 0xe1, 0xeb, 0x03, 0x80, 0xd1, 0x29, 0x00, 0x9e, 0xec, 0xf8,
+    0x9d, 0x48, 0xd7, 0x56, 0x85, 0x4b, 0xb0, 0x63, 0x2c, 0x17, 0x08, 0xba, 0x91, 0xc5, 0x7a, 0xd8,
+    0x48, 0x00, 0xdb, 0x9d, 0xb7, 0x5e, 0x04, 0xbc, 0xb4, 0x64, 0xa1, 0x15, 0xc6, 0x9e, 0xf2, 0x02,
+    0x42, 0x47, 0x38, 0x6e, 0x38, 0xd4, 0x46, 0x93, 0xf0, 0xe3, 0xba, 0x01, 0x48, 0x84, 0x0a, 0xe0,
+    0xdd, 0x78, 0x02, 0xc0, 0xb9, 0x29, 0x00, 0xc4, 0x02, 0x0f, 0x8e, 0x89, 0xd6, 0x7e, 0xd3, 0x23,
+    0x6b, 0xb8, 0x30, 0x16, 0x10, 0xfa, 0x91, 0x8c, 0x49, 0xea, 0x3c, 0x2d, 0x39, 0xa8, 0x34, 0x8e,
+    0x4e, 0x8c, 0x00, 0x64, 0x75, 0xef, 0x19, 0x80, 0xb3, 0xe2, 0x00, 0x0e, 0x41, 0x43, 0x00, 0xd8,
+    0x83, 0x00, 0x08, 0xe4, 0xc0, 0x28, 0x59, 0x7a, 0x85, 0x30, 0xdf, 0x29, 0xe9, 0x03, 0x82, 0xb5,
+    0x47, 0x95, 0x12, 0x81, 0xba, 0x6a, 0x06, 0x90, 0x73, 0xb4, 0x9f, 0xb7, 0x34, 0x53, 0x73, 0x82,
+    0xae, 0x0a, 0x8e, 0xfc, 0x30, 0x80, 0x18, 0xaf, 0xcf, 0x23, 0x89, 0xe4, 0x34, 0x5d, 0x79, 0xc9,
+    0x16, 0x80, 0xf4, 0xa1, 0x00, 0x02, 0x9e, 0x00, 0x00, 0x90, 0xa2, 0x02, 0xd8, 0x23, 0xa9, 0x01,
+    0x70, 0x05, 0x0a, 0x80, 0x8d, 0x62, 0x03, 0xa0, 0xb1, 0x29, 0x40, 0x7b, 0x29, 0x6d, 0x25, 0x69,
+    0x07, 0x62, 0xa3, 0x99, 0xa6, 0x68, 0x2e, 0x57, 0x13, 0x26, 0x90, 0xbb, 0x3c, 0xe2, 0x40, 0x60,
+    0xaa, 0xb4, 0x5f, 0x3d, 0x21, 0xc4, 0x98, 0xe4, 0x77, 0x64, 0xc4, 0x02, 0xd3, 0x62, 0x3a, 0x27,
+    0x8e, 0x38, 0x00, 0x56, 0x85, 0x02, 0xf0, 0x38, 0x09, 0x01, 0x50, 0x7c, 0x0a, 0x00, 0x0a, 0xd0,
+    0x05, 0xe0, 0xb9, 0x29, 0x00, 0x14, 0x0d, 0x26, 0x1f, 0xaa, 0xd6, 0x8e, 0x6f, 0xea, 0x6e, 0x56,
+    0x32, 0x14, 0xf8, 0x29, 0xaa, 0x48, 0x67, 0xf0, 0x3c, 0x40, 0x78, 0x44, 0x54, 0xcc, 0x65, 0xbc,
+    0x34, 0x24, 0x28, 0xb4, 0x15, 0x00, 0x54, 0xa2, 0x00, 0xb6, 0x50, 0x12, 0x00, 0x0e, 0x23, 0x03,
+    0xf4, 0x18, 0x7a, 0x00, 0x68, 0x0f, 0x0a, 0x70, 0xe2, 0x52, 0x01, 0x80, 0xd9, 0x29, 0xc0, 0x88,
+    0x12, 0xd0, 0x98, 0x68, 0xd7, 0x4a, 0x97, 0x43, 0x88, 0x56, 0xac, 0x17, 0x08, 0xca, 0x50, 0x46,
+    0xae, 0xd8, 0x4a, 0x00, 0x8b, 0x9e, 0x33, 0xb4, 0x04, 0xc4, 0xb4, 0xe4, 0x8e, 0x4b, 0xe0, 0xa0,
+    0x12, 0x03, 0x52, 0x1f, 0x08, 0xbf, 0x37, 0x54, 0x47, 0x9b, 0xd4, 0x43, 0x2d, 0x01, 0x48, 0x86,
+    0x0a, 0x30, 0x60, 0xb5, 0x03, 0xe0, 0x05, 0x2c, 0x40, 0x79, 0xab, 0x1b, 0x00, 0x07, 0xa7, 0x00,
+    0x05, 0xdb, 0x18, 0x48, 0xa6, 0x5a, 0xdb, 0x1d, 0xcf, 0x1b, 0x4b, 0xc3, 0x5a, 0xe0, 0x87, 0x48,
+    0xec, 0xe3, 0xa9, 0xfb, 0x34, 0xa6, 0x9b, 0x40, 0xf0, 0x3c, 0x51, 0x02, 0x96, 0xf5, 0xbd, 0x4a,
+    0x4f, 0x4e, 0x4b, 0x83, 0x0c, 0xe4, 0x9c, 0xbc, 0x61, 0x11, 0xe0, 0xe1, 0x10, 0xa4, 0x00, 0x60,
+    0xf1, 0x29, 0x40, 0x75, 0xcd, 0x19, 0x00, 0x28, 0xa6, 0x00, 0x74, 0x82, 0x50, 0xe7, 0x2a, 0x1a,
+    0x30, 0xc2, 0x71, 0xb3, 0xbd, 0xd2, 0x4e, 0x4d, 0x69, 0x3b, 0xe0, 0xcc, 0xf0, 0xcb, 0x80, 0xe2,
+    0xc0, 0x8e, 0xa6, 0x21, 0xb2, 0xd3, 0x7c, 0xde, 0x65, 0x31, 0x00, 0x52, 0x88, 0x02, 0xe0, 0xd7,
+    0x3a, 0x01, 0x40, 0x8c, 0x0a, 0xd0, 0x0f, 0x6c, 0x04, 0xc0, 0x1d, 0x28, 0x80, 0x38, 0x66, 0x02,
+    0x80, 0xe6, 0xa6, 0x00, 0x2d, 0x1e, 0x9a, 0x8c, 0x24, 0x1e, 0x58, 0x59, 0xa6, 0xbc, 0x87, 0xb9,
+    0x5e, 0x4d, 0x28, 0xc4, 0xf8, 0xb0, 0x87, 0x0b, 0x01, 0x2c, 0xcd, 0x86, 0x2b, 0x81, 0x30, 0x63,
+    0x94, 0x3a, 0xba, 0xde, 0x21, 0xcc, 0x4b, 0x2b, 0x75, 0x18, 0x3d, 0x00, 0x58, 0x17, 0x0a, 0x60,
+    0x63, 0x89, 0x01, 0x40, 0xf9, 0x29, 0x00, 0x30, 0x98, 0x08, 0x00, 0x18, 0xb0, 0x00, 0xa4, 0x80,
+    0x36, 0x00, 0x1e, 0x9c, 0x02, 0x4c, 0xd2, 0x89, 0xeb, 0xa1, 0x6c, 0x8d, 0x88, 0xa2, 0xb1, 0x2c,
+    0x25, 0x4b, 0x01, 0x5e, 0xb2, 0x2a, 0xab, 0x06, 0xef, 0x03, 0x88, 0xfe, 0x43, 0x20, 0x60, 0x46,
+    0x4c, 0x5b, 0x7a, 0xe2, 0xba, 0x00, 0x40, 0x27, 0x0a, 0xa0, 0xe2, 0x81, 0x15, 0xa6, 0x45, 0x34,
+    0x47, 0x8c, 0x09, 0x17, 0x00, 0x86, 0xa7, 0x00, 0xc0, 0x49, 0x1c, 0x4b, 0x22, 0x5e, 0xe3, 0xc8,
+    0x6e, 0x43, 0x1d, 0xb1, 0x60, 0x20, 0x08, 0x3f, 0x20, 0xb6, 0x63, 0x33, 0x81, 0x29, 0x7f, 0xb4,
+    0x66, 0x14, 0x30, 0xd3, 0x94, 0xe7, 0xfd, 0x55, 0x8f, 0xca, 0x0c, 0x88, 0x21, 0xc0, 0x07, 0xdc,
+    0x50, 0x1f, 0x8d, 0xc2, 0x8e, 0x83, 0x02, 0x20, 0x21, 0x2a, 0x80, 0x83, 0x65, 0x06, 0x80, 0x37,
+    0xa0, 0x00, 0xed, 0xc5, 0x44, 0x00, 0x9c, 0x9c, 0x02, 0xb4, 0x4b, 0x9a, 0x5f, 0x99, 0x6c, 0xed,
+    0xe6, 0xbb, 0x21, 0xda, 0x0e, 0x73, 0x01, 0x5f, 0x22, 0xbd, 0xa6, 0xaa, 0x0e, 0xd4, 0x9e, 0x5a,
+    0x32, 0x1e, 0xff, 0xc4, 0x09, 0x68, 0x1a, 0x18, 0xa7, 0x60, 0x39, 0x2f, 0x0d, 0x63, 0x8f, 0x60,
+    0xe0, 0x86, 0x4d, 0x00, 0xcb, 0x43, 0xc4, 0x14, 0x80, 0xe5, 0xa7, 0x00, 0xd3, 0x4d, 0x40, 0x00,
+    0x20, 0x99, 0x02, 0x40, 0x0a, 0xb3, 0x92, 0xab, 0x6a, 0x80, 0x68, 0xc6, 0x8f, 0x74, 0x4a, 0x43,
+    0x35, 0xa3, 0xf3, 0x60, 0xaa, 0xbd, 0x4f, 0x03, 0x8c, 0x09, 0xab, 0x67, 0x79, 0x48, 0x4f, 0x13,
+    0x62, 0x57, 0x20, 0x00, 0x48, 0x23, 0x0a, 0x00, 0x5f, 0xc7, 0x02, 0x00, 0x39, 0x32, 0xc0, 0x40,
+    0xc8, 0x08, 0x00, 0x97, 0xa0, 0x00, 0xec, 0xa0, 0x4d, 0x00, 0x1a, 0x9c, 0x02, 0x78, 0x99, 0x0d,
+    0x14, 0x92, 0x7a, 0x60, 0x74, 0x19, 0x72, 0xcc, 0xe5, 0x82, 0x35, 0xa1, 0x1d, 0x51, 0x58, 0x1a,
+    0x4e, 0x04, 0xae, 0x27, 0xfb, 0x05, 0x0a, 0x42, 0x0d, 0x50, 0x22, 0x8a, 0xf0, 0xda, 0x30, 0x31,
+    0x8d, 0x25, 0xe1, 0x64, 0x05, 0x60, 0x65, 0x28, 0xc0, 0x8b, 0x07, 0x18, 0x00, 0x05, 0xa8, 0x00,
+    0xca, 0xe8, 0x6b, 0x00, 0xe0, 0x80, 0x02, 0xa8, 0xc2, 0x3d, 0x00, 0x78, 0x72, 0x0a, 0x80, 0x4d,
+    0xcf, 0x7b, 0x87, 0xba, 0xb5, 0xe0, 0x78, 0xae, 0xe9, 0x93, 0x4c, 0x05, 0x72, 0x0a, 0xdb, 0x07,
+    0x1b, 0x3c, 0x10, 0x38, 0xea, 0x6e, 0xac, 0x87, 0x19, 0x33, 0xad, 0xf9, 0x09, 0x76, 0x00, 0x00,
+    0xa5, 0x28, 0xc0, 0x73, 0xe5, 0x2a, 0x9b, 0x36, 0xd1, 0x2e, 0x38, 0xae, 0x32, 0x00, 0x98, 0x9e,
+    0x02, 0x10, 0x05, 0x9d, 0xc7, 0x88, 0x7a, 0x4d, 0x32, 0x3d, 0x90, 0x6a, 0xc3, 0x8a, 0x01, 0x20,
+    0xea, 0x6c, 0x10, 0x93, 0xed, 0x04, 0x9c, 0x1b, 0xda, 0xe2, 0x59, 0x40, 0x4d, 0x53, 0x4a, 0x96,
+    0xe2, 0x70, 0x2a, 0x35, 0xe0, 0x06, 0x82, 0x4e, 0x83, 0x43, 0x85, 0xb4, 0xca, 0x38, 0x46, 0x01,
+    0x80, 0xa4, 0xa8, 0x00, 0x18, 0xfe, 0x67, 0x00, 0x5e, 0x81, 0x02, 0xdc, 0x37, 0x6a, 0x00, 0x70,
+    0x74, 0x0a, 0x90, 0xac, 0x3d, 0x3c, 0x66, 0xba, 0x35, 0x19, 0xee, 0x52, 0x1b, 0x42, 0xec, 0x05,
+    0x7a, 0x81, 0x2c, 0xe8, 0xb7, 0xba, 0x50, 0x9b, 0x1e, 0x09, 0xad, 0x2d, 0x14, 0x29, 0xc0, 0x29,
+    0x61, 0x98, 0xf8, 0xe5, 0xc4, 0xb4, 0x8f, 0x37, 0xd6, 0x34, 0x1b, 0x56, 0x01, 0x34, 0x0e, 0x51,
+    0x2c, 0x00, 0x16, 0xa0, 0x02, 0x4c, 0xb7, 0x62, 0x00, 0x80, 0x66, 0x0a, 0x60, 0x10, 0xa6, 0x01,
+    0xc0, 0x06, 0x2c, 0x00, 0xaa, 0x6a, 0xa2, 0xb8, 0xca, 0x06, 0x84, 0x5a, 0x9c, 0xa4, 0x9f, 0xb4,
+    0x54, 0x1b, 0xa2, 0xef, 0x15, 0x84, 0xfb, 0x36, 0x00, 0x79, 0xb0, 0x46, 0xac, 0x86, 0xfc, 0x34,
+    0x63, 0x73, 0x4f, 0xb4, 0x94, 0x54, 0x42, 0x06, 0x08, 0xe9, 0x6f, 0x00, 0xdc, 0x82, 0x02, 0xd4,
+    0xe3, 0x84, 0x00, 0x68, 0x72, 0x0a, 0x70, 0xe6, 0x22, 0xfe, 0x47, 0xf2, 0x01, 0xcc, 0x68, 0xbe,
+    0x47, 0x96, 0x2b, 0xd6, 0x82, 0x9f, 0x9c, 0x42, 0x59, 0xb8, 0xd1, 0x90, 0x96, 0x0c, 0x39, 0x59,
+    0x08, 0x37, 0x40, 0xa9, 0xac, 0x9f, 0x99, 0xc4, 0xcc, 0x34, 0x19, 0x82, 0x33, 0x0b, 0x80, 0xb5,
+    0x11, 0x00, 0x26, 0xce, 0x37, 0x00, 0x94, 0xa0, 0x02, 0x50, 0x43, 0x15, 0x01, 0x80, 0x05, 0x0a,
+    0x20, 0x0b, 0x85, 0x05, 0xe0, 0xd1, 0x29, 0xc0, 0x47, 0x11, 0x86, 0x1c, 0x0a, 0xd7, 0x7c, 0xa5,
+    0xd1, 0x81, 0x4c, 0xb2, 0x15, 0xb8, 0x31, 0x4d, 0x51, 0x73, 0xf0, 0x42, 0x40, 0xb9, 0xb7, 0x4e,
+    0x2c, 0x66, 0xd4, 0x34, 0xe8, 0x28, 0x58, 0x14, 0x00, 0xb4, 0xa2, 0x00, 0x7d, 0x7d, 0x82, 0x73,
+    0x5a, 0x45, 0xeb, 0xf8, 0x98, 0x26, 0x00, 0x60, 0x7c, 0x0a, 0x60, 0x0a, 0x9d, 0x03, 0x20, 0xf2,
+    0x29, 0x40, 0xff, 0x5c, 0x20, 0x09, 0x4b, 0x06, 0x80, 0x5c, 0x03, 0x21, 0x5e, 0x36, 0x14, 0x50,
+    0x0a, 0x69, 0xe9, 0x8c, 0x01, 0x37, 0x4d, 0xc9, 0x53, 0xa7, 0xb9, 0xaa, 0xdc, 0x80, 0x9e, 0x12,
+    0x42, 0xa1, 0x0e, 0x35, 0xd2, 0x2a, 0xd9, 0x98, 0x52, 0x00, 0x12, 0x23, 0x03, 0x88, 0xd8, 0x16,
+    0x01, 0x78, 0x07, 0x0a, 0x10, 0xe0, 0x05, 0x06, 0xc0, 0xd9, 0x29, 0xc0, 0xa5, 0x4a, 0x28, 0x9b,
+    0x09, 0xd7, 0x5a, 0xb7, 0x83, 0x47, 0x20, 0x31, 0x18, 0xe0, 0xb9, 0x91, 0x14, 0x13, 0xeb, 0x44,
+    0xed, 0x7a, 0xa3, 0x75, 0x5c, 0x51, 0xac, 0x80, 0xa7, 0x85, 0x9b, 0xb6, 0x99, 0x33, 0xd3, 0x4a,
+    0xc1, 0x88, 0xaf, 0x6a, 0xd8, 0x05, 0xf0, 0x2c, 0xa4, 0x18, 0x00, 0x58, 0x82, 0x0a, 0x40, 0xdd,
+    0x0f, 0x06, 0x00, 0xa2, 0x29, 0x40, 0x40, 0x64, 0x18, 0x00, 0x3b, 0xa0, 0x00, 0xb8, 0xd2, 0xd7,
+    0xe1, 0xaa, 0x1b, 0xf8, 0x2d, 0xf1, 0xbf, 0x61, 0xd2, 0x54, 0x0d, 0xf8, 0x3f, 0x2b, 0xdd, 0xec,
+    0xe3, 0x00, 0x65, 0xbf, 0x2e, 0x28, 0x17, 0x12, 0xd4, 0x94, 0xa7, 0x1d, 0x2f, 0x43, 0xd2, 0x09,
+    0x70, 0x30, 0x64, 0x2f, 0x01, 0x70, 0x0d, 0x0a, 0xd0, 0x0f, 0x5a, 0x06, 0xa0, 0xd1, 0x29, 0x00,
+    0x81, 0x1f, 0x35, 0x1e, 0xe9, 0x47, 0x08, 0xb9, 0x21, 0xe7, 0x56, 0x2e, 0x59, 0x0b, 0x02, 0x93,
+    0x90, 0x32, 0xe1, 0x48, 0xc0, 0xb9, 0xb2, 0x60, 0xfa, 0x21, 0xe4, 0x00, 0xa5, 0xc0, 0x24, 0x3a,
+    0x16, 0x53, 0xd3, 0x70, 0xfd, 0x2d, 0x03, 0x00, 0x56, 0x47, 0x00, 0x74, 0xb8, 0x40, 0x00, 0x50,
+    0x84, 0x0a, 0xe0, 0x0d, 0xf2, 0x01, 0x00, 0x1e, 0x28, 0xc0, 0x2e, 0x10, 0x0c, 0x80, 0x67, 0xa7,
+    0x00, 0x67, 0xfd, 0xe4, 0x6b, 0xa8, 0x5c, 0xd3, 0xb1, 0x65, 0x34, 0x27, 0xc9, 0x58, 0xa0, 0xe6,
+    0xb8, 0x12, 0xe3, 0xc1, 0x13, 0x81, 0xe6, 0xd0, 0x86, 0x87, 0x98, 0x71, 0xd3, 0xa4, 0xa9, 0xb8,
+    0x2b, 0x00, 0x50, 0x8b, 0x00, 0xd4, 0x34, 0x2a, 0xe3, 0x69, 0x17, 0x2d, 0x14, 0xe4, 0x15, 0x05,
+    0x80, 0xf9, 0x29, 0x40, 0x28, 0xac, 0x04, 0x80, 0xe8, 0xa7, 0x00, 0x2d, 0xb4, 0x4a, 0x13, 0xac,
+    0x19, 0xf8, 0x39, 0xec, 0xc1, 0xbd, 0xd9, 0x52, 0xa0, 0x08, 0x27, 0x1f, 0xd9, 0x06, 0xe4, 0xb4,
+    0xa5, 0x39, 0x03, 0x1b, 0xaf, 0x92, 0x03, 0x84, 0x79, 0x68, 0x48, 0x3e, 0x54, 0x49, 0xb3, 0xac,
+    0x18, 0x8b, 0x00, 0x78, 0x09, 0x0a, 0xc0, 0xe0, 0x57, 0x03, 0xc0, 0xe1, 0x29, 0xc0, 0x95, 0xb4,
+    0x1b, 0x9c, 0x29, 0xd7, 0x4c, 0xbc, 0x7b, 0xa1, 0x33, 0xb1, 0x18, 0xd8, 0x3d, 0x51, 0x89, 0x40,
+    0xeb, 0x46, 0x30, 0xeb, 0x22, 0x30, 0xf2, 0x51, 0xb4, 0x00, 0xa8, 0x82, 0xe5, 0x2e, 0x9b, 0x53,
+    0xd3, 0x56, 0xa0, 0x60, 0x0b, 0x68, 0x58, 0x06, 0x00, 0x19, 0x84, 0x45, 0x01, 0x58, 0x84, 0x0a,
+    0xd0, 0x5e, 0x98, 0x04, 0x20, 0x06, 0x2c, 0xc0, 0x75, 0x07, 0x0e, 0x00, 0xa8, 0xa6, 0x00, 0xfa,
+    0x90, 0x37, 0x00, 0x6c, 0x81, 0x02, 0x00, 0xcb, 0xd8, 0x86, 0xab, 0x70, 0x80, 0xb7, 0xc3, 0xa3,
+    0x1c, 0x49, 0x5b, 0xb5, 0x5e, 0x05, 0x07, 0xec, 0xae, 0xaf, 0x03, 0x9a, 0xee, 0x2a, 0xed, 0x4d,
+    0xc8, 0x50, 0x6b, 0x72, 0xf6, 0x2b, 0xca, 0x48, 0x29, 0x80, 0xe2, 0x90, 0x76, 0x02, 0xc0, 0x3d,
+    0x28, 0xc0, 0x40, 0x74, 0x0e, 0x80, 0x66, 0xa7, 0x00, 0xe0, 0x5d, 0x35, 0x00, 0x24, 0xa0, 0x02,
+    0x58, 0xc7, 0xfa, 0x54, 0xb9, 0x66, 0x2d, 0x68, 0x4d, 0x5a, 0x30, 0x84, 0x2b, 0x81, 0x64, 0xce,
+    0x9a, 0xdb, 0x89, 0xb0, 0x03, 0x96, 0x2d, 0xc3, 0xc6, 0x63, 0xcc, 0x4d, 0xeb, 0xcd, 0x17, 0x29,
+    0x01, 0x58, 0x1f, 0x01, 0x30, 0x61, 0x99, 0x05, 0x40, 0x19, 0x2a, 0xc0, 0x39, 0x66, 0x1a, 0x00,
+    0x98, 0xa0, 0x00, 0xc6, 0xc8, 0x07, 0x00, 0x1e, 0x9e, 0x02, 0xb8, 0xd6, 0x08, 0x8d, 0xa1, 0x74,
+    0xad, 0xc6, 0x93, 0x7d, 0x62, 0x24, 0x6b, 0x01, 0x9a, 0xf3, 0xb0, 0x43, 0x08, 0x6f, 0x34, 0xa2,
+    0x12, 0x5b, 0xe7, 0x61, 0x46, 0x4e, 0x9b, 0x62, 0x05, 0x05, 0xe4, 0x42, 0x2f, 0x60, 0x82, 0xcf,
+    0x1f, 0xaa, 0xa7, 0x65, 0x34, 0x52, 0x90, 0x4f, 0x0a, 0x00, 0x06, 0xa8, 0x00, 0x9f, 0x78, 0x5b,
+    0x00, 0x22, 0xa0, 0x02, 0xe8, 0x18, 0x60, 0x01, 0xb8, 0x01, 0x0b, 0x40, 0xc6, 0x3e, 0x22, 0xc0,
+    0xa2, 0x81, 0x9e, 0xaf, 0xba, 0xd3, 0x9f, 0x4d, 0x05, 0x82, 0xa3, 0x3a, 0xda, 0x79, 0xc0, 0x4e,
+    0x63, 0x4a, 0x72, 0x32, 0x35, 0x2b, 0x3b, 0xe0, 0xb8, 0x0a, 0xca, 0x31, 0x44, 0x9d, 0x34, 0xcc,
+    0x8c, 0xf7, 0x1b, 0x80, 0xb7, 0xa0, 0x00, 0x17, 0x66, 0x0a, 0x00, 0x9c, 0x9e, 0x02, 0x14, 0xe8,
+    0x2e, 0xb7, 0x99, 0x74, 0xed, 0x63, 0x3c, 0xbb, 0x1e, 0x14, 0x93, 0x01, 0xdd, 0x09, 0xf9, 0x7b,
+    0xb6, 0x8e, 0xd4, 0xaa, 0x2d, 0xea, 0xee, 0x25, 0xc5, 0x0b, 0x88, 0xb6, 0x37, 0x71, 0xca, 0x39,
+    0x37, 0x2d, 0x16, 0x08, 0x87, 0x5d, 0x86, 0x6d, 0x80, 0x50, 0x40, 0x2e, 0x0b, 0x80, 0x65, 0xa8,
+    0x00, 0xf5, 0x05, 0x25, 0x00, 0xe2, 0x80, 0x02, 0x6c, 0x57, 0x3a, 0x00, 0x80, 0x6c, 0x0a, 0x20,
+    0x8f, 0xcf, 0x00, 0xc0, 0x1e, 0x28, 0x40, 0xaf, 0x52, 0x85, 0xb8, 0x2a, 0x07, 0x70, 0x2c, 0xb4,
+    0xa3, 0x8a, 0x34, 0x56, 0xd3, 0x99, 0x30, 0x39, 0xae, 0xfa, 0x3c, 0x00, 0x9a, 0x2d, 0x88, 0xf4,
+    0x83, 0x14, 0xb5, 0x27, 0x67, 0xf9, 0x95, 0x88, 0xb4, 0x02, 0x34, 0x26, 0x89, 0x0b, 0x58, 0x5c,
+    0x04, 0x78, 0x20, 0xc4, 0x39, 0x00, 0x68, 0x78, 0x0a, 0xb0, 0x5d, 0x3f, 0x01, 0x40, 0x0a, 0x2a,
+    0xc0, 0x7d, 0x96, 0x45, 0x95, 0x8b, 0xd6, 0x80, 0xe3, 0x5c, 0x57, 0x3c, 0x38, 0x13, 0x20, 0x3a,
+    0xcd, 0x19, 0xb1, 0x08, 0x3d, 0x60, 0xe9, 0xb4, 0x4e, 0xaa, 0xc6, 0xe4, 0x34, 0xa1, 0x7a, 0x43,
+    0x08, 0x80, 0x15, 0x12, 0x00, 0x09, 0xee, 0x32, 0x00, 0x14, 0xa2, 0x02, 0xc0, 0xc3, 0x0e, 0x01,
+    0x80, 0x0b, 0x0a, 0x00, 0x8d, 0xf7, 0x04, 0xe0, 0xe9, 0x29, 0x40, 0x7d, 0x35, 0x68, 0x16, 0x6a,
+    0xd7, 0x60, 0x17, 0x99, 0x82, 0x42, 0x32, 0x17, 0x98, 0x35, 0xb0, 0x76, 0x93, 0xf0, 0x48, 0xa0,
+    0xaa, 0xae, 0xf9, 0x13, 0x66, 0xec, 0x34, 0x6a, 0x72, 0xbe, 0xd3, 0x31, 0x14, 0x03, 0x38, 0xc5,
+    0xb4, 0x69, 0x7b, 0xda, 0x46, 0x3b, 0xfd, 0x38, 0x06, 0x00, 0x60, 0x82, 0x0a, 0xf0, 0x89, 0x35,
+    0x03, 0x20, 0x0a, 0x2a, 0x00, 0x8d, 0x69, 0x0b, 0x80, 0x3b, 0xa0, 0x00, 0xa0, 0x04, 0x6e, 0x0f,
+    0xac, 0x9a, 0xd9, 0xbd, 0x89, 0xb3, 0x36, 0xda, 0x56, 0xa0, 0xb7, 0xad, 0x25, 0x63, 0x08, 0xf4,
+    0x34, 0xe7, 0x0f, 0x21, 0x6b, 0xb7, 0xd2, 0x03, 0x96, 0xe2, 0x38, 0xe2, 0x49, 0x54, 0x4a, 0xd3,
+    0x60, 0xd9, 0x14, 0x6b, 0x79, 0x0d, 0xe4, 0x10, 0x62, 0xfd, 0x04, 0xc0, 0xf1, 0x29, 0x00, 0x67,
+    0xf6, 0x09, 0x99, 0x69, 0xd7, 0x2c, 0xd7, 0x63, 0x45, 0x48, 0xb1, 0x19, 0xd0, 0xd1, 0xef, 0x33,
+    0x7f, 0xeb, 0x4a, 0x2d, 0x4a, 0x23, 0x9f, 0x8c, 0x52, 0xc4, 0x00, 0x29, 0x70, 0x3b, 0xfb, 0x9d,
+    0x93, 0xd3, 0x6c, 0x6b, 0x50, 0x36, 0x62, 0x58, 0x07, 0x10, 0xe9, 0x03, 0x23, 0x00, 0x58, 0x88,
+    0x0a, 0xe0, 0x5f, 0x0e, 0x00, 0x20, 0x16, 0x28, 0x40, 0x78, 0x37, 0x15, 0x00, 0xe8, 0xa6, 0x00,
+    0xe9, 0x30, 0x52, 0x00, 0x6c, 0x82, 0x02, 0xb8, 0xea, 0x95, 0x8b, 0xab, 0x74, 0x60, 0x06, 0x42,
+    0xd1, 0x46, 0x48, 0x6b, 0x35, 0x1c, 0x0c, 0x67, 0x37, 0xa7, 0xef, 0x03, 0xa6, 0xc3, 0x6a, 0xa3,
+    0x2f, 0xc8, 0x11, 0x8a, 0x8a, 0x16, 0xd4, 0x48, 0x48, 0x2d, 0xe0, 0xe3, 0x92, 0xbd, 0x35, 0xc6,
+    0x4d, 0x80, 0xcb, 0x42, 0xfc, 0x14, 0x80, 0xa6, 0xa7, 0x00, 0xd4, 0xad, 0x58, 0x00, 0x66, 0xc0,
+    0x02, 0x58, 0x77, 0x8a, 0x01, 0x90, 0x84, 0x0a, 0xa0, 0x21, 0xea, 0x5d, 0xe5, 0xaa, 0xb5, 0x1f,
+    0x3a, 0x05, 0xee, 0x0d, 0xee, 0x04, 0x7e, 0x67, 0xd3, 0x9e, 0x2f, 0xc2, 0x0f, 0x58, 0x8e, 0xcd,
+    0x0b, 0xba, 0x31, 0x3b, 0xed, 0x08, 0x5b, 0xbd, 0x06, 0x6d, 0x8d, 0x90, 0xc3, 0x7f, 0x23, 0x03,
+    0x00, 0xa5, 0xa8, 0x00, 0xf8, 0xa8, 0x1d, 0x00, 0x60, 0x83, 0x02, 0x6c, 0xe3, 0x99, 0x00, 0x78,
+    0x7c, 0x0a, 0x60, 0x63, 0x17, 0xe8, 0x84, 0xe2, 0x35, 0x15, 0x40, 0x84, 0x93, 0x8f, 0xec, 0x05,
+    0x64, 0x47, 0xec, 0x3c, 0x29, 0xbc, 0x12, 0xc8, 0x2e, 0x2b, 0x5e, 0x82, 0x19, 0x3d, 0xad, 0xaa,
+    0x22, 0xdf, 0x22, 0x0d, 0xcd, 0x00, 0x52, 0x27, 0x21, 0x90, 0x9e, 0xd6, 0xd1, 0x50, 0x3b, 0x3e,
+    0x4b, 0x00, 0x18, 0xa1, 0x02, 0xe8, 0xc2, 0xcb, 0x00, 0x90, 0x01, 0x0b, 0x10, 0x8a, 0xaa, 0x00,
+    0x20, 0x12, 0x2a, 0x00, 0x8b, 0xb5, 0x00, 0x80, 0x5b, 0xa0, 0x00, 0xe1, 0x2c, 0xc8, 0x1d, 0x2c,
+    0x9b, 0xc9, 0x85, 0x88, 0x29, 0x64, 0xda, 0x58, 0x20, 0x77, 0xb1, 0xad, 0x38, 0x09, 0xfc, 0xb4,
+    0x27, 0xfc, 0xf8, 0x42, 0xbb, 0xf2, 0x03, 0x9e, 0x1e, 0x29, 0x38, 0x52, 0xd4, 0x4a, 0xeb, 0x3c,
+    0xd8, 0x46, 0x82, 0x79, 0x0f, 0xe0, 0xb2, 0xe2, 0x4b, 0x02, 0xc0, 0xf9, 0x29, 0x40, 0x32, 0x1c,
+    0x80, 0x92, 0x89, 0x27, 0x03, 0xf0, 0x23, 0x1f, 0x47, 0x31, 0x1a, 0xc8, 0xe9, 0xce, 0xa6, 0x84,
+    0xeb, 0x4c, 0x8d, 0x49, 0x24, 0x4d, 0x82, 0x52, 0xcc, 0x00, 0x29, 0x62, 0x0b, 0xf3, 0x9e, 0xb3,
+    0xd3, 0x76, 0x67, 0x78, 0x15, 0x5e, 0xd8, 0x07, 0x18, 0xc9, 0x23, 0x57, 0x01, 0x58, 0x8a, 0x0a,
+    0x80, 0xe0, 0xd7, 0x04, 0x20, 0x1e, 0x28, 0x00, 0x7a, 0x81, 0x0a, 0x00, 0x08, 0xa7, 0x00, 0xdf,
+    0x88, 0x26, 0x00, 0xec, 0x82, 0x02, 0x38, 0x0a, 0x17, 0x89, 0xab, 0x76, 0xc0, 0x55, 0xc1, 0x53,
+    0xdc, 0x47, 0x73, 0x35, 0x9b, 0x0c, 0x43, 0xcf, 0xa3, 0x0f, 0x04, 0xac, 0xac, 0x5a, 0xee, 0x20,
+    0x48, 0x92, 0x99, 0xaa, 0xf6, 0x4b, 0x08, 0x48, 0x2f, 0xa0, 0x54, 0x92, 0x9d, 0xe3, 0xc6, 0x55,
+    0x00, 0x4e, 0x43, 0x66, 0x0a, 0x80, 0xc6, 0xa7, 0x00, 0xd7, 0x4d, 0x30, 0x00, 0xe6, 0x80, 0x02,
+    0x50, 0x37, 0x01, 0x01, 0x90, 0x86, 0x0a, 0xb0, 0xa3, 0x6d, 0x73, 0xe5, 0xb2, 0x35, 0x9f, 0x39,
+    0x05, 0x46, 0x0d, 0x0e, 0x05, 0x74, 0x83, 0x33, 0xe8, 0x31, 0x42, 0x10, 0x60, 0xba, 0x6d, 0x44,
+    0xc3, 0x31, 0x3d, 0x6d, 0x89, 0xd9, 0x53, 0xec, 0x6c, 0x95, 0x90, 0x85, 0x7d, 0xc1, 0x15, 0x00,
+    0xc5, 0xc8, 0x00, 0x3f, 0x39, 0x6c, 0x7a, 0xe0, 0x83, 0x4c, 0x94, 0x23, 0xb7, 0x01, 0x78, 0x7e,
+    0x0a, 0xb0, 0xe6, 0x68, 0x2d, 0x84, 0xea, 0xb5, 0x51, 0x3e, 0x42, 0x4a, 0x8e, 0x0c, 0x06, 0x64,
+    0x7c, 0xdc, 0x9c, 0x2e, 0x3c, 0x13, 0xb8, 0xde, 0x6a, 0x7e, 0x85, 0x19, 0x3f, 0xcd, 0xea, 0x27,
+    0xdd, 0x90, 0x0d, 0xd5, 0x80, 0x55, 0x1f, 0xc7, 0xe5, 0x9d, 0xf6, 0xd1, 0x54, 0x34, 0xf6, 0x24,
+    0x00, 0x98, 0xa1, 0x02, 0x0c, 0x43, 0x3e, 0x00, 0x90, 0x03, 0x0a, 0x60, 0x0a, 0x22, 0x05, 0x20,
+    0x1a, 0x2a, 0xc0, 0x88, 0x13, 0x12, 0x80, 0x7b, 0xa0, 0x00, 0x26, 0xe5, 0x22, 0x2a, 0xac, 0x5b,
+    0xb3, 0x55, 0x87, 0x5f, 0x8d, 0xda, 0x5a, 0xa0, 0x56, 0xb5, 0x46, 0x0d, 0x0a, 0x04, 0xb5, 0x28,
+    0xe9, 0xc2, 0xd6, 0xbe, 0x12, 0x04, 0xa6, 0x5f, 0x01, 0x0f, 0x5c, 0x54, 0x4b, 0x03, 0xad, 0xb6,
+    0x6f, 0x9b, 0x79, 0x11, 0xe0, 0x43, 0xe3, 0xa5, 0x06, 0xc0, 0x01, 0x2a, 0xc0, 0x2c, 0x82, 0x12,
+    0x80, 0xa9, 0xa7, 0x00, 0x3e, 0xee, 0x4d, 0x00, 0x72, 0xc0, 0x02, 0x40, 0x30, 0xa6, 0xff, 0xc4,
+    0x6a, 0x00, 0xa7, 0x37, 0x63, 0xd8, 0xad, 0x3b, 0x35, 0x64, 0x97, 0x02, 0xfc, 0x48, 0x51, 0x03,
+    0xa4, 0x48, 0xcd, 0xaa, 0x7d, 0x4e, 0x4f, 0x03, 0xe6, 0x81, 0x90, 0x65, 0x61, 0x21, 0x80, 0x94,
+    0x0e, 0x2d, 0x03, 0x60, 0x31, 0x32, 0x80, 0x84, 0x71, 0x0a, 0x80, 0x98, 0xa0, 0x00, 0xf1, 0x25,
+    0x6f, 0x00, 0xa0, 0x9c, 0x02, 0x50, 0xc3, 0xab, 0x01, 0xb0, 0x0d, 0x0a, 0xd0, 0xa5, 0x66, 0xf2,
+    0xad, 0xe2, 0x01, 0x94, 0x03, 0x33, 0xa7, 0x1d, 0xed, 0xd5, 0x6a, 0x2b, 0x0c, 0x1d, 0x82, 0xbe,
+    0x10, 0xd0, 0x5a, 0x2a, 0x21, 0x47, 0x20, 0x4b, 0xa6, 0x1a, 0xdb, 0x23, 0xee, 0x20, 0xc5, 0x18,
+    0x55, 0x44, 0xc0, 0x65, 0x1e, 0x77, 0x01, 0x40, 0x0d, 0x39, 0x70, 0x00, 0x9a, 0x9f, 0x02, 0x6c,
+    0x37, 0x21, 0x00, 0x98, 0x05, 0x0a, 0x20, 0xdd, 0xd4, 0x01, 0x40, 0x22, 0x2a, 0x80, 0x96, 0xda,
+    0x43, 0x96, 0xeb, 0xd6, 0x78, 0xe1, 0xe4, 0x67, 0x34, 0xb8, 0x14, 0xb0, 0x85, 0x8e, 0x06, 0xcb,
+    0x08, 0x43, 0xa0, 0xf9, 0x36, 0xe5, 0x12, 0xc7, 0xfc, 0xb4, 0xa7, 0x61, 0xeb, 0xa7, 0xb2, 0x75,
+    0x02, 0x1e, 0xa4, 0x11, 0x4b, 0x8a, 0x60, 0x44, 0xbb, 0xbc, 0x83, 0x12, 0x01, 0x78, 0x80, 0x0a,
+    0xd0, 0x67, 0x11, 0x5c, 0x83, 0xf2, 0x35, 0x4d, 0x40, 0xee, 0xc0, 0x8c, 0x2c, 0x06, 0x64, 0xaa,
+    0xfc, 0xed, 0x34, 0xbc, 0x13, 0x90, 0xb6, 0xca, 0xdb, 0x86, 0x19, 0x41, 0xcd, 0x9a, 0xac, 0xf2,
+    0xcd, 0x0d, 0xdd, 0x00, 0x19, 0x1a, 0x73, 0x17, 0x9d, 0x16, 0xd2, 0x54, 0x2c, 0x06, 0x70, 0x00,
+    0x18, 0xa2, 0x02, 0x34, 0x83, 0x75, 0x01, 0x90, 0x05, 0x0a, 0xd0, 0x8a, 0x8a, 0x02, 0x20, 0x22,
+    0x2a, 0x40, 0x86, 0x3d, 0x07, 0x80, 0x9b, 0xa0, 0x00, 0x6f, 0xb5, 0x6e, 0x34, 0x2c, 0x5c, 0x9b,
+    0x31, 0xc6, 0xd1, 0xac, 0xda, 0x5c, 0x40, 0x56, 0xb9, 0xdf, 0xd2, 0x0a, 0x0c, 0x35, 0x2a, 0xd7,
+    0x4a, 0xee, 0xc1, 0x32, 0x04, 0xac, 0xa2, 0x29, 0x57, 0x67, 0xd4, 0x4b, 0x1b, 0x41, 0x75, 0xdd,
+    0xb2, 0x79, 0x13, 0xa0, 0xb4, 0xe3, 0xfc, 0x03, 0xc0, 0x09, 0x2a, 0xc0, 0x2a, 0xc2, 0x08, 0x80,
+    0xc9, 0xa7, 0x00, 0x41, 0x16, 0x26, 0x00, 0xf2, 0x80, 0x02, 0xe0, 0xd0, 0x0e, 0xcf, 0xc4, 0x6c,
+    0xe0, 0x46, 0x33, 0x2c, 0x5d, 0xad, 0x43, 0xb5, 0xe1, 0x9f, 0xae, 0xf2, 0x46, 0x71, 0x03, 0xa6,
+    0x02, 0xd5, 0x08, 0x7d, 0xce, 0x4f, 0x23, 0x72, 0x62, 0x00, 0x4f, 0x61, 0x23, 0xa0, 0xc4, 0xe1,
+    0x60, 0x00, 0x20, 0x2e, 0x28, 0x80, 0x7e, 0xcf, 0x10, 0x00, 0x48, 0xa7, 0x00, 0xca, 0x98, 0x3e,
+    0x00, 0xec, 0x83, 0x02, 0x58, 0x48, 0x1d, 0x5e, 0xab, 0x7a, 0x00, 0xa4, 0xc0, 0x46, 0x06, 0x47,
+    0x83, 0x35, 0x1a, 0x06, 0x75, 0x9b, 0x9d, 0x4f, 0x04, 0xaa, 0x83, 0xd2, 0x21, 0x02, 0x48, 0x53,
+    0xb2, 0xc6, 0x76, 0x07, 0x79, 0x48, 0x33, 0xed, 0x75, 0x0f, 0x43, 0x4e, 0xc8, 0x65, 0x80, 0xd1,
+    0x42, 0xc0, 0x11, 0x80, 0x06, 0xa8, 0x00, 0xe0, 0x5d, 0x51, 0x00, 0xe6, 0x81, 0x02, 0x4c, 0x77,
+    0xa8, 0x01, 0x90, 0x8a, 0x0a, 0x50, 0x10, 0xa4, 0x04, 0x00, 0x07, 0x2c, 0x40, 0x9c, 0x4c, 0xf6,
+    0x96, 0x0b, 0xd7, 0x74, 0xda, 0x3c, 0xc6, 0x34, 0x38, 0x15, 0x90, 0xfd, 0xce, 0x6e, 0xca, 0x08,
+    0x45, 0xe0, 0x99, 0x36, 0xb1, 0x08, 0xc7, 0x04, 0x35, 0x29, 0x5f, 0xcb, 0x3a, 0xb1, 0x95, 0x02,
+    0x26, 0xd2, 0xe9, 0x27, 0x8e, 0xe0, 0x44, 0xfb, 0xdc, 0x03, 0x6e, 0x00, 0x78, 0x82, 0x0a, 0x40,
+    0xe4, 0xdc, 0x5a, 0x82, 0xfa, 0xb5, 0x06, 0x46, 0x8e, 0x33, 0x8b, 0x4c, 0x06, 0x64, 0xcf, 0x14,
+    0x4f, 0x3c, 0x3c, 0x14, 0x68, 0xb6, 0x8a, 0x38, 0x8e, 0x19, 0x43, 0xcd, 0x9a, 0x30, 0x06, 0xbc,
+    0x0d, 0xe5, 0x00, 0xdc, 0x16, 0xf5, 0xec, 0x9b, 0x36, 0xd2, 0x56, 0x23, 0x16, 0x4b, 0x00, 0x98,
+    0x22, 0x03, 0x5c, 0xe3, 0xeb, 0x00, 0x90, 0x07, 0x0a, 0x50, 0x8b, 0xf6, 0x06, 0x20, 0x2a, 0x2a,
+    0xc0, 0x83, 0x7f, 0x18, 0x80, 0xbb, 0xa0, 0x00, 0xbb, 0xa5, 0x4a, 0x3c, 0xac, 0x5c, 0x73, 0x21,
+    0xe5, 0x42, 0xc6, 0xda, 0x5e, 0xe0, 0x55, 0x3d, 0x83, 0x70, 0x0b, 0x14, 0xb5, 0xab, 0xc6, 0xa6,
+    0x85, 0xc4, 0x52, 0x04, 0xb0, 0xe7, 0xb1, 0x2f, 0x73, 0x54, 0x4c, 0x3b, 0x05, 0x54, 0x4b, 0xc8,
+    0x79, 0x15, 0x20, 0x05, 0xe4, 0x5a, 0x01, 0xc0, 0x11, 0x2a, 0x40, 0x29, 0xfc, 0x1a, 0x80, 0xe9,
+    0xa7, 0x00, 0x41, 0xfe, 0x6d, 0x00, 0x72, 0x81, 0x02, 0x9c, 0x31, 0x79, 0x8c, 0xc4, 0x6e, 0xc0,
+    0xb6, 0x2e, 0xe7, 0x8a, 0xac, 0x4b, 0xb5, 0x5f, 0xaa, 0x5e, 0x29, 0x44, 0x91, 0x03, 0xa8, 0xb9,
+    0xdc, 0xd6, 0x79, 0x4e, 0x50, 0x4b, 0x26, 0x23, 0x69, 0x30, 0x61, 0x25, 0xc0, 0x54, 0xe2, 0x2b,
+    0x05, 0x20, 0x36, 0x28, 0x00, 0x81, 0xb5, 0x05, 0x00, 0x68, 0xa7, 0x00, 0xbf, 0xf0, 0x11, 0x00,
+    0x6c, 0x84, 0x02, 0xa0, 0xc6, 0x63, 0x25, 0xab, 0x7c, 0x80, 0xb2, 0xc0, 0xb0, 0x9b, 0x46, 0x8b,
+    0xb5, 0x99, 0xfe, 0x94, 0x93, 0x9a, 0x6f, 0x34, 0xa2, 0x75, 0x7a, 0x6b, 0x0e, 0xc8, 0x13, 0xb8,
+    0x9e, 0xb6, 0x87, 0xb6, 0x48, 0x35, 0x8d, 0x96, 0x0d, 0x0b, 0xf4, 0xc8, 0x6d, 0x80, 0x12, 0x42,
+    0x8e, 0x07, 0x80, 0x26, 0xa8, 0x00, 0xe7, 0x35, 0x2a, 0x00, 0x66, 0x82, 0x02, 0x54, 0x37, 0x17,
+    0x01, 0x90, 0x8c, 0x0a, 0xf0, 0x8f, 0x44, 0x02, 0x00, 0x0f, 0x28, 0x80, 0xa0, 0xbc, 0x8c, 0x97,
+    0x2b, 0xd7, 0x70, 0xd4, 0xa4, 0x23, 0x36, 0xb8, 0x15, 0x70, 0x69, 0x8f, 0x9c, 0xcd, 0x08, 0x47,
+    0x00, 0xca, 0xb5, 0x7a, 0xfd, 0xc6, 0x0c, 0x35, 0x2b, 0x5e, 0xd7, 0x71, 0xaf, 0xb5, 0x02, 0x2e,
+    0xe6, 0xe9, 0x83, 0x8d, 0x60, 0x45, 0x33, 0xfd, 0xe3, 0x8c, 0x01, 0x78, 0x84, 0x0a, 0x50, 0x5e,
+    0x14, 0x01, 0x80, 0x02, 0x2a, 0xc0, 0x41, 0x82, 0x06, 0x00, 0x1d, 0xb0, 0x00, 0x37, 0x99, 0xa7,
+    0x24, 0xb2, 0x19, 0x88, 0xb1, 0xb3, 0xc2, 0x12, 0xf1, 0x52, 0x00, 0x79, 0xab, 0x59, 0x65, 0x66,
+    0x14, 0xb5, 0xeb, 0xcf, 0x8a, 0xe8, 0x35, 0xb4, 0x03, 0x7c, 0x57, 0xa4, 0x09, 0x6b, 0x5a, 0x49,
+    0x5b, 0x85, 0xc3, 0x63, 0x00, 0x90, 0x09, 0x0a, 0xf0, 0x0b, 0x55, 0x04, 0x20, 0x32, 0x2a, 0x40,
+    0x81, 0x97, 0x0d, 0x80, 0xdb, 0xa0, 0x00, 0x0b, 0x56, 0x27, 0x41, 0x2c, 0x5d, 0x53, 0x29, 0x04,
+    0x76, 0xdd, 0xda, 0x60, 0xa0, 0x45, 0xc1, 0x37, 0xfd, 0x0b, 0x1c, 0x35, 0xed, 0xb7, 0x02, 0xb9,
+    0xc6, 0x72, 0x04, 0xb2, 0x2d, 0x12, 0x89, 0x7f, 0xd4, 0x4c, 0x5b, 0xed, 0xd2, 0x79, 0xe1, 0x79,
+    0x17, 0xa0, 0x25, 0xe4, 0xc8, 0x05, 0xc0, 0x19, 0x2a, 0xc0, 0x29, 0xc0, 0x12, 0x00, 0x1a, 0xb0,
+    0x00, 0xa1, 0xa8, 0x43, 0x00, 0x26, 0xa0, 0x02, 0xfc, 0xf8, 0x12, 0x01, 0xc8, 0x07, 0x0a, 0xe0,
+    0xc9, 0x9d, 0x0e, 0x11, 0xc3, 0x01, 0xda, 0xa7, 0x66, 0x42, 0xae, 0x4e, 0xd5, 0x76, 0xda, 0x5a,
+    0x80, 0x02, 0xc5, 0x0e, 0xa8, 0xb6, 0xf1, 0xcf, 0xcc, 0x39, 0x43, 0xad, 0xd9, 0x8f, 0x40, 0x46,
+    0x84, 0x9d, 0x80, 0x93, 0x8b, 0xa9, 0x0b, 0x80, 0xf8, 0xa0, 0x00, 0x0f, 0xae, 0x5a, 0x00, 0x20,
+    0x9e, 0x02, 0xd4, 0x62, 0x57, 0x01, 0xb0, 0x13, 0x0a, 0x60, 0x8d, 0xa1, 0x03, 0xa0, 0xfa, 0x29,
+    0x40, 0x04, 0x5b, 0xc4, 0x18, 0x4d, 0xd6, 0x64, 0xd2, 0xcb, 0xae, 0x5e, 0x3e, 0x12, 0x60, 0xba,
+    0xa9, 0x11, 0x73, 0x20, 0x51, 0xe0, 0x0a, 0x59, 0x22, 0xd0, 0x23, 0xdd, 0xb4, 0x1c, 0x2f, 0x5a,
+    0x67, 0x26, 0xd7, 0x01, 0x4c, 0x03, 0xa1, 0x66, 0x00, 0x1a, 0xa1, 0x02, 0xbc, 0x57, 0x0e, 0x00,
+    0x98, 0x0b, 0x0a, 0x80, 0x5d, 0x09, 0x02, 0x40, 0x3a, 0x2a, 0x00, 0x3e, 0x7e, 0x1b, 0x00, 0x5c,
+    0xa0, 0x00, 0x89, 0x7a, 0x0d, 0x60, 0x2e, 0x5d, 0xa3, 0x3d, 0x33, 0x00, 0xe0, 0xe0, 0x58, 0x40,
+    0x15, 0xbf, 0x2d, 0x3c, 0x23, 0x24, 0x8d, 0xe9, 0xd2, 0xc6, 0xac, 0x1b, 0x53, 0xd4, 0xb2, 0x7b,
+    0x55, 0x24, 0xb6, 0x56, 0x0b, 0xe0, 0xb0, 0xc7, 0x3f, 0x27, 0x82, 0x17, 0x4d, 0x55, 0x10, 0xa9,
+    0x03, 0xe0, 0x19, 0x2a, 0x80, 0x77, 0x47, 0x17, 0x00, 0x2a, 0xa8, 0x00, 0x0a, 0x29, 0x64, 0x00,
+    0xf4, 0x80, 0x02, 0x70, 0x25, 0x02, 0x6e, 0xc8, 0x68, 0x20, 0xf6, 0x4f, 0x25, 0xe1, 0xc4, 0x53,
+    0x81, 0x61, 0xb2, 0x24, 0x4b, 0x9a, 0x71, 0xd4, 0xae, 0x69, 0x13, 0x04, 0xd1, 0x50, 0x0f, 0x20,
+    0x66, 0xf1, 0x3f, 0x9d, 0x69, 0x27, 0x8d, 0xb5, 0x0e, 0x77, 0x06, 0x40, 0x2e, 0x28, 0x80, 0x32,
+    0xc2, 0x06, 0x80, 0xe8, 0xa8, 0x00, 0xfb, 0xcd, 0x0a, 0x00, 0xee, 0x83, 0x02, 0x78, 0xf9, 0x14,
+    0x0e, 0xb1, 0x76, 0x8d, 0x44, 0x0d, 0xa1, 0xc3, 0x6b, 0x8b, 0x81, 0x55, 0x14, 0xbd, 0x0b, 0x31,
+    0x90, 0x04, 0xaf, 0xac, 0x72, 0xc0, 0x1f, 0x4b, 0x12, 0xc0, 0xc6, 0x29, 0x4f, 0x2d, 0x52, 0x35,
+    0xed, 0xe5, 0xc7, 0x8f, 0xcb, 0xe7, 0x65, 0x00, 0x98, 0x90, 0xef, 0x0c, 0x00, 0x87, 0xa8, 0x00,
+    0xad, 0x48, 0x23, 0x00, 0xe8, 0x80, 0x02, 0x80, 0x02, 0x6b, 0x00, 0x98, 0x82, 0x0a, 0xa0, 0x63,
+    0xae, 0x01, 0x20, 0x27, 0x28, 0x00, 0x37, 0x5d, 0x11, 0x3f, 0x2c, 0x07, 0x64, 0x53, 0xba, 0x54,
+    0xa7, 0xba, 0x55, 0xbb, 0x45, 0x6c, 0x30, 0xcb, 0x13, 0x3d, 0xc0, 0x2a, 0x42, 0x0a, 0x89, 0xe6,
+    0x14, 0xb5, 0x68, 0x4d, 0x36, 0x6f, 0x0e, 0x96, 0x02, 0x50, 0x66, 0xee, 0x68, 0x39, 0x62, 0x04,
+    0x80, 0x68, 0xd8, 0xb6, 0x00, 0x80, 0x7a, 0x0a, 0xd0, 0x0a, 0x92, 0x02, 0xc0, 0x56, 0x28, 0xc0,
+    0x32, 0x30, 0x06, 0x80, 0x0a, 0xa8, 0x00, 0x1c, 0x14, 0xd8, 0x5c, 0xb4, 0x59, 0x93, 0x79, 0xee,
+    0x3c, 0x4c, 0xf9, 0x4a, 0xe0, 0xe8, 0xa6, 0xd1, 0xa1, 0x82, 0x4c, 0x01, 0x2c, 0x5b, 0xa3, 0x34,
+    0x93, 0x94, 0xd3, 0x7c, 0xa6, 0x60, 0xeb, 0xa3, 0xdc, 0x07, 0x40, 0xf5, 0x83, 0xfb, 0x00, 0x68,
+    0x86, 0x0a, 0x80, 0x5f, 0xd8, 0x04, 0x60, 0x36, 0x28, 0x40, 0x77, 0xcb, 0x1a, 0x00, 0x09, 0xc9,
+    0x00, 0xef, 0xa0, 0x46, 0x00, 0xf0, 0x81, 0x02, 0x10, 0x2a, 0x64, 0x85, 0xb9, 0x76, 0x2d, 0xd6,
+    0xcc, 0xbf, 0xac, 0x83, 0x6b, 0x81, 0x93, 0x00, 0xdf, 0x47, 0x8d, 0xb0, 0x04, 0xaa, 0x37, 0xcb,
+    0x0d, 0x6e, 0xcc, 0x51, 0xcb, 0x06, 0xb6, 0x0a, 0xbe, 0x5a, 0x2f, 0x20, 0x44, 0x1e, 0xad, 0x4a,
+    0x08, 0x66, 0x34, 0x57, 0x42, 0x9a, 0x04, 0x80, 0x87, 0xa8, 0x00, 0xd2, 0x55, 0x64, 0x00, 0x6a,
+    0xc0, 0x02, 0x64, 0x37, 0xe1, 0x00, 0xa0, 0x84, 0x0a, 0xc0, 0x10, 0xd6, 0x03, 0x40, 0x17, 0x28,
+    0x80, 0x60, 0x74, 0x92, 0x84, 0xac, 0x06, 0x60, 0x0a, 0x8d, 0xe4, 0x58, 0xbc, 0x15, 0xf0, 0x89,
+    0x6b, 0x0e, 0xb6, 0x19, 0x49, 0xed, 0x9a, 0xb8, 0x6a, 0xbd, 0x0c, 0xfd, 0x80, 0xe4, 0x18, 0x75,
+    0xe9, 0x98, 0x96, 0xd2, 0x58, 0xf4, 0x70, 0x45, 0x00, 0x64, 0x83, 0x02, 0x50, 0x63, 0x84, 0x01,
+    0x88, 0x90, 0x0a, 0x10, 0xdf, 0xfc, 0x04, 0xe0, 0x46, 0x28, 0x80, 0xad, 0xf1, 0xf5, 0x10, 0x8b,
+    0xd7, 0x3a, 0xab, 0x80, 0x17, 0xc0, 0x36, 0x19, 0x48, 0x2d, 0x52, 0x2c, 0x16, 0x03, 0x4b, 0x6d,
+    0x3a, 0x28, 0xc7, 0x31, 0xb2, 0x2c, 0x01, 0x2b, 0xad, 0xb0, 0x2b, 0x25, 0x75, 0xd3, 0x66, 0x4c,
+    0x04, 0x93, 0x7f, 0xde, 0x06, 0x90, 0xf9, 0xd8, 0x2e, 0x00, 0x70, 0x8a, 0x0a, 0x50, 0x0b, 0xce,
+    0x06, 0x80, 0x16, 0x28, 0x00, 0x28, 0x6c, 0x18, 0x80, 0x49, 0xa8, 0x00, 0x33, 0xf6, 0x60, 0x00,
+    0xf2, 0x82, 0x02, 0x80, 0x34, 0x86, 0x9e, 0xc3, 0x74, 0xe0, 0x65, 0x20, 0xee, 0x4a, 0xa9, 0x63,
+    0xb5, 0x19, 0xd3, 0xea, 0x49, 0x38, 0xf1, 0x03, 0xb0, 0xd7, 0x63, 0x5d, 0x5b, 0xce, 0x11, 0xa4,
+    0xc6, 0x05, 0x57, 0xb8, 0x60, 0x2b, 0x40, 0xa5, 0xe0, 0xce, 0x6b, 0x24, 0x4e, 0x80, 0x0d, 0x89,
+    0x2b, 0x00, 0x00, 0xc8, 0xa7, 0x00, 0xa6, 0x28, 0x6d, 0x00, 0xec, 0x85, 0x02, 0x04, 0x63, 0x9e,
+    0x01, 0xa8, 0x82, 0x0a, 0xe0, 0x42, 0xe4, 0x6a, 0x45, 0xa3, 0x35, 0x99, 0xd8, 0xf0, 0x17, 0x92,
+    0xcf, 0x04, 0x84, 0x77, 0x22, 0x66, 0x36, 0x48, 0x15, 0xc0, 0xf2, 0x94, 0xc8, 0x70, 0x49, 0x3b,
+    0x6d, 0xb8, 0x89, 0x95, 0xd4, 0xca, 0x85, 0x00, 0x94, 0x3d, 0xec, 0x05, 0x80, 0x86, 0xa8, 0x00,
+    0x01, 0x36, 0x27, 0x00, 0xe6, 0x83, 0x02, 0x98, 0x83, 0x7a, 0x00, 0xc0, 0x09, 0x0a, 0x10, 0xa7,
+    0x4c, 0xfb, 0xe5, 0xe2, 0x35, 0x16, 0x33, 0x97, 0x49, 0x0f, 0xce, 0x05, 0x48, 0x0c, 0x5c, 0x6d,
+    0x37, 0x42, 0x13, 0xc0, 0x8a, 0x8c, 0x61, 0xb7, 0x31, 0x49, 0xed, 0xaa, 0x58, 0x26, 0x9d, 0x6a,
+    0xc5, 0x00, 0x53, 0x75, 0x4e, 0xa1, 0x1f, 0xb8, 0xd1, 0x64, 0x0c, 0x29, 0x5b, 0x00, 0x9e, 0xa2,
+    0x02, 0x50, 0x97, 0xfc, 0x00, 0xa8, 0x03, 0x0a, 0x60, 0xdd, 0x34, 0x01, 0x80, 0x1a, 0x2a, 0x00,
+    0x43, 0x8a, 0x05, 0x00, 0x7d, 0xa0, 0x00, 0xa7, 0x91, 0x22, 0x07, 0x32, 0x1b, 0x78, 0x3d, 0x94,
+    0x17, 0x95, 0xf1, 0x58, 0x00, 0xf7, 0xaf, 0xb4, 0x34, 0x67, 0x2c, 0x35, 0xac, 0xe7, 0x22, 0xce,
+    0x31, 0x14, 0x04, 0x9c, 0x71, 0x64, 0xec, 0x60, 0xda, 0x4a, 0x63, 0xf1, 0x05, 0xa4, 0xb4, 0x91,
+    0x0f, 0x00, 0xf2, 0x0d, 0x6a, 0x03, 0x20, 0x4a, 0x2a, 0x40, 0x7a, 0x23, 0x09, 0x80, 0x3b, 0xa1,
+    0x00, 0xb9, 0xee, 0xdd, 0x40, 0xac, 0x5e, 0x9b, 0x48, 0xa2, 0x9a, 0x11, 0xdb, 0x66, 0x00, 0x05,
+    0x4c, 0x85, 0x3d, 0x0c, 0x34, 0xb5, 0xe7, 0x98, 0x22, 0xba, 0xc8, 0xd2, 0x04, 0xaa, 0xf3, 0x72,
+    0x8a, 0x9b, 0x54, 0x4e, 0xc3, 0x8d, 0x30, 0x74, 0x03, 0x7a, 0x1d, 0x80, 0x96, 0x63, 0x51, 0x05,
+    0xc0, 0x31, 0x2a, 0x80, 0x2f, 0xb8, 0x11, 0x00, 0x7a, 0xa0, 0x00, 0xa4, 0x90, 0x37, 0x00, 0xa6,
+    0xa1, 0x02, 0xac, 0x18, 0xd8, 0x00, 0xc8, 0x0d, 0x0a, 0xc0, 0x56, 0xed, 0x2e, 0x0d, 0xdb, 0x81,
+    0x95, 0x6e, 0x1c, 0xa2, 0xa0, 0xae, 0xd5, 0x5e, 0x8a, 0xc3, 0x03, 0xcd, 0x44, 0x10, 0xd0, 0x3a,
+    0xae, 0xe4, 0x2e, 0x39, 0x49, 0x0d, 0xfb, 0x1a, 0xf5, 0x05, 0x82, 0xb5, 0x00, 0x16, 0x6a, 0xfd,
+    0xe5, 0x95, 0x58, 0x01, 0x44, 0x2d, 0xfe, 0x43, 0x00, 0xa0, 0x9f, 0x02, 0x84, 0x62, 0x03, 0x01,
+    0xb0, 0x19, 0x0a, 0x80, 0x0b, 0x5c, 0x04, 0xa0, 0x12, 0x2a, 0x80, 0x11, 0x17, 0x61, 0x14, 0xad,
+    0xd6, 0x62, 0x1f, 0x73, 0x3f, 0x3e, 0xbe, 0x13, 0xe8, 0x21, 0x8a, 0xfa, 0x02, 0x21, 0x57, 0x00,
+    0x4b, 0x50, 0x11, 0xa9, 0x26, 0xf5, 0x34, 0x64, 0x28, 0xdc, 0x69, 0x2d, 0x37, 0x02, 0x52, 0xee,
+    0x38, 0x61, 0x00, 0x9a, 0x22, 0x03, 0x2c, 0x58, 0x03, 0x00, 0x98, 0x11, 0x0a, 0xb0, 0x0d, 0x6c,
+    0x06, 0x00, 0x2f, 0x28, 0x80, 0x93, 0x3a, 0xe4, 0x96, 0xab, 0xd7, 0x4e, 0xce, 0x5c, 0xf0, 0x3e,
+    0xb8, 0x17, 0x10, 0x31, 0x90, 0x2e, 0xeb, 0x08, 0x4f, 0x00, 0xeb, 0xb0, 0x1b, 0xdb, 0xc6, 0x2c,
+    0xc1, 0x6a, 0x64, 0xbb, 0x6c, 0xa9, 0x35, 0x03, 0x56, 0xbf, 0x99, 0xcf, 0x78, 0x60, 0x47, 0xa3,
+    0x35, 0x04, 0xd0, 0x00, 0x78, 0x8c, 0x0a, 0x70, 0x5d, 0xa9, 0x01, 0xa0, 0x16, 0x28, 0xc0, 0x74,
+    0x9b, 0x17, 0x00, 0x8a, 0xa8, 0x00, 0x0a, 0xd9, 0x5e, 0x00, 0x74, 0x82, 0x02, 0x20, 0x87, 0xb0,
+    0x19, 0xc8, 0x6e, 0xc6, 0x15, 0x51, 0x6f, 0x2a, 0xc7, 0x6b, 0x81, 0xd9, 0xc7, 0xb2, 0x68, 0x9e,
+    0xd1, 0x04, 0xb3, 0xa9, 0x3b, 0x1a, 0xc5, 0xd0, 0x10, 0x98, 0x0e, 0x52, 0x0b, 0x7b, 0x69, 0x2d,
+    0xad, 0xd5, 0x1d, 0xa9, 0x68, 0x46, 0x46, 0x80, 0x4e, 0x3a, 0x06, 0x03, 0x80, 0x48, 0xa9, 0x00,
+    0xe2, 0x05, 0x6a, 0x00, 0x6e, 0x85, 0x02, 0xf0, 0x97, 0x0f, 0x01, 0xb0, 0x7c, 0x0a, 0x00, 0x09,
+    0x5c, 0x84, 0x6c, 0xa3, 0x81, 0xd3, 0x3b, 0x69, 0xcd, 0x2f, 0xf0, 0xd4, 0x96, 0x50, 0xca, 0xc3,
+    0x1f, 0xcb, 0x13, 0xa0, 0xb6, 0x4c, 0x5d, 0x79, 0x52, 0x3b, 0x8d, 0x47, 0x40, 0x61, 0xf3, 0xe7,
+    0x7d, 0x80, 0x9a, 0x8c, 0xb5, 0x0b, 0x00, 0xe7, 0xa8, 0x00, 0xc7, 0x90, 0x21, 0x00, 0x68, 0x82,
+    0x02, 0xa4, 0xc2, 0x33, 0x00, 0x98, 0x88, 0x0a, 0x10, 0xe2, 0xac, 0x00, 0x20, 0x3f, 0x28, 0x80,
+    0x6f, 0xf9, 0x92, 0x2f, 0x8c, 0x07, 0x4e, 0x70, 0x01, 0xd2, 0x71, 0x3a, 0x57, 0x63, 0x31, 0xaf,
+    0x43, 0xe1, 0x12, 0x43, 0x00, 0x8b, 0xb4, 0x48, 0xa1, 0xe3, 0x2c, 0xb5, 0x6c, 0x7c, 0x36, 0xee,
+    0x03, 0xf6, 0x02, 0x5e, 0x4f, 0xb5, 0xe4, 0x6b, 0xe2, 0x05, 0x40, 0xd5, 0x38, 0x5c, 0x00, 0x80,
+    0x80, 0x0a, 0xf0, 0x09, 0x51, 0x01, 0xc0, 0x6e, 0x28, 0xc0, 0x2b, 0xd4, 0x08, 0x80, 0x6a, 0xa8,
+    0x00, 0x40, 0x26, 0x07, 0x00, 0x76, 0xc0, 0x02, 0x98, 0xf1, 0x2c, 0x35, 0xd1, 0x6c, 0x2d, 0x46,
+    0xad, 0xea, 0x51, 0xe3, 0x43, 0x01, 0x9c, 0xa8, 0xc8, 0x45, 0x12, 0x92, 0x05, 0xb0, 0xc4, 0x0c,
+    0xe0, 0x77, 0xd2, 0x4f, 0x63, 0xe2, 0xc2, 0x12, 0xf8, 0x72, 0x25, 0x20, 0x05, 0xeb, 0x7a, 0x34,
+    0x66, 0x4e, 0x34, 0x08, 0x34, 0x76, 0x0f, 0x00, 0xdc, 0xa0, 0x00, 0x16, 0x1a, 0xde, 0x53, 0x2e,
+    0x5f, 0x03, 0x4d, 0x33, 0x24, 0xfd, 0xe0, 0x60, 0x00, 0x14, 0xc0, 0xa7, 0x02, 0x24, 0x44, 0x01,
+    0xea, 0xbe, 0x9e, 0x62, 0x1b, 0xd3, 0xd4, 0xa8, 0x93, 0x75, 0x94, 0xa2, 0x56, 0x0d, 0x80, 0x99,
+    0x86, 0xa4, 0xc8, 0x81, 0x1f, 0xed, 0xc6, 0x10, 0xd5, 0x00, 0xe0, 0x39, 0x2a, 0x00, 0x77, 0xc3,
+    0x19, 0x80, 0x7a, 0xa0, 0x00, 0xd3, 0xad, 0x38, 0x00, 0xa8, 0xa2, 0x02, 0x1c, 0x44, 0xda, 0x00,
+    0xd0, 0x0b, 0x0a, 0x20, 0x9e, 0x58, 0x2c, 0x21, 0xc3, 0x19, 0x56, 0x44, 0xd7, 0x81, 0x20, 0xcf,
+    0x05, 0x5c, 0x3f, 0x23, 0xeb, 0x80, 0xc6, 0x53, 0xd3, 0xb6, 0x0e, 0xb0, 0x17, 0x43, 0x45, 0xe0,
+    0x8a, 0x49, 0x9b, 0xd9, 0xa5, 0xbd, 0x34, 0x57, 0x84, 0xde, 0xd6, 0x17, 0x39, 0x01, 0x4a, 0xf2,
+    0x50, 0x52, 0x00, 0xa2, 0xa5, 0x02, 0x70, 0x17, 0xfe, 0x00, 0xb8, 0x17, 0x0a, 0x30, 0x5f, 0xe8,
+    0x01, 0xc0, 0xfa, 0x29, 0x40, 0x40, 0xfa, 0x09, 0x00, 0x1e, 0xb0, 0x00, 0xa1, 0x08, 0x24, 0xcb,
+    0xb6, 0x1a, 0x30, 0x55, 0xd4, 0x4d, 0xe0, 0x02, 0x51, 0xed, 0x78, 0x24, 0xee, 0x91, 0xb1, 0x44,
+    0x0d, 0x6a, 0xd8, 0x10, 0x2d, 0x27, 0xd5, 0xd3, 0x82, 0xf0, 0xa3, 0x8e, 0x7a, 0x5e, 0x08, 0xb0,
+    0xa5, 0x98, 0x26, 0x00, 0x70, 0x90, 0x0c, 0x10, 0x8d, 0xd9, 0x06, 0x80, 0x2e, 0x28, 0x00, 0x2c,
+    0x92, 0x14, 0x80, 0xa9, 0xa8, 0x00, 0x17, 0x9e, 0x4f, 0x00, 0x72, 0x84, 0x02, 0x64, 0xf8, 0xa3,
+    0xaa, 0xc2, 0x7a, 0x20, 0xa4, 0x92, 0xa9, 0x1a, 0xa6, 0x7b, 0xb5, 0x14, 0x04, 0x8d, 0x8b, 0x28,
+    0x51, 0x04, 0xaa, 0x06, 0xfb, 0xdf, 0x27, 0x4e, 0x93, 0xb9, 0xce, 0x48, 0x4b, 0x0e, 0x60, 0x31,
+    0x46, 0xe6, 0x4f, 0x13, 0x3c, 0x28, 0x66, 0x00, 0xd6, 0x8e, 0xa9, 0x16, 0x00, 0x28, 0xa8, 0x00,
+    0x9f, 0x20, 0x5a, 0x00, 0x6c, 0x87, 0x02, 0xa0, 0xa2, 0x01, 0x00, 0xa8, 0x88, 0x0a, 0x20, 0xe4,
+    0x32, 0x05, 0x60, 0x0f, 0x28, 0x40, 0x23, 0x73, 0x28, 0x12, 0xed, 0xd6, 0x60, 0x84, 0xba, 0xed,
+    0x2e, 0xbe, 0x14, 0x90, 0x15, 0xeb, 0x80, 0x3f, 0x21, 0x5b, 0x20, 0x0b, 0xc8, 0xdc, 0x2b, 0x28,
+    0x05, 0xb5, 0x28, 0x37, 0x5a, 0x94, 0x31, 0x77, 0x02, 0x54, 0x9e, 0xe6, 0x6d, 0x74, 0x66, 0x45,
+    0xdb, 0x18, 0x23, 0x53, 0x00, 0xc0, 0x0f, 0x0a, 0xf0, 0x9b, 0xb1, 0x5b, 0xe4, 0xfa, 0xb5, 0x0b,
+    0x36, 0x3f, 0x68, 0x0f, 0x2e, 0x06, 0x3c, 0xea, 0xfb, 0x09, 0x47, 0xc2, 0x14, 0x80, 0xb2, 0xcb,
+    0x4c, 0xbb, 0x31, 0x4f, 0x6d, 0xba, 0xd8, 0x76, 0x2e, 0x6a, 0xdd, 0x80, 0x1a, 0x63, 0x90, 0x00,
+    0x1b, 0x18, 0xd2, 0x70, 0x0a, 0xb1, 0x57, 0x00, 0x1e, 0x24, 0x03, 0x88, 0x37, 0x0e, 0x01, 0xa8,
+    0x09, 0x0a, 0x30, 0x5d, 0x28, 0x01, 0x80, 0x32, 0x2a, 0x80, 0x40, 0x6c, 0x03, 0x00, 0xdd, 0xa0,
+    0x00, 0xf5, 0x71, 0x9f, 0x1f, 0xb2, 0x5c, 0x53, 0x4d, 0xb4, 0x5e, 0x4d, 0xf2, 0x5e, 0x00, 0xe5,
+    0xb5, 0x39, 0x94, 0x68, 0x44, 0xb5, 0x6c, 0xea, 0x2e, 0x53, 0x32, 0x74, 0x34, 0xb2, 0xaf, 0xb4,
+    0xe1, 0x5d, 0x5a, 0x4c, 0x7b, 0xb9, 0x08, 0xed, 0x5e, 0x91, 0x15, 0x80, 0xb5, 0x0f, 0x84, 0x02,
+    0x20, 0x62, 0x2a, 0x00, 0x76, 0x5d, 0x05, 0x80, 0x9b, 0xa1, 0x00, 0xeb, 0x95, 0x69, 0x00, 0x2c,
+    0xa0, 0x02, 0x18, 0x84, 0x0b, 0x00, 0xe0, 0x03, 0x0a, 0x00, 0x8c, 0x0b, 0xe8, 0x6c, 0xb3, 0x81,
+    0x92, 0x4c, 0x91, 0x18, 0x2c, 0x30, 0xd5, 0x84, 0x4a, 0x22, 0x6a, 0x10, 0xcb, 0x14, 0x98, 0x36,
+    0xce, 0x46, 0x5a, 0x52, 0x3f, 0xcd, 0x48, 0xbe, 0x76, 0x2d, 0xe7, 0x8d, 0x80, 0xdb, 0x36, 0x68,
+    0x12, 0x00, 0xda, 0xa0, 0x00, 0xb9, 0xc0, 0x26, 0x00, 0x26, 0xa3, 0x02, 0x30, 0xf8, 0x8e, 0x00,
+    0xc8, 0x13, 0x0a, 0xb0, 0x67, 0x34, 0x80, 0x09, 0xf3, 0x01, 0x0d, 0x3a, 0xc2, 0xe0, 0x94, 0x0e,
+    0xd6, 0x4c, 0x54, 0x1c, 0x8c, 0x8b, 0xc4, 0xd1, 0x90, 0x26, 0x0b, 0xea, 0x52, 0x38, 0x4f, 0xa6,
+    0x8a, 0xa7, 0xdf, 0x85, 0x81, 0xcd, 0x98, 0x5a, 0x2d, 0x5b, 0x47, 0xa7, 0xb8, 0x01, 0x60, 0x3f,
+    0x2e, 0x2e, 0x00, 0x20, 0xa1, 0x02, 0x88, 0xc2, 0xbd, 0x00, 0xb0, 0x1f, 0x0a, 0x30, 0x8a, 0xd4,
+    0x04, 0xa0, 0x2a, 0x32, 0x40, 0x90, 0x81, 0x0b, 0x80, 0x5d, 0xa0, 0x00, 0xbc, 0x4c, 0x69, 0x45,
+    0x34, 0x5c, 0x73, 0xc1, 0x68, 0x2e, 0xa7, 0xf8, 0x54, 0xa0, 0xf5, 0x2e, 0x91, 0x4b, 0x85, 0x74,
+    0x81, 0xec, 0x0d, 0xcb, 0xa6, 0xa2, 0x34, 0xd4, 0xaa, 0x09, 0xb1, 0xac, 0xcd, 0x5c, 0x0a, 0x58,
+    0xd9, 0xd8, 0x19, 0x07, 0x9a, 0x17, 0x6d, 0xb4, 0x0b, 0xc0, 0x05, 0x00, 0x47, 0x28, 0x40, 0x3f,
+    0x3c, 0xa6, 0x8a, 0x0b, 0x28, 0x07, 0xdf, 0xcc, 0xe8, 0x3a, 0x38, 0x19, 0xe8, 0x20, 0x4f, 0x69,
+    0x41, 0x09, 0x55, 0x80, 0x39, 0xae, 0xaf, 0xfa, 0xc6, 0x44, 0x35, 0x29, 0x5e, 0x95, 0xf2, 0xa8,
+    0x95, 0x03, 0x74, 0x75, 0xb1, 0x4b, 0x66, 0xe0, 0x48, 0xd3, 0xa5, 0xd7, 0x81, 0x00, 0xa8, 0x0b,
+    0x0a, 0x60, 0xdd, 0xc4, 0x05, 0x80, 0x3a, 0x2a, 0x00, 0x3f, 0x32, 0x15, 0x00, 0xfd, 0xa0, 0x00,
+    0xfd, 0x49, 0xea, 0x2c, 0x32, 0x5d, 0x3b, 0x69, 0x14, 0xdb, 0x94, 0xf2, 0x60, 0x60, 0xb4, 0xb7,
+    0xc8, 0x21, 0x69, 0x4c, 0xb5, 0x2b, 0xe8, 0x32, 0xeb, 0x33, 0x94, 0x04, 0xaa, 0xc7, 0xfc, 0x39,
+    0x5e, 0xda, 0x4c, 0x8b, 0xed, 0xa8, 0x69, 0x46, 0x91, 0x17, 0x20, 0x26, 0x10, 0xf2, 0x06, 0x20,
+    0x6a, 0x2a, 0x40, 0x75, 0x25, 0x17, 0x80, 0xbb, 0xa1, 0x00, 0xe4, 0x05, 0x44, 0x00, 0xac, 0xa0,
+    0x02, 0x28, 0x64, 0x37, 0x01, 0xe0, 0x05, 0x0a, 0x30, 0x8e, 0xd1, 0x14, 0x6d, 0xbb, 0x01, 0x52,
+    0x51, 0x29, 0xb0, 0x29, 0x50, 0xd5, 0x7a, 0x57, 0xc2, 0xc4, 0x04, 0x4b, 0x15, 0x98, 0xc6, 0x4e,
+    0x80, 0x35, 0x52, 0x41, 0x4d, 0x29, 0x3e, 0xf7, 0x7a, 0xe6, 0x95, 0x80, 0x5b, 0x39, 0x90, 0x09,
+    0x00, 0xfa, 0xa0, 0x00, 0xc2, 0x50, 0x6b, 0x00, 0xa6, 0xa3, 0x02, 0x08, 0x78, 0xa0, 0x01, 0xc8,
+    0x15, 0x0a, 0x80, 0xe9, 0x7f, 0x6b, 0x08, 0xfb, 0x81, 0xc6, 0x2a, 0x04, 0xf3, 0x91, 0x2e, 0xd6,
+    0x48, 0x97, 0x34, 0x5b, 0x75, 0x44, 0x12, 0x70, 0x4e, 0x0a, 0x53, 0x08, 0x38, 0x51, 0x66, 0xba,
+    0x2b, 0x92, 0xdb, 0x82, 0xd5, 0x9c, 0x5c, 0x1d, 0x77, 0x5a, 0xae, 0xd8, 0x01, 0x66, 0x41, 0x16,
+    0x02, 0x00, 0xa0, 0xa1, 0x02, 0x9c, 0x82, 0x15, 0x00, 0xb0, 0x21, 0x0a, 0xe0, 0x63, 0x85, 0x00,
+    0x60, 0x1f, 0x28, 0x40, 0x3c, 0x2b, 0x70, 0x10, 0x2d, 0xd7, 0x5a, 0xd9, 0x91, 0x28, 0x26, 0xbe,
+    0x15, 0x38, 0x7d, 0x4c, 0x49, 0x60, 0x21, 0x5f, 0x40, 0xdb, 0x3e, 0x85, 0xf6, 0x28, 0x15, 0xb5,
+    0x2c, 0x4f, 0xe6, 0x61, 0x35, 0xb7, 0x02, 0x58, 0xd5, 0x95, 0x21, 0x8d, 0x66, 0x46, 0x53, 0xc5,
+    0xe2, 0xca, 0x00, 0xc0, 0x13, 0x0a, 0x10, 0x8d, 0x4e, 0x06, 0xe0, 0x0a, 0x2a, 0x00, 0x8a, 0x2d,
+    0x1b, 0x80, 0x1e, 0xb0, 0x00, 0xe8, 0xbc, 0xbf, 0x35, 0xb8, 0x19, 0xe8, 0x64, 0x0e, 0xea, 0x6e,
+    0x09, 0x57, 0xe0, 0xf8, 0xad, 0x25, 0x18, 0xc7, 0x4c, 0xb5, 0x28, 0x56, 0x5f, 0xeb, 0xa9, 0xb5,
+    0x03, 0x80, 0x62, 0x89, 0x24, 0x61, 0x60, 0x49, 0xd3, 0xc5, 0xd7, 0xb8, 0x01, 0xa8, 0x0d, 0x0a,
+    0xa0, 0x5d, 0x50, 0x03, 0x80, 0x42, 0x32, 0x00, 0x3d, 0xb2, 0x0a, 0x00, 0x1d, 0xa1, 0x00, 0xf7,
+    0x51, 0xc5, 0x38, 0xb2, 0x5d, 0x1b, 0xa1, 0x74, 0x54, 0xe0, 0xf2, 0x62, 0xa0, 0x23, 0x39, 0x6b,
+    0xce, 0x69, 0x54, 0xb5, 0xea, 0xe4, 0x06, 0x23, 0x36, 0xb4, 0x04, 0xa2, 0xdf, 0x14, 0x13, 0x60,
+    0x5a, 0x4d, 0x9b, 0xed, 0x68, 0xa5, 0x37, 0x91, 0x19, 0xc0, 0x76, 0x10, 0x5d, 0x04, 0x20, 0x72,
+    0x2a, 0x00, 0x75, 0xef, 0x0c, 0x80, 0xdb, 0xa1, 0x00, 0xde, 0x55, 0x1e, 0x00, 0x2c, 0xa1, 0x02,
+    0x30, 0x84, 0x9f, 0x00, 0xe0, 0x07, 0x0a, 0x80, 0x90, 0x84, 0x32, 0x6d, 0xc3, 0x81, 0x11, 0x54,
+    0xc7, 0x67, 0x27, 0x70, 0xd5, 0x72, 0x6c, 0x42, 0x1f, 0xf7, 0xca, 0x15, 0x90, 0x2e, 0xaf, 0xf8,
+    0x04, 0x52, 0x43, 0xed, 0x79, 0xbe, 0x75, 0xa8, 0xe5, 0x9d, 0x00, 0x9c, 0x3b, 0xc8, 0x00, 0x00,
+    0x1a, 0xa1, 0x00, 0xcd, 0x38, 0x3f, 0x00, 0x26, 0xa4, 0x02, 0xdc, 0x37, 0xf0, 0x00, 0xc8, 0x17,
+    0x0a, 0x60, 0x61, 0xdc, 0x00, 0x00, 0x03, 0x2a, 0x80, 0x1d, 0x66, 0x69, 0x8f, 0x4e, 0xd6, 0x44,
+    0xd9, 0x8c, 0xba, 0x5f, 0xc4, 0x12, 0x50, 0x92, 0x09, 0x7d, 0x45, 0x38, 0x53, 0x20, 0xea, 0xaf,
+    0x4f, 0x39, 0x84, 0xdd, 0xb4, 0x5e, 0x0f, 0x57, 0x51, 0xb5, 0xf8, 0x01, 0x6a, 0x3f, 0x36, 0x47,
+    0x00, 0x20, 0xa2, 0x02, 0xb8, 0x82, 0x32, 0x01, 0xb0, 0x23, 0x0a, 0x90, 0xe3, 0x26, 0x05, 0x60,
+    0x27, 0x28, 0x40, 0x4b, 0x25, 0x86, 0x0f, 0x4d, 0xd7, 0x56, 0x80, 0x81, 0x04, 0x24, 0x3e, 0x16,
+    0x08, 0x55, 0x0d, 0x72, 0x69, 0x21, 0x61, 0x00, 0x3b, 0xba, 0x47, 0x0c, 0x29, 0x1d, 0xb5, 0x2b,
+    0x5d, 0xbc, 0x74, 0x37, 0xd7, 0x02, 0x5a, 0x7b, 0x5d, 0xed, 0x96, 0xe6, 0x46, 0x7b, 0xa5, 0xe2,
+    0x25, 0x00, 0xc0, 0x15, 0x0a, 0x70, 0x8c, 0xfe, 0x03, 0xe0, 0x12, 0x2a, 0x00, 0x8c, 0x8f, 0x11,
+    0x80, 0x3e, 0xa0, 0x00, 0xf4, 0x6c, 0x16, 0x2e, 0x38, 0x1a, 0xe8, 0x80, 0xed, 0x6a, 0x9c, 0x09,
+    0x59, 0x20, 0x38, 0xae, 0x9e, 0x3c, 0xc7, 0x54, 0xb5, 0xa8, 0x4a, 0x25, 0x64, 0xab, 0xd5, 0x03,
+    0x8a, 0x58, 0xb9, 0xed, 0x5c, 0xe0, 0x49, 0xdb, 0xe9, 0x97, 0x2e, 0x01, 0xa8, 0x0f, 0x0a, 0xb0,
+    0x0e, 0x06, 0x00, 0x40, 0x4f, 0x28, 0x00, 0x78, 0x32, 0xc8, 0x90, 0x8c, 0xd7, 0x3c, 0x3e, 0x25,
+    0x63, 0xca, 0x3c, 0x19, 0xc0, 0x88, 0x8e, 0x03, 0x9d, 0x1a, 0x57, 0x6d, 0x6a, 0xb8, 0xb2, 0x3d,
+    0x0e, 0x35, 0x01, 0x67, 0x3d, 0x67, 0x97, 0x98, 0x76, 0xd3, 0x6c, 0x32, 0x0a, 0x47, 0x4a, 0xe4,
+    0x06, 0xd0, 0x2d, 0x24, 0x75, 0x00, 0x88, 0x9e, 0x0a, 0x40, 0xdd, 0xbc, 0x00, 0xe0, 0x7e, 0x28,
+    0x80, 0x76, 0x2f, 0x1a, 0x00, 0x6b, 0xa8, 0x00, 0x0d, 0x39, 0x01, 0x00, 0x78, 0x82, 0x02, 0xa4,
+    0x84, 0x0e, 0x52, 0xdb, 0x72, 0x20, 0x34, 0xd5, 0xdc, 0x46, 0x09, 0x64, 0x35, 0xda, 0xa1, 0x98,
+    0x1a, 0xba, 0x92, 0x05, 0xa4, 0xdd, 0x6b, 0x9c, 0x73, 0x54, 0x51, 0x9b, 0xd2, 0xef, 0x3e, 0x2f,
+    0x79, 0x29, 0x00, 0x87, 0x9a, 0x6e, 0x55, 0x84, 0x4e, 0x80, 0xca, 0x35, 0xb4, 0x04, 0x80, 0x29,
+    0xa9, 0x00, 0xee, 0xdd, 0x0f, 0x00, 0x72, 0x86, 0x02, 0x30, 0x78, 0x71, 0x01, 0xc0, 0x82, 0x0a,
+    0xe0, 0x84, 0x1d, 0x48, 0xa3, 0x9b, 0x35, 0x10, 0x46, 0xa3, 0x26, 0x13, 0xd1, 0x04, 0x8c, 0x40,
+    0xfa, 0xb8, 0x21, 0x4e, 0x15, 0x80, 0xfa, 0x4c, 0x87, 0x63, 0x61, 0x39, 0x2d, 0xf8, 0xc0, 0x08,
+    0x12, 0x2f, 0x86, 0x80, 0x1b, 0x8f, 0x19, 0x07, 0x00, 0xa8, 0xa8, 0x00, 0xb7, 0xf8, 0x23, 0x00,
+    0x6c, 0x89, 0x02, 0xc4, 0x58, 0xae, 0x00, 0xd8, 0x0b, 0x0a, 0x10, 0x57, 0x17, 0xa6, 0x43, 0xdb,
+    0x35, 0x94, 0x49, 0xd8, 0xb3, 0x88, 0xaf, 0x05, 0x36, 0x8f, 0xc3, 0xb6, 0x5b, 0xc8, 0x18, 0xb8,
+    0x66, 0x0d, 0x80, 0x40, 0x4a, 0x49, 0x90, 0x1a, 0x1b, 0xe1, 0x5a, 0xce, 0xbd, 0x80, 0x97, 0x49,
+    0x17, 0x72, 0xa7, 0xd9, 0xd1, 0x68, 0xa3, 0x00, 0x51, 0x00, 0xf0, 0x85, 0x02, 0xf4, 0xc2, 0x6b,
+    0x00, 0xb8, 0x86, 0x0a, 0x70, 0xe3, 0xf6, 0x01, 0xa0, 0x17, 0x28, 0x40, 0x41, 0x5d, 0x57, 0x09,
+    0xae, 0x06, 0x38, 0x1d, 0x73, 0xeb, 0x73, 0xc2, 0x16, 0xe0, 0xb9, 0x4b, 0x83, 0xda, 0x31, 0x57,
+    0x0d, 0x2a, 0xcf, 0x3d, 0x56, 0x6b, 0xfd, 0x00, 0xe5, 0x55, 0x90, 0x51, 0x16, 0x98, 0xd2, 0x78,
+    0x04, 0x3e, 0x29, 0x00, 0x6a, 0x84, 0x02, 0x84, 0xe3, 0x17, 0x01, 0xd0, 0x15, 0x0a, 0x00, 0x9b,
+    0xd7, 0xa6, 0x24, 0xeb, 0x35, 0xcb, 0x57, 0xf9, 0x8f, 0x36, 0x6f, 0x06, 0x24, 0xaa, 0xcb, 0x9b,
+    0xb2, 0x46, 0x56, 0x83, 0xe2, 0x8d, 0xe3, 0xc4, 0x43, 0x4f, 0x80, 0x89, 0x50, 0x88, 0x53, 0xa6,
+    0xe5, 0xb4, 0x9c, 0x88, 0x0a, 0x09, 0x12, 0xd9, 0x01, 0x7a, 0x0d, 0xb9, 0x65, 0x00, 0x22, 0xa8,
+    0x02, 0x58, 0x97, 0x53, 0x01, 0xb8, 0x21, 0x0a, 0x70, 0xdd, 0x24, 0x04, 0xc0, 0x22, 0x2a, 0x40,
+    0x43, 0xa2, 0x12, 0x00, 0xbe, 0xa0, 0x00, 0x46, 0xa9, 0x4f, 0xd5, 0x36, 0x1d, 0xf8, 0x48, 0xb5,
+    0x2e, 0x29, 0x02, 0x5b, 0xcd, 0x65, 0x2a, 0x51, 0x8c, 0xad, 0x6c, 0x81, 0xa8, 0xf9, 0xc6, 0x5a,
+    0x19, 0x75, 0x04, 0xaf, 0x05, 0xd4, 0xa7, 0x3b, 0xde, 0x0a, 0xc8, 0xe9, 0x67, 0xdd, 0x34, 0xa1,
+    0x15, 0xe0, 0x13, 0x0e, 0x6e, 0x05, 0x60, 0x52, 0x2a, 0x80, 0x79, 0x19, 0x15, 0x80, 0xbc, 0xa1,
+    0x00, 0x02, 0xce, 0x3a, 0x00, 0x30, 0xa1, 0x02, 0xfc, 0x40, 0x4a, 0xb7, 0xe8, 0x68, 0xed, 0x23,
+    0x55, 0xbd, 0xc6, 0x43, 0x3c, 0x81, 0xa0, 0x89, 0xa4, 0x24, 0x8c, 0x73, 0x05, 0x9e, 0x7a, 0xcb,
+    0x3e, 0x6b, 0xd8, 0x4e, 0x2b, 0xaa, 0x0f, 0xaf, 0x29, 0x8c, 0x23, 0x20, 0x67, 0xe3, 0x2d, 0x06,
+    0x00, 0x32, 0x2a, 0x00, 0x30, 0x20, 0x1b, 0x00, 0x7b, 0xa2, 0x00, 0x28, 0x46, 0x04, 0x00, 0x76,
+    0x83, 0x02, 0xec, 0xb6, 0xe8, 0xd4, 0xd0, 0x78, 0x8d, 0x04, 0x0d, 0x72, 0x2a, 0xe2, 0x73, 0x01,
+    0x4a, 0xf3, 0x70, 0xe4, 0x16, 0x52, 0x06, 0xaa, 0x10, 0x83, 0x6b, 0x8c, 0xd2, 0x52, 0x83, 0xc6,
+    0x87, 0x26, 0xb4, 0x73, 0x31, 0x20, 0x56, 0x4d, 0x30, 0x22, 0x6a, 0x7e, 0x34, 0xdc, 0x27, 0x14,
+    0x0a, 0x00, 0x9c, 0xa1, 0x00, 0xb4, 0x40, 0x66, 0x00, 0x2e, 0xa2, 0x02, 0xf4, 0x98, 0xa2, 0x01,
+    0xe8, 0x07, 0x0a, 0xb0, 0x51, 0x3e, 0xb3, 0x81, 0xb3, 0x01, 0x0e, 0xb4, 0xe4, 0xd2, 0x9f, 0xd0,
+    0x05, 0x6c, 0x01, 0x03, 0x68, 0x7a, 0x4c, 0x56, 0x83, 0xca, 0x52, 0x19, 0xf7, 0x5a, 0x41, 0x00,
+    0x2a, 0x96, 0xe9, 0x61, 0x05, 0xae, 0x34, 0x1e, 0xb7, 0x7d, 0x63, 0x92, 0x3a, 0x01, 0x2a, 0xd7,
+    0xc8, 0x1a, 0x00, 0xf4, 0x85, 0x02, 0x40, 0xc5, 0x2a, 0x23, 0xc9, 0x7c, 0x6d, 0x51, 0x59, 0xc6,
+    0x41, 0xce, 0xa3, 0x11, 0x05, 0xea, 0xe8, 0x99, 0xaf, 0xb1, 0xd5, 0x9a, 0x6b, 0xe3, 0x95, 0xff,
+    0x50, 0x14, 0x50, 0x56, 0x14, 0x52, 0xa2, 0x69, 0x3b, 0x8d, 0xf7, 0x20, 0x08, 0x70, 0x44, 0x7e,
+    0x00, 0x60, 0x43, 0xa0, 0x0f, 0x80, 0x28, 0xca, 0x00, 0xda, 0x65, 0x2e, 0x00, 0xee, 0x88, 0x02,
+    0x54, 0x57, 0x6d, 0x00, 0xb0, 0x8a, 0x0a, 0xb0, 0x10, 0x29, 0x02, 0x80, 0x37, 0x28, 0x00, 0x56,
+    0x00, 0x2b, 0xb5, 0x6d, 0x07, 0x38, 0x50, 0xe5, 0x28, 0x80, 0x40, 0x57, 0x4b, 0x19, 0x4b, 0x80,
+    0x22, 0x2b, 0x5d, 0x00, 0x7a, 0x3e, 0x93, 0x5c, 0x45, 0x25, 0xb5, 0xec, 0x06, 0x07, 0xc0, 0x8a,
+    0xd7, 0x02, 0x74, 0x2d, 0xaa, 0x97, 0x56, 0xe8, 0x05, 0x38, 0xad, 0x43, 0xa9, 0x00, 0x98, 0x96,
+    0x0a, 0xf0, 0x5d, 0x89, 0x02, 0x20, 0x77, 0x28, 0x40, 0x7e, 0x65, 0x06, 0x00, 0x6c, 0xa8, 0x00,
+    0x52, 0x58, 0x31, 0x28, 0xba, 0x5a, 0xf3, 0x10, 0x36, 0x35, 0xbb, 0x10, 0x51, 0x80, 0x87, 0xa1,
+    0xc8, 0xed, 0xe3, 0x64, 0x81, 0xe7, 0xeb, 0x06, 0xa7, 0x1e, 0xd6, 0xd3, 0x92, 0xcf, 0x33, 0xc6,
+    0x1f, 0x63, 0x09, 0xd0, 0xbd, 0x58, 0xe6, 0x00, 0x80, 0x8e, 0x0c, 0xa0, 0x0c, 0x52, 0x04, 0xc0,
+    0xa6, 0x3c, 0x80, 0x87, 0x41, 0x13, 0x80, 0xfd, 0xa0, 0x00, 0x0c, 0xce, 0x92, 0x2f, 0xb4, 0x5e,
+    0xfb, 0x34, 0x02, 0xa4, 0x8d, 0xf8, 0x5e, 0x60, 0xe1, 0xc0, 0xdf, 0xbd, 0x85, 0x9c, 0x01, 0xe9,
+    0xb2, 0x78, 0xf1, 0xa1, 0xd4, 0xd4, 0x9c, 0x33, 0x52, 0x56, 0xf4, 0xdc, 0x0c, 0xa0, 0x25, 0x32,
+    0xb7, 0x93, 0x9a, 0x21, 0x8d, 0xd7, 0x09, 0x02, 0x00, 0x00, 0x6f, 0x28, 0x00, 0x2b, 0x32, 0x10,
+    0x80, 0xab, 0xa8, 0x00, 0x40, 0xde, 0x40, 0x00, 0x7a, 0x82, 0x02, 0xe4, 0xf4, 0x29, 0x40, 0xe0,
+    0x6e, 0x80, 0xb3, 0x27, 0xb5, 0x8a, 0x28, 0x7c, 0x01, 0x58, 0xc7, 0xae, 0x8f, 0x1f, 0xb3, 0xd5,
+    0xa0, 0x6a, 0x6c, 0x28, 0xc6, 0xd6, 0x10, 0xa8, 0xe2, 0xc5, 0x9c, 0x53, 0x81, 0x2d, 0x8d, 0xb7,
+    0xe8, 0x3a, 0x5a, 0xa4, 0x56, 0x00, 0x10, 0x33, 0xee, 0x17, 0x00, 0x9d, 0xa1, 0x00, 0xeb, 0x58,
+    0x28, 0x00, 0xb2, 0x9f, 0x02, 0xb4, 0xd7, 0xa6, 0x01, 0xf0, 0x6a, 0x01, 0xa0, 0xb9, 0x37, 0x94,
+    0x6c, 0x74, 0xb5, 0x64, 0xd8, 0xa8, 0x98, 0x43, 0x34, 0x05, 0x90, 0x1a, 0xc5, 0xe1, 0x6c, 0x5a,
+    0x4f, 0x03, 0xe6, 0x07, 0x33, 0x19, 0x91, 0x21, 0x40, 0xf8, 0x5d, 0x87, 0x00, 0xe0, 0x96, 0x28,
+    0x40, 0x75, 0x1b, 0x19, 0x00, 0xcb, 0xc8, 0x00, 0x07, 0x81, 0x6a, 0x00, 0xf8, 0x83, 0x02, 0x7c,
+    0xc5, 0x23, 0x4a, 0xdb, 0x78, 0x00, 0x03, 0xd5, 0x58, 0x58, 0x07, 0x7c, 0x35, 0x52, 0xb9, 0xfe,
+    0x3a, 0xae, 0xf2, 0x05, 0x9c, 0xe1, 0xeb, 0x26, 0x46, 0xd4, 0x52, 0xab, 0xd2, 0x30, 0x25, 0x6d,
+    0x78, 0x2f, 0x60, 0xb7, 0xa4, 0x83, 0x0e, 0x86, 0x66, 0x80, 0x16, 0x3d, 0x9c, 0x1b, 0x80, 0x89,
+    0xa9, 0x00, 0xd9, 0xad, 0x6d, 0x00, 0xf2, 0x87, 0x02, 0xc0, 0xd7, 0xa3, 0x01, 0xc0, 0x88, 0x0a,
+    0x30, 0x90, 0x2d, 0x05, 0xc0, 0x07, 0x2c, 0x80, 0x1d, 0xfa, 0xc2, 0x88, 0xce, 0xd6, 0x3a, 0xad,
+    0x95, 0x2f, 0x24, 0xc4, 0x14, 0xb0, 0x55, 0x68, 0xd7, 0x28, 0x39, 0x5b, 0xc0, 0xf9, 0xbd, 0xa5,
+    0x56, 0x88, 0xfd, 0x34, 0x67, 0xef, 0x18, 0xa8, 0xcb, 0x78, 0x02, 0x76, 0x92, 0xf9, 0x1e, 0x93,
+    0xec, 0x4a, 0x9b, 0x4c, 0x78, 0x93, 0x00, 0xd8, 0x11, 0x0a, 0x50, 0x66, 0x9e, 0x8d, 0x42, 0xf3,
+    0xb5, 0x8c, 0x2a, 0x04, 0x0d, 0x80, 0x0f, 0xa6, 0x00, 0x51, 0x94, 0x3a, 0x5b, 0x48, 0x1a, 0x80,
+    0x2a, 0x0a, 0x7f, 0x06, 0x4a, 0x4f, 0x6d, 0x89, 0xa7, 0x33, 0x9b, 0xcf, 0xd5, 0x80, 0xdb, 0x10,
+    0xe7, 0xf1, 0xa8, 0x39, 0xd2, 0x7e, 0x9f, 0xf0, 0x48, 0x00, 0x70, 0x87, 0x02, 0x98, 0x02, 0x6c,
+    0x00, 0xb8, 0x8c, 0x0a, 0x10, 0xe4, 0x8a, 0x01, 0xa0, 0x2f, 0x28, 0x40, 0x57, 0x67, 0x54, 0x01,
+    0x0e, 0x07, 0x36, 0x1f, 0xaa, 0x0a, 0x8f, 0x42, 0x18, 0x48, 0x01, 0xed, 0x55, 0x0a, 0x32, 0x5d,
+    0x0d, 0xea, 0x41, 0xa1, 0xd8, 0x6c, 0x15, 0x01, 0x2d, 0x66, 0xbc, 0x2f, 0x15, 0xf8, 0xd2, 0x78,
+    0x21, 0x5e, 0x84, 0x41, 0xea, 0x05, 0x40, 0x09, 0xa3, 0xd0, 0x00, 0xd0, 0x1b, 0x0a, 0x20, 0x0e,
+    0x26, 0x00, 0x20, 0x03, 0x2a, 0x00, 0x86, 0xb5, 0x02, 0x80, 0x1f, 0xb0, 0x00, 0xf7, 0xfd, 0x41,
+    0x00, 0x3c, 0x5b, 0x00, 0x08, 0x8e, 0x7e, 0x48, 0x1b, 0x5f, 0xad, 0xb8, 0xb5, 0xe3, 0xbb, 0x11,
+    0x55, 0x01, 0x63, 0x45, 0xd3, 0x0f, 0x9c, 0xf6, 0xd3, 0x86, 0xe5, 0xe1, 0xa7, 0x44, 0xe4, 0x08,
+    0x18, 0x96, 0x57, 0x4f, 0x01, 0xb8, 0x27, 0x0a, 0x10, 0x90, 0x11, 0x04, 0x80, 0x47, 0x28, 0x00,
+    0x54, 0xf8, 0x75, 0xb3, 0xad, 0x07, 0x22, 0x56, 0x25, 0xd2, 0x6a, 0x40, 0x58, 0xf3, 0x04, 0x6c,
+    0x1f, 0xa3, 0x2a, 0x61, 0xa0, 0x79, 0xbd, 0x44, 0x60, 0x43, 0x35, 0xb5, 0xa8, 0x13, 0x9f, 0xa8,
+    0x82, 0x17, 0x03, 0x78, 0x5b, 0x22, 0xc8, 0x6b, 0xe8, 0x06, 0x98, 0xed, 0x63, 0x08, 0x01, 0x98,
+    0x9a, 0x0a, 0x60, 0x5d, 0x29, 0x04, 0x20, 0x87, 0x28, 0x00, 0x7a, 0xf3, 0x11, 0x00, 0xac, 0xa8,
+    0x00, 0x08, 0x69, 0x31, 0x00, 0xfc, 0x80, 0x02, 0x78, 0x62, 0x52, 0x7f, 0xe8, 0x6e, 0xad, 0xb3,
+    0xdc, 0x24, 0xc9, 0x41, 0x54, 0x81, 0xd8, 0x87, 0xbe, 0xe3, 0x94, 0xd3, 0x05, 0x9c, 0x06, 0x64,
+    0xc8, 0x8c, 0x58, 0x50, 0x93, 0xd6, 0x2e, 0xab, 0xdf, 0x8c, 0x29, 0x80, 0xc7, 0x9f, 0xb0, 0xa6,
+    0xca, 0xb6, 0xb4, 0x0e, 0x82, 0x3f, 0x1b, 0x80, 0x3d, 0xa1, 0x00, 0x9a, 0x3e, 0xa2, 0x1f, 0xb4,
+    0x5f, 0x7b, 0xc8, 0xe2, 0x29, 0x00, 0xf8, 0x62, 0x0a, 0x40, 0xc9, 0x7f, 0xa1, 0x85, 0xac, 0x01,
+    0x66, 0x93, 0x70, 0xfa, 0x9e, 0x14, 0xd5, 0x92, 0xbd, 0xe2, 0x90, 0xfd, 0xdc, 0x0d, 0xd8, 0x09,
+    0xd0, 0x83, 0x84, 0x9a, 0x25, 0x4d, 0x28, 0x8a, 0x21, 0x02, 0x00, 0x7f, 0x28, 0x40, 0x28, 0x52,
+    0x19, 0x80, 0xeb, 0xc8, 0x00, 0x3f, 0x6e, 0x60, 0x00, 0x7a, 0x83, 0x02, 0x2c, 0x96, 0xa1, 0x1a,
+    0xe0, 0x72, 0x26, 0xa3, 0x1b, 0x9a, 0x35, 0x29, 0x8c, 0x01, 0x91, 0xda, 0x40, 0x17, 0x22, 0xf3,
+    0xd5, 0x9e, 0xcf, 0xab, 0x5b, 0xd3, 0xd6, 0xd1, 0xa8, 0xfe, 0x06, 0x5a, 0x54, 0x81, 0x31, 0xad,
+    0xd7, 0xdb, 0x4d, 0xe5, 0xa3, 0x66, 0x80, 0x17, 0x2e, 0x1a, 0x02, 0x00, 0xdd, 0xa1, 0x00, 0xd8,
+    0x10, 0x4d, 0x00, 0xb2, 0xa0, 0x02, 0x88, 0xb8, 0x58, 0x01, 0xf8, 0x03, 0x0a, 0x10, 0x60, 0x9b,
+    0x01, 0xc0, 0xbb, 0x29, 0x40, 0xd7, 0x20, 0xfb, 0xb5, 0x11, 0xd6, 0x82, 0x59, 0x23, 0x99, 0x25,
+    0xd1, 0x15, 0x28, 0x16, 0x14, 0x75, 0xce, 0x69, 0x41, 0xed, 0x48, 0x9d, 0x29, 0x30, 0x44, 0x96,
+    0x80, 0x62, 0x7b, 0xc9, 0x0b, 0x80, 0x9b, 0xa2, 0x00, 0xfa, 0x18, 0x17, 0x00, 0xf8, 0x84, 0x02,
+    0x2c, 0xc4, 0xf1, 0x00, 0xd8, 0x7c, 0x02, 0x40, 0xd6, 0xd9, 0xe2, 0x05, 0x8c, 0x35, 0x4c, 0xc6,
+    0x10, 0x69, 0xa6, 0x32, 0x06, 0x96, 0xca, 0x9b, 0xd1, 0x25, 0xd4, 0x93, 0x71, 0xa2, 0x31, 0xb3,
+    0x1b, 0x78, 0x33, 0xc6, 0xf7, 0xa5, 0x78, 0x7a, 0x87, 0x76, 0x80, 0x9b, 0x40, 0x88, 0x05, 0x80,
+    0xc9, 0xa9, 0x00, 0xd3, 0xfd, 0x17, 0x00, 0xf2, 0x88, 0x02, 0x88, 0x57, 0x9a, 0x00, 0xc0, 0x8c,
+    0x0c, 0xc0, 0x90, 0xf9, 0x00, 0xc0, 0x17, 0x28, 0xc0, 0x31, 0xf8, 0x4a, 0x87, 0x0e, 0xd7, 0x38,
+    0xdd, 0xed, 0x65, 0x17, 0xc4, 0x15, 0x50, 0xc5, 0x68, 0x62, 0x6f, 0x39, 0x5f, 0xc0, 0x59, 0x42,
+    0x69, 0x02, 0x89, 0x0d, 0x35, 0xab, 0xed, 0x28, 0x51, 0xce, 0xb8, 0x02, 0x78, 0x48, 0x3a, 0x47,
+    0xb9, 0xec, 0x4b, 0x2b, 0xf9, 0x77, 0x11, 0x01, 0xd8, 0x15, 0x0a, 0xd0, 0xe1, 0xeb, 0x05, 0x40,
+    0x03, 0x2a, 0xc0, 0x2e, 0x38, 0x14, 0x80, 0x4f, 0xa6, 0x00, 0xd8, 0xec, 0x66, 0x59, 0x48, 0x1b,
+    0x40, 0x62, 0x48, 0x0b, 0xd5, 0x49, 0x53, 0xed, 0x38, 0x30, 0xfd, 0xed, 0xcf, 0xe5, 0x80, 0x1f,
+    0xf2, 0x98, 0x1a, 0xa7, 0x79, 0xd2, 0x88, 0xa8, 0x58, 0x6c, 0x00, 0x70, 0x88, 0x02, 0xf0, 0x18,
+    0xdd, 0x00, 0xe8, 0x0f, 0x0a, 0xf0, 0x5b, 0xf7, 0x06, 0x81, 0xd3, 0xb5, 0xcb, 0x52, 0xae, 0xed,
+    0xa4, 0x50, 0x06, 0x32, 0x9a, 0x33, 0xb4, 0x8d, 0x4c, 0x58, 0x73, 0xfa, 0xcd, 0xf0, 0x5a, 0x5b,
+    0x49, 0x20, 0xda, 0x1e, 0xe9, 0x7d, 0x05, 0xce, 0xb4, 0x5e, 0x58, 0x0d, 0xcd, 0x8e, 0xba, 0x01,
+    0x6a, 0xaf, 0x48, 0x4d, 0x00, 0xf4, 0x87, 0x02, 0x38, 0x83, 0x9c, 0x00, 0xc8, 0x84, 0x0a, 0xb0,
+    0xe2, 0x07, 0x03, 0xe0, 0x17, 0x28, 0x00, 0x83, 0x69, 0x18, 0x00, 0x0f, 0xa7, 0x00, 0x2e, 0xf3,
+    0xc8, 0xd8, 0xc6, 0x58, 0xe3, 0x71, 0x6d, 0x90, 0xaf, 0x44, 0x59, 0x80, 0x78, 0xce, 0xc2, 0x6e,
+    0xa7, 0x0d, 0x35, 0x26, 0x72, 0x54, 0x33, 0x10, 0x79, 0x02, 0x8c, 0xf5, 0x15, 0x0b, 0x00, 0xee,
+    0x8a, 0x02, 0xc8, 0xa3, 0x73, 0x01, 0xe0, 0x15, 0x0a, 0x60, 0x90, 0x87, 0x01, 0x60, 0xfb, 0x29,
+    0xc0, 0x5f, 0x25, 0x02, 0x14, 0x50, 0xd6, 0x22, 0x29, 0x4b, 0x01, 0x8a, 0x4a, 0x19, 0x40, 0xee,
+    0xae, 0xb7, 0x52, 0x50, 0x51, 0x66, 0x19, 0x48, 0x74, 0x74, 0xe1, 0xd5, 0x18, 0x60, 0x96, 0xa4,
+    0x41, 0x21, 0xfa, 0x01, 0x76, 0x06, 0xf1, 0x5a, 0x00, 0xa6, 0x27, 0x03, 0x4c, 0x77, 0x79, 0x01,
+    0xc8, 0x25, 0x0a, 0xe0, 0x90, 0xdc, 0x05, 0xc0, 0x1f, 0x28, 0x40, 0x3b, 0xb8, 0xc0, 0x86, 0x2e,
+    0xd7, 0x36, 0xe5, 0x15, 0x49, 0x14, 0x44, 0x16, 0x20, 0x2d, 0xa9, 0xc6, 0x86, 0x39, 0x61, 0xa0,
+    0xa9, 0xc3, 0x4c, 0x18, 0x89, 0x15, 0xb5, 0xec, 0xef, 0x9e, 0x47, 0xcd, 0xd8, 0x02, 0x7a, 0x82,
+    0xc2, 0x23, 0xc1, 0x6c, 0x4c, 0x5b, 0xd1, 0xb7, 0x6e, 0x00, 0xd8, 0x17, 0x0a, 0x30, 0x61, 0x8a,
+    0x03, 0x40, 0x0b, 0x2a, 0x40, 0x31, 0x9a, 0x09, 0x80, 0x6f, 0xa6, 0x00, 0x1a, 0x3d, 0xc6, 0x58,
+    0xc8, 0x1b, 0x20, 0xae, 0x87, 0x6e, 0xc0, 0x49, 0x55, 0xcd, 0x78, 0x34, 0xf1, 0xc3, 0xcf, 0xed,
+    0x80, 0xe1, 0xe5, 0xb6, 0x70, 0xa5, 0x99, 0xd2, 0x8c, 0xb0, 0xf0, 0x46, 0x00, 0xf0, 0x88, 0x02,
+    0xd4, 0x98, 0x36, 0x00, 0xe8, 0x11, 0x0a, 0xd0, 0xdf, 0x55, 0x7c, 0x81, 0xdb, 0xb5, 0x09, 0x34,
+    0xd0, 0x23, 0xa4, 0x70, 0x06, 0x1a, 0xcf, 0xcb, 0x0b, 0x93, 0xcc, 0x58, 0x6b, 0xb6, 0xec, 0x70,
+    0x60, 0x5b, 0x4b, 0x80, 0x09, 0x22, 0x63, 0xb3, 0x05, 0xd6, 0x34, 0xdf, 0x41, 0xc1, 0x24, 0x8e,
+    0xda, 0x01, 0x74, 0xa7, 0xd0, 0x21, 0x00, 0x74, 0x88, 0x02, 0x14, 0x83, 0x04, 0x00, 0xc8, 0x86,
+    0x0a, 0x40, 0x63, 0xa6, 0x00, 0xe0, 0x1f, 0x28, 0xc0, 0x85, 0x29, 0x0e, 0x00, 0x2f, 0xa7, 0x00,
+    0xf4, 0x4a, 0xa5, 0xd4, 0x46, 0x59, 0xbb, 0x99, 0xad, 0xf8, 0xac, 0x44, 0x5b, 0x80, 0xf8, 0xcb,
+    0xa8, 0x7c, 0xa7, 0x15, 0x35, 0x28, 0x71, 0xc8, 0x49, 0x0f, 0x99, 0x02, 0x8c, 0x5c, 0xae, 0xdb,
+    0x2d, 0x6e, 0x0b, 0x50, 0xa4, 0xa3, 0xc6, 0x00, 0xe0, 0x17, 0x0f, 0x10, 0x10, 0x59, 0x06, 0x60,
+    0x03, 0x2a, 0xc0, 0x6e, 0x3d, 0x75, 0x0f, 0x70, 0x16, 0x0d, 0x31, 0x5b, 0x4f, 0x7b, 0xca, 0x19,
+    0x28, 0xae, 0x6e, 0x26, 0x0a, 0x50, 0x53, 0x26, 0x69, 0xc9, 0x26, 0x72, 0xe2, 0xdd, 0x98, 0x61,
+    0x93, 0x6e, 0xf5, 0x24, 0x1a, 0x02, 0x7e, 0xd4, 0xcd, 0x34, 0x00, 0xf2, 0x89, 0x02, 0x38, 0x84,
+    0xeb, 0x00, 0xf0, 0x09, 0x0a, 0xd0, 0x90, 0xad, 0x9c, 0xa1, 0xd3, 0xb5, 0x8c, 0x79, 0x0b, 0xcb,
+    0x04, 0xb1, 0x05, 0x38, 0x69, 0xf2, 0x0a, 0x66, 0xce, 0x18, 0x68, 0x1a, 0x31, 0x4d, 0x45, 0x62,
+    0x47, 0xb0, 0xea, 0x3c, 0x90, 0xce, 0x32, 0xbe, 0x80, 0x5e, 0xab, 0x1c, 0xe0, 0x30, 0x3b, 0xd3,
+    0x62, 0xeb, 0x6d, 0x63, 0x00, 0x76, 0x86, 0x02, 0x20, 0x58, 0x4d, 0x00, 0xd0, 0x84, 0x0a, 0x00,
+    0x0d, 0xc0, 0x06, 0xe0, 0xa3, 0x29, 0x80, 0x56, 0xad, 0x09, 0x16, 0x12, 0x07, 0x80, 0xc9, 0xb1,
+    0xe4, 0x6b, 0xd2, 0x55, 0x2b, 0x26, 0x4e, 0x7c, 0xd4, 0x73, 0x3d, 0x00, 0xd9, 0x36, 0xae, 0xd9,
+    0x68, 0xae, 0xb4, 0x63, 0x2e, 0x86, 0x08, 0x00, 0x5c, 0xa2, 0x00, 0x2e, 0x46, 0x54, 0x00, 0xfa,
+    0x84, 0x02, 0xec, 0x38, 0x61, 0x72, 0xe0, 0x78, 0xad, 0xd1, 0x89, 0xff, 0x04, 0x20, 0xa4, 0x29,
+    0x00, 0x02, 0x17, 0x35, 0x26, 0x53, 0xd6, 0x96, 0xdc, 0x12, 0xec, 0xd7, 0x56, 0x13, 0x40, 0x5e,
+    0x89, 0x38, 0x7e, 0x81, 0x37, 0xed, 0x27, 0x4b, 0x1a, 0x6e, 0xa3, 0x7e, 0x80, 0x9f, 0x28, 0xd0,
+    0x19, 0x00, 0x3d, 0xa2, 0x00, 0xbb, 0x40, 0x4b, 0x00, 0x32, 0xa2, 0x02, 0xe8, 0x58, 0x50, 0x01,
+    0xf8, 0x09, 0x0a, 0x20, 0xe2, 0xf7, 0x00, 0xc0, 0xd3, 0x29, 0x00, 0xac, 0x62, 0x80, 0xb2, 0x71,
+    0xd6, 0x64, 0x76, 0xeb, 0x17, 0x24, 0x51, 0x17, 0x18, 0x32, 0xd2, 0xa3, 0xd8, 0x69, 0x47, 0x90,
+    0xaa, 0x1c, 0x0a, 0x78, 0x43, 0xae, 0x80, 0x23, 0xb4, 0x31, 0x15, 0x8c, 0xfb, 0x02, 0x32, 0x90,
+    0x38, 0x08, 0x1c, 0x78, 0x46, 0x43, 0xe4, 0xe3, 0x0a, 0x01, 0xd8, 0x82, 0x0a, 0x10, 0x5e, 0xe7,
+    0x02, 0x00, 0xa4, 0x29, 0xc0, 0xcb, 0x5c, 0x0b, 0x9b, 0x92, 0x06, 0x84, 0x9e, 0x33, 0x55, 0x12,
+    0x54, 0x15, 0x30, 0x9e, 0x72, 0xbb, 0xdd, 0x78, 0x39, 0xcd, 0xd8, 0xa3, 0x3c, 0x3b, 0x8a, 0x8e,
+    0x00, 0xe1, 0x75, 0xed, 0x02, 0x80, 0x9c, 0xa2, 0x00, 0x0d, 0x59, 0x17, 0x00, 0xfc, 0x82, 0x02,
+    0x94, 0xe4, 0x8a, 0x5e, 0xe8, 0x76, 0xcd, 0x62, 0x5e, 0xfd, 0x40, 0x41, 0x74, 0x81, 0xc8, 0xa2,
+    0x3a, 0x75, 0x9a, 0x53, 0x06, 0x98, 0x4a, 0x1c, 0xb1, 0x8f, 0x58, 0x52, 0x8b, 0x8a, 0xef, 0x0c,
+    0x85, 0x8c, 0x31, 0xc0, 0xb7, 0x2c, 0xda, 0x1c, 0xcc, 0xd6, 0x34, 0xdb, 0x78, 0xbb, 0x0e, 0x80,
+    0xbd, 0xa1, 0x00, 0xff, 0xe5, 0x5e, 0x00, 0xb4, 0xa1, 0x02, 0x68, 0x63, 0x03, 0x01, 0xf8, 0x6a,
+    0x0a, 0x40, 0x59, 0x83, 0x88, 0x85, 0xcc, 0x01, 0x5d, 0x6c, 0x4a, 0x0f, 0x9a, 0x94, 0xd5, 0x88,
+    0xc7, 0x4b, 0xf0, 0xea, 0xdc, 0x0f, 0x60, 0x3a, 0x4d, 0x8c, 0x15, 0x9a, 0x2d, 0x0d, 0xd9, 0x92,
+    0xd2, 0x36, 0x08, 0x9f, 0x80, 0x05, 0x89, 0x7d, 0x0a, 0x80, 0x5e, 0xa1, 0x00, 0x3b, 0xce, 0x51,
+    0x00, 0xb8, 0x9e, 0x02, 0x80, 0xe2, 0xa8, 0x00, 0x08, 0x6b, 0x0a, 0x60, 0x44, 0xd0, 0xd2, 0xc9,
+    0x9c, 0x35, 0x65, 0xa3, 0xb2, 0x72, 0xb5, 0xf5, 0x04, 0x88, 0x91, 0xf2, 0x56, 0x65, 0x60, 0x4e,
+    0x0b, 0x82, 0xf1, 0xfc, 0xd4, 0xa8, 0x21, 0x60, 0xf8, 0x89, 0xc8, 0x03, 0x40, 0x97, 0x28, 0xc0,
+    0x2c, 0x24, 0x09, 0x80, 0xac, 0xa8, 0x00, 0x3f, 0xae, 0x2c, 0x00, 0xfe, 0x82, 0x02, 0xb0, 0xf8,
+    0x5a, 0x01, 0xf0, 0x76, 0x0a, 0x30, 0x26, 0xdf, 0xac, 0x6b, 0xa4, 0x35, 0x16, 0xe3, 0x80, 0xf8,
+    0x45, 0xf4, 0x05, 0x86, 0x51, 0x3c, 0x07, 0x72, 0x5a, 0x52, 0xcb, 0x66, 0x07, 0x29, 0xc5, 0x90,
+    0x2d, 0xe0, 0x48, 0x68, 0xb5, 0x54, 0xe3, 0xc6, 0x00, 0x51, 0x19, 0xde, 0xf2, 0x07, 0xbe, 0xd1,
+    0x16, 0xf1, 0x58, 0x20, 0x00, 0x36, 0xa1, 0x02, 0xa4, 0xd7, 0x10, 0x00, 0x00, 0x6b, 0x0a, 0x10,
+    0x32, 0xbe, 0xc8, 0xa5, 0xac, 0x01, 0x9f, 0xe4, 0xf0, 0x8b, 0x09, 0x75, 0x05, 0x88, 0xb0, 0x64,
+    0xcb, 0x47, 0xde, 0x4e, 0x4b, 0xaa, 0x88, 0x45, 0xd2, 0xa2, 0x25, 0xa0, 0x48, 0x5e, 0x4b, 0x55,
+    0x24, 0xaf, 0x44, 0x81, 0x42, 0xe6, 0x18, 0x00, 0xdf, 0xa0, 0x00, 0x32, 0x29, 0xec, 0x15, 0x3a,
+    0x5e, 0x9b, 0x54, 0x77, 0x9d, 0x01, 0x10, 0x5f, 0x0a, 0xc0, 0xaa, 0xee, 0xca, 0xe6, 0x9c, 0x81,
+    0xa5, 0x11, 0x97, 0x83, 0x23, 0xb6, 0xd4, 0x9a, 0xfa, 0xe3, 0x1d, 0x14, 0xe3, 0x0c, 0xf8, 0x75,
+    0x4b, 0xa9, 0xf2, 0xb2, 0x37, 0x6d, 0xc7, 0xdd, 0x28, 0x01, 0x60, 0x77, 0x28, 0x40, 0x7d, 0x9f,
+    0x0e, 0x00, 0x8d, 0xa8, 0x00, 0xe5, 0x70, 0x15, 0x00, 0x3e, 0x9b, 0x02, 0x1c, 0x57, 0x6e, 0x67,
+    0x21, 0x75, 0xa0, 0x86, 0x1a, 0x56, 0x59, 0x26, 0x6d, 0x35, 0xe2, 0xff, 0x64, 0x54, 0x37, 0x17,
+    0x04, 0xa2, 0x38, 0x7b, 0x3a, 0x7c, 0xe6, 0x4b, 0x4b, 0x12, 0x27, 0x2a, 0xf7, 0xc1, 0x29, 0x20,
+    0xa3, 0x61, 0xff, 0x06, 0xa0, 0x5f, 0x28, 0x40, 0x8d, 0x25, 0x0a, 0x00, 0xce, 0xa7, 0x00, 0xa5,
+    0x08, 0x04, 0x00, 0x42, 0x9b, 0x02, 0x14, 0xf2, 0x18, 0x80, 0x32, 0x69, 0xed, 0x28, 0x24, 0x8e,
+    0x2a, 0x6d, 0x45, 0x81, 0x60, 0xb3, 0xf8, 0xab, 0x1a, 0xb8, 0xd3, 0x86, 0x14, 0x0c, 0x9c, 0x33,
+    0xea, 0x08, 0x38, 0x7e, 0x02, 0x4a, 0x00, 0xd0, 0x27, 0x0a, 0xc0, 0x0a, 0xdf, 0x06, 0x20, 0x33,
+    0x32, 0x80, 0x90, 0x29, 0x01, 0x80, 0xdf, 0xa0, 0x00, 0x35, 0x96, 0x2d, 0x00, 0x3c, 0x9e, 0x02,
+    0x30, 0xa8, 0xa5, 0x9a, 0x1a, 0x6b, 0xad, 0xb4, 0x3a, 0xba, 0x5b, 0x10, 0x85, 0x81, 0xa1, 0x03,
+    0x77, 0x75, 0x9a, 0xb6, 0xd4, 0xae, 0xf1, 0x19, 0xa3, 0x28, 0xe4, 0x0b, 0x40, 0x9a, 0x38, 0xb8,
+    0xf2, 0xb8, 0x33, 0x20, 0x85, 0x04, 0xac, 0x29, 0x82, 0x77, 0xb4, 0x06, 0x3a, 0xb4, 0x1b, 0x80,
+    0x6d, 0xa8, 0x00, 0xf1, 0xdd, 0x49, 0x00, 0x40, 0x9b, 0x02, 0x18, 0x0c, 0x6d, 0x37, 0x29, 0x6d,
+    0x20, 0xa7, 0xb8, 0x9b, 0xb0, 0x43, 0x65, 0x81, 0x21, 0x2c, 0x23, 0x2a, 0x96, 0xd7, 0xd3, 0x98,
+    0x17, 0xf2, 0x5e, 0xc6, 0xe8, 0x09, 0x38, 0x76, 0xb8, 0xe3, 0x64, 0xc9, 0x2d, 0x4d, 0x62, 0x10,
+    0xe9, 0x03, 0xc0, 0x3f, 0x28, 0x00, 0x4b, 0x9e, 0x91, 0x84, 0xae, 0xd7, 0x18, 0xd3, 0x45, 0x42,
+    0x00, 0x44, 0x98, 0x02, 0x30, 0x6b, 0x25, 0xbc, 0x39, 0x69, 0x40, 0xe9, 0x43, 0xba, 0xc5, 0x88,
+    0x35, 0xb5, 0xe4, 0x04, 0x69, 0xda, 0xc1, 0x58, 0x03, 0x80, 0xe5, 0xba, 0x86, 0xb5, 0x6c, 0x4e,
+    0x03, 0x5e, 0x57, 0x6c, 0x01, 0xd8, 0x1f, 0x0a, 0xd0, 0xde, 0x63, 0x01, 0x40, 0x2b, 0x2a, 0x80,
+    0x3b, 0xa6, 0x16, 0x80, 0xef, 0xa6, 0x00, 0xf0, 0xbd, 0x3f, 0x5c, 0xc8, 0x1d, 0x70, 0xad, 0x86,
+    0x77, 0x93, 0x49, 0x5d, 0x6d, 0x18, 0xc3, 0x38, 0xeb, 0xcc, 0x0d, 0x01, 0x6b, 0xcb, 0x64, 0xe4,
+    0x9c, 0x19, 0xd3, 0x92, 0x2a, 0x8a, 0x29, 0x72, 0xf0, 0x0a, 0x10, 0x3d, 0xd8, 0x14, 0x01, 0xe8,
+    0x19, 0x0a, 0xd0, 0xe2, 0x02, 0x00, 0x80, 0xfb, 0x29, 0x00, 0x2b, 0x72, 0x13, 0x80, 0xf0, 0xa6,
+    0x00, 0xc6, 0xac, 0x50, 0xa2, 0xcc, 0x5a, 0x2b, 0xea, 0xe7, 0x19, 0x3c, 0x5b, 0x53, 0xc0, 0xa7,
+    0xb0, 0x95, 0x08, 0x07, 0xf6, 0xb4, 0x22, 0xf3, 0x32, 0xda, 0x8c, 0x5a, 0x02, 0x94, 0xa1, 0xc0,
+    0x59, 0x00, 0x74, 0x8a, 0x02, 0xa0, 0x78, 0x12, 0xcf, 0xf8, 0x0f, 0x2d, 0xc1, 0xe3, 0x47, 0x00,
+    0xc0, 0xeb, 0x29, 0x00, 0x6b, 0x06, 0xc1, 0xa3, 0xd1, 0xd6, 0x3c, 0xd0, 0x4b, 0x95, 0xf0, 0xd0,
+    0x18, 0x10, 0x1e, 0xcf, 0xce, 0x78, 0x69, 0x4d, 0x6d, 0x2a, 0x21, 0xc3, 0xee, 0x41, 0xc6, 0x00,
+    0xa4, 0x72, 0xbf, 0xc3, 0x91, 0x5b, 0x03, 0x60, 0x40, 0x50, 0x57, 0x27, 0xf8, 0x47, 0x73, 0x7c,
+    0xe3, 0x33, 0x01, 0xd8, 0x88, 0x0a, 0xb0, 0x5f, 0xe9, 0x01, 0x00, 0xbc, 0x29, 0xc0, 0xb7, 0x8c,
+    0xae, 0x8f, 0xf2, 0x06, 0x68, 0x85, 0xbb, 0x53, 0x50, 0xd4, 0x16, 0x08, 0x9a, 0x52, 0x18, 0xa6,
+    0x79, 0x3f, 0x0d, 0x6a, 0xa0, 0xba, 0x83, 0x8d, 0xa6, 0x00, 0x64, 0x8d, 0x77, 0xa6, 0x99, 0xfc,
+    0xd2, 0x36, 0x00, 0xc1, 0x18, 0x00, 0x7c, 0x84, 0x00, 0x30, 0x04, 0x95, 0x00, 0xe8, 0x7c, 0x0a,
+    0x40, 0xdd, 0xc5, 0x01, 0x40, 0x8c, 0x29, 0xc0, 0xb9, 0x42, 0x75, 0x9c, 0xb3, 0x06, 0x90, 0x32,
+    0xbc, 0x37, 0x8a, 0xd8, 0x53, 0x33, 0xb6, 0x50, 0x16, 0xeb, 0x8b, 0x37, 0x40, 0x38, 0xae, 0x35,
+    0xd5, 0xca, 0xee, 0x34, 0x22, 0x75, 0xdd, 0x0c, 0x80, 0x1d, 0xa2, 0x00, 0xe6, 0xdd, 0x62, 0x00,
+    0x34, 0x23, 0x03, 0xdc, 0x83, 0xbc, 0x00, 0xf8, 0x70, 0x0a, 0xc0, 0xe0, 0x56, 0xfa, 0x85, 0xe4,
+    0x81, 0x93, 0x6e, 0x66, 0x4d, 0x99, 0xf4, 0xd5, 0x86, 0x5a, 0xcc, 0x95, 0xc0, 0x5c, 0xd1, 0xc8,
+    0xb2, 0xec, 0x63, 0xab, 0x99, 0x33, 0x4d, 0xa9, 0x27, 0x91, 0x30, 0x06, 0xb7, 0x00, 0x55, 0x81,
+    0x99, 0x06, 0x80, 0xbe, 0xa1, 0x00, 0x23, 0xd6, 0x48, 0x00, 0x38, 0xa0, 0x02, 0xd0, 0xc2, 0x9a,
+    0x00, 0x08, 0x71, 0x0a, 0x80, 0xd0, 0xb6, 0x1a, 0xca, 0xb4, 0xb5, 0x20, 0x6e, 0x04, 0xb5, 0xb2,
+    0x55, 0x05, 0x76, 0x48, 0x13, 0x54, 0x75, 0xe0, 0x4f, 0x43, 0x2e, 0xae, 0x11, 0xc9, 0xa8, 0x27,
+    0xa0, 0x59, 0x0a, 0x15, 0x03, 0x40, 0xaf, 0x28, 0x80, 0x6f, 0xc1, 0x65, 0x90, 0x1f, 0xd1, 0x28,
+    0x41, 0x56, 0x4c, 0x00, 0x3c, 0x9f, 0x02, 0xfc, 0x04, 0x37, 0xd5, 0x19, 0x6f, 0xad, 0xc2, 0x3f,
+    0xfb, 0x95, 0x0d, 0x95, 0x81, 0x20, 0xdf, 0x50, 0xa4, 0x93, 0xf6, 0xd4, 0x9c, 0x3b, 0xc2, 0xc4,
+    0x12, 0xe4, 0x0c, 0x48, 0xc2, 0x15, 0x7f, 0x55, 0xb9, 0x37, 0xc0, 0x16, 0x85, 0x40, 0xc2, 0x82,
+    0x87, 0x34, 0x48, 0x35, 0xd6, 0x0a, 0x80, 0xad, 0xc8, 0x00, 0x05, 0x56, 0x63, 0x00, 0x40, 0x9c,
+    0x02, 0xa8, 0x0a, 0x65, 0xc2, 0x28, 0x71, 0xe0, 0x65, 0x38, 0xcc, 0x42, 0x46, 0x75, 0x01, 0x20,
+    0x24, 0x1d, 0xb5, 0x9e, 0x17, 0xd4, 0xa8, 0xfa, 0xe1, 0x17, 0xea, 0xe8, 0x0a, 0x50, 0xfa, 0xd8,
+    0xaf, 0xcb, 0xc9, 0x31, 0x2d, 0xb4, 0x0a, 0xb4, 0x76, 0xca, 0x4f, 0x94, 0x06, 0x42, 0x66, 0x1b,
+    0x80, 0xee, 0xa7, 0x00, 0xd6, 0x5d, 0x66, 0x00, 0x44, 0x99, 0x02, 0xf0, 0xab, 0xc3, 0xd2, 0x39,
+    0x6d, 0xa0, 0x58, 0xc2, 0x33, 0x81, 0x88, 0x45, 0x35, 0xa1, 0x11, 0x93, 0xe8, 0xbb, 0x98, 0x03,
+    0x88, 0xda, 0x0a, 0xaf, 0xa4, 0x6c, 0x4f, 0x3b, 0x4a, 0xd7, 0x31, 0x00, 0xd8, 0x23, 0x0a, 0xe0,
+    0x0f, 0x3e, 0x00, 0xe0, 0xcb, 0x29, 0x40, 0x86, 0x1f, 0x23, 0x19, 0xb2, 0x07, 0x3c, 0xd2, 0x11,
+    0x8d, 0x66, 0x52, 0x58, 0x1b, 0xea, 0xb1, 0xa3, 0xd3, 0x72, 0x47, 0x80, 0x4a, 0xb3, 0xfc, 0x3a,
+    0x66, 0xd6, 0x34, 0xa5, 0xae, 0x64, 0xb6, 0x14, 0xfc, 0x02, 0x62, 0xfa, 0xf5, 0x5f, 0x00, 0x7a,
+    0x47, 0x00, 0x68, 0x98, 0x86, 0x00, 0xe0, 0x82, 0x0a, 0xe0, 0x0b, 0xfb, 0x06, 0x20, 0xcc, 0x29,
+    0x80, 0x52, 0xbd, 0xa1, 0x27, 0xf3, 0xd6, 0x7c, 0x7d, 0xd9, 0x30, 0xc6, 0xd6, 0x15, 0xc8, 0x15,
+    0x2e, 0xbc, 0xe2, 0x81, 0x41, 0x6d, 0x09, 0xb5, 0xf6, 0x19, 0xa3, 0xa6, 0x80, 0x27, 0x2b, 0x74,
+    0x02, 0x00, 0xdd, 0xa2, 0x00, 0x69, 0x9d, 0x5e, 0x4a, 0xfe, 0x44, 0xd3, 0x0c, 0x59, 0x90, 0x00,
+    0xf0, 0x7e, 0x0a, 0x30, 0x0b, 0xf8, 0x49, 0x65, 0xc4, 0xc9, 0x82, 0x0b, 0x77, 0x4e, 0x30, 0x74,
+    0x06, 0x80, 0x2f, 0x0b, 0x5f, 0x3d, 0x5a, 0x54, 0x53, 0xaa, 0xe9, 0x74, 0x14, 0x90, 0x35, 0x20,
+    0x89, 0x51, 0xfa, 0x53, 0xe6, 0xe6, 0x80, 0x9d, 0x1c, 0xfc, 0xd8, 0x0c, 0x3e, 0xd2, 0x24, 0x10,
+    0x46, 0x37, 0x00, 0xc0, 0x9c, 0x02, 0x9c, 0x49, 0xa2, 0x91, 0x28, 0x73, 0x00, 0xc5, 0xb8, 0x59,
+    0x68, 0x47, 0x7d, 0x01, 0xe0, 0x1b, 0x97, 0xcc, 0xa2, 0x37, 0xd4, 0xb0, 0xf4, 0x51, 0x64, 0xfb,
+    0x68, 0x0b, 0x58, 0xca, 0x98, 0x38, 0xfb, 0xc9, 0x33, 0x0d, 0xa5, 0x87, 0x8e, 0xb4, 0xca, 0x57,
+    0x00, 0x09, 0x41, 0x94, 0x11, 0x80, 0x0e, 0xa8, 0x00, 0xd9, 0x05, 0x3f, 0x00, 0xc4, 0x99, 0x02,
+    0x1c, 0xac, 0x36, 0xe2, 0x39, 0x6f, 0x60, 0x78, 0xc1, 0xe6, 0x6d, 0x88, 0x4d, 0xb5, 0x1f, 0x17,
+    0x13, 0x7c, 0xb9, 0xb8, 0x03, 0x8c, 0xcc, 0x6a, 0x0a, 0x9c, 0xec, 0x4f, 0x53, 0x4a, 0x77, 0x59,
+    0x01, 0xd8, 0x25, 0x0a, 0x40, 0x90, 0x94, 0x04, 0xe0, 0xd3, 0x29, 0x00, 0x85, 0x87, 0x79, 0x1a,
+    0xd2, 0x07, 0x26, 0xf2, 0xd1, 0xd4, 0x69, 0xd2, 0x58, 0x13, 0x46, 0x32, 0x2e, 0xaf, 0x72, 0x49,
+    0xe0, 0x49, 0xb4, 0x69, 0xc8, 0x65, 0xde, 0x34, 0x25, 0xbb, 0x68, 0xae, 0x10, 0x1c, 0x03, 0x6e,
+    0xf1, 0x1d, 0x35, 0x00, 0xfa, 0x47, 0x00, 0x40, 0xd8, 0xad, 0x01, 0xe0, 0x84, 0x0a, 0x90, 0x8c,
+    0x7e, 0x04, 0x20, 0xd4, 0x29, 0x40, 0x62, 0xfd, 0x94, 0x26, 0x13, 0xd7, 0x74, 0x4b, 0x89, 0x8d,
+    0xc1, 0x56, 0x16, 0xb8, 0xfd, 0x2e, 0x2b, 0xe6, 0x81, 0x43, 0xcd, 0xe9, 0xb1, 0xa5, 0x0e, 0xa3,
+    0xae, 0x80, 0x68, 0x36, 0x7e, 0x94, 0x13, 0xfd, 0x52, 0x08, 0x24, 0x55, 0xb6, 0x50, 0x7e, 0x45,
+    0xfb, 0x08, 0xf9, 0xb3, 0x01, 0xf0, 0x80, 0x0a, 0xe0, 0x89, 0x2b, 0x06, 0x60, 0xcc, 0x29, 0x80,
+    0x19, 0x21, 0x25, 0x2a, 0x94, 0x06, 0x7c, 0xe2, 0xe2, 0xbb, 0x29, 0xda, 0x94, 0x31, 0x7a, 0x8a,
+    0x99, 0x2d, 0x90, 0x37, 0x46, 0x19, 0xcc, 0xf2, 0x81, 0xe7, 0xee, 0x00, 0xa0, 0x27, 0x82, 0xed,
+    0x0e, 0x5e, 0xd2, 0x28, 0x1b, 0xde, 0x0a, 0x00, 0x40, 0x9d, 0x02, 0x48, 0xe8, 0x1c, 0x6b, 0x28,
+    0x75, 0x20, 0x84, 0x39, 0xea, 0x64, 0x48, 0x85, 0x81, 0xdf, 0x10, 0x0f, 0x84, 0xa6, 0x57, 0xd4,
+    0xb0, 0xf6, 0xf1, 0xbf, 0x0a, 0xe9, 0x0b, 0x60, 0x46, 0x38, 0xbd, 0x2a, 0xca, 0x35, 0xad, 0xb5,
+    0x84, 0x5a, 0xe2, 0xca, 0x5f, 0x80, 0x4a, 0x3f, 0xe0, 0x07, 0x80, 0x2e, 0xa8, 0x00, 0xde, 0x0d,
+    0x17, 0x00, 0x44, 0x9a, 0x02, 0x28, 0x2c, 0x6e, 0xf5, 0x39, 0x71, 0xe0, 0xa7, 0x40, 0x86, 0x53,
+    0x88, 0x55, 0xb5, 0x5e, 0x1b, 0xb3, 0x93, 0xb7, 0xd8, 0x03, 0x92, 0xb9, 0xaa, 0xd5, 0x93, 0x6c,
+    0x50, 0x6b, 0x6e, 0x57, 0xcb, 0x14, 0xda, 0x27, 0x84, 0x80, 0x10, 0xea, 0x01, 0xe0, 0xdb, 0x29,
+    0x40, 0x76, 0x6d, 0x14, 0x00, 0xf2, 0xa7, 0x00, 0x14, 0x22, 0xac, 0x6d, 0x52, 0x59, 0x13, 0x82,
+    0xb2, 0xb8, 0x96, 0x72, 0x4b, 0x40, 0xb9, 0x35, 0xe0, 0x7c, 0x65, 0xe6, 0x34, 0x65, 0xc4, 0x70,
+    0x26, 0x0d, 0x3c, 0x03, 0x78, 0xdd, 0x2d, 0x8b, 0x53, 0x7a, 0x08, 0x11, 0x18, 0xd8, 0x14, 0x01,
+    0xe0, 0x86, 0x0a, 0x40, 0x0d, 0xfc, 0x01, 0x20, 0xdc, 0x29, 0x40, 0x71, 0x69, 0xec, 0x24, 0x33,
+    0xd7, 0x6a, 0x26, 0xb9, 0xda, 0xbd, 0xd6, 0x16, 0xa8, 0xdd, 0x0f, 0x5f, 0xe1, 0x81, 0x45, 0x4d,
+    0x6a, 0xaf, 0x43, 0xec, 0xa2, 0xb6, 0x00, 0xe9, 0x5f, 0xb8, 0xaa, 0x14, 0x1d, 0x03, 0x28, 0xeb,
+    0xec, 0x0d, 0x55, 0xfe, 0x45, 0x13, 0xfd, 0xf8, 0x17, 0x01, 0xf0, 0x82, 0x0a, 0xf0, 0x09, 0x9a,
+    0x03, 0x60, 0xd4, 0x29, 0xc0, 0x28, 0x05, 0x38, 0x24, 0xb4, 0x06, 0x7a, 0x94, 0x72, 0x98, 0x15,
+    0x5a, 0x95, 0x11, 0x5a, 0x2b, 0xfd, 0x6e, 0x90, 0x39, 0x86, 0xd9, 0x46, 0xed, 0xd6, 0xe8, 0xf6,
+    0x00, 0xe2, 0x34, 0x72, 0x82, 0x11, 0x7e, 0xd2, 0x2c, 0x25, 0xfe, 0x4e, 0x00, 0xc0, 0x9d, 0x02,
+    0xa0, 0x26, 0x94, 0x54, 0x28, 0x77, 0x00, 0xb3, 0x3a, 0x72, 0x2a, 0x49, 0x8d, 0x81, 0x9f, 0x03,
+    0x9f, 0x97, 0xa9, 0x77, 0x04, 0xa9, 0x02, 0x4a, 0x1b, 0x17, 0x69, 0x0c, 0x60, 0x7a, 0xd7, 0x3c,
+    0x5a, 0xca, 0x37, 0x6d, 0xd6, 0x01, 0x42, 0x08, 0xcb, 0x67, 0x80, 0x8b, 0x3d, 0x7c, 0x1a, 0x80,
+    0x4e, 0xa8, 0x00, 0xe4, 0xbd, 0x5e, 0x00, 0xc4, 0x9a, 0x02, 0x00, 0xec, 0xe6, 0x0c, 0x3a, 0x73,
+    0x60, 0x07, 0x40, 0x1b, 0x41, 0x88, 0x5d, 0x35, 0x1d, 0x1e, 0x85, 0x2b, 0xb6, 0xf8, 0x03, 0x98,
+    0xa5, 0x02, 0x30, 0x8b, 0xec, 0x50, 0x83, 0xa2, 0xb7, 0x5c, 0xec, 0xd9, 0x29, 0x40, 0xb2, 0x10,
+    0x4c, 0x06, 0xe0, 0xe3, 0x29, 0x40, 0x75, 0xed, 0x0b, 0x00, 0x12, 0xa8, 0x00, 0x39, 0x82, 0x83,
+    0x72, 0xd2, 0x59, 0x0b, 0x9e, 0x72, 0x41, 0x8a, 0x72, 0x4d, 0xa0, 0x78, 0x37, 0x51, 0x3a, 0x65,
+    0xee, 0xb4, 0xe5, 0xca, 0x90, 0x3a, 0x0a, 0x5c, 0x03, 0x84, 0xbf, 0x05, 0xd3, 0x56, 0xfa, 0x08,
+    0x29, 0xf4, 0xd7, 0x7c, 0x00, 0xe0, 0x88, 0x0a, 0xe0, 0x0d, 0x7f, 0x06, 0x20, 0xe4, 0x29, 0x40,
+    0x7e, 0x2b, 0xe4, 0x22, 0x53, 0xd7, 0x60, 0x0f, 0x81, 0xb7, 0xb8, 0x56, 0x17, 0xa0, 0xad, 0xd0,
+    0xd3, 0xcc, 0x81, 0x47, 0xd0, 0x7a, 0xad, 0xdb, 0xb9, 0xa2, 0xbe, 0x80, 0xa9, 0x79, 0xea, 0xe1,
+    0x15, 0x3d, 0x03, 0x3a, 0xbd, 0xbc, 0xd5, 0x58, 0x7e, 0x46, 0x23, 0xe9, 0xf8, 0x7f, 0x00, 0xf0,
+    0x84, 0x0a, 0x20, 0x0a, 0x01, 0x01, 0x60, 0xdc, 0x29, 0x00, 0x39, 0xf3, 0x4e, 0x1e, 0xd4, 0x06,
+    0x74, 0x48, 0x0a, 0x65, 0x02, 0xda, 0x95, 0xf9, 0x45, 0x8c, 0x62, 0xb4, 0x90, 0x3b, 0xa6, 0xd9,
+    0xc1, 0xd8, 0x3c, 0xea, 0xfe, 0x80, 0xa4, 0x43, 0xd6, 0xb3, 0x14, 0x9e, 0xd2, 0x32, 0x2f, 0x66,
+    0x22, 0x00, 0x40, 0x9e, 0x02, 0xe8, 0x63, 0x01, 0x54, 0x28, 0x79, 0xe0, 0x50, 0x3c, 0x01, 0xaf,
+    0x49, 0x95, 0x01, 0x9f, 0xf4, 0xf8, 0xae, 0xab, 0x97, 0xd4, 0x9e, 0x16, 0xda, 0xe6, 0x21, 0xe9,
+    0x0c, 0x68, 0x86, 0x56, 0x79, 0x87, 0xca, 0x39, 0x0d, 0x57, 0x00, 0x67, 0x26, 0xcb, 0x6f, 0x80,
+    0x8c, 0x3b, 0x12, 0x11, 0x80, 0x6e, 0xa8, 0x00, 0xec, 0x45, 0x35, 0x00, 0x44, 0x9b, 0x02, 0xa0,
+    0x4b, 0x62, 0x26, 0x3a, 0x75, 0xe0, 0x86, 0x3f, 0xac, 0x2d, 0x88, 0x65, 0xb5, 0x5c, 0x1e, 0x89,
+    0x43, 0xb5, 0x18, 0x04, 0xa0, 0x91, 0xca, 0x09, 0x83, 0x6c, 0x51, 0x93, 0xca, 0xf7, 0xa4, 0xbd,
+    0xd9, 0x2b, 0x40, 0xc3, 0x90, 0xae, 0x03, 0xe0, 0xeb, 0x29, 0xc0, 0x74, 0x59, 0x03, 0x00, 0x32,
+    0xa8, 0x00, 0x5c, 0xb2, 0x4b, 0x79, 0x52, 0x5a, 0x03, 0xa6, 0x52, 0x8a, 0x8b, 0x72, 0x4f, 0x00,
+    0x58, 0xb9, 0xd1, 0x1e, 0x65, 0xf6, 0x34, 0xa6, 0xce, 0x7c, 0x12, 0x08, 0x7c, 0x03, 0x8c, 0xae,
+    0x8d, 0x2a, 0x58, 0x7a, 0x09, 0x41, 0xd0, 0xd7, 0xa7, 0x01, 0xe0, 0x8a, 0x0c, 0x90, 0x0e, 0xf8,
+    0x03, 0x20, 0xec, 0x29, 0x00, 0x89, 0x85, 0xb8, 0x20, 0x73, 0xd7, 0x54, 0x09, 0x19, 0x94, 0xb4,
+    0xd6, 0x17, 0x98, 0x65, 0xb1, 0x4b, 0xae, 0x81, 0x49, 0x4d, 0x3b, 0x2c, 0x74, 0x76, 0xa2, 0xc6,
+    0x00, 0x2a, 0x8f, 0x8e, 0x35, 0x17, 0x5d, 0x03, 0x48, 0x9b, 0xbc, 0x2c, 0x5b, 0xfe, 0x46, 0x33,
+    0xcd, 0xd8, 0xac, 0x01, 0xf0, 0x86, 0x0a, 0x80, 0x8a, 0x69, 0x05, 0x60, 0xe4, 0x29, 0x40, 0x4a,
+    0x01, 0xc6, 0x18, 0xf4, 0x06, 0x6e, 0xfe, 0xd9, 0xc0, 0x11, 0x5a, 0x16, 0xd8, 0x35, 0xad, 0x8b,
+    0xff, 0x90, 0x3d, 0xed, 0x19, 0x3d, 0xbd, 0xaa, 0xeb, 0x06, 0x01, 0xa6, 0x53, 0x62, 0x49, 0x18,
+    0xbe, 0xd2, 0x38, 0x37, 0x7e, 0x66, 0x00, 0xc0, 0x9e, 0x02, 0xbc, 0x22, 0x27, 0x01, 0x28, 0x7b,
+    0x0a, 0x60, 0x3e, 0x8c, 0xf4, 0x49, 0x9d, 0x01, 0xdf, 0xe3, 0x3e, 0xc6, 0xac, 0xb7, 0xd4, 0x96,
+    0x33, 0xd2, 0xc1, 0x28, 0x69, 0x0d, 0x68, 0x6e, 0x15, 0xf1, 0xb0, 0xca, 0x3b, 0xad, 0xa7, 0x02,
+    0xfd, 0x34, 0xcb, 0x77, 0x00, 0x0d, 0x39, 0xca, 0x07, 0x80, 0x8e, 0xa8, 0x00, 0xf4, 0x15, 0x0b,
+    0x00, 0xc4, 0x9b, 0x02, 0x08, 0xab, 0xa1, 0x43, 0x3a, 0x77, 0x40, 0x36, 0xbf, 0x2a, 0x13, 0x88,
+    0x6d, 0xb5, 0x1b, 0x1c, 0xd9, 0xd7, 0xb4, 0x38, 0x04, 0xa8, 0x7f, 0xa2, 0x53, 0x7b, 0xec, 0x51,
+    0x9b, 0xea, 0xb7, 0x2c, 0x8b, 0xd9, 0x2d, 0x20, 0xc4, 0x90, 0x18, 0x01, 0xe0, 0xf3, 0x29, 0x80,
+    0x74, 0xc7, 0x16, 0x00, 0x52, 0xa8, 0x00, 0x7c, 0xaa, 0x23, 0x80, 0xd2, 0x5a, 0xfb, 0x9d, 0xb2,
+    0x0e, 0x95, 0x72, 0x51, 0x60, 0x67, 0xbb, 0x4f, 0x04, 0x65, 0xfe, 0x34, 0xe6, 0xcf, 0x4c, 0x4a,
+    0x06, 0x9c, 0x03, 0x96, 0xa2, 0xf5, 0x02, 0x58, 0xfa, 0x09, 0x58, 0xc8, 0x63, 0x5c, 0x00, 0x08,
+    0x7d, 0x0a, 0xd0, 0x63, 0x4e, 0x84, 0xc7, 0xe4, 0x35, 0x92, 0x44, 0x36, 0xf8, 0xab, 0x15, 0x06,
+    0x66, 0x7f, 0xe4, 0x61, 0x62, 0xe0, 0x52, 0xb3, 0xea, 0xca, 0xff, 0x86, 0xa8, 0x33, 0xa0, 0x6a,
+    0xa8, 0x54, 0x1b, 0x46, 0xdf, 0x80, 0x95, 0x20, 0xd5, 0x00, 0x97, 0xdf, 0xd1, 0x4e, 0x2a, 0xd6,
+    0x46, 0x00, 0x3c, 0xa2, 0x02, 0xbc, 0xc2, 0xb0, 0x00, 0x18, 0x7b, 0x0a, 0x20, 0xd7, 0x58, 0xf6,
+    0x04, 0xc5, 0x01, 0x5a, 0x6e, 0x12, 0xa7, 0x88, 0xb6, 0x05, 0x70, 0x8b, 0x33, 0x3d, 0x52, 0xe4,
+    0x4f, 0x8b, 0x26, 0xee, 0x26, 0x48, 0xbb, 0x43, 0xe0, 0x19, 0x99, 0xd1, 0x1e, 0x87, 0xb7, 0x34,
+    0x50, 0x8f, 0x8d, 0x0e, 0x00, 0xd0, 0xa7, 0x00, 0xa8, 0x88, 0x24, 0x00, 0x4a, 0x9f, 0x02, 0x38,
+    0x70, 0x86, 0x82, 0x52, 0x69, 0xa0, 0x87, 0x34, 0x62, 0x2e, 0xeb, 0x35, 0xb5, 0x23, 0x96, 0x2c,
+    0x47, 0x4b, 0x7a, 0x03, 0x9c, 0x12, 0x6d, 0x19, 0xb4, 0x72, 0x4f, 0x13, 0x72, 0xe1, 0xae, 0xce,
+    0xf2, 0x1f, 0x80, 0xb3, 0x8d, 0xad, 0x06, 0xa0, 0x2b, 0x2a, 0x80, 0x7f, 0x35, 0x14, 0x00, 0x11,
+    0xa7, 0x00, 0x8c, 0x1a, 0x48, 0x96, 0x4e, 0x1e, 0x60, 0xc9, 0x0f, 0x28, 0x00, 0x62, 0x5d, 0xcd,
+    0xb6, 0xc5, 0x0a, 0x34, 0x2d, 0x16, 0x01, 0xec, 0x9b, 0x1e, 0xcb, 0x1c, 0x9b, 0xd4, 0xa8, 0xfb,
+    0xdd, 0x2d, 0x57, 0xf6, 0x0b, 0x38, 0x25, 0xe4, 0x64, 0x01, 0xf8, 0x7e, 0x0a, 0x30, 0xdd, 0x7c,
+    0x03, 0x80, 0x1c, 0x2a, 0x80, 0xa5, 0x30, 0x1b, 0xa2, 0xd4, 0xd6, 0x7a, 0xa5, 0x04, 0xa4, 0xaa,
+    0xdc, 0x14, 0xb0, 0x59, 0x2f, 0x76, 0x3e, 0x99, 0x41, 0xcd, 0xc9, 0xb3, 0x7e, 0x48, 0x01, 0xef,
+    0x80, 0x27, 0x67, 0x2d, 0xb3, 0x95, 0x9e, 0x02, 0x1e, 0xfa, 0x30, 0x5f, 0x00, 0xc2, 0x9f, 0x02,
+    0x08, 0x99, 0xa6, 0xb0, 0x31, 0x7b, 0x6d, 0x93, 0x12, 0xc5, 0xa3, 0x6a, 0x8d, 0x01, 0x99, 0x27,
+    0x3b, 0xb0, 0x15, 0xd8, 0xd4, 0xa2, 0xbd, 0x4a, 0x98, 0x1a, 0x6a, 0x0d, 0xa8, 0x12, 0x2b, 0x54,
+    0x9a, 0xd1, 0x39, 0x20, 0x46, 0x47, 0xa2, 0xd4, 0xe5, 0x7f, 0x34, 0x14, 0x88, 0xc5, 0x08, 0x00,
+    0xaf, 0xa8, 0x00, 0xb8, 0x90, 0x01, 0x00, 0x46, 0x9f, 0x02, 0xf4, 0xd6, 0x0c, 0xf5, 0x40, 0x73,
+    0x00, 0x86, 0x97, 0x81, 0x26, 0xa3, 0x75, 0x01, 0x5b, 0xf2, 0x08, 0xe6, 0x18, 0x19, 0xd4, 0xa8,
+    0x48, 0x9b, 0xd7, 0xe8, 0x6e, 0x11, 0x90, 0x5a, 0x67, 0x14, 0x0f, 0xe2, 0x2f, 0x8d, 0x14, 0x64,
+    0xe6, 0x00, 0x00, 0xfc, 0x29, 0xc0, 0x28, 0xc2, 0x1b, 0x80, 0xf2, 0xa7, 0x00, 0x3c, 0x64, 0x6b,
+    0x9f, 0xd4, 0x1a, 0xe0, 0xf5, 0x6b, 0x09, 0xb9, 0x7a, 0x4f, 0x4d, 0x48, 0x28, 0x82, 0xee, 0x92,
+    0xe6, 0x80, 0xa7, 0x31, 0xa9, 0x99, 0xae, 0xfc, 0xd3, 0x8c, 0x90, 0x88, 0x85, 0xb3, 0x7c, 0x08,
+    0xe8, 0x44, 0x63, 0x19, 0x01, 0xe8, 0x8c, 0x0c, 0x80, 0x60, 0x57, 0x02, 0x40, 0xcc, 0x29, 0x80,
+    0x90, 0x04, 0x6a, 0xa6, 0xb3, 0x07, 0x48, 0xf5, 0x5b, 0xd1, 0x7e, 0xd8, 0x57, 0xab, 0xe9, 0xf0,
+    0x88, 0x4e, 0x8b, 0x47, 0xe3, 0x5a, 0xa6, 0x4e, 0xb0, 0xc6, 0x2e, 0xb5, 0xaa, 0x7b, 0x43, 0xc4,
+    0x92, 0x1d, 0x03, 0x5a, 0x06, 0xd9, 0x30, 0x00, 0x3e, 0xa0, 0x02, 0x58, 0xb7, 0x4f, 0x00, 0x20,
+    0x89, 0x0a, 0x90, 0xaa, 0x5c, 0x0c, 0x29, 0xbd, 0xb5, 0xdd, 0x28, 0xdf, 0x60, 0x2c, 0x57, 0x05,
+    0x64, 0xf4, 0x33, 0xe7, 0x50, 0xe6, 0x50, 0x7b, 0xce, 0x0c, 0x5a, 0x45, 0xc0, 0x3d, 0x60, 0xca,
+    0x59, 0x6e, 0x4a, 0xa5, 0xaf, 0x80, 0x49, 0x40, 0xc8, 0x0d, 0x80, 0x10, 0xa8, 0x00, 0x28, 0xc6,
+    0x0f, 0x5d, 0x4c, 0x5f, 0x83, 0x20, 0xc5, 0x5c, 0x8e, 0x5a, 0x65, 0x40, 0x46, 0x4b, 0x04, 0xa2,
+    0x04, 0x3e, 0xb5, 0x26, 0xb2, 0x3e, 0x98, 0x84, 0x7a, 0x03, 0xac, 0xf8, 0xda, 0x65, 0x6c, 0xf4,
+    0x0e, 0xb8, 0xb9, 0xd1, 0x80, 0x78, 0xf9, 0x21, 0x2d, 0x65, 0x61, 0x03, 0x00, 0xc0, 0x33, 0x32,
+    0x80, 0x30, 0xc2, 0x11, 0x80, 0xf1, 0xa7, 0x00, 0x0b, 0xde, 0x21, 0x2e, 0x50, 0x1d, 0x58, 0xfd,
+    0xa4, 0x0d, 0x01, 0x69, 0x5f, 0x60, 0x56, 0x40, 0x42, 0x3e, 0x47, 0x0e, 0xb5, 0x6b, 0xc3, 0x22,
+    0x4d, 0xbf, 0x7b, 0x04, 0xaa, 0x1b, 0xea, 0x9d, 0x96, 0x78, 0x4c, 0x43, 0x0d, 0xb9, 0x4d, 0x01,
+    0x00, 0x81, 0x0a, 0x00, 0x8a, 0x86, 0x04, 0xa0, 0x04, 0x2a, 0x40, 0x1c, 0x49, 0xf1, 0x26, 0xd5,
+    0x06, 0x76, 0xb0, 0x0a, 0x1e, 0xa6, 0x5e, 0x54, 0xf3, 0xd9, 0xca, 0x0c, 0xb9, 0xa4, 0x3b, 0x00,
+    0x9a, 0xc7, 0x2e, 0xcc, 0x2b, 0x07, 0x35, 0xe5, 0x31, 0xd6, 0xd3, 0x2c, 0x3f, 0x02, 0x3c, 0x13,
+    0x36, 0x6a, 0x00, 0x44, 0x9d, 0x02, 0x78, 0x27, 0x20, 0x66, 0x3a, 0x7d, 0x60, 0xd3, 0xbf, 0x7d,
+    0xda, 0x87, 0x85, 0xb5, 0x5a, 0x03, 0xfb, 0x20, 0xb5, 0x98, 0x04, 0xa4, 0x62, 0x92, 0xcd, 0x63,
+    0x6c, 0x53, 0xb3, 0x46, 0x17, 0x92, 0x01, 0xd9, 0x33, 0x60, 0x16, 0x90, 0x90, 0x00, 0xe0, 0x0b,
+    0x2a, 0x80, 0x76, 0xf7, 0x17, 0x00, 0xb2, 0xa8, 0x00, 0xb3, 0x82, 0x1f, 0x99, 0x52, 0x5c, 0xc3,
+    0x91, 0xf2, 0x49, 0xe9, 0x72, 0x57, 0xc0, 0xd5, 0x40, 0x13, 0x24, 0x65, 0x16, 0xb5, 0x68, 0xc9,
+    0xf6, 0xcc, 0x03, 0xfc, 0x03, 0xac, 0xa3, 0x05, 0x02, 0x52, 0x7a, 0x0b, 0xb8, 0x1c, 0x04, 0x3d,
+    0x00, 0x08, 0x83, 0x0a, 0xd0, 0x5d, 0x5e, 0x06, 0xc0, 0xfc, 0x29, 0x40, 0x5b, 0x80, 0x38, 0xa7,
+    0x75, 0x06, 0x62, 0xc3, 0x4c, 0xf0, 0x3c, 0x60, 0x54, 0x43, 0x72, 0xcb, 0xe3, 0x20, 0xa8, 0x39,
+    0xc0, 0x0a, 0xb2, 0x67, 0x1c, 0x47, 0xf7, 0x80, 0x1e, 0x1c, 0xaf, 0xd9, 0x97, 0x3f, 0xd2, 0x54,
+    0xcc, 0xc8, 0x1b, 0x00, 0x46, 0xa0, 0x02, 0x6c, 0x59, 0x08, 0x86, 0x40, 0x77, 0xa0, 0xf4, 0x10,
+    0xef, 0xc9, 0xa4, 0x85, 0x01, 0xd9, 0x0f, 0x0f, 0x30, 0x20, 0x59, 0xd4, 0xb2, 0xdc, 0x0a, 0x91,
+    0x0f, 0x6f, 0xd2, 0xb8, 0x82, 0x29, 0xa0, 0xa5, 0xe2, 0x33, 0x8d, 0x15, 0x64, 0x8b, 0x02, 0x00,
+    0x0c, 0x2a, 0xc0, 0x27, 0x46, 0x08, 0x80, 0x32, 0xa8, 0x00, 0xac, 0x7c, 0x9f, 0x96, 0xd4, 0x1b,
+    0xc8, 0x8d, 0xe9, 0xa6, 0x71, 0x7a, 0x53, 0x4d, 0xd7, 0x2e, 0xeb, 0xb1, 0x92, 0xf6, 0x80, 0x28,
+    0x0b, 0xb3, 0xe7, 0xae, 0x3c, 0xd4, 0x9c, 0x01, 0xa9, 0xa8, 0xb1, 0x7c, 0x09, 0x00, 0x79, 0x58,
+    0xf8, 0x00, 0x10, 0x77, 0x0a, 0xf0, 0x93, 0x7c, 0x2d, 0xe9, 0xfc, 0x01, 0xc6, 0x02, 0xa1, 0x1b,
+    0x1f, 0x36, 0xd6, 0x68, 0xd6, 0x2b, 0x56, 0xd4, 0xe2, 0x12, 0x68, 0x9a, 0x69, 0x95, 0x72, 0xb1,
+    0x4f, 0xed, 0x5a, 0x5a, 0x6e, 0x5c, 0x63, 0xd7, 0x80, 0x9c, 0x3e, 0x84, 0x14, 0x80, 0x4f, 0xa8,
+    0x00, 0xdf, 0x9d, 0x3a, 0x00, 0x48, 0xa3, 0x02, 0xc8, 0x6a, 0xa8, 0x85, 0x4a, 0x73, 0xad, 0x86,
+    0xca, 0x01, 0x3b, 0xcc, 0x65, 0x01, 0x55, 0x08, 0xf9, 0xe6, 0x94, 0x79, 0xd4, 0xa6, 0x15, 0x7b,
+    0x10, 0x0e, 0x70, 0x10, 0xc8, 0xb6, 0xf6, 0x3b, 0x41, 0xe9, 0x2f, 0x80, 0xa3, 0x10, 0x86, 0x05,
+    0x20, 0x14, 0x2a, 0x40, 0x76, 0xf9, 0x0f, 0x00, 0x13, 0xa8, 0x00, 0x92, 0x41, 0xbc, 0x94, 0x56,
+    0x1a, 0x80, 0x25, 0x13, 0x3f, 0xbb, 0x80, 0x53, 0x6d, 0x78, 0xaf, 0x0e, 0x39, 0xa0, 0xee, 0x18,
+    0xeb, 0xcf, 0xde, 0xe9, 0x1d, 0xfd, 0x03, 0x84, 0x79, 0xa4, 0x3c, 0x60, 0x7e, 0x49, 0x53, 0x5d,
+    0x03, 0x83, 0x01, 0x18, 0x83, 0x0a, 0xc0, 0xea, 0x83, 0x85, 0x01, 0xe5, 0x01, 0x4f, 0x3b, 0xd6,
+    0x1a, 0x96, 0x36, 0x06, 0x60, 0x76, 0xf4, 0x9c, 0x8a, 0xe4, 0x11, 0xb4, 0xce, 0xea, 0x76, 0x7d,
+    0xbc, 0x4b, 0x00, 0x1b, 0xaa, 0x25, 0xa4, 0x8b, 0xd7, 0xb4, 0x58, 0x8f, 0xcf, 0x1b, 0x00, 0x50,
+    0xa8, 0x00, 0xa1, 0xa8, 0x69, 0x00, 0x4a, 0xa1, 0x02, 0xb0, 0xb3, 0xab, 0x43, 0x52, 0x71, 0xe0,
+    0x66, 0x21, 0x45, 0x0c, 0xe9, 0x55, 0x35, 0x1b, 0xca, 0xc4, 0xba, 0x49, 0xfa, 0x03, 0xa4, 0xdf,
+    0xb3, 0xea, 0xb7, 0x72, 0x51, 0x93, 0xfa, 0xc4, 0x08, 0xbc, 0xf2, 0x27, 0x40, 0x84, 0x62, 0x1c,
+    0x01, 0x40, 0xe4, 0x29, 0x00, 0x2f, 0x24, 0x0d, 0x80, 0x13, 0xa8, 0x00, 0x1e, 0x9c, 0xc4, 0x7a,
+    0x58, 0x59, 0xa3, 0x59, 0xce, 0xde, 0x46, 0x8b, 0x4d, 0x00, 0x29, 0xa7, 0xd6, 0x66, 0xc5, 0x46,
+    0xc1, 0x2b, 0x5b, 0x21, 0xaa, 0x8a, 0x7d, 0x03, 0x7c, 0xf2, 0x18, 0x2b, 0x00, 0xbe, 0xa1, 0x02,
+    0x98, 0x77, 0x52, 0x00, 0x20, 0x8f, 0x0a, 0x40, 0xaa, 0x4e, 0x7c, 0x2a, 0xd5, 0xb5, 0xd8, 0x2b,
+    0x2b, 0x43, 0x33, 0xb7, 0x05, 0x4c, 0x2d, 0xec, 0x67, 0x56, 0x66, 0x12, 0xb4, 0x12, 0x6c, 0x73,
+    0x37, 0xc0, 0x43, 0x20, 0xbb, 0x5b, 0xc8, 0xe2, 0xa4, 0xc7, 0x00, 0x50, 0x43, 0x5a, 0x0c, 0x80,
+    0x70, 0xa8, 0x00, 0xd5, 0xd5, 0x19, 0x00, 0xcc, 0xa0, 0x02, 0xd8, 0x86, 0x59, 0x2e, 0x5a, 0x6b,
+    0xe0, 0xa5, 0xcc, 0xf0, 0x02, 0x02, 0x56, 0x99, 0x9f, 0xc5, 0x5c, 0xf6, 0x83, 0xda, 0x63, 0xae,
+    0x52, 0x73, 0x88, 0x7e, 0x74, 0x10, 0x38, 0x22, 0x92, 0x4a, 0x88, 0xf9, 0x27, 0x6d, 0x25, 0x0e,
+    0x53, 0x03, 0x60, 0x14, 0x2a, 0x80, 0xac, 0xb5, 0x95, 0x04, 0xb4, 0x07, 0x2a, 0xdb, 0xb0, 0x47,
+    0x62, 0x5a, 0x19, 0x78, 0x9d, 0x32, 0xab, 0x47, 0x92, 0x49, 0x4d, 0x6a, 0x29, 0x98, 0xb3, 0xf2,
+    0x36, 0x81, 0xac, 0xb7, 0x56, 0x07, 0x32, 0x7e, 0xd3, 0x6a, 0x37, 0x26, 0x46, 0x00, 0xc0, 0xa1,
+    0x02, 0x90, 0x42, 0x04, 0x01, 0x28, 0x87, 0x0a, 0x20, 0x53, 0x6b, 0x9c, 0x48, 0xcd, 0x01, 0x9a,
+    0x72, 0x9a, 0x07, 0xa1, 0x77, 0xd5, 0x64, 0x66, 0x93, 0xc7, 0x1e, 0x69, 0x10, 0xa0, 0x5a, 0x8e,
+    0x16, 0xc1, 0xca, 0x47, 0xad, 0xfa, 0x97, 0xcb, 0xb4, 0xca, 0xa7, 0x80, 0x52, 0x8c, 0x6b, 0x15,
+    0x00, 0xb1, 0xa7, 0x00, 0xb3, 0x48, 0x12, 0x00, 0xce, 0xa0, 0x02, 0xe0, 0x30, 0x6a, 0xe6, 0x61,
+    0x67, 0x6d, 0xd6, 0xb4, 0x90, 0xc1, 0x2c, 0x3e, 0x81, 0xe1, 0xa1, 0x30, 0x11, 0x14, 0x3b, 0xd5,
+    0xae, 0x2b, 0x75, 0x09, 0x20, 0x76, 0x0e, 0x18, 0xaa, 0x23, 0x11, 0x00, 0xf8, 0x88, 0x0a, 0xe0,
+    0xde, 0xe8, 0x05, 0x80, 0x44, 0x2a, 0x40, 0xa2, 0xfc, 0xc7, 0xaa, 0x74, 0xd7, 0x58, 0xb9, 0xdc,
+    0x58, 0xd5, 0x5c, 0x17, 0x18, 0xbd, 0xb0, 0x10, 0x61, 0x99, 0x4b, 0x2d, 0x4b, 0x2f, 0x80, 0xd3,
+    0x00, 0x17, 0x81, 0xeb, 0x71, 0xdf, 0x42, 0x93, 0x3e, 0x03, 0x4a, 0x0d, 0x21, 0x0b, 0x00, 0x42,
+    0xa2, 0x02, 0x50, 0x37, 0x8f, 0x01, 0x30, 0x85, 0x0a, 0x60, 0x1d, 0x15, 0x1e, 0x68, 0xb5, 0x01,
+    0x57, 0x32, 0x83, 0x23, 0x04, 0x78, 0x65, 0x74, 0x37, 0xbb, 0x31, 0x1c, 0xea, 0x8f, 0xb9, 0x7a,
+    0xcd, 0x67, 0x1f, 0xd2, 0x43, 0x80, 0xa9, 0x49, 0x97, 0x4d, 0xe6, 0xa7, 0xb4, 0xd5, 0x3a, 0x5e,
+    0x02, 0x80, 0x71, 0xa8, 0x00, 0xf9, 0xad, 0x42, 0x00, 0x50, 0x9f, 0x02, 0x6c, 0x03, 0x90, 0xae,
+    0x69, 0x67, 0xc0, 0x15, 0x4d, 0x89, 0x54, 0x49, 0x2e, 0x35, 0xe7, 0xa0, 0x40, 0xc5, 0xcc, 0xfb,
+    0x04, 0xb4, 0x16, 0x83, 0xe9, 0xd2, 0x78, 0x4e, 0xd3, 0xbd, 0x98, 0x77, 0x00, 0x00, 0x89, 0x0a,
+    0xa0, 0x0a, 0x7e, 0x01, 0xa0, 0x24, 0x2a, 0x00, 0x5f, 0xcd, 0xa8, 0x20, 0x55, 0x07, 0x60, 0x81,
+    0x79, 0xe8, 0x78, 0x5e, 0x56, 0x7b, 0x99, 0x6e, 0x92, 0x54, 0xa4, 0x43, 0xe0, 0xfa, 0x34, 0x03,
+    0x62, 0x2a, 0x27, 0x41, 0x6c, 0x70, 0xd2, 0x49, 0x29, 0xbf, 0x02, 0x50, 0x38, 0x3e, 0x29, 0x00,
+    0x44, 0x9f, 0x02, 0xac, 0xc2, 0x80, 0x01, 0x38, 0x85, 0x0a, 0x80, 0xc5, 0x12, 0x8e, 0x87, 0xa5,
+    0xb5, 0xd9, 0xbf, 0x98, 0x3a, 0xb1, 0x18, 0x05, 0x7a, 0xa4, 0x22, 0x9c, 0x4b, 0x6c, 0x55, 0xc3,
+    0x92, 0xd3, 0x68, 0x59, 0xd8, 0x3b, 0x00, 0x19, 0x0e, 0xe6, 0x04, 0xe0, 0x2b, 0x32, 0x00, 0x7e,
+    0xcf, 0x0d, 0x00, 0x32, 0xa9, 0x00, 0x5c, 0x02, 0xec, 0xa9, 0x52, 0x5e, 0x3b, 0x15, 0x53, 0xce,
+    0x6c, 0x73, 0x5f, 0x20, 0x64, 0xc2, 0x11, 0x9a, 0x65, 0x36, 0xb5, 0xab, 0xb9, 0x98, 0x04, 0x03,
+    0x7c, 0x04, 0xaa, 0xcf, 0x25, 0x5c, 0x4d, 0x7a, 0x0d, 0x50, 0x31, 0x24, 0x57, 0x01, 0x08, 0x8b,
+    0x0a, 0x40, 0x5d, 0xcf, 0x03, 0xc0, 0x1c, 0x2a, 0xc0, 0x7b, 0x06, 0x8f, 0x9d, 0xf5, 0x06, 0x58,
+    0xc6, 0x14, 0x5d, 0x01, 0x60, 0x16, 0xa8, 0x65, 0x4d, 0x29, 0xa4, 0xa8, 0x41, 0x06, 0x0b, 0x36,
+    0xaa, 0x1b, 0x49, 0x17, 0x81, 0x28, 0x2c, 0x0b, 0xec, 0x99, 0xbf, 0xd2, 0x5a, 0xf4, 0x60, 0x4e,
+    0x00, 0x46, 0xa2, 0x02, 0xc0, 0xf7, 0x7b, 0x00, 0x40, 0x7f, 0x0a, 0xb0, 0x0e, 0x04, 0x47, 0xa7,
+    0xa5, 0x81, 0xd6, 0x3c, 0xb3, 0x89, 0x25, 0xd9, 0xd4, 0x94, 0x7c, 0xd2, 0x60, 0x36, 0x6f, 0x14,
+    0xc8, 0x1e, 0xad, 0x16, 0x5f, 0xe3, 0x3b, 0xcd, 0x67, 0x62, 0x71, 0x06, 0x00, 0x2c, 0x2a, 0x80,
+    0x2c, 0xac, 0x17, 0x80, 0xb2, 0xa8, 0x00, 0xcc, 0x8d, 0x00, 0x7b, 0xd4, 0x1d, 0x60, 0xed, 0x84,
+    0x06, 0xb7, 0x79, 0x5b, 0x8d, 0x85, 0xbe, 0x28, 0x80, 0x90, 0x16, 0x01, 0x6d, 0xc3, 0xb4, 0x9a,
+    0xa6, 0xbc, 0xd4, 0xb2, 0x05, 0x72, 0x82, 0x9c, 0x7c, 0x0b, 0x58, 0xf5, 0x38, 0xb5, 0x01, 0x10,
+    0x7f, 0x0a, 0x50, 0x0a, 0xd4, 0x03, 0xe0, 0x1c, 0x2a, 0xc0, 0x1f, 0xd7, 0x0d, 0x1e, 0xb6, 0xd6,
+    0x64, 0xaa, 0xea, 0xca, 0xba, 0xe2, 0x14, 0xb8, 0x1d, 0x8b, 0x8f, 0x21, 0xb1, 0x57, 0x0d, 0x9b,
+    0x49, 0x9d, 0xcb, 0x60, 0xf7, 0x80, 0xa6, 0x80, 0xdb, 0x03, 0x00, 0x52, 0xa9, 0x00, 0x1e, 0xaa,
+    0x47, 0xa3, 0xd2, 0x5e, 0x03, 0x4d, 0x53, 0x36, 0x76, 0x73, 0x61, 0xe0, 0x23, 0x41, 0xf0, 0x9e,
+    0x65, 0x3e, 0x35, 0x2a, 0xb7, 0x2a, 0xd7, 0x02, 0x9c, 0x04, 0xa8, 0xcb, 0x95, 0xbd, 0x4e, 0xfa,
+    0x0d, 0x78, 0x25, 0xa4, 0xc2, 0x00, 0x08, 0x8d, 0x0a, 0x50, 0xdd, 0x59, 0x01, 0xc0, 0x24, 0x2a,
+    0x00, 0x80, 0xd8, 0xa5, 0x9a, 0x15, 0x07, 0x54, 0xc4, 0x14, 0xbb, 0x12, 0xe0, 0x16, 0x88, 0xe5,
+    0xad, 0x4f, 0xdd, 0xa8, 0x43, 0x4d, 0xdb, 0x35, 0xb1, 0xe1, 0x49, 0x1f, 0x8d, 0x2a, 0x32, 0xdb,
+    0xe1, 0x9a, 0xdf, 0xd2, 0x5c, 0xfc, 0xf0, 0x22, 0x00, 0xc6, 0xa2, 0x02, 0xa4, 0xd7, 0xae, 0x01,
+    0x40, 0x81, 0x0a, 0x70, 0x90, 0xb1, 0xc4, 0xa7, 0xad, 0x81, 0x56, 0x43, 0x57, 0x61, 0x25, 0xf9,
+    0xd4, 0x8a, 0x81, 0xd2, 0xbb, 0x36, 0xef, 0x14, 0xc0, 0xc6, 0x2d, 0x89, 0x60, 0xe3, 0x3d, 0x6d,
+    0xd8, 0xe1, 0x09, 0x04, 0x00, 0x34, 0x2a, 0xc0, 0x2e, 0x1e, 0x0d, 0x80, 0xd2, 0xa8, 0x00, 0x22,
+    0x26, 0xcf, 0x74, 0x54, 0x1e, 0x30, 0xe9, 0xa3, 0x6a, 0x8e, 0x79, 0x5d, 0x2d, 0xa5, 0x42, 0x19,
+    0x95, 0x8f, 0x1e, 0x8d, 0x2b, 0xb4, 0x24, 0x71, 0xa3, 0xdc, 0xd4, 0xae, 0x4b, 0xda, 0x4e, 0x91,
+    0xfc, 0x0b, 0x78, 0x01, 0x19, 0x05, 0x01, 0x10, 0x81, 0x0a, 0x00, 0x0a, 0x9c, 0x01, 0xe0, 0x24,
+    0x2a, 0x40, 0x2b, 0x7f, 0xe3, 0x1d, 0xd6, 0xd6, 0x62, 0x52, 0xb2, 0xaa, 0xb0, 0x62, 0x15, 0x90,
+    0xc9, 0x4b, 0xed, 0x16, 0xb1, 0x59, 0x0d, 0xbb, 0xc4, 0x8f, 0x49, 0x60, 0xff, 0x00, 0x29, 0x83,
+    0xe1, 0x15, 0x00, 0x72, 0xc9, 0x00, 0xc3, 0x81, 0x23, 0x94, 0x52, 0x5f, 0xc3, 0x88, 0x33, 0x5d,
+    0x73, 0x73, 0x63, 0xa0, 0x13, 0x3f, 0xcd, 0x84, 0x65, 0x46, 0x35, 0xe8, 0xb5, 0x7a, 0x4d, 0x02,
+    0xbc, 0x04, 0xa6, 0xb9, 0x8d, 0x9f, 0x51, 0x7a, 0x0e, 0xa0, 0x15, 0x64, 0x30, 0x00, 0x08, 0x8f,
+    0x0c, 0x80, 0x5d, 0xe5, 0x05, 0xc0, 0x2c, 0x2a, 0x80, 0x81, 0xe8, 0x78, 0x97, 0x35, 0x07, 0x4c,
+    0xc5, 0x6c, 0x18, 0x25, 0x60, 0x17, 0x60, 0x59, 0x0e, 0xb6, 0x14, 0xa9, 0x45, 0x2d, 0x5b, 0x35,
+    0xb7, 0xce, 0x4a, 0x27, 0x81, 0x6c, 0x38, 0xf1, 0x33, 0x9c, 0xff, 0xd2, 0x60, 0x03, 0x49, 0x68,
+    0x00, 0x46, 0xa3, 0x02, 0x88, 0x57, 0x1f, 0x01, 0x40, 0x83, 0x0a, 0x90, 0x12, 0x57, 0x32, 0xa8,
+    0xb5, 0x01, 0x56, 0x47, 0x1f, 0xf5, 0x24, 0x19, 0xd5, 0x82, 0x8e, 0xba, 0x96, 0x32, 0x6f, 0x15,
+    0xc0, 0x4a, 0xce, 0xbe, 0x53, 0xe3, 0x3f, 0xed, 0x38, 0xe1, 0xae, 0x01, 0x00, 0x3c, 0x32, 0x40,
+    0x31, 0x72, 0x02, 0x80, 0xf2, 0xa8, 0x00, 0x82, 0x16, 0x2e, 0x6e, 0xd4, 0x1e, 0x00, 0xfd, 0x82,
+    0x91, 0x6d, 0x79, 0x5f, 0xed, 0xc4, 0xc6, 0x10, 0x73, 0x8e, 0x26, 0x81, 0xe9, 0xa6, 0x7c, 0x07,
+    0xa0, 0xfc, 0xd4, 0xaa, 0x90, 0x72, 0xab, 0x82, 0x7c, 0x0c, 0x98, 0x05, 0xf9, 0x55, 0x00, 0x10,
+    0x83, 0x0a, 0xe0, 0x89, 0x66, 0x06, 0xe0, 0x2c, 0x2a, 0x00, 0x38, 0x55, 0xb5, 0x1d, 0xf6, 0xd6,
+    0x60, 0xf7, 0xd1, 0x09, 0xa6, 0xe2, 0x15, 0x60, 0x85, 0x2c, 0x4c, 0x10, 0xb1, 0x5b, 0x2d, 0xcb,
+    0xbf, 0x7f, 0x3e, 0x60, 0x07, 0x19, 0xeb, 0x49, 0xce, 0x1b, 0x9e, 0xf4, 0x27, 0x13, 0xf4, 0x0c,
+    0xb0, 0xd7, 0x5c, 0x19, 0xe0, 0x14, 0xef, 0xab, 0x4c, 0x99, 0x53, 0x6d, 0x89, 0x2d, 0xea, 0x58,
+    0x00, 0x37, 0x0d, 0x29, 0x66, 0x71, 0xa0, 0x95, 0xbe, 0x03, 0x72, 0xdd, 0xe5, 0x35, 0x00, 0x4c,
+    0xa3, 0x02, 0xf4, 0xe7, 0xff, 0x40, 0x59, 0x75, 0x40, 0xa4, 0x4c, 0x5a, 0x9e, 0x03, 0x7e, 0x01,
+    0x94, 0xeb, 0xee, 0x21, 0x95, 0x7a, 0xd4, 0xae, 0x4a, 0xd3, 0x4a, 0xbe, 0xf4, 0x12, 0xc0, 0xe6,
+    0xf3, 0xa1, 0xd8, 0xf9, 0x31, 0x4d, 0x76, 0x90, 0xd6, 0x03, 0x60, 0x3c, 0x2a, 0x40, 0x77, 0xed,
+    0x08, 0x00, 0x54, 0xa8, 0x00, 0x4e, 0xe1, 0xef, 0x89, 0xda, 0x1b, 0x58, 0x99, 0x34, 0xcc, 0x42,
+    0x92, 0x53, 0x8d, 0x57, 0x2a, 0x20, 0xd6, 0xf2, 0x5e, 0x81, 0xab, 0xea, 0x3a, 0x73, 0x33, 0x1e,
+    0xd4, 0x98, 0xcf, 0x50, 0x4f, 0x00, 0x4a, 0xa4, 0x02, 0xbc, 0x5b, 0x9c, 0xa3, 0x51, 0x7d, 0xc0,
+    0xe2, 0x88, 0xe8, 0x43, 0xe5, 0x85, 0xb5, 0xd2, 0x2a, 0x51, 0xe4, 0x34, 0xba, 0x04, 0x9e, 0x6e,
+    0x9a, 0x67, 0x72, 0x72, 0x54, 0x9b, 0x52, 0xeb, 0x22, 0xc4, 0xf1, 0x33, 0xe0, 0xf6, 0xe3, 0xae,
+    0x05, 0x40, 0x14, 0x2a, 0x80, 0x27, 0x7a, 0x10, 0x80, 0xd3, 0xc8, 0x00, 0x1a, 0xbd, 0xac, 0x75,
+    0x58, 0x5c, 0x73, 0x65, 0xe6, 0x61, 0x6f, 0x8a, 0x59, 0xc0, 0x64, 0x35, 0xba, 0x35, 0xc4, 0x76,
+    0x35, 0x6d, 0xeb, 0x7a, 0x31, 0x82, 0x3d, 0x64, 0xb4, 0xc3, 0xc8, 0x48, 0x00, 0x52, 0xa0, 0x02,
+    0x1c, 0x74, 0x21, 0x3a, 0x73, 0x67, 0x60, 0xf3, 0x38, 0x93, 0xb8, 0x64, 0x56, 0xb5, 0xe3, 0xb7,
+    0xd8, 0x35, 0x00, 0xfc, 0x04, 0xa2, 0x69, 0x5d, 0xd4, 0x5d, 0x7a, 0x0f, 0xf8, 0x89, 0xb7, 0x33,
+    0x00, 0x30, 0x8f, 0x0a, 0x30, 0x1e, 0xce, 0x29, 0x64, 0xdd, 0x81, 0x0e, 0x35, 0x65, 0x90, 0x13,
+    0x18, 0x06, 0x48, 0xbf, 0xf3, 0xd2, 0x64, 0x6a, 0x12, 0xac, 0xfa, 0x8c, 0xa6, 0x48, 0xd3, 0x4d,
+    0xa0, 0x0a, 0xd1, 0x1f, 0xc8, 0xe7, 0xcf, 0x34, 0xda, 0x42, 0xc6, 0x04, 0x80, 0x11, 0xa9, 0x00,
+    0xd9, 0xbd, 0x6f, 0x00, 0xd0, 0xa1, 0x02, 0xc4, 0xa5, 0x27, 0x3f, 0x6a, 0x71, 0x40, 0x75, 0x52,
+    0x14, 0xd9, 0x48, 0x56, 0xb5, 0x1b, 0xb0, 0x3e, 0x4f, 0xc9, 0x9b, 0x05, 0xac, 0xb9, 0x23, 0x2a,
+    0xc5, 0xf8, 0x50, 0x83, 0x6a, 0xc3, 0x8f, 0x00, 0x28, 0x93, 0x0a, 0x80, 0x60, 0xa8, 0x02, 0x40,
+    0xfd, 0x05, 0x80, 0x1b, 0xa0, 0xa6, 0x93, 0x37, 0xd6, 0x48, 0xe7, 0xe4, 0xe2, 0xbf, 0x68, 0x13,
+    0x58, 0x2e, 0xa9, 0x01, 0x95, 0xc9, 0x53, 0x4d, 0x4a, 0xb1, 0x71, 0xcd, 0xc5, 0xd7, 0x00, 0x9e,
+    0x8e, 0x15, 0x0c, 0x00, 0x71, 0xa8, 0x00, 0x5a, 0x8d, 0x84, 0x73, 0xd8, 0x5c, 0x63, 0xe9, 0x64,
+    0xd5, 0x46, 0x8a, 0x5b, 0xe0, 0xe3, 0x38, 0x43, 0x33, 0xc4, 0x7e, 0xb5, 0x2c, 0xd8, 0xcc, 0x08,
+    0x83, 0x5d, 0x64, 0xac, 0xb9, 0x68, 0x22, 0x00, 0xd2, 0xa0, 0x02, 0x78, 0xf4, 0x43, 0x07, 0x73,
+    0x69, 0x60, 0x03, 0xb5, 0x7f, 0xfd, 0x63, 0x5e, 0x35, 0xa1, 0xbb, 0xd6, 0xcb, 0x01, 0x1c, 0x65,
+    0xa2, 0x2f, 0x35, 0x36, 0x67, 0xfa, 0x0f, 0x20, 0xaa, 0x97, 0x4f, 0x01, 0x30, 0x91, 0x0a, 0xf0,
+    0x9a, 0xae, 0x5e, 0x63, 0xe5, 0x01, 0x0b, 0x39, 0x33, 0xe7, 0x18, 0x38, 0x06, 0x40, 0xc6, 0x63,
+    0xae, 0x75, 0xea, 0x52, 0x93, 0xce, 0x0c, 0x1f, 0xa2, 0xd3, 0x4f, 0x40, 0x4a, 0xd2, 0xce, 0x44,
+    0xe8, 0xd7, 0xb4, 0x1b, 0x43, 0x74, 0x16, 0x80, 0x31, 0xa9, 0x00, 0xd6, 0xd5, 0x4a, 0x00, 0x50,
+    0xa2, 0x02, 0x48, 0x26, 0x90, 0x54, 0x6a, 0x73, 0x00, 0x65, 0xd2, 0xfa, 0x9d, 0x48, 0x5e, 0x35,
+    0xd9, 0xb7, 0x02, 0x26, 0xc7, 0xbb, 0x05, 0xac, 0xc0, 0x5b, 0x07, 0xbb, 0x78, 0x51, 0xa3, 0x92,
+    0xa3, 0xa3, 0x01, 0x28, 0x95, 0x0a, 0xe0, 0x5f, 0x84, 0x00, 0x40, 0x05, 0x2a, 0x40, 0x19, 0x2a,
+    0xba, 0x92, 0x57, 0xd6, 0x46, 0x1d, 0xbd, 0x44, 0xad, 0xe8, 0x13, 0x30, 0xce, 0x28, 0x64, 0x64,
+    0xc9, 0x55, 0x2d, 0x1a, 0xb5, 0x5a, 0x73, 0xc4, 0xdf, 0x00, 0x20, 0x8d, 0xa5, 0x01, 0x00, 0x91,
+    0xa8, 0x00, 0x9f, 0x7d, 0xcd, 0x70, 0x58, 0x5d, 0x4b, 0x71, 0xa3, 0x3f, 0x22, 0x8a, 0x5d, 0x00,
+    0x93, 0xbc, 0xd6, 0x30, 0xc4, 0x86, 0xb5, 0x2b, 0xc5, 0x1c, 0x9c, 0x83, 0x7d, 0x94, 0xa4, 0xb1,
+    0x60, 0x6c, 0x00, 0x52, 0xa1, 0x02, 0xe0, 0x94, 0xa3, 0xc8, 0x72, 0x6b, 0x40, 0x83, 0x30, 0x63,
+    0x13, 0x63, 0x66, 0xa1, 0x1e, 0xc1, 0xc4, 0xc1, 0x03, 0x3c, 0x65, 0xa2, 0xeb, 0xbc, 0x97, 0x72,
+    0x7a, 0x10, 0x48, 0xca, 0x37, 0xa7, 0x00, 0x30, 0x93, 0x0a, 0x30, 0x14, 0x9a, 0xbc, 0x62, 0xed,
+    0x01, 0x05, 0x3e, 0xf5, 0x19, 0x1e, 0x58, 0x06, 0x38, 0xc4, 0x33, 0x0a, 0x86, 0x6a, 0x53, 0x7b,
+    0xa6, 0x2c, 0x57, 0x03, 0xd4, 0x51, 0x00, 0x2a, 0x53, 0x84, 0xca, 0xe8, 0xdf, 0x34, 0x1d, 0x43,
+    0x2a, 0x0c, 0x80, 0x51, 0xa9, 0x00, 0xd5, 0x55, 0x25, 0x00, 0xd0, 0xa2, 0x02, 0xa8, 0x66, 0xbd,
+    0x69, 0x6a, 0x75, 0xc0, 0x34, 0x52, 0xce, 0x53, 0x48, 0x66, 0xb5, 0xd6, 0xbf, 0x00, 0xf9, 0xc4,
+    0xdb, 0x05, 0xaa, 0xc0, 0xeb, 0x54, 0xb1, 0xf8, 0x11, 0xc4, 0xb6, 0xc3, 0xf4, 0x00, 0x28, 0x97,
+    0x0a, 0x50, 0xdf, 0x72, 0x05, 0x40, 0x0d, 0x2a, 0xc0, 0x1d, 0x3c, 0x11, 0x92, 0x77, 0xd6, 0x44,
+    0x4d, 0x65, 0xa7, 0x9c, 0x68, 0x14, 0x08, 0x9e, 0xc8, 0x87, 0x37, 0xc9, 0x57, 0x0d, 0x8a, 0x38,
+    0x4a, 0x21, 0xc3, 0xe7, 0x80, 0x22, 0x8b, 0x7d, 0x13, 0x00, 0xb1, 0xc8, 0x00, 0xe9, 0x3d, 0xa6,
+    0x6c, 0xd8, 0x5d, 0x2b, 0x2d, 0x02, 0x56, 0xff, 0x89, 0x5f, 0x00, 0x52, 0x40, 0x7d, 0x2d, 0xc4,
+    0x8e, 0xb5, 0x2a, 0xb3, 0x22, 0xd3, 0x83, 0x9d, 0x64, 0x9e, 0xa9, 0x88, 0x45, 0x00, 0xd2, 0xa1,
+    0x02, 0x64, 0x55, 0x03, 0x80, 0x72, 0x6d, 0x20, 0x93, 0xab, 0x44, 0xf9, 0x61, 0x6e, 0x99, 0x9b,
+    0xc8, 0xcc, 0x33, 0x06, 0x5c, 0x65, 0xa0, 0xa2, 0x7c, 0xe9, 0x80, 0xfa, 0x10, 0x70, 0xf2, 0xb7,
+    0xbe, 0x01, 0x30, 0x95, 0x0c, 0x80, 0x8e, 0x81, 0x02, 0x60, 0xf5, 0x29, 0x40, 0x44, 0x63, 0xf0,
+    0x22, 0x78, 0x06, 0x32, 0xb6, 0x0b, 0xd7, 0x96, 0xea, 0x53, 0x5b, 0x8a, 0x6c, 0xca, 0x68, 0xd4,
+    0x53, 0xc0, 0x69, 0x53, 0x47, 0x58, 0xe9, 0xe7, 0x34, 0x9f, 0x42, 0x02, 0x02, 0x80, 0x71, 0xa9,
+    0x00, 0xd6, 0xdd, 0x6f, 0x00, 0x50, 0x23, 0x03, 0xe8, 0x66, 0x2a, 0x7d, 0x6a, 0x77, 0x60, 0x34,
+    0x52, 0x99, 0x09, 0x48, 0x6e, 0x35, 0xd4, 0xc7, 0xf8, 0xcf, 0xc2, 0xfb, 0x05, 0xa6, 0xba, 0xab,
+    0x31, 0xa7, 0x78, 0x52, 0xc3, 0xd6, 0x23, 0x46, 0x00, 0x28, 0x99, 0x0a, 0xd0, 0x5e, 0x5b, 0x03,
+    0x40, 0x15, 0x2a, 0xc0, 0x25, 0xb0, 0xa7, 0x91, 0x97, 0xd6, 0x42, 0x74, 0xbd, 0x8a, 0x8e, 0xe8,
+    0x14, 0xe0, 0x9d, 0xa8, 0xe8, 0x0e, 0xc9, 0x59, 0x0d, 0x8a, 0x3b, 0x49, 0xee, 0xc1, 0xef, 0x00,
+    0xe5, 0x8e, 0xe9, 0xdb, 0x19, 0x96, 0xd7, 0x42, 0xab, 0xc0, 0x1d, 0x00, 0x62, 0x98, 0x00, 0x0c,
+    0xf1, 0xc9, 0x08, 0xb1, 0x65, 0x4d, 0x9a, 0xa8, 0x81, 0xf2, 0x60, 0x2f, 0x99, 0x26, 0x29, 0x96,
+    0x07, 0x80, 0x94, 0xa8, 0x00, 0x81, 0x3d, 0x49, 0x8d, 0xdc, 0x1b, 0xc0, 0x90, 0x29, 0x8a, 0x37,
+    0x98, 0x5d, 0x46, 0x66, 0x34, 0x6b, 0x32, 0x02, 0x5f, 0x19, 0x28, 0x15, 0xa1, 0xf2, 0xa3, 0x5e,
+    0x34, 0xa6, 0xde, 0x98, 0x03, 0x00, 0xd6, 0x9f, 0x02, 0xb0, 0x94, 0x6a, 0x70, 0x82, 0x69, 0xc0,
+    0xd2, 0xb9, 0x38, 0x5b, 0xaa, 0x46, 0x35, 0x24, 0xc8, 0xbc, 0xc3, 0x4c, 0x5d, 0x05, 0x98, 0x30,
+    0xc5, 0xd1, 0x9f, 0xfe, 0x4e, 0x0b, 0x1e, 0x24, 0x43, 0x01, 0x18, 0x99, 0x0c, 0xd0, 0x1b, 0x6c,
+    0x32, 0xaa, 0xe5, 0x01, 0x90, 0x49, 0x7d, 0xd9, 0x1e, 0xd9, 0xd5, 0x46, 0x3a, 0x73, 0x1c, 0x03,
+    0x6f, 0x18, 0x88, 0xc2, 0xee, 0x37, 0x74, 0xe2, 0x4b, 0x8d, 0xca, 0x0f, 0x65, 0x05, 0xa0, 0x6c,
+    0x2a, 0x40, 0x79, 0x23, 0x05, 0x00, 0x75, 0xa8, 0x00, 0xbf, 0x20, 0xe7, 0x46, 0xde, 0x5a, 0x0b,
+    0x45, 0x56, 0x7c, 0x11, 0xa2, 0x55, 0xc0, 0x36, 0xa3, 0x20, 0xb1, 0x23, 0x6f, 0x35, 0xe8, 0xf7,
+    0x12, 0x71, 0x03, 0xdf, 0x03, 0x9e, 0x93, 0xa6, 0x46, 0x60, 0xd8, 0x5e, 0xd3, 0xd0, 0x62, 0x9b,
+    0x01, 0x88, 0x63, 0x0a, 0x00, 0x48, 0xdf, 0xf8, 0xc3, 0x9e, 0x35, 0x28, 0x93, 0xca, 0xc0, 0x83,
+    0xdd, 0x64, 0x94, 0xa0, 0x50, 0x67, 0x00, 0xd2, 0xa2, 0x02, 0xc0, 0x56, 0x84, 0xe6, 0x71, 0x71,
+    0xc0, 0xb2, 0xa0, 0xfd, 0x63, 0x60, 0x7e, 0x01, 0x16, 0xdc, 0xbc, 0xbb, 0x0b, 0x9c, 0x65, 0xa0,
+    0x03, 0x2c, 0x2b, 0x9f, 0xfa, 0x11, 0xc0, 0x52, 0xe3, 0x3e, 0x01, 0x58, 0x81, 0x0a, 0xa0, 0xd4,
+    0x38, 0x96, 0x0a, 0xae, 0x81, 0x09, 0xde, 0x16, 0xa4, 0xac, 0x3a, 0xd5, 0x86, 0x22, 0x1b, 0x5b,
+    0x4a, 0xf5, 0x15, 0x58, 0x7a, 0xf4, 0xbb, 0xa6, 0xfa, 0x3d, 0xad, 0xf8, 0x9a, 0x3a, 0x58, 0xaa,
+    0xed, 0x81, 0x4d, 0x4c, 0x4f, 0x50, 0x1d, 0xf9, 0xd5, 0x3a, 0x52, 0x0b, 0x6a, 0xfc, 0xee, 0x18,
+    0x78, 0x8a, 0x4e, 0x69, 0x4d, 0xe2, 0x4d, 0x2d, 0x2a, 0x90, 0xad, 0x02, 0xa0, 0x74, 0x2a, 0xc0,
+    0x77, 0xf9, 0x18, 0x00, 0x95, 0xa8, 0x00, 0xe7, 0x28, 0xbe, 0x47, 0x5e, 0x5b, 0x03, 0x95, 0xf6,
+    0x0c, 0xf1, 0xa1, 0x57, 0xe0, 0x85, 0xa4, 0xa5, 0x45, 0x23, 0x77, 0xb5, 0xa7, 0xff, 0x10, 0x69,
+    0x00, 0xff, 0x63, 0xa6, 0xc0, 0xd6, 0x83, 0x55, 0x58, 0x5f, 0x8b, 0xf4, 0x82, 0xfb, 0x00, 0x88,
+    0x65, 0x0a, 0xd0, 0x4b, 0xae, 0xcd, 0xc3, 0xa6, 0x35, 0xa6, 0x85, 0x92, 0xb3, 0x83, 0xfd, 0x64,
+    0x90, 0x9e, 0x50, 0x3f, 0x00, 0x52, 0xa3, 0x02, 0x94, 0xf7, 0xa3, 0x9d, 0x71, 0x73, 0x60, 0xc2,
+    0x1a, 0xc9, 0x79, 0x61, 0x86, 0x81, 0x12, 0xe8, 0xb2, 0xb1, 0x0e, 0xbc, 0xd5, 0x9e, 0xb0, 0x83,
+    0x8b, 0xae, 0x7a, 0x12, 0xc0, 0x2a, 0xc3, 0xac, 0x00, 0x58, 0x83, 0x0a, 0xc0, 0x56, 0xb9, 0x23,
+    0x0b, 0xb6, 0x01, 0x08, 0xd2, 0x62, 0xd7, 0xae, 0x5a, 0xd5, 0x7e, 0x2b, 0x63, 0x36, 0x5c, 0x75,
+    0x16, 0x50, 0xfe, 0xf3, 0x31, 0xce, 0xfa, 0x3f, 0x2d, 0x49, 0x18, 0x27, 0x65, 0xaa, 0xf5, 0x81,
+    0xc9, 0x50, 0xe7, 0x66, 0x1b, 0x19, 0xd6, 0x30, 0x62, 0xdb, 0xc7, 0xf5, 0x6e, 0x19, 0x68, 0x56,
+    0xae, 0xd6, 0x26, 0xe2, 0x4f, 0xcd, 0x79, 0x10, 0x01, 0x07, 0xa0, 0x7c, 0x32, 0x80, 0x76, 0xaf,
+    0x10, 0x00, 0xb5, 0xc8, 0x00, 0x0e, 0xb9, 0x94, 0x49, 0xde, 0x5b, 0xfb, 0xc8, 0xf6, 0x9d, 0xdc,
+    0xa1, 0x59, 0x20, 0x45, 0xa6, 0x20, 0xeb, 0x22, 0x7f, 0xa1, 0x27, 0x05, 0x09, 0x01, 0x03, 0x1f,
+    0x64, 0xb0, 0x0f, 0xbe, 0x43, 0x00, 0xd8, 0x9f, 0x02, 0x20, 0xe3, 0x59, 0x00, 0x88, 0x67, 0x0a,
+    0x60, 0xcf, 0x82, 0x7b, 0xc3, 0xae, 0xb5, 0x64, 0x7a, 0x22, 0xca, 0x83, 0x1d, 0x65, 0x8e, 0x9f,
+    0xe8, 0x16, 0x00, 0xd2, 0x23, 0x03, 0x88, 0x58, 0xfb, 0x56, 0x71, 0x75, 0xe0, 0xa1, 0x94, 0x8a,
+    0x76, 0x62, 0x8e, 0x01, 0x4f, 0xf5, 0xc2, 0xc7, 0x11, 0xdc, 0xd5, 0x9c, 0x5e, 0xeb, 0xdb, 0xbc,
+    0xfa, 0x12, 0x98, 0x02, 0xa3, 0x1a, 0x00, 0x58, 0x85, 0x0a, 0xd0, 0xd8, 0x30, 0x71, 0x0b, 0xbe,
+    0x01, 0xc7, 0xc3, 0x90, 0xae, 0xaf, 0x7a, 0xd5, 0x74, 0x39, 0x3b, 0x11, 0x68, 0xf5, 0x16, 0x48,
+    0x56, 0xb3, 0x69, 0xf3, 0xfa, 0x41, 0xad, 0xe9, 0x0f, 0x5d, 0x03, 0xa0, 0xfd, 0x09, 0x80, 0x58,
+    0x7b, 0x39, 0x19, 0x39, 0xd6, 0x24, 0x69, 0x5b, 0xa6, 0xf0, 0xee, 0x19, 0x50, 0x1e, 0xae, 0x41,
+    0xfe, 0xe1, 0x51, 0x6d, 0x19, 0x93, 0xbf, 0xc5, 0xe4, 0xc5, 0x35, 0xcf, 0x6e, 0xed, 0xe2, 0x1c,
+    0xba, 0x05, 0x42, 0x85, 0xca, 0x09, 0x2a, 0x72, 0x98, 0x71, 0x86, 0x90, 0x51, 0x51, 0xf0, 0x43,
+    0x06, 0x5b, 0xe0, 0xd0, 0x01, 0x80, 0x05, 0x2a, 0xc0, 0x34, 0x86, 0x17, 0x80, 0x98, 0xa6, 0x00,
+    0x2c, 0x7d, 0x16, 0x31, 0x6c, 0x5b, 0x23, 0x1e, 0xe7, 0x09, 0x3e, 0xd8, 0x53, 0xa6, 0xf8, 0xe4,
+    0xde, 0x60, 0xc4, 0xdd, 0x11, 0x83, 0x39, 0x7e, 0x30, 0x8d, 0x59, 0x06, 0x2c, 0x0d, 0x1c, 0xe8,
+    0x53, 0xf0, 0x57, 0x63, 0x32, 0xec, 0xed, 0x24, 0xeb, 0x4d, 0xe0, 0x79, 0x0b, 0x22, 0x05, 0x60,
+    0x1d, 0x2a, 0x00, 0x6d, 0xab, 0x16, 0x2e, 0x18, 0x07, 0x18, 0xcc, 0xba, 0x96, 0xbc, 0x6a, 0x56,
+    0xab, 0x39, 0x4d, 0x71, 0xb5, 0xd5, 0x5d, 0x00, 0x09, 0x4a, 0x7d, 0x43, 0xec, 0x0f, 0x35, 0xa9,
+    0x3d, 0x86, 0x04, 0x80, 0x16, 0xa8, 0x00, 0x93, 0x45, 0x3f, 0x59, 0x64, 0x59, 0x5b, 0x94, 0xed,
+    0x15, 0xae, 0xbb, 0x69, 0xc0, 0xb8, 0x37, 0xb1, 0x55, 0x87, 0x4f, 0xb5, 0xa4, 0x53, 0xbc, 0xec,
+    0x93, 0x37, 0xd7, 0x38, 0xc6, 0xa5, 0x60, 0x72, 0x68, 0x17, 0xb8, 0xa4, 0x6a, 0x48, 0x9d, 0xc8,
+    0x63, 0xc6, 0x69, 0x42, 0x3e, 0xab, 0xc1, 0x17, 0x99, 0x29, 0x7f, 0xd5, 0x19, 0x00, 0x36, 0xa8,
+    0x00, 0xdd, 0xe0, 0x34, 0x00, 0xe2, 0x9a, 0x02, 0x6c, 0x95, 0x98, 0xa7, 0xb0, 0x6f, 0x0d, 0x28,
+    0x9b, 0xcb, 0x0c, 0x61, 0x57, 0x19, 0xa2, 0x8e, 0xf3, 0x13, 0x00, 0x97, 0xa7, 0x00, 0x90, 0xc0,
+    0x93, 0x3f, 0xe6, 0x19, 0x58, 0x20, 0x51, 0x05, 0x7f, 0xc1, 0x61, 0x6d, 0xd9, 0x2b, 0xa7, 0x41,
+    0xad, 0x3f, 0x81, 0xe5, 0x2b, 0x38, 0x0b, 0x80, 0x95, 0xa8, 0x00, 0xe1, 0x25, 0xb1, 0xb4, 0xe0,
+    0x1c, 0x49, 0x04, 0x0a, 0x8e, 0xd7, 0xaa, 0x5b, 0x0d, 0x96, 0x36, 0x6b, 0xb3, 0x56, 0x7f, 0x01,
+    0xe4, 0x18, 0x3f, 0x25, 0xb2, 0x5f, 0xd4, 0xac, 0xed, 0x68, 0x5f, 0x00, 0xda, 0xa0, 0x02, 0xb0,
+    0xd7, 0x65, 0x00, 0x90, 0x67, 0x0e, 0x50, 0x35, 0x5a, 0x75, 0xee, 0xae, 0x01, 0x61, 0xdc, 0x2a,
+    0xad, 0x1a, 0x5e, 0xd5, 0x8e, 0x61, 0x79, 0x8a, 0x52, 0x5e, 0x5d, 0xd3, 0x60, 0x37, 0x22, 0xc3,
+    0xa1, 0x5f, 0xe4, 0xc0, 0xac, 0xa6, 0x52, 0x22, 0x97, 0x99, 0x66, 0x09, 0xbb, 0xa4, 0x07, 0x7f,
+    0x94, 0x9e, 0xf3, 0x7d, 0x41, 0x00, 0x58, 0xa1, 0x02, 0x9c, 0x43, 0x2d, 0x00, 0x88, 0x6d, 0x0a,
+    0x40, 0xd8, 0x66, 0x14, 0xc2, 0xc6, 0x99, 0xdd, 0x6a, 0x84, 0xc9, 0x84, 0x7d, 0x65, 0x88, 0x33,
+    0xee, 0x27, 0x00, 0xdc, 0x9e, 0x02, 0x98, 0x62, 0x44, 0x01, 0x98, 0x69, 0x0a, 0x50, 0xc8, 0xaf,
+    0xa9, 0x06, 0x8f, 0xb5, 0x24, 0x9c, 0x64, 0x5a, 0xb7, 0x1e, 0x05, 0x8e, 0xa9, 0x08, 0x07, 0x00,
+    0xd6, 0x22, 0x03, 0xe0, 0x98, 0x0d, 0x00, 0x80, 0x75, 0x01, 0xe0, 0xa2, 0xf3, 0x9b, 0xaa, 0x76,
+    0x35, 0xd5, 0xe2, 0x46, 0xa4, 0x58, 0x1d, 0x06, 0x8e, 0x1f, 0x84, 0x62, 0xc9, 0xfe, 0x11, 0xd4,
+    0x92, 0x23, 0xf3, 0x00, 0x68, 0x85, 0x0a, 0x50, 0x5f, 0xef, 0x05, 0x40, 0xa6, 0x29, 0x40, 0xce,
+    0x6e, 0x2d, 0xb8, 0xdb, 0x06, 0x7c, 0x6c, 0xb3, 0x0d, 0x5f, 0xf8, 0x55, 0x2b, 0xa6, 0x45, 0x4c,
+    0x57, 0x79, 0x77, 0xcd, 0x32, 0xdd, 0xa4, 0x02, 0x80, 0x86, 0x29, 0x80, 0xbb, 0xc2, 0x00, 0x89,
+    0x7c, 0x66, 0x98, 0x1f, 0xdc, 0xe1, 0x21, 0x7c, 0x92, 0x59, 0xae, 0x57, 0x6f, 0x00, 0x60, 0x87,
+    0x0a, 0x10, 0x8f, 0x22, 0x05, 0x20, 0xbe, 0x29, 0xc0, 0x68, 0xd9, 0xc9, 0x05, 0x3b, 0x67, 0x6c,
+    0xb0, 0x91, 0xef, 0x16, 0x76, 0x96, 0x19, 0xaa, 0xd8, 0x03, 0x00, 0x70, 0x7d, 0x0a, 0xe0, 0x0a,
+    0x95, 0x02, 0x60, 0xae, 0x29, 0xc0, 0x30, 0x7b, 0xf9, 0x1c, 0x5c, 0xd6, 0x8c, 0x28, 0xca, 0x47,
+    0xe4, 0xfa, 0x14, 0x20, 0xfe, 0xf8, 0x26, 0x01, 0x80, 0x77, 0x01, 0x40, 0x1d, 0xa5, 0xa1, 0xa9,
+    0x7e, 0xb5, 0x11, 0xed, 0x02, 0x57, 0x55, 0x3d, 0x06, 0x8c, 0xd8, 0x33, 0x3f, 0xc6, 0x7e, 0x52,
+    0xb3, 0x6a, 0xe3, 0x69, 0x00, 0x68, 0x87, 0x0a, 0xf0, 0xdf, 0x37, 0x03, 0x40, 0xae, 0x29, 0xc0,
+    0xc3, 0x88, 0x25, 0xb6, 0xfb, 0x06, 0x72, 0x6a, 0xb3, 0xd6, 0x53, 0x78, 0x56, 0x23, 0x72, 0xa5,
+    0xb1, 0x58, 0x79, 0x79, 0x2d, 0x42, 0x5d, 0x6a, 0x00, 0x80, 0x8e, 0x29, 0x00, 0xc3, 0x38, 0xf3,
+    0x88, 0x9c, 0x66, 0x94, 0x16, 0x94, 0xbf, 0x23, 0xfc, 0x92, 0x39, 0x92, 0xf7, 0x9b, 0x01, 0x60,
+    0x89, 0x0a, 0x90, 0x0f, 0x85, 0x02, 0x20, 0xc6, 0x29, 0x40, 0x6e, 0x51, 0x22, 0x03, 0x5b, 0x67,
+    0x60, 0xc2, 0x19, 0x48, 0x1b, 0xf6, 0x96, 0x19, 0x86, 0xd8, 0x2b, 0x01, 0x70, 0x7f, 0x0a, 0x70,
+    0x8b, 0x15, 0x00, 0x60, 0xb6, 0x29, 0x40, 0x40, 0x41, 0xd0, 0x1e, 0x7c, 0xd6, 0x86, 0xe6, 0xa9,
+    0x25, 0xe9, 0x7a, 0x15, 0x08, 0x0e, 0xd9, 0x7f, 0x00, 0x80, 0x79, 0x0a, 0x30, 0x17, 0x4e, 0x7e,
+    0xa8, 0x86, 0x35, 0xce, 0xf8, 0xb0, 0x2d, 0x51, 0x5d, 0x06, 0x8a, 0x8d, 0xa3, 0x1b, 0xbe, 0xfe,
+    0x52, 0x8b, 0x42, 0xe3, 0xa3, 0x01, 0x68, 0x89, 0x0a, 0x90, 0xe0, 0x77, 0x00, 0x40, 0xb6, 0x29,
+    0x00, 0xb6, 0xcc, 0x59, 0xb3, 0x1b, 0x07, 0x66, 0x6e, 0xbb, 0xae, 0x47, 0xf8, 0x56, 0x1b, 0xa6,
+    0x84, 0x20, 0x40, 0x79, 0x7b, 0xf2, 0x60, 0x5d, 0x2c, 0x05, 0x80, 0x96, 0x29, 0x00, 0xc9, 0xae,
+    0xe9, 0x88, 0xbc, 0x66, 0x90, 0x0c, 0xb4, 0x9c, 0x24, 0x7c, 0x93, 0x21, 0x7a, 0x57, 0x06, 0x01,
+    0x60, 0x8b, 0x0a, 0x00, 0x10, 0xf2, 0x06, 0x20, 0xce, 0x29, 0x80, 0x71, 0xff, 0x76, 0x00, 0x7b,
+    0x67, 0x52, 0xdd, 0x59, 0xa0, 0x20, 0x76, 0x97, 0x19, 0x5e, 0xd8, 0x94, 0x00, 0x70, 0x81, 0x0a,
+    0x10, 0x0c, 0x97, 0x04, 0x60, 0xbe, 0x29, 0x40, 0x4f, 0x3f, 0x07, 0x20, 0x9c, 0xd6, 0x80, 0xac,
+    0x39, 0x03, 0xed, 0xfa, 0x15, 0xf8, 0x11, 0x99, 0x9c, 0x01, 0x80, 0x7b, 0x0a, 0x80, 0x10, 0xcc,
+    0x33, 0xa7, 0x8e, 0xb5, 0x89, 0x05, 0x6f, 0x64, 0x4c, 0x7d, 0x06, 0x88, 0x40, 0x3b, 0xe8, 0xb2,
+    0x7e, 0x53, 0x6b, 0x1a, 0x83, 0x1c, 0x01, 0x68, 0x8b, 0x0a, 0x40, 0xe1, 0xb8, 0x04, 0x40, 0xbe,
+    0x29, 0xc0, 0xa4, 0xea, 0xd1, 0xaf, 0x3b, 0x07, 0x5a, 0x77, 0x73, 0x86, 0x3b, 0x78, 0x57, 0x13,
+    0x06, 0x64, 0x4f, 0x01, 0x78, 0x7d, 0x0a, 0xb0, 0x5d, 0xd9, 0x02, 0x80, 0x9e, 0x29, 0xc0, 0xcc,
+    0x5e, 0xc0, 0x88, 0xdc, 0x66, 0x8c, 0x02, 0x6c, 0x69, 0x25, 0xfc, 0x93, 0x01, 0x6a, 0xd7, 0x70,
+    0x00, 0x60, 0x8d, 0x0c, 0x50, 0x10, 0x58, 0x04, 0x20, 0xd6, 0x29, 0xc0, 0x73, 0xb3, 0x0f, 0x03,
+    0x9b, 0x07, 0x42, 0xfe, 0xc1, 0xe8, 0x27, 0xf6, 0xd7, 0x11, 0x36, 0x78, 0xc1, 0x01, 0x70, 0x83,
+    0x0a, 0xc0, 0x8c, 0x0d, 0x02, 0x60, 0xc6, 0x29, 0x80, 0x5d, 0x93, 0xda, 0x20, 0xbc, 0xd6, 0x78,
+    0x7c, 0x31, 0xd1, 0xef, 0x7a, 0x16, 0xe0, 0x0d, 0x59, 0xfa, 0x00, 0x80, 0x7d, 0x0a, 0xe0, 0x89,
+    0x6b, 0x00, 0xa0, 0x96, 0x3d, 0x00, 0x14, 0x73, 0x37, 0x47, 0x9d, 0x06, 0x84, 0xf2, 0x0a, 0x44,
+    0xa4, 0xfe, 0x53, 0x4b, 0xf2, 0x22, 0x95, 0x00, 0x68, 0x8d, 0x0c, 0xf0, 0x61, 0xeb, 0x01, 0x40,
+    0xc6, 0x29, 0x80, 0x8f, 0x04, 0xaa, 0xab, 0x5b, 0x07, 0x4c, 0x86, 0x53, 0xce, 0x30, 0xf8, 0x97,
+    0x11, 0xea, 0xe3, 0xae, 0x00, 0x78, 0x7f, 0x0a, 0x00, 0xde, 0x7b, 0x00, 0x80, 0xa6, 0x29, 0x40,
+    0xce, 0x50, 0xb3, 0x88, 0xfc, 0x66, 0x86, 0xf9, 0xf3, 0xc4, 0x25, 0x7c, 0x94, 0xe9, 0x25, 0x24,
+    0x71, 0x00, 0x88, 0x77, 0x0a, 0x70, 0x5d, 0x21, 0x9a, 0xc1, 0xee, 0x01, 0xcc, 0x88, 0x24, 0x10,
+    0x8c, 0x1d, 0xd6, 0x84, 0x03, 0x86, 0x4b, 0x00, 0x5c, 0xa1, 0x02, 0x5c, 0xa3, 0xa1, 0x01, 0x98,
+    0x73, 0x0a, 0xb0, 0x5a, 0x82, 0x44, 0x08, 0xb7, 0x35, 0xdc, 0x55, 0xa8, 0x8b, 0xbc, 0xbe, 0x05,
+    0x76, 0x3f, 0xb6, 0x16, 0x00, 0xe0, 0x9f, 0x02, 0x7c, 0x42, 0x38, 0x01, 0xa8, 0x67, 0x0a, 0xd0,
+    0x48, 0x9d, 0x6b, 0x50, 0xaf, 0x81, 0xa0, 0xa9, 0xdc, 0xe7, 0xa4, 0x1f, 0xd5, 0x8c, 0x29, 0x36,
+    0x62, 0x00, 0xe4, 0x9c, 0x02, 0x5c, 0x87, 0x1f, 0x72, 0xba, 0x77, 0xa0, 0xb3, 0x39, 0x59, 0x62,
+    0x82, 0x87, 0x99, 0xa0, 0x3c, 0x10, 0x01, 0x80, 0x17, 0xa8, 0x00, 0xe7, 0x75, 0x51, 0x00, 0xe8,
+    0x9a, 0x02, 0xcc, 0x8c, 0xa5, 0x86, 0xc8, 0x71, 0x06, 0x38, 0x3f, 0xf9, 0x61, 0xc2, 0x4f, 0x99,
+    0x1d, 0x43, 0xf0, 0x18, 0x80, 0x98, 0xa7, 0x00, 0xdf, 0x4d, 0x09, 0x29, 0x6c, 0x1f, 0x40, 0x24,
+    0xa9, 0x61, 0xe6, 0xd8, 0x63, 0x2d, 0xa8, 0x5f, 0x6e, 0x02, 0xc0, 0x1d, 0x2a, 0x80, 0x38, 0xd6,
+    0x0f, 0x80, 0x59, 0xa7, 0x00, 0xd8, 0x1d, 0xa7, 0x82, 0xf0, 0x5b, 0x9b, 0x09, 0x05, 0x30, 0xce,
+    0xeb, 0x5d, 0x20, 0x87, 0xe3, 0x05, 0x06, 0x00, 0x06, 0x2a, 0xc0, 0x28, 0x22, 0x09, 0x80, 0x9a,
+    0xa6, 0x00, 0xcf, 0x94, 0x96, 0xef, 0x74, 0x1b, 0xf0, 0x6d, 0xe9, 0xab, 0x07, 0xfa, 0x53, 0x4d,
+    0x28, 0xe3, 0x4f, 0x03, 0x40, 0xd6, 0x29, 0x00, 0x53, 0xb4, 0x95, 0xa2, 0x9b, 0x07, 0x22, 0xb6,
+    0x33, 0xed, 0x1d, 0xf8, 0x98, 0x09, 0xaa, 0x63, 0x36, 0x01, 0x78, 0x83, 0x0a, 0xf0, 0x5e, 0xa0,
+    0x02, 0x80, 0xb6, 0x29, 0x40, 0xc8, 0x80, 0xc1, 0x87, 0x3c, 0x67, 0x78, 0xf0, 0x0b, 0x6a, 0x26,
+    0x7c, 0x95, 0xc9, 0x31, 0xc4, 0xec, 0x00, 0x88, 0x7b, 0x0a, 0x30, 0xdd, 0xb6, 0x05, 0xc0, 0xfe,
+    0x29, 0x40, 0x9b, 0x3e, 0x18, 0x91, 0x5d, 0xd6, 0x82, 0xf1, 0x7d, 0x02, 0x00, 0x5c, 0x22, 0x03,
+    0xb0, 0xa3, 0x58, 0x00, 0x98, 0x77, 0x0a, 0xa0, 0xdf, 0x74, 0x00, 0x08, 0xc7, 0x35, 0x17, 0x4f,
+    0x66, 0x56, 0xbd, 0xfe, 0x05, 0x70, 0x30, 0x66, 0x3a, 0x00, 0xe0, 0xa0, 0x02, 0xa4, 0x02, 0xac,
+    0x01, 0xa8, 0x6b, 0x0a, 0x30, 0x51, 0x47, 0x8e, 0x4d, 0xbf, 0x81, 0x9d, 0x84, 0x70, 0xf1, 0x9b,
+    0x5f, 0xd5, 0x7e, 0x3a, 0xd6, 0x07, 0x00, 0xe4, 0x9d, 0x02, 0xac, 0xc2, 0xbc, 0x00, 0xb8, 0x7b,
+    0x0a, 0x90, 0xbd, 0x47, 0x64, 0x81, 0x97, 0x19, 0x20, 0x38, 0xbe, 0x09, 0x80, 0x57, 0xa8, 0x00,
+    0xf8, 0xb5, 0x01, 0x00, 0xe8, 0x9b, 0x02, 0x04, 0x2c, 0x4f, 0x69, 0xc8, 0x75, 0x06, 0xf7, 0x3e,
+    0x32, 0x6c, 0xc2, 0x5f, 0x99, 0xdb, 0x42, 0xc4, 0x04, 0x80, 0xd8, 0xa7, 0x00, 0xd3, 0x5d, 0x37,
+    0x00, 0x6c, 0xa0, 0x02, 0x3c, 0x4a, 0xe5, 0x3e, 0xd9, 0x67, 0xed, 0x57, 0x0f, 0xd8, 0x05, 0x60,
+    0xe6, 0x29, 0x00, 0x84, 0x41, 0xf6, 0x1e, 0x3c, 0xd7, 0x50, 0x45, 0x61, 0x36, 0xf6, 0x7a, 0x18,
+    0xb8, 0x9d, 0x98, 0x55, 0x00, 0x80, 0x85, 0x0a, 0x10, 0x8b, 0x09, 0x04, 0xa0, 0xb6, 0x29, 0x80,
+    0x56, 0xb3, 0x70, 0x30, 0x1d, 0x07, 0x70, 0xce, 0x39, 0xa0, 0x5d, 0xfe, 0x55, 0xe3, 0xfd, 0xb8,
+    0x2c, 0x01, 0x90, 0x79, 0x0a, 0x40, 0x8a, 0xbf, 0x00, 0xe0, 0xf6, 0x29, 0x00, 0x00, 0xf5, 0x26,
+    0x04, 0x7e, 0x66, 0x80, 0xd6, 0x80, 0x00, 0x00, 0xde, 0xa1, 0x02, 0x08, 0x58, 0x25, 0x01, 0xa0,
+    0x71, 0x0a, 0x40, 0xad, 0x15, 0x33, 0x21, 0xdf, 0x99, 0x99, 0xfc, 0xe8, 0xe6, 0x09, 0x9f, 0x65,
+    0x6c, 0x08, 0x01, 0x5c, 0x00, 0xe2, 0x9f, 0x02, 0x54, 0x37, 0x4b, 0x00, 0xb0, 0x83, 0x0a, 0xa0,
+    0x2a, 0x23, 0xc9, 0x65, 0xa7, 0x35, 0x1f, 0x3f, 0x18, 0x0d, 0x80, 0xb9, 0xa7, 0x00, 0x18, 0x1e,
+    0x3b, 0x76, 0x70, 0x5d, 0x0b, 0x6d, 0x05, 0x4a, 0xda, 0xeb, 0x63, 0xc0, 0xd6, 0x61, 0x1b, 0x06,
+    0x00, 0x1e, 0x2a, 0xc0, 0x2e, 0x76, 0x05, 0x80, 0xfa, 0xa6, 0x00, 0xa3, 0xed, 0x21, 0xac, 0xf4,
+    0x1c, 0xa0, 0x41, 0x46, 0xac, 0x35, 0xf9, 0x59, 0x2d, 0x27, 0xe4, 0xe6, 0x01, 0x40, 0xee, 0x29,
+    0x00, 0x28, 0x1e, 0x16, 0x80, 0xfb, 0xa7, 0x00, 0x2e, 0x0c, 0x64, 0x0c, 0x78, 0x9a, 0xf9, 0x31,
+    0xc3, 0x2b, 0x01, 0x78, 0x89, 0x0a, 0xd0, 0xe0, 0xfa, 0x01, 0x80, 0xce, 0x29, 0x00, 0xa6, 0xd2,
+    0x43, 0x82, 0x9c, 0x67, 0x5a, 0xf9, 0x03, 0xe4, 0x29, 0xfc, 0x96, 0xa9, 0x11, 0x64, 0xd3, 0x00,
+    0x88, 0x81, 0x0a, 0x80, 0x5d, 0xe4, 0x05, 0xc0, 0x16, 0x2a, 0xc0, 0xaf, 0xfe, 0x76, 0x9a, 0xbd,
+    0xd6, 0x78, 0x03, 0x89, 0x0b, 0x00, 0x66, 0x9f, 0x02, 0x54, 0x78, 0x77, 0xb8, 0xc1, 0x77, 0x0d,
+    0x83, 0x17, 0xeb, 0x65, 0xaf, 0x97, 0x01, 0xdb, 0x84, 0x9d, 0x0f, 0x00, 0x98, 0xa8, 0x00, 0xc5,
+    0x30, 0x5b, 0x00, 0x6a, 0x9c, 0x02, 0xb4, 0x57, 0x09, 0x5e, 0xd2, 0x75, 0xe0, 0xa5, 0x95, 0x54,
+    0xe4, 0xe3, 0x6f, 0xb5, 0xdb, 0x90, 0x9b, 0x18, 0x00, 0xd9, 0xa7, 0x00, 0x9e, 0x08, 0x34, 0x00,
+    0x6e, 0xa0, 0x02, 0x84, 0x71, 0xf0, 0x24, 0xe0, 0x6b, 0xc6, 0x27, 0x0c, 0x4d, 0x02, 0xe0, 0x2d,
+    0x32, 0xc0, 0x85, 0x85, 0x19, 0x00, 0x5a, 0xa7, 0x00, 0x4b, 0xda, 0xdd, 0x03, 0xf2, 0x1e, 0x30,
+    0x11, 0xd0, 0xed, 0xb0, 0xf0, 0x5d, 0x87, 0xe6, 0x0f, 0xe3, 0x00, 0x20, 0x0e, 0x2a, 0x00, 0x77,
+    0x2f, 0x0e, 0x00, 0x7b, 0xa8, 0x00, 0xc9, 0xd2, 0xb5, 0x77, 0x76, 0x5b, 0xcb, 0x21, 0xe4, 0x4d,
+    0x01, 0x98, 0x7f, 0x0a, 0x10, 0x60, 0x31, 0x08, 0x06, 0xe7, 0xb5, 0xc5, 0x66, 0x76, 0x6e, 0xbd,
+    0x7e, 0x06, 0x6a, 0x09, 0xd6, 0x1b, 0x00, 0xe0, 0x22, 0x03, 0x3c, 0xc3, 0xbe, 0x00, 0xa8, 0x73,
+    0x0a, 0x70, 0xe3, 0x4d, 0x5d, 0x48, 0xdf, 0x81, 0x54, 0x4b, 0xf2, 0x07, 0x8c, 0xdf, 0xd5, 0x6a,
+    0x40, 0x9e, 0x36, 0x00, 0xe4, 0x9f, 0x02, 0x78, 0x62, 0x3b, 0x00, 0xb8, 0x83, 0x0a, 0xa0, 0xc9,
+    0x4c, 0x61, 0x80, 0xb7, 0x19, 0x9e, 0x88, 0xdf, 0x0e, 0x00, 0x7a, 0xa7, 0x00, 0xeb, 0xc9, 0x3b,
+    0x11, 0x72, 0x1f, 0xf0, 0x4c, 0xd0, 0x49, 0xbc, 0xf0, 0x5f, 0x8d, 0x76, 0x0f, 0x87, 0x05, 0x20,
+    0x16, 0x2a, 0x80, 0x78, 0xa7, 0x04, 0x00, 0x9b, 0xa8, 0x00, 0xca, 0x12, 0x90, 0x85, 0xf6, 0x5b,
+    0xbb, 0x2d, 0x64, 0xad, 0x00, 0x98, 0x81, 0x0a, 0x80, 0xdd, 0x50, 0x05, 0x00, 0xef, 0x29, 0x80,
+    0x6f, 0x46, 0x05, 0xbd, 0x9e, 0x06, 0x68, 0xda, 0xe0, 0x03, 0x00, 0x6a, 0x9d, 0x02, 0xfc, 0xf9,
+    0xeb, 0xda, 0xd1, 0x79, 0x40, 0x04, 0x11, 0xae, 0x46, 0xe2, 0x7f, 0x35, 0x1a, 0x8f, 0xdb, 0x02,
+    0x00, 0x19, 0xa8, 0x00, 0xa0, 0xa8, 0x59, 0x00, 0x6e, 0xa1, 0x02, 0x58, 0x13, 0x7a, 0x13, 0xe0,
+    0x6f, 0x66, 0xb7, 0xe2, 0x09, 0x01, 0x80, 0xe6, 0x29, 0xc0, 0x5a, 0x3a, 0xc6, 0x87, 0xfc, 0x07,
+    0x26, 0x29, 0xbc, 0xd9, 0x33, 0x7c, 0x58, 0x9b, 0xbd, 0x63, 0xca, 0x00, 0x88, 0x87, 0x0a, 0xa0,
+    0x5e, 0xc5, 0x05, 0xc0, 0x2e, 0x2a, 0x80, 0xaf, 0xdc, 0x96, 0xa4, 0x1d, 0xd7, 0x66, 0x0d, 0xa1,
+    0x03, 0x00, 0xe6, 0xa0, 0x02, 0x58, 0x57, 0xbb, 0x00, 0xc0, 0x7d, 0x0a, 0x10, 0x1e, 0x0b, 0x1e,
+    0xaf, 0xaf, 0x81, 0x19, 0x39, 0x20, 0x12, 0x80, 0x7a, 0xa7, 0x00, 0xa4, 0x8e, 0xac, 0x69, 0xf4,
+    0x1e, 0xd0, 0x04, 0xa4, 0x16, 0x65, 0xf8, 0x61, 0x66, 0x56, 0x63, 0x19, 0x05, 0x40, 0x0e, 0x2a,
+    0x40, 0x29, 0xcc, 0x0c, 0x80, 0x7b, 0xa8, 0x00, 0x16, 0x85, 0xb8, 0x02, 0x78, 0x9c, 0xc1, 0xd1,
+    0xb8, 0x57, 0x01, 0xa0, 0x7b, 0x0a, 0xf0, 0x8a, 0x15, 0x06, 0x20, 0x07, 0x2a, 0x00, 0x11, 0x19,
+    0x2c, 0x0e, 0x3f, 0xd6, 0x66, 0xe6, 0x00, 0x0d, 0x00, 0x62, 0xa2, 0x02, 0xc8, 0xf7, 0xd3, 0x00,
+    0xb0, 0x8d, 0x0a, 0x50, 0x2a, 0x69, 0xcb, 0x69, 0xcf, 0xb5, 0x57, 0x43, 0x48, 0x13, 0x80, 0x59,
+    0xa8, 0x00, 0xd5, 0x2d, 0x08, 0x00, 0xf0, 0x9f, 0x02, 0xfc, 0xc7, 0xf0, 0xba, 0xeb, 0x6d, 0x20,
+    0xd6, 0x8e, 0xc5, 0x01, 0xa0, 0xe6, 0x29, 0x80, 0x94, 0x35, 0xc8, 0x17, 0xdd, 0x07, 0x16, 0x05,
+    0x29, 0xa0, 0x0f, 0xfe, 0x98, 0x91, 0xb5, 0xf8, 0x9f, 0x00, 0x90, 0x85, 0x0a, 0xc0, 0x8a, 0xc3,
+    0x00, 0xe0, 0x26, 0x2a, 0x80, 0x56, 0xd5, 0x24, 0x00, 0x3e, 0x67, 0x6a, 0x3b, 0xbe, 0x2a, 0x00,
+    0x68, 0x9f, 0x02, 0xa0, 0x22, 0xf4, 0x00, 0xc8, 0x83, 0x0a, 0x50, 0xc6, 0x70, 0xe0, 0xc3, 0x97,
+    0xb5, 0x59, 0x37, 0x0a, 0x16, 0x80, 0xb8, 0xc8, 0x00, 0xfc, 0x0d, 0x0d, 0x00, 0xec, 0xa3, 0x02,
+    0xf4, 0x69, 0x48, 0x8c, 0xda, 0x75, 0x4d, 0xb5, 0x90, 0x6a, 0x02, 0x60, 0x1e, 0x2a, 0x40, 0x75,
+    0x6b, 0x14, 0x00, 0x1c, 0xa8, 0x00, 0x18, 0x02, 0x18, 0xeb, 0xfa, 0x1b, 0x78, 0xd9, 0xc3, 0x82,
+    0x01, 0xa8, 0x7b, 0x0a, 0xd0, 0xde, 0x4f, 0x00, 0x40, 0xff, 0x29, 0x80, 0x45, 0xa4, 0xda, 0x81,
+    0x5f, 0x66, 0x62, 0x24, 0xbe, 0x6f, 0x00, 0xe4, 0xa1, 0x02, 0xd0, 0xc2, 0x54, 0x01, 0xb8, 0x8b,
+    0x0a, 0x00, 0xda, 0xf9, 0x35, 0x80, 0xd7, 0x01, 0x19, 0x90, 0x07, 0x1c, 0x00, 0xfa, 0xa7, 0x00,
+    0xa2, 0x70, 0x18, 0x00, 0x72, 0xa1, 0x02, 0x2c, 0xf2, 0x38, 0x11, 0xf1, 0x67, 0x4d, 0x66, 0x60,
+    0x51, 0x05, 0xc0, 0x46, 0x2a, 0x40, 0x91, 0x8a, 0x37, 0xa9, 0x7d, 0xd7, 0x4a, 0x07, 0xf9, 0x00,
+    0x00, 0x66, 0xa2, 0x02, 0x5c, 0x57, 0xa8, 0x00, 0xc0, 0x83, 0x0a, 0x70, 0xa2, 0x4f, 0x66, 0xae,
+    0xc7, 0x81, 0x56, 0x3f, 0x24, 0x0d, 0x80, 0xda, 0xa7, 0x00, 0xe6, 0xc5, 0x53, 0x00, 0x74, 0xa0,
+    0x02, 0xd0, 0xc4, 0x0e, 0x07, 0xf8, 0x67, 0x00, 0xa6, 0x61, 0x7c, 0x04, 0x40, 0x26, 0x2a, 0x80,
+    0x2f, 0x44, 0x0b, 0x80, 0xdb, 0xa8, 0x00, 0xe8, 0x7d, 0xbc, 0x05, 0xf8, 0x1d, 0x70, 0x09, 0xb9,
+    0x14, 0x01, 0xa0, 0x81, 0x0a, 0xe0, 0x89, 0x40, 0x06, 0x20, 0x1f, 0x2a, 0x00, 0x2e, 0x4f, 0xa9,
+    0x12, 0x9f, 0xd6, 0x62, 0x11, 0x16, 0x2c, 0x00, 0xec, 0xa4, 0x02, 0xe4, 0xa7, 0xe7, 0x7c, 0xda,
+    0x79, 0xad, 0x23, 0x90, 0xc5, 0x04, 0x60, 0x2e, 0x2a, 0x80, 0x76, 0x83, 0x00, 0x00, 0x5c, 0xa8,
+    0x00, 0x2c, 0xda, 0x41, 0xe0, 0xfa, 0x1c, 0x50, 0x0d, 0xa4, 0x22, 0x00, 0xa8, 0x7f, 0x0a, 0x00,
+    0x5e, 0x1e, 0x03, 0x40, 0x0f, 0x2a, 0xc0, 0x55, 0x12, 0xe7, 0x81, 0x9f, 0x06, 0x60, 0x10, 0x7e,
+    0x20, 0x00, 0xe4, 0xa2, 0x02, 0x20, 0xa3, 0x11, 0x00, 0xb8, 0x8f, 0x0c, 0x40, 0x63, 0xb1, 0x91,
+    0x80, 0xe7, 0x81, 0x54, 0x90, 0xa5, 0x06, 0x00, 0x3a, 0xa8, 0x00, 0x9d, 0xd8, 0x3e, 0x00, 0x72,
+    0xa2, 0x02, 0xa8, 0xd3, 0xb3, 0x43, 0xf1, 0x6b, 0x0d, 0xc6, 0x61, 0x2d, 0x00, 0xc0, 0x56, 0x2a,
+    0x00, 0x64, 0x4a, 0x65, 0xa4, 0xbd, 0xd7, 0x28, 0xfc, 0x10, 0x28, 0x00, 0x66, 0xa3, 0x02, 0x7c,
+    0x37, 0x27, 0x01, 0xc0, 0x87, 0x0a, 0x20, 0xa2, 0xf6, 0x81, 0xad, 0xd7, 0x01, 0x13, 0x42, 0x5c,
+    0x13, 0x80, 0x1a, 0xa8, 0x00, 0xdb, 0xd5, 0x0f, 0x00, 0x74, 0xa1, 0x02, 0xf0, 0x45, 0x94, 0x35,
+    0xf8, 0x6b, 0xe0, 0x65, 0x60, 0xa6, 0x06, 0x40, 0x36, 0x32, 0x00, 0xa0, 0x57, 0x7b, 0x03, 0xbe,
+    0x07, 0x44, 0x3e, 0x26, 0x61, 0x00, 0x68, 0xa1, 0x02, 0x78, 0x02, 0x65, 0x00, 0xc8, 0x8b, 0x0a,
+    0x20, 0x52, 0x4b, 0x5c, 0xc5, 0xb7, 0xb5, 0x97, 0x89, 0x6b, 0x12, 0x00, 0x7b, 0xa9, 0x00, 0xbf,
+    0x40, 0x5e, 0x00, 0x76, 0xdf, 0x03, 0xd4, 0x03, 0x11, 0x00, 0x98, 0x8f, 0x0c, 0x60, 0x5e, 0x08,
+    0x02, 0x00, 0x27, 0x2a, 0xc0, 0x81, 0x84, 0x7b, 0xb3, 0x7e, 0x07, 0x42, 0x0a, 0x19, 0x22, 0x00,
+    0xea, 0xa0, 0x02, 0x60, 0x17, 0x78, 0x01, 0xd0, 0x87, 0x0a, 0x20, 0x1a, 0xd5, 0x1b, 0xe1, 0xb7,
+    0x01, 0x17, 0xae, 0x2d, 0xd7, 0x04, 0xde, 0x07, 0x34, 0x39, 0xbe, 0x37, 0x00, 0xe8, 0xa1, 0x02,
+    0x84, 0x42, 0x8f, 0x01, 0xc8, 0x8d, 0x0a, 0xe0, 0xd5, 0xcc, 0xa9, 0xc5, 0xbf, 0xb5, 0x16, 0x8c,
+    0xf9, 0x07, 0x00, 0x9b, 0xa9, 0x00, 0xb6, 0x88, 0x37, 0x00, 0xf6, 0x9f, 0x02, 0xb4, 0x57, 0x9c,
+    0x01, 0xc0, 0x8b, 0x0a, 0x50, 0x9d, 0xcd, 0x04, 0xac, 0xe7, 0x01, 0xcd, 0x42, 0xee, 0x19, 0x80,
+    0x5a, 0xa8, 0x00, 0xd6, 0x3d, 0x3b, 0x00, 0x74, 0xa2, 0x02, 0x10, 0xa7, 0x56, 0x56, 0xf8, 0x6f,
+    0xa0, 0x05, 0xe7, 0x2d, 0xad, 0x81, 0xff, 0x01, 0x87, 0x8c, 0xc7, 0x03, 0x00, 0x9a, 0xa8, 0x00,
+    0xa7, 0x78, 0x3d, 0x00, 0xf2, 0x23, 0x03, 0x80, 0x36, 0x98, 0x79, 0xf1, 0x71, 0x4d, 0x85, 0xe3,
+    0x67, 0x06, 0xc0, 0x6e, 0x2a, 0x40, 0x2b, 0x30, 0x04, 0x80, 0x1d, 0xa8, 0x00, 0xf6, 0x95, 0x3c,
+    0x00, 0x70, 0xa3, 0x02, 0xe8, 0x45, 0xb1, 0xb4, 0xea, 0x7b, 0x00, 0xb2, 0x90, 0xd4, 0x03, 0xa0,
+    0x1e, 0x2a, 0x40, 0x75, 0xfd, 0x05, 0x00, 0xbd, 0xc8, 0x00, 0xe1, 0x01, 0x5f, 0x19, 0x7e, 0x1c,
+    0x60, 0xc9, 0x77, 0xda, 0x00, 0xe0, 0x81, 0x0a, 0xa0, 0x62, 0x79, 0x05, 0x80, 0x2e, 0x32, 0x80,
+    0x79, 0xd1, 0x2f, 0x18, 0x3f, 0xd7, 0x4e, 0x3e, 0xce, 0x3c, 0x00, 0x6c, 0xa7, 0x02, 0x9c, 0x02,
+    0x68, 0x01, 0xd8, 0x83, 0x0a, 0x00, 0x60, 0x17, 0x01, 0x00, 0x3f, 0x2a, 0xc0, 0x38, 0x4c, 0x03,
+    0x80, 0xde, 0xa7, 0x00, 0x08, 0x69, 0x13, 0x00, 0x6a, 0xa2, 0x02, 0xdc, 0x07, 0xe1, 0x72, 0xf8,
+    0x73, 0x40, 0xa5, 0xde, 0x35, 0x01, 0x80, 0x0f, 0x2a, 0x40, 0x8c, 0x45, 0x46, 0x18, 0x5f, 0xd7,
+    0x46, 0x42, 0x3e, 0x13, 0x00, 0xec, 0x27, 0x03, 0x88, 0x02, 0xca, 0x00, 0xd8, 0x85, 0x0a, 0xa0,
+    0xe0, 0x64, 0x05, 0x00, 0x47, 0x2a, 0x80, 0x36, 0xb8, 0x16, 0x80, 0xfe, 0xa7, 0x00, 0x05, 0xa1,
+    0x5a, 0x00, 0xea, 0xa2, 0x02, 0x04, 0x08, 0x49, 0x7e, 0xf8, 0x75, 0xe0, 0x34, 0x5e, 0x10, 0x06,
+    0x80, 0x17, 0x2a, 0x80, 0xa0, 0xe7, 0x18, 0x18, 0x7f, 0xd7, 0x3c, 0x9f, 0x98, 0x0a, 0x00, 0xf6,
+    0xa1, 0x02, 0x50, 0xf8, 0xa8, 0x00, 0xc0, 0x93, 0x0a, 0xf0, 0x0c, 0x83, 0x03, 0xa0, 0x07, 0x2a,
+    0xc0, 0x3f, 0x7c, 0x0c, 0x80, 0xda, 0xa8, 0x00, 0x00, 0x4a, 0xdd, 0x23, 0xfe, 0x1d, 0x18, 0x75,
+    0xd7, 0xf8, 0x00, 0xe0, 0x87, 0x0a, 0xd0, 0x6d, 0x70, 0xc3, 0xc5, 0xe7, 0xb5, 0x8b, 0x27, 0xb0,
+    0x14, 0x80, 0x9d, 0xa8, 0x00, 0x1f, 0x3e, 0x6e, 0x00, 0x70, 0xa5, 0x02, 0x14, 0xe3, 0x55, 0x00,
+    0xe8, 0x83, 0x0a, 0x90, 0x0f, 0x9d, 0x00, 0xa0, 0x3e, 0x32, 0x00, 0x7b, 0x30, 0xee, 0x89, 0x9f,
+    0x07, 0x3e, 0xd9, 0xa5, 0x1b, 0x00, 0x78, 0xa2, 0x02, 0x20, 0x9a, 0x61, 0x53, 0xf1, 0x7b, 0x8d,
+    0x01, 0x8a, 0x9f, 0x02, 0x60, 0x2f, 0x2a, 0x40, 0x8a, 0x59, 0x10, 0x00, 0x7c, 0xa9, 0x00, 0xbc,
+    0x40, 0x63, 0x00, 0x7a, 0xa1, 0x02, 0x10, 0x67, 0x53, 0xb2, 0xf8, 0x7b, 0x20, 0x63, 0xdd, 0x94,
+    0x06, 0x80, 0x2f, 0x2a, 0xc0, 0x80, 0xdf, 0x0c, 0x00, 0xdf, 0xa7, 0x00, 0xa4, 0xc8, 0x00, 0x00,
+    0x76, 0x23, 0x03, 0xc8, 0x78, 0x51, 0x00, 0xc0, 0x99, 0x0c, 0x30, 0x0b, 0x04, 0x04, 0xa0, 0x1f,
+    0x2a, 0x40, 0x5c, 0xae, 0xb8, 0x8c, 0xdf, 0x07, 0x1e, 0xd4, 0x6d, 0x46, 0x00, 0x78, 0x23, 0x03,
+    0xe4, 0x37, 0x34, 0x00, 0xf0, 0x7f, 0x0a, 0xb0, 0x0a, 0xcf, 0x01, 0xa0, 0x27, 0x32, 0x40, 0x3a,
+    0x72, 0x10, 0x80, 0xff, 0xa7, 0x00, 0xf1, 0x65, 0x57, 0x00, 0x7c, 0xa0, 0x02, 0x7c, 0xa3, 0x74,
+    0x00, 0xf8, 0x81, 0x0a, 0x90, 0xde, 0x16, 0x03, 0xc0, 0x0f, 0x2a, 0x40, 0x35, 0x54, 0x1a, 0x80,
+    0x3f, 0xa8, 0x00, 0xe3, 0x9d, 0x0b, 0x00, 0x7c, 0xa1, 0x02, 0x2c, 0xa3, 0x15, 0x01, 0xf8, 0x85,
+    0x0a, 0xd0, 0xdd, 0x64, 0x05, 0xc0, 0x1f, 0x2a, 0x40, 0x30, 0x6e, 0x08, 0x80, 0x7f, 0xa8, 0x00,
+    0xda, 0x65, 0x30, 0x00, 0x7c, 0xa2, 0x02, 0xdc, 0xc2, 0xba, 0x01, 0xf8, 0x89, 0x0a, 0x70, 0x5d,
+    0xa4, 0x00, 0xc0, 0x2f, 0x32, 0xc0, 0x2b, 0xca, 0x12, 0x80, 0xbf, 0xc8, 0x00
+};
+
+#endif /* ECLIPSE_INFO_MODERN_COMPACT_H */
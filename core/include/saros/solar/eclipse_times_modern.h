@@ -32,13 +32,17 @@
 #  define ECLIPSE_ATTR           /* nothing */
 #endif
 
+#ifndef ECLIPSE_CONST
+#  define ECLIPSE_CONST          const   /* constexpr under SarosCatalog.h */
+#endif
+
 #define ECLIPSE_MODERN_COUNT       4612u
 #define ECLIPSE_MODERN_SAROS_FIRST 110u
 #define ECLIPSE_MODERN_SAROS_LAST  173u
 
 /* eclipse_times_modern[] — sorted int64_t timestamps, 8 bytes each.
  * Size: 36,896 bytes */
-static const uint8_t eclipse_times_modern[36896u] ECLIPSE_ATTR = {
+static ECLIPSE_CONST uint8_t eclipse_times_modern[36896u] ECLIPSE_ATTR = {
     0xfd, 0x06, 0xab, 0xee, 0xf4, 0xff, 0xff, 0xff, 0x2d, 0xdc, 0x94, 0x10, 0xf5, 0xff, 0xff, 0xff,
     0x01, 0xb3, 0x7e, 0x32, 0xf5, 0xff, 0xff, 0xff, 0x1a, 0x3a, 0x67, 0x54, 0xf5, 0xff, 0xff, 0xff,
     0x9e, 0xa0, 0xee, 0x68, 0xf5, 0xff, 0xff, 0xff, 0x5d, 0x14, 0x51, 0x76, 0xf5, 0xff, 0xff, 0xff,
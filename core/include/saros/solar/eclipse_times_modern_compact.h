@@ -0,0 +1,1202 @@
+/*
+ * Auto-generated by build_compact_db.py — DO NOT EDIT
+ *
+ * Sorted timestamps, frame-of-reference packed in blocks of 32.
+ * Saros range : 110–173
+ * Eclipses    : 4612
+ * Flash usage : 18,340 bytes (17.9 KB)
+ *
+ * Usage: #define SAROS_USE_COMPACT in the solar implementation unit, which
+ * then includes this header instead of the raw one.  ECLIPSE_USE_PROGMEM
+ * works as for the raw headers.
+ */
+
+#ifndef ECLIPSE_TIMES_MODERN_COMPACT_H
+#define ECLIPSE_TIMES_MODERN_COMPACT_H
+
+#include <stdint.h>
+
+#ifdef ECLIPSE_USE_PROGMEM
+#  include <avr/pgmspace.h>
+#  define ECLIPSE_READ_BYTE(p)   pgm_read_byte(p)
+#  define ECLIPSE_READ_WORD(p)   pgm_read_word(p)
+#  define ECLIPSE_READ_DWORD(p)  pgm_read_dword(p)
+#  define ECLIPSE_ATTR           PROGMEM
+#else
+#  define ECLIPSE_READ_BYTE(p)   (*(const uint8_t  *)(p))
+#  define ECLIPSE_READ_WORD(p)   (*(const uint16_t *)(p))
+#  define ECLIPSE_READ_DWORD(p)  (*(const uint32_t *)(p))
+#  define ECLIPSE_ATTR           /* nothing */
+#endif
+
+#define ECLIPSE_MODERN_COUNT       4612u
+#define ECLIPSE_MODERN_SAROS_FIRST 110u
+#define ECLIPSE_MODERN_SAROS_LAST  173u
+#define ECLIPSE_MODERN_BLOCK_SIZE  32u
+#define ECLIPSE_MODERN_BLOCKS      145u
+
+/* eclipse_times_modern_base[] — int64_t time of the first eclipse of each block (skip index).
+ * Size: 1,160 bytes */
+static const uint8_t eclipse_times_modern_base[1160u] ECLIPSE_ATTR = {
+    0xfd, 0x06, 0xab, 0xee, 0xf4, 0xff, 0xff, 0xff, 0xaa, 0xd3, 0xb4, 0x63, 0xf6, 0xff, 0xff, 0xff,
+    0x64, 0xc5, 0x44, 0x0d, 0xf7, 0xff, 0xff, 0xff, 0x37, 0x08, 0xec, 0x94, 0xf7, 0xff, 0xff, 0xff,
+    0x53, 0xd5, 0xb7, 0x02, 0xf8, 0xff, 0xff, 0xff, 0xeb, 0x44, 0xb0, 0x6e, 0xf8, 0xff, 0xff, 0xff,
+    0x03, 0xa8, 0x22, 0xc6, 0xf8, 0xff, 0xff, 0xff, 0xf1, 0x9b, 0xc7, 0x0b, 0xf9, 0xff, 0xff, 0xff,
+    0xf4, 0x92, 0x85, 0x50, 0xf9, 0xff, 0xff, 0xff, 0x69, 0x90, 0x1c, 0x8e, 0xf9, 0xff, 0xff, 0xff,
+    0x84, 0xef, 0xa2, 0xc3, 0xf9, 0xff, 0xff, 0xff, 0x52, 0xe5, 0x41, 0xf8, 0xf9, 0xff, 0xff, 0xff,
+    0xf8, 0x70, 0x4a, 0x2a, 0xfa, 0xff, 0xff, 0xff, 0xe2, 0x8e, 0x15, 0x5d, 0xfa, 0xff, 0xff, 0xff,
+    0xb9, 0xaa, 0xe1, 0x88, 0xfa, 0xff, 0xff, 0xff, 0xb7, 0x29, 0x5b, 0xb6, 0xfa, 0xff, 0xff, 0xff,
+    0x38, 0xfd, 0x3d, 0xe1, 0xfa, 0xff, 0xff, 0xff, 0x09, 0xa8, 0xcc, 0x0d, 0xfb, 0xff, 0xff, 0xff,
+    0xfa, 0x76, 0xad, 0x38, 0xfb, 0xff, 0xff, 0xff, 0xea, 0x5f, 0xbd, 0x61, 0xfb, 0xff, 0xff, 0xff,
+    0x23, 0xd6, 0xcd, 0x8a, 0xfb, 0xff, 0xff, 0xff, 0x72, 0x88, 0xf3, 0xb2, 0xfb, 0xff, 0xff, 0xff,
+    0x18, 0xbb, 0x2d, 0xda, 0xfb, 0xff, 0xff, 0xff, 0x46, 0x9c, 0xbe, 0xff, 0xfb, 0xff, 0xff, 0xff,
+    0x60, 0xfe, 0xfa, 0x26, 0xfc, 0xff, 0xff, 0xff, 0x62, 0xaf, 0x37, 0x4e, 0xfc, 0xff, 0xff, 0xff,
+    0x20, 0x35, 0xdd, 0x72, 0xfc, 0xff, 0xff, 0xff, 0x52, 0x1c, 0x46, 0x98, 0xfc, 0xff, 0xff, 0xff,
+    0xc9, 0xf3, 0x18, 0xbb, 0xfc, 0xff, 0xff, 0xff, 0x8c, 0xcb, 0x02, 0xdd, 0xfc, 0xff, 0xff, 0xff,
+    0xa9, 0xa1, 0xec, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0x97, 0x76, 0xd6, 0x20, 0xfd, 0xff, 0xff, 0xff,
+    0xbf, 0x78, 0xcd, 0x42, 0xfd, 0xff, 0xff, 0xff, 0x63, 0x37, 0xce, 0x63, 0xfd, 0xff, 0xff, 0xff,
+    0xa3, 0xd1, 0x37, 0x82, 0xfd, 0xff, 0xff, 0xff, 0x6b, 0x1e, 0x92, 0x9f, 0xfd, 0xff, 0xff, 0xff,
+    0x0c, 0xd7, 0x3f, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0x23, 0x0f, 0xed, 0xd6, 0xfd, 0xff, 0xff, 0xff,
+    0x3b, 0x69, 0x9a, 0xf2, 0xfd, 0xff, 0xff, 0xff, 0x3a, 0x9b, 0x32, 0x0f, 0xfe, 0xff, 0xff, 0xff,
+    0xb7, 0x4e, 0xe0, 0x2a, 0xfe, 0xff, 0xff, 0xff, 0x18, 0x3b, 0xa3, 0x45, 0xfe, 0xff, 0xff, 0xff,
+    0x06, 0x5c, 0x7e, 0x5f, 0xfe, 0xff, 0xff, 0xff, 0xb3, 0x7a, 0x2c, 0x7b, 0xfe, 0xff, 0xff, 0xff,
+    0x77, 0xf3, 0x06, 0x95, 0xfe, 0xff, 0xff, 0xff, 0xb1, 0x4c, 0xca, 0xaf, 0xfe, 0xff, 0xff, 0xff,
+    0x6c, 0x64, 0x8e, 0xca, 0xfe, 0xff, 0xff, 0xff, 0xaf, 0x73, 0x8f, 0xe4, 0xfe, 0xff, 0xff, 0xff,
+    0x22, 0x67, 0x80, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0x44, 0xe4, 0x44, 0x18, 0xff, 0xff, 0xff, 0xff,
+    0x93, 0x2b, 0x08, 0x33, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x2c, 0xcd, 0x4d, 0xff, 0xff, 0xff, 0xff,
+    0x42, 0xd3, 0xa6, 0x67, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe4, 0x6b, 0x82, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0x9d, 0x6c, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x19, 0x3e, 0x46, 0xb6, 0xff, 0xff, 0xff, 0xff,
+    0xb2, 0x07, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x15, 0x34, 0xfc, 0xe9, 0xff, 0xff, 0xff, 0xff,
+    0x9e, 0x4b, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x18, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0xad, 0x66, 0x1a, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xc7, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0xa4, 0x8c, 0x72, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1a, 0x3a, 0x8e, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0x5b, 0x14, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x13, 0xd9, 0xc2, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0xeb, 0xd9, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x6e, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0x6a, 0x61, 0x12, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x64, 0x26, 0x2d, 0x01, 0x00, 0x00, 0x00,
+    0x94, 0xf7, 0xff, 0x46, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x5f, 0xda, 0x60, 0x01, 0x00, 0x00, 0x00,
+    0xc4, 0x30, 0xf2, 0x79, 0x01, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xe3, 0x92, 0x01, 0x00, 0x00, 0x00,
+    0x05, 0x03, 0xd5, 0xab, 0x01, 0x00, 0x00, 0x00, 0xd5, 0xd1, 0xdb, 0xc3, 0x01, 0x00, 0x00, 0x00,
+    0x4b, 0xc7, 0xf3, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x07, 0x65, 0xfa, 0xf4, 0x01, 0x00, 0x00, 0x00,
+    0x59, 0x38, 0x12, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x63, 0x4c, 0x19, 0x26, 0x02, 0x00, 0x00, 0x00,
+    0xf5, 0x9b, 0x48, 0x3e, 0x02, 0x00, 0x00, 0x00, 0xde, 0xd9, 0x65, 0x55, 0x02, 0x00, 0x00, 0x00,
+    0x31, 0x9d, 0x93, 0x6d, 0x02, 0x00, 0x00, 0x00, 0xdb, 0xc6, 0x9a, 0x85, 0x02, 0x00, 0x00, 0x00,
+    0xf1, 0xb7, 0xc9, 0x9d, 0x02, 0x00, 0x00, 0x00, 0x04, 0x50, 0xba, 0xb6, 0x02, 0x00, 0x00, 0x00,
+    0x61, 0xe4, 0x14, 0xcd, 0x02, 0x00, 0x00, 0x00, 0x88, 0xe0, 0x1b, 0xe5, 0x02, 0x00, 0x00, 0x00,
+    0x16, 0xc8, 0x0c, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x7f, 0xa8, 0x24, 0x17, 0x03, 0x00, 0x00, 0x00,
+    0x57, 0xbe, 0x2b, 0x2f, 0x03, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x43, 0x48, 0x03, 0x00, 0x00, 0x00,
+    0xa6, 0xe1, 0x1d, 0x62, 0x03, 0x00, 0x00, 0x00, 0x2f, 0x82, 0x0e, 0x7b, 0x03, 0x00, 0x00, 0x00,
+    0x8d, 0x30, 0x00, 0x94, 0x03, 0x00, 0x00, 0x00, 0xa9, 0xa3, 0x00, 0xae, 0x03, 0x00, 0x00, 0x00,
+    0x9b, 0x2c, 0xdb, 0xc7, 0x03, 0x00, 0x00, 0x00, 0xd8, 0x79, 0xb6, 0xe1, 0x03, 0x00, 0x00, 0x00,
+    0xd6, 0x62, 0xa6, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x96, 0x57, 0x54, 0x16, 0x04, 0x00, 0x00, 0x00,
+    0x12, 0xba, 0x18, 0x31, 0x04, 0x00, 0x00, 0x00, 0xaa, 0x66, 0xaf, 0x4d, 0x04, 0x00, 0x00, 0x00,
+    0x11, 0x8f, 0x5d, 0x69, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x5b, 0x0b, 0x85, 0x04, 0x00, 0x00, 0x00,
+    0x12, 0xc3, 0xb8, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x3a, 0x98, 0x4f, 0xbd, 0x04, 0x00, 0x00, 0x00,
+    0x11, 0x4a, 0xc0, 0xd9, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x61, 0x40, 0xf7, 0x04, 0x00, 0x00, 0x00,
+    0xc2, 0xcd, 0xab, 0x15, 0x05, 0x00, 0x00, 0x00, 0x03, 0xc5, 0xee, 0x33, 0x05, 0x00, 0x00, 0x00,
+    0xac, 0x84, 0x6f, 0x51, 0x05, 0x00, 0x00, 0x00, 0x85, 0x4f, 0xb2, 0x6f, 0x05, 0x00, 0x00, 0x00,
+    0x0c, 0x97, 0x1d, 0x8e, 0x05, 0x00, 0x00, 0x00, 0xd3, 0xc1, 0x49, 0xad, 0x05, 0x00, 0x00, 0x00,
+    0x2a, 0xe4, 0xb4, 0xcb, 0x05, 0x00, 0x00, 0x00, 0xa0, 0x83, 0xe1, 0xea, 0x05, 0x00, 0x00, 0x00,
+    0xe9, 0x56, 0xe2, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x66, 0x7e, 0x1f, 0x2c, 0x06, 0x00, 0x00, 0x00,
+    0x86, 0x2e, 0x20, 0x4d, 0x06, 0x00, 0x00, 0x00, 0x3f, 0xc6, 0x1f, 0x6e, 0x06, 0x00, 0x00, 0x00,
+    0xcc, 0xb2, 0x20, 0x8f, 0x06, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x0a, 0xb1, 0x06, 0x00, 0x00, 0x00,
+    0x85, 0x4e, 0xf4, 0xd2, 0x06, 0x00, 0x00, 0x00, 0x27, 0x0c, 0xb1, 0xf6, 0x06, 0x00, 0x00, 0x00,
+    0x0a, 0x96, 0x19, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x83, 0x85, 0xaa, 0x41, 0x07, 0x00, 0x00, 0x00,
+    0x84, 0xc1, 0xe6, 0x68, 0x07, 0x00, 0x00, 0x00, 0x29, 0x44, 0x0c, 0x91, 0x07, 0x00, 0x00, 0x00,
+    0x35, 0xed, 0xef, 0xbb, 0x07, 0x00, 0x00, 0x00, 0x13, 0x12, 0x52, 0xea, 0x07, 0x00, 0x00, 0x00,
+    0x5e, 0x72, 0x9e, 0x19, 0x08, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x3c, 0x4e, 0x08, 0x00, 0x00, 0x00,
+    0xbd, 0x49, 0x44, 0x80, 0x08, 0x00, 0x00, 0x00, 0x6d, 0xba, 0xb6, 0xb6, 0x08, 0x00, 0x00, 0x00,
+    0x6d, 0xfd, 0x27, 0xed, 0x08, 0x00, 0x00, 0x00, 0x65, 0xbc, 0xec, 0x28, 0x09, 0x00, 0x00, 0x00,
+    0xc6, 0x85, 0x99, 0x65, 0x09, 0x00, 0x00, 0x00, 0x69, 0xd3, 0x1b, 0xa4, 0x09, 0x00, 0x00, 0x00,
+    0x43, 0x15, 0x1c, 0xe6, 0x09, 0x00, 0x00, 0x00, 0x76, 0x3a, 0xc3, 0x2b, 0x0a, 0x00, 0x00, 0x00,
+    0x42, 0xc0, 0xd2, 0x75, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0xd9, 0x1e, 0xc6, 0x0a, 0x00, 0x00, 0x00,
+    0x06, 0xb2, 0x63, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x19, 0x11, 0x93, 0x9a, 0x0b, 0x00, 0x00, 0x00,
+    0x06, 0xd4, 0x42, 0xb7, 0x0c, 0x00, 0x00, 0x00
+};
+
+/* eclipse_times_modern_frame[] — uint32 per block: payload byte offset << 8 | offset width.
+ * Size: 580 bytes */
+static const uint8_t eclipse_times_modern_frame[580u] ECLIPSE_ATTR = {
+    0x21, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x20, 0xfc, 0x00, 0x00, 0x1f, 0x78, 0x01, 0x00,
+    0x1f, 0xf1, 0x01, 0x00, 0x1f, 0x6a, 0x02, 0x00, 0x1f, 0xe3, 0x02, 0x00, 0x1f, 0x5c, 0x03, 0x00,
+    0x1e, 0xd5, 0x03, 0x00, 0x1e, 0x4a, 0x04, 0x00, 0x1e, 0xbf, 0x04, 0x00, 0x1e, 0x34, 0x05, 0x00,
+    0x1e, 0xa9, 0x05, 0x00, 0x1e, 0x1e, 0x06, 0x00, 0x1e, 0x93, 0x06, 0x00, 0x1e, 0x08, 0x07, 0x00,
+    0x1e, 0x7d, 0x07, 0x00, 0x1e, 0xf2, 0x07, 0x00, 0x1e, 0x67, 0x08, 0x00, 0x1e, 0xdc, 0x08, 0x00,
+    0x1e, 0x51, 0x09, 0x00, 0x1e, 0xc6, 0x09, 0x00, 0x1e, 0x3b, 0x0a, 0x00, 0x1e, 0xb0, 0x0a, 0x00,
+    0x1e, 0x25, 0x0b, 0x00, 0x1e, 0x9a, 0x0b, 0x00, 0x1e, 0x0f, 0x0c, 0x00, 0x1e, 0x84, 0x0c, 0x00,
+    0x1e, 0xf9, 0x0c, 0x00, 0x1e, 0x6e, 0x0d, 0x00, 0x1e, 0xe3, 0x0d, 0x00, 0x1e, 0x58, 0x0e, 0x00,
+    0x1e, 0xcd, 0x0e, 0x00, 0x1d, 0x42, 0x0f, 0x00, 0x1d, 0xb3, 0x0f, 0x00, 0x1d, 0x24, 0x10, 0x00,
+    0x1d, 0x95, 0x10, 0x00, 0x1d, 0x06, 0x11, 0x00, 0x1d, 0x77, 0x11, 0x00, 0x1d, 0xe8, 0x11, 0x00,
+    0x1d, 0x59, 0x12, 0x00, 0x1d, 0xca, 0x12, 0x00, 0x1d, 0x3b, 0x13, 0x00, 0x1d, 0xac, 0x13, 0x00,
+    0x1d, 0x1d, 0x14, 0x00, 0x1d, 0x8e, 0x14, 0x00, 0x1d, 0xff, 0x14, 0x00, 0x1d, 0x70, 0x15, 0x00,
+    0x1d, 0xe1, 0x15, 0x00, 0x1d, 0x52, 0x16, 0x00, 0x1d, 0xc3, 0x16, 0x00, 0x1d, 0x34, 0x17, 0x00,
+    0x1d, 0xa5, 0x17, 0x00, 0x1d, 0x16, 0x18, 0x00, 0x1d, 0x87, 0x18, 0x00, 0x1d, 0xf8, 0x18, 0x00,
+    0x1d, 0x69, 0x19, 0x00, 0x1d, 0xda, 0x19, 0x00, 0x1d, 0x4b, 0x1a, 0x00, 0x1d, 0xbc, 0x1a, 0x00,
+    0x1d, 0x2d, 0x1b, 0x00, 0x1d, 0x9e, 0x1b, 0x00, 0x1d, 0x0f, 0x1c, 0x00, 0x1d, 0x80, 0x1c, 0x00,
+    0x1d, 0xf1, 0x1c, 0x00, 0x1d, 0x62, 0x1d, 0x00, 0x1d, 0xd3, 0x1d, 0x00, 0x1d, 0x44, 0x1e, 0x00,
+    0x1d, 0xb5, 0x1e, 0x00, 0x1d, 0x26, 0x1f, 0x00, 0x1d, 0x97, 0x1f, 0x00, 0x1d, 0x08, 0x20, 0x00,
+    0x1d, 0x79, 0x20, 0x00, 0x1d, 0xea, 0x20, 0x00, 0x1d, 0x5b, 0x21, 0x00, 0x1d, 0xcc, 0x21, 0x00,
+    0x1d, 0x3d, 0x22, 0x00, 0x1d, 0xae, 0x22, 0x00, 0x1d, 0x1f, 0x23, 0x00, 0x1d, 0x90, 0x23, 0x00,
+    0x1d, 0x01, 0x24, 0x00, 0x1d, 0x72, 0x24, 0x00, 0x1d, 0xe3, 0x24, 0x00, 0x1d, 0x54, 0x25, 0x00,
+    0x1d, 0xc5, 0x25, 0x00, 0x1d, 0x36, 0x26, 0x00, 0x1d, 0xa7, 0x26, 0x00, 0x1d, 0x18, 0x27, 0x00,
+    0x1d, 0x89, 0x27, 0x00, 0x1d, 0xfa, 0x27, 0x00, 0x1d, 0x6b, 0x28, 0x00, 0x1d, 0xdc, 0x28, 0x00,
+    0x1d, 0x4d, 0x29, 0x00, 0x1d, 0xbe, 0x29, 0x00, 0x1d, 0x2f, 0x2a, 0x00, 0x1d, 0xa0, 0x2a, 0x00,
+    0x1d, 0x11, 0x2b, 0x00, 0x1d, 0x82, 0x2b, 0x00, 0x1d, 0xf3, 0x2b, 0x00, 0x1d, 0x64, 0x2c, 0x00,
+    0x1d, 0xd5, 0x2c, 0x00, 0x1d, 0x46, 0x2d, 0x00, 0x1d, 0xb7, 0x2d, 0x00, 0x1d, 0x28, 0x2e, 0x00,
+    0x1d, 0x99, 0x2e, 0x00, 0x1d, 0x0a, 0x2f, 0x00, 0x1d, 0x7b, 0x2f, 0x00, 0x1d, 0xec, 0x2f, 0x00,
+    0x1d, 0x5d, 0x30, 0x00, 0x1d, 0xce, 0x30, 0x00, 0x1d, 0x3f, 0x31, 0x00, 0x1d, 0xb0, 0x31, 0x00,
+    0x1d, 0x21, 0x32, 0x00, 0x1d, 0x92, 0x32, 0x00, 0x1d, 0x03, 0x33, 0x00, 0x1d, 0x74, 0x33, 0x00,
+    0x1d, 0xe5, 0x33, 0x00, 0x1e, 0x56, 0x34, 0x00, 0x1e, 0xcb, 0x34, 0x00, 0x1e, 0x40, 0x35, 0x00,
+    0x1e, 0xb5, 0x35, 0x00, 0x1e, 0x2a, 0x36, 0x00, 0x1e, 0x9f, 0x36, 0x00, 0x1e, 0x14, 0x37, 0x00,
+    0x1e, 0x89, 0x37, 0x00, 0x1e, 0xfe, 0x37, 0x00, 0x1e, 0x73, 0x38, 0x00, 0x1e, 0xe8, 0x38, 0x00,
+    0x1e, 0x5d, 0x39, 0x00, 0x1e, 0xd2, 0x39, 0x00, 0x1e, 0x47, 0x3a, 0x00, 0x1e, 0xbc, 0x3a, 0x00,
+    0x1e, 0x31, 0x3b, 0x00, 0x1e, 0xa6, 0x3b, 0x00, 0x1e, 0x1b, 0x3c, 0x00, 0x1e, 0x90, 0x3c, 0x00,
+    0x1e, 0x05, 0x3d, 0x00, 0x1e, 0x7a, 0x3d, 0x00, 0x1f, 0xef, 0x3d, 0x00, 0x1f, 0x68, 0x3e, 0x00,
+    0x1f, 0xe1, 0x3e, 0x00, 0x1f, 0x5a, 0x3f, 0x00, 0x1f, 0xd3, 0x3f, 0x00, 0x21, 0x4c, 0x40, 0x00,
+    0x1e, 0xcc, 0x40, 0x00
+};
+
+/* eclipse_times_modern_packed[] — per block, the offsets of eclipses 1..31 from the block's
+ * base, LSB-first at the block's width; each block starts on a byte.
+ * Size: 16,600 bytes */
+static const uint8_t eclipse_times_modern_packed[16600u] ECLIPSE_ATTR = {
+    0x30, 0xd5, 0xe9, 0x21, 0x08, 0x58, 0xa7, 0x87, 0x74, 0xcc, 0xf0, 0x96, 0x09, 0xcd, 0x1c, 0xd2,
+    0x03, 0xd6, 0x60, 0x7a, 0x28, 0x0d, 0x5d, 0xd9, 0x51, 0xca, 0x58, 0x0b, 0xa7, 0x6f, 0xf4, 0xc7,
+    0x54, 0x4b, 0xb7, 0xb4, 0xb0, 0xf6, 0x5d, 0x2e, 0x7c, 0x35, 0x17, 0xe7, 0x2d, 0x73, 0x41, 0xf4,
+    0x94, 0xf6, 0xcd, 0x0f, 0x00, 0x4e, 0xa9, 0xe8, 0xe4, 0xdc, 0xe9, 0xe8, 0x58, 0x3b, 0x7f, 0x2d,
+    0x44, 0x7a, 0x84, 0x7b, 0xe9, 0x01, 0xc5, 0x85, 0x1f, 0x12, 0x0e, 0xc3, 0x30, 0x3d, 0x0c, 0xf5,
+    0x86, 0xb3, 0xe8, 0xd8, 0x34, 0x3d, 0xd2, 0x5f, 0x32, 0x5f, 0x25, 0xe1, 0x83, 0x4d, 0xcc, 0xfb,
+    0x5a, 0x2d, 0x9c, 0x11, 0x21, 0xbd, 0x45, 0x6f, 0xc9, 0xc6, 0x99, 0x76, 0xb9, 0x7f, 0x4c, 0x4d,
+    0x7c, 0x24, 0xd2, 0x5a, 0x65, 0xae, 0x16, 0xb6, 0xc6, 0xde, 0xf4, 0xac, 0xf5, 0x4d, 0xb3, 0x5b,
+    0x02, 0x70, 0xe8, 0x00, 0x38, 0x9e, 0x24, 0x07, 0x44, 0xdc, 0x4a, 0x0e, 0x98, 0xff, 0x86, 0x14,
+    0xfe, 0x3f, 0xad, 0x1b, 0x60, 0xdd, 0xe9, 0x21, 0xb0, 0x3a, 0xd2, 0x22, 0x87, 0x7b, 0x0e, 0x29,
+    0x7b, 0xa0, 0x34, 0x30, 0x67, 0xd6, 0x70, 0x36, 0x74, 0x16, 0x97, 0x3d, 0x83, 0xb9, 0xd3, 0x43,
+    0x29, 0x06, 0xbc, 0x44, 0xe5, 0x08, 0xf7, 0x4a, 0xe5, 0x14, 0x1d, 0x52, 0x9f, 0x5b, 0x59, 0x58,
+    0x3c, 0x9d, 0x7f, 0x5f, 0xa5, 0x42, 0xbc, 0x65, 0xb3, 0x81, 0xa4, 0x66, 0xe4, 0xe8, 0xe0, 0x6c,
+    0x0b, 0xdd, 0x06, 0x74, 0x6c, 0x32, 0x43, 0x7a, 0xd1, 0x49, 0x2d, 0x7b, 0xf8, 0x76, 0x69, 0x81,
+    0x37, 0x1b, 0xa6, 0x87, 0x09, 0x50, 0x8e, 0x88, 0xe8, 0xc9, 0xca, 0x8e, 0x47, 0xa7, 0xf0, 0x95,
+    0x73, 0x08, 0x2d, 0x9c, 0x24, 0x16, 0x17, 0x9d, 0xfe, 0x51, 0x53, 0xa3, 0xb9, 0x2e, 0xe8, 0x00,
+    0xa3, 0xb9, 0x24, 0x07, 0x19, 0x82, 0x4a, 0x0e, 0xc8, 0xeb, 0x86, 0x14, 0x4c, 0xf1, 0x70, 0x15,
+    0x80, 0x3c, 0xad, 0x1b, 0x31, 0xd4, 0xe9, 0x21, 0xf3, 0x00, 0xd2, 0x22, 0x61, 0x9b, 0x0e, 0x29,
+    0x96, 0x50, 0x34, 0x30, 0x6a, 0xbf, 0x70, 0x36, 0xbd, 0xbe, 0x5a, 0x37, 0xc3, 0x19, 0x97, 0x3d,
+    0x48, 0xa6, 0xd3, 0x43, 0x2f, 0xd5, 0xbb, 0x44, 0x8c, 0x7c, 0xf8, 0x4a, 0x6e, 0x47, 0xe2, 0x4b,
+    0x6f, 0x21, 0x1e, 0x52, 0x9b, 0x91, 0x5a, 0x58, 0x4c, 0x8d, 0x44, 0x59, 0x6f, 0xf7, 0x80, 0x5f,
+    0x54, 0xa3, 0x69, 0x60, 0x87, 0x75, 0xbd, 0x65, 0x89, 0xab, 0xa5, 0x66, 0x7b, 0x5d, 0xe2, 0x6c,
+    0xcc, 0x06, 0xcc, 0x6d, 0xfe, 0xf3, 0x07, 0x74, 0x08, 0x62, 0x44, 0x7a, 0xc6, 0x5c, 0x2e, 0x7b,
+    0x60, 0xd5, 0x6a, 0x81, 0x94, 0x6d, 0x53, 0x82, 0x2e, 0x41, 0xe8, 0x00, 0x38, 0x7d, 0x92, 0x03,
+    0x0a, 0xa1, 0x03, 0x82, 0xad, 0x50, 0xc9, 0xb1, 0xdc, 0x6e, 0x48, 0x99, 0x58, 0x87, 0xab, 0xac,
+    0xc0, 0xb5, 0x6e, 0x62, 0xea, 0x2b, 0x39, 0xd1, 0xca, 0xe9, 0xa1, 0xdf, 0x0d, 0x69, 0x11, 0x48,
+    0xb6, 0x43, 0xaa, 0xad, 0x08, 0x3f, 0xe5, 0xaf, 0x45, 0x03, 0x13, 0xf5, 0xf5, 0x88, 0x15, 0xea,
+    0xc2, 0xd9, 0x36, 0x7b, 0xb5, 0x6e, 0x72, 0x4d, 0x97, 0x3d, 0xf8, 0xdf, 0x3f, 0x5f, 0x00, 0xe5,
+    0xf4, 0xd0, 0xfe, 0x7e, 0x97, 0x48, 0x62, 0x8b, 0xaf, 0xcc, 0x42, 0x10, 0x5f, 0x0a, 0xc7, 0x78,
+    0x48, 0x55, 0x17, 0x11, 0xa6, 0x9b, 0x85, 0x5a, 0x58, 0xe2, 0x48, 0xa2, 0x2c, 0x56, 0x4a, 0xe0,
+    0x77, 0x77, 0x31, 0x0d, 0x5c, 0xae, 0xd5, 0x5b, 0x46, 0xb1, 0x2e, 0x35, 0x47, 0x47, 0x8a, 0xb3,
+    0x01, 0xd2, 0x3b, 0x3c, 0x86, 0x43, 0x45, 0x93, 0x83, 0x69, 0x20, 0x1e, 0xa3, 0x4e, 0x53, 0xac,
+    0x01, 0x73, 0xf3, 0x39, 0xd9, 0x5a, 0x3c, 0xa4, 0xb4, 0x4e, 0x6d, 0x67, 0x1c, 0xd1, 0x87, 0x35,
+    0x10, 0x4d, 0xff, 0x20, 0x8a, 0x3a, 0xf4, 0x10, 0x6e, 0x30, 0x09, 0x8a, 0x9b, 0xe0, 0x21, 0xc5,
+    0x80, 0x0f, 0xe6, 0x12, 0x04, 0x59, 0x7a, 0x8d, 0xfa, 0x1e, 0xd6, 0x48, 0x10, 0xe0, 0x6c, 0x7f,
+    0xc6, 0xc3, 0x3b, 0xee, 0x3b, 0x56, 0x1e, 0x47, 0x49, 0xba, 0x50, 0xbe, 0x47, 0x7a, 0x58, 0x8d,
+    0xe9, 0xa0, 0x44, 0x83, 0xc6, 0x57, 0x26, 0xfa, 0x2a, 0x41, 0x4b, 0xf3, 0x69, 0xa2, 0xfd, 0x95,
+    0x71, 0xd7, 0xe0, 0xeb, 0x2c, 0xec, 0x89, 0x62, 0x6b, 0x77, 0x2a, 0xcb, 0xd2, 0xeb, 0xa6, 0x05,
+    0xf8, 0x75, 0xdb, 0x97, 0x26, 0x27, 0x24, 0xf0, 0x96, 0x01, 0x7c, 0x2c, 0xea, 0x80, 0x69, 0x0a,
+    0x1e, 0x43, 0x13, 0x99, 0xc9, 0x41, 0x9c, 0xe8, 0x01, 0xd1, 0xb1, 0x2f, 0xd6, 0x10, 0xcf, 0x59,
+    0x72, 0x48, 0x75, 0x7b, 0x4e, 0xae, 0x97, 0x0f, 0x29, 0x15, 0xaa, 0x71, 0x15, 0x44, 0x30, 0x62,
+    0x8d, 0xb6, 0x59, 0xeb, 0x26, 0xac, 0x3a, 0x3d, 0xf4, 0x89, 0x3f, 0x2d, 0x52, 0xcc, 0x2e, 0x41,
+    0xd5, 0xff, 0x40, 0xa4, 0xa0, 0x22, 0xf2, 0x53, 0x04, 0xce, 0x4c, 0x2f, 0xa6, 0x86, 0x1a, 0xd8,
+    0x0d, 0x28, 0x62, 0xcd, 0xb9, 0x35, 0xce, 0x76, 0x8d, 0xb6, 0x75, 0xdb, 0x9c, 0x71, 0xe5, 0x9d,
+    0xd9, 0x5c, 0xf6, 0x92, 0x53, 0xa7, 0x87, 0x7d, 0xc5, 0xbd, 0x44, 0x2e, 0xcf, 0x07, 0x25, 0x16,
+    0x87, 0xbe, 0x12, 0xa5, 0x5b, 0x7c, 0xb9, 0xe3, 0x69, 0x13, 0x95, 0x15, 0xf7, 0x90, 0xc6, 0xef,
+    0xc9, 0x4f, 0x01, 0x66, 0x2c, 0xe9, 0x00, 0x84, 0x62, 0xe9, 0x80, 0x8c, 0x68, 0xc9, 0xc1, 0xa1,
+    0xd4, 0x01, 0x31, 0xda, 0x93, 0x8f, 0xb0, 0x29, 0x0c, 0x4f, 0xec, 0x64, 0x2c, 0x39, 0xd2, 0x60,
+    0x6a, 0x1e, 0xae, 0xff, 0x86, 0x14, 0x23, 0xcb, 0xb8, 0xca, 0x55, 0x91, 0x96, 0xa5, 0xf2, 0x96,
+    0x75, 0x93, 0x57, 0x50, 0xc9, 0x09, 0xf0, 0x44, 0xf3, 0x64, 0xc7, 0xa1, 0x87, 0xac, 0x77, 0xa3,
+    0x45, 0x37, 0x33, 0xbb, 0xa3, 0x97, 0x10, 0x87, 0x54, 0xcf, 0xc9, 0x7d, 0xca, 0x79, 0x37, 0x5c,
+    0x75, 0xad, 0xa0, 0xbc, 0x5a, 0xc8, 0x9c, 0x81, 0x21, 0xb7, 0x76, 0xc4, 0x90, 0xe6, 0xde, 0x6c,
+    0x89, 0x21, 0x5a, 0xb7, 0x9b, 0x5f, 0x21, 0x5c, 0xc3, 0xa0, 0x65, 0x2f, 0xe1, 0xdb, 0xcf, 0x27,
+    0x63, 0x27, 0x05, 0x4c, 0xb0, 0x91, 0x1e, 0xd6, 0x6f, 0xee, 0x12, 0x01, 0xec, 0xfc, 0x52, 0x05,
+    0x39, 0x04, 0x1e, 0xc3, 0x93, 0xa5, 0xc9, 0x21, 0xfd, 0xdd, 0x01, 0x11, 0x41, 0x87, 0xc7, 0x10,
+    0x53, 0x14, 0x6b, 0x94, 0x12, 0xd1, 0x4a, 0xc2, 0x14, 0x3e, 0x27, 0xd6, 0x96, 0x87, 0x94, 0x4f,
+    0xac, 0xed, 0x8c, 0xa0, 0xf1, 0xb0, 0x66, 0x8d, 0xeb, 0x92, 0xf3, 0x77, 0x70, 0x01, 0x22, 0x34,
+    0x04, 0x08, 0x9d, 0x07, 0xa7, 0x87, 0x1a, 0x97, 0x79, 0x4e, 0x15, 0xdf, 0x25, 0xa8, 0x97, 0x31,
+    0x88, 0xd4, 0xa7, 0x32, 0x7e, 0x4a, 0x39, 0x48, 0xcc, 0x35, 0xc3, 0xc5, 0xf4, 0x42, 0xfa, 0xaa,
+    0x81, 0xd9, 0x2d, 0x78, 0xd2, 0x80, 0xcc, 0x11, 0x6b, 0xcb, 0x62, 0x71, 0xb6, 0x07, 0x90, 0xe2,
+    0x9d, 0xe8, 0x68, 0x2b, 0x2f, 0x08, 0x27, 0xd0, 0x97, 0xe4, 0x0c, 0x20, 0x8c, 0x1d, 0x53, 0x17,
+    0x46, 0x16, 0x4e, 0x0f, 0x01, 0xf9, 0xa2, 0x68, 0x44, 0xdc, 0x6f, 0x54, 0x21, 0x84, 0xc3, 0x63,
+    0x7c, 0xbd, 0x92, 0x1c, 0x51, 0x16, 0x8e, 0xcb, 0x33, 0x0e, 0x1e, 0xe3, 0xbe, 0x13, 0xd6, 0xec,
+    0x70, 0x27, 0x47, 0x1b, 0xca, 0xb4, 0x92, 0x28, 0x4e, 0xe7, 0x74, 0xea, 0x0e, 0x8f, 0x95, 0x2d,
+    0x66, 0x67, 0x2e, 0xbc, 0xc3, 0x1a, 0xa6, 0x47, 0xeb, 0x76, 0xf9, 0xc9, 0xf2, 0xe5, 0x1f, 0x59,
+    0x80, 0x13, 0x54, 0xff, 0x60, 0x06, 0x77, 0x7a, 0x98, 0x10, 0x27, 0x65, 0x3a, 0x5e, 0xee, 0x9c,
+    0x40, 0x03, 0x26, 0xe8, 0x16, 0xa3, 0x43, 0x0a, 0x0a, 0x7e, 0xd7, 0x66, 0x37, 0x88, 0xb9, 0x1e,
+    0x0e, 0x4b, 0xef, 0x72, 0xe9, 0xec, 0xcc, 0x35, 0xea, 0x49, 0x4b, 0x1a, 0x1c, 0xd6, 0xd4, 0xb2,
+    0xda, 0x7a, 0xe9, 0xda, 0xf0, 0x4e, 0xd6, 0xd7, 0xca, 0x03, 0x54, 0x6c, 0x7f, 0x03, 0x19, 0x49,
+    0x1a, 0x61, 0xdf, 0x21, 0x55, 0xf8, 0xe4, 0xf2, 0x18, 0x0e, 0x00, 0x25, 0xc7, 0x86, 0x50, 0xa9,
+    0x92, 0x1e, 0xe7, 0xb8, 0xc8, 0x42, 0xe3, 0x31, 0x4f, 0x6c, 0x61, 0x0d, 0x8c, 0x56, 0x72, 0x44,
+    0x5d, 0x39, 0x2b, 0x85, 0x3f, 0x72, 0x4e, 0x75, 0x93, 0x86, 0x94, 0x82, 0x48, 0x01, 0x16, 0xc2,
+    0x02, 0x8f, 0xb1, 0x1b, 0x62, 0x67, 0xf2, 0x26, 0x2c, 0xdf, 0x70, 0x3f, 0x05, 0xa8, 0xeb, 0xee,
+    0x0f, 0x0e, 0x3a, 0xa2, 0x87, 0xf9, 0xe6, 0x67, 0x65, 0x9d, 0x6a, 0x94, 0x89, 0x64, 0xa9, 0x73,
+    0x3a, 0x00, 0x95, 0xa0, 0xb4, 0x7b, 0x0d, 0x29, 0xc7, 0x6f, 0x23, 0x2b, 0x86, 0x6f, 0xd7, 0x0a,
+    0x27, 0x85, 0xb9, 0x70, 0xf8, 0x49, 0x6f, 0x7e, 0xc8, 0xec, 0x0c, 0xe2, 0xd6, 0x49, 0x03, 0x57,
+    0x05, 0xea, 0x40, 0x1a, 0x24, 0x1a, 0x31, 0x28, 0x3a, 0x55, 0xf4, 0xe1, 0xef, 0x18, 0x59, 0x97,
+    0x0f, 0x88, 0x7d, 0xe2, 0xe3, 0x82, 0x09, 0x88, 0xc7, 0x04, 0x3c, 0x89, 0x35, 0x73, 0x10, 0x4c,
+    0x8e, 0x6e, 0xd5, 0x72, 0x14, 0x1a, 0x52, 0x2b, 0x99, 0x0c, 0x78, 0x4e, 0x6b, 0xb7, 0x88, 0x54,
+    0xf9, 0x3a, 0x5c, 0xb5, 0xfa, 0x12, 0x8f, 0x45, 0xc1, 0x69, 0x67, 0x7c, 0xb5, 0xc4, 0xda, 0xaa,
+    0x5d, 0xeb, 0xd6, 0x98, 0x68, 0x01, 0x96, 0xa2, 0x03, 0x84, 0x36, 0xce, 0xe9, 0xe1, 0xfe, 0xf5,
+    0xb4, 0xf8, 0xfe, 0x25, 0x65, 0xa2, 0xd7, 0xf5, 0x9c, 0x11, 0xcb, 0x25, 0x28, 0x4f, 0x5a, 0x7e,
+    0x0a, 0xbc, 0x94, 0xd7, 0xca, 0x8a, 0x89, 0xb9, 0x57, 0x0e, 0x4c, 0xaf, 0x6e, 0x7c, 0x0d, 0xac,
+    0x5b, 0x52, 0x3b, 0x03, 0xe9, 0xdb, 0xe8, 0x00, 0x71, 0xe5, 0x74, 0xf0, 0x80, 0xbc, 0x2b, 0xa4,
+    0x28, 0xf0, 0x18, 0xbc, 0x50, 0x25, 0x07, 0xb7, 0xe2, 0x03, 0xf2, 0xdb, 0x85, 0x8f, 0x6c, 0x67,
+    0x85, 0x35, 0x7b, 0xcd, 0x4b, 0x0e, 0x6d, 0x29, 0xcd, 0x43, 0x64, 0xeb, 0x01, 0x89, 0xef, 0x74,
+    0x4e, 0x18, 0x51, 0x88, 0x14, 0x6c, 0x2a, 0x5c, 0xb5, 0x6d, 0x44, 0x74, 0x89, 0x5e, 0x10, 0x6b,
+    0x3d, 0x4f, 0xad, 0x9b, 0xda, 0xb5, 0x25, 0x27, 0xdc, 0x0d, 0xd8, 0x69, 0x06, 0x00, 0x84, 0x1a,
+    0xd3, 0xe9, 0xe1, 0x19, 0xab, 0xb4, 0x18, 0x84, 0xd6, 0x3b, 0x1a, 0x71, 0x96, 0x92, 0xe8, 0xdb,
+    0x25, 0x28, 0x59, 0xc9, 0x43, 0x0a, 0x6f, 0x95, 0x9f, 0x3e, 0xe6, 0x88, 0xab, 0xb4, 0x1f, 0x4b,
+    0x6f, 0x47, 0x6a, 0x0d, 0xbc, 0x25, 0xe7, 0x11, 0x03, 0x56, 0x84, 0x7e, 0xc3, 0x14, 0x65, 0x1a,
+    0xd1, 0x44, 0x1f, 0x55, 0x3c, 0x81, 0xf1, 0x18, 0x2e, 0x90, 0x25, 0x87, 0x8c, 0x53, 0xa9, 0x82,
+    0x51, 0xea, 0xb8, 0x30, 0x2e, 0xe0, 0x31, 0x9d, 0x33, 0x62, 0x0d, 0x60, 0x52, 0x38, 0x94, 0x89,
+    0xb1, 0x1c, 0x11, 0xcf, 0xcf, 0x4a, 0x06, 0xad, 0x9e, 0x53, 0xc0, 0xb9, 0x21, 0x25, 0x30, 0x72,
+    0x80, 0xc5, 0xb4, 0xc1, 0x63, 0x58, 0x98, 0xda, 0x19, 0x26, 0xe2, 0xb0, 0x86, 0xa1, 0xc5, 0xf2,
+    0x41, 0xe5, 0x5b, 0x80, 0x01, 0xb3, 0xff, 0x20, 0x91, 0x75, 0x7a, 0x58, 0xac, 0x85, 0x56, 0xd6,
+    0x81, 0x4d, 0x99, 0xae, 0xcc, 0x3b, 0x27, 0x98, 0x8a, 0x09, 0xaa, 0x70, 0xf6, 0x90, 0xde, 0x42,
+    0x3c, 0xb2, 0x55, 0x86, 0x78, 0xad, 0xf0, 0x72, 0x98, 0x6b, 0x4b, 0xc1, 0xf4, 0x02, 0x30, 0xcb,
+    0xe9, 0x00, 0x9c, 0xaa, 0x74, 0x00, 0xdd, 0xd5, 0x2b, 0x58, 0x86, 0x96, 0x0e, 0xcc, 0xd9, 0x25,
+    0x87, 0x3d, 0xc8, 0x03, 0x12, 0x8a, 0x94, 0x8f, 0xc0, 0x0f, 0x89, 0x27, 0xea, 0x58, 0xcc, 0xca,
+    0xa6, 0xc0, 0x92, 0x53, 0x75, 0x5b, 0xf3, 0x80, 0x85, 0x79, 0x40, 0x5b, 0x8f, 0x08, 0xd1, 0x56,
+    0xc5, 0x21, 0xf5, 0xcb, 0x20, 0x57, 0x75, 0x24, 0x6a, 0x59, 0xcf, 0xd4, 0x44, 0xd7, 0x5e, 0x88,
+    0x0b, 0x86, 0x69, 0xdb, 0xba, 0xdd, 0x20, 0x5d, 0x72, 0x65, 0x6f, 0x80, 0x5d, 0xad, 0xb5, 0x9a,
+    0xb7, 0x32, 0x35, 0xf5, 0x25, 0x57, 0xa7, 0x87, 0x59, 0x9a, 0xd3, 0xa2, 0x33, 0x20, 0xef, 0x18,
+    0xb0, 0x72, 0x4a, 0x3e, 0xf0, 0x3d, 0x96, 0xe3, 0xaf, 0x0f, 0x29, 0x3e, 0x3c, 0x7e, 0x4a, 0x85,
+    0x31, 0xae, 0x02, 0xc0, 0x04, 0xea, 0x40, 0x78, 0x2b, 0x1a, 0x01, 0x6f, 0x37, 0x55, 0xfc, 0x48,
+    0xf0, 0x18, 0x5c, 0x4a, 0x26, 0x87, 0x06, 0x35, 0xa9, 0x72, 0x8b, 0xfb, 0xb8, 0xb4, 0x26, 0xe1,
+    0x31, 0xbb, 0x7e, 0x62, 0x4d, 0x00, 0xf8, 0x92, 0xa3, 0xf8, 0xb5, 0x1c, 0x5d, 0x2c, 0xd4, 0x4a,
+    0x36, 0x16, 0x9e, 0x53, 0x72, 0x26, 0x22, 0x25, 0xe9, 0x0f, 0x57, 0x7d, 0x40, 0x1e, 0x60, 0x3c,
+    0x4d, 0xf1, 0x98, 0x19, 0x8f, 0x76, 0x66, 0xb2, 0x4d, 0xac, 0x9d, 0xf0, 0xb4, 0x6e, 0xe2, 0x6b,
+    0x2d, 0x5f, 0xd6, 0xa8, 0x05, 0x08, 0xdc, 0x0c, 0x10, 0xaa, 0x57, 0xa7, 0x87, 0x01, 0xce, 0xd3,
+    0xa2, 0x8b, 0x9d, 0x94, 0xa9, 0x1e, 0xd5, 0x73, 0xaa, 0x7c, 0x97, 0xa0, 0x52, 0x21, 0x10, 0xe9,
+    0x2d, 0x60, 0x7e, 0xea, 0x05, 0xeb, 0xc8, 0x02, 0x5f, 0xa8, 0xe8, 0x40, 0x0c, 0xb1, 0x74, 0x10,
+    0xcd, 0xc3, 0x2b, 0xc8, 0x9c, 0xee, 0x18, 0xdb, 0x68, 0x25, 0x07, 0x02, 0x97, 0x03, 0x82, 0x80,
+    0x8f, 0x8f, 0xd0, 0x20, 0x85, 0x27, 0xaf, 0xe7, 0x77, 0x8c, 0x12, 0x67, 0x58, 0xd3, 0x5f, 0xa9,
+    0xe4, 0x90, 0x9c, 0xd4, 0x3c, 0x47, 0x9a, 0x1d, 0x90, 0x96, 0x71, 0xe7, 0x94, 0x11, 0x6f, 0x48,
+    0xa1, 0x86, 0xc4, 0x55, 0x7a, 0x2b, 0x5a, 0x16, 0x8b, 0x06, 0xd1, 0xd5, 0x0d, 0x2c, 0xac, 0x21,
+    0xb1, 0xb6, 0x6e, 0x24, 0x2e, 0x96, 0x9c, 0x15, 0x1e, 0x60, 0xf7, 0x06, 0x9d, 0xe6, 0xcd, 0x3c,
+    0xfc, 0x83, 0x00, 0xc4, 0xe9, 0x61, 0xfc, 0xa1, 0xb4, 0xc8, 0x6a, 0xc8, 0x3b, 0x32, 0x69, 0x98,
+    0x92, 0x29, 0x6f, 0x25, 0x68, 0x13, 0xd1, 0x43, 0x2a, 0x29, 0x82, 0x9f, 0x02, 0x66, 0x3f, 0xe8,
+    0x80, 0x8f, 0xba, 0xdf, 0x40, 0x6f, 0x89, 0x46, 0x28, 0x6d, 0x46, 0x15, 0xc4, 0x1d, 0x3c, 0x06,
+    0x30, 0x29, 0xc9, 0x51, 0xe2, 0x4c, 0xaa, 0x74, 0xa2, 0x37, 0x2e, 0xb5, 0x22, 0x78, 0x4c, 0xa9,
+    0x4a, 0x58, 0x53, 0x3b, 0xb1, 0xe4, 0x90, 0xe1, 0x26, 0x47, 0xf7, 0xb0, 0xb4, 0x12, 0x5a, 0x4a,
+    0xe7, 0x64, 0xa0, 0x77, 0x48, 0x69, 0x2f, 0xc3, 0x55, 0x58, 0x1a, 0x06, 0xd8, 0xed, 0x2c, 0x3c,
+    0x26, 0x50, 0x99, 0x9d, 0x55, 0xd2, 0x0d, 0x6b, 0x77, 0x25, 0xad, 0x9b, 0x7c, 0x19, 0xcb, 0xf7,
+    0xa2, 0x64, 0x01, 0x3a, 0x5f, 0xfc, 0x83, 0x75, 0xd9, 0xe9, 0xe1, 0x02, 0x83, 0xb4, 0xc8, 0xfe,
+    0x8b, 0x56, 0xb6, 0x94, 0x49, 0x99, 0x40, 0x74, 0x3b, 0x67, 0xe8, 0x79, 0x09, 0xea, 0x35, 0xe8,
+    0x90, 0x02, 0x94, 0x07, 0xe9, 0x40, 0x80, 0xd3, 0x74, 0x70, 0x16, 0xc5, 0x2b, 0xec, 0xdd, 0x98,
+    0x0e, 0x0c, 0x89, 0x23, 0x47, 0xa8, 0xa2, 0x03, 0x92, 0xd7, 0x6f, 0x8f, 0x4c, 0x44, 0x85, 0x27,
+    0x7d, 0x9f, 0xca, 0x0a, 0x6f, 0xff, 0x57, 0x73, 0x91, 0xa7, 0xe4, 0xb0, 0xe9, 0xcd, 0x3c, 0x70,
+    0x38, 0x1d, 0xd0, 0x49, 0xc2, 0x41, 0xf4, 0x58, 0x63, 0x48, 0x0d, 0x96, 0xc0, 0x55, 0x71, 0xe6,
+    0x58, 0x16, 0x2c, 0xed, 0xd0, 0xd5, 0xea, 0xbd, 0x82, 0xe1, 0x60, 0x0a, 0x6b, 0x6f, 0x37, 0xac,
+    0x9b, 0x1e, 0x54, 0x25, 0x27, 0x50, 0xfb, 0xd7, 0xb5, 0x95, 0xa1, 0x79, 0x60, 0x8c, 0xe8, 0xe1,
+    0xac, 0x5f, 0xb4, 0xe8, 0x42, 0xbd, 0x3b, 0x86, 0x3e, 0x93, 0x92, 0xa8, 0xb6, 0x8e, 0xa5, 0xff,
+    0x55, 0x43, 0x7a, 0xef, 0x85, 0x9f, 0x02, 0x42, 0x54, 0xea, 0xc0, 0x56, 0xe8, 0x74, 0xc0, 0xea,
+    0x90, 0x46, 0x44, 0xae, 0x4d, 0x15, 0x70, 0x8d, 0x3c, 0x46, 0x58, 0x8a, 0xc9, 0x01, 0xad, 0x01,
+    0x81, 0x08, 0xd3, 0x3c, 0x2e, 0x40, 0x2c, 0x79, 0xcc, 0x41, 0x79, 0x58, 0xa3, 0xae, 0xcb, 0xe4,
+    0x4c, 0x83, 0xd3, 0x3c, 0x81, 0x9c, 0xcb, 0x91, 0xef, 0x4d, 0xad, 0x64, 0x99, 0xe5, 0x39, 0x1d,
+    0xbf, 0x22, 0x52, 0xc8, 0x74, 0x71, 0x15, 0x75, 0xf2, 0x96, 0xc5, 0xc5, 0x19, 0x8f, 0x45, 0xdf,
+    0x69, 0x67, 0xdd, 0xdd, 0xc4, 0x1a, 0xf2, 0x73, 0xeb, 0x86, 0x9e, 0x7b, 0xc9, 0x21, 0x69, 0x59,
+    0x80, 0x8f, 0x61, 0x01, 0x21, 0xe4, 0x74, 0x7a, 0x88, 0x43, 0x42, 0x2d, 0x56, 0xcd, 0xf5, 0x8e,
+    0xa6, 0xee, 0x52, 0x26, 0x0d, 0x4b, 0xcf, 0x49, 0xff, 0x66, 0x82, 0x02, 0xf7, 0x12, 0xea, 0xc0,
+    0xec, 0x46, 0x1a, 0xe1, 0x76, 0x31, 0x55, 0x1c, 0x2f, 0xef, 0x18, 0x30, 0xa5, 0x26, 0xc7, 0xd9,
+    0xb2, 0x03, 0xd2, 0x52, 0x58, 0xaa, 0x20, 0x7c, 0x3c, 0x2e, 0x4c, 0x47, 0x78, 0xcc, 0x4a, 0xa4,
+    0x58, 0x03, 0x93, 0xb6, 0xe4, 0xbc, 0x8f, 0xd6, 0x3c, 0x31, 0x93, 0xcb, 0x51, 0x82, 0x15, 0xad,
+    0x24, 0xee, 0xec, 0x39, 0xb9, 0xd2, 0x1e, 0x52, 0xd9, 0xa4, 0x71, 0x95, 0x1d, 0x11, 0x3c, 0x96,
+    0x85, 0xb4, 0x9d, 0xe5, 0xfe, 0x0e, 0x6b, 0x44, 0x09, 0xae, 0x1b, 0x74, 0xd7, 0x25, 0x37, 0x50,
+    0xce, 0xf2, 0xbd, 0x11, 0x5c, 0x80, 0x25, 0x69, 0x00, 0x61, 0xe5, 0x6f, 0x7a, 0x88, 0x41, 0x3f,
+    0x2d, 0x2a, 0x98, 0xf2, 0x8e, 0x96, 0xed, 0x52, 0xa6, 0x75, 0x3a, 0xcf, 0xd9, 0xda, 0x59, 0x82,
+    0x02, 0xf4, 0x2a, 0xe8, 0xc0, 0xb5, 0xb7, 0xdf, 0x70, 0xa2, 0x87, 0x46, 0xc0, 0x9a, 0x46, 0x15,
+    0xfc, 0xe5, 0x3b, 0x86, 0xe9, 0x33, 0xc9, 0x81, 0x0f, 0xef, 0x80, 0xa8, 0xf3, 0x93, 0x2a, 0x28,
+    0xa7, 0x8d, 0xcb, 0xc5, 0x0c, 0x1e, 0xb3, 0xc0, 0x10, 0xd6, 0xb4, 0x0d, 0x2c, 0x39, 0xe8, 0xa3,
+    0xc9, 0x11, 0xc6, 0x27, 0xad, 0x54, 0x0b, 0xd2, 0x39, 0xc5, 0x7a, 0x1d, 0x52, 0xa4, 0xbc, 0x70,
+    0x95, 0x68, 0x93, 0x01, 0x76, 0xf7, 0x04, 0x8f, 0x81, 0x52, 0x67, 0x67, 0x8d, 0x09, 0xc3, 0xda,
+    0xbb, 0x57, 0xeb, 0x96, 0x53, 0x5f, 0xc9, 0xc9, 0x2a, 0xb1, 0x7c, 0x9f, 0x44, 0x16, 0x20, 0xdb,
+    0xbe, 0x3f, 0xf8, 0xf6, 0x9c, 0x1e, 0xc6, 0x0a, 0x48, 0x8b, 0xa4, 0xac, 0x68, 0xe5, 0x35, 0x93,
+    0x94, 0xa9, 0xa8, 0xb7, 0x73, 0x02, 0x50, 0xf8, 0xe8, 0x80, 0xd2, 0xc0, 0x74, 0x90, 0xab, 0x92,
+    0x46, 0x34, 0xf0, 0x46, 0x15, 0xd4, 0x5b, 0x3c, 0x46, 0xa5, 0x49, 0xc9, 0xa1, 0x72, 0xf2, 0x80,
+    0x64, 0x21, 0xe3, 0x23, 0x48, 0xc9, 0x8d, 0xcb, 0xe6, 0x2d, 0x1e, 0x53, 0x74, 0x14, 0xd6, 0x74,
+    0xd8, 0x2d, 0x39, 0x05, 0xe1, 0x34, 0xcf, 0x40, 0x9e, 0x72, 0xf4, 0xf3, 0x45, 0x2b, 0x49, 0x0c,
+    0x78, 0x4e, 0x56, 0x18, 0x87, 0x14, 0x2e, 0x63, 0x5c, 0x25, 0x91, 0xa0, 0x65, 0xc1, 0xb3, 0xc1,
+    0x63, 0x27, 0x62, 0xda, 0x19, 0xc4, 0xc7, 0xb0, 0x26, 0xa6, 0xde, 0xba, 0x49, 0xa9, 0x58, 0x72,
+    0xb1, 0x74, 0x2b, 0xdf, 0x54, 0x47, 0x05, 0xd8, 0x96, 0xe4, 0x0f, 0xe6, 0xee, 0xa1, 0x87, 0xdc,
+    0x80, 0xd1, 0x22, 0xd9, 0xdd, 0xee, 0xf8, 0x8d, 0x1b, 0x65, 0x02, 0x3e, 0xb2, 0xea, 0x40, 0xea,
+    0xdb, 0x74, 0x20, 0x96, 0xd7, 0x2b, 0x2c, 0x4b, 0x9c, 0x0e, 0x03, 0x1f, 0x3c, 0xc6, 0xf1, 0xbe,
+    0xc9, 0x11, 0xe3, 0xf9, 0x80, 0x3c, 0xe6, 0xe6, 0x23, 0x28, 0x35, 0xe3, 0x89, 0x4f, 0x34, 0x1e,
+    0xa3, 0xe3, 0x29, 0xd6, 0xc4, 0x7a, 0x31, 0x39, 0x88, 0x56, 0x35, 0x8f, 0xf5, 0xf9, 0x07, 0xf4,
+    0xc3, 0x84, 0x10, 0x81, 0xf9, 0x7a, 0x4e, 0x00, 0xad, 0x88, 0xd4, 0x8a, 0x5c, 0x5c, 0x75, 0x26,
+    0xc3, 0x65, 0x19, 0x07, 0x12, 0x5d, 0xe9, 0x0b, 0xdb, 0x59, 0x2b, 0x30, 0xb1, 0x96, 0x73, 0xde,
+    0xba, 0xa5, 0x60, 0x60, 0x72, 0x4a, 0x26, 0x81, 0x9d, 0x01, 0xc3, 0x9a, 0xb7, 0x54, 0x16, 0x10,
+    0x42, 0x21, 0xa7, 0x87, 0xc4, 0x8c, 0xd4, 0x62, 0x36, 0x4f, 0xef, 0xd8, 0xff, 0x74, 0x4a, 0x02,
+    0x60, 0x19, 0x95, 0x82, 0x4d, 0xf8, 0xdf, 0xe0, 0x9a, 0x89, 0x46, 0x54, 0x78, 0x4a, 0x15, 0x0c,
+    0x2e, 0x3c, 0x06, 0xbc, 0x72, 0x34, 0xa2, 0x1b, 0xb8, 0x9b, 0xa0, 0x6e, 0x95, 0x2a, 0x36, 0x39,
+    0x8e, 0x0b, 0x18, 0x39, 0x1e, 0x03, 0x3f, 0x13, 0xd6, 0xe8, 0xcd, 0xde, 0x3f, 0xfa, 0x99, 0xe1,
+    0x10, 0x6e, 0x9a, 0x72, 0x44, 0xbd, 0x51, 0x2b, 0x71, 0xf7, 0x75, 0x4e, 0xf0, 0xf2, 0x33, 0xd6,
+    0xbf, 0x6d, 0xc7, 0x95, 0x55, 0x6d, 0x80, 0x69, 0x1d, 0xc4, 0x63, 0xd0, 0x1b, 0xda, 0x99, 0xe5,
+    0xfc, 0xb0, 0xc6, 0x1b, 0xa6, 0xd5, 0x59, 0xc4, 0x0a, 0x79, 0x03, 0x85, 0x2d, 0x9f, 0x61, 0x8a,
+    0x05, 0x38, 0x50, 0x04, 0x10, 0x22, 0x39, 0xa7, 0x87, 0xce, 0xf6, 0x7e, 0x24, 0x77, 0x69, 0x5a,
+    0x69, 0x80, 0x27, 0x65, 0x02, 0xb5, 0xa7, 0xe9, 0x40, 0x89, 0xd0, 0xdf, 0x90, 0x5f, 0x8e, 0x46,
+    0xc4, 0x58, 0x4b, 0x15, 0xf5, 0x9c, 0x3b, 0xc6, 0xb0, 0x97, 0xc9, 0x11, 0xc1, 0xe9, 0x80, 0x00,
+    0x9f, 0x94, 0x2a, 0xc2, 0x05, 0x8f, 0x4b, 0x3e, 0xf8, 0x1d, 0xc3, 0x3b, 0x28, 0xd6, 0x24, 0xe7,
+    0x2b, 0x39, 0xe1, 0x56, 0xe1, 0x10, 0x8b, 0xcb, 0x72, 0xa4, 0x08, 0x44, 0x2b, 0x49, 0xde, 0x79,
+    0x4e, 0x78, 0x8e, 0x87, 0xd4, 0x18, 0x57, 0x5c, 0x95, 0xc2, 0x7d, 0x80, 0xcd, 0x67, 0xc0, 0x63,
+    0x40, 0xfb, 0xda, 0x59, 0x7e, 0xe5, 0xb0, 0xd6, 0x8a, 0xdb, 0xba, 0x05, 0xeb, 0x5c, 0x72, 0x64,
+    0x73, 0x2c, 0x1f, 0xb5, 0xc1, 0x05, 0xa8, 0x5a, 0xff, 0x0f, 0x0a, 0x0b, 0xa7, 0x87, 0xd9, 0x84,
+    0xd3, 0x62, 0x76, 0x46, 0x5a, 0xa9, 0xe1, 0x2a, 0x65, 0x02, 0xfb, 0xb3, 0xe8, 0x40, 0xf7, 0xe1,
+    0x74, 0x60, 0x78, 0xbb, 0x2b, 0x88, 0x33, 0x49, 0x15, 0x5e, 0x22, 0x3c, 0xc6, 0x7f, 0x42, 0xc9,
+    0xa1, 0xb7, 0xf9, 0x80, 0xb8, 0x9f, 0xe0, 0x23, 0xad, 0xb5, 0xe2, 0xc9, 0xaf, 0x9a, 0xe3, 0x62,
+    0x80, 0x85, 0xc7, 0x48, 0x6f, 0x85, 0x35, 0x2f, 0x9a, 0x4b, 0x0e, 0x3f, 0x2c, 0xcd, 0x03, 0x81,
+    0xe7, 0x01, 0x15, 0x17, 0xd4, 0x4a, 0xbf, 0x35, 0x9d, 0x13, 0x32, 0x08, 0x22, 0xb5, 0x4b, 0x0b,
+    0x57, 0x7d, 0x70, 0x6b, 0x59, 0xaa, 0x58, 0x44, 0x17, 0x83, 0x68, 0x76, 0x16, 0x7b, 0x41, 0xac,
+    0x1d, 0x97, 0xb4, 0x6e, 0x22, 0xd3, 0x96, 0xdc, 0x9a, 0x2c, 0x60, 0xd7, 0xeb, 0x63, 0x01, 0x86,
+    0x1d, 0xff, 0x83, 0x34, 0xd9, 0xe9, 0x21, 0x7c, 0x9f, 0xb4, 0x68, 0x07, 0xd6, 0x3b, 0x02, 0xa1,
+    0x9c, 0x96, 0xc2, 0xa8, 0x1a, 0xe0, 0xb0, 0xdd, 0x95, 0x46, 0xa0, 0x7a, 0x4f, 0x15, 0x79, 0x81,
+    0x3c, 0x86, 0x80, 0xbc, 0xc9, 0x51, 0x86, 0x2a, 0x8d, 0xbc, 0xba, 0xf2, 0x26, 0xae, 0xa0, 0xa5,
+    0x0a, 0x83, 0xfa, 0xe3, 0xc2, 0xd2, 0x8f, 0xc7, 0x9c, 0x03, 0x8b, 0x35, 0xc3, 0x58, 0xf9, 0x0f,
+    0x99, 0x5f, 0x38, 0x34, 0xff, 0xc6, 0x1c, 0x39, 0x00, 0xd4, 0x4a, 0x96, 0x29, 0x9f, 0x53, 0xb4,
+    0x28, 0x22, 0xc5, 0xcb, 0xdf, 0x71, 0x0d, 0x4c, 0x21, 0x60, 0xd4, 0x81, 0xf1, 0xd8, 0x2b, 0x6f,
+    0x76, 0x76, 0xab, 0x3b, 0xac, 0x41, 0x8c, 0xb2, 0x6e, 0xe7, 0x3b, 0x59, 0x5d, 0x18, 0xaf, 0x90,
+    0x47, 0x8e, 0xcd, 0xf2, 0xd9, 0xcc, 0x55, 0x80, 0x41, 0x5f, 0x00, 0xe1, 0xcb, 0x1f, 0x7a, 0xf8,
+    0xfc, 0xf1, 0x47, 0x02, 0xd8, 0xfe, 0xe8, 0xc0, 0x99, 0xdb, 0x74, 0x30, 0x83, 0xc2, 0x2b, 0xe8,
+    0xeb, 0x99, 0x0e, 0x7e, 0x32, 0x52, 0x45, 0xd7, 0x14, 0x8f, 0xd1, 0x20, 0x53, 0x72, 0x70, 0x20,
+    0x3e, 0x20, 0x1a, 0x95, 0xf8, 0xc8, 0x28, 0x96, 0x78, 0xf2, 0x14, 0xc3, 0xac, 0x24, 0xda, 0xe3,
+    0x31, 0x66, 0x16, 0x61, 0x0d, 0x7e, 0x02, 0x93, 0x93, 0x9d, 0x49, 0xf3, 0x44, 0x09, 0x7b, 0x40,
+    0x03, 0x3b, 0x08, 0x51, 0x30, 0x69, 0xe7, 0x94, 0xab, 0x7d, 0x48, 0xed, 0xad, 0xc4, 0x55, 0xaa,
+    0x95, 0x5a, 0x16, 0xfc, 0x2c, 0xd1, 0x75, 0x20, 0xd8, 0x82, 0x71, 0x9e, 0x68, 0x67, 0x76, 0xa3,
+    0xc3, 0x1a, 0xcb, 0x71, 0xeb, 0x46, 0xac, 0x65, 0xc9, 0x85, 0x31, 0x05, 0x76, 0x8b, 0x6a, 0x69,
+    0x5e, 0xeb, 0x02, 0x40, 0x18, 0xf2, 0x9c, 0x1e, 0x02, 0xef, 0x5f, 0xea, 0x80, 0xdf, 0xcb, 0x74,
+    0x90, 0x55, 0xd6, 0x2b, 0xf0, 0x72, 0xa4, 0x11, 0x6d, 0x5a, 0x53, 0x05, 0xea, 0x08, 0x8f, 0x91,
+    0x8c, 0x68, 0x72, 0xb4, 0x34, 0x3e, 0x20, 0x82, 0x53, 0xf9, 0xc8, 0x13, 0xcb, 0x78, 0x02, 0x38,
+    0xff, 0xb8, 0x9c, 0x46, 0xe0, 0x31, 0xea, 0x02, 0x63, 0x0d, 0xa8, 0xe5, 0x92, 0x93, 0xab, 0x5b,
+    0xf3, 0xe0, 0xd5, 0x7c, 0x40, 0xd4, 0xad, 0xb4, 0xd2, 0xda, 0xb0, 0xe7, 0x04, 0x66, 0x83, 0x48,
+    0x81, 0xfa, 0xc5, 0x55, 0xdf, 0xbc, 0x5b, 0x16, 0x45, 0x1c, 0xd1, 0x25, 0x1a, 0x12, 0x8f, 0xe1,
+    0x70, 0x6a, 0x67, 0x22, 0xc3, 0xc4, 0x1a, 0x28, 0x55, 0xeb, 0x56, 0x69, 0x84, 0xc9, 0x29, 0xa1,
+    0x01, 0x76, 0x70, 0xdb, 0x53, 0x9f, 0x7c, 0xc1, 0x05, 0x18, 0x77, 0x0c, 0x10, 0x02, 0x5b, 0x51,
+    0xea, 0x40, 0x7f, 0xcd, 0x74, 0x20, 0xfd, 0xd4, 0x2b, 0xb0, 0x1b, 0xa4, 0x11, 0xd2, 0x61, 0x53,
+    0x05, 0x2b, 0x05, 0x8f, 0x21, 0xa0, 0x68, 0x72, 0xb8, 0x10, 0x3e, 0x20, 0x74, 0x4f, 0xf9, 0x08,
+    0x70, 0xc9, 0x78, 0x32, 0xde, 0xfe, 0xb8, 0x70, 0x3a, 0xe0, 0x31, 0x38, 0xf9, 0x62, 0x8d, 0x35,
+    0xe5, 0x92, 0x23, 0x05, 0x5b, 0xf3, 0x84, 0xc4, 0x7c, 0x40, 0xfd, 0xb5, 0xb4, 0x92, 0x09, 0xab,
+    0xe7, 0x64, 0x0f, 0x84, 0x48, 0x91, 0x9c, 0xc5, 0x55, 0xe5, 0xc5, 0x5b, 0x16, 0xea, 0x17, 0xd1,
+    0x45, 0xa4, 0x11, 0x8f, 0x65, 0x5a, 0x6a, 0x67, 0x9d, 0xbd, 0xc4, 0x1a, 0xff, 0x53, 0xeb, 0x36,
+    0xef, 0x83, 0xc9, 0x8d, 0x9e, 0x01, 0x76, 0xaa, 0xdc, 0x53, 0x1f, 0x7c, 0xbf, 0x05, 0x38, 0x0f,
+    0x0c, 0x10, 0x02, 0xb2, 0x45, 0xea, 0x00, 0x37, 0xcf, 0x74, 0x50, 0xc9, 0xd3, 0x2b, 0x18, 0xca,
+    0xa3, 0x11, 0x1c, 0x6b, 0x53, 0x05, 0xc0, 0x01, 0x8f, 0xd1, 0xdb, 0x68, 0x72, 0x6c, 0xf0, 0x3d,
+    0x20, 0x4a, 0x4e, 0xf9, 0xc8, 0xe4, 0xc7, 0x78, 0xf2, 0x77, 0xfe, 0xb8, 0xc8, 0x3d, 0xe0, 0x31,
+    0xec, 0xee, 0x62, 0x4d, 0x9d, 0xe5, 0x92, 0x53, 0x5e, 0x5a, 0xf3, 0x9c, 0xbf, 0x7c, 0x40, 0x1f,
+    0xbf, 0xb4, 0x52, 0xc7, 0xa5, 0xe7, 0xb4, 0xc3, 0x84, 0x48, 0xa5, 0x49, 0xc5, 0x55, 0xea, 0xcf,
+    0x5b, 0xd6, 0x27, 0x14, 0xd1, 0xd5, 0x39, 0x11, 0x8f, 0xa1, 0x50, 0x6a, 0x67, 0xcc, 0xb7, 0xc4,
+    0x9a, 0xd9, 0x53, 0xeb, 0x36, 0x6b, 0x83, 0xc9, 0x65, 0xab, 0x01, 0x76, 0x89, 0xe1, 0x53, 0xdf,
+    0x78, 0xbd, 0x05, 0x38, 0xd2, 0x0b, 0x10, 0x02, 0x15, 0x3c, 0xea, 0x80, 0xed, 0xd0, 0x74, 0xe0,
+    0xba, 0xd2, 0x2b, 0x98, 0x7f, 0xa3, 0x11, 0x71, 0x75, 0x53, 0x05, 0xb7, 0xfe, 0x8e, 0x01, 0x1b,
+    0x3c, 0x73, 0x74, 0x8f, 0x72, 0x20, 0x10, 0x7e, 0x06, 0x89, 0x3c, 0x12, 0x7c, 0x32, 0xf5, 0xd0,
+    0xb9, 0x38, 0x0a, 0x15, 0x32, 0x4a, 0x12, 0x70, 0x4d, 0x8a, 0x32, 0x96, 0x23, 0x94, 0x2c, 0xf4,
+    0xd8, 0x82, 0xb1, 0x40, 0x55, 0xf7, 0xc1, 0x52, 0xbe, 0xec, 0xea, 0xe4, 0x70, 0x58, 0x49, 0x31,
+    0xba, 0xf9, 0x55, 0x8b, 0x09, 0x69, 0x56, 0x92, 0x5c, 0xd4, 0xe5, 0xca, 0xe3, 0x8f, 0x35, 0x0c,
+    0x9f, 0x67, 0x7c, 0xe1, 0xd1, 0xda, 0x23, 0xa0, 0xee, 0xe6, 0xd0, 0x55, 0xca, 0x09, 0x80, 0x36,
+    0x76, 0x5e, 0x18, 0x61, 0x1f, 0xf0, 0x06, 0x09, 0x08, 0xb5, 0xde, 0x10, 0x02, 0x83, 0x35, 0xea,
+    0x80, 0xae, 0xd2, 0x74, 0x10, 0xdd, 0xd1, 0x2b, 0x70, 0x3e, 0xa3, 0x11, 0x0f, 0x81, 0x53, 0xc5,
+    0x3b, 0xfc, 0x8e, 0x71, 0x94, 0x69, 0x72, 0x80, 0xbd, 0x3d, 0x20, 0x58, 0x52, 0xf9, 0x88, 0x42,
+    0xc5, 0x78, 0xc2, 0x8d, 0xfd, 0xb8, 0xc0, 0x6d, 0xe0, 0x31, 0x6a, 0xd7, 0x62, 0x4d, 0xdd, 0xe8,
+    0x92, 0x53, 0xef, 0x58, 0xf3, 0x3c, 0xda, 0x7c, 0x40, 0xcf, 0xd1, 0xb4, 0x52, 0x00, 0x9d, 0xe7,
+    0x14, 0x42, 0x86, 0x48, 0xdd, 0xc0, 0xc4, 0x55, 0x70, 0xe5, 0x5b, 0x56, 0x4f, 0x0e, 0xd1, 0x55,
+    0x8d, 0x10, 0x8f, 0x25, 0x5b, 0x6a, 0x67, 0x93, 0xad, 0xc4, 0x1a, 0xc8, 0x55, 0xeb, 0x66, 0x57,
+    0x82, 0xc9, 0x51, 0xeb, 0x01, 0x76, 0x09, 0x3d, 0x6b, 0x1e, 0x20, 0xfd, 0xd4, 0xb7, 0x3c, 0x6e,
+    0x01, 0x02, 0xd9, 0x12, 0xe9, 0xc0, 0x9c, 0x68, 0x3a, 0x58, 0x93, 0xf1, 0x8a, 0x01, 0x13, 0xd3,
+    0xd1, 0x50, 0xff, 0x48, 0x8a, 0xaa, 0xa3, 0x4a, 0x18, 0x28, 0x8f, 0xd9, 0xe1, 0x27, 0x39, 0xcc,
+    0xb3, 0x0f, 0x88, 0xd8, 0x0f, 0x1f, 0x59, 0xa7, 0x89, 0x27, 0x57, 0x12, 0x66, 0x55, 0x43, 0x8e,
+    0xc7, 0xdc, 0x72, 0xc2, 0x1a, 0x7d, 0xf7, 0x92, 0xab, 0x10, 0xa6, 0x79, 0xbd, 0x95, 0x1e, 0x70,
+    0x3e, 0x0a, 0x21, 0xfe, 0xcb, 0xc5, 0x47, 0x20, 0xd4, 0x6d, 0x49, 0xe5, 0xde, 0x39, 0x1d, 0xf4,
+    0x0e, 0x29, 0xdd, 0x60, 0x5c, 0xdd, 0xb4, 0xd1, 0xb2, 0xc8, 0x03, 0x45, 0xf7, 0x9c, 0xa8, 0x05,
+    0x73, 0x62, 0x68, 0x67, 0x4e, 0xd7, 0x61, 0x9d, 0xcb, 0xdb, 0xba, 0x31, 0xe4, 0x2c, 0x39, 0x14,
+    0x4c, 0x60, 0x07, 0xde, 0xa7, 0xea, 0xa0, 0x6a, 0x6f, 0x3a, 0xcc, 0x4c, 0x59, 0x0a, 0x70, 0x1e,
+    0xc0, 0xf1, 0x86, 0x94, 0x46, 0xc4, 0xf4, 0xa6, 0x0a, 0x59, 0x28, 0x8f, 0x29, 0xa3, 0x32, 0x39,
+    0x52, 0x35, 0x10, 0xe8, 0x16, 0x40, 0x1a, 0x99, 0x8a, 0xf3, 0x26, 0x92, 0x96, 0x52, 0xd5, 0x1f,
+    0xff, 0xb8, 0xa2, 0x65, 0xf1, 0x98, 0x71, 0xa9, 0x58, 0xab, 0xc2, 0x62, 0x72, 0xd0, 0x59, 0x35,
+    0x2f, 0x48, 0x22, 0xff, 0x31, 0xf6, 0x85, 0xc3, 0xbe, 0x03, 0xe6, 0x48, 0x66, 0x50, 0x2b, 0xf9,
+    0x7f, 0x3d, 0xa7, 0xc5, 0x24, 0x22, 0xa5, 0x1e, 0x8d, 0xab, 0xc1, 0xe2, 0x5b, 0x96, 0xb0, 0xc5,
+    0xe3, 0xba, 0x99, 0x1e, 0x60, 0x90, 0xe2, 0x78, 0x5c, 0x3c, 0xa6, 0x9d, 0x2f, 0x89, 0x8a, 0xf5,
+    0xa5, 0x5d, 0xeb, 0x06, 0x18, 0x9e, 0xe9, 0xc0, 0x58, 0x74, 0x3a, 0x80, 0x96, 0xf1, 0x8a, 0xdf,
+    0x88, 0xd3, 0x81, 0x25, 0xf9, 0x48, 0x44, 0x3b, 0xf4, 0x8a, 0xe2, 0xc3, 0x98, 0x31, 0x68, 0x2e,
+    0x39, 0xda, 0xc8, 0x0f, 0x48, 0x41, 0x19, 0x1f, 0xf5, 0xfb, 0x8b, 0xa7, 0xfc, 0x14, 0x66, 0xb5,
+    0x23, 0x5d, 0xbb, 0x46, 0x83, 0x3f, 0xd9, 0xce, 0x5e, 0x58, 0xab, 0x24, 0x44, 0x6c, 0x0b, 0x71,
+    0x4c, 0x8e, 0x9b, 0x95, 0xe6, 0xfd, 0xef, 0x7d, 0xc0, 0xac, 0x1a, 0x84, 0xf8, 0xe1, 0x22, 0x1f,
+    0x13, 0xb4, 0xb7, 0x25, 0x74, 0x39, 0xf1, 0x74, 0x65, 0x44, 0xa4, 0x4d, 0x10, 0x71, 0xf5, 0x8f,
+    0x6f, 0xcb, 0x1e, 0x67, 0x12, 0x5d, 0xf1, 0x1a, 0x17, 0x5c, 0x35, 0x82, 0x91, 0x45, 0x41, 0x02,
+    0x34, 0x1d, 0xdb, 0xba, 0x06, 0x3e, 0x69, 0xe9, 0x20, 0x46, 0x73, 0x3a, 0x24, 0x9e, 0xf0, 0x8a,
+    0x2e, 0x8c, 0xd3, 0x01, 0xef, 0xf3, 0x48, 0xe4, 0x2c, 0x78, 0xcc, 0xa8, 0xad, 0x98, 0x59, 0xdd,
+    0x2d, 0x39, 0x6a, 0xb7, 0x0f, 0xe8, 0xf7, 0x10, 0x1f, 0x69, 0x83, 0x8c, 0x27, 0xb4, 0xdc, 0x65,
+    0xb5, 0x6b, 0x62, 0xbb, 0xf6, 0x70, 0x3e, 0x19, 0x6a, 0x76, 0x58, 0xcb, 0x54, 0x5f, 0x72, 0x63,
+    0xde, 0x34, 0x2f, 0x2b, 0xe3, 0x03, 0xe2, 0x13, 0x21, 0x44, 0x2c, 0xf3, 0xf8, 0x98, 0xfc, 0xbd,
+    0x2d, 0x23, 0x18, 0x3b, 0xa7, 0x01, 0x26, 0xf1, 0xbc, 0x8d, 0x44, 0xa4, 0x5a, 0xc2, 0x70, 0x55,
+    0x18, 0x73, 0xcb, 0xe6, 0x33, 0x11, 0xdd, 0xf9, 0x24, 0x17, 0x1c, 0xff, 0x7e, 0x91, 0xd1, 0x0b,
+    0x02, 0xf4, 0x8e, 0x26, 0xb1, 0x06, 0xea, 0x4c, 0xea, 0xa0, 0x45, 0x71, 0x3a, 0xf8, 0x1c, 0xf4,
+    0x0a, 0x48, 0x88, 0xd3, 0x71, 0x8c, 0xff, 0x48, 0x06, 0xa7, 0xf4, 0x8a, 0x77, 0x27, 0x8f, 0x09,
+    0xde, 0x2f, 0x39, 0x7e, 0x3a, 0x10, 0x88, 0x61, 0x17, 0x1f, 0x21, 0xdd, 0x8e, 0xa7, 0x62, 0xeb,
+    0x65, 0x45, 0xde, 0x8a, 0xc7, 0x9a, 0xa1, 0x3e, 0x99, 0x4b, 0x96, 0x58, 0x0b, 0x65, 0x62, 0x72,
+    0x5a, 0x2a, 0x35, 0x0f, 0x08, 0xf6, 0x03, 0x1e, 0x86, 0x21, 0x44, 0xc6, 0x57, 0xf9, 0x88, 0x2b,
+    0xbe, 0x2d, 0x7b, 0xcb, 0x3c, 0x67, 0x96, 0x23, 0x22, 0x8d, 0x90, 0x8b, 0xab, 0xed, 0xb5, 0x5b,
+    0x76, 0xed, 0x9b, 0xe8, 0xba, 0xf2, 0xb9, 0x60, 0x9c, 0x3e, 0x8c, 0x7c, 0xf8, 0xa1, 0x9d, 0x3f,
+    0x5c, 0x02, 0x74, 0x37, 0x4c, 0xb1, 0x06, 0xda, 0xd9, 0xea, 0x40, 0x91, 0x71, 0x3a, 0x54, 0x29,
+    0xf6, 0x8a, 0xbb, 0x96, 0xd3, 0x21, 0xb7, 0x04, 0x49, 0xea, 0x9a, 0xa7, 0xca, 0xb7, 0x21, 0x8f,
+    0x91, 0x96, 0x35, 0x39, 0x0c, 0x12, 0x10, 0xa8, 0xc5, 0x2d, 0x1f, 0xad, 0x56, 0x8e, 0x27, 0x64,
+    0x33, 0x66, 0x65, 0x25, 0x6d, 0xbb, 0xce, 0x30, 0xf2, 0x98, 0x8e, 0x9b, 0x58, 0xbb, 0xb7, 0x65,
+    0x72, 0xc2, 0x2e, 0x35, 0x4f, 0x46, 0x06, 0x04, 0xc6, 0x3a, 0x21, 0xc4, 0x4f, 0x92, 0x5a, 0xf9,
+    0xac, 0xbc, 0x2d, 0xb5, 0xa7, 0x3d, 0x67, 0x11, 0x30, 0x22, 0x5d, 0x54, 0x8d, 0xab, 0xb0, 0x1d,
+    0x5c, 0xd6, 0xe5, 0x9c, 0xe8, 0xde, 0x59, 0xbc, 0x60, 0x70, 0x35, 0x8c, 0x1c, 0xf3, 0xac, 0x9d,
+    0x0d, 0x22, 0x8a, 0xf5, 0xb7, 0x78, 0xeb, 0x06, 0x13, 0x24, 0xe9, 0x60, 0x28, 0x58, 0x3a, 0x1c,
+    0x12, 0xf3, 0x8a, 0xb3, 0x30, 0xbf, 0x81, 0x2b, 0x57, 0x3a, 0x7e, 0xf3, 0xd2, 0x08, 0xfb, 0x67,
+    0x54, 0x09, 0xcb, 0xe3, 0x31, 0x60, 0x2d, 0x25, 0xe7, 0x38, 0xe5, 0x01, 0x89, 0x2f, 0xe3, 0xa3,
+    0x16, 0xf8, 0xf0, 0x94, 0x0a, 0x56, 0xaa, 0x2a, 0x6c, 0x1c, 0xd7, 0x35, 0x10, 0x1e, 0x63, 0x11,
+    0x0e, 0x6b, 0x61, 0xfd, 0x4a, 0x4e, 0x69, 0xa8, 0xe6, 0x9d, 0xf1, 0x77, 0xc0, 0x19, 0x3d, 0x84,
+    0x48, 0x96, 0xab, 0x1c, 0xfd, 0x15, 0x68, 0xe5, 0x65, 0x96, 0xe7, 0x8c, 0x69, 0x36, 0xa4, 0xe6,
+    0xd2, 0x71, 0x35, 0x1c, 0x3e, 0xcb, 0x3e, 0x12, 0x1b, 0x60, 0x69, 0xb7, 0x16, 0xfc, 0x50, 0x07,
+    0x8f, 0x9b, 0xb9, 0xb4, 0x73, 0x89, 0xd4, 0xb0, 0x06, 0x40, 0xe1, 0xe8, 0x00, 0x3f, 0x5e, 0x3a,
+    0x9c, 0x9e, 0xf1, 0x0a, 0x36, 0x56, 0xbf, 0x01, 0x97, 0x90, 0x46, 0x64, 0x8f, 0xa3, 0x4a, 0xee,
+    0x08, 0x8f, 0xd1, 0x05, 0x2a, 0x39, 0xf3, 0xdf, 0x0e, 0x88, 0x69, 0x1c, 0x1f, 0xdd, 0xf7, 0xe9,
+    0xa6, 0xea, 0xc8, 0xf0, 0x14, 0x92, 0x59, 0xaa, 0xd4, 0x80, 0x1b, 0x17, 0x2d, 0x25, 0x1e, 0xe3,
+    0x75, 0x0a, 0x6b, 0x99, 0x45, 0x4b, 0x6e, 0x46, 0x9d, 0xe6, 0xbd, 0x47, 0x78, 0xc0, 0x34, 0xb9,
+    0x70, 0x88, 0x17, 0x85, 0x10, 0x09, 0xc7, 0x94, 0xa3, 0x39, 0x13, 0xad, 0x8c, 0x88, 0xef, 0x9c,
+    0xfa, 0x0a, 0x87, 0xd4, 0xf8, 0x2d, 0xae, 0x46, 0x42, 0x68, 0x59, 0xad, 0x50, 0xa2, 0xeb, 0x7a,
+    0x6d, 0x80, 0x71, 0x50, 0xe0, 0x71, 0x49, 0x9e, 0x76, 0x06, 0xa0, 0x03, 0xeb, 0x40, 0xf0, 0x64,
+    0x3a, 0x5c, 0x6a, 0xf8, 0x0a, 0x05, 0xfc, 0xbf, 0x61, 0x6a, 0x6a, 0x3a, 0x1a, 0x4e, 0xd3, 0x08,
+    0x1c, 0xe3, 0x54, 0xf9, 0x54, 0xe4, 0x31, 0x04, 0xdc, 0x26, 0x27, 0x6a, 0xfa, 0x01, 0xc1, 0x1d,
+    0xe7, 0xa3, 0x3d, 0xae, 0xf1, 0x64, 0x2f, 0x58, 0xaa, 0xda, 0xf6, 0x1f, 0x17, 0x42, 0x29, 0x1e,
+    0x03, 0x7d, 0x18, 0x6b, 0x45, 0x23, 0x4c, 0x6e, 0xf1, 0xb8, 0xe6, 0xbd, 0x1d, 0x7f, 0x40, 0x27,
+    0xb2, 0x70, 0x98, 0xa6, 0x87, 0x10, 0xc9, 0xfa, 0x98, 0x23, 0x7d, 0x2a, 0xad, 0x34, 0xaa, 0xfb,
+    0x9c, 0xb0, 0x38, 0x88, 0x34, 0xd8, 0x44, 0xae, 0x56, 0x43, 0x6f, 0x59, 0xbc, 0x7c, 0xa2, 0x9b,
+    0xbc, 0x84, 0x80, 0x2b, 0x63, 0x5e, 0x70, 0xdc, 0x55, 0x3c, 0x06, 0xc2, 0xc5, 0xe9, 0x40, 0xe8,
+    0x57, 0x3a, 0x14, 0x09, 0xf5, 0x0a, 0x9b, 0xe5, 0xd2, 0x51, 0xeb, 0x06, 0x49, 0xdc, 0x35, 0xa5,
+    0x8a, 0x64, 0xfb, 0x8e, 0x39, 0xea, 0x31, 0x39, 0xd8, 0xb3, 0x0e, 0xc8, 0x26, 0x36, 0x1f, 0x0d,
+    0x7d, 0x87, 0xa7, 0xb7, 0x61, 0x66, 0xf5, 0xbf, 0xea, 0xb8, 0x08, 0xbf, 0x6a, 0x97, 0x85, 0x15,
+    0x1e, 0x23, 0xe2, 0x11, 0x6b, 0xc7, 0x40, 0x4b, 0x6e, 0x8e, 0xb0, 0xe6, 0x79, 0x40, 0x7a, 0xc0,
+    0x63, 0x34, 0x84, 0xe8, 0xc4, 0x21, 0x1f, 0x05, 0x4a, 0x68, 0xa5, 0x49, 0xae, 0xe7, 0xac, 0x6f,
+    0x3a, 0xa4, 0x87, 0xc7, 0x71, 0xb5, 0x24, 0x5a, 0xcb, 0x8a, 0xed, 0x11, 0x5d, 0x2c, 0x3b, 0x17,
+    0x5c, 0xff, 0x72, 0x91, 0x59, 0x55, 0xb6, 0x33, 0x4b, 0xd8, 0xb0, 0x06, 0x75, 0xd1, 0xe8, 0x00,
+    0x4f, 0x56, 0x3a, 0x50, 0x98, 0xf1, 0x0a, 0x03, 0xc6, 0xd2, 0x71, 0x26, 0x8d, 0x46, 0x5e, 0x7f,
+    0x1f, 0x49, 0xd5, 0x7d, 0x54, 0xb9, 0x11, 0xdd, 0x31, 0x54, 0x88, 0x25, 0x27, 0x60, 0xcc, 0x01,
+    0x99, 0x0c, 0xe4, 0x23, 0x7b, 0xba, 0xf0, 0xf4, 0xaa, 0xc2, 0xac, 0xfe, 0x97, 0x1c, 0x57, 0xcb,
+    0xe8, 0x1d, 0x8b, 0x73, 0x0f, 0x6b, 0x06, 0x6c, 0x4a, 0xee, 0xe7, 0xab, 0xe6, 0x2d, 0x6c, 0x76,
+    0x40, 0x6f, 0x36, 0x84, 0x08, 0x3f, 0xa6, 0x1c, 0xb7, 0x38, 0xe2, 0xe3, 0x71, 0x01, 0xad, 0x24,
+    0x7c, 0xef, 0x9c, 0xa7, 0xf7, 0x86, 0x34, 0x0c, 0x26, 0xae, 0x56, 0x35, 0x69, 0xd9, 0x04, 0x07,
+    0xa2, 0x8b, 0xcd, 0xdd, 0x82, 0xfd, 0x93, 0xdf, 0x71, 0x9f, 0xb1, 0x45, 0x06, 0x72, 0x80, 0xe8,
+    0x20, 0x27, 0x61, 0x3a, 0xa4, 0x1e, 0xf0, 0x8a, 0xfd, 0xdc, 0xd2, 0x91, 0xd9, 0xfa, 0x48, 0x02,
+    0xe1, 0xf0, 0xca, 0xe0, 0x17, 0x8f, 0x61, 0x1f, 0x25, 0x39, 0x9f, 0x4f, 0x0f, 0x08, 0x55, 0x06,
+    0x1f, 0xa1, 0x0d, 0x88, 0x27, 0xd8, 0xe1, 0x65, 0x85, 0x3d, 0x4e, 0xbb, 0x3e, 0x42, 0xf0, 0x98,
+    0x92, 0xc5, 0x27, 0xdb, 0xe7, 0x0a, 0x6b, 0x82, 0xeb, 0x4a, 0x4e, 0xfa, 0x9d, 0xe6, 0x6d, 0xb7,
+    0x76, 0xc0, 0x67, 0x34, 0x84, 0x28, 0x57, 0x0c, 0x1f, 0x95, 0x17, 0xb7, 0xa5, 0x99, 0x68, 0xe7,
+    0x9c, 0xfd, 0x37, 0xa4, 0x7c, 0x44, 0x71, 0xf5, 0x7a, 0x39, 0xcb, 0xde, 0xc4, 0x12, 0x5d, 0x5e,
+    0x7f, 0x16, 0xac, 0x9d, 0x7b, 0x91, 0x4b, 0x87, 0xb3, 0x33, 0x44, 0x20, 0x80, 0x06, 0x35, 0xf1,
+    0xe9, 0xa0, 0x3b, 0x5f, 0x3a, 0x7c, 0xa8, 0xf4, 0x0a, 0x1b, 0x2b, 0xd3, 0xb1, 0x11, 0x00, 0x49,
+    0x8e, 0xd1, 0xf3, 0x8a, 0x1a, 0xef, 0x8e, 0x39, 0xc9, 0x15, 0x33, 0xa8, 0x84, 0x26, 0xe7, 0x3f,
+    0xde, 0x01, 0xad, 0x22, 0xe6, 0xa3, 0x76, 0x3e, 0xf1, 0x14, 0x70, 0xc3, 0xac, 0x28, 0x45, 0x6c,
+    0x97, 0x13, 0xbc, 0x27, 0x3b, 0x84, 0x16, 0x6b, 0xd6, 0x26, 0x4b, 0x6e, 0x8c, 0xb7, 0xe6, 0xe5,
+    0xd5, 0x7a, 0xc0, 0xf7, 0x38, 0x84, 0x88, 0x27, 0x24, 0x1f, 0xeb, 0xb2, 0xb6, 0xe5, 0x1b, 0xa4,
+    0xe7, 0xcc, 0x6f, 0x2c, 0x9e, 0x84, 0xe0, 0x87, 0xf4, 0xb1, 0x2a, 0xae, 0x16, 0xd6, 0x6d, 0x59,
+    0xd7, 0x0c, 0xa2, 0x0b, 0xce, 0xee, 0x82, 0x51, 0x6d, 0x2e, 0x32, 0xf3, 0x82, 0x80, 0x06, 0xcf,
+    0x9a, 0x26, 0xc0, 0xa6, 0x2c, 0x1d, 0x3c, 0x85, 0x4e, 0x07, 0x68, 0x1a, 0x5e, 0xb1, 0x9b, 0x70,
+    0x3a, 0x4a, 0xd7, 0x1e, 0xc9, 0x57, 0x83, 0x5e, 0xb1, 0x64, 0xe1, 0x31, 0xbf, 0xee, 0x62, 0x66,
+    0x60, 0xb6, 0xe4, 0x58, 0xba, 0x3e, 0xa0, 0x29, 0x5a, 0x7c, 0x94, 0xfd, 0x2d, 0x9e, 0xa2, 0x2e,
+    0x98, 0x55, 0x1d, 0x6c, 0xed, 0x32, 0x68, 0xfd, 0x64, 0x9a, 0x6a, 0x61, 0xcd, 0x07, 0x0d, 0xb1,
+    0x1d, 0x27, 0x31, 0xb9, 0xbd, 0x52, 0x9a, 0x37, 0x94, 0xf4, 0x01, 0x33, 0x67, 0x10, 0xa2, 0x71,
+    0x7d, 0x7c, 0xfc, 0xc4, 0xde, 0x96, 0x83, 0xb2, 0xc4, 0x13, 0x2d, 0x10, 0x91, 0x1e, 0xb3, 0xc3,
+    0x55, 0x8d, 0xb4, 0x2d, 0x5b, 0xb4, 0x47, 0x74, 0x73, 0x40, 0x5c, 0xb0, 0x14, 0x01, 0x46, 0x06,
+    0x84, 0x33, 0xc3, 0xc0, 0x2c, 0x47, 0x1d, 0x70, 0x53, 0xb2, 0x86, 0xd7, 0xf9, 0x4a, 0x61, 0xbe,
+    0x02, 0x38, 0xbe, 0x72, 0xd1, 0x48, 0x62, 0xe8, 0x54, 0x59, 0xdd, 0xde, 0x31, 0x37, 0xbc, 0x26,
+    0xa7, 0xed, 0x17, 0xfd, 0x5c, 0x6b, 0x3d, 0x20, 0x63, 0x16, 0x69, 0xa4, 0xf2, 0xc5, 0x9b, 0xea,
+    0x00, 0x4a, 0x15, 0xa2, 0xf0, 0xe3, 0x52, 0xdd, 0xc1, 0x63, 0x8a, 0xc0, 0x62, 0xed, 0x26, 0x9f,
+    0xc4, 0x45, 0xff, 0x2e, 0xb9, 0x51, 0x36, 0x87, 0xe7, 0x61, 0x87, 0xff, 0xf6, 0xeb, 0xc2, 0x21,
+    0xe9, 0xe7, 0x72, 0x6c, 0xfc, 0xa6, 0x95, 0xde, 0x69, 0x9e, 0x93, 0x08, 0x0f, 0x91, 0x02, 0x8b,
+    0x28, 0xd5, 0xee, 0x90, 0xb8, 0xaa, 0x5f, 0x51, 0x63, 0xe1, 0xc5, 0x3a, 0xee, 0x51, 0x04, 0x02,
+    0x06, 0x05, 0xc9, 0xe9, 0x00, 0x76, 0x74, 0x3a, 0x04, 0x27, 0xf2, 0x0a, 0xc2, 0x22, 0xc0, 0x11,
+    0x94, 0x8c, 0x46, 0x18, 0x52, 0xa6, 0x0a, 0xdf, 0x15, 0x8f, 0x09, 0x11, 0x2f, 0x39, 0xd4, 0xdc,
+    0x0f, 0x48, 0x0b, 0x1b, 0x1f, 0x69, 0x68, 0x8c, 0x27, 0x77, 0xbd, 0x52, 0xa5, 0x73, 0xec, 0xb8,
+    0xe8, 0x27, 0xf2, 0x18, 0xaf, 0x63, 0x58, 0xe3, 0x41, 0x64, 0x72, 0x8a, 0xb5, 0x34, 0x4f, 0xdf,
+    0xf3, 0x03, 0xa2, 0x6a, 0x86, 0x43, 0xbb, 0x1b, 0x84, 0x38, 0x06, 0xb1, 0x1c, 0xa3, 0x70, 0x6a,
+    0xa5, 0x25, 0x7a, 0xe7, 0x6c, 0xb4, 0x44, 0xa4, 0xfc, 0x27, 0x71, 0x15, 0xe0, 0x71, 0xcb, 0x3e,
+    0x8c, 0x77, 0xdc, 0xc0, 0x56, 0xa2, 0xab, 0x09, 0x74, 0x80, 0xf9, 0xb5, 0xe2, 0x31, 0x6d, 0x94,
+    0x76, 0x06, 0x69, 0x44, 0xe9, 0x60, 0x8c, 0x58, 0x3a, 0x7c, 0x80, 0xf3, 0x0a, 0x9d, 0x3d, 0xbf,
+    0xb1, 0xc4, 0x57, 0x3a, 0x7a, 0xfe, 0xd2, 0x48, 0x07, 0x70, 0x54, 0x69, 0xb4, 0xe3, 0x31, 0x7e,
+    0x52, 0x25, 0xe7, 0x29, 0xe4, 0x01, 0x09, 0xd2, 0xe3, 0x23, 0x46, 0xf3, 0xf0, 0x24, 0xe4, 0x58,
+    0xaa, 0xf0, 0x58, 0x1c, 0x57, 0x4d, 0x1b, 0x1e, 0xbb, 0xd4, 0x0d, 0x6b, 0x89, 0x28, 0x4b, 0xce,
+    0x84, 0xa7, 0xe6, 0x91, 0x98, 0x78, 0xc0, 0x4d, 0x39, 0x84, 0x98, 0x5d, 0xad, 0x1c, 0xd9, 0x25,
+    0x68, 0xa5, 0x23, 0x9c, 0xe7, 0x0c, 0xe4, 0x36, 0xa4, 0xc4, 0xe2, 0x71, 0xb5, 0xfa, 0x40, 0xcb,
+    0xd6, 0xd6, 0x13, 0xdd, 0x72, 0x76, 0x03, 0x4c, 0xc0, 0xd8, 0x82, 0x5f, 0xd3, 0xe0, 0x31, 0xf3,
+    0xa1, 0x76, 0x06, 0x7f, 0x98, 0xea, 0xe0, 0x87, 0x68, 0x3a, 0xe8, 0x2c, 0xf6, 0x8a, 0xc4, 0xfe,
+    0xbf, 0xc1, 0xb1, 0x6c, 0x3a, 0x54, 0x84, 0xd2, 0x08, 0x23, 0xdc, 0x54, 0xe9, 0xda, 0xe2, 0x31,
+    0x04, 0x8b, 0x26, 0xe7, 0x29, 0xfa, 0x01, 0x9d, 0x27, 0xe5, 0xa3, 0xb4, 0xb7, 0xf1, 0x34, 0x25,
+    0xc0, 0xac, 0xea, 0x1f, 0x20, 0x17, 0x14, 0x12, 0x1e, 0xc3, 0x1a, 0x18, 0x6b, 0x17, 0xdc, 0x4b,
+    0x8e, 0xc5, 0xb5, 0xe6, 0x39, 0xee, 0x7d, 0x40, 0x47, 0x3c, 0x84, 0x08, 0xbd, 0xc0, 0x1c, 0x69,
+    0xcb, 0xe5, 0xa3, 0x88, 0x31, 0xad, 0x1c, 0x32, 0xf7, 0x9c, 0x87, 0x54, 0x88, 0x14, 0x7a, 0x34,
+    0xae, 0xea, 0x49, 0x6f, 0xd9, 0x4a, 0x54, 0xa2, 0x9b, 0x27, 0xf0, 0x82, 0x05, 0xc9, 0xe2, 0xb1,
+    0xb2, 0xa5, 0x76, 0x06, 0x3b, 0x61, 0xe8, 0x80, 0x09, 0x6e, 0x3a, 0xd4, 0x42, 0xee, 0x8a, 0xb5,
+    0x3f, 0xd3, 0xa1, 0x44, 0x87, 0x46, 0x08, 0x2d, 0x1e, 0x89, 0xd8, 0x7d, 0x54, 0x01, 0x62, 0xe0,
+    0x31, 0x7e, 0xda, 0x24, 0x47, 0xbf, 0xeb, 0x01, 0x2d, 0x8f, 0xe0, 0x23, 0x4f, 0x25, 0xf1, 0xf4,
+    0xc3, 0x4d, 0xaa, 0x6e, 0x58, 0x97, 0xd5, 0x8c, 0x81, 0xe3, 0x42, 0x55, 0xc2, 0x63, 0xd5, 0x26,
+    0x61, 0xed, 0xc0, 0x6b, 0xc9, 0x1d, 0x8b, 0xd2, 0x3c, 0xdc, 0x0b, 0x0f, 0x38, 0x31, 0x84, 0x10,
+    0x01, 0xa2, 0xe1, 0x63, 0x28, 0x39, 0xad, 0x14, 0xc2, 0xe8, 0x9c, 0x80, 0xd4, 0x87, 0xb4, 0xa2,
+    0x15, 0xae, 0xaa, 0xff, 0x69, 0xd9, 0xd7, 0x24, 0xa2, 0x1b, 0x04, 0xd5, 0x82, 0xed, 0x9d, 0xe1,
+    0x31, 0x55, 0xeb, 0x45, 0x06, 0x4e, 0xfe, 0xe9, 0xa0, 0xd6, 0x71, 0x3a, 0xdc, 0xf8, 0xf2, 0x0a,
+    0x9b, 0x84, 0xd3, 0x61, 0xa6, 0xfc, 0x48, 0x74, 0x65, 0xf4, 0x8a, 0x61, 0x24, 0x8f, 0xa1, 0xe2,
+    0x2d, 0x39, 0x19, 0x2f, 0x10, 0x88, 0x43, 0x11, 0x1f, 0x0d, 0x74, 0x8e, 0x27, 0xda, 0xde, 0x65,
+    0xb5, 0x81, 0x6a, 0xbb, 0x74, 0x3d, 0xf1, 0xd8, 0x33, 0xd1, 0x27, 0x7b, 0x2d, 0x11, 0x6b, 0xaa,
+    0x32, 0x4c, 0x2e, 0xe2, 0xa1, 0xe6, 0x21, 0xf6, 0x7d, 0x40, 0xd7, 0x2e, 0x84, 0x48, 0x41, 0x26,
+    0x1f, 0x27, 0x2d, 0x6a, 0x25, 0x02, 0xfa, 0xb6, 0x2c, 0x20, 0xf1, 0x9c, 0x36, 0x80, 0x88, 0x54,
+    0x88, 0x29, 0xae, 0x36, 0x33, 0x6e, 0x59, 0xbd, 0x66, 0xa2, 0x3b, 0x1d, 0xe4, 0x82, 0x4d, 0xdf,
+    0x30, 0x32, 0x14, 0x3f, 0x80, 0x06, 0x3d, 0x33, 0xe8, 0x20, 0x90, 0x5d, 0x3a, 0x28, 0x21, 0xef,
+    0x8a, 0x6f, 0xcc, 0xd2, 0x31, 0x1b, 0xf6, 0x48, 0x7a, 0xde, 0xf0, 0x0a, 0xb4, 0xf6, 0x8e, 0xb9,
+    0xf5, 0x15, 0x33, 0xdc, 0xcf, 0x24, 0xa7, 0x8a, 0xd5, 0x01, 0x5d, 0x7c, 0xe1, 0x23, 0x52, 0xb7,
+    0xf0, 0x14, 0x6c, 0xbd, 0xac, 0xe6, 0x02, 0x69, 0x57, 0x95, 0xbe, 0x27, 0xd3, 0x96, 0x0a, 0x6b,
+    0x45, 0x7a, 0x4a, 0xee, 0x2d, 0x9e, 0xe6, 0xcd, 0x29, 0x75, 0xc0, 0x71, 0x2e, 0x84, 0x38, 0x17,
+    0x08, 0x1f, 0xf1, 0xc7, 0xb6, 0x65, 0xc8, 0x57, 0xe7, 0x14, 0x4d, 0x20, 0x9e, 0xb2, 0xe7, 0x86,
+    0x14, 0xdf, 0x1d, 0xae, 0xd6, 0x5e, 0x67, 0x59, 0x67, 0x19, 0xa2, 0xab, 0xbb, 0xd2, 0x82, 0x6f,
+    0x26, 0x2e, 0xf2, 0x90, 0x79, 0x76, 0x06, 0x06, 0x1e, 0xc2, 0x60, 0xd0, 0x22, 0x1d, 0x64, 0x4d,
+    0xb2, 0x06, 0xc8, 0xa6, 0x4a, 0xb1, 0x97, 0xf9, 0x37, 0x90, 0xa7, 0xd1, 0x48, 0xa9, 0x92, 0x54,
+    0x01, 0xba, 0xe3, 0x31, 0x90, 0x06, 0x25, 0xc7, 0x1e, 0x23, 0xfd, 0x3c, 0x40, 0x45, 0xa3, 0xfb,
+    0x00, 0xde, 0x04, 0x52, 0x4e, 0xaa, 0x56, 0x60, 0x1d, 0x97, 0xb0, 0x1e, 0x1e, 0xab, 0x69, 0x0c,
+    0x6b, 0xbd, 0xe6, 0x24, 0xae, 0x18, 0x7a, 0xc9, 0xb1, 0xe3, 0x37, 0xbc, 0xcd, 0xd9, 0xfb, 0xb7,
+    0x8e, 0x18, 0x0e, 0x77, 0xf1, 0x94, 0xa3, 0x5f, 0x3f, 0xad, 0x04, 0x92, 0xec, 0x9c, 0x8e, 0x1b,
+    0x88, 0xb4, 0x8c, 0x4d, 0xa9, 0x46, 0x2c, 0xc4, 0xd5, 0xa4, 0xc9, 0x19, 0xbb, 0xb3, 0xe0, 0x71,
+    0xaf, 0xcc, 0x0c, 0xf0, 0xd9, 0x5c, 0x3c, 0x06, 0x96, 0xd5, 0xea, 0x80, 0x2b, 0x9b, 0x35, 0xcc,
+    0x22, 0x4e, 0x87, 0x36, 0x30, 0x4b, 0x41, 0x48, 0x06, 0x38, 0x2c, 0xaf, 0xd2, 0x88, 0x2f, 0xe8,
+    0x54, 0xc1, 0x8b, 0xe5, 0x31, 0x43, 0x7b, 0x26, 0x27, 0xd3, 0x2d, 0xfd, 0xec, 0x00, 0x41, 0xa0,
+    0x8c, 0x20, 0x69, 0x34, 0x75, 0x93, 0x8f, 0xfe, 0x9f, 0x79, 0x93, 0xe1, 0x5d, 0xa9, 0x9a, 0x7f,
+    0x7e, 0x5c, 0x45, 0x02, 0x79, 0x0c, 0xb6, 0x4f, 0xac, 0x09, 0x9a, 0x32, 0x39, 0xd0, 0x9d, 0x9a,
+    0x87, 0x72, 0x94, 0xff, 0x3c, 0x0c, 0xc3, 0x21, 0x2a, 0x0b, 0x73, 0xec, 0xd7, 0xa8, 0x95, 0x8f,
+    0xdc, 0x9e, 0x53, 0x94, 0x15, 0x91, 0x2a, 0x02, 0xc7, 0xd5, 0x4f, 0x85, 0x1a, 0xbb, 0xb9, 0xbf,
+    0x65, 0x93, 0x70, 0x3c, 0x2e, 0xbd, 0xf4, 0x01, 0x06, 0xbf, 0xd0, 0xe8, 0xa0, 0x40, 0x6e, 0x3a,
+    0x7c, 0xc2, 0xef, 0x8a, 0x6c, 0x45, 0xd3, 0x61, 0x23, 0x8d, 0x46, 0x58, 0xdc, 0x1e, 0x89, 0x05,
+    0x7f, 0x54, 0x89, 0x8a, 0xe3, 0x31, 0xdf, 0xd1, 0x24, 0x47, 0xc1, 0xfa, 0x01, 0x11, 0x40, 0xe0,
+    0xa3, 0x59, 0x6a, 0xf1, 0xb4, 0x92, 0xb9, 0xac, 0x7e, 0xce, 0x1c, 0x57, 0xc5, 0x1a, 0x1e, 0x13,
+    0x2d, 0x0b, 0x6b, 0xb5, 0x9f, 0x4b, 0xae, 0xb2, 0x98, 0xe6, 0xb5, 0xcf, 0x79, 0x40, 0x60, 0x2b,
+    0x84, 0xc8, 0xbc, 0xa3, 0x1c, 0x4b, 0x61, 0xe2, 0xe3, 0xfb, 0x38, 0xad, 0xa4, 0xc5, 0xeb, 0x9c,
+    0x58, 0xde, 0x87, 0x14, 0xf2, 0x20, 0xae, 0x3e, 0x25, 0x6a, 0xd9, 0xfa, 0x55, 0xa2, 0x1b, 0x9f,
+    0xd4, 0x82, 0x2d, 0x94, 0xe2, 0x31, 0x6e, 0x65, 0x76, 0x06, 0xab, 0xfd, 0xe8, 0x60, 0x48, 0x56,
+    0x3a, 0xfc, 0x2b, 0xf2, 0x0a, 0xdf, 0xce, 0xd2, 0x71, 0x25, 0xfd, 0x48, 0x1e, 0x44, 0xa4, 0x8a,
+    0x80, 0xe7, 0x8e, 0x09, 0xa3, 0x2d, 0x39, 0x28, 0x68, 0x0e, 0x68, 0x7e, 0x24, 0x1f, 0xa1, 0x38,
+    0x86, 0xa7, 0xdd, 0x1b, 0x66, 0xa5, 0x5a, 0xe7, 0xb8, 0x98, 0x1f, 0x6a, 0x57, 0x1d, 0xe9, 0x1d,
+    0xb3, 0x9e, 0x10, 0x6b, 0xa6, 0x7d, 0x4a, 0x2e, 0x94, 0xae, 0xe6, 0x2d, 0xfd, 0x76, 0xc0, 0x69,
+    0x37, 0x84, 0xb8, 0x8d, 0x14, 0x1f, 0xf3, 0x12, 0x68, 0x65, 0x00, 0x84, 0xe7, 0x64, 0x7c, 0x38,
+    0xa4, 0xee, 0x3c, 0x71, 0x35, 0xb0, 0x4e, 0xcb, 0xf6, 0x2c, 0x10, 0x5d, 0xb5, 0x04, 0x17, 0x6c,
+    0x47, 0xfd, 0x8e, 0x1d, 0x91, 0x2d, 0x72, 0x39, 0xa5, 0x76, 0x06, 0xaf, 0x72, 0xea, 0x60, 0x44,
+    0x72, 0x3a, 0xd8, 0x6d, 0xf4, 0x0a, 0x33, 0x9b, 0xd3, 0xb1, 0xef, 0xfd, 0x48, 0xde, 0xa1, 0xa7,
+    0x0a, 0x3b, 0x0b, 0x8f, 0xa1, 0x7d, 0x35, 0x39, 0x6b, 0xc0, 0x0f, 0x88, 0x8c, 0x2c, 0x1f, 0x45,
+    0x26, 0x8d, 0xa7, 0x9a, 0x2b, 0x66, 0xd5, 0x97, 0x68, 0xbb, 0x98, 0xd1, 0xf1, 0x18, 0x30, 0x92,
+    0x58, 0x5b, 0xe4, 0x63, 0x72, 0x77, 0x15, 0x35, 0xcf, 0x3e, 0xfd, 0x03, 0xfe, 0x03, 0x21, 0xc4,
+    0x97, 0x7c, 0xf9, 0x38, 0xd3, 0x52, 0x2b, 0xfd, 0x8c, 0xb7, 0xe5, 0xbe, 0x98, 0xe7, 0xbc, 0x52,
+    0x46, 0xa4, 0xf5, 0x3f, 0x71, 0xf5, 0xd2, 0x84, 0xcb, 0xee, 0x13, 0x12, 0x5d, 0x12, 0x8e, 0x17,
+    0x1c, 0xef, 0x80, 0x91, 0x89, 0x7d, 0xb5, 0x73, 0xe2, 0x32, 0xb1, 0x06, 0xab, 0x23, 0xea, 0xa0,
+    0x7e, 0x6d, 0x3a, 0x08, 0xb1, 0xf3, 0x0a, 0x1f, 0x81, 0xd3, 0x81, 0xa5, 0xfa, 0x48, 0x42, 0x1a,
+    0xa7, 0x0a, 0xc0, 0xff, 0x8e, 0x21, 0xed, 0x33, 0x39, 0xea, 0x93, 0x0f, 0xc8, 0xaa, 0x24, 0x1f,
+    0xfd, 0xdb, 0x8c, 0x27, 0x41, 0xf6, 0x65, 0x45, 0xcb, 0xfc, 0xb8, 0x48, 0x7a, 0xf0, 0xd8, 0x03,
+    0xaa, 0x58, 0x5b, 0x7e, 0x5e, 0x72, 0xf6, 0x5f, 0x35, 0xef, 0x85, 0xea, 0x03, 0xa6, 0x69, 0x21,
+    0xc4, 0x56, 0x46, 0xf9, 0x88, 0x8f, 0x4f, 0x2b, 0x6b, 0x7f, 0x3c, 0x27, 0x83, 0x23, 0x22, 0x25,
+    0x7b, 0x88, 0xab, 0x13, 0xf9, 0x5b, 0xd6, 0x07, 0x88, 0xe8, 0xa2, 0x10, 0xbc, 0xe0, 0x91, 0x97,
+    0x78, 0x5c, 0x88, 0x7c, 0x91, 0x25, 0xda, 0xb4, 0xf3, 0x9c, 0x32, 0xb1, 0x06, 0x65, 0xd3, 0xea,
+    0x60, 0x1a, 0x69, 0x3a, 0x14, 0x11, 0xf7, 0x8a, 0x80, 0x69, 0xd3, 0xc1, 0xed, 0x96, 0x46, 0x34,
+    0x0a, 0xa7, 0x8a, 0x2d, 0x21, 0x8f, 0x11, 0x11, 0x35, 0x39, 0xda, 0xf6, 0x0f, 0xe8, 0xa5, 0x2c,
+    0x1f, 0xb1, 0x3e, 0x8e, 0xa7, 0x15, 0x12, 0x66, 0xd5, 0xaa, 0x01, 0xb9, 0x4e, 0xfa, 0xf0, 0x18,
+    0xb1, 0xc1, 0x58, 0xe3, 0xa3, 0x60, 0x72, 0x8e, 0xad, 0x35, 0x2f, 0xc4, 0xf6, 0x03, 0xc6, 0xe3,
+    0x21, 0xc4, 0xd8, 0x22, 0xe6, 0x58, 0x11, 0x32, 0x1f, 0x6f, 0x9a, 0x69, 0x65, 0x59, 0xc7, 0xe7,
+    0xd4, 0xf9, 0x42, 0xa4, 0xff, 0xd7, 0x71, 0x75, 0xe7, 0x7b, 0xcb, 0x12, 0x69, 0x13, 0x5d, 0x2b,
+    0x88, 0x17, 0xac, 0x5d, 0x18, 0x8f, 0x55, 0x6e, 0xb5, 0xb3, 0x23, 0x47, 0xb1, 0x06, 0x37, 0xfc,
+    0xea, 0xc0, 0xbd, 0x66, 0x3a, 0x7c, 0x0c, 0xf8, 0x0a, 0x23, 0x13, 0xc0, 0xe1, 0x0b, 0x6c, 0x3a,
+    0x38, 0xda, 0xd2, 0x48, 0xd9, 0xef, 0x54, 0x59, 0x96, 0xe2, 0x31, 0x19, 0x11, 0x27, 0xa7, 0xef,
+    0xf3, 0x01, 0x25, 0xf3, 0xe7, 0x23, 0x0e, 0x95, 0xf1, 0xa4, 0xf4, 0x5a, 0xaa, 0x1c, 0xa4, 0x1f,
+    0x97, 0x40, 0x33, 0x1e, 0xbb, 0x3a, 0x17, 0x6b, 0x03, 0x45, 0x4c, 0x6e, 0xa0, 0xb4, 0xe6, 0x49,
+    0x80, 0x7f, 0x40, 0xab, 0x32, 0x84, 0x08, 0xb6, 0xc6, 0x1c, 0x51, 0x83, 0x69, 0xa5, 0xef, 0xd4,
+    0xe7, 0x24, 0xd4, 0x42, 0xa4, 0x99, 0xfa, 0x71, 0xd5, 0x3e, 0x7f, 0xcb, 0x6a, 0x2b, 0x13, 0xdd,
+    0xe1, 0x40, 0x04, 0xdc, 0xf3, 0xf5, 0x82, 0xd9, 0x47, 0xe2, 0xf1, 0x91, 0xd5, 0x76, 0x06, 0x3b,
+    0x5f, 0xe9, 0x40, 0x73, 0x6f, 0x3a, 0x64, 0xa4, 0xf1, 0x0a, 0xae, 0x52, 0xd3, 0x31, 0x14, 0x92,
+    0x46, 0x3c, 0x81, 0xa4, 0x0a, 0x43, 0x2e, 0x8f, 0xb9, 0xac, 0x28, 0x39, 0xd9, 0x1f, 0x10, 0xa8,
+    0xfc, 0x09, 0x1f, 0x01, 0x8b, 0x8c, 0xa7, 0x16, 0xa0, 0x52, 0x05, 0xca, 0xbd, 0xac, 0x1c, 0x1f,
+    0x1d, 0xd7, 0x8a, 0x35, 0x1e, 0x33, 0xd3, 0x0b, 0x6b, 0x0e, 0x22, 0x4c, 0x2e, 0x64, 0x99, 0xe6,
+    0x75, 0x22, 0x7c, 0xc0, 0x4c, 0x2b, 0x84, 0xd8, 0x24, 0xac, 0x1c, 0xab, 0xe9, 0x69, 0x25, 0xff,
+    0x79, 0xe7, 0xec, 0x14, 0x40, 0xa4, 0xc1, 0x65, 0x71, 0x35, 0x6a, 0x57, 0xcb, 0xd2, 0x0c, 0x14,
+    0x5d, 0x52, 0xbe, 0x16, 0xec, 0xf0, 0x18, 0x8f, 0x2b, 0xb7, 0xb3, 0xb3, 0xe7, 0x1c, 0xb1, 0x06,
+    0x63, 0xa5, 0xe9, 0x40, 0xa1, 0x73, 0x3a, 0x3c, 0xeb, 0xf1, 0x0a, 0xf0, 0x0d, 0xc0, 0x21, 0xc5,
+    0x6f, 0x3a, 0x4a, 0xb4, 0xd1, 0x88, 0x1f, 0xbb, 0x54, 0x81, 0x55, 0xe3, 0x31, 0xd0, 0xad, 0x25,
+    0xa7, 0x45, 0xfc, 0x01, 0xed, 0xfc, 0xe2, 0x23, 0x7f, 0x82, 0xf1, 0x04, 0x39, 0x58, 0xaa, 0x8e,
+    0x29, 0x1d, 0x97, 0x22, 0x47, 0x1e, 0x7b, 0x64, 0x0b, 0x6b, 0xd4, 0x80, 0x4c, 0x4e, 0x60, 0x95,
+    0xe6, 0x55, 0x00, 0x7e, 0xc0, 0x01, 0xcd, 0x70, 0xf8, 0x93, 0x83, 0x10, 0x5d, 0xe2, 0x95, 0xe3,
+    0x23, 0x4b, 0xad, 0xf4, 0x0d, 0xef, 0x9c, 0xd8, 0x71, 0x88, 0x34, 0xd7, 0x26, 0xae, 0x42, 0x4d,
+    0x6d, 0x59, 0x76, 0x61, 0xa2, 0xeb, 0x3c, 0x71, 0x80, 0x11, 0x1f, 0x5c, 0x30, 0x23, 0x56, 0x3c,
+    0x06, 0x6f, 0x1d, 0xea, 0x00, 0x62, 0x70, 0x3a, 0x48, 0x47, 0xf3, 0x8a, 0x04, 0x91, 0xd3, 0x21,
+    0x4c, 0xf9, 0x48, 0x00, 0x5d, 0xa7, 0xca, 0x56, 0xfd, 0x8e, 0xd1, 0x7d, 0x34, 0x39, 0xdb, 0x8f,
+    0x0f, 0xe8, 0x13, 0x27, 0x1f, 0xd9, 0xa5, 0x8c, 0x27, 0xf9, 0x09, 0x66, 0x85, 0xe1, 0xf9, 0xb8,
+    0xe2, 0x04, 0x6d, 0x17, 0x9d, 0x1e, 0x1e, 0xa3, 0x5a, 0x13, 0x6b, 0xa4, 0x0a, 0x4c, 0x4e, 0x09,
+    0xa6, 0xe6, 0x5d, 0xf7, 0x7d, 0xc0, 0x87, 0x24, 0x84, 0x68, 0xa0, 0x29, 0x1f, 0xab, 0x30, 0x6a,
+    0xa5, 0x09, 0xf0, 0xb6, 0x24, 0xfc, 0xf0, 0x9c, 0x31, 0xb2, 0x88, 0x34, 0x44, 0x1f, 0xae, 0x2a,
+    0x4f, 0x70, 0x59, 0x3a, 0x1e, 0xa2, 0xfb, 0xf4, 0xf0, 0x82, 0x01, 0x97, 0x2f, 0xf2, 0x91, 0xa1,
+    0x76, 0x06, 0x94, 0xc5, 0xe8, 0xa0, 0xcf, 0x67, 0x3a, 0xa4, 0x7d, 0xf0, 0x8a, 0x46, 0x0d, 0xd3,
+    0x41, 0xcb, 0xfa, 0x48, 0x7e, 0xc2, 0xa3, 0x0a, 0x06, 0x36, 0x5e, 0xd1, 0xd4, 0xe1, 0x31, 0x42,
+    0x16, 0x25, 0x27, 0x38, 0xe7, 0x01, 0xf1, 0x7a, 0xe2, 0xa3, 0xf2, 0xf4, 0xf0, 0xa4, 0xf3, 0xc3,
+    0xac, 0x3c, 0x5d, 0x69, 0x17, 0xf5, 0x32, 0x1e, 0x33, 0x82, 0x08, 0x6b, 0xc8, 0xa9, 0x4b, 0x0e,
+    0x65, 0x95, 0xe6, 0xe5, 0x50, 0x79, 0x40, 0x9d, 0x20, 0x84, 0x18, 0x60, 0x13, 0x1f, 0x69, 0x54,
+    0x69, 0xa5, 0xcd, 0xe4, 0xb6, 0x2c, 0x28, 0xed, 0x9c, 0xb7, 0x73, 0x87, 0x34, 0xa4, 0x26, 0xae,
+    0x06, 0xf0, 0x68, 0xd9, 0x48, 0x52, 0xa2, 0x7b, 0xc3, 0xd5, 0x82, 0x89, 0x74, 0x2f, 0xf2, 0x63,
+    0x8d, 0x76, 0x06, 0xbf, 0x5d, 0xc2, 0x60, 0xe4, 0x9e, 0x35, 0xcc, 0xec, 0x54, 0x0a, 0xf4, 0x2a,
+    0xc0, 0x91, 0x13, 0x88, 0x46, 0x5c, 0x9b, 0xa6, 0x8a, 0x34, 0x04, 0x8f, 0x71, 0x5f, 0xf6, 0x37,
+    0xb1, 0xf3, 0xe8, 0x47, 0x1d, 0x39, 0x1a, 0x4d, 0xac, 0xf0, 0x26, 0xbb, 0x93, 0x52, 0x25, 0x1d,
+    0xf0, 0xb8, 0x0a, 0x6c, 0xf1, 0x58, 0x90, 0xb3, 0x4e, 0x0b, 0x09, 0x0e, 0x6b, 0x32, 0x3d, 0x25,
+    0x4e, 0x4f, 0xc1, 0xe1, 0x3d, 0xd7, 0xe0, 0x3f, 0xac, 0xcb, 0x70, 0xd8, 0x28, 0xae, 0x1c, 0x8b,
+    0x71, 0x6a, 0xe5, 0x60, 0x6a, 0xe7, 0x2c, 0x27, 0x0e, 0xa3, 0xe2, 0x0b, 0x4a, 0x35, 0xa5, 0x1a,
+    0xae, 0xda, 0x80, 0xd2, 0xd8, 0x0f, 0xd3, 0x8e, 0x9b, 0xd0, 0x74, 0x80, 0x3d, 0x70, 0xe2, 0x31,
+    0x62, 0x8d, 0x76, 0x06, 0x4b, 0x2b, 0xc2, 0x60, 0xf6, 0x7a, 0x35, 0x18, 0xed, 0x56, 0x8a, 0xd6,
+    0x51, 0xbf, 0xf1, 0x72, 0x92, 0x46, 0x2c, 0x95, 0xa3, 0x0a, 0xb3, 0x0d, 0x8f, 0x39, 0x67, 0xf5,
+    0x37, 0x44, 0x4c, 0x25, 0xe7, 0x66, 0xf5, 0xfc, 0x24, 0x1d, 0x49, 0xa3, 0xea, 0x45, 0xdd, 0x24,
+    0x2e, 0x5a, 0xaa, 0x08, 0xaa, 0x1b, 0x97, 0xb2, 0x25, 0x1e, 0x0b, 0x28, 0x0b, 0x6b, 0xf2, 0x1c,
+    0x24, 0xee, 0xc0, 0xc7, 0xe1, 0xe1, 0x83, 0xdc, 0x3f, 0x03, 0xb7, 0x70, 0xe8, 0x4a, 0xa8, 0x1c,
+    0xcf, 0x7e, 0x68, 0x65, 0x40, 0x85, 0xe7, 0x14, 0x83, 0x00, 0xa3, 0x09, 0x00, 0x87, 0xb4, 0xd5,
+    0x52, 0xa9, 0x26, 0x4f, 0xcd, 0x58, 0x80, 0xc4, 0x8e, 0x2b, 0x50, 0x6e, 0x80, 0xa1, 0x65, 0xe0,
+    0x71, 0xc1, 0xa1, 0x76, 0x06, 0xf8, 0x15, 0xc4, 0x00, 0x63, 0x8c, 0x35, 0x08, 0xbe, 0x4c, 0x87,
+    0x0c, 0x77, 0x4b, 0xf1, 0xca, 0xff, 0x37, 0x70, 0x3b, 0xd3, 0xc8, 0x92, 0xe2, 0x54, 0x41, 0x6a,
+    0xe4, 0x31, 0xac, 0xcd, 0x26, 0xa7, 0x14, 0x22, 0xfd, 0x8c, 0x6d, 0x4a, 0x23, 0x7c, 0x50, 0xde,
+    0x04, 0xb2, 0x56, 0xaa, 0x08, 0x13, 0x20, 0x17, 0x2b, 0x26, 0x1e, 0xcb, 0x9d, 0x18, 0x6b, 0x88,
+    0x82, 0x25, 0xae, 0xd8, 0x83, 0xc9, 0x3d, 0x06, 0x3a, 0xbc, 0x47, 0x8e, 0xfc, 0x37, 0x59, 0x16,
+    0x0e, 0xd5, 0xe8, 0x98, 0xa3, 0x7a, 0x2c, 0xad, 0x3c, 0x26, 0xfb, 0x9c, 0xb4, 0x41, 0x88, 0x94,
+    0x76, 0x5e, 0xa9, 0x0a, 0x41, 0xd4, 0xd8, 0x78, 0xff, 0x8e, 0x3b, 0x88, 0x83, 0x80, 0xad, 0xcf,
+    0xe2, 0xb1, 0x3c, 0xc1, 0x76, 0x06, 0xa9, 0xcd, 0xe8, 0x60, 0xb4, 0x8f, 0x35, 0x64, 0xa8, 0x54,
+    0x0a, 0x10, 0xb5, 0xbf, 0x51, 0xed, 0x8b, 0x46, 0xb0, 0x23, 0xa4, 0x4a, 0x28, 0x18, 0x8f, 0xc1,
+    0xef, 0x26, 0x39, 0xa4, 0xe9, 0xe8, 0x67, 0xc6, 0xf9, 0x01, 0xfd, 0x05, 0x45, 0xa3, 0x7e, 0x08,
+    0x7c, 0xe4, 0xf1, 0xbb, 0x9b, 0x10, 0xb4, 0x49, 0x15, 0x7c, 0x9c, 0xe3, 0x9a, 0x16, 0xc3, 0x63,
+    0xfb, 0x68, 0x61, 0xed, 0xd8, 0x73, 0xc9, 0x81, 0xde, 0x37, 0x3c, 0x2f, 0xb1, 0xfb, 0x67, 0x89,
+    0x18, 0x0e, 0x3d, 0x6b, 0x94, 0x23, 0x79, 0x3b, 0xad, 0x84, 0x4b, 0xeb, 0x9c, 0xcb, 0xf2, 0x87,
+    0x94, 0x2b, 0x4b, 0xa9, 0xde, 0xcd, 0xc3, 0x55, 0x05, 0xae, 0x19, 0xab, 0x2a, 0xdf, 0x71, 0xe3,
+    0x86, 0x0c, 0xf0, 0x96, 0x51, 0x3c, 0x06, 0x7a, 0x9f, 0xea, 0x80, 0xf4, 0x71, 0x3a, 0xf8, 0xde,
+    0x58, 0x0a, 0x99, 0x29, 0xc0, 0xc1, 0xea, 0x71, 0x3a, 0x06, 0x95, 0xd2, 0x08, 0xe7, 0xdc, 0x54,
+    0x51, 0xc9, 0xe5, 0x31, 0x97, 0x3a, 0x26, 0x87, 0x9e, 0x09, 0x02, 0xe5, 0xfa, 0xe3, 0x23, 0xb5,
+    0x63, 0xde, 0x24, 0x2d, 0x56, 0xaa, 0x18, 0x5d, 0x1f, 0x57, 0xc0, 0x3e, 0x1e, 0x53, 0xa3, 0x12,
+    0x6b, 0x35, 0x9c, 0x4c, 0x6e, 0x7c, 0xa4, 0xe6, 0x59, 0x87, 0xe4, 0xbf, 0xb9, 0x02, 0x10, 0xa8,
+    0x86, 0x18, 0x0e, 0x81, 0xb5, 0x10, 0x22, 0x24, 0xfd, 0x72, 0xf4, 0xfe, 0xa8, 0x95, 0xc1, 0xaa,
+    0x9e, 0x53, 0x7a, 0x14, 0x91, 0x5a, 0xa6, 0xc6, 0xd5, 0xef, 0xeb, 0x2d, 0xeb, 0x41, 0xe4, 0x71,
+    0xa9, 0x21, 0x0f, 0x30, 0x6b, 0x75, 0x3c, 0x06, 0x92, 0xd0, 0xea, 0x40, 0x38, 0x67, 0x3a, 0x8c,
+    0x42, 0xf7, 0x8a, 0x24, 0x17, 0xc0, 0x71, 0x71, 0x6c, 0x3a, 0x3c, 0x6e, 0xd2, 0x48, 0x80, 0xf1,
+    0x54, 0xe9, 0x12, 0xe1, 0x31, 0x5c, 0x15, 0x27, 0xe7, 0x9e, 0xee, 0x01, 0x4d, 0xf6, 0xe7, 0xa3,
+    0x28, 0x82, 0xf1, 0x44, 0xf9, 0x59, 0xaa, 0x7e, 0x78, 0x1f, 0x57, 0xce, 0xa3, 0xed, 0x62, 0xcf,
+    0xc5, 0x63, 0xe9, 0xd4, 0x62, 0x6d, 0xba, 0x85, 0xc9, 0x09, 0x5c, 0xd6, 0x3c, 0xcb, 0xe1, 0x0f,
+    0x48, 0xcf, 0x85, 0x10, 0x9d, 0x77, 0x98, 0x63, 0xd8, 0x31, 0xad, 0x64, 0xf2, 0xf8, 0x9c, 0xd8,
+    0x61, 0x88, 0x54, 0x6b, 0x38, 0xae, 0xea, 0x07, 0x70, 0x59, 0x4c, 0x4b, 0xa2, 0xeb, 0x32, 0x88,
+    0x80, 0x47, 0xcd, 0x5e, 0x30, 0x30, 0x3f, 0x3c, 0x06, 0xdf, 0x81, 0xc3, 0x60, 0x22, 0x98, 0x35,
+    0x9c, 0xef, 0x58, 0x0a, 0x0e, 0x20, 0xc0, 0x01, 0x27, 0x94, 0x46, 0xdc, 0xd8, 0xa6, 0x8a, 0x55,
+    0x7a, 0x85, 0x49, 0x4e, 0xe5, 0x31, 0x87, 0x1a, 0xff, 0x86, 0x72, 0x2f, 0xfd, 0xf4, 0xd3, 0x47,
+    0xa3, 0xa6, 0x6d, 0xde, 0xf4, 0x40, 0x53, 0xaa, 0x84, 0xad, 0x1f, 0x17, 0xf9, 0x8a, 0x14, 0xab,
+    0x23, 0xc6, 0x63, 0x4b, 0x3c, 0x3b, 0xcd, 0x32, 0xb8, 0xc4, 0x79, 0xaf, 0x38, 0x3c, 0xde, 0x85,
+    0xfc, 0x67, 0x19, 0x18, 0x0e, 0x61, 0xdf, 0x97, 0xa3, 0x35, 0x44, 0xad, 0x8c, 0xd9, 0xbc, 0x9b,
+    0xab, 0xa7, 0x9e, 0x93, 0xa6, 0x37, 0x8c, 0x2e, 0x5f, 0x22, 0xd2, 0xd5, 0x5e, 0xa5, 0x1a, 0xdc,
+    0x4c, 0x63, 0x6b, 0x6e, 0x3c, 0x6e, 0xc2, 0xe2, 0x01, 0x06, 0xdc, 0x83, 0xe8, 0x80, 0xdf, 0x8e,
+    0x35, 0xc0, 0xce, 0x53, 0x0a, 0x7c, 0xaa, 0xbf, 0x61, 0x04, 0x89, 0x46, 0xca, 0xf3, 0xa3, 0xca,
+    0x9f, 0x0b, 0x8f, 0x79, 0x8a, 0x26, 0x39, 0x11, 0xaa, 0xe8, 0xe7, 0xc0, 0xf1, 0x01, 0x95, 0xe7,
+    0x44, 0xa3, 0x39, 0x08, 0x7c, 0xa4, 0x77, 0xb7, 0x9b, 0xc0, 0x9c, 0x49, 0x95, 0x6d, 0x8d, 0xe3,
+    0xb2, 0x41, 0xc2, 0x63, 0x06, 0x44, 0x61, 0x0d, 0x9f, 0x6d, 0xc9, 0x21, 0xdc, 0x37, 0x3c, 0xc6,
+    0x58, 0x9a, 0xc7, 0x01, 0x71, 0xff, 0x40, 0x14, 0xc3, 0x21, 0x92, 0x7b, 0x72, 0x1c, 0x39, 0xa7,
+    0x95, 0x50, 0x32, 0x9d, 0x73, 0xd9, 0xfb, 0x90, 0xe6, 0xad, 0x28, 0xd5, 0x53, 0x62, 0xb8, 0xaa,
+    0x53, 0x34, 0x63, 0x39, 0x7d, 0x3b, 0x6e, 0x55, 0x8e, 0x01, 0x06, 0xe6, 0x8e, 0xe8, 0x40, 0x00,
+    0x5c, 0x3a, 0xa4, 0x76, 0xf0, 0x0a, 0x85, 0x4a, 0xbf, 0xa1, 0xa2, 0x59, 0x3a, 0x9a, 0x7d, 0xd1,
+    0x08, 0x36, 0xe8, 0x23, 0x01, 0xf9, 0x8d, 0x2a, 0x90, 0xc7, 0x3b, 0x06, 0xc1, 0xa7, 0xe4, 0x28,
+    0x02, 0x3a, 0xa0, 0xb6, 0x6b, 0x7c, 0x84, 0xa4, 0x14, 0x9e, 0xcc, 0x9b, 0x4a, 0xd5, 0x73, 0x6f,
+    0xe3, 0x52, 0xa9, 0xa3, 0x5d, 0x01, 0x28, 0x78, 0x6c, 0x79, 0x2b, 0xac, 0xbd, 0x35, 0x2b, 0xb9,
+    0xd1, 0x7b, 0x9a, 0x37, 0x9d, 0xda, 0x01, 0xa5, 0xd8, 0xc2, 0x61, 0x67, 0x14, 0x42, 0x74, 0xac,
+    0x50, 0x8e, 0x49, 0xed, 0xf0, 0xd1, 0xe5, 0x86, 0x56, 0xf6, 0xa2, 0x76, 0xce, 0xbe, 0x7c, 0x43,
+    0x3a, 0xd8, 0x11, 0x57, 0xa1, 0x1f, 0xb4, 0xec, 0xad, 0x0e, 0xd1, 0x05, 0xc2, 0xb4, 0x26, 0x00,
+    0x8f, 0x20, 0x1d, 0xbc, 0x4f, 0x4e, 0x87, 0xf4, 0xf2, 0x5d, 0xf1, 0xe1, 0x6e, 0x3a, 0x58, 0x5d,
+    0x1e, 0x49, 0x68, 0x78, 0x5e, 0xd9, 0x15, 0x16, 0x33, 0x0b, 0x4b, 0x25, 0x07, 0xfd, 0xf6, 0x01,
+    0x3d, 0x10, 0xe1, 0x23, 0x4c, 0x7b, 0xf1, 0x34, 0x0a, 0xba, 0xac, 0xf6, 0xa3, 0x6b, 0xd7, 0xda,
+    0xcb, 0x27, 0xf3, 0x82, 0x0c, 0x6b, 0xa7, 0x8e, 0x88, 0x2d, 0xb4, 0x78, 0xc9, 0x29, 0xbb, 0xca,
+    0xb9, 0x32, 0x61, 0x9a, 0xf7, 0x6a, 0xec, 0x01, 0x89, 0x8d, 0x10, 0xa2, 0xcf, 0x5e, 0x7c, 0xac,
+    0x0e, 0xdf, 0x96, 0x36, 0x47, 0xc4, 0x73, 0xfe, 0x0a, 0x91, 0xaa, 0xf6, 0xc2, 0xd5, 0x3a, 0xbb,
+    0xcb, 0x1a, 0xeb, 0xb2, 0x65, 0x19, 0xb9, 0x88, 0xae, 0x48, 0x75, 0x0b, 0x06, 0x5a, 0xc1, 0xe8,
+    0x60, 0x78, 0x6a, 0x3a, 0x50, 0xc6, 0x54, 0x8a, 0xc4, 0x04, 0x5e, 0x01, 0x4b, 0xf3, 0x37, 0xd2,
+    0x86, 0xd1, 0x08, 0xd3, 0x7e, 0x54, 0x29, 0x9b, 0xe1, 0x31, 0x40, 0x19, 0x25, 0xe7, 0x27, 0xe9,
+    0x01, 0xf5, 0x8e, 0x47, 0xa3, 0x68, 0x49, 0x7c, 0x54, 0x7a, 0xad, 0x9b, 0xc8, 0x0a, 0xc4, 0x13,
+    0x0d, 0x5e, 0xa9, 0x02, 0xe4, 0x6d, 0x5c, 0xef, 0xcf, 0x78, 0x8c, 0x26, 0x21, 0xac, 0x75, 0xff,
+    0x2e, 0x39, 0x2c, 0x4f, 0x9a, 0x07, 0xde, 0x72, 0xff, 0x7a, 0x1a, 0xc3, 0xa1, 0x10, 0x8b, 0x72,
+    0x8c, 0x2f, 0xa6, 0x95, 0x4e, 0x8c, 0x9d, 0x73, 0xa2, 0xf3, 0x90, 0xfe, 0x6c, 0xc4, 0x55, 0x0f,
+    0xb2, 0x19, 0x9b, 0xc0, 0xa5, 0x65, 0x53, 0x4e, 0x3b, 0xee, 0xbf, 0x25, 0xd1, 0x05, 0x3c, 0x03,
+    0xea, 0x20, 0x27, 0x71, 0x3a, 0x54, 0xd0, 0xf2, 0x0a, 0xe9, 0x92, 0xd3, 0x71, 0x21, 0xf8, 0x48,
+    0x76, 0x37, 0xa7, 0x0a, 0xa1, 0xfe, 0x8e, 0xb9, 0xab, 0x15, 0x33, 0x5c, 0x6f, 0x26, 0x47, 0x32,
+    0xf3, 0x01, 0xc1, 0x5e, 0xe4, 0x23, 0x99, 0x97, 0xf1, 0x34, 0xf4, 0xbf, 0xac, 0xc2, 0xf8, 0x6c,
+    0x57, 0x52, 0x1d, 0x1e, 0x53, 0x65, 0xfa, 0x64, 0x7d, 0x57, 0x62, 0xed, 0xbc, 0x80, 0xc9, 0xc5,
+    0x8a, 0xd4, 0x3c, 0x91, 0xb8, 0x0f, 0x58, 0x84, 0x84, 0x10, 0xb3, 0xff, 0xe4, 0x63, 0x75, 0x47,
+    0xad, 0x5c, 0x3d, 0xde, 0x96, 0x77, 0x04, 0x9e, 0x13, 0xde, 0xa6, 0x78, 0x92, 0xca, 0x22, 0x52,
+    0x6d, 0x76, 0xb8, 0xaa, 0x72, 0xc0, 0x65, 0xb9, 0x7a, 0x88, 0xae, 0xe1, 0xbc, 0x0b, 0x06, 0x56,
+    0x94, 0xc2, 0x00, 0xe9, 0x9c, 0x35, 0xf4, 0x6b, 0x4e, 0x07, 0x66, 0xcc, 0x4a, 0xd1, 0x8e, 0x01,
+    0x38, 0xb0, 0xf9, 0xd1, 0xc8, 0xea, 0xba, 0x54, 0x49, 0x61, 0xe4, 0x31, 0x32, 0xad, 0x25, 0xa7,
+    0xd9, 0x21, 0xfd, 0x88, 0x12, 0x40, 0x20, 0x21, 0xfe, 0x68, 0xb4, 0x13, 0xc0, 0x9b, 0x8a, 0x14,
+    0x4b, 0xd5, 0xb2, 0xab, 0xe3, 0x12, 0x3e, 0xc9, 0x63, 0x32, 0x7f, 0x61, 0x0d, 0xb3, 0xb3, 0xc4,
+    0x89, 0x4c, 0x32, 0xb9, 0x6d, 0xfc, 0x86, 0x37, 0x66, 0x4b, 0xf3, 0xac, 0xdc, 0xf0, 0x1f, 0xee,
+    0x65, 0x38, 0xa4, 0xc9, 0x58, 0x8e, 0x30, 0x29, 0xb5, 0xf2, 0xde, 0xc0, 0x73, 0x62, 0xbe, 0x21,
+    0xd2, 0xde, 0x41, 0xa5, 0xba, 0x97, 0x15, 0x57, 0x87, 0x88, 0x68, 0x6c, 0xe0, 0x84, 0xc7, 0x05,
+    0x0b, 0x66, 0xea, 0xc0, 0x99, 0x65, 0x3a, 0x28, 0xb9, 0xf5, 0x0a, 0x09, 0x06, 0xc0, 0x41, 0x12,
+    0x6b, 0x3a, 0x70, 0xd4, 0xd1, 0x88, 0x4a, 0x08, 0x24, 0x41, 0x09, 0x9d, 0x2a, 0xfb, 0xd5, 0x3b,
+    0x46, 0x55, 0xde, 0xe4, 0x68, 0xa7, 0x3c, 0x20, 0xeb, 0xed, 0x7c, 0xb4, 0xfc, 0x2b, 0x9e, 0x22,
+    0xaf, 0x4a, 0x95, 0x98, 0xe7, 0xe3, 0xaa, 0xbb, 0xb2, 0x5d, 0x1f, 0x62, 0x78, 0xac, 0x24, 0x59,
+    0xac, 0x89, 0x29, 0x2f, 0xb9, 0xc3, 0xcb, 0x9a, 0x57, 0xa1, 0xf5, 0x01, 0x57, 0xb7, 0x10, 0x22,
+    0x23, 0xf5, 0x72, 0x64, 0x7c, 0x96, 0x8f, 0x9d, 0xb6, 0xb4, 0x32, 0x09, 0xd8, 0x73, 0x32, 0x24,
+    0x21, 0x52, 0x79, 0xb5, 0xb8, 0x6a, 0x72, 0xbe, 0x65, 0x1f, 0x7c, 0x88, 0xee, 0x16, 0x17, 0x02,
+    0x06, 0x79, 0x68, 0xc1, 0x60, 0x25, 0x05, 0x1d, 0x18, 0x6c, 0xaf, 0x06, 0x61, 0x83, 0x4a, 0x61,
+    0x8d, 0xe8, 0x37, 0xa4, 0x27, 0xd1, 0xc8, 0x6a, 0x5f, 0x54, 0x51, 0x96, 0xde, 0x31, 0x5d, 0x02,
+    0xfe, 0xa6, 0xb7, 0x9a, 0xe4, 0x50, 0x81, 0x9e, 0x1f, 0xbb, 0xc8, 0x68, 0x44, 0x4a, 0xa7, 0x9b,
+    0x56, 0xe7, 0x49, 0x15, 0x37, 0x6a, 0xe3, 0xba, 0xaa, 0xbf, 0x63, 0xff, 0x90, 0x3a, 0xcd, 0x3f,
+    0x26, 0xac, 0x6d, 0xa7, 0x8d, 0x38, 0x4b, 0x52, 0x25, 0x87, 0x5b, 0xe2, 0xf0, 0x14, 0xb2, 0xec,
+    0x5f, 0xe9, 0x5c, 0x38, 0xfc, 0x81, 0x4d, 0x8e, 0x46, 0x59, 0xb4, 0xb2, 0xc2, 0xa8, 0x73, 0xda,
+    0x77, 0x7f, 0xd1, 0x13, 0x84, 0x43, 0x1a, 0xa9, 0xa1, 0x54, 0x6f, 0xb3, 0xe1, 0x2a, 0xcc, 0xbb,
+    0x8c, 0x05, 0xfd, 0x1d, 0xe9, 0xa0, 0x3c, 0x59, 0x3a, 0x7c, 0xba, 0xf2, 0x0a, 0x7a, 0xc8, 0xd2,
+    0x01, 0x1e, 0x92, 0x46, 0x46, 0x42, 0x20, 0xc9, 0xb5, 0x7d, 0x54, 0xd9, 0x3a, 0xe0, 0x31, 0x1a,
+    0x8d, 0x25, 0xe7, 0xf3, 0xd5, 0x01, 0xbd, 0xad, 0xe4, 0xa3, 0xcc, 0xc2, 0xf0, 0x14, 0xf8, 0x59,
+    0xaa, 0x3a, 0x21, 0x99, 0x95, 0xf0, 0x7f, 0xe3, 0xda, 0x1d, 0xa6, 0x5d, 0xb1, 0x6b, 0x78, 0x0c,
+    0x99, 0x33, 0xac, 0x71, 0x73, 0x2c, 0xb9, 0x92, 0x92, 0x9a, 0x07, 0x89, 0xe1, 0x01, 0x4d, 0xb9,
+    0x10, 0x62, 0x95, 0xa9, 0x72, 0xec, 0xb2, 0x8b, 0x8f, 0x85, 0x22, 0xb4, 0xb2, 0x9b, 0xc6, 0x73,
+    0x42, 0xed, 0x1b, 0xd2, 0xa0, 0xc9, 0xb8, 0x1a, 0x5f, 0xa3, 0x65, 0x49, 0x1e, 0x89, 0x6e, 0x6a,
+    0xc9, 0x01, 0x06, 0x06, 0x78, 0xe9, 0x40, 0xcd, 0x9e, 0x35, 0xd0, 0xb3, 0x54, 0x0a, 0x73, 0x20,
+    0xc0, 0x31, 0x6c, 0x88, 0x46, 0x8a, 0x46, 0xa6, 0x0a, 0x0d, 0x07, 0x8f, 0x79, 0x8c, 0xf5, 0x37,
+    0x24, 0xd4, 0x25, 0x67, 0xb9, 0x1c, 0xfd, 0xe0, 0xae, 0x3e, 0x20, 0xe0, 0xe4, 0x68, 0xf4, 0x1c,
+    0xc0, 0x9b, 0xf8, 0x75, 0x4a, 0x55, 0xdb, 0xb1, 0xe3, 0x82, 0x65, 0xc6, 0x63, 0xf3, 0x90, 0x61,
+    0xcd, 0x3e, 0xa7, 0xc4, 0x0d, 0xf2, 0x30, 0x39, 0x50, 0x00, 0x87, 0xb7, 0x99, 0x81, 0xff, 0x84,
+    0x34, 0xc3, 0x21, 0x0f, 0xb0, 0x72, 0x8c, 0xc2, 0xa9, 0x95, 0x42, 0x99, 0x9d, 0x93, 0x4d, 0x35,
+    0x8c, 0xb6, 0x66, 0x22, 0x52, 0xc4, 0x09, 0xa5, 0xea, 0xaf, 0x0d, 0x57, 0xa7, 0xe8, 0x68, 0x6c,
+    0xc6, 0x6b, 0xc7, 0x05, 0xb1, 0x08, 0xea, 0xe0, 0x67, 0x60, 0x3a, 0xb0, 0xe1, 0xf4, 0x0a, 0x89,
+    0xcd, 0xbf, 0x11, 0x71, 0x66, 0x3a, 0x5a, 0xeb, 0xd1, 0x88, 0x54, 0xca, 0x54, 0x39, 0x9a, 0xde,
+    0x31, 0xbf, 0x83, 0x26, 0xa7, 0x8c, 0xe2, 0x01, 0x9d, 0xe8, 0xe5, 0x23, 0x37, 0x05, 0xde, 0x34,
+    0x58, 0x2a, 0x9e, 0xa6, 0x47, 0x98, 0x15, 0x4e, 0xe7, 0xe3, 0xe2, 0xd3, 0xbe, 0x63, 0x36, 0xe3,
+    0x62, 0x0d, 0xe3, 0x66, 0xc9, 0x81, 0x09, 0xd7, 0xbc, 0xe5, 0x65, 0x0f, 0x48, 0xaf, 0x15, 0x0e,
+    0x69, 0xeb, 0x10, 0xe2, 0x72, 0xe2, 0x72, 0xbc, 0xb7, 0x92, 0x8f, 0x8b, 0x7a, 0xb4, 0xd2, 0xba,
+    0xd3, 0x73, 0x86, 0xc2, 0x1f, 0xd2, 0xb5, 0xaf, 0xb8, 0x9a, 0x37, 0xb8, 0x65, 0x7b, 0x57, 0x88,
+    0x2e, 0x0f, 0xfb, 0x01, 0x06, 0xab, 0xb2, 0xc1, 0x80, 0xaa, 0x7a, 0x35, 0xd0, 0x3c, 0x55, 0x0a,
+    0x79, 0x3d, 0xbf, 0x01, 0xc5, 0x8e, 0x46, 0xc8, 0xae, 0xa2, 0x4a, 0xf7, 0x56, 0x85, 0x21, 0x4e,
+    0xe2, 0x31, 0xa6, 0xd1, 0xfd, 0xe6, 0x8a, 0x93, 0xe4, 0x50, 0x8f, 0xa0, 0x1f, 0xca, 0xb5, 0x68,
+    0x44, 0xd5, 0xad, 0x9b, 0xe6, 0xd2, 0x49, 0x55, 0x05, 0x7a, 0xe3, 0xea, 0x8c, 0xc0, 0x63, 0x6b,
+    0x8a, 0x3a, 0x8d, 0x37, 0x2a, 0xac, 0x1d, 0x18, 0x8f, 0xb8, 0x5b, 0x6e, 0x25, 0x47, 0x8d, 0xe1,
+    0xf0, 0xb0, 0x4f, 0xed, 0x9f, 0xed, 0x5b, 0x38, 0x64, 0x76, 0x4f, 0x8e, 0x49, 0x61, 0xb4, 0xb2,
+    0x5d, 0xb0, 0x73, 0x1e, 0x25, 0x1c, 0xd2, 0x61, 0x3d, 0xa5, 0x2a, 0x28, 0x2c, 0x63, 0xb7, 0x78,
+    0x3b, 0x6e, 0x71, 0x88, 0x01, 0x06, 0x72, 0x1d, 0xe9, 0xa0, 0x70, 0x74, 0x35, 0xa0, 0xd8, 0x4a,
+    0x07, 0xbd, 0xe7, 0x4a, 0xc1, 0x43, 0xca, 0x2b, 0xf0, 0x94, 0xfd, 0xc6, 0xf4, 0x36, 0x1a, 0xd1,
+    0x2c, 0x92, 0x2a, 0x2b, 0x99, 0x3b, 0xc6, 0x33, 0xbb, 0xe4, 0x54, 0xa1, 0x39, 0xa0, 0x58, 0x1f,
+    0x69, 0x24, 0x4c, 0x94, 0x8f, 0xbe, 0xce, 0x75, 0x53, 0x01, 0x66, 0x78, 0x9a, 0xa0, 0x28, 0x55,
+    0x65, 0x86, 0x8e, 0x8b, 0x25, 0xf7, 0x8e, 0x01, 0x88, 0x88, 0x35, 0xe2, 0x4c, 0x25, 0x87, 0xd6,
+    0xe8, 0xf0, 0xec, 0xf4, 0x6a, 0xde, 0x1e, 0xc5, 0xfd, 0x4b, 0x12, 0xef, 0x80, 0x98, 0x53, 0xe1,
+    0x90, 0x93, 0x55, 0x39, 0x42, 0x47, 0xd0, 0x4a, 0x79, 0x12, 0xcf, 0x79, 0x4b, 0x72, 0x48, 0xf7,
+    0x89, 0xe2, 0x2a, 0x8a, 0xf4, 0x8c, 0x05, 0xe6, 0x5b, 0xc2, 0xc0, 0xc6, 0x2e, 0x1d, 0x94, 0x30,
+    0xb3, 0x06, 0x17, 0xa1, 0x4a, 0x61, 0xfa, 0x01, 0x38, 0xa2, 0x1d, 0xd1, 0xc8, 0x19, 0xc3, 0x54,
+    0xa9, 0x2b, 0xe1, 0x31, 0x73, 0xb3, 0x25, 0x27, 0x70, 0x23, 0xfd, 0xb0, 0xc3, 0x45, 0xa3, 0x0a,
+    0x2c, 0xde, 0x64, 0x2d, 0x4d, 0xaa, 0xbc, 0x60, 0x1e, 0x97, 0x71, 0x19, 0x1e, 0x93, 0xf8, 0xd6,
+    0x69, 0xa9, 0xe9, 0x61, 0xcd, 0x68, 0xa1, 0xc4, 0x7d, 0x9f, 0x2f, 0xb9, 0xce, 0x06, 0x87, 0x97,
+    0xfd, 0x80, 0xff, 0x32, 0x1b, 0xc3, 0x21, 0x56, 0xb2, 0x72, 0x1c, 0x19, 0xa9, 0x95, 0x4d, 0x9b,
+    0x9d, 0xf3, 0xb1, 0x30, 0x8c, 0x2a, 0x30, 0x22, 0xd2, 0x0c, 0x10, 0xa5, 0x1a, 0x01, 0x0d, 0x57,
+    0xa5, 0xad, 0x68, 0xac, 0x2d, 0x70, 0xc7, 0x05, 0x5b, 0x5e, 0xea, 0x60, 0x97, 0x5c, 0x3a, 0x14,
+    0xc7, 0xf6, 0x8a, 0x4a, 0xb0, 0xbf, 0x21, 0x0f, 0x63, 0x3a, 0xd0, 0x12, 0xd3, 0x08, 0xa5, 0xbd,
+    0x54, 0x99, 0x62, 0xe2, 0x31, 0x88, 0x69, 0x26, 0x47, 0xda, 0xec, 0x01, 0x61, 0x07, 0xe6, 0x23,
+    0xd4, 0x0f, 0xde, 0xb4, 0xc7, 0x2d, 0x9e, 0x78, 0x47, 0x4a, 0xd5, 0x80, 0x10, 0xb3, 0x72, 0x71,
+    0x7d, 0x5c, 0x25, 0x0e, 0x78, 0x2c, 0xd4, 0x5f, 0xac, 0x11, 0x7e, 0x2d, 0x39, 0xa6, 0xf3, 0x9a,
+    0xe7, 0x84, 0xef, 0x01, 0xd7, 0x1b, 0x11, 0x62, 0xd4, 0xfa, 0x72, 0x5c, 0x89, 0xa2, 0x95, 0x9c,
+    0x22, 0x9f, 0x13, 0xb3, 0xf6, 0x90, 0x06, 0xde, 0xc7, 0x55, 0xdb, 0xa3, 0x2d, 0xcb, 0x3e, 0x4b,
+    0x74, 0xb9, 0xc1, 0x0f, 0xb0, 0x50, 0xb1, 0x0b, 0x06, 0x17, 0xf6, 0xe9, 0x20, 0x9a, 0x70, 0x3a,
+    0x18, 0xb0, 0xf2, 0x8a, 0xbe, 0x8d, 0xd3, 0x61, 0x0b, 0xf8, 0x48, 0x26, 0xf8, 0xa6, 0x8a, 0x82,
+    0xa0, 0x5e, 0x99, 0x51, 0xe0, 0x31, 0x81, 0xba, 0x62, 0x06, 0x2f, 0xc9, 0xe4, 0xe0, 0xaf, 0x3e,
+    0x20, 0xfe, 0x77, 0x7c, 0x94, 0x2f, 0x34, 0x9e, 0x38, 0xb3, 0x97, 0x15, 0x28, 0xa4, 0xed, 0xb2,
+    0xbb, 0xc2, 0x63, 0xca, 0x29, 0x9f, 0x0c, 0xbc, 0x4c, 0xac, 0xa9, 0xad, 0x2f, 0xb9, 0x25, 0x97,
+    0x9a, 0xc7, 0x88, 0xf5, 0x01, 0x87, 0xa1, 0x10, 0x62, 0x47, 0x9a, 0x7c, 0xb4, 0xa6, 0xa8, 0x95,
+    0x14, 0xcc, 0xdb, 0x52, 0x85, 0xa4, 0x78, 0xfe, 0x8d, 0x22, 0xd2, 0x35, 0x78, 0xb8, 0xaa, 0x09,
+    0xbf, 0x65, 0xd7, 0x8c, 0x88, 0x2e, 0x63, 0xb5, 0x0b, 0x06, 0xfb, 0x9b, 0xe9, 0xc0, 0xcd, 0x9d,
+    0x35, 0x64, 0x78, 0x4e, 0x07, 0x46, 0xb3, 0x4a, 0x71, 0xfc, 0x01, 0x38, 0xa6, 0x9b, 0xd1, 0x88,
+    0x5a, 0xbc, 0x54, 0x61, 0xf8, 0xe2, 0x31, 0x28, 0xb1, 0x25, 0x47, 0x88, 0x1d, 0xfd, 0x54, 0x61,
+    0x3f, 0x20, 0xde, 0xf9, 0x68, 0xd4, 0x15, 0xbe, 0x9b, 0xdc, 0xfa, 0x4a, 0x15, 0x06, 0xa5, 0xe3,
+    0x8a, 0xaa, 0xc8, 0x63, 0x9c, 0x6b, 0x61, 0xed, 0x9f, 0xae, 0xc4, 0x35, 0xe7, 0x31, 0x39, 0x11,
+    0xfc, 0x86, 0x37, 0x98, 0x4a, 0xf3, 0x2a, 0x7e, 0xf0, 0xdf, 0xa4, 0x66, 0x38, 0x5c, 0x39, 0x57,
+    0x8e, 0x79, 0x2e, 0xb5, 0x32, 0xbf, 0xba, 0x73, 0xc6, 0xd8, 0x21, 0x52, 0x39, 0x2b, 0xa5, 0x5a,
+    0xa0, 0x12, 0x57, 0x0f, 0x91, 0x68, 0xac, 0x25, 0x7a, 0xc7, 0x05, 0x62, 0x3a, 0xea, 0x40, 0x48,
+    0x65, 0x3a, 0x40, 0x0e, 0xf5, 0x8a, 0x9a, 0xfc, 0xbf, 0x41, 0xb1, 0x6a, 0x3a, 0x10, 0xf4, 0x1f,
+    0x09, 0x0b, 0xe2, 0x54, 0xe1, 0x2c, 0xde, 0x31, 0x2d, 0xd2, 0x26, 0x47, 0xf7, 0xe3, 0x01, 0x55,
+    0xce, 0xe6, 0x23, 0x4a, 0x5d, 0xf1, 0x74, 0xb8, 0xc5, 0xac, 0x0c, 0x46, 0x1f, 0x17, 0x74, 0x95,
+    0xed, 0x22, 0x76, 0xc1, 0x63, 0x3f, 0xce, 0x62, 0xed, 0x23, 0x73, 0xc9, 0x01, 0x71, 0xd6, 0x3c,
+    0xd2, 0x94, 0x0f, 0xd8, 0xfb, 0x85, 0x10, 0x21, 0x3d, 0xe5, 0xa3, 0x31, 0x2c, 0xad, 0xcc, 0xc8,
+    0xf4, 0x9c, 0x14, 0x3f, 0x88, 0x74, 0x16, 0x29, 0xae, 0x02, 0x5f, 0x6f, 0xd9, 0xa6, 0x11, 0xa2,
+    0x4b, 0x66, 0x83, 0x80, 0xdf, 0x72, 0x5e, 0xf0, 0x7d, 0x2c, 0x3c, 0x06, 0x8b, 0x98, 0xc3, 0xe0,
+    0xe2, 0x9d, 0x35, 0xd4, 0x0b, 0x59, 0x8a, 0x8f, 0x3f, 0xc0, 0x61, 0x7b, 0x93, 0x46, 0x1c, 0x80,
+    0xa7, 0x0a, 0x0e, 0x6f, 0x85, 0x81, 0x81, 0xe4, 0x31, 0xdf, 0x8e, 0xff, 0x26, 0x8d, 0x29, 0xfd,
+    0xf0, 0x86, 0x49, 0x23, 0x57, 0x57, 0xde, 0xc4, 0x3b, 0x59, 0xaa, 0xda, 0x60, 0x1f, 0x97, 0x4a,
+    0x9b, 0x14, 0x33, 0xce, 0xc8, 0x63, 0xc4, 0x62, 0x62, 0x6d, 0x7c, 0xbf, 0xc4, 0xed, 0xb7, 0x38,
+    0xbc, 0x64, 0xa1, 0xfc, 0x07, 0xbb, 0x18, 0x0e, 0x9d, 0x41, 0x98, 0x23, 0xb8, 0x49, 0xad, 0x94,
+    0x51, 0xf6, 0x9c, 0xb3, 0x07, 0x62, 0x94, 0xd4, 0x17, 0x91, 0x66, 0x9f, 0x2a, 0x55, 0x46, 0x96,
+    0x1a, 0x1b, 0x55, 0xe1, 0x71, 0x3f, 0xee, 0x0f, 0x70, 0x6a, 0x69, 0x3c, 0x06, 0x83, 0x58, 0xea,
+    0x80, 0xd5, 0x8b, 0x35, 0x38, 0x15, 0x59, 0x8a, 0xa2, 0xf8, 0xbf, 0x81, 0x24, 0x8f, 0x46, 0xcc,
+    0x15, 0xa7, 0x8a, 0xe2, 0xf3, 0x8e, 0x49, 0x47, 0xff, 0x37, 0xe6, 0xe9, 0x26, 0x47, 0xec, 0x0b,
+    0xfd, 0xd4, 0x54, 0x3c, 0xa0, 0xf9, 0x56, 0x69, 0xa4, 0x13, 0xc0, 0x9b, 0x7c, 0xb6, 0x4a, 0x95,
+    0x55, 0xe3, 0xe3, 0xba, 0xaf, 0xc2, 0x63, 0x73, 0xc7, 0x62, 0xad, 0xf5, 0x9b, 0xc4, 0xad, 0xcc,
+    0x2e, 0xb9, 0xd8, 0x48, 0x87, 0xe7, 0xe2, 0x86, 0xff, 0xb8, 0xd3, 0xc2, 0x61, 0xd7, 0xf2, 0x72,
+    0x0c, 0x19, 0xa5, 0x95, 0x49, 0xc6, 0x9e, 0xf3, 0xca, 0x30, 0x8c, 0xd6, 0xb8, 0x20, 0xd2, 0x5f,
+    0xba, 0xb8, 0x6a, 0x4c, 0x51, 0x63, 0x5d, 0x7f, 0x3a, 0xee, 0x0e, 0x16, 0x02, 0x06, 0xd3, 0x92,
+    0xea, 0x00, 0x67, 0x73, 0x3a, 0x3c, 0xf9, 0xf4, 0x8a, 0x9d, 0x39, 0xc0, 0x21, 0xf2, 0x72, 0x3a,
+    0xb0, 0x4f, 0xd2, 0x08, 0x44, 0xe4, 0x54, 0xe1, 0xc5, 0xe4, 0x31, 0x50, 0x58, 0x26, 0x87, 0x18,
+    0x05, 0x02, 0xa5, 0x8b, 0xe4, 0x23, 0xe1, 0xca, 0xf1, 0x44, 0xe7, 0x58, 0xaa, 0x5a, 0xeb, 0x1e,
+    0x57, 0x3a, 0x49, 0x1e, 0xe3, 0x04, 0x11, 0x6b, 0x82, 0xbe, 0x4c, 0xce, 0x1f, 0xa0, 0xe6, 0xf1,
+    0x6e, 0xe4, 0x3f, 0x3a, 0x0d, 0x10, 0xe8, 0x15, 0x19, 0x0e, 0x6d, 0x94, 0x10, 0xe2, 0xad, 0xf7,
+    0x72, 0x2c, 0x91, 0xa9, 0x95, 0xdc, 0x8f, 0x9e, 0x13, 0x28, 0x17, 0x91, 0x32, 0x45, 0xc6, 0x55,
+    0x17, 0xf6, 0x2d, 0x1b, 0x15, 0xe2, 0x71, 0xa9, 0xe6, 0x89, 0x6e, 0x4f, 0xec, 0x01, 0x06, 0xc0,
+    0xe0, 0xe8, 0x40, 0x00, 0x6b, 0x3a, 0xbc, 0x84, 0xf0, 0x8a, 0x3c, 0x26, 0xd3, 0xd1, 0xcf, 0x90,
+    0x46, 0x12, 0x61, 0x1f, 0x09, 0xee, 0x3d, 0x5e, 0x01, 0xd7, 0xe4, 0x31, 0xc8, 0xc2, 0x24, 0xe7,
+    0x55, 0xfb, 0x01, 0x65, 0x9a, 0xe0, 0xa3, 0x7d, 0x59, 0xf1, 0xb4, 0x11, 0xbc, 0xac, 0xba, 0xc1,
+    0x6a, 0x97, 0xcc, 0x23, 0x1e, 0xbb, 0x87, 0xfa, 0x64, 0x4f, 0x57, 0x61, 0xed, 0xbc, 0x74, 0xc9,
+    0x21, 0x30, 0xd3, 0xbc, 0xdd, 0x34, 0x0f, 0x88, 0xc1, 0x85, 0x10, 0xdd, 0x6f, 0xe2, 0x23, 0x6d,
+    0xf1, 0xb6, 0xdc, 0x76, 0xed, 0x9c, 0x20, 0x9a, 0x87, 0x54, 0x24, 0x29, 0xae, 0x2a, 0x0d, 0x69,
+    0x59, 0x5f, 0x71, 0xa2, 0xcb, 0x6d, 0xd2, 0x82, 0xaf, 0x76, 0x30, 0x32, 0xb4, 0x6d, 0x76, 0x06,
+    0x20, 0x8d, 0xc3, 0xc0, 0x67, 0x9c, 0x35, 0x88, 0x08, 0x59, 0x8a, 0xae, 0x32, 0xc0, 0xa1, 0xa9,
+    0x94, 0x46, 0x7e, 0x21, 0xa7, 0x8a, 0x74, 0x78, 0x85, 0xd9, 0x8c, 0xe5, 0x31, 0x05, 0x50, 0xff,
+    0x66, 0xe8, 0xcb, 0xe4, 0x1c, 0xb7, 0xa5, 0x9f, 0x84, 0x19, 0x69, 0x94, 0x11, 0xcc, 0x9b, 0xd8,
+    0xf4, 0x4a, 0x55, 0xdf, 0xeb, 0xe3, 0xc2, 0x6d, 0xc8, 0x63, 0x5c, 0x58, 0x62, 0xcd, 0x50, 0xbf,
+    0xc4, 0x95, 0x8f, 0x38, 0xbc, 0x42, 0x9b, 0xfc, 0x27, 0xa6, 0x18, 0x0e, 0x13, 0x18, 0x98, 0x63,
+    0xfd, 0x48, 0xad, 0xf4, 0xe9, 0xf5, 0x9c, 0xcc, 0xe6, 0x61, 0xd4, 0xe0, 0x15, 0x91, 0x6e, 0x06,
+    0x2b, 0xd5, 0x17, 0x7b, 0x1a, 0x3b, 0xa3, 0xe3, 0x71, 0x6b, 0x6d, 0x0f, 0x30, 0x9c, 0x72, 0x3c,
+    0x06, 0x8e, 0xa7, 0xea, 0xe0, 0x28, 0x90, 0x35, 0xac, 0xc6, 0x4c, 0x87, 0x0e, 0x39, 0x4b, 0x51,
+    0xe7, 0x01, 0x38, 0x42, 0x34, 0xd2, 0x08, 0xd5, 0xed, 0x54, 0x21, 0x0a, 0xe0, 0x31, 0xf9, 0x0b,
+    0x27, 0xa7, 0x15, 0xea, 0x01, 0x41, 0x47, 0x4b, 0xa3, 0x1d, 0x17, 0xde, 0x04, 0xb7, 0x58, 0xaa,
+    0xb6, 0x55, 0x1f, 0x97, 0xcc, 0x26, 0x1e, 0x03, 0x74, 0x16, 0x6b, 0xf4, 0x3a, 0x25, 0x4e, 0xf2,
+    0x80, 0xc9, 0x15, 0x1e, 0x3a, 0x3c, 0x11, 0xcc, 0x9a, 0x37, 0x5c, 0x8c, 0xff, 0xf2, 0xdf, 0xc2,
+    0xa1, 0x34, 0x05, 0x73, 0xac, 0xec, 0xa5, 0x95, 0x85, 0xfd, 0x9e, 0x73, 0x8b, 0x0a, 0x91, 0x82,
+    0x91, 0xc6, 0x55, 0x43, 0xa1, 0x1a, 0xcb, 0x16, 0xd7, 0x71, 0x0b, 0xf5, 0x10, 0x30, 0x84, 0x36,
+    0x3c, 0x06, 0x5c, 0x25, 0xe9, 0xe0, 0x88, 0x56, 0x3a, 0x1c, 0x71, 0x57, 0x8a, 0xd7, 0x55, 0x5e,
+    0xf1, 0x77, 0xec, 0x37, 0xb0, 0xc8, 0xd1, 0x48, 0x0c, 0x91, 0x54, 0x01, 0x0d, 0xdd, 0x31, 0x2d,
+    0xd5, 0x25, 0x27, 0xe8, 0xce, 0x01, 0xd5, 0xe0, 0xe4, 0x23, 0xcf, 0x80, 0xdd, 0x54, 0xf1, 0x1a,
+    0x9e, 0x82, 0xf4, 0x49, 0xd5, 0x5f, 0xa8, 0xe3, 0xca, 0x0d, 0xbd, 0x63, 0x7a, 0x39, 0x62, 0x0d,
+    0x88, 0x51, 0xc9, 0x7d, 0x27, 0xd6, 0x3c, 0x61, 0xef, 0x0e, 0x78, 0x03, 0x15, 0x0e, 0x05, 0x6d,
+    0x95, 0xa3, 0xb6, 0x03, 0xad, 0x9c, 0x6c, 0xf1, 0x9c, 0x07, 0x26, 0x87, 0xf4, 0x2d, 0x29, 0xae,
+    0x12, 0x3c, 0xcf, 0xd8, 0xe6, 0x4b, 0x2d, 0x8b, 0xb4, 0xcf, 0x71, 0xd3, 0x1b, 0x88, 0x6e, 0x45,
+    0xd6, 0x01, 0x06, 0xea, 0xba, 0xea, 0xa0, 0x6f, 0x6a, 0x3a, 0xb4, 0x7a, 0xf6, 0x0a, 0x91, 0x76,
+    0xd3, 0xf1, 0x43, 0x04, 0x49, 0x94, 0xb6, 0xa7, 0x0a, 0xf1, 0x04, 0x8f, 0x29, 0x75, 0x38, 0x39,
+    0x90, 0x7e, 0x0f, 0xa8, 0xe2, 0x3b, 0x1f, 0xa1, 0x56, 0x8c, 0x27, 0x95, 0x4b, 0x66, 0x55, 0x6f,
+    0x69, 0xbb, 0x70, 0x73, 0xf1, 0xd8, 0x15, 0xb0, 0x58, 0xb3, 0xd4, 0x61, 0x72, 0xdf, 0x7a, 0x35,
+    0x0f, 0x7e, 0xf9, 0x03, 0x1e, 0x51, 0x21, 0x44, 0x0c, 0x96, 0xf9, 0xf8, 0x64, 0x4e, 0x2b, 0x69,
+    0x23, 0xb7, 0x25, 0xc9, 0xb9, 0xe7, 0xdc, 0x40, 0x44, 0xa4, 0xda, 0x8e, 0x71, 0x15, 0xc5, 0x83,
+    0xcb, 0xc2, 0xf5, 0x11, 0x5d, 0x01, 0xb5, 0x17, 0xbc, 0x2e, 0x7d, 0x91, 0x63, 0x61, 0xb6, 0x73,
+    0x35, 0x29, 0xb1, 0x06, 0x07, 0x21, 0xea, 0x00, 0xdd, 0x63, 0x3a, 0x9c, 0xd4, 0xf4, 0x8a, 0xe3,
+    0xe8, 0xbf, 0x71, 0x61, 0x69, 0x3a, 0xb0, 0xe9, 0x1f, 0x49, 0xda, 0xd6, 0x54, 0x51, 0x92, 0xde,
+    0x31, 0x38, 0xa2, 0x26, 0xe7, 0x68, 0xe5, 0x01, 0x45, 0x05, 0xe6, 0xa3, 0x97, 0x63, 0xf1, 0x34,
+    0x63, 0xc2, 0xac, 0x68, 0x68, 0x1f, 0x17, 0x50, 0xfe, 0x1d, 0x83, 0x15, 0x17, 0x6b, 0x48, 0x66,
+    0x4b, 0x6e, 0x0a, 0xb6, 0xe6, 0xa5, 0xef, 0x7b, 0xc0, 0x21, 0x36, 0x84, 0x88, 0x85, 0x27, 0x1f,
+    0x89, 0x3c, 0x69, 0x25, 0x91, 0xa4, 0xe7, 0xec, 0x1d, 0x41, 0xa4, 0xa5, 0x49, 0x71, 0x15, 0xbc,
+    0x76, 0xcb, 0xa2, 0x9a, 0x10, 0xdd, 0x9f, 0x89, 0x17, 0xfc, 0xed, 0x0b, 0x8f, 0x8f, 0xd2, 0x2e,
+    0x72, 0x42, 0xb2, 0x76, 0x06, 0xdd, 0x0e, 0xe9, 0x60, 0x7c, 0x72, 0x3a, 0x54, 0x07, 0xf0, 0x8a,
+    0x2d, 0x6d, 0xd3, 0x31, 0xa5, 0xf5, 0x48, 0x5a, 0x42, 0xa5, 0x0a, 0xa3, 0x09, 0x8f, 0xe1, 0x55,
+    0x2b, 0x39, 0x78, 0x91, 0x0f, 0x08, 0x32, 0x12, 0x1f, 0x25, 0x76, 0x8a, 0x27, 0x04, 0x07, 0x66,
+    0xa5, 0x8c, 0x55, 0xbb, 0x30, 0xaf, 0xf1, 0x98, 0xfe, 0x4d, 0x58, 0xbb, 0xd5, 0x60, 0x72, 0x12,
+    0x96, 0x34, 0x2f, 0xb5, 0xde, 0x03, 0x92, 0xce, 0x20, 0xc4, 0x7b, 0xcd, 0xf8, 0xd8, 0xd8, 0x51,
+    0x2b, 0xd7, 0xe5, 0x3a, 0xa7, 0xbb, 0x11, 0x22, 0x4d, 0x10, 0x87, 0xab, 0x2f, 0x12, 0x5b, 0x76,
+    0xc4, 0x8e, 0xe8, 0x5e, 0x4a, 0xb7, 0x60, 0x9c, 0xf6, 0x8b, 0x1c, 0x41, 0xa1, 0x9d, 0x69, 0xef,
+    0x87, 0x75, 0x69, 0x67, 0xeb, 0x06, 0xdf, 0x83, 0xea, 0x80, 0x17, 0x5c, 0x3a, 0x4c, 0x79, 0xf7,
+    0x0a, 0xf3, 0xbe, 0xbf, 0x51, 0x82, 0x62, 0x3a, 0xfe, 0x20, 0xd3, 0x08, 0x86, 0xc8, 0x54, 0x19,
+    0xd2, 0xe1, 0x31, 0x23, 0xb3, 0x26, 0xa7, 0x3c, 0xe6, 0x01, 0xf1, 0xcf, 0xe7, 0x23, 0xe4, 0x46,
+    0xf1, 0x64, 0xa6, 0x5b, 0xaa, 0xe4, 0xa8, 0x1e, 0xd7, 0x73, 0x22, 0x1e, 0xb3, 0xca, 0x15, 0x6b,
+    0x55, 0xb8, 0x4b, 0x2e, 0xb5, 0xb7, 0xe6, 0x51, 0xe9, 0x7c, 0x40, 0x46, 0x3a, 0x84, 0x98, 0x88,
+    0xc0, 0x1c, 0x15, 0xaa, 0x68, 0xa5, 0x0b, 0xd2, 0xe7, 0xbc, 0xbb, 0x3d, 0xa4, 0x4d, 0x1f, 0x72,
+    0x75, 0xcd, 0x6a, 0xcb, 0xa6, 0x14, 0x13, 0xdd, 0x02, 0x1e, 0x04, 0xbc, 0x3a, 0x0a, 0x8f, 0x9d,
+    0xbf, 0xb6, 0xb3, 0x37, 0x05, 0xb1, 0x06, 0x57, 0x7f, 0xe9, 0x60, 0x90, 0x58, 0x3a, 0xe4, 0xc5,
+    0xf3, 0x8a, 0xaf, 0x8a, 0xbf, 0xb1, 0xc8, 0x8e, 0x46, 0x9e, 0x46, 0xa5, 0x4a, 0xbd, 0xe7, 0x8e,
+    0xe1, 0xb6, 0x31, 0x39, 0xfc, 0x82, 0x0e, 0xe8, 0xd3, 0x31, 0x1f, 0x85, 0x8f, 0xec, 0x26, 0x7a,
+    0xe7, 0xf0, 0xa4, 0xe5, 0x53, 0xaa, 0xfc, 0x90, 0x1d, 0xd7, 0x94, 0xfa, 0x1d, 0x13, 0xb1, 0x12,
+    0x6b, 0xeb, 0xe6, 0x4a, 0x6e, 0x1d, 0xb2, 0xe6, 0xcd, 0x18, 0x79, 0xc0, 0x1d, 0xab, 0x70, 0x58,
+    0x82, 0xb0, 0x1c, 0xb7, 0x57, 0x68, 0xa5, 0xb6, 0x99, 0xe7, 0x2c, 0x10, 0x3b, 0xa4, 0xb2, 0x63,
+    0x71, 0x75, 0x1d, 0x5d, 0xcb, 0x9a, 0x5a, 0x10, 0xdd, 0xe7, 0xdd, 0x03, 0xcc, 0x81, 0xff, 0x8e,
+    0xad, 0xef, 0xb5, 0x73, 0x9e, 0xd7, 0xb0, 0x06, 0xcd, 0x31, 0xe9, 0x00, 0xee, 0x54, 0x3a, 0xfc,
+    0x45, 0x58, 0x0a, 0xe9, 0x46, 0xbf, 0x61, 0xf5, 0x92, 0x46, 0xaa, 0x02, 0xa4, 0x0a, 0x78, 0xfd,
+    0x8e, 0x61, 0x95, 0x2c, 0x39, 0xeb, 0xbe, 0x0e, 0xc8, 0xfd, 0x1f, 0x1f, 0x79, 0x79, 0xec, 0x26,
+    0x01, 0x76, 0x52, 0x75, 0x05, 0xeb, 0xb8, 0x1a, 0x39, 0xef, 0x18, 0x0d, 0x91, 0x58, 0xcb, 0x20,
+    0x54, 0x72, 0x3b, 0x99, 0x35, 0x8f, 0xe6, 0xe4, 0xfe, 0x39, 0x4f, 0x77, 0xc0, 0xde, 0xa3, 0x70,
+    0x68, 0xb8, 0xac, 0x1c, 0xef, 0xec, 0x67, 0xa5, 0x47, 0x95, 0xe7, 0x6c, 0xc5, 0x37, 0xa4, 0x9d,
+    0x89, 0x71, 0xd5, 0x72, 0x4b, 0xcb, 0xbe, 0x34, 0x75, 0x5c, 0xe2, 0x8c, 0x03, 0xdc, 0x8b, 0x02,
+    0x8f, 0xe7, 0xe4, 0xb4, 0x33, 0xa8, 0xd9, 0xb0, 0x06, 0x70, 0x8a, 0xe9, 0x80, 0xeb, 0x55, 0x3a,
+    0x24, 0x88, 0x59, 0x0a, 0x8e, 0x48, 0xbf, 0x31, 0xa8, 0x99, 0x46, 0x44, 0xf6, 0xa3, 0x8a, 0xde,
+    0x1a, 0x8f, 0xc1, 0xd4, 0x2c, 0x39, 0xf1, 0x14, 0x0f, 0xa8, 0x64, 0x4e, 0x1a, 0x81, 0x12, 0xec,
+    0xa6, 0x53, 0xc5, 0x52, 0x25, 0xad, 0xe7, 0xb8, 0xba, 0x9c, 0xf0, 0x98, 0xc4, 0x82, 0x58, 0x8b,
+    0xe0, 0x58, 0x72, 0xa6, 0x73, 0x35, 0x4f, 0x2f, 0xf1, 0xfe, 0x4d, 0x46, 0x85, 0x43, 0xc8, 0x8f,
+    0xe5, 0xb8, 0x00, 0x40, 0x2b, 0x75, 0x67, 0x3d, 0x67, 0xc9, 0xba, 0x21, 0xfd, 0x2c, 0x90, 0xab,
+    0x73, 0x3e, 0x5a, 0x96, 0x86, 0xb6, 0xe3, 0x76, 0xcc, 0x1c, 0x60, 0x1f, 0x33, 0x78, 0x3c, 0x84,
+    0xab, 0x9d, 0xe5, 0xdc, 0x86, 0xf5, 0x71, 0x79, 0xeb, 0x06, 0x0a, 0xd2, 0xc2, 0x80, 0x66, 0x97,
+    0x35, 0x10, 0xcf, 0x56, 0x8a, 0x12, 0x07, 0xc0, 0x61, 0x8f, 0x8f, 0x46, 0x4e, 0xf9, 0xa5, 0x4a,
+    0x49, 0x22, 0x8f, 0x51, 0x49, 0x2d, 0x39, 0x8c, 0x64, 0xe9, 0x47, 0x6b, 0x31, 0x1a, 0xa5, 0x66,
+    0xf2, 0xa6, 0x24, 0x7c, 0x52, 0x25, 0x81, 0xf6, 0xb8, 0x62, 0x2e, 0xf1, 0x58, 0x1a, 0x85, 0x58,
+    0x3b, 0x36, 0x2b, 0x71, 0xea, 0x0e, 0x0e, 0x8f, 0xff, 0x0e, 0xff, 0xad, 0x1e, 0x86, 0x43, 0xc4,
+    0x9c, 0xe5, 0xd8, 0x70, 0x51, 0x2b, 0xad, 0x17, 0x3c, 0xa7, 0xbc, 0x1e, 0x22, 0xf5, 0x32, 0x54,
+    0xaa, 0xb3, 0x4b, 0x34, 0x56, 0xfb, 0xc3, 0xe3, 0x76, 0xe3, 0x1b, 0xe0, 0x07, 0xda, 0x78, 0xac,
+    0x74, 0x9e, 0x9d, 0x39, 0x05, 0x8a, 0xf5, 0x79, 0x4f, 0xeb, 0x06, 0x5b, 0x7c, 0xe9, 0xc0, 0xc1,
+    0x56, 0x3a, 0xd8, 0xf2, 0xf3, 0x0a, 0x48, 0xe2, 0xd2, 0xe1, 0x31, 0x02, 0x49, 0x78, 0x5f, 0xf2,
+    0x0a, 0x52, 0xf8, 0x8e, 0x71, 0x48, 0x2f, 0x39, 0x2d, 0xc9, 0x0e, 0x08, 0xd0, 0x26, 0x1f, 0xd5,
+    0x55, 0x88, 0x27, 0x33, 0x0f, 0x66, 0xc5, 0xa0, 0x5a, 0xbb, 0x14, 0x90, 0x3d, 0x19, 0x35, 0xa2,
+    0x58, 0x13, 0x56, 0x55, 0x72, 0x18, 0xba, 0x35, 0x8f, 0x49, 0xc3, 0x03, 0x1a, 0x18, 0x22, 0xc4,
+    0x47, 0xdc, 0xf8, 0x48, 0x56, 0xb3, 0x2d, 0x47, 0x78, 0x0e, 0xe9, 0x1a, 0x62, 0x5c, 0x05, 0xbf,
+    0xd5, 0xb2, 0x99, 0x47, 0x44, 0xb7, 0xd3, 0xc8, 0x05, 0xe3, 0x79, 0x5c, 0x64, 0x2d, 0xd3, 0x00,
+    0x5d, 0x53, 0x3a, 0xac, 0xc1, 0xd5, 0x5a, 0x77, 0x7d, 0xd0, 0x25, 0x07, 0x7e, 0xbe, 0xea, 0xe0,
+    0x3c, 0x5e, 0x3a, 0x74, 0x26, 0xf8, 0x8a, 0xc7, 0x25, 0xd3, 0x61, 0xa2, 0x9b, 0x46, 0x5e, 0x6d,
+    0xa6, 0x4a, 0x3f, 0x1d, 0x8f, 0xf9, 0x8b, 0x35, 0x39, 0x1b, 0x8a, 0x0f, 0xe8, 0x14, 0x3a, 0x1f,
+    0xb1, 0xe5, 0x8b, 0x27, 0x11, 0xd9, 0xc7, 0x45, 0x94, 0x87, 0xc7, 0x32, 0xf4, 0xc5, 0x5a, 0x05,
+    0xf3, 0x92, 0x4b, 0xe0, 0xae, 0x79, 0x02, 0x64, 0x1f, 0xb0, 0x78, 0x10, 0x21, 0xf2, 0x14, 0x31,
+    0xc7, 0xa8, 0x33, 0x5a, 0x49, 0x2a, 0xf7, 0x39, 0x1b, 0xb2, 0x0f, 0xa9, 0x2f, 0x8f, 0x5c, 0xfd,
+    0xad, 0xdb, 0xb2, 0xe3, 0xef, 0x44, 0xf7, 0x77, 0x20, 0x1e, 0x6f, 0xce, 0x6c, 0xe7, 0x5b, 0x41,
+    0x62, 0xdd, 0x0c, 0xdf, 0xba, 0xa7, 0x21, 0x30, 0x39, 0x13, 0x33, 0x60, 0x07, 0x21, 0xf1, 0xc1,
+    0x80, 0x38, 0x77, 0x35, 0x0c, 0x43, 0x56, 0x8a, 0xc3, 0x32, 0xbf, 0x71, 0x37, 0x92, 0x46, 0x40,
+    0xb6, 0xa2, 0xca, 0xaa, 0x1a, 0x8f, 0x61, 0xbb, 0x25, 0x39, 0xd1, 0x1c, 0xe8, 0x47, 0x98, 0x33,
+    0x1a, 0x69, 0x72, 0xeb, 0xa6, 0xe7, 0x88, 0x52, 0x25, 0x8f, 0xdf, 0xb8, 0x94, 0x52, 0xf0, 0x18,
+    0x3d, 0x5b, 0x58, 0x93, 0x31, 0x71, 0x78, 0x3d, 0xd3, 0xf6, 0x6f, 0x22, 0x2d, 0x1c, 0xc2, 0xb2,
+    0x28, 0x47, 0x9b, 0x22, 0x5a, 0x69, 0x7e, 0xdc, 0x39, 0x07, 0xd7, 0x0d, 0x69, 0xa2, 0xaa, 0x52,
+    0x8d, 0x81, 0x96, 0xb1, 0xc1, 0xd3, 0x1d, 0xf7, 0x83, 0xc8, 0x00, 0x7b, 0x6e, 0xc2, 0xe3, 0xa8,
+    0xef, 0xec, 0xdc, 0x2f, 0x35, 0xac, 0xa3, 0xe9, 0xde, 0x38, 0x7a, 0x62, 0x56, 0x07, 0x89, 0x4d,
+    0xe9, 0x20, 0xbd, 0x71, 0x3a, 0x3c, 0xb7, 0xf0, 0x8a, 0xf2, 0x72, 0xd3, 0x51, 0x8b, 0x8c, 0x46,
+    0x58, 0x2d, 0xa5, 0x0a, 0xa8, 0x1a, 0x8f, 0x01, 0x13, 0x2a, 0x39, 0xfa, 0xfb, 0x0f, 0x88, 0x7a,
+    0x07, 0x1f, 0x75, 0xfb, 0x8c, 0x27, 0x5c, 0xcd, 0x65, 0xa5, 0x32, 0xef, 0xb8, 0xc0, 0xf2, 0xf0,
+    0x98, 0x1a, 0x6e, 0x58, 0x0b, 0x43, 0x5f, 0x72, 0xdf, 0xdb, 0x34, 0x6f, 0x04, 0xdf, 0x03, 0x0a,
+    0x52, 0x21, 0xc4, 0x87, 0x87, 0x5a, 0x49, 0x34, 0xda, 0x39, 0xbd, 0x9a, 0x10, 0x29, 0x93, 0x40,
+    0x5c, 0x35, 0x23, 0xd9, 0xb2, 0x0c, 0xa0, 0x44, 0xf7, 0x41, 0xb9, 0x05, 0xab, 0x0a, 0xc6, 0xe3,
+    0x71, 0xd8, 0xec, 0x8c, 0x7c, 0x4a, 0xac, 0x93, 0x4c, 0x5a, 0xb7, 0x7b, 0xdb, 0x25, 0x07, 0x0a,
+    0x6a, 0xe9, 0x80, 0x56, 0xb3, 0x52, 0x98, 0x5a, 0xfe, 0x0d, 0x4e, 0x90, 0x34, 0x82, 0xfb, 0x24,
+    0x55, 0x28, 0x5d, 0x79, 0x8c, 0x11, 0x4d, 0xc9, 0x19, 0x17, 0x80, 0x40, 0x73, 0xd7, 0xd1, 0x08,
+    0x83, 0x75, 0x37, 0x71, 0xec, 0x95, 0x2a, 0x3b, 0x2c, 0xc7, 0xc5, 0xa9, 0x90, 0xc7, 0x6a, 0xab,
+    0xc2, 0x9a, 0x2c, 0x12, 0x93, 0xbb, 0xba, 0xa5, 0x79, 0x8e, 0xfe, 0xf7, 0x8f, 0xe6, 0x31, 0x1c,
+    0x2e, 0x27, 0x2b, 0xc7, 0xfc, 0x7b, 0x5a, 0x89, 0x4c, 0xdf, 0x39, 0xd9, 0xff, 0x0f, 0x69, 0xa1,
+    0x5c, 0x5c, 0xad, 0x7b, 0xf1, 0xb8, 0x1a, 0xab, 0x06, 0x38, 0x26, 0x2d, 0x1e, 0x9b, 0x3e, 0x68,
+    0xe7, 0xd2, 0x1d, 0x62, 0x0d, 0xfa, 0xda, 0xba, 0xe5, 0xc1, 0x2d, 0x79, 0x44, 0xa4, 0x56, 0x07,
+    0x62, 0xe6, 0xea, 0xa0, 0xe2, 0x6e, 0x3a, 0x80, 0xab, 0xf6, 0x8a, 0x44, 0x87, 0xd3, 0x71, 0xb5,
+    0x06, 0x49, 0x4e, 0x56, 0x79, 0xcc, 0x1f, 0xa4, 0xc9, 0x21, 0xa6, 0x81, 0x40, 0xdd, 0x47, 0xf9,
+    0x48, 0x56, 0x78, 0x3c, 0x21, 0xc3, 0x30, 0xab, 0xf6, 0x89, 0xdb, 0x25, 0xaa, 0x8d, 0xc7, 0x60,
+    0x6e, 0xc5, 0x5a, 0xdd, 0x1f, 0x93, 0xcb, 0x26, 0xab, 0x79, 0x5e, 0x0c, 0x20, 0x30, 0xc9, 0x0c,
+    0x21, 0x96, 0x16, 0xcd, 0xc7, 0x25, 0xe5, 0x6d, 0x89, 0xd3, 0xef, 0x39, 0xc1, 0x36, 0x11, 0x69,
+    0xae, 0x73, 0x5c, 0x6d, 0xec, 0xdf, 0xb2, 0x22, 0x01, 0x45, 0x37, 0xc0, 0xdf, 0x05, 0xe7, 0x0d,
+    0x62, 0x64, 0xc8, 0xa1, 0x62, 0x9d, 0x8d, 0xda, 0xba, 0x09, 0xf2, 0x30, 0x39, 0x89, 0x44, 0x60,
+    0x07, 0xe0, 0x6b, 0xe9, 0x60, 0xbf, 0x54, 0x3a, 0x24, 0x2b, 0x59, 0x8a, 0x02, 0x4a, 0xbf, 0xe1,
+    0x60, 0x96, 0x46, 0x64, 0x19, 0xa4, 0xca, 0x3e, 0x0a, 0x8f, 0xb1, 0x0f, 0x2d, 0x39, 0x80, 0xee,
+    0x0e, 0x48, 0xb1, 0x67, 0x37, 0xa9, 0x3c, 0x94, 0xaa, 0x87, 0x65, 0xc7, 0x65, 0x4c, 0x7c, 0xc7,
+    0x0c, 0xb2, 0xc4, 0x5a, 0x7f, 0xac, 0x92, 0xd3, 0x36, 0xad, 0x79, 0xd4, 0x45, 0xe1, 0x70, 0xda,
+    0x60, 0x39, 0xe2, 0xd4, 0xcf, 0xca, 0x52, 0x48, 0xcf, 0xd9, 0xb5, 0x6f, 0x48, 0x49, 0x88, 0xe3,
+    0xea, 0x84, 0x98, 0x96, 0xdd, 0xe7, 0xeb, 0xb8, 0xb7, 0x2c, 0x07, 0x18, 0x9c, 0x0a, 0x1e, 0x3f,
+    0x21, 0x6a, 0xe7, 0x9b, 0xc7, 0x61, 0x4d, 0x0d, 0xd8, 0xba, 0xdd, 0x2c, 0x2e, 0x39, 0x81, 0xf6,
+    0x90, 0x07, 0xaa, 0xe0, 0xea, 0x20, 0xbf, 0x6d, 0x3a, 0xec, 0xad, 0xf6, 0x0a, 0x1b, 0x88, 0xd3,
+    0xb1, 0x2c, 0x05, 0x49, 0xbe, 0xd5, 0xa7, 0x4a, 0x8e, 0x11, 0x8f, 0xa9, 0x06, 0x38, 0x39, 0x90,
+    0xc0, 0x0f, 0x28, 0x43, 0x38, 0x1f, 0x49, 0x4f, 0x8d, 0xa7, 0x7a, 0x46, 0x66, 0x05, 0xb0, 0x8e,
+    0xc7, 0x3a, 0x58, 0xc5, 0x9a, 0x06, 0x1f, 0x93, 0x13, 0x02, 0xab, 0x79, 0x48, 0x0a, 0x20, 0xd0,
+    0x35, 0x0a, 0x21, 0xfe, 0x53, 0xcd, 0x47, 0xc4, 0x78, 0xcf, 0x79, 0xa4, 0x8a, 0x48, 0xc3, 0x46,
+    0xe3, 0x6a, 0x2a, 0x0c, 0x97, 0x45, 0x72, 0x25, 0xba, 0x65, 0x5e, 0x2f, 0x18, 0xf8, 0x02, 0x23,
+    0x5f, 0x61, 0x6c, 0x67, 0x02, 0x6e, 0x62, 0x8d, 0x6c, 0xdf, 0xba, 0x67, 0x62, 0x30, 0x39, 0x17,
+    0x4e, 0x60, 0x07, 0xe4, 0xa1, 0xe9, 0x00, 0x23, 0xcd, 0x52, 0xe4, 0xa3, 0xfa, 0x8d, 0x6c, 0xcb,
+    0x34, 0xc2, 0xa7, 0x21, 0x55, 0x3e, 0xbd, 0x78, 0xcc, 0x48, 0x6f, 0xc9, 0x29, 0x3f, 0x78, 0x40,
+    0x15, 0x92, 0xd2, 0x08, 0x4c, 0x60, 0x37, 0x15, 0x8a, 0x96, 0x2a, 0x14, 0x3f, 0xc7, 0x55, 0x26,
+    0x86, 0xc7, 0x08, 0x1f, 0xc4, 0x1a, 0x9e, 0xcc, 0x92, 0xf3, 0xfb, 0xbc, 0x7f, 0x3c, 0x53, 0xe1,
+    0x30, 0x87, 0x66, 0x39, 0x0a, 0x19, 0xd0, 0x4a, 0x31, 0x61, 0xcf, 0x19, 0xb9, 0x6f, 0x48, 0x7d,
+    0x13, 0xe4, 0xaa, 0x36, 0x69, 0xc7, 0x85, 0xb4, 0x3a, 0xc0, 0xfc, 0x59, 0xf0, 0xb8, 0x15, 0x5b,
+    0x3b, 0x5f, 0xa8, 0x0d, 0x6b, 0xff, 0xff, 0xd6, 0x5d, 0x6b, 0x6d, 0xc9, 0x11, 0x74, 0xb3, 0x7a,
+    0x68, 0xe5, 0x90, 0x07, 0xbe, 0x44, 0xea, 0xc0, 0x23, 0x69, 0x3a, 0x9c, 0xba, 0xf4, 0x8a, 0xb8,
+    0x6c, 0xd3, 0xd1, 0x47, 0x3a, 0x55, 0x9e, 0xac, 0x77, 0x4c, 0x94, 0xb3, 0xc9, 0xc9, 0x59, 0x7a,
+    0x40, 0xaa, 0x93, 0xf9, 0xc8, 0xb1, 0x5d, 0x3c, 0x89, 0xfd, 0x30, 0xab, 0x04, 0x21, 0x3c, 0x66,
+    0x5e, 0x2c, 0xd6, 0x4e, 0x7f, 0x97, 0xdc, 0x27, 0x61, 0xcd, 0x63, 0x78, 0xfa, 0x80, 0x10, 0x5a,
+    0x08, 0x11, 0xa1, 0x9a, 0x56, 0xca, 0xfc, 0x79, 0x4e, 0x97, 0x36, 0x44, 0x6a, 0x17, 0x13, 0x57,
+    0x43, 0xf6, 0xb7, 0x6c, 0xa8, 0x0a, 0xd1, 0x75, 0xfc, 0x79, 0xc1, 0xb6, 0xda, 0xda, 0x19, 0xb7,
+    0x90, 0x58, 0x3f, 0x4e, 0xb6, 0xee, 0x98, 0x01, 0x4c, 0xce, 0x93, 0x0a, 0xd8, 0x83, 0x48, 0xd6,
+    0x7c, 0x35, 0x06, 0xd5, 0x07, 0xcd, 0xf6, 0xe8, 0x00, 0x08, 0x69, 0x3a, 0x14, 0x1c, 0xf1, 0x8a,
+    0xb4, 0x15, 0xd3, 0xd1, 0xb5, 0xfd, 0x48, 0xea, 0x53, 0x79, 0x8c, 0x6b, 0x34, 0xc9, 0x39, 0x80,
+    0x7e, 0x40, 0x69, 0x49, 0xf8, 0x28, 0x63, 0x52, 0x3c, 0xc9, 0xab, 0x2f, 0x2b, 0x19, 0xa1, 0xda,
+    0x45, 0xe8, 0x14, 0xd6, 0x82, 0x69, 0x97, 0x5c, 0x90, 0x33, 0xcd, 0x4b, 0x90, 0xf3, 0x80, 0xf4,
+    0x5b, 0x08, 0x31, 0xa4, 0x29, 0x3e, 0xde, 0x55, 0x77, 0xce, 0xa8, 0xbc, 0x43, 0xba, 0x0f, 0x17,
+    0x57, 0x93, 0x55, 0xb4, 0x2c, 0x97, 0x3f, 0xd1, 0xa5, 0x3f, 0x69, 0xc1, 0x02, 0x3f, 0x18, 0xf9,
+    0x68, 0x7b, 0x58, 0xdf, 0x07, 0xb6, 0x6e, 0x3c, 0x4c, 0x4b, 0xee, 0xa2, 0x0f, 0xd8, 0xa3, 0x68,
+    0xd3, 0xbc, 0x01, 0x05, 0xd5, 0x07, 0xfb, 0xb6, 0xac, 0x01, 0x10, 0x66, 0xa5, 0x50, 0x91, 0xff,
+    0x37, 0x60, 0xbe, 0xa3, 0x11, 0x80, 0xd5, 0x52, 0x05, 0xef, 0x21, 0x8f, 0xa1, 0x93, 0x95, 0x7e,
+    0x34, 0xeb, 0x45, 0x23, 0xad, 0x7b, 0xbc, 0x49, 0x3d, 0x3d, 0xa9, 0x82, 0xcd, 0xf3, 0xb8, 0x50,
+    0x55, 0xe2, 0x31, 0xb0, 0xef, 0x61, 0x0d, 0xb8, 0x81, 0xc3, 0xe3, 0xf0, 0x84, 0xff, 0xfc, 0x22,
+    0x86, 0x43, 0x2e, 0x0b, 0xcb, 0x51, 0x49, 0x45, 0xad, 0x94, 0xb9, 0xde, 0x39, 0x9d, 0x00, 0x2a,
+    0x55, 0x4d, 0x21, 0x34, 0x16, 0x97, 0x87, 0xc7, 0xa5, 0x28, 0x6d, 0x80, 0xdd, 0xac, 0xc6, 0x63,
+    0x4c, 0xd3, 0xd9, 0xd9, 0x14, 0x3a, 0xb1, 0x66, 0x6a, 0x08, 0xc7, 0xbd, 0xa9, 0x68, 0x75, 0xb6,
+    0x48, 0x43, 0x5e, 0x52, 0x67, 0xcb, 0xe7, 0xab, 0x66, 0x01, 0x02, 0x8e, 0x31, 0xe9, 0x80, 0x79,
+    0x79, 0xa5, 0xf0, 0x0a, 0xeb, 0x37, 0xf4, 0x88, 0xa4, 0x11, 0x6d, 0x0e, 0x52, 0x05, 0x28, 0xfe,
+    0x8e, 0x41, 0xa1, 0x5a, 0x72, 0xb4, 0xf6, 0x49, 0x23, 0x8c, 0x9d, 0xba, 0x89, 0x0b, 0x67, 0xa9,
+    0xa2, 0x98, 0xe1, 0xb8, 0x68, 0x6f, 0xe1, 0x31, 0x6c, 0xb8, 0x61, 0x0d, 0xc2, 0xc4, 0x92, 0xf3,
+    0x6a, 0x73, 0xff, 0x70, 0x81, 0x85, 0x43, 0xf7, 0xba, 0xca, 0x91, 0xde, 0x06, 0xad, 0x24, 0x62,
+    0xe4, 0x39, 0x69, 0x05, 0x1c, 0x52, 0x67, 0xa1, 0x33, 0x56, 0x89, 0x50, 0xc7, 0x45, 0x21, 0x74,
+    0x80, 0xb9, 0xce, 0xbf, 0x63, 0x75, 0xcd, 0xda, 0xd9, 0x0f, 0xbe, 0xb0, 0x66, 0x68, 0xe0, 0xba,
+    0xf9, 0x9c, 0x66, 0x75, 0xb2, 0x4b, 0x43, 0x1e, 0xc1, 0x1b, 0xcb, 0xc7, 0x83, 0x6b, 0x01, 0x02,
+    0xfa, 0x2b, 0xea, 0xc0, 0xb4, 0xde, 0x74, 0x90, 0xe0, 0x02, 0x38, 0x94, 0x84, 0xa3, 0x11, 0x97,
+    0x64, 0x53, 0x85, 0x48, 0x11, 0x8f, 0x11, 0x58, 0x63, 0x72, 0x14, 0x8e, 0x3f, 0x20, 0x8f, 0xb8,
+    0xbc, 0x89, 0xb0, 0x36, 0xa9, 0x92, 0x30, 0xfd, 0xb8, 0xa0, 0x61, 0xe1, 0x31, 0xa2, 0x91, 0x62,
+    0x4d, 0x49, 0xfd, 0x92, 0x23, 0xd6, 0x54, 0xf3, 0xd4, 0xf7, 0x85, 0x43, 0x97, 0x8a, 0xcb, 0xd1,
+    0x3e, 0x41, 0xad, 0xb4, 0x4d, 0xe4, 0x39, 0x59, 0x3c, 0x22, 0x52, 0xe7, 0x2f, 0x71, 0x95, 0x62,
+    0x76, 0xc7, 0x75, 0xd6, 0x77, 0x80, 0x1d, 0xf1, 0xc5, 0x63, 0x82, 0x2f, 0xda, 0x19, 0x87, 0x41,
+    0xb1, 0x96, 0x7d, 0xd3, 0xba, 0x8d, 0xec, 0x60, 0x72, 0xed, 0xde, 0x43, 0xde, 0x91, 0x61, 0xcb,
+    0xd7, 0xc6, 0x6a, 0x01, 0x02, 0x90, 0xef, 0xe8, 0x80, 0x07, 0xc1, 0x74, 0x80, 0xe5, 0xc6, 0x2b,
+    0x44, 0x85, 0xa4, 0x11, 0xab, 0xbc, 0x51, 0xc5, 0xa5, 0x14, 0x8f, 0x81, 0x68, 0x52, 0x72, 0x9c,
+    0x79, 0x3c, 0x20, 0x43, 0xc7, 0xf8, 0xc8, 0x19, 0x67, 0xa9, 0x92, 0x53, 0xdc, 0xb8, 0x6c, 0xca,
+    0xe2, 0x31, 0x5b, 0x44, 0x61, 0x0d, 0x03, 0xdc, 0x92, 0x13, 0xed, 0x4d, 0xf3, 0x14, 0xc5, 0x78,
+    0x40, 0xd8, 0x6f, 0xca, 0x91, 0x1c, 0x18, 0xad, 0xa4, 0x9c, 0xdf, 0x39, 0xed, 0x66, 0x1c, 0x52,
+    0x18, 0x83, 0x71, 0x55, 0x92, 0x82, 0x96, 0x95, 0x4f, 0x06, 0x8f, 0x05, 0x83, 0x69, 0x67, 0x1a,
+    0x18, 0xc3, 0x9a, 0x12, 0x7a, 0xeb, 0x96, 0x48, 0x62, 0xc9, 0xed, 0x61, 0x04, 0x76, 0x91, 0xbf,
+    0x2c, 0x1f, 0x65, 0x9b, 0x05, 0x18, 0x36, 0xf9, 0x0f, 0x02, 0xfd, 0xfc, 0xe8, 0x00, 0x1d, 0xbf,
+    0x74, 0xd0, 0x00, 0xc8, 0x2b, 0x4c, 0xcf, 0xa4, 0x11, 0xf7, 0xb7, 0x51, 0x85, 0x11, 0x18, 0x8f,
+    0x01, 0x70, 0x52, 0x72, 0x34, 0x9e, 0x3c, 0x20, 0x98, 0xc9, 0xf8, 0xc8, 0x6a, 0x67, 0xa9, 0x52,
+    0x12, 0xdd, 0xb8, 0xe0, 0xbe, 0xe2, 0x31, 0x43, 0x51, 0x61, 0xcd, 0x10, 0xdb, 0x92, 0x23, 0x96,
+    0x4e, 0xf3, 0xa4, 0xca, 0x78, 0x40, 0x9f, 0x7f, 0xca, 0x51, 0xb8, 0x15, 0xad, 0x24, 0xc8, 0xe0,
+    0x39, 0xb1, 0x3d, 0x1c, 0x52, 0x70, 0x95, 0x71, 0xd5, 0x28, 0x81, 0x96, 0x05, 0xd4, 0x06, 0x8f,
+    0x7d, 0x8c, 0x69, 0x67, 0xfe, 0x21, 0xc3, 0x1a, 0x11, 0x7a, 0xeb, 0x06, 0x24, 0x63, 0xc9, 0x61,
+    0x4e, 0x04, 0x76, 0xca, 0xbd, 0x2c, 0x1f, 0x64, 0x9d, 0x05, 0x38, 0x84, 0xf9, 0x0f, 0x02, 0xad,
+    0x07, 0xe9, 0x40, 0x42, 0xbd, 0x74, 0x70, 0xf1, 0xc8, 0x2b, 0x50, 0x11, 0xa5, 0x11, 0x86, 0xb2,
+    0x51, 0xc5, 0x02, 0x1b, 0x8f, 0xb1, 0x64, 0x52, 0x72, 0xd8, 0xbd, 0x3c, 0x20, 0x38, 0xca, 0xf8,
+    0x08, 0xef, 0x66, 0xa9, 0x12, 0xdb, 0xdd, 0xb8, 0x34, 0xa3, 0xe2, 0x31, 0xd3, 0x5e, 0x61, 0xcd,
+    0x36, 0xd9, 0x92, 0x63, 0x45, 0x4f, 0xf3, 0x70, 0xc4, 0x78, 0x40, 0x15, 0x8d, 0xca, 0x51, 0x2c,
+    0x13, 0xad, 0x54, 0xd1, 0xe1, 0x39, 0x5d, 0x13, 0x1c, 0x52, 0x50, 0xa5, 0x71, 0x15, 0xc4, 0x7f,
+    0x96, 0x25, 0x3c, 0xa6, 0x9d, 0x61, 0xae, 0x0c, 0x6b, 0x5d, 0xe5, 0xad, 0x5b, 0x0d, 0x90, 0x25,
+    0x37, 0xb7, 0x10, 0xd8, 0x31, 0xf8, 0x59, 0x80, 0x05, 0x9a, 0xff, 0x20, 0xf9, 0x73, 0x7a, 0xe8,
+    0xf3, 0x2d, 0x2d, 0x02, 0x33, 0xad, 0xe9, 0xc0, 0x40, 0x99, 0xa5, 0x30, 0xed, 0xeb, 0x37, 0xf4,
+    0x20, 0xa6, 0x11, 0xc7, 0x36, 0x52, 0xc5, 0x1c, 0x12, 0x8f, 0x21, 0xb4, 0x5d, 0x72, 0x4c, 0xf2,
+    0xeb, 0x26, 0x63, 0xb1, 0xa5, 0x8a, 0xb0, 0x9f, 0xe3, 0xb2, 0xcd, 0x86, 0xc7, 0x34, 0x46, 0x88,
+    0x35, 0xdd, 0x3e, 0x4b, 0x0e, 0x5a, 0xea, 0xfd, 0x33, 0x55, 0x15, 0x0e, 0xf1, 0xf2, 0x2c, 0x47,
+    0xe6, 0x0c, 0xb4, 0xd2, 0x20, 0xb1, 0xe7, 0xc4, 0xba, 0x70, 0x48, 0xf5, 0xd1, 0x1d, 0x60, 0x1e,
+    0x47, 0xf0, 0x58, 0x9b, 0xbc, 0x76, 0x16, 0x06, 0x36, 0xac, 0x29, 0x4b, 0xb8, 0x6e, 0xe8, 0x98,
+    0x43, 0x9e, 0xcb, 0x2a, 0xcb, 0x47, 0x3d, 0x6e, 0x01, 0x5e, 0xdf, 0xff, 0x83, 0x30, 0xca, 0xe9,
+    0xa1, 0xde, 0xe1, 0xb4, 0x38, 0x1c, 0x04, 0x48, 0x02, 0xe9, 0xd6, 0xea, 0x40, 0xf5, 0xde, 0x74,
+    0x00, 0x44, 0xd9, 0x2b, 0x54, 0x81, 0x9c, 0x0e, 0xd4, 0x50, 0x3c, 0x06, 0xea, 0xba, 0xc9, 0x81,
+    0x41, 0xfd, 0x80, 0x08, 0x9b, 0xe6, 0x23, 0x3e, 0x64, 0xe3, 0x49, 0xcd, 0x1f, 0xb3, 0xe2, 0x85,
+    0x8f, 0xc7, 0xa0, 0x3a, 0x32, 0x39, 0x6d, 0x4a, 0x35, 0x8f, 0x79, 0x05, 0x08, 0xf4, 0xde, 0x84,
+    0x10, 0x19, 0xe3, 0x22, 0x52, 0xdf, 0x96, 0x71, 0x55, 0x97, 0x0c, 0x97, 0xe5, 0x4f, 0x4b, 0x74,
+    0xb1, 0x32, 0xbd, 0x60, 0x0b, 0xe9, 0xc4, 0x5a, 0xa1, 0x7b, 0xeb, 0xe6, 0xd1, 0x82, 0xc9, 0xa5,
+    0x08, 0x05, 0x76, 0x6a, 0x0c, 0x6b, 0x5e, 0x7c, 0x35, 0xd5, 0x17, 0x33, 0x19, 0x10, 0x0a, 0x32,
+    0xa7, 0x87, 0x73, 0xae, 0xd4, 0xe2, 0xcf, 0x52, 0xef, 0x58, 0x98, 0x76, 0x4a, 0x02, 0x72, 0x40,
+    0x95, 0xc2, 0xdc, 0xef, 0xdf, 0xb0, 0x4a, 0x8c, 0x46, 0xc8, 0xe8, 0x49, 0x15, 0x78, 0x52, 0x3c,
+    0x06, 0x1d, 0x56, 0xc9, 0x51, 0xfb, 0x1d, 0x8d, 0xdc, 0xe3, 0x95, 0x2a, 0xb3, 0x24, 0x8e, 0x0b,
+    0xec, 0x3f, 0x1e, 0x53, 0xc3, 0x12, 0xd6, 0xb4, 0x5d, 0x86, 0x43, 0x6e, 0x81, 0xca, 0xd1, 0x0d,
+    0x43, 0xad, 0x74, 0x4a, 0xda, 0x39, 0xe9, 0x80, 0x20, 0x52, 0x03, 0xd5, 0x1d, 0xd7, 0xcb, 0xb2,
+    0x01, 0x46, 0x23, 0x11, 0x8f, 0x21, 0x97, 0x68, 0x67, 0xd9, 0xea, 0xc3, 0xda, 0x4b, 0x6f, 0xeb,
+    0xd6, 0xd1, 0xa7, 0xd5, 0x4d, 0xad, 0x0a, 0x79, 0x4d, 0x94, 0x2d, 0x9f, 0x2d, 0x8b, 0x05, 0x38,
+    0xdd, 0x04, 0x10, 0x06, 0x3f, 0xa7, 0x87, 0x81, 0x20, 0x7f, 0xe4, 0x45, 0x60, 0x5a, 0x69, 0x60,
+    0x2a, 0x65, 0x02, 0x4c, 0xf5, 0xe9, 0x40, 0x25, 0xb9, 0x74, 0xe0, 0x93, 0xf7, 0x37, 0xec, 0x54,
+    0x4c, 0x15, 0x8d, 0xb4, 0x3b, 0x06, 0xbc, 0xa6, 0xc9, 0xe1, 0x04, 0xec, 0x80, 0x94, 0xa7, 0x3c,
+    0x2e, 0xfe, 0x1e, 0x78, 0x8c, 0x4c, 0xa6, 0x58, 0x93, 0x7c, 0xb4, 0xe4, 0x24, 0x9b, 0xd6, 0x3c,
+    0xd8, 0x75, 0xcb, 0x51, 0x78, 0x16, 0xad, 0xa4, 0xc5, 0xea, 0x39, 0xe1, 0xec, 0x1e, 0x52, 0xbc,
+    0x7e, 0x71, 0xd5, 0x85, 0xd5, 0x96, 0x35, 0x8d, 0x81, 0x80, 0x7d, 0xfc, 0xc0, 0x63, 0x34, 0x2c,
+    0xdb, 0x19, 0xab, 0xf0, 0xb0, 0xb6, 0x44, 0xde, 0xba, 0x1d, 0x91, 0x5d, 0x72, 0x98, 0xc4, 0x2c,
+    0x1f, 0xaa, 0xc1, 0x05, 0x28, 0xbc, 0x04, 0x10, 0xfe, 0x04, 0xa7, 0x87, 0xe5, 0xd4, 0xd3, 0x22,
+    0xfd, 0x2a, 0xef, 0x98, 0xb8, 0xce, 0x73, 0x02, 0x75, 0xed, 0xea, 0xc0, 0xef, 0xc3, 0x74, 0xe0,
+    0x63, 0x37, 0x55, 0xf0, 0xd5, 0xf1, 0x18, 0xbb, 0xdf, 0x26, 0x87, 0x12, 0xe9, 0x03, 0xa2, 0x65,
+    0x9e, 0x8f, 0x90, 0x85, 0xe2, 0x31, 0x14, 0x01, 0x63, 0xcd, 0x4e, 0x02, 0x93, 0x63, 0xd6, 0x5c,
+    0xf3, 0xe4, 0x9b, 0x7e, 0x40, 0x51, 0x6b, 0xcc, 0x91, 0xbb, 0xde, 0xe7, 0xd4, 0x3c, 0x81, 0x48,
+    0x71, 0xc8, 0xc8, 0x55, 0x60, 0xb3, 0x5b, 0x56, 0xa1, 0x48, 0x3c, 0x66, 0x4d, 0xb4, 0x9d, 0x3d,
+    0xad, 0x12, 0x6b, 0x9c, 0xff, 0xad, 0x1b, 0xa7, 0x0c, 0x26, 0xe7, 0x07, 0x0f, 0xd8, 0xed, 0xf5,
+    0x04, 0x84, 0x59, 0xd0, 0xe9, 0x21, 0x2c, 0x30, 0xb5, 0x28, 0x3f, 0xce, 0x3b, 0xca, 0x17, 0xf5,
+    0x9c, 0x9c, 0x4d, 0x26, 0xe8, 0x58, 0x2a, 0x44, 0xda, 0x27, 0x98, 0x9f, 0x02, 0xb8, 0xc1, 0x7e,
+    0x43, 0x2a, 0x4c, 0x1a, 0x41, 0xf7, 0x22, 0x55, 0x2c, 0xde, 0xef, 0x18, 0x1a, 0xd0, 0x25, 0xc7,
+    0x5b, 0x68, 0xa9, 0x22, 0xfe, 0xe3, 0xb8, 0x00, 0x60, 0xe1, 0x31, 0x69, 0xdd, 0x61, 0x4d, 0x61,
+    0xd6, 0xfd, 0xa3, 0xce, 0x15, 0x0e, 0xdd, 0x90, 0x2b, 0x47, 0xc6, 0x17, 0xb4, 0x92, 0x77, 0x9a,
+    0xe7, 0x64, 0xe6, 0x70, 0x48, 0x8d, 0x9d, 0x1d, 0x60, 0xf5, 0xf9, 0xef, 0x18, 0x24, 0xba, 0x76,
+    0x96, 0x14, 0x31, 0xac, 0x09, 0xb7, 0x0d, 0x79, 0xe3, 0x7b, 0x2c, 0xdf, 0x9a, 0xb2, 0x05, 0xd8,
+    0x72, 0xfb, 0x0f, 0x62, 0x0c, 0xa7, 0x87, 0x3b, 0x8b, 0x68, 0x25, 0x6b, 0xc2, 0x94, 0x39, 0xe8,
+    0xbf, 0x73, 0x62, 0x2f, 0x97, 0xa0, 0xf5, 0xa0, 0x0f, 0x29, 0x91, 0xdb, 0x23, 0xfb, 0x72, 0x81,
+    0xd7, 0x02, 0xe1, 0x8c, 0xe9, 0x00, 0x0d, 0xc5, 0xdf, 0x00, 0x94, 0x8f, 0x46, 0x7c, 0x84, 0x4a,
+    0x15, 0x9a, 0xb4, 0x3b, 0x46, 0x4a, 0x89, 0xc9, 0x51, 0x11, 0xeb, 0x80, 0xb8, 0x50, 0x3c, 0x2e,
+    0xaa, 0xa9, 0x77, 0x0c, 0xbf, 0xa4, 0x58, 0x83, 0x4e, 0xac, 0xe4, 0x08, 0x6c, 0x2c, 0x47, 0x84,
+    0x2c, 0xb4, 0x92, 0x36, 0x9c, 0xe7, 0x54, 0xe9, 0x76, 0x48, 0xad, 0x89, 0xc5, 0x55, 0x72, 0x2f,
+    0xf0, 0xd8, 0xa9, 0xaf, 0x76, 0xe6, 0x7f, 0x3a, 0xac, 0xf1, 0xf1, 0xb5, 0x6e, 0x21, 0x4c, 0x97,
+    0xdc, 0x1e, 0xc5, 0x05, 0x88, 0xb2, 0xfc, 0x0f, 0x7e, 0x2b, 0xa7, 0x87, 0xe1, 0x62, 0xd3, 0xe2,
+    0x7a, 0x20, 0xcf, 0xc9, 0x70, 0x57, 0x82, 0xb2, 0x12, 0x40, 0xa4, 0x41, 0x79, 0xf8, 0x29, 0x1b,
+    0x39, 0x5e, 0xcb, 0x02, 0x18, 0xe6, 0x02, 0x1e, 0x3f, 0xe8, 0x00, 0x2b, 0x68, 0x54, 0x01, 0xce,
+    0xbd, 0x63, 0x1c, 0xa6, 0x93, 0x1c, 0x4d, 0xc7, 0x0e, 0x08, 0x46, 0x66, 0xe3, 0x42, 0x81, 0x83,
+    0xc7, 0x44, 0x58, 0x84, 0x35, 0x30, 0xf2, 0x4a, 0x0e, 0xc3, 0x2e, 0xcd, 0xc3, 0xcd, 0x47, 0x2b,
+    0x3d, 0x16, 0x75, 0x4e, 0x8d, 0x33, 0x87, 0x14, 0x8c, 0x36, 0x5c, 0xa5, 0x17, 0xa0, 0x9d, 0x41,
+    0x6a, 0x0b, 0x6b, 0x48, 0x83, 0xad, 0x9b, 0x7e, 0x78, 0x25, 0x37, 0x37, 0x65, 0x01, 0x8a, 0xdf,
+    0xfb, 0x83, 0x28, 0xcc, 0xe9, 0xe1, 0xc0, 0x86, 0xb4, 0x98, 0x32, 0xb7, 0x73, 0xca, 0xab, 0x96,
+    0xa0, 0xe4, 0xc2, 0x0e, 0xa9, 0x92, 0x23, 0x7e, 0x4a, 0x34, 0x76, 0xd7, 0xb2, 0x46, 0x88, 0xb9,
+    0x47, 0xe4, 0x4a, 0x6f, 0x2d, 0x32, 0x0d, 0x4c, 0x9f, 0xe8, 0x11, 0x03, 0x42, 0xde, 0xe8, 0xc0,
+    0xce, 0xad, 0x74, 0xd0, 0xfc, 0xc6, 0x2b, 0x34, 0x71, 0x96, 0x1c, 0x33, 0x5c, 0x0e, 0x08, 0x39,
+    0x47, 0x3e, 0x52, 0x8b, 0x16, 0x9e, 0x38, 0x79, 0x87, 0x35, 0xb4, 0x8d, 0x4a, 0x4e, 0xb6, 0x54,
+    0xcd, 0x53, 0x51, 0xdb, 0x01, 0xb1, 0x03, 0x1c, 0x52, 0x6f, 0x36, 0x71, 0x55, 0xdd, 0x95, 0x96,
+    0x25, 0x31, 0x41, 0x74, 0x59, 0xac, 0x0b, 0x6b, 0x91, 0xa6, 0xad, 0x5b, 0xe2, 0x9b, 0x25, 0xb7,
+    0xb4, 0x05, 0xd8, 0x35, 0x53, 0xa8, 0x79, 0xe8, 0xc4, 0xe9, 0xe1, 0x19, 0xaf, 0xb4, 0x18, 0xcd,
+    0xc7, 0x3b, 0x4a, 0x2a, 0x99, 0x92, 0x76, 0x79, 0x0f, 0x69, 0xc7, 0x08, 0x7e, 0xaa, 0x8f, 0x2f,
+    0xae, 0x22, 0xd2, 0x2c, 0xaf, 0x7e, 0xac, 0x4b, 0x2f, 0xef, 0x19, 0x0d, 0xcc, 0xc9, 0xf1, 0x11,
+    0x03, 0x76, 0x3c, 0x69, 0x44, 0xf4, 0xdc, 0x54, 0x31, 0xa1, 0xc9, 0x63, 0x2c, 0x26, 0x99, 0x1c,
+    0xa0, 0xea, 0x8f, 0x0b, 0xce, 0x2a, 0x1e, 0xc3, 0xd5, 0x29, 0xd6, 0x7c, 0x3f, 0x31, 0x39, 0xba,
+    0xf4, 0xcb, 0xd1, 0x01, 0x42, 0xad, 0xf4, 0xd5, 0xea, 0x39, 0x45, 0x4c, 0x22, 0x52, 0xd5, 0xc0,
+    0xf1, 0x18, 0x17, 0x96, 0x76, 0x76, 0xf3, 0x53, 0xac, 0x1d, 0xba, 0xb5, 0x6e, 0x4c, 0xe6, 0x2d,
+    0xdf, 0xb8, 0xab, 0x05, 0x98, 0x16, 0x15, 0x10, 0x4a, 0x7e, 0xa7, 0x87, 0xe8, 0x0a, 0x53, 0x66,
+    0x8d, 0x51, 0xcf, 0x79, 0xef, 0x66, 0x82, 0x72, 0x56, 0x40, 0xa4, 0xca, 0xc0, 0x79, 0xad, 0xdf,
+    0x9e, 0x98, 0x3b, 0x23, 0xc7, 0xf4, 0xaa, 0x7b, 0xd8, 0xc0, 0x00, 0xb7, 0xb5, 0x73, 0x22, 0xba,
+    0x27, 0xdd, 0x08, 0x87, 0x58, 0x03, 0xb6, 0x29, 0x69, 0x44, 0xb0, 0x6c, 0x54, 0x51, 0x6f, 0xca,
+    0x63, 0x3c, 0x34, 0x93, 0x1c, 0x74, 0x43, 0xa5, 0xca, 0x38, 0x86, 0xe3, 0x92, 0x92, 0x8a, 0xc7,
+    0x30, 0x3a, 0x85, 0x35, 0x02, 0x67, 0xca, 0x51, 0x6d, 0x2a, 0xad, 0x14, 0x19, 0xdd, 0x39, 0x4d,
+    0xcc, 0x1d, 0x52, 0x9c, 0x24, 0xf1, 0x58, 0x0f, 0x77, 0x76, 0x86, 0x56, 0x3d, 0xac, 0x9d, 0xf7,
+    0xb5, 0x6e, 0xa1, 0x07, 0x2d, 0xdf, 0x4d, 0x96, 0x05, 0xd8, 0x27, 0xfc, 0x0f, 0xa2, 0x79, 0xa7,
+    0x87, 0x31, 0x01, 0x53, 0xe6, 0x0d, 0xe0, 0xce, 0x49, 0xcc, 0x67, 0x82, 0x96, 0x7a, 0x3a, 0xa4,
+    0x57, 0x11, 0x8f, 0xac, 0xe4, 0xfc, 0x5d, 0x8b, 0x0f, 0x27, 0xe6, 0x36, 0xba, 0x2c, 0xbd, 0x0a,
+    0x33, 0xb4, 0xf3, 0xc4, 0x9f, 0x27, 0x0d, 0x3b, 0x7a, 0x58, 0x03, 0x06, 0xb4, 0x69, 0xc4, 0x02,
+    0x9b, 0x54, 0x11, 0x47, 0xc6, 0x63, 0x84, 0x2d, 0x98, 0x1c, 0x6f, 0x85, 0xa5, 0xca, 0x12, 0xbe,
+    0xe3, 0x22, 0x13, 0x84, 0xc7, 0x2c, 0xeb, 0x89, 0x35, 0x3a, 0x94, 0xcb, 0xd1, 0x21, 0x03, 0xad,
+    0x04, 0xe0, 0xf0, 0x39, 0x09, 0xbc, 0x1c, 0x52, 0x32, 0x8a, 0xf0, 0x58, 0x9a, 0xbd, 0x76, 0x66,
+    0xb0, 0x3c, 0xac, 0xe9, 0xeb, 0xb2, 0x7c, 0x04, 0x13, 0x17, 0x60, 0x67, 0x0c, 0x40, 0x08, 0x1a,
+    0x9d, 0x1e, 0x16, 0x12, 0x4e, 0x99, 0x55, 0x40, 0x3c, 0xa7, 0x42, 0x8d, 0x09, 0xda, 0xcf, 0xfd,
+    0x90, 0x06, 0x69, 0xe3, 0xb5, 0x2f, 0x03, 0x62, 0xae, 0x99, 0x16, 0xd3, 0xab, 0x7f, 0x56, 0x3b,
+    0xd7, 0x79, 0x77, 0xd2, 0xb0, 0xdf, 0x88, 0x75, 0x2c, 0x41, 0x9c, 0x5d, 0x35, 0xa6, 0xad, 0x03,
+    0xf5, 0xea, 0xe8, 0x00, 0xb0, 0x71, 0x54, 0xa1, 0xbc, 0xc2, 0x63, 0x30, 0x0a, 0x95, 0x1c, 0xda,
+    0xe5, 0x0e, 0x48, 0xe6, 0x24, 0x1e, 0x53, 0x72, 0x15, 0xd6, 0x54, 0x12, 0x2d, 0x39, 0xee, 0xf0,
+    0x34, 0xcf, 0x52, 0x7f, 0xe7, 0x54, 0x62, 0x70, 0x48, 0x39, 0xed, 0xc5, 0x55, 0xa4, 0x7b, 0xda,
+    0x59, 0xd3, 0xbc, 0xb0, 0xd6, 0x0a, 0xdf, 0xba, 0xd5, 0x74, 0x58, 0x72, 0x0a, 0x7c, 0xff, 0xe0,
+    0x5d, 0x72, 0x7a, 0x98, 0x8c, 0x2c, 0x2d, 0x6e, 0x44, 0xee, 0x9c, 0x48, 0x04, 0x26, 0xe8, 0x71,
+    0xc4, 0x43, 0x2a, 0xa7, 0x8b, 0x9f, 0x06, 0x7e, 0x89, 0xb9, 0xbb, 0x2e, 0x4b, 0xaf, 0x68, 0x44,
+    0x0d, 0xbc, 0x4f, 0xec, 0x11, 0x37, 0x7a, 0x1f, 0xd6, 0x1b, 0xc9, 0x70, 0x76, 0x9d, 0xd6, 0xd6,
+    0x4d, 0xc6, 0x44, 0xbc, 0x03, 0xf9, 0xf4, 0xea, 0xc0, 0x68, 0xcb, 0x74, 0x90, 0x91, 0xc8, 0x63,
+    0x78, 0x29, 0x9b, 0x1c, 0x33, 0xdc, 0x0f, 0xc8, 0xe9, 0xc4, 0x58, 0x33, 0x74, 0xc1, 0xe4, 0x8c,
+    0x19, 0xd7, 0x3c, 0xc5, 0x5f, 0x9f, 0x93, 0xac, 0x0f, 0x22, 0xf5, 0x2c, 0x21, 0x57, 0xb9, 0x45,
+    0x6f, 0x59, 0xdf, 0xf5, 0xc4, 0x1a, 0xc8, 0x70, 0xeb, 0x96, 0xff, 0x86, 0xc9, 0xb1, 0x4b, 0x05,
+    0x84, 0x80, 0xd7, 0xe9, 0xa1, 0x51, 0x30, 0xb5, 0xc8, 0x90, 0xd0, 0x3b, 0x36, 0x77, 0x99, 0xa0,
+    0x15, 0x96, 0x10, 0xe9, 0xd7, 0x6d, 0x7e, 0x2a, 0xca, 0xce, 0xf4, 0x3a, 0x97, 0xd7, 0xc0, 0x8b,
+    0x9c, 0x1f, 0x71, 0xe5, 0x49, 0x62, 0x5d, 0x99, 0x21, 0x67, 0x67, 0x70, 0x6f, 0xdd, 0xa9, 0xa8,
+    0x45, 0xf8, 0x40, 0xb5, 0x2b, 0xdf, 0x85, 0x78, 0xd9, 0x03, 0xac, 0xd3, 0x68, 0x44, 0xcf, 0x58,
+    0x54, 0x71, 0xe2, 0xc3, 0x63, 0xcc, 0x61, 0x92, 0x1c, 0x8f, 0xe3, 0x8d, 0x0b, 0x60, 0x05, 0x1e,
+    0x73, 0x38, 0x14, 0xd6, 0x3c, 0xdd, 0xd1, 0x4a, 0xf0, 0x66, 0x9d, 0xd3, 0x46, 0xc9, 0x21, 0x55,
+    0xf7, 0x09, 0x8f, 0xad, 0xa2, 0x66, 0x67, 0xa3, 0x55, 0xc3, 0x9a, 0x07, 0x4d, 0xeb, 0xf6, 0x58,
+    0x66, 0x01, 0x8e, 0x04, 0xfc, 0x83, 0x70, 0xdc, 0xe9, 0xa1, 0x6d, 0xa8, 0x94, 0x19, 0xd8, 0xb3,
+    0x73, 0x96, 0x1d, 0x98, 0xa0, 0xc3, 0x76, 0x0e, 0x69, 0x52, 0xed, 0x5d, 0xab, 0x40, 0x1e, 0xe6,
+    0x72, 0x6e, 0x2c, 0xbd, 0xff, 0x4e, 0x9e, 0x34, 0x82, 0xcd, 0x61, 0xed, 0xb7, 0x0f, 0x67, 0xcb,
+    0x8e, 0x69, 0xeb, 0xdf, 0x86, 0xc3, 0x3b, 0xf5, 0x46, 0x2b, 0xaf, 0xe6, 0x70, 0xd9, 0x03, 0xc0,
+    0x87, 0xe8, 0x80, 0x9b, 0xba, 0xe9, 0xc0, 0xb7, 0x35, 0xc9, 0xc1, 0xb8, 0xf1, 0x01, 0xd1, 0x47,
+    0x81, 0x8f, 0xa8, 0x1d, 0x0a, 0x6b, 0xc0, 0xc9, 0x2d, 0x39, 0x1e, 0x61, 0x69, 0x1e, 0x8e, 0xe3,
+    0x87, 0x14, 0x1a, 0x62, 0xb8, 0x4a, 0xc4, 0xa3, 0x96, 0x05, 0x97, 0xa4, 0x75, 0x23, 0xe5, 0x69,
+    0xc9, 0xd1, 0x44, 0x05, 0xec, 0x00, 0x6b, 0xa7, 0x87, 0xce, 0xa3, 0xa4, 0x45, 0x44, 0x4e, 0xbd,
+    0x23, 0x33, 0x59, 0x87, 0xd4, 0x57, 0x55, 0x7e, 0x2a, 0x90, 0x3e, 0x5c, 0x35, 0x2a, 0xb1, 0xf4,
+    0xd2, 0x22, 0xaa, 0x81, 0x95, 0x15, 0x7a, 0xc4, 0xbc, 0x71, 0xe3, 0x6c, 0xc3, 0x94, 0x5a, 0xb7,
+    0x0c, 0x32, 0x22, 0x9c, 0x47, 0xc1, 0x65, 0x6f, 0x4a, 0x0c, 0xd0, 0x77, 0x59, 0xa8, 0xf6, 0x53,
+    0x9b, 0x9d, 0x1e, 0x7a, 0x7a, 0xf0, 0x12, 0x01, 0xfa, 0x68, 0x51, 0x85, 0xac, 0xfb, 0x1d, 0x43,
+    0xf1, 0x2b, 0xc9, 0xc1, 0x6a, 0xb7, 0x71, 0x11, 0x2a, 0x7f, 0xc7, 0xe8, 0x9f, 0x09, 0x6b, 0x04,
+    0x9b, 0xd1, 0x4a, 0x1e, 0x83, 0x3a, 0x27, 0x62, 0x12, 0x87, 0x94, 0xb7, 0xe0, 0xec, 0x8c, 0x06,
+    0xc0, 0xb0, 0x06, 0xd0, 0xa7, 0x75, 0x33, 0x55, 0x66, 0x01, 0x52, 0x41, 0xf6, 0x07, 0x6d, 0x53,
+    0xa7, 0x87, 0x76, 0x88, 0x76, 0x4e, 0x65, 0xbe, 0x25, 0x28, 0x08, 0x48, 0x87, 0x94, 0x05, 0xe2,
+    0x5d, 0x4b, 0xf4, 0x38, 0xcc, 0xc5, 0x61, 0xb0, 0xf4, 0x92, 0xc2, 0xf1, 0xa4, 0x71, 0x52, 0x1c,
+    0xd6, 0x6e, 0xc9, 0xe1, 0x6c, 0x3e, 0xa3, 0xc3, 0xbb, 0x80, 0x61, 0x56, 0xde, 0x47, 0xc7, 0x65,
+    0x0f, 0x4f, 0x07, 0x40, 0xd8, 0x92, 0x89, 0x2e, 0x4c, 0x3c, 0x9d, 0x1e, 0x9a, 0x7b, 0x94, 0x24,
+    0x01, 0x7b, 0xea, 0xe8, 0x00, 0x06, 0x0c, 0x1e, 0x43, 0x70, 0x54, 0xc9, 0xa1, 0x34, 0x10, 0x8f,
+    0x51, 0x3a, 0x16, 0xd6, 0xa8, 0x79, 0x59, 0x72, 0xd8, 0xfd, 0x77, 0x4e, 0xda, 0xff, 0x0d, 0x29,
+    0x87, 0x76, 0x71, 0x15, 0x07, 0x44, 0xed, 0xcc, 0xa8, 0xb9, 0xb0, 0x46, 0x4f, 0xbe, 0x75, 0x53,
+    0x2c, 0xf7, 0x0f, 0x82, 0x3f, 0x4e, 0x0f, 0x29, 0x26, 0x4b, 0x8b, 0xb6, 0xde, 0x4b, 0x50, 0xb8,
+    0x21, 0x0f, 0x29, 0x7d, 0x27, 0x31, 0x97, 0x6e, 0xce, 0xd2, 0xeb, 0xc4, 0x9f, 0x06, 0x56, 0x10,
+    0x7e, 0x58, 0x43, 0x1a, 0x86, 0xb3, 0xf1, 0x55, 0x6d, 0xdd, 0x98, 0xb3, 0x88, 0x77, 0x24, 0xbc,
+    0xac, 0xbc, 0x6f, 0xe0, 0xcb, 0x1e, 0xdb, 0x52, 0xba, 0x30, 0x0e, 0x72, 0x7a, 0xb8, 0x7f, 0xca,
+    0x4b, 0x2c, 0x38, 0x7e, 0x50, 0x52, 0xc6, 0xe3, 0x2b, 0x01, 0x2f, 0xf8, 0xe8, 0x80, 0xb3, 0x58,
+    0xe9, 0x00, 0x21, 0x6a, 0xc9, 0xc1, 0xb5, 0xcd, 0x01, 0x01, 0xa7, 0x91, 0x8f, 0x78, 0x83, 0x10,
+    0x6b, 0x70, 0xcf, 0xd5, 0x3c, 0x5c, 0x11, 0x0e, 0x29, 0x87, 0x40, 0x71, 0x95, 0x90, 0x35, 0x2d,
+    0x8b, 0x69, 0x61, 0xeb, 0xa6, 0xdd, 0xd4, 0x92, 0x73, 0x90, 0x9c, 0x1e, 0x3a, 0x8e, 0x96, 0x16,
+    0x25, 0xf2, 0xf1, 0x8e, 0x44, 0x11, 0x1f, 0x52, 0x9f, 0x32, 0xf8, 0xa9, 0x1b, 0x7c, 0x71, 0x95,
+    0xa6, 0xcf, 0x47, 0x0c, 0xcb, 0x1b, 0xce, 0xe6, 0xb7, 0xb0, 0x75, 0x13, 0x37, 0x22, 0xc2, 0xb5,
+    0x76, 0x5d, 0xf6, 0x46, 0xec, 0x00, 0x7d, 0x29, 0xad, 0xbc, 0x44, 0xe7, 0x22, 0xd3, 0x22, 0xdd,
+    0x59, 0xbe, 0x52, 0x20, 0x3f, 0x7c, 0xa9, 0x51, 0xcd, 0xcc, 0xe4, 0x40, 0x48, 0x98, 0xce, 0xc8,
+    0x6a, 0x61, 0x01, 0x75, 0x48, 0xe9, 0x00, 0xa6, 0x2e, 0x1e, 0x03, 0x3d, 0x5b, 0xc9, 0x61, 0x3c,
+    0x36, 0xac, 0xd1, 0x58, 0xb3, 0xe4, 0xe8, 0x65, 0xf3, 0x9c, 0x58, 0xa3, 0x1b, 0x52, 0x28, 0xb0,
+    0xe3, 0x2a, 0xcb, 0xf7, 0xad, 0x1b, 0x64, 0xd6, 0x7f, 0x50, 0x42, 0xc8, 0xb4, 0x28, 0x7c, 0xc6,
+    0x04, 0x95, 0xca, 0xf3, 0x90, 0x92, 0x82, 0x5c, 0x7a, 0xa1, 0xef, 0xd3, 0xc0, 0x02, 0x91, 0x10,
+    0x6b, 0xb9, 0xb1, 0x5b, 0xb7, 0x82, 0xdf, 0xcb, 0xde, 0xe7, 0x3d, 0x2f, 0x31, 0x32, 0x01, 0x42,
+    0xe9, 0xcb, 0x90, 0xaf, 0x34, 0x7f, 0xab, 0x89, 0x9e, 0x04, 0x7b, 0x48, 0xbb, 0x44, 0xe4, 0xae,
+    0x3a, 0x89, 0x45, 0x59, 0xa2, 0xc2, 0xc0, 0x2f, 0x36, 0xb3, 0xa9, 0xd9, 0xb7, 0x5b, 0x9c, 0x7d,
+    0x05, 0xf5, 0x31, 0xbf, 0x2c, 0x44, 0xa0, 0x83, 0xe9, 0x6f, 0xe5, 0x01, 0x76, 0xec, 0x3b, 0x06,
+    0x96, 0x82, 0xc2, 0x1a, 0x00, 0x43, 0x75, 0x4e, 0x10, 0x94, 0xce, 0xce, 0x70, 0xa9, 0x2e, 0xac,
+    0x81, 0x2d, 0xce, 0x02, 0x04, 0xc9, 0x74, 0x7a, 0x88, 0x19, 0xd9, 0x12, 0x14, 0xc7, 0x13, 0x4b,
+    0x2f, 0x70, 0x48, 0x0e, 0x6b, 0xb4, 0xd0, 0x0e, 0xef, 0xe8, 0x71, 0x65, 0xe5, 0x61, 0x4a, 0x3a,
+    0x3d, 0xc4, 0x17, 0xef, 0x41, 0xc9, 0x43, 0x39, 0x4d, 0x94, 0x9b, 0x7c, 0xb8, 0x2b, 0xc8, 0x95,
+    0xad, 0x5d, 0x7e, 0xe4, 0x2c, 0xbd, 0x64, 0xce, 0xf5, 0x96, 0x89, 0xfc, 0xc9, 0x5f, 0xd3, 0x56,
+    0xeb, 0x31, 0x47, 0xd3, 0x06, 0x10, 0xd0, 0x39, 0xd0, 0xe9, 0x21, 0x99, 0x42, 0x84, 0x4a, 0xe8,
+    0x0b, 0x91, 0xa9, 0x4e, 0xa9, 0xe4, 0x6d, 0x8d, 0x56, 0xeb, 0x2d, 0xcb, 0x1e, 0xe1, 0xc6, 0xf6,
+    0xda, 0x49, 0xd6, 0xee, 0x64, 0xbe, 0x58, 0x1f, 0x26, 0x99, 0xd3, 0x43, 0x92, 0x67, 0x88, 0x14,
+    0x1f, 0x74, 0x7a, 0x48, 0xcf, 0x22, 0x67, 0x03
+};
+
+#endif /* ECLIPSE_TIMES_MODERN_COMPACT_H */
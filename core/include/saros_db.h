@@ -0,0 +1,389 @@
+/*
+ * saros_db.h — table-driven eclipse engine over saros_db_t
+ *
+ * saros.h binds each catalog to its own translation unit (the solar and
+ * lunar data headers share array names), so every find_* is an external
+ * call into that unit.  The functions here take the catalog as a
+ * saros_db_t instead: one set of searches serves both catalogs, any
+ * number of them can be used from one translation unit, and being
+ * static inline they are specialised into the caller when the db is a
+ * known constant.
+ *
+ *   #include "saros_db.h"
+ *
+ *   eclipse_result_t r = saros_db_find_next(&saros_lunar_db, now);
+ *   uint64_t bin = saros_db_octal_phase(&saros_solar_db, now_ms, 145, 2, 1000);
+ *
+ *   saros_range_t it;                                    // eclipses in [t0, t1]
+ *   eclipse_entry_t e;
+ *   saros_db_range(&it, &saros_solar_db, t0, t1, NULL);
+ *   while (saros_range_next(&it, &e)) { ... }
+ *
+ *   const saros_db_t *both[2] = { &saros_solar_db, &saros_lunar_db };
+ *   uint8_t which;
+ *   r = saros_db_find_next_any(both, 2, now, &which);   // next eclipse of any kind
+ *
+ * Results are identical to the matching find_* / calculate_* functions.
+ * Series records are clamped as they are read (at most
+ * SAROS_MAX_ECLIPSES members, indices below count), so a corrupt catalog
+ * file gives wrong answers but is never read outside its tables; see
+ * saros_file_verify() for rejecting one up front.
+ * Tables are read through ECLIPSE_READ_*, so a db in PROGMEM is only
+ * readable from a translation unit where those are the PROGMEM readers.
+ */
+
+#ifndef SAROS_DB_H
+#define SAROS_DB_H
+
+#include "saros.h"
+
+/**
+ * saros_range_filter_t — optional filter for saros_db_range().
+ * Start from SAROS_RANGE_FILTER_ANY and narrow what is needed.
+ */
+typedef struct {
+    uint32_t type_mask;   /**< SAROS_ECL_BIT(ecl_type) per accepted type; 0 = any */
+    uint8_t  saros_min;   /**< accepted series, inclusive */
+    uint8_t  saros_max;
+    uint8_t  pos_min;     /**< accepted 0-based position in the series, inclusive */
+    uint8_t  pos_max;
+} saros_range_filter_t;
+
+#define SAROS_RANGE_FILTER_ANY { 0u, 0u, 255u, 0u, 255u }
+
+/** Iterator over the eclipses of one db inside a time interval. */
+typedef struct {
+    const saros_db_t    *db;
+    uint32_t             next;     /**< next global index to look at */
+    uint32_t             end;      /**< one past the last index in the interval */
+    saros_range_filter_t filter;
+} saros_range_t;
+
+/* ── Internals ──────────────────────────────────────────────────────────── */
+
+static inline uint32_t _sdb_series_offset(const saros_db_t *db, uint8_t saros_number)
+{
+    return (uint32_t)(saros_number - db->saros_first) * SAROS_RECORD_SIZE;
+}
+
+/* Members of a series, never more than its record holds. */
+static inline uint8_t _sdb_series_count(const saros_db_t *db, uint8_t saros_number)
+{
+    const uint8_t c = ECLIPSE_READ_BYTE(db->saros + _sdb_series_offset(db, saros_number));
+    return c > SAROS_MAX_ECLIPSES ? (uint8_t)SAROS_MAX_ECLIPSES : c;
+}
+
+/* Global index of the eclipse at 'pos' within a series, kept inside the
+ * tables. */
+static inline uint16_t _sdb_series_index(const saros_db_t *db, uint8_t saros_number, uint8_t pos)
+{
+    const uint16_t idx = ECLIPSE_READ_WORD(db->saros + _sdb_series_offset(db, saros_number) + 2u
+                                           + (uint32_t)pos * 2u);
+    return idx < db->count ? idx : (uint16_t)(db->count - 1u);
+}
+
+static inline int64_t _sdb_series_time(const saros_db_t *db, uint8_t saros_number, uint8_t pos)
+{
+    return _saros_read_i64(db->times, _sdb_series_index(db, saros_number, pos));
+}
+
+static inline eclipse_entry_t _sdb_entry(const saros_db_t *db, uint32_t idx)
+{
+    eclipse_entry_t e;
+    uint8_t         b[ECLIPSE_INFO_SIZE];
+    const uint8_t  *p = db->info + idx * ECLIPSE_INFO_SIZE;
+
+    memset(&e, 0, sizeof(e));
+    e.global_index = (uint16_t)idx;
+    e.unix_time    = _saros_read_i64(db->times, idx);
+    for (uint8_t i = 0; i < ECLIPSE_INFO_SIZE; i++)
+        b[i] = ECLIPSE_READ_BYTE(p + i);
+    if (db->is_lunar)
+        e.info.lunar = _decode_lunar(b);
+    else
+        e.info.solar = _decode_solar(b);
+    e.valid = 1;
+    return e;
+}
+
+/* strict = 0: first index with time >= key; strict = 1: first with time > key. */
+static inline uint32_t _sdb_bound(const saros_db_t *db, int64_t key, int strict)
+{
+    uint32_t lo = 0, hi = db->count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2u;
+        int64_t  t   = _saros_read_i64(db->times, mid);
+        if (strict ? (t <= key) : (t < key))
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* The eclipse at idx with its neighbours in the same series. */
+static inline eclipse_result_t _sdb_result(const saros_db_t *db, uint32_t idx)
+{
+    eclipse_result_t r;
+    uint8_t          saros_number, pos, count;
+
+    memset(&r, 0, sizeof(r));
+    r.eclipse    = _sdb_entry(db, idx);
+    saros_number = db->is_lunar ? r.eclipse.info.lunar.saros_number
+                                : r.eclipse.info.solar.saros_number;
+    pos          = db->is_lunar ? r.eclipse.info.lunar.saros_pos
+                                : r.eclipse.info.solar.saros_pos;
+    if (saros_number < db->saros_first || saros_number > db->saros_last)
+        return r;
+
+    count = _sdb_series_count(db, saros_number);
+    if (pos > 0u && pos <= count)
+        r.saros_prev = _sdb_entry(db, _sdb_series_index(db, saros_number, pos - 1u));
+    if ((uint32_t)pos + 1u < (uint32_t)count)
+        r.saros_next = _sdb_entry(db, _sdb_series_index(db, saros_number, pos + 1u));
+    return r;
+}
+
+/* ── Single catalog ─────────────────────────────────────────────────────── */
+
+/**
+ * saros_db_find_next(db, ts) / saros_db_find_past(db, ts)
+ *   find_next/past_*_eclipse() on db.
+ */
+static inline eclipse_result_t saros_db_find_next(const saros_db_t *db, int64_t timestamp)
+{
+    eclipse_result_t empty;
+    uint32_t         idx = _sdb_bound(db, timestamp, 0);
+    if (idx < db->count)
+        return _sdb_result(db, idx);
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+}
+
+static inline eclipse_result_t saros_db_find_past(const saros_db_t *db, int64_t timestamp)
+{
+    eclipse_result_t empty;
+    uint32_t         idx = _sdb_bound(db, timestamp, 1);
+    if (idx > 0u)
+        return _sdb_result(db, idx - 1u);
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+}
+
+/**
+ * saros_db_saros_window(db, ts, saros_number)
+ *   find_*_saros_window() on db.
+ */
+static inline saros_window_t saros_db_saros_window(const saros_db_t *db, int64_t timestamp,
+                                                   uint8_t saros_number)
+{
+    saros_window_t w;
+    uint8_t        count, lo = 0, hi;
+
+    memset(&w, 0, sizeof(w));
+    w.saros_number = saros_number;
+    if (saros_number < db->saros_first || saros_number > db->saros_last)
+        return w;
+
+    count = _sdb_series_count(db, saros_number);
+    hi    = count;
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2u;
+        if (_sdb_series_time(db, saros_number, mid) < timestamp)
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    if (lo < count)
+        w.future = _sdb_entry(db, _sdb_series_index(db, saros_number, lo));
+    if (lo > 0u)
+        w.past   = _sdb_entry(db, _sdb_series_index(db, saros_number, lo - 1u));
+    return w;
+}
+
+/**
+ * saros_db_octal_phase(db, ts, saros_number, resolution, scale)
+ *   calculate_*_octal_phase() for scale 1 (ts in seconds) and
+ *   calculate_*_octal_phase_ms() for scale 1000 (ts in milliseconds).
+ *   0 when ts is outside the series.
+ */
+static inline uint64_t saros_db_octal_phase(const saros_db_t *db, int64_t timestamp,
+                                            uint8_t saros_number, uint8_t resolution,
+                                            uint16_t scale)
+{
+    saros_window_t w;
+    uint64_t       total;
+
+    if (scale == 0u)
+        return 0;
+    w = saros_db_saros_window(db, timestamp / scale, saros_number);
+    if (!w.past.valid || !w.future.valid)
+        return 0;
+    total = (uint64_t)(w.future.unix_time - w.past.unix_time) * scale;
+    if (total == 0u)
+        return 0;
+    return _saros_div_pow2((uint64_t)(timestamp - w.past.unix_time * scale),
+                           _saros_resolution_bits(resolution), total);
+}
+
+/**
+ * saros_db_series(db, saros_number, times, &count)
+ *   get_solar_saros_series() on db, except that unused slots are zeroed.
+ *   count is 0 for a series outside the catalog.
+ */
+static inline void saros_db_series(const saros_db_t *db, uint8_t saros_number,
+                                   int64_t times[SAROS_MAX_ECLIPSES], uint8_t *count)
+{
+    uint8_t c = 0;
+
+    memset(times, 0, SAROS_MAX_ECLIPSES * sizeof(int64_t));
+    if (saros_number >= db->saros_first && saros_number <= db->saros_last) {
+        c = _sdb_series_count(db, saros_number);
+        for (uint8_t i = 0; i < c; i++)
+            times[i] = _sdb_series_time(db, saros_number, i);
+    }
+    *count = c;
+}
+
+/**
+ * saros_db_series_count(db, saros_number)
+ *   Number of eclipses in a series; 0 outside the catalog.
+ */
+static inline uint8_t saros_db_series_count(const saros_db_t *db, uint8_t saros_number)
+{
+    if (saros_number < db->saros_first || saros_number > db->saros_last)
+        return 0;
+    return _sdb_series_count(db, saros_number);
+}
+
+/* ── Time ranges ────────────────────────────────────────────────────────── */
+
+/**
+ * saros_db_range(it, db, t0, t1, filter) / saros_range_next(it, &entry)
+ *   Eclipses with t0 <= unix_time <= t1 in time order, optionally filtered
+ *   (filter may be NULL).  The interval costs two bisections up front;
+ *   after that the records are walked in order, and the filter is checked
+ *   on the raw series / position / type bytes so rejected eclipses are
+ *   never decoded.  saros_range_next() returns 0 once the range is done.
+ */
+static inline void saros_db_range(saros_range_t *it, const saros_db_t *db, int64_t t0, int64_t t1,
+                                  const saros_range_filter_t *filter)
+{
+    static const saros_range_filter_t any = SAROS_RANGE_FILTER_ANY;
+
+    it->db     = db;
+    it->filter = filter ? *filter : any;
+    it->next   = _sdb_bound(db, t0, 0);
+    it->end    = t1 < t0 ? it->next : _sdb_bound(db, t1, 1);
+}
+
+static inline int saros_range_next(saros_range_t *it, eclipse_entry_t *out)
+{
+    const saros_range_filter_t *f = &it->filter;
+
+    while (it->next < it->end) {
+        const uint32_t idx = it->next++;
+        const uint8_t *p   = it->db->info + idx * ECLIPSE_INFO_SIZE;
+        const uint8_t  num = ECLIPSE_READ_BYTE(p + 6);
+        const uint8_t  pos = ECLIPSE_READ_BYTE(p + 7);
+        const uint8_t  typ = ECLIPSE_READ_BYTE(p + 8);
+
+        if (num < f->saros_min || num > f->saros_max || pos < f->pos_min || pos > f->pos_max)
+            continue;
+        if (f->type_mask != 0u && (typ >= 32u || !(f->type_mask & SAROS_ECL_BIT(typ))))
+            continue;
+        *out = _sdb_entry(it->db, idx);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * saros_eclipse_range(db, t0, t1, filter, callback, user)
+ *   Callback form of saros_db_range(): calls callback(&entry, user) for
+ *   each match in time order until it returns 0.  Returns the number of
+ *   eclipses delivered.
+ */
+typedef int (*saros_range_callback_t)(const eclipse_entry_t *entry, void *user);
+
+static inline uint32_t saros_eclipse_range(const saros_db_t *db, int64_t t0, int64_t t1,
+                                           const saros_range_filter_t *filter,
+                                           saros_range_callback_t callback, void *user)
+{
+    saros_range_t   it;
+    eclipse_entry_t e;
+    uint32_t        n = 0;
+
+    saros_db_range(&it, db, t0, t1, filter);
+    while (saros_range_next(&it, &e)) {
+        n++;
+        if (!callback(&e, user))
+            break;
+    }
+    return n;
+}
+
+/* ── Several catalogs ───────────────────────────────────────────────────── */
+
+/**
+ * saros_db_find_next_any(dbs, n, ts, &which) / saros_db_find_past_any(...)
+ *   Nearest eclipse at or after (before) ts across n catalogs, e.g. solar
+ *   and lunar together.  Each catalog is only bisected; the result is
+ *   decoded once, for the winner.  which receives the winning catalog's
+ *   position in dbs (earliest on ties); eclipse.valid == 0 if none has one.
+ */
+static inline eclipse_result_t saros_db_find_next_any(const saros_db_t *const *dbs, uint8_t n,
+                                                      int64_t timestamp, uint8_t *which)
+{
+    eclipse_result_t empty;
+    uint32_t         best_idx = 0;
+    int64_t          best_time = 0;
+    int              best = -1;
+
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t idx = _sdb_bound(dbs[i], timestamp, 0);
+        if (idx < dbs[i]->count) {
+            int64_t t = _saros_read_i64(dbs[i]->times, idx);
+            if (best < 0 || t < best_time) {
+                best = i;
+                best_idx = idx;
+                best_time = t;
+            }
+        }
+    }
+    if (which)
+        *which = best < 0 ? 0u : (uint8_t)best;
+    if (best >= 0)
+        return _sdb_result(dbs[best], best_idx);
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+}
+
+static inline eclipse_result_t saros_db_find_past_any(const saros_db_t *const *dbs, uint8_t n,
+                                                      int64_t timestamp, uint8_t *which)
+{
+    eclipse_result_t empty;
+    uint32_t         best_idx = 0;
+    int64_t          best_time = 0;
+    int              best = -1;
+
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t idx = _sdb_bound(dbs[i], timestamp, 1);
+        if (idx > 0u) {
+            int64_t t = _saros_read_i64(dbs[i]->times, idx - 1u);
+            if (best < 0 || t > best_time) {
+                best = i;
+                best_idx = idx - 1u;
+                best_time = t;
+            }
+        }
+    }
+    if (which)
+        *which = best < 0 ? 0u : (uint8_t)best;
+    if (best >= 0)
+        return _sdb_result(dbs[best], best_idx);
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+}
+
+#endif /* SAROS_DB_H */
@@ -0,0 +1,109 @@
+/*
+ * saros_file.h — memory-mapped eclipse catalogs (desktop / server builds)
+ *
+ * A catalog file carries the same tables as the compiled-in data headers,
+ * so the full Saros 1–180 set or any build_db.py catalog can be loaded at
+ * run time.  saros_file_open() maps the file read-only and hands out a
+ * saros_db_t that points straight into the mapping; every saros_db.h
+ * search then runs on the file with no copy.
+ *
+ *   saros_file_t f;
+ *   if (saros_file_open(&f, "solar_all.sdb") == SAROS_FILE_OK) {
+ *       eclipse_result_t r = saros_db_find_next(&f.db, now);
+ *       ...
+ *       saros_file_close(&f);
+ *   }
+ *
+ * ── Layout (little-endian) ────────────────────────────────────────────────
+ *   [ 0.. 7]  magic "SAROSDB\0"
+ *   [ 8.. 9]  uint16 version (SAROS_FILE_VERSION)
+ *   [10]      uint8  kind: 0 solar, 1 lunar
+ *   [11]      uint8  reserved, 0
+ *   [12]      uint8  saros_first
+ *   [13]      uint8  saros_last
+ *   [14..15]  uint16 series record size (SAROS_RECORD_SIZE)
+ *   [16..19]  uint32 eclipse count
+ *   [20..23]  uint32 file size
+ *   [24..27]  uint32 times  offset   count × int64, 8-byte aligned
+ *   [28..31]  uint32 info   offset   count × ECLIPSE_INFO_SIZE bytes
+ *   [32..35]  uint32 series offset   (last - first + 1) × record size
+ *   [36..39]  uint32 CRC-32 of the times section
+ *   [40..43]  uint32 CRC-32 of the info section
+ *   [44..47]  uint32 CRC-32 of the series section
+ *   [48..59]  reserved, 0
+ *   [60..63]  uint32 CRC-32 of bytes 0..59
+ *
+ * saros_file_open() only checks the 64-byte header (magic, version, header
+ * CRC, sizes and bounds of every section), so opening costs the same
+ * whatever the catalog size.  The section contents are not read: the
+ * saros_db.h readers clamp series records to the tables, so a corrupt or
+ * crafted file gets wrong answers but no reads outside the mapping.
+ * saros_file_verify() is the opt-in full pass for untrusted files: every
+ * series record (at most SAROS_MAX_ECLIPSES members, each global index
+ * below the eclipse count, members and the times section in ascending
+ * time), then the section CRCs.
+ *
+ * Not available on Arduino builds.
+ */
+
+#ifndef SAROS_FILE_H
+#define SAROS_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "saros.h"
+
+#define SAROS_FILE_VERSION     1u
+#define SAROS_FILE_HEADER_SIZE 64u
+
+typedef enum {
+    SAROS_FILE_OK = 0,
+    SAROS_FILE_ERR_IO,         /**< cannot open, map or write the file */
+    SAROS_FILE_ERR_FORMAT,     /**< bad magic, header CRC, size or section bounds; from verify, bad series records */
+    SAROS_FILE_ERR_VERSION,    /**< written by a newer format revision */
+    SAROS_FILE_ERR_CHECKSUM    /**< a section does not match its CRC */
+} saros_file_status_t;
+
+/** An open catalog; db stays valid until saros_file_close(). */
+typedef struct {
+    saros_db_t     db;
+    const uint8_t *data;       /**< start of the mapping */
+    size_t         size;
+    void          *handle;     /**< platform mapping; NULL for a caller-owned buffer */
+} saros_file_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * saros_file_open(f, path)
+ *   Map path read-only and validate its header: O(1).  On failure f is
+ *   left closed (safe to pass to saros_file_close()).
+ *
+ * saros_file_open_memory(f, data, size)
+ *   Same checks over a caller-owned buffer (e.g. a fetched file on the
+ *   web build); the buffer must be 8-byte aligned and outlive f.
+ *
+ * saros_file_verify(f)
+ *   SAROS_FILE_ERR_FORMAT if a series record or the time order is
+ *   inconsistent, else SAROS_FILE_ERR_CHECKSUM if a section does not
+ *   match its CRC-32: O(catalog size).
+ *
+ * saros_file_close(f)
+ *   Unmap; f->db must not be used afterwards.
+ *
+ * saros_file_write(path, db)
+ *   Write db (e.g. saros_solar_db) as a catalog file.
+ */
+saros_file_status_t saros_file_open(saros_file_t *f, const char *path);
+saros_file_status_t saros_file_open_memory(saros_file_t *f, const void *data, size_t size);
+saros_file_status_t saros_file_verify(const saros_file_t *f);
+void                saros_file_close(saros_file_t *f);
+saros_file_status_t saros_file_write(const char *path, const saros_db_t *db);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAROS_FILE_H */
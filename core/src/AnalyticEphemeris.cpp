@@ -0,0 +1,215 @@
+//
+// Analytic Sun and Moon, scalar and batched (see AnalyticEphemeris.h).
+//
+
+#include "AnalyticEphemeris.h"
+
+#include <math.h>
+
+namespace Fractonica::AnalyticEphemeris {
+
+    static constexpr double Deg = 3.14159265358979323846 / 180.0;
+    static constexpr double InvTwoPi = 0.15915494309189533577;
+    // 2*pi split so that k * TwoPiHi is exact for any k the series reaches
+    static constexpr double TwoPiHi = 6.28125;
+    static constexpr double TwoPiLo = 1.9353071795864769253e-3;
+    // Adding and subtracting 1.5 * 2^52 rounds a double to an integer
+    static constexpr double RoundMagic = 6755399441055744.0;
+
+    // The kernels below are written once for T = double and for T = a
+    // vector of doubles (GCC/Clang vector extensions), using only + - * /
+    // so both compile to the same operations lane by lane.  That holds while
+    // nothing fuses them into multiply-adds: CMakeLists.txt builds this file
+    // without FP contraction (and, on GCC, without SLP vectorisation of the
+    // scalar path).  RoundMagic also needs plain round-to-nearest doubles,
+    // so no -ffast-math and no x87 excess precision.
+
+    static inline double Sqrt(const double v) { return sqrt(v); }
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__AVR__)
+#define ANALYTIC_EPHEMERIS_LANES
+    // One SSE2 / NEON register of doubles; wider targets still split it well.
+    typedef double Lanes __attribute__((vector_size(16)));
+    static constexpr size_t LaneCount = sizeof(Lanes) / sizeof(double);
+
+    static inline Lanes Sqrt(Lanes v) {
+        for (size_t i = 0; i < LaneCount; i++) v[i] = sqrt(v[i]);
+        return v;
+    }
+#endif
+
+    // sin and cos of a: reduce to [-pi, pi], evaluate at a quarter of that
+    // (Taylor to 1e-14 on [-pi/4, pi/4]) and double the angle twice.
+    template<typename T>
+    static inline void SinCos(const T a, T &s, T &c) {
+        const T k = (a * InvTwoPi + RoundMagic) - RoundMagic;
+        const T y = ((a - k * TwoPiHi) - k * TwoPiLo) * 0.25;
+        const T y2 = y * y;
+        T sq = y * (1.0 + y2 * (-1.0 / 6 + y2 * (1.0 / 120 + y2 * (-1.0 / 5040 + y2 * (1.0 / 362880
+                    + y2 * (-1.0 / 39916800 + y2 * (1.0 / 6227020800.0)))))));
+        T cq = 1.0 + y2 * (-1.0 / 2 + y2 * (1.0 / 24 + y2 * (-1.0 / 720 + y2 * (1.0 / 40320
+                    + y2 * (-1.0 / 3628800 + y2 * (1.0 / 479001600 + y2 * (-1.0 / 87178291200.0)))))));
+        T sh = 2.0 * sq * cq;
+        T ch = cq * cq - sq * sq;
+        s = 2.0 * sh * ch;
+        c = ch * ch - sh * sh;
+    }
+
+    template<typename T>
+    static inline T Sin(const T a) {
+        T s, c;
+        SinCos(a, s, c);
+        return s;
+    }
+
+    template<typename T>
+    static inline T Cos(const T a) {
+        T s, c;
+        SinCos(a, s, c);
+        return c;
+    }
+
+    template<typename T>
+    static inline void SunKernel(const T d, T &x, T &y, T &z) {
+        const T w = (282.9404 + 4.70935e-5 * d) * Deg;   // argument of perihelion
+        const T e = 0.016709 - 1.151e-9 * d;             // eccentricity
+        const T M = (356.0470 + 0.9856002585 * d) * Deg; // mean anomaly
+        T sM, cM, sE, cE, sw, cw;
+
+        SinCos(M, sM, cM);
+        SinCos(M + e * sM * (1.0 + e * cM), sE, cE);
+        SinCos(w, sw, cw);
+        const T xv = cE - e;
+        const T yv = Sqrt(1.0 - e * e) * sE;
+        x = xv * cw - yv * sw;
+        y = xv * sw + yv * cw;
+        z = d * 0.0;
+    }
+
+    template<typename T>
+    static inline void MoonKernel(const T d, T &x, T &y, T &z) {
+        constexpr double e = 0.054900;                   // eccentricity
+        const double cosI = cos(5.1454 * Deg), sinI = sin(5.1454 * Deg);
+        const T N = (125.1228 - 0.0529538083 * d) * Deg; // longitude of ascending node
+        const T w = (318.0634 + 0.1643573223 * d) * Deg; // argument of perigee
+        const T M = (115.3654 + 13.0649929509 * d) * Deg;
+        const T Ms = (356.0470 + 0.9856002585 * d) * Deg;
+        const T Ls = (282.9404 + 4.70935e-5 * d) * Deg + Ms;
+        const T Lm = N + w + M;
+        const T D = Lm - Ls;
+        const T F = Lm - N;
+        T s, c;
+
+        // Kepler's equation, Newton from the second-order start
+        SinCos(M, s, c);
+        T E = M + e * s * (1.0 + e * c);
+        for (int i = 0; i < 3; i++) {
+            SinCos(E, s, c);
+            E = E + (M - E + e * s) / (1.0 - e * c);
+        }
+        SinCos(E, s, c);
+
+        // Perturbations: longitude and latitude in degrees, distance in Earth radii
+        const T lon = -1.274 * Sin(M - 2.0 * D) + 0.658 * Sin(2.0 * D) - 0.186 * Sin(Ms)
+                      - 0.059 * Sin(2.0 * M - 2.0 * D) - 0.057 * Sin(M - 2.0 * D + Ms) + 0.053 * Sin(M + 2.0 * D)
+                      + 0.046 * Sin(2.0 * D - Ms) + 0.041 * Sin(M - Ms) - 0.035 * Sin(D)
+                      - 0.031 * Sin(M + Ms) - 0.015 * Sin(2.0 * F - 2.0 * D) + 0.011 * Sin(M - 4.0 * D);
+        const T lat = -0.173 * Sin(F - 2.0 * D) - 0.055 * Sin(M - F - 2.0 * D) - 0.046 * Sin(M + F - 2.0 * D)
+                      + 0.033 * Sin(F + 2.0 * D) + 0.017 * Sin(2.0 * M + F);
+        const T a = 60.2666 - 0.58 * Cos(M - 2.0 * D) - 0.46 * Cos(2.0 * D);
+
+        // Orbit plane, then ecliptic
+        const T xv = a * (c - e);
+        const T yv = a * (Sqrt(1.0 - e * e) * s);
+        T sw, cw, sN, cN;
+        SinCos(w, sw, cw);
+        SinCos(N, sN, cN);
+        const T u = xv * cw - yv * sw;
+        const T v = xv * sw + yv * cw;
+        const T x0 = cN * u - sN * v * cosI;
+        const T y0 = sN * u + cN * v * cosI;
+        const T z0 = v * sinI;
+
+        // Turn by the perturbations in longitude, then in latitude
+        SinCos(lon * Deg, s, c);
+        const T x1 = x0 * c - y0 * s;
+        const T y1 = y0 * c + x0 * s;
+        const T rho = Sqrt(x1 * x1 + y1 * y1);
+        SinCos(lat * Deg, s, c);
+        const T k = c - z0 * s / rho;
+        x = x1 * k;
+        y = y1 * k;
+        z = z0 * c + rho * s;
+    }
+
+    static double Angle(const Position &a, const Position &b) {
+        const double cx = a.y * b.z - a.z * b.y;
+        const double cy = a.z * b.x - a.x * b.z;
+        const double cz = a.x * b.y - a.y * b.x;
+        return atan2(sqrt(cx * cx + cy * cy + cz * cz), a.x * b.x + a.y * b.y + a.z * b.z);
+    }
+
+    Position Sun(const double d) {
+        Position p{};
+        SunKernel(d, p.x, p.y, p.z);
+        return p;
+    }
+
+    Position Moon(const double d) {
+        Position p{};
+        MoonKernel(d, p.x, p.y, p.z);
+        return p;
+    }
+
+    Position ToEquatorial(const Position &ecliptic, const double d) {
+        const double ecl = (23.4393 - 3.563e-7 * d) * Deg;
+        const double c = cos(ecl), s = sin(ecl);
+        return { ecliptic.x, ecliptic.y * c - ecliptic.z * s, ecliptic.y * s + ecliptic.z * c };
+    }
+
+    double Elongation(const double d) {
+        return Angle(Sun(d), Moon(d));
+    }
+
+    // ── Batches ─────────────────────────────────────────────────────────
+
+#ifdef ANALYTIC_EPHEMERIS_LANES
+    template<void (*Kernel)(Lanes, Lanes &, Lanes &, Lanes &), void (*Scalar)(double, double &, double &, double &)>
+    static void Batch(const double *d, const size_t count, Position *out) {
+        size_t i = 0;
+        for (; i + LaneCount <= count; i += LaneCount) {
+            Lanes t, x, y, z;
+            for (size_t j = 0; j < LaneCount; j++) t[j] = d[i + j];
+            Kernel(t, x, y, z);
+            for (size_t j = 0; j < LaneCount; j++) out[i + j] = { x[j], y[j], z[j] };
+        }
+        for (; i < count; i++) Scalar(d[i], out[i].x, out[i].y, out[i].z);
+    }
+
+    void SunPositions(const double *d, const size_t count, Position *out) {
+        Batch<SunKernel<Lanes>, SunKernel<double>>(d, count, out);
+    }
+
+    void MoonPositions(const double *d, const size_t count, Position *out) {
+        Batch<MoonKernel<Lanes>, MoonKernel<double>>(d, count, out);
+    }
+#else
+    void SunPositions(const double *d, const size_t count, Position *out) {
+        for (size_t i = 0; i < count; i++) out[i] = Sun(d[i]);
+    }
+
+    void MoonPositions(const double *d, const size_t count, Position *out) {
+        for (size_t i = 0; i < count; i++) out[i] = Moon(d[i]);
+    }
+#endif
+
+    void Elongations(const double *d, const size_t count, double *out) {
+        Position sun[64], moon[64];
+        for (size_t i = 0; i < count; i += 64) {
+            const size_t n = count - i < 64 ? count - i : 64;
+            SunPositions(d + i, n, sun);
+            MoonPositions(d + i, n, moon);
+            for (size_t j = 0; j < n; j++) out[i + j] = Angle(sun[j], moon[j]);
+        }
+    }
+}
@@ -19,6 +19,35 @@ static inline int64_t read_int64_progmem(const int64_t *p)
 #define READ_INT64(ptr) (*(const int64_t *)(ptr))
 #endif
 
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+#define FRACTONICA_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static uint64_t read_le64(const uint8_t *buf)
+{
+  return (uint64_t)buf[0] | ((uint64_t)buf[1] << 8) |
+         ((uint64_t)buf[2] << 16) | ((uint64_t)buf[3] << 24) |
+         ((uint64_t)buf[4] << 32) | ((uint64_t)buf[5] << 40) |
+         ((uint64_t)buf[6] << 48) | ((uint64_t)buf[7] << 56);
+}
+
+static uint32_t read_le32(const uint8_t *buf)
+{
+  return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) |
+         ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static void parse_header(const uint8_t *buf, fractonica_header_t *header)
+{
+  header->magic = read_le32(buf);
+  header->entry_count = read_le32(buf + 4);
+  header->reserved = read_le64(buf + 8);
+}
+
 void *fractonica_file_open(const char *filepath, fractonica_header_t *header)
 {
   if (!filepath || !header)
@@ -39,16 +68,7 @@ void *fractonica_file_open(const char *filepath, fractonica_header_t *header)
     return NULL;
   }
 
-  header->magic = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) |
-                  ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
-
-  header->entry_count = (uint32_t)buf[4] | ((uint32_t)buf[5] << 8) |
-                        ((uint32_t)buf[6] << 16) | ((uint32_t)buf[7] << 24);
-
-  header->reserved = (uint64_t)buf[8] | ((uint64_t)buf[9] << 8) |
-                      ((uint64_t)buf[10] << 16) | ((uint64_t)buf[11] << 24) |
-                      ((uint64_t)buf[12] << 32) | ((uint64_t)buf[13] << 40) |
-                      ((uint64_t)buf[14] << 48) | ((uint64_t)buf[15] << 56);
+  parse_header(buf, header);
 
   return f;
 }
@@ -84,51 +104,303 @@ int64_t fractonica_file_get_timestamp(void *handle,
     return (int64_t)FRACTONICA_INVALID;
   }
 
-  /* Little-endian parse */
-  uint64_t val = (uint64_t)buf[0] | ((uint64_t)buf[1] << 8) |
-                  ((uint64_t)buf[2] << 16) | ((uint64_t)buf[3] << 24) |
-                  ((uint64_t)buf[4] << 32) | ((uint64_t)buf[5] << 40) |
-                  ((uint64_t)buf[6] << 48) | ((uint64_t)buf[7] << 56);
+  return (int64_t)read_le64(buf);
+}
+
+bool fractonica_file_source_open(fractonica_file_source_t *file,
+                                 const char *filepath,
+                                 fractonica_file_mode_t mode)
+{
+  if (!file || !filepath)
+  {
+    return false;
+  }
+  memset(file, 0, sizeof(*file));
+
+#ifdef FRACTONICA_HAVE_MMAP
+  if (mode == FRACTONICA_FILE_MMAP)
+  {
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    struct stat st;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size >= FRACTONICA_HEADER_SIZE)
+    {
+      map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+      return false;
+    }
+    file->map = (const uint8_t *)map;
+    file->map_size = (size_t)st.st_size;
+    parse_header(file->map, &file->header);
+  }
+  else
+#else
+  (void)mode;
+#endif
+  {
+    file->handle = fractonica_file_open(filepath, &file->header);
+    if (!file->handle)
+    {
+      return false;
+    }
+  }
+
+  /* Every declared entry must be there */
+  uint64_t size = file->map_size;
+  if (file->handle)
+  {
+    FILE *f = (FILE *)file->handle;
+    long end = (fseek(f, 0, SEEK_END) == 0) ? ftell(f) : -1L;
+    size = (end < 0) ? 0 : (uint64_t)end;
+  }
+  if (file->header.magic != FRACTONICA_MAGIC || file->header.reserved != 0 ||
+      size < FRACTONICA_HEADER_SIZE + (uint64_t)file->header.entry_count * 8u)
+  {
+    fractonica_file_source_close(file);
+    return false;
+  }
+  return true;
+}
+
+void fractonica_file_source_close(fractonica_file_source_t *file)
+{
+  if (!file)
+  {
+    return;
+  }
+#ifdef FRACTONICA_HAVE_MMAP
+  if (file->map)
+  {
+    munmap((void *)file->map, file->map_size);
+  }
+#endif
+  fractonica_file_close(file->handle);
+  file->handle = NULL;
+  file->map = NULL;
+  file->map_size = 0;
+  memset(file->used, 0, sizeof(file->used));
+}
+
+/* Entry index of a file, from the mapping or the block holding it. */
+static int64_t file_read(fractonica_file_source_t *file, uint32_t index)
+{
+  const uint64_t offset = FRACTONICA_HEADER_SIZE + (uint64_t)index * 8u;
+
+  if (file->map)
+  {
+    return (int64_t)read_le64(file->map + offset);
+  }
+
+  const uint32_t page = (uint32_t)(offset / FRACTONICA_FILE_PAGE_SIZE);
+  const uint32_t within = (uint32_t)(offset % FRACTONICA_FILE_PAGE_SIZE);
+  uint32_t slot = 0;
+
+  for (uint32_t i = 0; i < FRACTONICA_FILE_CACHE_PAGES; i++)
+  {
+    if (file->used[i] && file->page[i] == page)
+    {
+      file->used[i] = ++file->clock;
+      return (int64_t)read_le64(file->data[i] + within);
+    }
+    if (file->used[i] < file->used[slot])
+    {
+      slot = i;
+    }
+  }
+
+  /* Miss: refill the least recently used slot with the whole block */
+  FILE *f = (FILE *)file->handle;
+  file->used[slot] = 0;
+  if (!f || fseek(f, (long)page * (long)FRACTONICA_FILE_PAGE_SIZE, SEEK_SET) != 0 ||
+      fread(file->data[slot], 1, FRACTONICA_FILE_PAGE_SIZE, f) < within + 8u)
+  {
+    return (int64_t)FRACTONICA_INVALID;
+  }
+  file->page[slot] = page;
+  file->used[slot] = ++file->clock;
+  return (int64_t)read_le64(file->data[slot] + within);
+}
+
+/* Entry index of a source; the caller has checked the index. */
+static inline int64_t source_read(const fractonica_source_t *source,
+                                  uint32_t index)
+{
+  if (source->timestamps)
+  {
+    return READ_INT64(source->timestamps + index);
+  }
+  return file_read(source->file, index);
+}
+
+static inline bool source_ready(const fractonica_source_t *source)
+{
+  return source && (source->timestamps || source->file);
+}
 
-  return (int64_t)val;
+void fractonica_file_init(fractonica_source_t *source,
+                          fractonica_file_source_t *file)
+{
+  if (source)
+  {
+    source->entry_count = file ? file->header.entry_count : 0;
+    source->timestamps = NULL;
+    source->file = file;
+  }
 }
 
-void fractonica_mem_init(fractonica_mem_source_t *source, uint32_t count,
+void fractonica_mem_init(fractonica_source_t *source, uint32_t count,
                           const int64_t *timestamps)
 {
   if (source)
   {
     source->entry_count = count;
     source->timestamps = timestamps;
+    source->file = NULL;
   }
 }
 
-int64_t fractonica_mem_get_timestamp(const fractonica_mem_source_t *source,
+int64_t fractonica_mem_get_timestamp(const fractonica_source_t *source,
                                       uint32_t index)
 {
-  if (!source || !source->timestamps || index >= source->entry_count)
+  if (!source_ready(source) || index >= source->entry_count)
   {
     return (int64_t)FRACTONICA_INVALID;
   }
-  return READ_INT64(source->timestamps + index);
+  return source_read(source, index);
+}
+
+/* Entries are sorted, so the next few helpers find the first entry later
+ * than a timestamp.  Consecutive entries of one event are roughly a period
+ * apart, so interpolating between the first and last entry lands within a
+ * few entries of the answer; a gallop outwards from that guess brackets it
+ * and a short bisection finishes.  A guess from a cursor works the same. */
+static uint32_t interpolation_guess(const fractonica_source_t *source,
+                                    int64_t timestamp)
+{
+  const uint32_t n = source->entry_count;
+  const int64_t first = source_read(source, 0);
+  const int64_t last = source_read(source, n - 1);
+
+  if (timestamp <= first || last <= first)
+  {
+    return 0;
+  }
+  if (timestamp >= last)
+  {
+    return n - 1;
+  }
+  return (uint32_t)(((double)timestamp - (double)first) /
+                    ((double)last - (double)first) * (double)(n - 1));
+}
+
+/* First entry > timestamp, known to be in [lo, hi]. */
+static uint32_t upper_bound_in(const fractonica_source_t *source,
+                               int64_t timestamp, uint32_t lo, uint32_t hi)
+{
+  while (lo < hi)
+  {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (source_read(source, mid) <= timestamp)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/* Index of the first entry > timestamp (entry_count if none). */
+static uint32_t upper_bound_from(const fractonica_source_t *source,
+                                 int64_t timestamp, uint32_t guess)
+{
+  const uint32_t n = source->entry_count;
+  uint32_t lo;
+  uint32_t hi;
+  uint32_t step = 1;
+
+  if (guess >= n)
+  {
+    guess = n - 1;
+  }
+
+  /* Bracket the answer in [lo, hi] */
+  if (source_read(source, guess) <= timestamp)
+  {
+    lo = guess + 1;
+    hi = lo;
+    while (hi < n && source_read(source, hi) <= timestamp)
+    {
+      lo = hi + 1;
+      hi = (n - hi > step) ? hi + step : n;
+      step <<= 1;
+    }
+  }
+  else
+  {
+    hi = guess;
+    lo = hi;
+    while (lo > 0 && source_read(source, lo - 1) > timestamp)
+    {
+      hi = lo - 1;
+      lo = (hi > step) ? hi - step : 0;
+      step <<= 1;
+    }
+  }
+
+  return upper_bound_in(source, timestamp, lo, hi);
+}
+
+/* Search result around timestamp, given the first entry after it. */
+static fractonica_search_result_t closest_from(const fractonica_source_t *source,
+                                               int64_t timestamp, uint32_t after)
+{
+  fractonica_search_result_t result = {0, 0, false, false};
+
+  if (after > 0)
+  {
+    result.past_index = after - 1;
+    result.found_past = true;
+
+    if (source_read(source, after - 1) == timestamp)
+    {
+      result.future_index = after - 1;
+      result.found_future = true;
+      return result;
+    }
+  }
+  if (after < source->entry_count)
+  {
+    result.future_index = after;
+    result.found_future = true;
+  }
+  return result;
 }
 
 fractonica_search_result_t
-fractonica_find_closest(const fractonica_mem_source_t *source,
+fractonica_find_closest(const fractonica_source_t *source,
                         int64_t timestamp)
 {
   fractonica_search_result_t result = {0, 0, false, false};
 
-  if (!source || !source->timestamps || source->entry_count == 0)
+  if (!source_ready(source) || source->entry_count == 0)
   {
     return result;
   }
 
-  uint32_t left = 0;
   uint32_t right = source->entry_count - 1;
 
-  int64_t first = READ_INT64(source->timestamps);
-  int64_t last = READ_INT64(source->timestamps + right);
+  int64_t first = source_read(source, 0);
+  int64_t last = source_read(source, right);
 
   if (timestamp < first)
   {
@@ -146,47 +418,55 @@ fractonica_find_closest(const fractonica_mem_source_t *source,
     return result;
   }
 
-  while (left <= right)
+  return closest_from(source, timestamp,
+                      upper_bound_from(source, timestamp,
+                                       interpolation_guess(source, timestamp)));
+}
+
+bool fractonica_cursor_seek(const fractonica_source_t *source,
+                            fractonica_cursor_t *cursor,
+                            int64_t timestamp)
+{
+  if (!cursor)
   {
-    uint32_t mid = left + (right - left) / 2;
-    int64_t val = READ_INT64(source->timestamps + mid);
+    return false;
+  }
+  if (cursor->valid && timestamp >= cursor->start && timestamp < cursor->end)
+  {
+    return true;
+  }
 
-    if (val < timestamp)
-    {
-      left = mid + 1;
-    }
-    else if (val > timestamp)
-    {
-      if (mid == 0)
-      {
-        right = 0;
-        break;
-      }
-      right = mid - 1;
-    }
-    else
-    {
-      result.past_index = mid;
-      result.future_index = mid;
-      result.found_past = true;
-      result.found_future = true;
-      return result;
-    }
+  cursor->valid = false;
+  if (!source_ready(source) || source->entry_count < 2)
+  {
+    return false;
   }
 
-  if (left < source->entry_count)
+  /* Usually the neighbouring window, a read or two away; after a jump,
+   * start over from the interpolated guess. */
+  const int64_t span = cursor->end - cursor->start;
+  uint32_t guess;
+  if (span > 0 && cursor->index < source->entry_count - 1 &&
+      timestamp >= cursor->start - span && timestamp < cursor->end + span)
   {
-    result.future_index = left;
-    result.found_future = true;
+    guess = (timestamp >= cursor->end) ? cursor->index + 1 : cursor->index;
+  }
+  else
+  {
+    guess = interpolation_guess(source, timestamp);
   }
 
-  if (left > 0)
+  uint32_t after = upper_bound_from(source, timestamp, guess);
+  if (after == 0 || after == source->entry_count)
   {
-    result.past_index = left - 1;
-    result.found_past = true;
+    return false;
   }
 
-  return result;
+  cursor->index = after - 1;
+  cursor->start = source_read(source, after - 1);
+  cursor->end = source_read(source, after);
+  cursor->valid = true;
+  return true;
 }
 
 uint32_t convert_decimal_to_octal(uint32_t decimalNumber)
@@ -204,8 +484,60 @@ uint32_t convert_decimal_to_octal(uint32_t decimalNumber)
   return (uint32_t)octalNumber;
 }
 
+/* Bin of dt seconds into a window of period seconds (0 <= dt <= period),
+ * with its normalized position and progress toward the next bin. */
+static uint32_t window_bin(double dt, double period, uint32_t resolution,
+                           double *out_normalized, double *out_progress)
+{
+  double normalized = dt / period;
+  if (normalized < 0.0)
+    normalized = 0.0;
+  if (normalized > 1.0)
+    normalized = 1.0;
+  *out_normalized = normalized;
+
+  double pos = normalized * (double)resolution;
+
+  // Ceil bin mapping (1..resolution) then to 0-based (0..resolution-1)
+  uint32_t ceiled = (uint32_t)ceil(pos);
+  if (ceiled == 0)
+    ceiled = 1;
+  if (ceiled > resolution)
+    ceiled = resolution;
+
+  // progress toward next bin boundary (fractional part within the current bin step)
+  double nextBoundary = (double)ceiled;
+  double prevBoundary = nextBoundary - 1.0;
+  double frac;
+  if (pos <= prevBoundary)
+    frac = 0.0;
+  else if (pos >= nextBoundary)
+    frac = 1.0;
+  else
+    frac = (pos - prevBoundary); // 0..1
+  *out_progress = frac;
+
+  return ceiled - 1;
+}
+
+/* Position of unix_ts in the window [t0, t1] (t0 < t1) as bin/progress. */
+static void fill_fraction(fractonica_ephemeris_fraction_t *out,
+                          int64_t t0, int64_t t1, int64_t unix_ts,
+                          uint32_t resolution)
+{
+  if (unix_ts < t0)
+    unix_ts = t0;
+  if (unix_ts > t1)
+    unix_ts = t1;
+
+  out->bin = window_bin((double)(unix_ts - t0), (double)(t1 - t0), resolution,
+                        &out->normalized, &out->progress);
+  out->bin_octal = convert_decimal_to_octal(out->bin);
+  out->valid = true;
+}
+
 fractonica_ephemeris_fraction_t
-fractonica_ephemeris_fraction_at(const fractonica_mem_source_t *source,
+fractonica_ephemeris_fraction_at(const fractonica_source_t *source,
                                   int64_t unix_ts,
                                   uint32_t resolution,
                                   int64_t *io_window_start,
@@ -215,7 +547,7 @@ fractonica_ephemeris_fraction_at(const fractonica_mem_source_t *source,
   memset(&out, 0, sizeof(out));
   out.valid = false;
 
-  if (!source || !source->timestamps || source->entry_count < 2 || resolution == 0)
+  if (!source_ready(source) || source->entry_count < 2 || resolution == 0)
   {
     return out;
   }
@@ -251,44 +583,399 @@ fractonica_ephemeris_fraction_at(const fractonica_mem_source_t *source,
     }
   }
 
-  // Now compute within a window [t0, t1]
-  if (unix_ts < t0)
-    unix_ts = t0;
-  if (unix_ts > t1)
-    unix_ts = t1;
+  fill_fraction(&out, t0, t1, unix_ts, resolution);
+  return out;
+}
 
-  const double period = (double)(t1 - t0);
-  const double dt = (double)(unix_ts - t0);
-  double normalized = dt / period;
-  if (normalized < 0.0)
-    normalized = 0.0;
-  if (normalized > 1.0)
-    normalized = 1.0;
-  out.normalized = normalized;
+fractonica_ephemeris_fraction_t
+fractonica_ephemeris_fraction_at_cursor(const fractonica_source_t *source,
+                                        int64_t unix_ts,
+                                        uint32_t resolution,
+                                        fractonica_cursor_t *cursor)
+{
+  fractonica_ephemeris_fraction_t out;
+  memset(&out, 0, sizeof(out));
+  out.valid = false;
 
-  double pos = normalized * (double)resolution;
+  if (resolution == 0 || !fractonica_cursor_seek(source, cursor, unix_ts))
+  {
+    return out;
+  }
 
-  // Ceil bin mapping (1..resolution) then to 0-based (0..resolution-1)
-  uint32_t ceiled = (uint32_t)ceil(pos);
-  if (ceiled == 0)
-    ceiled = 1;
-  if (ceiled > resolution)
-    ceiled = resolution;
-  out.bin = (ceiled - 1);
+  out.past_index = cursor->index;
+  out.future_index = cursor->index + 1;
+  fill_fraction(&out, cursor->start, cursor->end, unix_ts, resolution);
+  return out;
+}
 
-  // progress toward next bin boundary (fractional part within the current bin step)
-  double nextBoundary = (double)ceiled;
-  double prevBoundary = nextBoundary - 1.0;
-  double frac;
-  if (pos <= prevBoundary)
-    frac = 0.0;
-  else if (pos >= nextBoundary)
-    frac = 1.0;
-  else
-    frac = (pos - prevBoundary); // 0..1
-  out.progress = frac;
+size_t
+fractonica_ephemeris_fractions_sorted(const fractonica_source_t *source,
+                                      const int64_t *timestamps,
+                                      size_t count,
+                                      uint32_t resolution,
+                                      uint32_t *bins,
+                                      double *normalized,
+                                      double *progress,
+                                      bool *valid)
+{
+  size_t valid_count = 0;
+  uint32_t after = 0;     /* first entry > the last timestamp */
+  int64_t t0 = 0;
+  int64_t t1 = 0;
+  double period = 0.0;
+  bool window_ok = false; /* entries after - 1 and after bracket it */
+
+  for (size_t i = 0; i < count; i++)
+  {
+    if (bins)
+      bins[i] = 0;
+    if (normalized)
+      normalized[i] = 0.0;
+    if (progress)
+      progress[i] = 0.0;
+    if (valid)
+      valid[i] = false;
+  }
+  if (!source_ready(source) || source->entry_count < 2 || resolution == 0 || count == 0)
+  {
+    return 0;
+  }
 
-  out.bin_octal = convert_decimal_to_octal(out.bin);
-  out.valid = true;
-  return out;
+  after = interpolation_guess(source, timestamps[0]);
+  for (size_t i = 0; i < count; i++)
+  {
+    const int64_t ts = timestamps[i];
+
+    /* Merge step: stay in the current window while the timestamps do,
+     * otherwise gallop forward from it (backward if the input is not
+     * sorted, which only costs time). */
+    if (!window_ok || ts < t0 || ts >= t1)
+    {
+      after = upper_bound_from(source, ts, after);
+      window_ok = after > 0 && after < source->entry_count;
+      if (!window_ok)
+        continue;
+      t0 = source_read(source, after - 1);
+      t1 = source_read(source, after);
+      period = (double)(t1 - t0);
+      if (t0 == (int64_t)FRACTONICA_INVALID || t1 == (int64_t)FRACTONICA_INVALID || t1 <= t0)
+      {
+        window_ok = false;
+        continue;
+      }
+    }
+
+    /* An exact entry has no window, as in fractonica_ephemeris_fraction_at() */
+    if (ts == t0)
+      continue;
+
+    double n;
+    double p;
+    const uint32_t bin = window_bin((double)(ts - t0), period, resolution, &n, &p);
+    if (bins)
+      bins[i] = bin;
+    if (normalized)
+      normalized[i] = n;
+    if (progress)
+      progress[i] = p;
+    if (valid)
+      valid[i] = true;
+    valid_count++;
+  }
+  return valid_count;
+}
+
+/* ── Multi-series container ─────────────────────────────────────────────── */
+
+bool fractonica_multi_open_memory(fractonica_multi_t *multi,
+                                  const uint8_t *data, size_t size)
+{
+  if (!multi)
+  {
+    return false;
+  }
+  memset(multi, 0, sizeof(*multi));
+  if (!data || size < FRACTONICA_MULTI_HEADER_SIZE)
+  {
+    return false;
+  }
+
+  fractonica_header_t header;
+  parse_header(data, &header);
+  const uint32_t series_count = read_le32(data + 16);
+  const uint32_t index_count = read_le32(data + 20);
+  const int64_t index_start = (int64_t)read_le64(data + 24);
+  const int64_t index_step = (int64_t)read_le64(data + 32);
+
+  if (header.magic != FRACTONICA_MAGIC || header.reserved != FRACTONICA_VERSION_MULTI ||
+      series_count == 0 || series_count > FRACTONICA_MAX_SERIES ||
+      index_count == 0 || index_step <= 0)
+  {
+    return false;
+  }
+  /* Every row time index_start + k * index_step must be an int64 */
+  const uint64_t last_row = index_count - 1u;
+  if (last_row && ((uint64_t)index_step > (uint64_t)INT64_MAX / last_row ||
+                   index_start > INT64_MAX - (int64_t)(last_row * (uint64_t)index_step)))
+  {
+    return false;
+  }
+
+  const uint64_t index_offset = FRACTONICA_MULTI_HEADER_SIZE + (uint64_t)series_count * 24u;
+  const uint64_t index_size = (uint64_t)index_count * series_count * 4u;
+  const uint64_t times_offset = (index_offset + index_size + 7u) & ~(uint64_t)7u;
+  if (times_offset + (uint64_t)header.entry_count * 8u > size ||
+      ((uintptr_t)(data + times_offset) & 7u) != 0)
+  {
+    return false;
+  }
+  const int64_t *timestamps = (const int64_t *)(const void *)(data + times_offset);
+
+  for (uint32_t i = 0; i < series_count; i++)
+  {
+    const uint8_t *entry = data + FRACTONICA_MULTI_HEADER_SIZE + i * 24u;
+    const uint32_t first = read_le32(entry + FRACTONICA_SERIES_NAME_SIZE);
+    const uint32_t count = read_le32(entry + FRACTONICA_SERIES_NAME_SIZE + 4);
+    if ((uint64_t)first + count > header.entry_count)
+    {
+      return false;
+    }
+    memcpy(multi->names[i], entry, FRACTONICA_SERIES_NAME_SIZE);
+    fractonica_mem_init(&multi->series[i], count, timestamps + first);
+
+    /* Rows must count up, stay inside the series and bracket their time,
+     * or fractonica_multi_find_all() would search the wrong entries */
+    const int64_t *series_times = timestamps + first;
+    uint32_t previous = 0;
+    for (uint32_t k = 0; k < index_count; k++)
+    {
+      const uint32_t row = read_le32(data + index_offset + ((uint64_t)k * series_count + i) * 4u);
+      const int64_t row_time = index_start + (int64_t)(k * (uint64_t)index_step);
+      if (row < previous || row > count ||
+          (row > 0 && series_times[row - 1] >= row_time) ||
+          (row < count && series_times[row] < row_time))
+      {
+        return false;
+      }
+      previous = row;
+    }
+  }
+
+  multi->series_count = series_count;
+  multi->index_count = index_count;
+  multi->index_start = index_start;
+  multi->index_step = index_step;
+  multi->index = data + index_offset;
+  return true;
+}
+
+bool fractonica_multi_open(fractonica_multi_t *multi, const char *filepath)
+{
+  if (!multi || !filepath)
+  {
+    return false;
+  }
+  memset(multi, 0, sizeof(*multi));
+
+  FILE *f = fopen(filepath, "rb");
+  if (!f)
+  {
+    return false;
+  }
+  long size = (fseek(f, 0, SEEK_END) == 0) ? ftell(f) : -1L;
+  uint8_t *buffer = (size > 0 && fseek(f, 0, SEEK_SET) == 0) ? (uint8_t *)malloc((size_t)size) : NULL;
+  bool ok = buffer && fread(buffer, 1, (size_t)size, f) == (size_t)size;
+  fclose(f);
+
+  if (!ok || !fractonica_multi_open_memory(multi, buffer, (size_t)size))
+  {
+    free(buffer);
+    return false;
+  }
+  multi->buffer = buffer;
+  return true;
+}
+
+void fractonica_multi_close(fractonica_multi_t *multi)
+{
+  if (multi)
+  {
+    free(multi->buffer);
+    memset(multi, 0, sizeof(*multi));
+  }
+}
+
+const fractonica_source_t *fractonica_multi_series(const fractonica_multi_t *multi,
+                                                   const char *name)
+{
+  if (!multi || !name)
+  {
+    return NULL;
+  }
+  for (uint32_t i = 0; i < multi->series_count; i++)
+  {
+    if (strcmp(multi->names[i], name) == 0)
+    {
+      return &multi->series[i];
+    }
+  }
+  return NULL;
+}
+
+void fractonica_multi_find_all(const fractonica_multi_t *multi,
+                               int64_t timestamp,
+                               fractonica_search_result_t *out)
+{
+  if (!multi || !out || multi->series_count == 0)
+  {
+    return;
+  }
+
+  /* Row k counts the entries before its time, so the first entry after
+   * timestamp lies between rows k and k + 1 of the step holding it. */
+  const uint32_t sc = multi->series_count;
+  const uint8_t *row = NULL;
+  bool last_row = false;
+  if (timestamp >= multi->index_start)
+  {
+    const uint64_t k = ((uint64_t)timestamp - (uint64_t)multi->index_start) /
+                       (uint64_t)multi->index_step;
+    last_row = k >= multi->index_count - 1u;
+    row = multi->index + (size_t)(last_row ? multi->index_count - 1u : k) * sc * 4u;
+  }
+
+  for (uint32_t i = 0; i < sc; i++)
+  {
+    const fractonica_source_t *source = &multi->series[i];
+    uint32_t lo = 0;
+    uint32_t hi = source->entry_count;
+
+    if (!row)
+    {
+      hi = read_le32(multi->index + i * 4u);
+    }
+    else
+    {
+      lo = read_le32(row + i * 4u);
+      if (!last_row)
+      {
+        hi = read_le32(row + (sc + i) * 4u);
+      }
+    }
+    out[i] = closest_from(source, timestamp, upper_bound_in(source, timestamp, lo, hi));
+  }
+}
+
+static bool put_le32(FILE *f, uint32_t v)
+{
+  const uint8_t buf[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+  return fwrite(buf, 1, 4, f) == 4;
+}
+
+static bool put_le64(FILE *f, uint64_t v)
+{
+  return put_le32(f, (uint32_t)v) && put_le32(f, (uint32_t)(v >> 32));
+}
+
+bool fractonica_multi_write(const char *filepath,
+                            const char *const *names,
+                            const fractonica_source_t *series,
+                            uint32_t series_count,
+                            int64_t index_step)
+{
+  if (!filepath || !names || !series || series_count == 0 ||
+      series_count > FRACTONICA_MAX_SERIES || index_step <= 0)
+  {
+    return false;
+  }
+
+  /* Index rows from the earliest to the latest entry of any series */
+  uint64_t total = 0;
+  int64_t start = INT64_MAX;
+  int64_t end = INT64_MIN;
+  for (uint32_t i = 0; i < series_count; i++)
+  {
+    const fractonica_source_t *source = &series[i];
+    if (!names[i] || (source->entry_count && !source_ready(source)))
+    {
+      return false;
+    }
+    total += source->entry_count;
+    if (source->entry_count)
+    {
+      const int64_t first = source_read(source, 0);
+      const int64_t last = source_read(source, source->entry_count - 1);
+      start = first < start ? first : start;
+      end = last > end ? last : end;
+    }
+  }
+  if (total > UINT32_MAX)
+  {
+    return false;
+  }
+  if (start > end)
+  {
+    start = end = 0;
+  }
+  const uint64_t rows = ((uint64_t)end - (uint64_t)start) / (uint64_t)index_step + 1u;
+  if (rows > UINT32_MAX / series_count)
+  {
+    return false;
+  }
+  const uint32_t index_count = (uint32_t)rows;
+
+  FILE *f = fopen(filepath, "wb");
+  if (!f)
+  {
+    return false;
+  }
+
+  bool ok = put_le32(f, FRACTONICA_MAGIC) && put_le32(f, (uint32_t)total) &&
+            put_le64(f, FRACTONICA_VERSION_MULTI) &&
+            put_le32(f, series_count) && put_le32(f, index_count) &&
+            put_le64(f, (uint64_t)start) && put_le64(f, (uint64_t)index_step);
+
+  uint32_t first = 0;
+  for (uint32_t i = 0; ok && i < series_count; i++)
+  {
+    char name[FRACTONICA_SERIES_NAME_SIZE] = {0};
+    const size_t length = strlen(names[i]);
+    memcpy(name, names[i], length < sizeof(name) ? length : sizeof(name));
+    ok = fwrite(name, 1, sizeof(name), f) == sizeof(name) &&
+         put_le32(f, first) && put_le32(f, series[i].entry_count);
+    first += series[i].entry_count;
+  }
+
+  uint32_t next[FRACTONICA_MAX_SERIES] = {0};
+  for (uint32_t k = 0; ok && k < index_count; k++)
+  {
+    const int64_t row_time = start + (int64_t)k * index_step;
+    for (uint32_t i = 0; ok && i < series_count; i++)
+    {
+      while (next[i] < series[i].entry_count && source_read(&series[i], next[i]) < row_time)
+      {
+        next[i]++;
+      }
+      ok = put_le32(f, next[i]);
+    }
+  }
+
+  if (ok && ((uint64_t)index_count * series_count) % 2u)
+  {
+    ok = put_le32(f, 0);
+  }
+
+  for (uint32_t i = 0; ok && i < series_count; i++)
+  {
+    for (uint32_t j = 0; ok && j < series[i].entry_count; j++)
+    {
+      ok = put_le64(f, (uint64_t)source_read(&series[i], j));
+    }
+  }
+
+  if (fclose(f) != 0)
+  {
+    ok = false;
+  }
+  return ok;
 }
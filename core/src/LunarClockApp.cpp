@@ -47,9 +47,9 @@ namespace Fractonica
         {
             time = 0;
             const int64_t now = getUnixClock()->now();
-            const fractonica_ephemeris_fraction_t newMoonFr = fractonica_ephemeris_fraction_at(&newMoon, now, resolution, nullptr, nullptr);
-            const fractonica_ephemeris_fraction_t apogeeFr = fractonica_ephemeris_fraction_at(&apogee, now, resolution, nullptr, nullptr);
-            const fractonica_ephemeris_fraction_t nodal_ascendingFr = fractonica_ephemeris_fraction_at(&nodalAscending, now, resolution, nullptr, nullptr);
+            const fractonica_ephemeris_fraction_t newMoonFr = fractonica_ephemeris_fraction_at_cursor(&newMoon, now, resolution, &newMoonCursor);
+            const fractonica_ephemeris_fraction_t apogeeFr = fractonica_ephemeris_fraction_at_cursor(&apogee, now, resolution, &apogeeCursor);
+            const fractonica_ephemeris_fraction_t nodal_ascendingFr = fractonica_ephemeris_fraction_at_cursor(&nodalAscending, now, resolution, &nodalAscendingCursor);
 
             clock.draw(newMoonFr.bin, prevNewMoon, 0, posX, posY);
             clock.draw(apogeeFr.bin, prevApogee, 1, posX - offsetX, posY - offsetY);
@@ -145,10 +145,10 @@ namespace Fractonica {
 
         const uint32_t color = matrix->getColorHSV((apogee.bin + 2048) % 4096 * 16, 255, 255);
 
-        drawGlyph((newMoon.bin >> 9) % 8, 0, color, static_cast<QuadOp>((node.bin >> 0) % 8), matrix);
-        drawGlyph((newMoon.bin >> 6) % 8, 1, color, static_cast<QuadOp>((node.bin >> 3) % 8), matrix);
-        drawGlyph((newMoon.bin >> 3) % 8, 2, color, static_cast<QuadOp>((node.bin >> 6) % 8), matrix);
-        drawGlyph((newMoon.bin >> 0) % 8, 3, color, static_cast<QuadOp>((node.bin >> 9) % 8), matrix);
+        drawGlyph(newMoon.digits[3], 0, color, static_cast<QuadOp>(node.digits[0]), matrix);
+        drawGlyph(newMoon.digits[2], 1, color, static_cast<QuadOp>(node.digits[1]), matrix);
+        drawGlyph(newMoon.digits[1], 2, color, static_cast<QuadOp>(node.digits[2]), matrix);
+        drawGlyph(newMoon.digits[0], 3, color, static_cast<QuadOp>(node.digits[3]), matrix);
 
         matrix->flush();
     }
@@ -175,9 +175,9 @@ namespace Fractonica {
 
         const uint32_t color = apogee.bin * 8;
 
-        drawGlyph((newMoon.bin >> 9) % 8, 0, color, static_cast<QuadOp>((node.bin >> 0) % 8), x, y, size, display);
-        drawGlyph((newMoon.bin >> 6) % 8, 1, color, static_cast<QuadOp>((node.bin >> 3) % 8), x, y, size,display);
-        drawGlyph((newMoon.bin >> 3) % 8, 2, color, static_cast<QuadOp>((node.bin >> 6) % 8), x, y, size,display);
-        drawGlyph((newMoon.bin >> 0) % 8, 3, color, static_cast<QuadOp>((node.bin >> 9) % 8), x, y, size,display);
+        drawGlyph(newMoon.digits[3], 0, color, static_cast<QuadOp>(node.digits[0]), x, y, size, display);
+        drawGlyph(newMoon.digits[2], 1, color, static_cast<QuadOp>(node.digits[1]), x, y, size,display);
+        drawGlyph(newMoon.digits[1], 2, color, static_cast<QuadOp>(node.digits[2]), x, y, size,display);
+        drawGlyph(newMoon.digits[0], 3, color, static_cast<QuadOp>(node.digits[3]), x, y, size,display);
     }
 }
@@ -9,26 +9,41 @@
 #include "nodal_ascending.h"
 
 namespace Fractonica {
-    LunarTime::LunarTime(const uint8_t digits, const uint8_t base) : digits(digits), base(base) {
-
+    fractonica_mem_source_t LunarEventSource(const LunarEvent event) {
+        fractonica_mem_source_t source{};
+        switch (event) {
+            case NEW_MOON:
+                fractonica_mem_init(&source, FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps);
+                break;
+            case APOGEE:
+                fractonica_mem_init(&source, FRACTONICA_APOGEE_COUNT, fractonica_apogee_timestamps);
+                break;
+            case NODAL_ASCENDING:
+                fractonica_mem_init(&source, FRACTONICA_NODAL_ASCENDING_COUNT, fractonica_nodal_ascending_timestamps);
+                break;
+        }
+        return source;
+    }
 
-        fractonica_mem_init(&newMoon, FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps);
-        fractonica_mem_init(&apogee, FRACTONICA_APOGEE_COUNT, fractonica_apogee_timestamps);
-        fractonica_mem_init(&nodalAscending, FRACTONICA_NODAL_ASCENDING_COUNT, fractonica_nodal_ascending_timestamps);
-        resolution = static_cast<uint32_t>(pow(base, digits));
+    LunarTime::LunarTime(const uint8_t digits, const uint8_t base) : digits(digits), base(base) {
+        newMoon = LunarEventSource(NEW_MOON);
+        apogee = LunarEventSource(APOGEE);
+        nodalAscending = LunarEventSource(NODAL_ASCENDING);
+        resolution = 1;
+        for (uint8_t i = 0; i < digits; i++) resolution *= base;
     }
 
     LunarEventInfo LunarTime::getEventInfo(const uint32_t timestamp, const LunarEvent type) const {
         fractonica_ephemeris_fraction_t fraction;
         switch (type) {
             case NEW_MOON:
-                fraction = fractonica_ephemeris_fraction_at(&newMoon, timestamp, resolution, nullptr, nullptr);
+                fraction = fractonica_ephemeris_fraction_at_cursor(&newMoon, timestamp, resolution, &newMoonCursor);
                 break;
             case APOGEE:
-                fraction = fractonica_ephemeris_fraction_at(&apogee, timestamp, resolution, nullptr, nullptr);
+                fraction = fractonica_ephemeris_fraction_at_cursor(&apogee, timestamp, resolution, &apogeeCursor);
                 break;
             case NODAL_ASCENDING:
-                fraction = fractonica_ephemeris_fraction_at(&nodalAscending, timestamp, resolution, nullptr, nullptr);
+                fraction = fractonica_ephemeris_fraction_at_cursor(&nodalAscending, timestamp, resolution, &nodalAscendingCursor);
                 break;
             default:
                 return { .bin =0, .binOctal = 0, .progress = 0, .event = type, .normalized =0  };
@@ -4,12 +4,21 @@
  * Compile with solar_impl.c and test_saros_lib.c (or your own main).
  * Optionally define SAROS_USE_ALL to use the full Saros 1-180 dataset.
  * Optionally define ECLIPSE_USE_PROGMEM on AVR/ESP32.
+ * Optionally define SAROS_USE_EYTZINGER for the hosted search index.
+ * Optionally define SAROS_USE_COMPACT for the packed data headers.
  */
 
 #define SAROS_IMPL_LUNAR
 /* #define SAROS_USE_ALL */
+/* #define SAROS_USE_EYTZINGER */
+/* #define SAROS_USE_COMPACT */
 
+#ifdef SAROS_USE_COMPACT
+#include "../../include/saros/lunar/eclipse_times_modern_compact.h"
+#include "../../include/saros/lunar/eclipse_info_modern_compact.h"
+#else
 #include "../../include/saros/lunar/eclipse_times_modern.h"
 #include "../../include/saros/lunar/eclipse_info_modern.h"
+#endif
 #include "./../include/saros/lunar/saros_modern.h"
 #include "../../include/saros.h"
@@ -0,0 +1,358 @@
+/*
+ * saros_file.c — catalog file container: validation, mapping and writer.
+ * See saros_file.h for the layout.
+ */
+
+#if !defined(ARDUINO)
+
+#include "../../include/saros_file.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+static const uint8_t _sf_magic[8] = { 'S', 'A', 'R', 'O', 'S', 'D', 'B', 0 };
+
+/* ── Little-endian fields ───────────────────────────────────────────────── */
+
+static uint16_t _sf_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t _sf_get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void _sf_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void _sf_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/* ── CRC-32 (IEEE, reflected), one nibble per step ──────────────────────── */
+
+static const uint32_t _sf_crc_nibble[16] = {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+/* Running register: start from 0xFFFFFFFF, invert at the end. */
+static uint32_t _sf_crc32_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+    while (n--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ _sf_crc_nibble[crc & 0x0Fu];
+        crc = (crc >> 4) ^ _sf_crc_nibble[crc & 0x0Fu];
+    }
+    return crc;
+}
+
+static uint32_t _sf_crc32(const uint8_t *p, size_t n)
+{
+    return _sf_crc32_update(0xFFFFFFFFu, p, n) ^ 0xFFFFFFFFu;
+}
+
+/* ── Header ─────────────────────────────────────────────────────────────── */
+
+static uint32_t _sf_series_bytes(uint8_t first, uint8_t last)
+{
+    return (uint32_t)(last - first + 1u) * SAROS_RECORD_SIZE;
+}
+
+/* 1 if [offset, offset + len) lies inside the file, after the header. */
+static int _sf_in_bounds(uint32_t offset, uint64_t len, size_t size)
+{
+    return offset >= SAROS_FILE_HEADER_SIZE && (uint64_t)offset + len <= (uint64_t)size;
+}
+
+/* 1 if the tables are what the searches assume of them: times ascending,
+ * and every series at most SAROS_MAX_ECLIPSES members whose global
+ * indices lie inside the tables and run in time order.  saros_db.h clamps
+ * its reads, so a file failing this is only answered wrongly; and a
+ * crafted file can carry valid CRCs, so the CRCs do not catch it. */
+static int _sf_check_tables(const saros_db_t *db)
+{
+    uint32_t i;
+    unsigned s;
+
+    for (i = 1; i < db->count; i++) {
+        if (_saros_read_i64(db->times, i) < _saros_read_i64(db->times, i - 1u))
+            return 0;
+    }
+    for (s = db->saros_first; s <= db->saros_last; s++) {
+        const uint8_t *rec = db->saros + (s - db->saros_first) * SAROS_RECORD_SIZE;
+        const uint8_t  n   = rec[0];
+        uint16_t       prev = 0;
+
+        if (n > SAROS_MAX_ECLIPSES)
+            return 0;
+        for (i = 0; i < n; i++) {
+            const uint16_t idx = _sf_get16(rec + 2u + i * 2u);
+            if (idx >= db->count || (i > 0u && idx <= prev))
+                return 0;
+            prev = idx;
+        }
+    }
+    return 1;
+}
+
+static saros_file_status_t _sf_parse(const uint8_t *h, size_t size, saros_db_t *db)
+{
+    uint16_t version;
+    uint32_t count, times_off, info_off, series_off;
+    uint8_t  kind, first, last;
+
+    if (size < SAROS_FILE_HEADER_SIZE || memcmp(h, _sf_magic, sizeof(_sf_magic)) != 0)
+        return SAROS_FILE_ERR_FORMAT;
+    if (_sf_crc32(h, SAROS_FILE_HEADER_SIZE - 4u) != _sf_get32(h + 60))
+        return SAROS_FILE_ERR_FORMAT;
+
+    version = _sf_get16(h + 8);
+    if (version > SAROS_FILE_VERSION)
+        return SAROS_FILE_ERR_VERSION;
+
+    kind       = h[10];
+    first      = h[12];
+    last       = h[13];
+    count      = _sf_get32(h + 16);
+    times_off  = _sf_get32(h + 24);
+    info_off   = _sf_get32(h + 28);
+    series_off = _sf_get32(h + 32);
+
+    if (version == 0u || kind > 1u || first > last
+        || _sf_get16(h + 14) != SAROS_RECORD_SIZE
+        || count == 0u || count > 0xFFFFu            /* global_index is 16-bit */
+        || _sf_get32(h + 20) != size
+        || (times_off & 7u) != 0u
+        || !_sf_in_bounds(times_off,  (uint64_t)count * 8u, size)
+        || !_sf_in_bounds(info_off,   (uint64_t)count * ECLIPSE_INFO_SIZE, size)
+        || !_sf_in_bounds(series_off, _sf_series_bytes(first, last), size))
+        return SAROS_FILE_ERR_FORMAT;
+
+    db->times       = h + times_off;
+    db->info        = h + info_off;
+    db->saros       = h + series_off;
+    db->count       = count;
+    db->saros_first = first;
+    db->saros_last  = last;
+    db->is_lunar    = kind;
+    return SAROS_FILE_OK;
+}
+
+/* ── Public API ─────────────────────────────────────────────────────────── */
+
+saros_file_status_t saros_file_open_memory(saros_file_t *f, const void *data, size_t size)
+{
+    saros_file_status_t st;
+
+    memset(f, 0, sizeof(*f));
+    if (((uintptr_t)data & 7u) != 0u)
+        return SAROS_FILE_ERR_FORMAT;
+    st = _sf_parse((const uint8_t *)data, size, &f->db);
+    if (st != SAROS_FILE_OK) {
+        memset(&f->db, 0, sizeof(f->db));
+        return st;
+    }
+    f->data = (const uint8_t *)data;
+    f->size = size;
+    return SAROS_FILE_OK;
+}
+
+saros_file_status_t saros_file_open(saros_file_t *f, const char *path)
+{
+    saros_file_status_t st;
+    const uint8_t      *data;
+    size_t              size;
+    void               *handle;
+
+    memset(f, 0, sizeof(*f));
+
+#if defined(_WIN32)
+    {
+        LARGE_INTEGER len;
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return SAROS_FILE_ERR_IO;
+        if (!GetFileSizeEx(file, &len) || (unsigned long long)len.QuadPart > (size_t)-1) {
+            CloseHandle(file);
+            return SAROS_FILE_ERR_IO;
+        }
+        if (len.QuadPart < SAROS_FILE_HEADER_SIZE) {
+            CloseHandle(file);
+            return SAROS_FILE_ERR_FORMAT;
+        }
+        handle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (handle == NULL)
+            return SAROS_FILE_ERR_IO;
+        data = (const uint8_t *)MapViewOfFile((HANDLE)handle, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL) {
+            CloseHandle((HANDLE)handle);
+            return SAROS_FILE_ERR_IO;
+        }
+        size = (size_t)len.QuadPart;
+    }
+#else
+    {
+        struct stat st_buf;
+        void *map;
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return SAROS_FILE_ERR_IO;
+        if (fstat(fd, &st_buf) != 0) {
+            close(fd);
+            return SAROS_FILE_ERR_IO;
+        }
+        if (st_buf.st_size < (off_t)SAROS_FILE_HEADER_SIZE) {
+            close(fd);
+            return SAROS_FILE_ERR_FORMAT;
+        }
+        size = (size_t)st_buf.st_size;
+        map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED)
+            return SAROS_FILE_ERR_IO;
+        data   = (const uint8_t *)map;
+        handle = map;
+    }
+#endif
+
+    st = _sf_parse(data, size, &f->db);
+    f->data   = data;
+    f->size   = size;
+    f->handle = handle;
+    if (st != SAROS_FILE_OK)
+        saros_file_close(f);
+    return st;
+}
+
+saros_file_status_t saros_file_verify(const saros_file_t *f)
+{
+    const uint8_t *h = f->data;
+    const saros_db_t *db = &f->db;
+
+    if (h == NULL || !_sf_check_tables(db))
+        return SAROS_FILE_ERR_FORMAT;
+    if (_sf_crc32(db->times, (size_t)db->count * 8u) != _sf_get32(h + 36)
+        || _sf_crc32(db->info, (size_t)db->count * ECLIPSE_INFO_SIZE) != _sf_get32(h + 40)
+        || _sf_crc32(db->saros, _sf_series_bytes(db->saros_first, db->saros_last))
+           != _sf_get32(h + 44))
+        return SAROS_FILE_ERR_CHECKSUM;
+    return SAROS_FILE_OK;
+}
+
+void saros_file_close(saros_file_t *f)
+{
+    if (f->handle != NULL) {
+#if defined(_WIN32)
+        UnmapViewOfFile(f->data);
+        CloseHandle((HANDLE)f->handle);
+#else
+        munmap(f->handle, f->size);
+#endif
+    }
+    memset(f, 0, sizeof(*f));
+}
+
+/* The tables are read through ECLIPSE_READ_*, so a db in PROGMEM or RAM
+ * is copied out the same way. */
+static int _sf_write_section(FILE *fp, const uint8_t *p, size_t n, uint32_t *crc)
+{
+    uint8_t buf[512];
+    size_t  done = 0;
+
+    uint32_t r = 0xFFFFFFFFu;
+
+    while (done < n) {
+        size_t chunk = n - done < sizeof(buf) ? n - done : sizeof(buf);
+        for (size_t i = 0; i < chunk; i++)
+            buf[i] = ECLIPSE_READ_BYTE(p + done + i);
+        r = _sf_crc32_update(r, buf, chunk);
+        if (fwrite(buf, 1, chunk, fp) != chunk)
+            return 0;
+        done += chunk;
+    }
+    *crc = r ^ 0xFFFFFFFFu;
+    return 1;
+}
+
+saros_file_status_t saros_file_write(const char *path, const saros_db_t *db)
+{
+    uint8_t  h[SAROS_FILE_HEADER_SIZE];
+    uint32_t times_off, info_off, series_off, size;
+    uint32_t times_crc, info_crc, series_crc;
+    FILE    *fp;
+    int      ok;
+
+    if (db->count == 0u || db->count > 0xFFFFu || db->saros_first > db->saros_last)
+        return SAROS_FILE_ERR_FORMAT;
+
+    times_off  = SAROS_FILE_HEADER_SIZE;
+    info_off   = times_off + db->count * 8u;
+    series_off = info_off + db->count * ECLIPSE_INFO_SIZE;
+    size       = series_off + _sf_series_bytes(db->saros_first, db->saros_last);
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+        return SAROS_FILE_ERR_IO;
+
+    /* header goes in last, once the section CRCs are known */
+    memset(h, 0, sizeof(h));
+    ok = fwrite(h, 1, sizeof(h), fp) == sizeof(h)
+         && _sf_write_section(fp, db->times, (size_t)db->count * 8u, &times_crc)
+         && _sf_write_section(fp, db->info, (size_t)db->count * ECLIPSE_INFO_SIZE, &info_crc)
+         && _sf_write_section(fp, db->saros, _sf_series_bytes(db->saros_first, db->saros_last),
+                              &series_crc);
+
+    if (ok) {
+        memcpy(h, _sf_magic, sizeof(_sf_magic));
+        _sf_put16(h + 8, SAROS_FILE_VERSION);
+        h[10] = db->is_lunar ? 1u : 0u;
+        h[12] = db->saros_first;
+        h[13] = db->saros_last;
+        _sf_put16(h + 14, SAROS_RECORD_SIZE);
+        _sf_put32(h + 16, db->count);
+        _sf_put32(h + 20, size);
+        _sf_put32(h + 24, times_off);
+        _sf_put32(h + 28, info_off);
+        _sf_put32(h + 32, series_off);
+        _sf_put32(h + 36, times_crc);
+        _sf_put32(h + 40, info_crc);
+        _sf_put32(h + 44, series_crc);
+        _sf_put32(h + 60, _sf_crc32(h, SAROS_FILE_HEADER_SIZE - 4u));
+        ok = fseek(fp, 0, SEEK_SET) == 0 && fwrite(h, 1, sizeof(h), fp) == sizeof(h);
+    }
+    if (fclose(fp) != 0)
+        ok = 0;
+    if (!ok) {
+        remove(path);
+        return SAROS_FILE_ERR_IO;
+    }
+    return SAROS_FILE_OK;
+}
+
+#endif /* !ARDUINO */
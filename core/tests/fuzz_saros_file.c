@@ -0,0 +1,124 @@
+/*
+ * fuzz_saros_file.c — libFuzzer entry point for catalog files
+ *
+ * Input: a catalog file image.  The harness patches the file-size field
+ * and the header CRC so that mutations get past the header checks;
+ * anything saros_file_open_memory() accepts is then run through
+ * saros_file_verify() and, whatever that says, searched with every
+ * saros_db.h entry point, whose clamped series reads must stay inside the
+ * image.  Reads outside it are left to the sanitizers.
+ *
+ *   cmake -S core -B build -DCMAKE_C_COMPILER=clang -DCMAKE_CXX_COMPILER=clang++ \
+ *         -DSAROS_BUILD_FUZZER=ON
+ *   build/fuzz_saros_file -max_total_time=600 corpus/
+ *
+ * A good seed corpus is a few files from saros_file_write() or
+ * build_saros_file.py.  Without SAROS_LIBFUZZER it builds as a replay
+ * driver that runs the entry point over files named on the command line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "saros_db.h"
+#include "saros_file.h"
+
+#define FUZZ_MAX_FILE (1u << 20)
+
+static uint32_t crc32_ieee(const uint8_t *p, size_t n)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    while (n--) {
+        int k;
+        crc ^= *p++;
+        for (k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/* Every search over the catalog; results are folded so none is dropped. */
+static uint64_t exercise(const saros_db_t *db)
+{
+    const saros_db_t *const both[2] = { db, db };
+    const int64_t     first = _saros_read_i64(db->times, 0);
+    const int64_t     last  = _saros_read_i64(db->times, db->count - 1u);
+    const int64_t     probe[4] = { first - 1, first, (first >> 1) + (last >> 1), last + 1 };
+    int64_t           times[SAROS_MAX_ECLIPSES];
+    saros_range_t     it;
+    eclipse_entry_t   e;
+    uint64_t          acc = 0;
+    uint8_t           which, count;
+    unsigned          s, p;
+
+    for (p = 0; p < 4; p++) {
+        acc += (uint64_t)saros_db_find_next(db, probe[p]).saros_next.unix_time;
+        acc += (uint64_t)saros_db_find_past(db, probe[p]).saros_prev.unix_time;
+        acc += (uint64_t)saros_db_find_next_any(both, 2, probe[p], &which).eclipse.unix_time;
+        acc += (uint64_t)saros_db_find_past_any(both, 2, probe[p], &which).eclipse.unix_time;
+        for (s = db->saros_first; s <= db->saros_last; s++) {
+            acc += (uint64_t)saros_db_saros_window(db, probe[p], (uint8_t)s).future.unix_time;
+            acc += saros_db_octal_phase(db, probe[p], (uint8_t)s, 2, 1);
+        }
+    }
+    for (s = db->saros_first; s <= db->saros_last; s++) {
+        saros_db_series(db, (uint8_t)s, times, &count);
+        acc += (uint64_t)times[count ? count - 1u : 0u];
+    }
+    saros_db_range(&it, db, first, last, NULL);
+    while (saros_range_next(&it, &e))
+        acc += e.global_index;
+    return acc;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static uint64_t buf[FUZZ_MAX_FILE / 8u];
+    static volatile uint64_t sink;
+    uint8_t    *image = (uint8_t *)buf;
+    saros_file_t f;
+
+    if (size < SAROS_FILE_HEADER_SIZE || size > FUZZ_MAX_FILE)
+        return 0;
+    memcpy(image, data, size);
+    put32(image + 20, (uint32_t)size);
+    put32(image + 60, crc32_ieee(image, SAROS_FILE_HEADER_SIZE - 4u));
+
+    if (saros_file_open_memory(&f, image, size) == SAROS_FILE_OK) {
+        sink += (uint64_t)saros_file_verify(&f);
+        sink += exercise(&f.db);
+        saros_file_close(&f);
+    }
+    return 0;
+}
+
+#ifndef SAROS_LIBFUZZER
+int main(int argc, char **argv)
+{
+    static uint8_t buf[FUZZ_MAX_FILE];
+    int            i;
+
+    for (i = 1; i < argc; i++) {
+        FILE  *f = fopen(argv[i], "rb");
+        size_t n;
+        if (!f) {
+            perror(argv[i]);
+            return 1;
+        }
+        n = fread(buf, 1, sizeof(buf), f);
+        fclose(f);
+        LLVMFuzzerTestOneInput(buf, n);
+        printf("%s: ok\n", argv[i]);
+    }
+    return 0;
+}
+#endif
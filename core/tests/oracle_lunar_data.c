@@ -0,0 +1,19 @@
+/*
+ * oracle_lunar_data.c — raw lunar tables for the oracle (see saros_oracle.h).
+ */
+
+#include "saros/lunar/eclipse_times_modern.h"
+#include "saros/lunar/eclipse_info_modern.h"
+#include "saros/lunar/saros_modern.h"
+#include "saros_oracle.h"
+
+const oracle_catalog_t oracle_lunar = {
+    eclipse_times_modern,
+    eclipse_info_modern,
+    saros_modern,
+    sizeof(saros_modern),
+    ECLIPSE_MODERN_COUNT,
+    ECLIPSE_MODERN_SAROS_FIRST,
+    ECLIPSE_MODERN_SAROS_LAST,
+    1
+};
@@ -0,0 +1,19 @@
+/*
+ * oracle_solar_data.c — raw solar tables for the oracle (see saros_oracle.h).
+ */
+
+#include "saros/solar/eclipse_times_modern.h"
+#include "saros/solar/eclipse_info_modern.h"
+#include "saros/solar/saros_modern.h"
+#include "saros_oracle.h"
+
+const oracle_catalog_t oracle_solar = {
+    eclipse_times_modern,
+    eclipse_info_modern,
+    saros_modern,
+    sizeof(saros_modern),
+    ECLIPSE_MODERN_COUNT,
+    ECLIPSE_MODERN_SAROS_FIRST,
+    ECLIPSE_MODERN_SAROS_LAST,
+    0
+};
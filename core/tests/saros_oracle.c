@@ -0,0 +1,535 @@
+/*
+ * saros_oracle.c — see saros_oracle.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "saros_oracle.h"
+#include "saros_db.h"
+
+#define ORACLE_MAX_MEMBERS 256u
+#define ORACLE_MAX_REPORTS 20u
+
+/* Indices of every eclipse of each series, in catalog order. */
+static uint16_t _members[2][256][ORACLE_MAX_MEMBERS];
+static uint16_t _member_count[2][256];
+
+static unsigned long _checks;
+static unsigned      _reports;
+
+/* ── Raw table access ───────────────────────────────────────────────────── */
+
+static int64_t _time(const oracle_catalog_t *c, uint32_t i)
+{
+    const uint8_t *p = c->times + (size_t)i * 8u;
+    uint64_t       v = 0;
+    int            b;
+    for (b = 7; b >= 0; b--)
+        v = (v << 8) | p[b];
+    return (int64_t)v;
+}
+
+static uint8_t _saros_of(const oracle_catalog_t *c, uint32_t i)
+{
+    return c->info[(size_t)i * ECLIPSE_INFO_SIZE + 6u];
+}
+
+static uint16_t _u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static eclipse_entry_t _entry(const oracle_catalog_t *c, uint32_t i)
+{
+    const uint8_t  *b = c->info + (size_t)i * ECLIPSE_INFO_SIZE;
+    eclipse_entry_t e;
+
+    memset(&e, 0, sizeof(e));
+    e.unix_time    = _time(c, i);
+    e.global_index = (uint16_t)i;
+    e.valid        = 1;
+    if (c->is_lunar) {
+        e.info.lunar.pen_duration   = _u16(b);
+        e.info.lunar.par_duration   = _u16(b + 2);
+        e.info.lunar.total_duration = _u16(b + 4);
+        e.info.lunar.saros_number   = b[6];
+        e.info.lunar.saros_pos      = b[7];
+        e.info.lunar.ecl_type       = b[8];
+    } else {
+        e.info.solar.latitude_deg10   = (int16_t)_u16(b);
+        e.info.solar.longitude_deg10  = (int16_t)_u16(b + 2);
+        e.info.solar.central_duration = _u16(b + 4);
+        e.info.solar.saros_number     = b[6];
+        e.info.solar.saros_pos        = b[7];
+        e.info.solar.ecl_type         = b[8];
+        e.info.solar.sun_alt          = b[9];
+    }
+    return e;
+}
+
+void oracle_init(void)
+{
+    const oracle_catalog_t *cats[2] = { &oracle_solar, &oracle_lunar };
+    int                     k;
+    uint32_t                i;
+
+    memset(_member_count, 0, sizeof(_member_count));
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < cats[k]->count; i++) {
+            const uint8_t s = _saros_of(cats[k], i);
+            if (_member_count[k][s] < ORACLE_MAX_MEMBERS)
+                _members[k][s][_member_count[k][s]] = (uint16_t)i;
+            _member_count[k][s]++;
+        }
+    }
+}
+
+saros_db_t oracle_db(const oracle_catalog_t *c)
+{
+    saros_db_t db;
+
+    db.times       = c->times;
+    db.info        = c->info;
+    db.saros       = c->saros;
+    db.count       = c->count;
+    db.saros_first = c->saros_first;
+    db.saros_last  = c->saros_last;
+    db.is_lunar    = (uint8_t)c->is_lunar;
+    return db;
+}
+
+/* ── Reference lookups ──────────────────────────────────────────────────── */
+
+static eclipse_result_t _result(const oracle_catalog_t *c, uint32_t i)
+{
+    const int        k = c->is_lunar;
+    const uint8_t    s = _saros_of(c, i);
+    eclipse_result_t r;
+    uint16_t         p;
+
+    memset(&r, 0, sizeof(r));
+    r.eclipse = _entry(c, i);
+    for (p = 0; p < _member_count[k][s]; p++) {
+        if (_members[k][s][p] != i)
+            continue;
+        if (p > 0u)
+            r.saros_prev = _entry(c, _members[k][s][p - 1u]);
+        if (p + 1u < _member_count[k][s])
+            r.saros_next = _entry(c, _members[k][s][p + 1u]);
+        break;
+    }
+    return r;
+}
+
+eclipse_result_t oracle_find_next(const oracle_catalog_t *c, int64_t timestamp)
+{
+    eclipse_result_t r;
+    uint32_t         i;
+
+    for (i = 0; i < c->count; i++)
+        if (_time(c, i) >= timestamp)
+            return _result(c, i);
+    memset(&r, 0, sizeof(r));
+    return r;
+}
+
+eclipse_result_t oracle_find_past(const oracle_catalog_t *c, int64_t timestamp)
+{
+    eclipse_result_t r;
+    uint32_t         i;
+
+    for (i = c->count; i-- > 0;)
+        if (_time(c, i) <= timestamp)
+            return _result(c, i);
+    memset(&r, 0, sizeof(r));
+    return r;
+}
+
+saros_window_t oracle_saros_window(const oracle_catalog_t *c, int64_t timestamp, uint8_t saros_number)
+{
+    const int       k = c->is_lunar;
+    const uint16_t *m = _members[k][saros_number];
+    saros_window_t  w;
+    uint16_t        p;
+
+    memset(&w, 0, sizeof(w));
+    w.saros_number = saros_number;
+    for (p = 0; p < _member_count[k][saros_number]; p++) {
+        if (_time(c, m[p]) >= timestamp) {
+            w.future = _entry(c, m[p]);
+            break;
+        }
+    }
+    if (p > 0u)
+        w.past = _entry(c, m[p - 1u]);
+    return w;
+}
+
+/* saros.h resolution → bits of the bin: 12, 24 or 36, cycling mod 3. */
+static unsigned _bits(uint8_t resolution)
+{
+    return 12u * (((unsigned)resolution + 2u) % 3u + 1u);
+}
+
+/* floor(elapsed * 2^bits / total), one bit at a time. */
+static uint64_t _bin(uint64_t elapsed, uint64_t total, unsigned bits)
+{
+    uint64_t q = elapsed / total, r = elapsed % total;
+    unsigned b;
+
+    for (b = 0; b < bits; b++) {
+        r <<= 1;
+        q <<= 1;
+        if (r >= total) {
+            r -= total;
+            q |= 1u;
+        }
+    }
+    return q;
+}
+
+uint64_t oracle_octal_phase(const oracle_catalog_t *c, int64_t timestamp, uint8_t saros_number,
+                            uint8_t resolution, uint16_t scale)
+{
+    const saros_window_t w = oracle_saros_window(c, timestamp / scale, saros_number);
+
+    if (!w.past.valid || !w.future.valid)
+        return 0;
+    return _bin((uint64_t)(timestamp - w.past.unix_time * scale),
+                (uint64_t)(w.future.unix_time - w.past.unix_time) * scale, _bits(resolution));
+}
+
+uint64_t oracle_phase_ns(const oracle_catalog_t *c, int64_t timestamp_ns, uint8_t saros_number,
+                         unsigned bits)
+{
+    const int64_t  ns  = SAROS_NS_PER_SECOND;
+    const int64_t  sec = timestamp_ns / ns - (timestamp_ns % ns < 0 ? 1 : 0);
+    /* The window holding the floored second, eclipse moments included. */
+    saros_window_t w   = oracle_saros_window(c, sec + 1, saros_number);
+
+    if (!w.past.valid || !w.future.valid)
+        return 0;
+    return _bin((uint64_t)(sec - w.past.unix_time) * ns + (uint64_t)(timestamp_ns - sec * ns),
+                (uint64_t)(w.future.unix_time - w.past.unix_time) * ns, bits);
+}
+
+uint64_t oracle_average_bin(int64_t reference, int64_t timestamp, uint16_t scale, uint8_t resolution)
+{
+    const int64_t period = AVERAGE_SAROS_PERIOD_SECONDS;
+    int64_t       end;
+
+    if (timestamp >= reference)
+        return 0;
+    /* First period boundary at or after reference. */
+    end = timestamp + (reference - timestamp + period - 1) / period * period;
+    return _bin((uint64_t)(reference - (end - period)), (uint64_t)period * scale, _bits(resolution));
+}
+
+uint8_t oracle_series(const oracle_catalog_t *c, uint8_t saros_number, int64_t times[SAROS_MAX_ECLIPSES])
+{
+    const int k = c->is_lunar;
+    uint16_t  p;
+
+    memset(times, 0, SAROS_MAX_ECLIPSES * sizeof(int64_t));
+    for (p = 0; p < _member_count[k][saros_number] && p < SAROS_MAX_ECLIPSES; p++)
+        times[p] = _time(c, _members[k][saros_number][p]);
+    return (uint8_t)p;
+}
+
+/* ── Comparison ─────────────────────────────────────────────────────────── */
+
+unsigned long saros_checks_run(void)
+{
+    return _checks;
+}
+
+void saros_checks_add(unsigned long n)
+{
+    _checks += n;
+}
+
+unsigned saros_check_fail(const char *what, int64_t timestamp, uint8_t saros_number)
+{
+    if (_reports++ < ORACLE_MAX_REPORTS)
+        fprintf(stderr, "mismatch: %s at ts=%lld saros=%u\n", what, (long long)timestamp,
+                (unsigned)saros_number);
+    return 1;
+}
+
+int saros_entry_equal(const eclipse_entry_t *a, const eclipse_entry_t *b, int is_lunar)
+{
+    if (a->valid != b->valid)
+        return 0;
+    if (!a->valid)
+        return 1;
+    if (a->unix_time != b->unix_time || a->global_index != b->global_index)
+        return 0;
+    if (is_lunar)
+        return a->info.lunar.pen_duration   == b->info.lunar.pen_duration
+            && a->info.lunar.par_duration   == b->info.lunar.par_duration
+            && a->info.lunar.total_duration == b->info.lunar.total_duration
+            && a->info.lunar.saros_number   == b->info.lunar.saros_number
+            && a->info.lunar.saros_pos      == b->info.lunar.saros_pos
+            && a->info.lunar.ecl_type       == b->info.lunar.ecl_type;
+    return a->info.solar.latitude_deg10   == b->info.solar.latitude_deg10
+        && a->info.solar.longitude_deg10  == b->info.solar.longitude_deg10
+        && a->info.solar.central_duration == b->info.solar.central_duration
+        && a->info.solar.saros_number     == b->info.solar.saros_number
+        && a->info.solar.saros_pos        == b->info.solar.saros_pos
+        && a->info.solar.ecl_type         == b->info.solar.ecl_type
+        && a->info.solar.sun_alt          == b->info.solar.sun_alt;
+}
+
+static unsigned _check_result(const char *what, const eclipse_result_t *got,
+                              const eclipse_result_t *want, int is_lunar,
+                              int64_t timestamp)
+{
+    _checks++;
+    if (saros_entry_equal(&got->eclipse, &want->eclipse, is_lunar)
+        && saros_entry_equal(&got->saros_prev, &want->saros_prev, is_lunar)
+        && saros_entry_equal(&got->saros_next, &want->saros_next, is_lunar))
+        return 0;
+    return saros_check_fail(what, timestamp, 0);
+}
+
+static unsigned _check_window(const char *what, const saros_window_t *got,
+                              const saros_window_t *want, int is_lunar,
+                              int64_t timestamp)
+{
+    _checks++;
+    if (got->saros_number == want->saros_number
+        && saros_entry_equal(&got->past, &want->past, is_lunar)
+        && saros_entry_equal(&got->future, &want->future, is_lunar))
+        return 0;
+    return saros_check_fail(what, timestamp, want->saros_number);
+}
+
+static unsigned _check_u64(const char *what, uint64_t got, uint64_t want,
+                           int64_t timestamp, uint8_t saros_number)
+{
+    _checks++;
+    if (got == want)
+        return 0;
+    return saros_check_fail(what, timestamp, saros_number);
+}
+
+/* ── Library entry points per catalog ───────────────────────────────────── */
+
+typedef struct {
+    const oracle_catalog_t *oracle;
+    const char             *name;
+    eclipse_result_t      (*find_next)(int64_t);
+    eclipse_result_t      (*find_past)(int64_t);
+    saros_window_t        (*window)(int64_t, uint8_t);
+    uint64_t              (*phase)(int64_t, uint8_t, uint8_t);
+    uint64_t              (*phase_ms)(int64_t, uint8_t, uint8_t);
+    saros_phase_t         (*phase_ns)(int64_t, uint8_t);
+    void                  (*phases)(int64_t, const uint8_t *, size_t, uint8_t, uint64_t *);
+    void                  (*phases_ms)(int64_t, const uint8_t *, size_t, uint8_t, uint64_t *);
+#ifndef SAROS_USE_COMPACT
+    const saros_db_t       *db;
+#endif
+} _catalog_api_t;
+
+static const _catalog_api_t _apis[2] = {
+    { &oracle_solar, "solar", find_next_solar_eclipse, find_past_solar_eclipse,
+      find_solar_saros_window, calculate_solar_octal_phase, calculate_solar_octal_phase_ms, calculate_solar_phase_ns,
+      calculate_solar_octal_phases, calculate_solar_octal_phases_ms,
+#ifndef SAROS_USE_COMPACT
+      &saros_solar_db
+#endif
+    },
+    { &oracle_lunar, "lunar", find_next_lunar_eclipse, find_past_lunar_eclipse,
+      find_lunar_saros_window, calculate_lunar_octal_phase, calculate_lunar_octal_phase_ms, calculate_lunar_phase_ns,
+      calculate_lunar_octal_phases, calculate_lunar_octal_phases_ms,
+#ifndef SAROS_USE_COMPACT
+      &saros_lunar_db
+#endif
+    },
+};
+
+/* Phase checks of one series at ts (seconds), around ts * 1000 and
+ * around ts * 10^9. */
+static unsigned _check_series(const _catalog_api_t *a, int64_t ts, uint8_t s, uint8_t res)
+{
+    const oracle_catalog_t *c = a->oracle;
+    const int               k = c->is_lunar;
+    unsigned                bad = 0;
+    saros_window_t          w, ow = oracle_saros_window(c, ts, s);
+    uint64_t                want, got;
+    int64_t                 ms;
+    uint8_t                 digits;
+    int                     d;
+
+    w = a->window(ts, s);
+    bad += _check_window(k ? "find_lunar_saros_window" : "find_solar_saros_window", &w, &ow, k, ts);
+
+    want = oracle_octal_phase(c, ts, s, res, 1);
+    bad += _check_u64(k ? "calculate_lunar_octal_phase" : "calculate_solar_octal_phase",
+                      a->phase(ts, s, res), want, ts, s);
+    a->phases(ts, &s, 1, res, &got);
+    bad += _check_u64(k ? "calculate_lunar_octal_phases" : "calculate_solar_octal_phases",
+                      got, want, ts, s);
+#ifndef SAROS_USE_COMPACT
+    w = saros_db_saros_window(a->db, ts, s);
+    bad += _check_window("saros_db_saros_window", &w, &ow, k, ts);
+    bad += _check_u64("saros_db_octal_phase", saros_db_octal_phase(a->db, ts, s, res, 1), want, ts, s);
+#endif
+
+    if (ts <= INT64_MIN / 1000 + 1 || ts >= INT64_MAX / 1000 - 1)
+        return bad;
+    /* Either side of the second boundary and its last millisecond. */
+    for (d = 0; d < 3; d++) {
+        ms   = ts * 1000 + (d == 0 ? -1 : d == 1 ? 0 : 999);
+        want = oracle_octal_phase(c, ms, s, res, 1000);
+        bad += _check_u64(k ? "calculate_lunar_octal_phase_ms" : "calculate_solar_octal_phase_ms",
+                          a->phase_ms(ms, s, res), want, ms, s);
+        a->phases_ms(ms, &s, 1, res, &got);
+        bad += _check_u64(k ? "calculate_lunar_octal_phases_ms" : "calculate_solar_octal_phases_ms",
+                          got, want, ms, s);
+#ifndef SAROS_USE_COMPACT
+        bad += _check_u64("saros_db_octal_phase (ms)", saros_db_octal_phase(a->db, ms, s, res, 1000),
+                          want, ms, s);
+#endif
+    }
+
+    if (ts <= INT64_MIN / SAROS_NS_PER_SECOND + 1 || ts >= INT64_MAX / SAROS_NS_PER_SECOND - 1)
+        return bad;
+    /* Either side of the second and its last nanosecond. */
+    digits = (uint8_t)(res % SAROS_PHASE_MAX_DIGITS + 1u);
+    for (d = 0; d < 3; d++) {
+        const int64_t ns = ts * SAROS_NS_PER_SECOND + (d == 0 ? -1 : d == 1 ? 0 : 999999999);
+        got = a->phase_ns(ns, s);
+        bad += _check_u64(k ? "calculate_lunar_phase_ns" : "calculate_solar_phase_ns",
+                          got, oracle_phase_ns(c, ns, s, 64u), ns, s);
+        bad += _check_u64("saros_phase_digits", saros_phase_digits(got, digits),
+                          oracle_phase_ns(c, ns, s, 3u * digits), ns, s);
+    }
+    return bad;
+}
+
+static unsigned _check_solar_series(uint8_t s)
+{
+    int64_t  got[SAROS_MAX_ECLIPSES], want[SAROS_MAX_ECLIPSES];
+    uint8_t  count = 0xFF, n = oracle_series(&oracle_solar, s, want);
+    unsigned bad = 0;
+
+    get_solar_saros_series(s, got, &count);
+    bad += _check_u64("get_solar_saros_series count", count, n, 0, s);
+    if (count == n) {
+        _checks++;
+        /* Slots past count are unspecified, except for an unknown series. */
+        const int known = s >= oracle_solar.saros_first && s <= oracle_solar.saros_last;
+        if (memcmp(got, want, (known ? n : SAROS_MAX_ECLIPSES) * sizeof(int64_t)) != 0)
+            bad += saros_check_fail("get_solar_saros_series times", 0, s);
+    }
+#ifndef SAROS_USE_COMPACT
+    saros_db_series(&saros_solar_db, s, got, &count);
+    bad += _check_u64("saros_db_series count", count, n, 0, s);
+    _checks++;
+    if (memcmp(got, want, sizeof(want)) != 0)
+        bad += saros_check_fail("saros_db_series times", 0, s);
+#endif
+    return bad;
+}
+
+unsigned saros_check_point(int64_t ts, uint8_t saros_number, uint8_t resolution)
+{
+    unsigned bad = 0;
+    int      k;
+
+    for (k = 0; k < 2; k++) {
+        const _catalog_api_t   *a = &_apis[k];
+        const eclipse_result_t  next = oracle_find_next(a->oracle, ts);
+        const eclipse_result_t  past = oracle_find_past(a->oracle, ts);
+        eclipse_result_t        r;
+        uint8_t                 alive;
+
+        r = a->find_next(ts);
+        bad += _check_result(k ? "find_next_lunar_eclipse" : "find_next_solar_eclipse", &r, &next, k, ts);
+        r = a->find_past(ts);
+        bad += _check_result(k ? "find_past_lunar_eclipse" : "find_past_solar_eclipse", &r, &past, k, ts);
+#ifndef SAROS_USE_COMPACT
+        r = saros_db_find_next(a->db, ts);
+        bad += _check_result("saros_db_find_next", &r, &next, k, ts);
+        r = saros_db_find_past(a->db, ts);
+        bad += _check_result("saros_db_find_past", &r, &past, k, ts);
+#endif
+
+        bad += _check_series(a, ts, saros_number, resolution);
+        alive = k ? next.eclipse.info.lunar.saros_number : next.eclipse.info.solar.saros_number;
+        if (next.eclipse.valid && alive != saros_number)
+            bad += _check_series(a, ts, alive, resolution);
+    }
+
+    bad += _check_solar_series(saros_number);
+
+    {
+        /* Up to ~170 years back, clear of int64 overflow either way. */
+        const int64_t span = ((int64_t)saros_number + 1) * ((resolution & 7) + 1) * 2592000;
+        if (ts > INT64_MIN + span && ts < INT64_MAX - 2 * (int64_t)AVERAGE_SAROS_PERIOD_SECONDS)
+            bad += _check_u64("get_average_bin",
+                              get_average_bin(ts, ts - span, 1, resolution),
+                              oracle_average_bin(ts, ts - span, 1, resolution), ts, saros_number);
+    }
+    return bad;
+}
+
+unsigned saros_check_tables(void)
+{
+    const oracle_catalog_t *cats[2] = { &oracle_solar, &oracle_lunar };
+    unsigned                bad = 0;
+    int                     k;
+
+    for (k = 0; k < 2; k++) {
+        const oracle_catalog_t *c = cats[k];
+        const uint32_t          n = (uint32_t)(c->saros_last - c->saros_first) + 1u;
+        unsigned                s;
+        uint32_t                i;
+
+        /* The readers step through the table in SAROS_RECORD_SIZE strides. */
+        _checks++;
+        if (c->saros_size != (size_t)n * SAROS_RECORD_SIZE) {
+            fprintf(stderr, "%s series table: %lu bytes for %u series, expected %u-byte records\n",
+                    k ? "lunar" : "solar", (unsigned long)c->saros_size, (unsigned)n,
+                    (unsigned)SAROS_RECORD_SIZE);
+            bad++;
+            continue;
+        }
+
+        for (s = 0; s < 256u; s++) {
+            const int in_range = s >= c->saros_first && s <= c->saros_last;
+            _checks++;
+            if (!in_range) {
+                if (_member_count[k][s] != 0u)
+                    bad += saros_check_fail("eclipse outside the series range", 0, (uint8_t)s);
+                continue;
+            }
+            {
+                const uint8_t *rec   = c->saros + (size_t)(s - c->saros_first) * SAROS_RECORD_SIZE;
+                const uint8_t  count = rec[0];
+                uint8_t        p;
+
+                if (count != _member_count[k][s] || count > SAROS_MAX_ECLIPSES) {
+                    bad += saros_check_fail("series record count", 0, (uint8_t)s);
+                    continue;
+                }
+                for (p = 0; p < count; p++) {
+                    const uint16_t idx = _u16(rec + 2u + 2u * p);
+                    _checks++;
+                    if (idx != _members[k][s][p]
+                        || c->info[(size_t)idx * ECLIPSE_INFO_SIZE + 7u] != p)
+                        bad += saros_check_fail("series record entry", 0, (uint8_t)s);
+                }
+            }
+        }
+
+        for (i = 1; i < c->count; i++) {
+            _checks++;
+            if (_time(c, i - 1u) > _time(c, i))
+                bad += saros_check_fail("eclipse times out of order", _time(c, i), 0);
+        }
+    }
+    return bad;
+}
@@ -0,0 +1,82 @@
+/*
+ * saros_oracle.h — naive reference model of the saros.h lookups
+ *
+ * Every answer is found by a linear scan over the raw generated tables
+ * (eclipse_times_*, eclipse_info_*) without the series records, search
+ * indexes, caches or fixed-point tricks of the library, so it stays a
+ * trustworthy reference for any rewrite of those.  The series records are
+ * only checked against the scan (saros_check_tables()).
+ *
+ * The tables come from the raw headers in oracle_solar_data.c /
+ * oracle_lunar_data.c, whatever format the library under test was built
+ * with.
+ */
+
+#ifndef SAROS_ORACLE_H
+#define SAROS_ORACLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "saros.h"
+
+typedef struct {
+    const uint8_t *times;        /* count little-endian int64 */
+    const uint8_t *info;         /* count ECLIPSE_INFO_SIZE-byte records */
+    const uint8_t *saros;        /* series records */
+    size_t         saros_size;   /* sizeof the series table */
+    uint32_t       count;
+    uint8_t        saros_first;
+    uint8_t        saros_last;
+    int            is_lunar;
+} oracle_catalog_t;
+
+extern const oracle_catalog_t oracle_solar;
+extern const oracle_catalog_t oracle_lunar;
+
+/* Index the series members; call once before anything below. */
+void oracle_init(void);
+
+/* The catalog's tables as a saros_db_t, for saros_db.h (also in compact
+ * builds, which have no saros_solar_db / saros_lunar_db). */
+saros_db_t oracle_db(const oracle_catalog_t *c);
+
+eclipse_result_t oracle_find_next(const oracle_catalog_t *c, int64_t timestamp);
+eclipse_result_t oracle_find_past(const oracle_catalog_t *c, int64_t timestamp);
+saros_window_t   oracle_saros_window(const oracle_catalog_t *c, int64_t timestamp, uint8_t saros_number);
+uint64_t         oracle_octal_phase(const oracle_catalog_t *c, int64_t timestamp, uint8_t saros_number,
+                                    uint8_t resolution, uint16_t scale);
+/* floor(fraction of the [past, future) window at timestamp_ns * 2^bits). */
+uint64_t         oracle_phase_ns(const oracle_catalog_t *c, int64_t timestamp_ns, uint8_t saros_number,
+                                 unsigned bits);
+uint64_t         oracle_average_bin(int64_t reference, int64_t timestamp, uint16_t scale,
+                                    uint8_t resolution);
+uint8_t          oracle_series(const oracle_catalog_t *c, uint8_t saros_number,
+                               int64_t times[SAROS_MAX_ECLIPSES]);
+
+/*
+ * saros_check_point(ts, saros, resolution)
+ *   Compare every single-point find_* / calculate_* function (and the
+ *   saros_db.h equivalents in raw builds) with the oracle at ts in
+ *   seconds, around ts * 1000 in milliseconds and around ts * 10^9 in
+ *   nanoseconds, for the given series
+ *   and for the series of the next eclipse.  Returns the number of
+ *   mismatches; the first few are printed to stderr.
+ *
+ * saros_check_tables()
+ *   Validate the generated series records: the table size against
+ *   SAROS_RECORD_SIZE, and every record against the scan.
+ *
+ * saros_checks_run() / saros_checks_add(n)
+ *   Comparisons made so far / count n made outside this file.
+ */
+unsigned saros_check_point(int64_t timestamp, uint8_t saros_number, uint8_t resolution);
+unsigned saros_check_tables(void);
+unsigned long saros_checks_run(void);
+void          saros_checks_add(unsigned long n);
+
+/* Report a mismatch found outside saros_check_point(). */
+unsigned saros_check_fail(const char *what, int64_t timestamp, uint8_t saros_number);
+
+int saros_entry_equal(const eclipse_entry_t *a, const eclipse_entry_t *b, int is_lunar);
+
+#endif /* SAROS_ORACLE_H */
@@ -0,0 +1,210 @@
+/*
+ * test_analytic_ephemeris.cpp — AnalyticEphemeris.h batch, scalar and libm
+ *
+ *   test_analytic_ephemeris [random-samples]
+ *
+ * SunPositions() / MoonPositions() / Elongations() must equal Sun() /
+ * Moon() / Elongation() bit for bit, at every count up to a few hundred
+ * (odd ones leave a scalar tail after the vector steps) and from
+ * unaligned starts.  Both must stay within 1e-9 AU / 4e-10 Earth radii of
+ * a transcription of the same series on libm sin/cos, across +-550 years
+ * of random day numbers.  At every new_moon.h entry the Moon must be
+ * within 0.08 deg of the Sun in ecliptic longitude (0.074 at worst), so
+ * the elongation is the Moon's latitude to within that.  Exits non-zero
+ * on the first failing group.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "AnalyticEphemeris.h"
+#include "new_moon.h"
+
+#define TEST_RANDOM_SAMPLES 20000u
+#define TEST_MAX_COUNT      300u
+#define TEST_MAX_REPORTS    20u
+#define TEST_NEW_MOON_DEG   0.08
+
+namespace AE = Fractonica::AnalyticEphemeris;
+
+static const double deg = 3.14159265358979323846 / 180.0;
+
+static uint64_t      _rng = 0xD1B54A32D192ED03ull;
+static unsigned long _checks;
+static unsigned      _reports;
+
+static uint64_t next_random(void)
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 7;
+    _rng ^= _rng << 17;
+    return _rng;
+}
+
+/* Day number within +-550 years of 2000, at any fraction of a day. */
+static double random_day(void)
+{
+    return ((double)(next_random() >> 11) / 9007199254740992.0 - 0.5) * 2.0 * 550.0 * 365.25;
+}
+
+static unsigned fail(const char *what, double d, double off)
+{
+    if (_reports++ < TEST_MAX_REPORTS)
+        fprintf(stderr, "mismatch: %s at d=%.6f (%.3g)\n", what, d, off);
+    return 1;
+}
+
+static int same_bits(const AE::Position &a, const AE::Position &b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+/* ── The series on libm ─────────────────────────────────────────────────── */
+
+static AE::Position libm_sun(double d)
+{
+    const double w = (282.9404 + 4.70935e-5 * d) * deg;
+    const double e = 0.016709 - 1.151e-9 * d;
+    const double M = (356.0470 + 0.9856002585 * d) * deg;
+    const double E = M + e * sin(M) * (1.0 + e * cos(M));
+    const double xv = cos(E) - e, yv = sqrt(1.0 - e * e) * sin(E);
+    return { xv * cos(w) - yv * sin(w), xv * sin(w) + yv * cos(w), 0.0 };
+}
+
+static AE::Position libm_moon(double d)
+{
+    const double e = 0.054900, I = 5.1454 * deg;
+    const double N = (125.1228 - 0.0529538083 * d) * deg;
+    const double w = (318.0634 + 0.1643573223 * d) * deg;
+    const double M = (115.3654 + 13.0649929509 * d) * deg;
+    const double Ms = (356.0470 + 0.9856002585 * d) * deg;
+    const double Ls = (282.9404 + 4.70935e-5 * d) * deg + Ms;
+    const double Lm = N + w + M, D = Lm - Ls, F = Lm - N;
+
+    double E = M + e * sin(M) * (1.0 + e * cos(M));
+    for (int i = 0; i < 3; i++)
+        E = E + (M - E + e * sin(E)) / (1.0 - e * cos(E));
+
+    const double lon = -1.274 * sin(M - 2 * D) + 0.658 * sin(2 * D) - 0.186 * sin(Ms) - 0.059 * sin(2 * M - 2 * D)
+                     - 0.057 * sin(M - 2 * D + Ms) + 0.053 * sin(M + 2 * D) + 0.046 * sin(2 * D - Ms)
+                     + 0.041 * sin(M - Ms) - 0.035 * sin(D) - 0.031 * sin(M + Ms) - 0.015 * sin(2 * F - 2 * D)
+                     + 0.011 * sin(M - 4 * D);
+    const double lat = -0.173 * sin(F - 2 * D) - 0.055 * sin(M - F - 2 * D) - 0.046 * sin(M + F - 2 * D)
+                     + 0.033 * sin(F + 2 * D) + 0.017 * sin(2 * M + F);
+    const double a = 60.2666 - 0.58 * cos(M - 2 * D) - 0.46 * cos(2 * D);
+
+    /* Ecliptic longitude, latitude and distance of the unperturbed orbit */
+    const double xv = a * (cos(E) - e), yv = a * sqrt(1.0 - e * e) * sin(E);
+    const double v = atan2(yv, xv), r = sqrt(xv * xv + yv * yv);
+    const double x = r * (cos(N) * cos(v + w) - sin(N) * sin(v + w) * cos(I));
+    const double y = r * (sin(N) * cos(v + w) + cos(N) * sin(v + w) * cos(I));
+    const double z = r * sin(v + w) * sin(I);
+    const double l = atan2(y, x) + lon * deg, b = atan2(z, sqrt(x * x + y * y)) + lat * deg;
+    return { r * cos(l) * cos(b), r * sin(l) * cos(b), r * sin(b) };
+}
+
+static double distance(const AE::Position &a, const AE::Position &b)
+{
+    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+/* ── Groups ─────────────────────────────────────────────────────────────── */
+
+/* Batches of every count up to TEST_MAX_COUNT, from offsets 0 and 1 of the
+ * same day numbers, against the single-epoch calls. */
+static unsigned test_batches(void)
+{
+    static double       d[TEST_MAX_COUNT + 1], elong[TEST_MAX_COUNT];
+    static AE::Position sun[TEST_MAX_COUNT], moon[TEST_MAX_COUNT];
+    unsigned            bad = 0;
+
+    for (unsigned i = 0; i <= TEST_MAX_COUNT; i++)
+        d[i] = random_day();
+    for (unsigned count = 0; count <= TEST_MAX_COUNT; count++) {
+        for (unsigned offset = 0; offset < 2 && offset + count <= TEST_MAX_COUNT; offset++) {
+            const double *at = d + offset;
+            AE::SunPositions(at, count, sun);
+            AE::MoonPositions(at, count, moon);
+            AE::Elongations(at, count, elong);
+            for (unsigned i = 0; i < count; i++) {
+                const double e = AE::Elongation(at[i]);
+                _checks += 3;
+                if (!same_bits(sun[i], AE::Sun(at[i])))
+                    bad |= fail("SunPositions != Sun", at[i], 0.0);
+                if (!same_bits(moon[i], AE::Moon(at[i])))
+                    bad |= fail("MoonPositions != Moon", at[i], 0.0);
+                if (memcmp(&elong[i], &e, sizeof(e)) != 0)
+                    bad |= fail("Elongations != Elongation", at[i], elong[i] - e);
+            }
+        }
+    }
+    return bad;
+}
+
+/* Scalar path against libm at random day numbers (the batches equal it). */
+static unsigned test_libm(unsigned samples)
+{
+    double   worst_sun = 0.0, worst_moon = 0.0;
+    unsigned bad = 0;
+
+    for (unsigned i = 0; i < samples; i++) {
+        const double d = random_day();
+        const double s = distance(AE::Sun(d), libm_sun(d)), m = distance(AE::Moon(d), libm_moon(d));
+        _checks += 2;
+        if (s > 1e-9)
+            bad |= fail("Sun vs libm (AU)", d, s);
+        if (m > 4e-10)
+            bad |= fail("Moon vs libm (Earth radii)", d, m);
+        worst_sun  = s > worst_sun ? s : worst_sun;
+        worst_moon = m > worst_moon ? m : worst_moon;
+    }
+    printf("libm         worst %.2g AU, %.2g Earth radii\n", worst_sun, worst_moon);
+    return bad;
+}
+
+/* Conjunction in longitude at every built-in new moon. */
+static unsigned test_new_moons(void)
+{
+    double   worst = 0.0;
+    unsigned bad   = 0;
+
+    for (uint32_t i = 0; i < FRACTONICA_NEW_MOON_COUNT; i++) {
+        const double       d = AE::DayNumber(fractonica_new_moon_timestamps[i]);
+        const AE::Position s = AE::Sun(d), m = AE::Moon(d);
+        double             dl = atan2(m.y, m.x) - atan2(s.y, s.x);
+        dl = fabs(remainder(dl, 2.0 * 3.14159265358979323846)) / deg;
+        const double beta = fabs(atan2(m.z, sqrt(m.x * m.x + m.y * m.y))) / deg;
+        const double elongation = AE::Elongation(d) / deg;
+        _checks += 2;
+        if (dl > TEST_NEW_MOON_DEG)
+            bad |= fail("new moon longitude (deg)", d, dl);
+        if (fabs(elongation - beta) > TEST_NEW_MOON_DEG)
+            bad |= fail("new moon elongation - |latitude| (deg)", d, elongation - beta);
+        worst = dl > worst ? dl : worst;
+    }
+    printf("new moons    worst %.3f deg in longitude\n", worst);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned samples = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : TEST_RANDOM_SAMPLES;
+    unsigned       bad;
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               _checks);                                                           \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("batches", test_batches());
+    RUN("libm", test_libm(samples));
+    RUN("new moons", test_new_moons());
+#undef RUN
+    return 0;
+}
@@ -0,0 +1,596 @@
+/*
+ * test_ephemeris.c — Ephemeris.h sources against each other
+ *
+ *   test_ephemeris [random-samples]
+ *
+ * Writes the built-in tables (new moon, apogee, ascending node) and a long
+ * irregular series as ephemeris files, opens each one buffered and mapped,
+ * and checks that every search (find_closest, fraction_at with and without
+ * a window, cursors, fractions_sorted) returns exactly what the memory
+ * source does: at every entry ±1 s, at random timestamps across and beyond
+ * the series, and at the int64 extremes.  Files whose entry_count runs past
+ * their end, or with a bad header, must not open.
+ *
+ * The same series, plus an empty one, also go through version 2
+ * containers (fractonica_multi_write() at several index steps, read back
+ * from a file and from memory): every series must come back intact,
+ * fractonica_multi_find_all() must equal fractonica_find_closest() on each
+ * original, and truncated or corrupted containers must not open.  Exits
+ * non-zero on the first failing group.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Ephemeris.h"
+#include "apogee.h"
+#include "new_moon.h"
+#include "nodal_ascending.h"
+
+#define TEST_RANDOM_SAMPLES 20000u
+#define TEST_LONG_COUNT     20000u   /* many cache pages, so blocks are evicted */
+#define TEST_RESOLUTION     4096u
+#define TEST_FILE_PATH      "test_ephemeris.frac"
+#define TEST_MULTI_PATH     "test_ephemeris_multi.frac"
+#define TEST_MAX_REPORTS    20u
+
+static uint64_t      _rng = 0x9E3779B97F4A7C15ull;
+static unsigned long _checks;
+static unsigned      _reports;
+
+static uint64_t next_random(void)
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 7;
+    _rng ^= _rng << 17;
+    return _rng;
+}
+
+static unsigned fail(const char *what, const char *series, const char *view, int64_t timestamp)
+{
+    if (_reports++ < TEST_MAX_REPORTS)
+        fprintf(stderr, "mismatch: %s (%s, %s) at ts=%lld\n", what, series, view, (long long)timestamp);
+    return 1;
+}
+
+/* ── Sources ────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    const char    *name;
+    uint32_t       count;
+    const int64_t *timestamps;
+} test_series_t;
+
+static int64_t long_series[TEST_LONG_COUNT];
+
+static const test_series_t series[] = {
+    { "new_moon", FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps },
+    { "apogee", FRACTONICA_APOGEE_COUNT, fractonica_apogee_timestamps },
+    { "nodal_ascending", FRACTONICA_NODAL_ASCENDING_COUNT, fractonica_nodal_ascending_timestamps },
+    { "long", TEST_LONG_COUNT, long_series },
+};
+
+#define SERIES_COUNT (sizeof(series) / sizeof(series[0]))
+
+/* Ephemeris file of count entries of timestamps, declaring declared
+ * entries (little-endian host, like the reader); 0 on I/O errors. */
+static int write_file(const char *path, const int64_t *timestamps, uint32_t count, uint32_t declared,
+                      uint64_t reserved)
+{
+    fractonica_header_t h;
+    FILE               *f = fopen(path, "wb");
+    int                 ok;
+
+    if (!f)
+        return 0;
+    h.magic       = FRACTONICA_MAGIC;
+    h.entry_count = declared;
+    h.reserved    = reserved;
+    ok = fwrite(&h, FRACTONICA_HEADER_SIZE, 1, f) == 1
+      && fwrite(timestamps, 8, count, f) == count;
+    return fclose(f) == 0 && ok;
+}
+
+/* The three views of one series. */
+typedef struct {
+    fractonica_source_t src[3];   /* memory, buffered file, mapped file */
+} test_views_t;
+
+static const char *const view_names[3] = { "memory", "buffered", "mmap" };
+
+static fractonica_file_source_t files[2];
+
+static int open_views(test_views_t *v, const test_series_t *s)
+{
+    unsigned m;
+
+    fractonica_mem_init(&v->src[0], s->count, s->timestamps);
+    if (!write_file(TEST_FILE_PATH, s->timestamps, s->count, s->count, 0))
+        return 0;
+    for (m = 0; m < 2; m++) {
+        if (!fractonica_file_source_open(&files[m], TEST_FILE_PATH,
+                                         m ? FRACTONICA_FILE_MMAP : FRACTONICA_FILE_BUFFERED))
+            return 0;
+        fractonica_file_init(&v->src[1 + m], &files[m]);
+    }
+    return 1;
+}
+
+static void close_views(void)
+{
+    fractonica_file_source_close(&files[0]);
+    fractonica_file_source_close(&files[1]);
+    remove(TEST_FILE_PATH);
+}
+
+/* ── Comparisons ────────────────────────────────────────────────────────── */
+
+static int search_equal(const fractonica_search_result_t *a, const fractonica_search_result_t *b)
+{
+    return a->found_past == b->found_past && a->found_future == b->found_future
+        && (!a->found_past || a->past_index == b->past_index)
+        && (!a->found_future || a->future_index == b->future_index);
+}
+
+static int fraction_equal(const fractonica_ephemeris_fraction_t *a, const fractonica_ephemeris_fraction_t *b)
+{
+    return a->valid == b->valid && a->bin == b->bin && a->bin_octal == b->bin_octal
+        && a->normalized == b->normalized && a->progress == b->progress
+        && a->past_index == b->past_index && a->future_index == b->future_index;
+}
+
+/* Stateless searches at ts on every view against the memory source. */
+static unsigned check_point(const test_views_t *v, const char *name, int64_t ts)
+{
+    const fractonica_search_result_t     want = fractonica_find_closest(&v->src[0], ts);
+    const fractonica_ephemeris_fraction_t wf  = fractonica_ephemeris_fraction_at(&v->src[0], ts, TEST_RESOLUTION, NULL, NULL);
+    unsigned                             bad = 0, m;
+
+    for (m = 1; m < 3; m++) {
+        const fractonica_search_result_t      got = fractonica_find_closest(&v->src[m], ts);
+        const fractonica_ephemeris_fraction_t gf  = fractonica_ephemeris_fraction_at(&v->src[m], ts, TEST_RESOLUTION, NULL, NULL);
+        _checks += 2;
+        if (!search_equal(&got, &want))
+            bad += fail("fractonica_find_closest", name, view_names[m], ts);
+        if (!fraction_equal(&gf, &wf))
+            bad += fail("fractonica_ephemeris_fraction_at", name, view_names[m], ts);
+    }
+    return bad;
+}
+
+/* Stateful searches over timestamps in the given order: a window cache
+ * and a cursor per view, and fractions_sorted when they are sorted. */
+static unsigned check_sweep(const test_views_t *v, const char *name, const int64_t *ts, size_t n, int sorted)
+{
+    static uint32_t bins[3][TEST_RANDOM_SAMPLES];
+    static double   norm[3][TEST_RANDOM_SAMPLES], prog[3][TEST_RANDOM_SAMPLES];
+    static bool     valid[3][TEST_RANDOM_SAMPLES];
+    int64_t             w0[3] = { 0, 0, 0 }, w1[3] = { 0, 0, 0 };
+    fractonica_cursor_t cur[3];
+    unsigned            bad = 0, m;
+    size_t              i;
+
+    memset(cur, 0, sizeof(cur));
+    for (i = 0; i < n; i++) {
+        fractonica_ephemeris_fraction_t wf = fractonica_ephemeris_fraction_at(&v->src[0], ts[i], TEST_RESOLUTION, &w0[0], &w1[0]);
+        fractonica_ephemeris_fraction_t wc = fractonica_ephemeris_fraction_at_cursor(&v->src[0], ts[i], TEST_RESOLUTION, &cur[0]);
+        for (m = 1; m < 3; m++) {
+            const fractonica_ephemeris_fraction_t gf = fractonica_ephemeris_fraction_at(&v->src[m], ts[i], TEST_RESOLUTION, &w0[m], &w1[m]);
+            const fractonica_ephemeris_fraction_t gc = fractonica_ephemeris_fraction_at_cursor(&v->src[m], ts[i], TEST_RESOLUTION, &cur[m]);
+            _checks += 2;
+            if (!fraction_equal(&gf, &wf) || w0[m] != w0[0] || w1[m] != w1[0])
+                bad += fail("fractonica_ephemeris_fraction_at (window)", name, view_names[m], ts[i]);
+            if (!fraction_equal(&gc, &wc) || cur[m].valid != cur[0].valid
+                || (cur[0].valid && (cur[m].index != cur[0].index || cur[m].start != cur[0].start)))
+                bad += fail("fractonica_ephemeris_fraction_at_cursor", name, view_names[m], ts[i]);
+        }
+        if (bad)
+            return bad;
+    }
+
+    if (!sorted || n > TEST_RANDOM_SAMPLES)
+        return bad;
+    for (m = 0; m < 3; m++)
+        fractonica_ephemeris_fractions_sorted(&v->src[m], ts, n, TEST_RESOLUTION, bins[m], norm[m], prog[m], valid[m]);
+    for (m = 1; m < 3; m++) {
+        _checks++;
+        if (memcmp(bins[m], bins[0], n * sizeof(bins[0][0])) != 0 || memcmp(norm[m], norm[0], n * sizeof(norm[0][0])) != 0
+            || memcmp(prog[m], prog[0], n * sizeof(prog[0][0])) != 0 || memcmp(valid[m], valid[0], n * sizeof(valid[0][0])) != 0)
+            bad += fail("fractonica_ephemeris_fractions_sorted", name, view_names[m], ts[0]);
+    }
+    return bad;
+}
+
+static int compare_i64(const void *a, const void *b)
+{
+    const int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* ── Groups ─────────────────────────────────────────────────────────────── */
+
+/* Every view of every series at each entry ±1 and at the extremes. */
+static unsigned test_entries(void)
+{
+    static const int64_t extremes[] = { INT64_MIN, INT64_MIN + 1, -1, 0, 1, INT64_MAX - 1, INT64_MAX };
+    unsigned             bad = 0, k, i;
+    int                  d;
+
+    for (k = 0; k < SERIES_COUNT && !bad; k++) {
+        test_views_t v;
+        if (!open_views(&v, &series[k]))
+            return fail("open ephemeris file", series[k].name, "", 0);
+        for (i = 0; i < sizeof(extremes) / sizeof(extremes[0]); i++)
+            bad += check_point(&v, series[k].name, extremes[i]);
+        for (i = 0; i < series[k].count; i++)
+            for (d = -1; d <= 1; d++)
+                bad += check_point(&v, series[k].name, series[k].timestamps[i] + d);
+        close_views();
+    }
+    return bad;
+}
+
+/* Random timestamps across and beyond each series, in random and in
+ * sorted order. */
+static unsigned test_random(unsigned samples)
+{
+    static int64_t ts[TEST_RANDOM_SAMPLES];
+    unsigned       bad = 0, k, i;
+
+    if (samples > TEST_RANDOM_SAMPLES)
+        samples = TEST_RANDOM_SAMPLES;
+    for (k = 0; k < SERIES_COUNT && !bad; k++) {
+        const test_series_t *s     = &series[k];
+        const int64_t        first = s->timestamps[0], last = s->timestamps[s->count - 1u];
+        const int64_t        lo    = first - (last - first) / 8;
+        const uint64_t       span  = (uint64_t)(last - first) / 4u * 5u;
+        test_views_t         v;
+
+        if (!open_views(&v, s))
+            return fail("open ephemeris file", s->name, "", 0);
+        for (i = 0; i < samples; i++) {
+            ts[i] = lo + (int64_t)(next_random() % span);
+            bad += check_point(&v, s->name, ts[i]);
+        }
+        bad += check_sweep(&v, s->name, ts, samples, 0);
+        qsort(ts, samples, sizeof(ts[0]), compare_i64);
+        bad += check_sweep(&v, s->name, ts, samples, 1);
+        close_views();
+    }
+    return bad;
+}
+
+/* Files that must not open in either mode: entry_count beyond the end of
+ * the file (by one entry, by all of them), shorter than a header, a bad
+ * magic and a version 2 container.  Extra bytes after the entries are
+ * fine, and the file then answers like memory. */
+static unsigned test_truncated(void)
+{
+    const test_series_t *s = &series[0];
+    test_views_t         v;
+    unsigned             bad = 0, c, m;
+
+    for (c = 0; c < 6; c++) {
+        const uint32_t stored   = c == 0 ? s->count - 1u : c == 1 ? 0u : s->count;
+        const uint64_t reserved = c == 4 ? FRACTONICA_VERSION_MULTI : 0u;
+        const int      expect   = c == 5;
+        FILE          *f;
+        int            ok = write_file(TEST_FILE_PATH, s->timestamps, stored, s->count, reserved);
+
+        /* Patch the header: 2 cuts it to 8 bytes, 3 breaks the magic;
+         * 5 appends bytes that are not a whole entry */
+        if (ok && (c == 2 || c == 3 || c == 5)) {
+            uint8_t bytes[FRACTONICA_HEADER_SIZE];
+            ok = (f = fopen(TEST_FILE_PATH, "rb")) != NULL && fread(bytes, 1, sizeof(bytes), f) == sizeof(bytes);
+            if (f)
+                fclose(f);
+            bytes[0] ^= (uint8_t)(c == 3);
+            if (ok && c == 5)
+                ok = (f = fopen(TEST_FILE_PATH, "ab")) != NULL && fwrite("junk", 1, 5, f) == 5 && fclose(f) == 0;
+            else if (ok)
+                ok = (f = fopen(TEST_FILE_PATH, c == 2 ? "wb" : "r+b")) != NULL
+                  && fwrite(bytes, 1, c == 2 ? 8u : sizeof(bytes), f) == (c == 2 ? 8u : sizeof(bytes))
+                  && fclose(f) == 0;
+        }
+        if (!ok)
+            return fail("write ephemeris file", s->name, "", c);
+
+        for (m = 0; m < 2; m++) {
+            const bool opened = fractonica_file_source_open(&files[m], TEST_FILE_PATH,
+                                                            m ? FRACTONICA_FILE_MMAP : FRACTONICA_FILE_BUFFERED);
+            _checks++;
+            if (opened != expect)
+                bad += fail(expect ? "ephemeris file with trailing bytes rejected" : "malformed ephemeris file opened",
+                            s->name, view_names[1 + m], c);
+            if (opened && !expect)
+                fractonica_file_source_close(&files[m]);
+        }
+    }
+
+    /* The last file has trailing bytes and is open in both modes */
+    if (bad)
+        return bad;
+    fractonica_mem_init(&v.src[0], s->count, s->timestamps);
+    fractonica_file_init(&v.src[1], &files[0]);
+    fractonica_file_init(&v.src[2], &files[1]);
+    bad += check_point(&v, s->name, s->timestamps[s->count - 1u] - 1);
+    bad += check_point(&v, s->name, s->timestamps[s->count - 1u]);
+    bad += check_point(&v, s->name, s->timestamps[s->count - 1u] + 1);
+    close_views();
+    return bad;
+}
+
+/* ── Version 2 containers ───────────────────────────────────────────── */
+
+static const char *const multi_names[] = { "new_moon", "apogee", "nodal_ascending", "long", "empty" };
+
+#define MULTI_COUNT (sizeof(multi_names) / sizeof(multi_names[0]))
+
+/* The whole file at path in a malloc'd (so 8-byte aligned) buffer; NULL
+ * on failure. */
+static uint8_t *read_whole(const char *path, size_t *size)
+{
+    FILE    *f = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long     n;
+
+    if (!f)
+        return NULL;
+    if (fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0
+        && (data = (uint8_t *)malloc((size_t)n)) != NULL) {
+        if (fread(data, 1, (size_t)n, f) == (size_t)n) {
+            *size = (size_t)n;
+        } else {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(f);
+    return data;
+}
+
+/* multi_names as sources: the test series, the long one read from a
+ * buffered file when from_file, and an empty series. */
+static void multi_sources(fractonica_source_t *out, int from_file)
+{
+    unsigned k;
+
+    for (k = 0; k < SERIES_COUNT; k++)
+        fractonica_mem_init(&out[k], series[k].count, series[k].timestamps);
+    if (from_file)
+        fractonica_file_init(&out[SERIES_COUNT - 1u], &files[0]);
+    fractonica_mem_init(&out[SERIES_COUNT], 0, NULL);
+}
+
+/* Every series of multi against the originals: name, entries, and
+ * find_all == find_closest at ts. */
+static unsigned check_multi_at(const fractonica_multi_t *multi, const fractonica_source_t *orig, int64_t ts)
+{
+    fractonica_search_result_t got[FRACTONICA_MAX_SERIES];
+    unsigned                   bad = 0, i;
+
+    fractonica_multi_find_all(multi, ts, got);
+    for (i = 0; i < MULTI_COUNT; i++) {
+        const fractonica_search_result_t want = fractonica_find_closest(&orig[i], ts);
+        _checks++;
+        if (!search_equal(&got[i], &want))
+            bad += fail("fractonica_multi_find_all", multi_names[i], "multi", ts);
+    }
+    return bad;
+}
+
+static unsigned check_multi(const fractonica_multi_t *multi, const fractonica_source_t *orig, unsigned samples)
+{
+    static const int64_t extremes[] = { INT64_MIN, INT64_MIN + 1, -1, 0, 1, INT64_MAX - 1, INT64_MAX };
+    const int64_t        lo   = long_series[0] - 3155760000LL;
+    const uint64_t       span = (uint64_t)(long_series[TEST_LONG_COUNT - 1u] - lo) + 3155760000u;
+    unsigned             bad = 0, i, k;
+    int                  d;
+
+    _checks++;
+    if (multi->series_count != MULTI_COUNT)
+        return fail("series count", "", "multi", multi->series_count);
+    for (i = 0; i < MULTI_COUNT; i++) {
+        const fractonica_source_t *s = fractonica_multi_series(multi, multi_names[i]);
+        _checks++;
+        if (s != &multi->series[i] || s->entry_count != orig[i].entry_count
+            || (s->entry_count && memcmp(s->timestamps, orig[i].timestamps, s->entry_count * 8u) != 0))
+            bad += fail("fractonica_multi_series", multi_names[i], "multi", 0);
+    }
+    _checks++;
+    if (fractonica_multi_series(multi, "perigee") != NULL)
+        bad += fail("fractonica_multi_series of a missing name", "perigee", "multi", 0);
+    if (bad)
+        return bad;
+
+    for (i = 0; i < sizeof(extremes) / sizeof(extremes[0]); i++)
+        bad += check_multi_at(multi, orig, extremes[i]);
+    for (k = 0; k < SERIES_COUNT && !bad; k++)
+        for (i = 0; i < series[k].count && !bad; i += k == SERIES_COUNT - 1u ? 7u : 1u)
+            for (d = -1; d <= 1; d++)
+                bad += check_multi_at(multi, orig, series[k].timestamps[i] + d);
+    for (i = 0; i < samples && !bad; i++)
+        bad += check_multi_at(multi, orig, lo + (int64_t)(next_random() % span));
+    return bad;
+}
+
+/* Write, open from the file and from memory, compare; for several index
+ * steps, from a day to more than the whole span. */
+static unsigned test_multi(unsigned samples)
+{
+    static const int64_t steps[] = { 86400, 31557600, 100 * 31557600LL, INT64_MAX / 2 };
+    fractonica_source_t  orig[MULTI_COUNT], src[MULTI_COUNT];
+    fractonica_multi_t   multi;
+    unsigned             bad = 0, k;
+
+    multi_sources(orig, 0);
+    if (!write_file(TEST_FILE_PATH, long_series, TEST_LONG_COUNT, TEST_LONG_COUNT, 0)
+        || !fractonica_file_source_open(&files[0], TEST_FILE_PATH, FRACTONICA_FILE_BUFFERED))
+        return fail("open ephemeris file", "long", "buffered", 0);
+
+    for (k = 0; k < sizeof(steps) / sizeof(steps[0]) && !bad; k++) {
+        uint8_t *image;
+        size_t   size;
+
+        multi_sources(src, (int)(k & 1u));
+        if (!fractonica_multi_write(TEST_MULTI_PATH, multi_names, src, MULTI_COUNT, steps[k]))
+            bad += fail("fractonica_multi_write", "", "", steps[k]);
+        else if (!fractonica_multi_open(&multi, TEST_MULTI_PATH))
+            bad += fail("fractonica_multi_open", "", "", steps[k]);
+        else {
+            bad += check_multi(&multi, orig, samples);
+            fractonica_multi_close(&multi);
+        }
+        if (bad)
+            break;
+
+        image = read_whole(TEST_MULTI_PATH, &size);
+        if (!image || !fractonica_multi_open_memory(&multi, image, size))
+            bad += fail("fractonica_multi_open_memory", "", "", steps[k]);
+        else
+            bad += check_multi(&multi, orig, samples / 4u);
+        free(image);
+    }
+
+    /* Bad arguments */
+    multi_sources(src, 0);
+    _checks += 3;
+    if (fractonica_multi_write(TEST_MULTI_PATH, multi_names, src, 0, 86400)
+        || fractonica_multi_write(TEST_MULTI_PATH, multi_names, src, FRACTONICA_MAX_SERIES + 1u, 86400)
+        || fractonica_multi_write(TEST_MULTI_PATH, multi_names, src, MULTI_COUNT, 0))
+        bad += fail("fractonica_multi_write with bad arguments", "", "", 0);
+
+    fractonica_file_source_close(&files[0]);
+    remove(TEST_FILE_PATH);
+    remove(TEST_MULTI_PATH);
+    return bad;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put64(uint8_t *p, uint64_t v)
+{
+    put32(p, (uint32_t)v);
+    put32(p + 4, (uint32_t)(v >> 32));
+}
+
+/* A container of the three built-in tables, then: every truncation, each
+ * header and series-table field out of range, index rows that do not
+ * bracket their time, and a misaligned buffer.  None may open. */
+static unsigned test_multi_corrupt(void)
+{
+    const int64_t  step = 31557600;
+    fractonica_source_t src[3];
+    fractonica_multi_t  multi;
+    uint8_t       *image, *copy;
+    size_t         size, n;
+    uint32_t       index_count, index_offset;
+    unsigned       bad = 0, c, k;
+
+    for (k = 0; k < 3; k++)
+        fractonica_mem_init(&src[k], series[k].count, series[k].timestamps);
+    if (!fractonica_multi_write(TEST_MULTI_PATH, multi_names, src, 3, step)
+        || !(image = read_whole(TEST_MULTI_PATH, &size)))
+        return fail("fractonica_multi_write", "", "", 0);
+    copy = (uint8_t *)malloc(size + 8u);
+    index_count  = image[20] | (uint32_t)image[21] << 8 | (uint32_t)image[22] << 16 | (uint32_t)image[23] << 24;
+    index_offset = FRACTONICA_MULTI_HEADER_SIZE + 3u * 24u;
+
+    _checks++;
+    if (!copy || !fractonica_multi_open_memory(&multi, image, size))
+        bad += fail("fractonica_multi_open_memory", "", "", 0);
+
+    for (n = 0; n < size && !bad; n++) {
+        memcpy(copy, image, n);
+        _checks++;
+        if (fractonica_multi_open_memory(&multi, copy, n))
+            bad += fail("truncated container opened", "", "", (int64_t)n);
+    }
+
+    for (c = 0; c < 16 && !bad; c++) {
+        memcpy(copy, image, size);
+        switch (c) {
+        case 0: copy[0] ^= 1u; break;                                    /* magic */
+        case 1: put64(copy + 8, 0); break;                               /* version 0 */
+        case 2: put64(copy + 8, 3); break;                               /* version 3 */
+        case 3: put32(copy + 16, 0); break;                              /* no series */
+        case 4: put32(copy + 16, FRACTONICA_MAX_SERIES + 1u); break;     /* too many */
+        case 5: put32(copy + 20, 0); break;                              /* no index rows */
+        case 6: put32(copy + 20, index_count + 2u); break;               /* rows past the times */
+        case 7: put64(copy + 32, 0); break;                              /* step 0 */
+        case 8: put64(copy + 32, (uint64_t)-step); break;                /* negative step */
+        case 9: put64(copy + 24, (uint64_t)INT64_MAX - 10u); break;      /* row times overflow */
+        case 10: put32(copy + 4, 3u * 512u + 1u); break;                 /* more entries than stored */
+        case 11: put32(copy + FRACTONICA_MULTI_HEADER_SIZE + 16u, 1u); break;   /* series 0 shifted */
+        case 12: put32(copy + FRACTONICA_MULTI_HEADER_SIZE + 2u * 24u + 20u, 513u); break;  /* past the end */
+        case 13: put32(copy + index_offset + 4u * 3u * (index_count / 2u), 0); break;      /* row too low */
+        case 14: put32(copy + index_offset + 4u * 3u * (index_count / 2u) + 4u, 513u); break; /* past count */
+        case 15: {                                                       /* off by one */
+            uint8_t *row = copy + index_offset + 4u * 3u * (index_count / 2u) + 8u;
+            const uint32_t v = row[0] | (uint32_t)row[1] << 8 | (uint32_t)row[2] << 16 | (uint32_t)row[3] << 24;
+            put32(row, v ? v - 1u : v + 1u);
+            break;
+        }
+        }
+        _checks++;
+        if (fractonica_multi_open_memory(&multi, copy, size))
+            bad += fail("corrupted container opened", "", "", c);
+    }
+
+    /* Misaligned */
+    memcpy(copy + 4, image, size);
+    _checks++;
+    if (!bad && fractonica_multi_open_memory(&multi, copy + 4, size))
+        bad += fail("misaligned container opened", "", "", 4);
+
+    /* And from a file cut short */
+    {
+        FILE *f = fopen(TEST_MULTI_PATH, "wb");
+        const size_t half = size / 2u;
+        _checks++;
+        if (!f || fwrite(image, 1, half, f) != half || fclose(f) != 0)
+            bad += fail("write container", "", "", 0);
+        else if (fractonica_multi_open(&multi, TEST_MULTI_PATH))
+            bad += fail("truncated container file opened", "", "", (int64_t)half);
+    }
+
+    free(copy);
+    free(image);
+    remove(TEST_MULTI_PATH);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned samples = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : TEST_RANDOM_SAMPLES;
+    unsigned       bad, i;
+
+    /* Synodic months with a day or so of jitter, from 1900 */
+    long_series[0] = -2208988800LL;
+    for (i = 1; i < TEST_LONG_COUNT; i++)
+        long_series[i] = long_series[i - 1] + 2551443 - 86400 + (int64_t)(next_random() % 172800u);
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               _checks);                                                           \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("entries", test_entries());
+    RUN("random", test_random(samples));
+    RUN("truncated", test_truncated());
+    RUN("multi", test_multi(samples));
+    RUN("multi bad", test_multi_corrupt());
+#undef RUN
+    return 0;
+}
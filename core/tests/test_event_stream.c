@@ -0,0 +1,366 @@
+/*
+ * test_event_stream.c — event_stream.h against independent searches
+ *
+ *   test_event_stream
+ *
+ * Merges the solar and lunar catalogs with the new moon table over their
+ * whole span and over random sub-ranges, and checks every stream against
+ * per-source loops of find_next_*_eclipse() / fractonica_find_closest() /
+ * saros_rollover_queue_pop(): nothing missing or extra, time order, the
+ * documented order of events at the same moment, and that both ends of
+ * [t0, t1] are inclusive.  A second ephemeris carrying the solar eclipse
+ * times, a second copy of the new moon table, and an ephemeris of the
+ * saros rollover times force ties on every one of their events.  Exits
+ * non-zero on the first failing group.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "event_stream.h"
+#include "new_moon.h"
+#include "saros_oracle.h"
+
+#define TEST_MAX_EPHEMERIS 16384u
+
+/* Rollover queues: three solar then three lunar series, resolution 1 (a
+ * bin change every couple of days per series), in seconds. */
+#define TEST_ROLLOVER_SERIES 6u
+static const uint8_t rollover_series[TEST_ROLLOVER_SERIES] = { 136, 145, 150, 131, 137, 146 };
+
+static uint64_t _rng = 0x2545F4914F6CDD1Dull;
+
+static uint64_t next_random(void)
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 7;
+    _rng ^= _rng << 17;
+    return _rng;
+}
+
+static const fractonica_mem_source_t new_moon = {
+    FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps, NULL
+};
+
+static saros_db_t solar_db, lunar_db;
+
+/* The solar eclipse times as an ephemeris, to tie with the catalog. */
+static int64_t                 solar_times[TEST_MAX_EPHEMERIS];
+static fractonica_mem_source_t solar_ephemeris;
+
+/* Rollover times of one range as an ephemeris, to tie with the queue. */
+static int64_t                 rollover_times[TEST_MAX_EPHEMERIS];
+static fractonica_mem_source_t rollover_ephemeris;
+
+/* Sources of one stream in the order they are added; events at the same
+ * moment must come out catalogs, then ephemerides, each in this order,
+ * then rollovers.  reference is a second queue prepared exactly like
+ * rollovers and drained with saros_rollover_queue_pop(). */
+typedef struct {
+    const saros_db_t              *catalogs[2];
+    uint8_t                        catalog_count;
+    const fractonica_mem_source_t *ephemerides[3];
+    uint8_t                        ephemeris_count;
+    saros_rollover_queue_t        *rollovers;
+    saros_rollover_queue_t        *reference;
+} stream_sources_t;
+
+static eclipse_entry_t next_eclipse(const saros_db_t *db, int64_t t)
+{
+    return (db->is_lunar ? find_next_lunar_eclipse(t) : find_next_solar_eclipse(t)).eclipse;
+}
+
+/* Index of the first entry at or after t; entry_count if none. */
+static uint32_t next_entry(const fractonica_mem_source_t *src, int64_t t)
+{
+    const fractonica_search_result_t r = fractonica_find_closest(src, t);
+    return r.found_future ? r.future_index : src->entry_count;
+}
+
+static unsigned rank(const fractonica_event_t *e)
+{
+    return e->kind == FRACTONICA_EVENT_ECLIPSE ? 0u : e->kind == FRACTONICA_EVENT_EPHEMERIS ? 1u : 2u;
+}
+
+/* One stream over [t0, t1] against the per-source searches.  *events gets
+ * the number of events, *ties the number that shared a moment. */
+static unsigned check_stream(const stream_sources_t *src, int64_t t0, int64_t t1,
+                             unsigned long *events, unsigned long *ties)
+{
+    fractonica_event_stream_t s;
+    fractonica_event_t        ev, prev;
+    eclipse_entry_t           want_eclipse[2];
+    saros_rollover_event_t    want_rollover;
+    uint32_t                  want_index[3];
+    unsigned                  bad = 0, i;
+    int                       have_prev = 0;
+
+    memset(&prev, 0, sizeof(prev));
+    fractonica_events_init(&s, t0, t1);
+    for (i = 0; i < src->ephemeris_count; i++) {
+        fractonica_events_add_ephemeris(&s, src->ephemerides[i], (uint8_t)(10u + i));
+        want_index[i] = next_entry(src->ephemerides[i], t0);
+    }
+    for (i = 0; i < src->catalog_count; i++) {
+        fractonica_events_add_catalog(&s, src->catalogs[i], NULL);
+        want_eclipse[i] = next_eclipse(src->catalogs[i], t0);
+    }
+    if (src->rollovers)
+        fractonica_events_add_rollovers(&s, src->rollovers);
+
+    while (fractonica_events_next(&s, &ev)) {
+        saros_checks_add(2);
+        (*events)++;
+        if (ev.timestamp < t0 || ev.timestamp > t1)
+            bad += saros_check_fail("event outside [t0, t1]", ev.timestamp, 0);
+        if (have_prev && ev.timestamp == prev.timestamp) {
+            (*ties)++;
+            /* rollovers of one queue may share a second; they have no source */
+            if (rank(&prev) > rank(&ev)
+                || (rank(&prev) == rank(&ev) && ev.kind != FRACTONICA_EVENT_ROLLOVER && prev.source >= ev.source))
+                bad += saros_check_fail("tie order", ev.timestamp, ev.source);
+        } else if (have_prev && ev.timestamp < prev.timestamp) {
+            bad += saros_check_fail("time order", ev.timestamp, ev.source);
+        }
+
+        if (ev.kind == FRACTONICA_EVENT_ECLIPSE && ev.source < src->catalog_count) {
+            const saros_db_t *db = src->catalogs[ev.source];
+            if (ev.timestamp != ev.u.eclipse.unix_time
+                || !saros_entry_equal(&ev.u.eclipse, &want_eclipse[ev.source], db->is_lunar))
+                bad += saros_check_fail("eclipse event", ev.timestamp, ev.source);
+            want_eclipse[ev.source] = next_eclipse(db, ev.u.eclipse.unix_time + 1);
+        } else if (ev.kind == FRACTONICA_EVENT_EPHEMERIS && ev.source < src->ephemeris_count) {
+            const fractonica_mem_source_t *e = src->ephemerides[ev.source];
+            if (ev.tag != 10u + ev.source || ev.u.index != want_index[ev.source]
+                || ev.timestamp != fractonica_mem_get_timestamp(e, ev.u.index))
+                bad += saros_check_fail("ephemeris event", ev.timestamp, ev.source);
+            want_index[ev.source] = next_entry(e, ev.timestamp + 1);
+        } else if (ev.kind == FRACTONICA_EVENT_ROLLOVER && src->reference) {
+            const saros_rollover_event_t *r = &ev.u.rollover;
+            if (!saros_rollover_queue_pop(src->reference, INT64_MAX, &want_rollover)
+                || ev.timestamp != r->timestamp || r->timestamp != want_rollover.timestamp
+                || r->bin != want_rollover.bin || r->saros_number != want_rollover.saros_number
+                || r->is_lunar != want_rollover.is_lunar)
+                bad += saros_check_fail("rollover event", ev.timestamp, r->saros_number);
+        } else {
+            bad += saros_check_fail("unexpected event", ev.timestamp, ev.kind);
+        }
+        if (bad)
+            return bad;
+        prev      = ev;
+        have_prev = 1;
+    }
+
+    /* Every source must be exhausted up to t1. */
+    for (i = 0; i < src->catalog_count; i++) {
+        saros_checks_add(1);
+        if (want_eclipse[i].valid && want_eclipse[i].unix_time <= t1)
+            bad += saros_check_fail("eclipse missing from stream", want_eclipse[i].unix_time, (uint8_t)i);
+    }
+    for (i = 0; i < src->ephemeris_count; i++) {
+        saros_checks_add(1);
+        if (want_index[i] < src->ephemerides[i]->entry_count
+            && fractonica_mem_get_timestamp(src->ephemerides[i], want_index[i]) <= t1)
+            bad += saros_check_fail("ephemeris entry missing from stream", t1, (uint8_t)i);
+    }
+    if (src->reference) {
+        saros_checks_add(1);
+        if (saros_rollover_queue_next(src->reference) <= t1)
+            bad += saros_check_fail("rollover missing from stream", saros_rollover_queue_next(src->reference), 0);
+    }
+    return bad;
+}
+
+/* First and last event of a stream over [t0, t1]; 0 if it is empty. */
+static int stream_ends(const stream_sources_t *src, int64_t t0, int64_t t1,
+                       fractonica_event_t *first, fractonica_event_t *last)
+{
+    fractonica_event_stream_t s;
+    fractonica_event_t        ev;
+    int                       n = 0;
+    unsigned                  i;
+
+    fractonica_events_init(&s, t0, t1);
+    for (i = 0; i < src->catalog_count; i++)
+        fractonica_events_add_catalog(&s, src->catalogs[i], NULL);
+    for (i = 0; i < src->ephemeris_count; i++)
+        fractonica_events_add_ephemeris(&s, src->ephemerides[i], (uint8_t)(10u + i));
+    while (fractonica_events_next(&s, &ev)) {
+        if (n++ == 0)
+            *first = ev;
+        *last = ev;
+    }
+    return n > 0;
+}
+
+/* Solar, lunar and new moons over the span of all three and beyond. */
+static unsigned test_merge(void)
+{
+    const stream_sources_t src = { { &solar_db, &lunar_db }, 2, { &new_moon }, 1, NULL, NULL };
+    const int64_t          lo  = oracle_find_next(&oracle_solar, INT64_MIN).eclipse.unix_time;
+    const int64_t          hi  = oracle_find_past(&oracle_solar, INT64_MAX).eclipse.unix_time;
+    unsigned long          events = 0, ties = 0;
+    unsigned               bad = 0, i;
+
+    bad += check_stream(&src, INT64_MIN, INT64_MAX, &events, &ties);
+    saros_checks_add(1);
+    if (events != oracle_solar.count + oracle_lunar.count + new_moon.entry_count)
+        bad += saros_check_fail("event count", (int64_t)events, 0);
+    for (i = 0; i < 256 && !bad; i++) {
+        const int64_t t0 = lo + (int64_t)(next_random() % (uint64_t)(hi - lo));
+        bad += check_stream(&src, t0, t0 + (int64_t)(next_random() % 3155760000u), &events, &ties);
+    }
+    return bad;
+}
+
+/* t0 and t1 exactly on events of each kind, and one second past them. */
+static unsigned test_inclusive(void)
+{
+    const stream_sources_t src = { { &solar_db, &lunar_db }, 2, { &new_moon }, 1, NULL, NULL };
+    const uint32_t         k   = FRACTONICA_NEW_MOON_COUNT / 2u;
+    const int64_t          a[3] = {
+        find_next_solar_eclipse(fractonica_new_moon_timestamps[k]).eclipse.unix_time,
+        find_next_lunar_eclipse(fractonica_new_moon_timestamps[k]).eclipse.unix_time,
+        fractonica_new_moon_timestamps[k],
+    };
+    const int64_t          b[3] = {
+        find_past_solar_eclipse(fractonica_new_moon_timestamps[k + 40u]).eclipse.unix_time,
+        find_past_lunar_eclipse(fractonica_new_moon_timestamps[k + 40u]).eclipse.unix_time,
+        fractonica_new_moon_timestamps[k + 40u],
+    };
+    fractonica_event_t     first, last;
+    unsigned               bad = 0, i, j;
+
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < 3; j++) {
+            saros_checks_add(2);
+            if (!stream_ends(&src, a[i], b[j], &first, &last)
+                || first.timestamp != a[i] || last.timestamp != b[j])
+                bad += saros_check_fail("inclusive [t0, t1]", a[i], (uint8_t)j);
+            if (stream_ends(&src, a[i] + 1, b[j] - 1, &first, &last)
+                && (first.timestamp == a[i] || last.timestamp == b[j]))
+                bad += saros_check_fail("exclusive (t0, t1)", a[i], (uint8_t)j);
+        }
+    }
+    return bad;
+}
+
+/* Ephemerides added before the catalog and tying with it on every event:
+ * catalogs still come first, then the ephemerides in the order added. */
+static unsigned test_ties(void)
+{
+    const stream_sources_t src = {
+        { &solar_db, &lunar_db }, 2, { &new_moon, &solar_ephemeris, &new_moon }, 3, NULL, NULL
+    };
+    unsigned long          events = 0, ties = 0;
+    unsigned               bad;
+
+    bad = check_stream(&src, INT64_MIN, INT64_MAX, &events, &ties);
+    saros_checks_add(1);
+    if (!bad && ties != oracle_solar.count + new_moon.entry_count)
+        bad += saros_check_fail("tie count", (int64_t)ties, 0);
+    return bad;
+}
+
+/* A queue over rollover_series brought to t0. */
+static void rollover_queue(saros_rollover_queue_t *q, saros_phase_tracker_t trackers[TEST_ROLLOVER_SERIES],
+                           int64_t t0)
+{
+    unsigned i;
+
+    for (i = 0; i < TEST_ROLLOVER_SERIES; i++) {
+        if (i < TEST_ROLLOVER_SERIES / 2u)
+            solar_phase_tracker_init(&trackers[i], rollover_series[i], 1, 1);
+        else
+            lunar_phase_tracker_init(&trackers[i], rollover_series[i], 1, 1);
+    }
+    saros_rollover_queue_init(q, trackers, (uint8_t)TEST_ROLLOVER_SERIES, t0);
+}
+
+/* Rollovers merged with both catalogs and the new moons over random
+ * ranges of up to two years; then with an ephemeris of their own times
+ * added, so every rollover ties and must come out after that entry. */
+static unsigned test_rollovers(void)
+{
+    const int64_t          lo = fractonica_new_moon_timestamps[0];
+    const int64_t          hi = fractonica_new_moon_timestamps[FRACTONICA_NEW_MOON_COUNT - 1u];
+    saros_phase_tracker_t  ta[TEST_ROLLOVER_SERIES], tb[TEST_ROLLOVER_SERIES], tc[TEST_ROLLOVER_SERIES];
+    saros_rollover_queue_t qa, qb, qc;
+    saros_rollover_event_t r;
+    unsigned long          events = 0, ties = 0, rollovers = 0;
+    unsigned               bad = 0, i;
+
+    for (i = 0; i < 32 && !bad; i++) {
+        const int64_t    t0 = lo + (int64_t)(next_random() % (uint64_t)(hi - lo));
+        const int64_t    t1 = t0 + (int64_t)(next_random() % 63115200u);
+        stream_sources_t src = { { &solar_db, &lunar_db }, 2, { &new_moon }, 1, &qa, &qb };
+        uint32_t         n = 0;
+        unsigned long    before;
+
+        rollover_queue(&qa, ta, t0);
+        rollover_queue(&qb, tb, t0);
+        bad += check_stream(&src, t0, t1, &events, &ties);
+
+        /* The same range again, each distinct rollover second also an
+         * ephemeris entry. */
+        rollover_queue(&qc, tc, t0);
+        rollovers = 0;
+        while (saros_rollover_queue_pop(&qc, t1, &r)) {
+            rollovers++;
+            if (n > 0u && rollover_times[n - 1u] == r.timestamp)
+                continue;
+            if (n == TEST_MAX_EPHEMERIS)
+                return bad + saros_check_fail("rollovers over TEST_MAX_EPHEMERIS", t0, 0);
+            rollover_times[n++] = r.timestamp;
+        }
+        rollover_ephemeris.entry_count = n;
+        rollover_ephemeris.timestamps  = rollover_times;
+        src.ephemerides[1]  = &rollover_ephemeris;
+        src.ephemeris_count = 2;
+        rollover_queue(&qa, ta, t0);
+        rollover_queue(&qb, tb, t0);
+        before = ties;
+        bad += check_stream(&src, t0, t1, &events, &ties);
+        saros_checks_add(2);
+        if (rollovers == 0u)
+            bad += saros_check_fail("no rollovers in range", t0, 0);
+        if (!bad && ties - before < rollovers)
+            bad += saros_check_fail("rollover tie count", (int64_t)(ties - before), 0);
+    }
+    return bad;
+}
+
+int main(void)
+{
+    uint32_t i;
+    unsigned bad;
+
+    oracle_init();
+    solar_db = oracle_db(&oracle_solar);
+    lunar_db = oracle_db(&oracle_lunar);
+    if (oracle_solar.count > TEST_MAX_EPHEMERIS) {
+        fprintf(stderr, "solar catalog larger than TEST_MAX_EPHEMERIS\n");
+        return 1;
+    }
+    for (i = 0; i < oracle_solar.count; i++)
+        solar_times[i] = _saros_read_i64(oracle_solar.times, i);
+    solar_ephemeris.entry_count = oracle_solar.count;
+    solar_ephemeris.timestamps  = solar_times;
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               saros_checks_run());                                                \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("merge", test_merge());
+    RUN("inclusive", test_inclusive());
+    RUN("ties", test_ties());
+    RUN("rollovers", test_rollovers());
+#undef RUN
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * test_leap_seconds.cpp — libs/astro/leap_seconds.hpp without SPICE
+ *
+ *   test_leap_seconds [random-samples]
+ *
+ * Fills cspice_utils::LeapSeconds by hand with the naif0012.tls DELTET
+ * values (what load_leap_seconds() reads from the kernel pool) and checks
+ * unix_to_et() / et_to_unix(): ET of J2000 UTC against SPICE's own value,
+ * round trips at random times from 1900 to 2100 and every quarter second
+ * around each leap second, a two-second ET step across each inserted
+ * second that unix time folds onto one second, and the first DELTA_AT
+ * before the table starts.  Exits non-zero on the first failing group.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "leap_seconds.hpp"
+
+#define TEST_RANDOM_SAMPLES 200000u
+#define TEST_MAX_REPORTS    20u
+#define TEST_ROUND_TRIP     1e-6 /* seconds; a few ulps at unix 4e9 */
+
+/* Unix times at which each DELTA_AT of naif0012.tls starts (1972-2017). */
+static const double leap_unix[] = {
+    63072000, 78796800, 94694400, 126230400, 157766400, 189302400, 220924800,
+    252460800, 283996800, 315532800, 362793600, 394329600, 425865600, 489024000,
+    567993600, 631152000, 662688000, 709948800, 741484800, 773020800, 820454400,
+    867715200, 915148800, 1136073600, 1230768000, 1341100800, 1435708800, 1483228800,
+};
+
+#define LEAP_COUNT (sizeof(leap_unix) / sizeof(leap_unix[0]))
+
+static uint64_t      _rng = 0x94D049BB133111EBull;
+static unsigned long _checks;
+static unsigned      _reports;
+
+static uint64_t next_random(void)
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 7;
+    _rng ^= _rng << 17;
+    return _rng;
+}
+
+static unsigned fail(const char *what, double unix_seconds, double off)
+{
+    if (_reports++ < TEST_MAX_REPORTS)
+        fprintf(stderr, "mismatch: %s at unix=%.3f (%.3g s)\n", what, unix_seconds, off);
+    return 1;
+}
+
+static cspice_utils::LeapSeconds naif0012(void)
+{
+    cspice_utils::LeapSeconds ls;
+    for (unsigned i = 0; i < LEAP_COUNT; i++) {
+        ls.delta_at.push_back(10.0 + i);
+        ls.starts.push_back(leap_unix[i] - cspice_utils::LeapSeconds::unix_j2000);
+    }
+    ls.delta_t_a = 32.184;
+    ls.k         = 1.657e-3;
+    ls.eb        = 1.671e-2;
+    ls.m0        = 6.239996;
+    ls.m1        = 1.99096871e-7;
+    return ls;
+}
+
+static unsigned round_trip(const cspice_utils::LeapSeconds &ls, double unix_seconds)
+{
+    const double back = ls.et_to_unix(ls.unix_to_et(unix_seconds));
+    _checks++;
+    return fabs(back - unix_seconds) > TEST_ROUND_TRIP ? fail("round trip", unix_seconds, back - unix_seconds) : 0;
+}
+
+/* ── Groups ─────────────────────────────────────────────────────────────── */
+
+/* str2et_c("2000-01-01T12:00:00") = 64.183927284731 s. */
+static unsigned test_j2000(void)
+{
+    const cspice_utils::LeapSeconds ls = naif0012();
+    const double et = ls.unix_to_et(cspice_utils::LeapSeconds::unix_j2000);
+    const double off = et - 64.183927284731;
+    _checks++;
+    return fabs(off) > 1e-6 ? fail("ET of J2000", cspice_utils::LeapSeconds::unix_j2000, off) : 0;
+}
+
+static unsigned test_random(unsigned samples)
+{
+    const cspice_utils::LeapSeconds ls = naif0012();
+    const double from = -2208988800.0, to = 4102444800.0; /* 1900 .. 2100 */
+    unsigned bad = 0;
+
+    for (unsigned i = 0; i < samples; i++) {
+        const double u = from + (to - from) * ((double)(next_random() >> 11) / 9007199254740992.0);
+        bad |= round_trip(ls, u);
+        bad |= round_trip(ls, floor(u)); /* whole seconds, as the tables hold */
+    }
+    return bad;
+}
+
+/* Every leap second: round trips on either side, ET jumps by two seconds
+ * over unix second u - 1 .. u, and the inserted 23:59:60 comes back as
+ * the first second of the new day, [u, u + 1), like the DELTA_AT step in
+ * et_to_unix(). */
+static unsigned test_leaps(void)
+{
+    const cspice_utils::LeapSeconds ls = naif0012();
+    unsigned bad = 0;
+
+    for (unsigned i = 1; i < LEAP_COUNT; i++) {
+        const double u = leap_unix[i];
+        for (double s = -3.0; s <= 3.0; s += 0.25)
+            bad |= round_trip(ls, u + s);
+
+        const double step = ls.unix_to_et(u) - ls.unix_to_et(u - 1.0);
+        _checks++;
+        if (fabs(step - 2.0) > 1e-6)
+            bad |= fail("ET across a leap second", u, step - 2.0);
+
+        const double leap_et = ls.unix_to_et(u - 1.0) + 1.5; /* 23:59:60.5 UTC */
+        const double folded  = ls.et_to_unix(leap_et);
+        _checks++;
+        if (folded < u || folded >= u + 1.0)
+            bad |= fail("inserted second", u, folded - u);
+    }
+    return bad;
+}
+
+/* Before 1972 the first DELTA_AT applies, so ET - unix is constant up to
+ * the periodic term. */
+static unsigned test_before_table(void)
+{
+    const cspice_utils::LeapSeconds ls = naif0012();
+    unsigned bad = 0;
+
+    for (double u = leap_unix[0] - 20.0 * 31557600.0; u < leap_unix[0]; u += 86400.0 * 97.0) {
+        const double offset = ls.unix_to_et(u) - (u - cspice_utils::LeapSeconds::unix_j2000);
+        _checks++;
+        if (fabs(offset - (10.0 + 32.184)) > 2e-3)
+            bad |= fail("first DELTA_AT", u, offset - 42.184);
+        bad |= round_trip(ls, u);
+    }
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned samples = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : TEST_RANDOM_SAMPLES;
+    unsigned       bad;
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               _checks);                                                           \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("j2000", test_j2000());
+    RUN("random", test_random(samples));
+    RUN("leaps", test_leaps());
+    RUN("before", test_before_table());
+#undef RUN
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * test_lunar_events.cpp — libs/astro/event_search.hpp without SPICE
+ *
+ *   test_lunar_events
+ *
+ * Runs the event search on AnalyticEphemeris.h geometry in place of the
+ * kernels and checks it against the built-in tables (new_moon.h, apogee.h,
+ * nodal_ascending.h) over their span: one event found per table entry,
+ * none extra, each within the series' accuracy.  The same search split
+ * across fork()ed worker processes must give identical tables, a worker
+ * that dies or a source that fails must be counted in the status, and
+ * write_lunar_events() must read back through fractonica_multi_open().
+ * Exits non-zero on the first failing group.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "AnalyticEphemeris.h"
+#include "apogee.h"
+#include "event_search.hpp"
+#include "new_moon.h"
+#include "nodal_ascending.h"
+
+#define TEST_MULTI_PATH  "test_lunar_events.frac"
+#define TEST_MAX_REPORTS 20u
+
+namespace AE = Fractonica::AnalyticEphemeris;
+
+/* Unix seconds of ET 0 near the tables' span (TT - UTC = 69.184 s). */
+static const double unix_of_et0 = 946728000.0 - 69.184;
+
+static unsigned long _checks;
+static unsigned      _reports;
+
+static unsigned fail(const char *what, const char *series, int64_t timestamp, double off)
+{
+    if (_reports++ < TEST_MAX_REPORTS)
+        fprintf(stderr, "mismatch: %s (%s) at ts=%lld, off by %.0f s\n", what, series, (long long)timestamp, off);
+    return 1;
+}
+
+/* ── Geometry from the analytic series ──────────────────────────────────── */
+
+/* The analytic positions are referred to the ecliptic of date; turn its
+ * pole onto ecliptic_pole_of_date() so they read as ECLIPJ2000.  Every
+ * event function only depends on angles to that pole, so any such
+ * rotation will do. */
+static void to_j2000(const double et, const AE::Position &p, double out[3])
+{
+    double pole[3];
+    moon::detail::ecliptic_pole_of_date(et, pole);
+    const double vx = -pole[1], vy = pole[0], f = 1.0 / (1.0 + pole[2]);
+    const double v[3] = {p.x, p.y, p.z};
+    /* R = I + [v]x + [v]x^2 / (1 + c) for v = z x pole, c = z . pole */
+    const double m[3][3] = {{1.0 - vy * vy * f, vx * vy * f, vy},
+                            {vx * vy * f, 1.0 - vx * vx * f, -vx},
+                            {-vy, vx, 1.0 - (vx * vx + vy * vy) * f}};
+    for (int i = 0; i < 3; i++)
+        out[i] = m[i][0] * v[0] + m[i][1] * v[1] + m[i][2] * v[2];
+}
+
+struct AnalyticSource {
+    size_t fetches = 0;
+    double fail_from = 1.0, fail_to = 0.0; /* ET window that fails, if from <= to */
+
+    static double day(const double et) { return (et + unix_of_et0 - 946598400.0) / 86400.0; }
+
+    bool fetch(const double et, uint32_t, moon::EventGeometry &g, moon::EventSearchStatus &status)
+    {
+        fetches++;
+        if (et >= fail_from && et <= fail_to) {
+            if (status.failed++ == 0)
+                status.first_error = "analytic source: failure window";
+            return false;
+        }
+        const double h = 60.0; /* velocity by central difference */
+        double ahead[3], behind[3];
+        to_j2000(et, AE::Sun(day(et)), g.sun);
+        to_j2000(et, AE::Moon(day(et)), g.moon);
+        to_j2000(et, AE::Moon(day(et + h)), ahead);
+        to_j2000(et, AE::Moon(day(et - h)), behind);
+        for (int i = 0; i < 3; i++) {
+            g.state[i]     = g.moon[i];
+            g.state[3 + i] = (ahead[i] - behind[i]) / (2.0 * h);
+        }
+        return true;
+    }
+
+    double et_to_unix(const double et) const { return et + unix_of_et0; }
+};
+
+/* ── Tables ─────────────────────────────────────────────────────────────── */
+
+struct TestTable {
+    const char    *name;
+    uint32_t       count;
+    const int64_t *timestamps;
+    double         tolerance; /* seconds: the analytic series' error, not the search's */
+};
+
+/* The tolerances are the analytic series' errors with some margin (worst
+ * seen over the tables: 8 min, 5 h, 52 min): its latitude and distance
+ * terms are coarse, and the range rate is flat at apogee. */
+static const TestTable tables[moon::event_kind_count] = {
+    { "new_moon", FRACTONICA_NEW_MOON_COUNT, fractonica_new_moon_timestamps, 15.0 * 60.0 },
+    { "apogee", FRACTONICA_APOGEE_COUNT, fractonica_apogee_timestamps, 8.0 * 3600.0 },
+    { "nodal_ascending", FRACTONICA_NODAL_ASCENDING_COUNT, fractonica_nodal_ascending_timestamps, 75.0 * 60.0 },
+};
+
+/* Span all three tables cover. */
+static void table_span(int64_t &t0, int64_t &t1)
+{
+    t0 = INT64_MIN, t1 = INT64_MAX;
+    for (const TestTable &t : tables) {
+        t0 = t0 > t.timestamps[0] ? t0 : t.timestamps[0];
+        t1 = t1 < t.timestamps[t.count - 1] ? t1 : t.timestamps[t.count - 1];
+    }
+}
+
+static unsigned same_tables(const moon::EventTables &a, const moon::EventTables &b, const char *what)
+{
+    unsigned bad = 0;
+    for (uint32_t k = 0; k < moon::event_kind_count; k++) {
+        _checks++;
+        if (a.series[k] != b.series[k])
+            bad |= fail(what, moon::event_series_names[k], 0, 0.0);
+    }
+    return bad;
+}
+
+/* ── Groups ─────────────────────────────────────────────────────────────── */
+
+/* Every table entry in the span is matched by exactly one found event. */
+static unsigned test_tables(void)
+{
+    int64_t        t0, t1;
+    AnalyticSource source;
+    unsigned       bad = 0;
+
+    table_span(t0, t1);
+    const moon::EventTables found = moon::search_lunar_events(source, t0, t1);
+    if (found.status.failed)
+        return fail("status", found.status.first_error.c_str(), t0, 0.0);
+
+    for (uint32_t k = 0; k < moon::event_kind_count; k++) {
+        const TestTable            &t = tables[k];
+        const std::vector<int64_t> &s = found.series[k];
+        size_t                      expected = 0;
+
+        for (size_t i = 0; i < s.size(); i++) {
+            _checks++;
+            if ((i && s[i] <= s[i - 1]) || s[i] < t0 || s[i] > t1)
+                bad |= fail("order or range", t.name, s[i], 0.0);
+        }
+        for (uint32_t i = 0; i < t.count; i++) {
+            const int64_t ts = t.timestamps[i];
+            /* events within a tolerance of the span's ends may fall outside it */
+            if (ts < t0 + (int64_t)t.tolerance || ts > t1 - (int64_t)t.tolerance)
+                continue;
+            expected++;
+            _checks++;
+            double best = 1e18;
+            for (const int64_t e : s)
+                best = fabs((double)(e - ts)) < fabs(best) ? (double)(e - ts) : best;
+            if (fabs(best) > t.tolerance)
+                bad |= fail("no event near entry", t.name, ts, best);
+        }
+        _checks++;
+        if (s.size() < expected || s.size() > expected + 2)
+            bad |= fail("event count", t.name, (int64_t)s.size(), (double)expected);
+    }
+    return bad;
+}
+
+/* fork()ed workers, at several process counts, against one process. */
+static unsigned test_workers(void)
+{
+    int64_t        t0, t1;
+    AnalyticSource source;
+    unsigned       bad = 0;
+
+    table_span(t0, t1);
+    t1 = t0 + 10 * 31557600;
+    const moon::EventTables serial = moon::search_lunar_events(source, t0, t1);
+    const moon::detail::EventGrid grid = moon::detail::event_grid(source, t0, t1, 86400);
+
+    for (unsigned processes : {1u, 2u, 3u, 7u, 64u}) {
+        const moon::EventTables split = moon::run_event_workers(grid.intervals, processes,
+            [&](size_t first, size_t last, bool) {
+                moon::EventTables part;
+                AnalyticSource    own;
+                moon::detail::event_range(own, grid, first, last, t0, t1, part);
+                return part;
+            });
+        bad |= same_tables(serial, split, "workers");
+        _checks++;
+        if (split.status.failed)
+            bad |= fail("worker status", split.status.first_error.c_str(), processes, 0.0);
+    }
+    return bad;
+}
+
+/* Failed samples and dead workers are counted, never silently dropped. */
+static unsigned test_failures(void)
+{
+    int64_t        t0, t1;
+    AnalyticSource source;
+    unsigned       bad = 0;
+
+    table_span(t0, t1);
+    t1 = t0 + 2 * 31557600;
+    source.fail_from = (double)(t0 + 31557600) - unix_of_et0;
+    source.fail_to   = source.fail_from + 40.0 * 86400.0;
+    const moon::EventTables holed = moon::search_lunar_events(source, t0, t1);
+    _checks++;
+    if (!holed.status.failed || holed.status.first_error.empty())
+        bad |= fail("failure window not counted", "status", t0, 0.0);
+    _checks++;
+    for (uint32_t k = 0; k < moon::event_kind_count; k++)
+        for (const int64_t e : holed.series[k])
+            if ((double)e - unix_of_et0 > source.fail_from && (double)e - unix_of_et0 < source.fail_to)
+                bad |= fail("event inside failure window", moon::event_series_names[k], e, 0.0);
+
+#if !defined(_WIN32)
+    const moon::detail::EventGrid grid = moon::detail::event_grid(source, t0, t1, 86400);
+    const moon::EventTables dead = moon::run_event_workers(grid.intervals, 4,
+        [&](size_t first, size_t last, bool forked) {
+            if (forked && first > 0 && last == grid.intervals)
+                _exit(3); /* the last worker dies */
+            moon::EventTables part;
+            AnalyticSource    own;
+            moon::detail::event_range(own, grid, first, last, t0, t1, part);
+            return part;
+        });
+    _checks++;
+    if (dead.status.failed != 1)
+        bad |= fail("dead worker not counted", "status", (int64_t)dead.status.failed, 0.0);
+#endif
+    return bad;
+}
+
+/* write_lunar_events() through fractonica_multi_open(). */
+static unsigned test_write(void)
+{
+    int64_t            t0, t1;
+    AnalyticSource     source;
+    fractonica_multi_t multi;
+    unsigned           bad = 0;
+
+    table_span(t0, t1);
+    const moon::EventTables found = moon::search_lunar_events(source, t0, t1);
+    _checks++;
+    if (!moon::write_lunar_events(TEST_MULTI_PATH, found) || !fractonica_multi_open(&multi, TEST_MULTI_PATH))
+        return fail("write or open", TEST_MULTI_PATH, 0, 0.0);
+    for (uint32_t k = 0; k < moon::event_kind_count; k++) {
+        const fractonica_source_t *s = fractonica_multi_series(&multi, moon::event_series_names[k]);
+        _checks++;
+        if (!s || s->entry_count != found.series[k].size()
+            || !std::equal(found.series[k].begin(), found.series[k].end(), s->timestamps))
+            bad |= fail("read back", moon::event_series_names[k], 0, 0.0);
+    }
+    fractonica_multi_close(&multi);
+    remove(TEST_MULTI_PATH);
+    return bad;
+}
+
+int main(void)
+{
+    unsigned bad;
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               _checks);                                                           \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("tables", test_tables());
+    RUN("workers", test_workers());
+    RUN("failures", test_failures());
+    RUN("write", test_write());
+#undef RUN
+    return 0;
+}
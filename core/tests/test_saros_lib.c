@@ -0,0 +1,416 @@
+/*
+ * test_saros_lib.c — saros.h against the linear-scan oracle (saros_oracle.h)
+ *
+ *   test_saros_lib [random-samples]
+ *
+ * Checks the generated tables, then every lookup at each eclipse of both
+ * catalogs ±1 s, at random timestamps across and beyond the catalogs, and
+ * the stateful APIs (batch finds, multi-series phases, phase trackers in
+ * seconds, milliseconds and nanoseconds) on sweeps and exactly at window
+ * ends, and both catalogs written to and reopened from catalog files
+ * (range and *_any searches, malformed records rejected).  Exits non-zero on the first failing group.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "saros_db.h"
+#include "saros_file.h"
+#include "saros_oracle.h"
+
+#define TEST_RANDOM_SAMPLES 20000u
+#define TEST_SWEEP_STEP     (7 * 3600 + 13)
+#define TEST_FILE_PATH      "test_saros_lib.sdb"
+
+static uint64_t _rng = 0x9E3779B97F4A7C15ull;
+
+static uint64_t next_random(void)
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 7;
+    _rng ^= _rng << 17;
+    return _rng;
+}
+
+static unsigned test_boundaries(void)
+{
+    const oracle_catalog_t *cats[2] = { &oracle_solar, &oracle_lunar };
+    unsigned                bad = 0;
+    int                     k, d;
+
+    for (k = 0; k < 2; k++) {
+        eclipse_result_t r = oracle_find_next(cats[k], INT64_MIN);
+        while (r.eclipse.valid) {
+            const int64_t t = r.eclipse.unix_time;
+            const uint8_t s = cats[k]->is_lunar ? r.eclipse.info.lunar.saros_number
+                                                : r.eclipse.info.solar.saros_number;
+            for (d = -1; d <= 1; d++)
+                bad += saros_check_point(t + d, (d == 0) ? s : (uint8_t)next_random(),
+                                         (uint8_t)(r.eclipse.global_index % 7u));
+            r = oracle_find_next(cats[k], t + 1);
+        }
+    }
+    return bad;
+}
+
+static unsigned test_random(unsigned samples)
+{
+    static const int64_t extremes[] = { INT64_MIN, INT64_MIN + 1, -1, 0, 1, INT64_MAX - 1, INT64_MAX };
+    const int64_t first = oracle_find_next(&oracle_solar, INT64_MIN).eclipse.unix_time;
+    const int64_t last  = oracle_find_past(&oracle_solar, INT64_MAX).eclipse.unix_time;
+    /* A century of margin either side of the catalog. */
+    const int64_t lo    = first - 3155760000LL;
+    const int64_t span  = last + 3155760000LL - lo;
+    unsigned      bad = 0, i;
+
+    for (i = 0; i < sizeof(extremes) / sizeof(extremes[0]); i++)
+        bad += saros_check_point(extremes[i], (uint8_t)(i * 37u), (uint8_t)i);
+    for (i = 0; i < samples; i++) {
+        const uint64_t v = next_random();
+        bad += saros_check_point(lo + (int64_t)(v % (uint64_t)span), (uint8_t)(v >> 56),
+                                 (uint8_t)((v >> 48) & 7u));
+    }
+    return bad;
+}
+
+/* Batch finds on an ascending run (the galloping path) and shuffled. */
+static unsigned test_batch_find(void)
+{
+    const int64_t      first = oracle_find_next(&oracle_lunar, INT64_MIN).eclipse.unix_time;
+    const int64_t      last  = oracle_find_past(&oracle_lunar, INT64_MAX).eclipse.unix_time;
+    enum { N = 4096 };
+    static int64_t          ts[N];
+    static eclipse_result_t out[4][N];
+    unsigned                bad = 0, pass, i;
+
+    for (pass = 0; pass < 2; pass++) {
+        for (i = 0; i < N; i++)
+            ts[i] = first - 86400 + (int64_t)((uint64_t)(last - first + 172800) / N * i)
+                  + (int64_t)(next_random() % 3u) - 1;
+        if (pass == 1) {
+            for (i = N - 1; i > 0; i--) {
+                const unsigned j = (unsigned)(next_random() % (i + 1u));
+                const int64_t  t = ts[i];
+                ts[i] = ts[j];
+                ts[j] = t;
+            }
+        }
+        find_next_solar_eclipses(ts, N, out[0]);
+        find_past_solar_eclipses(ts, N, out[1]);
+        find_next_lunar_eclipses(ts, N, out[2]);
+        find_past_lunar_eclipses(ts, N, out[3]);
+        saros_checks_add(4u * N);
+        for (i = 0; i < N; i++) {
+            const eclipse_result_t want[4] = {
+                oracle_find_next(&oracle_solar, ts[i]), oracle_find_past(&oracle_solar, ts[i]),
+                oracle_find_next(&oracle_lunar, ts[i]), oracle_find_past(&oracle_lunar, ts[i]),
+            };
+            unsigned f;
+            for (f = 0; f < 4; f++) {
+                const int lunar = f >= 2;
+                if (!saros_entry_equal(&out[f][i].eclipse, &want[f].eclipse, lunar)
+                    || !saros_entry_equal(&out[f][i].saros_prev, &want[f].saros_prev, lunar)
+                    || !saros_entry_equal(&out[f][i].saros_next, &want[f].saros_next, lunar))
+                    bad += saros_check_fail("find_*_eclipses batch", ts[i], 0);
+            }
+        }
+    }
+    return bad;
+}
+
+/* Multi-series phases and trackers for the alive series on a long sweep,
+ * so cached windows expire and refill many times over. */
+static unsigned test_sweeps(void)
+{
+    enum { N = ALIVE_SAROS_COUNT };
+    saros_phase_tracker_t sec[N], ms[N], ns[N];
+    uint64_t              got[N], got_ms[N];
+    const int64_t         start = oracle_find_next(&oracle_solar, INT64_MIN).eclipse.unix_time;
+    const int64_t         end   = oracle_find_past(&oracle_solar, INT64_MAX).eclipse.unix_time;
+    unsigned              bad = 0, i;
+    int64_t               t;
+
+    for (i = 0; i < N; i++) {
+        solar_phase_tracker_init(&sec[i], SarosOrderedByBirth[i], 2, 1);
+        solar_phase_tracker_init(&ms[i], SarosOrderedByBirth[i], 3, 1000);
+        solar_phase_tracker_init_ns(&ns[i], SarosOrderedByBirth[i], (uint8_t)(i % SAROS_PHASE_MAX_DIGITS + 1u));
+    }
+    for (t = start - 86400; t < end + 86400; t += TEST_SWEEP_STEP * 97) {
+        calculate_solar_octal_phases(t, SarosOrderedByBirth, N, 2, got);
+        calculate_solar_octal_phases_ms(t * 1000 + 999, SarosOrderedByBirth, N, 3, got_ms);
+        saros_checks_add(4u * N);
+        for (i = 0; i < N; i++) {
+            const uint8_t  s    = SarosOrderedByBirth[i];
+            const uint64_t want = oracle_octal_phase(&oracle_solar, t, s, 2, 1);
+            const uint64_t wms  = oracle_octal_phase(&oracle_solar, t * 1000 + 999, s, 3, 1000);
+            if (got[i] != want)
+                bad += saros_check_fail("calculate_solar_octal_phases sweep", t, s);
+            if (got_ms[i] != wms)
+                bad += saros_check_fail("calculate_solar_octal_phases_ms sweep", t, s);
+            if (saros_phase_tracker_update(&sec[i], t) != want)
+                bad += saros_check_fail("saros_phase_tracker_update", t, s);
+            if (saros_phase_tracker_update(&ms[i], t * 1000 + 999) != wms)
+                bad += saros_check_fail("saros_phase_tracker_update (ms)", t, s);
+            if (t > INT64_MIN / SAROS_NS_PER_SECOND && t < INT64_MAX / SAROS_NS_PER_SECOND - 1) {
+                const int64_t  tn     = t * SAROS_NS_PER_SECOND + 999999999;
+                const unsigned digits = i % SAROS_PHASE_MAX_DIGITS + 1u;
+                saros_checks_add(2);
+                if (saros_phase_tracker_update(&ns[i], tn) != oracle_phase_ns(&oracle_solar, tn, s, 3u * digits))
+                    bad += saros_check_fail("saros_phase_tracker_update (ns)", tn, s);
+                if (saros_phase_tracker_phase(&ns[i], tn) != oracle_phase_ns(&oracle_solar, tn, s, 64u))
+                    bad += saros_check_fail("saros_phase_tracker_phase (ns)", tn, s);
+            }
+        }
+    }
+    return bad;
+}
+
+/* c written with saros_file_write() and read back into a malloc'd (so
+ * 8-byte aligned) buffer; NULL on failure. */
+static uint8_t *write_catalog(const oracle_catalog_t *c, size_t *size)
+{
+    const saros_db_t db = oracle_db(c);
+    uint8_t         *image = NULL;
+    FILE            *f;
+    long             n;
+
+    if (saros_file_write(TEST_FILE_PATH, &db) != SAROS_FILE_OK || !(f = fopen(TEST_FILE_PATH, "rb")))
+        return NULL;
+    if (fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0
+        && (image = (uint8_t *)malloc((size_t)n)) != NULL && fread(image, 1, (size_t)n, f) != (size_t)n) {
+        free(image);
+        image = NULL;
+    }
+    fclose(f);
+    remove(TEST_FILE_PATH);
+    *size = image ? (size_t)n : 0u;
+    return image;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void swap_bytes(uint8_t *a, uint8_t *b, size_t n)
+{
+    while (n--) {
+        const uint8_t t = *a;
+        *a++ = *b;
+        *b++ = t;
+    }
+}
+
+/* One corruption of a valid image per case.  Each must still open (open
+ * only reads the header), keep the searches on the corrupted series inside
+ * the tables, and fail saros_file_verify() with SAROS_FILE_ERR_FORMAT; the
+ * restored image must verify again. */
+static unsigned check_malformed(uint8_t *image, size_t size, const oracle_catalog_t *c)
+{
+    uint8_t     *times  = image + get32(image + 24);
+    uint8_t     *series = image + get32(image + 32);
+    uint8_t     *rec    = series;
+    uint8_t      saved[SAROS_RECORD_SIZE];
+    uint8_t      saved_times[16];
+    int64_t      members[SAROS_MAX_ECLIPSES];
+    saros_file_t f;
+    unsigned     bad = 0, k, i;
+    unsigned     s;
+    uint8_t      n;
+
+    for (s = c->saros_first; s < c->saros_last && rec[0] < 2u; s++)
+        rec += SAROS_RECORD_SIZE;
+    if (rec[0] < 2u)
+        return saros_check_fail("no series with two members", 0, 0);
+    memcpy(saved, rec, sizeof(saved));
+    memcpy(saved_times, times, sizeof(saved_times));
+
+    for (k = 0; k < 4; k++) {
+        switch (k) {
+        case 0: rec[0] = 0xFFu; break;
+        case 1: rec[2] = 0xFFu; rec[3] = 0xFFu; break;
+        case 2: swap_bytes(rec + 2, rec + 4, 2); break;
+        case 3: swap_bytes(times, times + 8, 8); break;
+        }
+        saros_checks_add(3);
+        if (saros_file_open_memory(&f, image, size) != SAROS_FILE_OK) {
+            bad += saros_check_fail("corrupt records rejected at open", (int64_t)k, (uint8_t)s);
+        } else {
+            saros_db_series(&f.db, (uint8_t)s, members, &n);
+            for (i = 0; i < n; i++) {
+                if (oracle_find_next(c, members[i]).eclipse.unix_time != members[i])
+                    break;
+            }
+            if (n > SAROS_MAX_ECLIPSES || saros_db_series_count(&f.db, (uint8_t)s) != n || i < n)
+                bad += saros_check_fail("corrupt series read outside the tables", (int64_t)k, (uint8_t)s);
+            if (saros_file_verify(&f) != SAROS_FILE_ERR_FORMAT)
+                bad += saros_check_fail("malformed catalog file verified", (int64_t)k, (uint8_t)s);
+        }
+        saros_file_close(&f);
+        memcpy(rec, saved, sizeof(saved));
+        memcpy(times, saved_times, sizeof(saved_times));
+    }
+    saros_checks_add(1);
+    if (saros_file_open_memory(&f, image, size) != SAROS_FILE_OK || saros_file_verify(&f) != SAROS_FILE_OK)
+        bad += saros_check_fail("restored catalog file rejected", 0, 0);
+    saros_file_close(&f);
+    return bad;
+}
+
+/* saros_db_range() on a file-backed db against successive oracle finds:
+ * every eclipse with t0 <= unix_time <= t1, in time order. */
+static unsigned check_range(const saros_db_t *db, const oracle_catalog_t *c, int64_t t0, int64_t t1)
+{
+    saros_range_t    it;
+    eclipse_entry_t  e;
+    eclipse_result_t want = oracle_find_next(c, t0);
+    unsigned         bad = 0;
+
+    saros_db_range(&it, db, t0, t1, NULL);
+    while (saros_range_next(&it, &e)) {
+        saros_checks_add(1);
+        if (!want.eclipse.valid || want.eclipse.unix_time > t1 || !saros_entry_equal(&e, &want.eclipse, c->is_lunar))
+            return bad + saros_check_fail("saros_db_range (file)", e.unix_time, 0);
+        want = oracle_find_next(c, e.unix_time + 1);
+    }
+    saros_checks_add(1);
+    if (want.eclipse.valid && want.eclipse.unix_time <= t1)
+        bad += saros_check_fail("saros_db_range (file) ended early", want.eclipse.unix_time, 0);
+    return bad;
+}
+
+/* Both catalogs through saros_file_write() / saros_file_open_memory(). */
+static unsigned test_files(void)
+{
+    const oracle_catalog_t *cats[2] = { &oracle_solar, &oracle_lunar };
+    uint8_t                *image[2];
+    size_t                  size[2];
+    saros_file_t            f[2];
+    const saros_db_t       *both[2];
+    const int64_t           first = oracle_find_next(&oracle_lunar, INT64_MIN).eclipse.unix_time;
+    const int64_t           last  = oracle_find_past(&oracle_lunar, INT64_MAX).eclipse.unix_time;
+    unsigned                bad = 0, i, k;
+
+    for (k = 0; k < 2; k++) {
+        image[k] = write_catalog(cats[k], &size[k]);
+        if (!image[k] || saros_file_open_memory(&f[k], image[k], size[k]) != SAROS_FILE_OK
+            || saros_file_verify(&f[k]) != SAROS_FILE_OK)
+            return saros_check_fail("catalog file round trip", 0, 0);
+        both[k] = &f[k].db;
+    }
+
+    for (k = 0; k < 2; k++) {
+        const int64_t a = oracle_find_next(cats[k], first).eclipse.unix_time;
+        const int64_t b = oracle_find_past(cats[k], last).eclipse.unix_time;
+        /* Whole catalog, then both ends exactly on eclipses (inclusive). */
+        bad += check_range(both[k], cats[k], INT64_MIN, INT64_MAX);
+        bad += check_range(both[k], cats[k], a, b);
+        bad += check_range(both[k], cats[k], a + 1, b - 1);
+        for (i = 0; i < 64; i++) {
+            const int64_t t0 = first + (int64_t)(next_random() % (uint64_t)(last - first));
+            bad += check_range(both[k], cats[k], t0, t0 + (int64_t)(next_random() % 315576000u));
+        }
+    }
+
+    for (i = 0; i < 4096; i++) {
+        const int64_t    t  = first - 86400 + (int64_t)(next_random() % (uint64_t)(last - first + 172800));
+        const eclipse_result_t sn = oracle_find_next(&oracle_solar, t), ln = oracle_find_next(&oracle_lunar, t);
+        const eclipse_result_t sp = oracle_find_past(&oracle_solar, t), lp = oracle_find_past(&oracle_lunar, t);
+        /* Earliest catalog wins ties. */
+        const unsigned   wn = !sn.eclipse.valid || (ln.eclipse.valid && ln.eclipse.unix_time < sn.eclipse.unix_time);
+        const unsigned   wp = !sp.eclipse.valid || (lp.eclipse.valid && lp.eclipse.unix_time > sp.eclipse.unix_time);
+        eclipse_result_t r;
+        uint8_t          which;
+
+        saros_checks_add(2);
+        r = saros_db_find_next_any(both, 2, t, &which);
+        if (which != wn || !saros_entry_equal(&r.eclipse, wn ? &ln.eclipse : &sn.eclipse, (int)wn))
+            bad += saros_check_fail("saros_db_find_next_any (file)", t, 0);
+        r = saros_db_find_past_any(both, 2, t, &which);
+        if (which != wp || !saros_entry_equal(&r.eclipse, wp ? &lp.eclipse : &sp.eclipse, (int)wp))
+            bad += saros_check_fail("saros_db_find_past_any (file)", t, 0);
+    }
+
+    for (k = 0; k < 2; k++) {
+        saros_file_close(&f[k]);
+        bad += check_malformed(image[k], size[k], cats[k]);
+        free(image[k]);
+    }
+    return bad;
+}
+
+/* Trackers exactly at the closing eclipse of each window of the alive
+ * series.  Seconds and milliseconds include that key in the window, so
+ * the phase saturates there and the next key opens the next window;
+ * full phases are compared with the oracle where nanoseconds fit. */
+static unsigned test_window_ends(void)
+{
+    const int64_t ns = SAROS_NS_PER_SECOND;
+    unsigned      bad = 0, i;
+
+    for (i = 0; i < ALIVE_SAROS_COUNT; i++) {
+        const uint8_t         s = SarosOrderedByBirth[i];
+        int64_t               times[SAROS_MAX_ECLIPSES];
+        const uint8_t         n = oracle_series(&oracle_solar, s, times);
+        saros_phase_tracker_t sec, ms;
+        unsigned              k, j;
+
+        solar_phase_tracker_init(&sec, s, 2, 1);
+        solar_phase_tracker_init(&ms, s, 3, 1000);
+        for (k = 1; k < n; k++) {
+            const int64_t end = times[k];
+            /* Milliseconds truncate toward zero: the key of end runs from lo
+             * to lo + 999, and the phase saturates from end * 1000 on. */
+            const int64_t lo  = end >= 0 ? end * 1000 : end * 1000 - 999;
+            const int     fit = end > 0 && end < INT64_MAX / ns - 2;
+
+            saros_checks_add(8);
+            if (saros_phase_tracker_phase(&sec, end) != UINT64_MAX)
+                bad += saros_check_fail("saros_phase_tracker_phase at window end", end, s);
+            if (saros_phase_tracker_update(&sec, end) != oracle_octal_phase(&oracle_solar, end, s, 2, 1))
+                bad += saros_check_fail("saros_phase_tracker_update at window end", end, s);
+            if (fit && k + 1 < n
+                && saros_phase_tracker_phase(&sec, end + 1) != oracle_phase_ns(&oracle_solar, (end + 1) * ns, s, 64u))
+                bad += saros_check_fail("saros_phase_tracker_phase after window end", end + 1, s);
+            if (fit && saros_phase_tracker_phase(&ms, lo - 1)
+                           != oracle_phase_ns(&oracle_solar, (end - 1) * ns + 999000000, s, 64u))
+                bad += saros_check_fail("saros_phase_tracker_phase (ms) before window end", lo - 1, s);
+            for (j = 0; j < 2; j++) {
+                const int64_t t = j ? lo + 999 : end * 1000;
+                if (saros_phase_tracker_phase(&ms, t) != UINT64_MAX)
+                    bad += saros_check_fail("saros_phase_tracker_phase (ms) at window end", t, s);
+                if (saros_phase_tracker_update(&ms, t) != oracle_octal_phase(&oracle_solar, t, s, 3, 1000))
+                    bad += saros_check_fail("saros_phase_tracker_update (ms) at window end", t, s);
+            }
+        }
+    }
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned samples = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : TEST_RANDOM_SAMPLES;
+    unsigned       bad;
+
+    oracle_init();
+
+#define RUN(name, call)                                                            \
+    do {                                                                           \
+        bad = (call);                                                              \
+        printf("%-12s %s (%lu checks so far)\n", name, bad ? "FAIL" : "ok",        \
+               saros_checks_run());                                                \
+        if (bad)                                                                   \
+            return 1;                                                              \
+    } while (0)
+
+    RUN("tables", saros_check_tables());
+    RUN("boundaries", test_boundaries());
+    RUN("random", test_random(samples));
+    RUN("batch find", test_batch_find());
+    RUN("sweeps", test_sweeps());
+    RUN("window ends", test_window_ends());
+    RUN("files", test_files());
+#undef RUN
+    return 0;
+}
@@ -8,6 +8,7 @@ Fractonica::WifiClock wifiClock("RT-GPON-7", "857010486557");
 
 uint64_t lastSync = 0;
 int sarosNumber = 141;
+saros_phase_tracker_t phaseTracker;
 
 static const uint8_t DIGITS[4][8] = {
     //   0           1           2            3           4           5          6             7
@@ -22,6 +23,7 @@ void setup()
     face.begin();
     wifiClock.begin();
     wifiClock.update();
+    solar_phase_tracker_init(&phaseTracker, sarosNumber, 2, 1);
 }
 
 void loop()
@@ -31,7 +33,13 @@ void loop()
         wifiClock.update();
         lastSync = millis();
     }
-    int64_t phase = calculate_solar_octal_phase(wifiClock.now(), sarosNumber, 2);
+    const int64_t now = wifiClock.now();
+    int64_t phase = saros_phase_tracker_update(&phaseTracker, now);
     face.setValue(phase, DIGITS);
-    delay(1000);
+
+    // Sleep until the digit changes, but wake at least once a minute for the sync.
+    int64_t wait = phaseTracker.next_change - now;
+    if (wait < 1) wait = 1;
+    if (wait > 60) wait = 60;
+    delay(static_cast<uint32_t>(wait) * 1000);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <OctalGlyph.h>
 #include "SSD1306Display.h"
 #include "saros.h"
+#include "SarosPhaseSnapshot.h"
 #include "RotaryEncoder.h"
 #include "WifiClock.h"
 #include "EventLogger.h"
@@ -36,6 +37,8 @@ RotaryEncoder encoder(ENCODER_PIN_IN1, ENCODER_PIN_IN2, RotaryEncoder::LatchMode
 volatile int saros = 141;
 volatile uint64_t sarosNumDisplayTime = 0;
 volatile uint64_t prevBin = 0;
+// Bins of every alive series, so turning the encoder never waits for a search
+Fractonica::SarosPhaseSnapshot<ALIVE_SAROS_COUNT, 1> phases;
 
 #define DEBOUNCE_BTN(pin, debounce_ms) \
     ([]() -> bool {                                                 \
@@ -122,6 +125,9 @@ void setup()
 
     glyph_settings.showBorder = false;
 
+    static constexpr uint8_t glyphResolution[] = { 2 };
+    phases.Configure(SarosOrderedByBirth, ALIVE_SAROS_COUNT, glyphResolution, 1, 1, false, wifiClock.now());
+
     if (sdcard.begin())
     {
         if (!recorder.begin())
@@ -141,7 +147,9 @@ void loop()
 {
     wifiClock.update();
 
-    uint64_t bin = calculate_solar_octal_phase(wifiClock.now(), saros, 2);
+    phases.Update(wifiClock.now());
+    uint64_t bin = 0;
+    phases.TryGet(saros, 0, bin);
 
     if (prevBin != bin) {
         display.clear();
@@ -0,0 +1,212 @@
+#ifndef ALIGNMENT_BATCH_HPP
+#define ALIGNMENT_BATCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../cspice/include/SpiceUsr.h"
+}
+
+#include "leap_seconds.hpp"
+#include "moon.hpp"
+
+namespace cspice_utils {
+
+    // Fill ls from the kernel pool; false if no leap-seconds kernel is loaded.
+    inline bool load_leap_seconds(LeapSeconds &ls) {
+        SpiceInt n = 0;
+        SpiceBoolean found = SPICEFALSE;
+        SpiceDouble m[2] = {};
+        SpiceDouble pairs[2 * 128] = {};
+
+        gdpool_c("DELTET/DELTA_AT", 0, 2 * 128, &n, pairs, &found);
+        if (!found || n < 2) return false;
+        ls.starts.clear();
+        ls.delta_at.clear();
+        for (SpiceInt i = 0; i + 1 < n; i += 2) {
+            ls.delta_at.push_back(pairs[i]);
+            ls.starts.push_back(pairs[i + 1]);
+        }
+        gdpool_c("DELTET/DELTA_T_A", 0, 1, &n, &ls.delta_t_a, &found);
+        gdpool_c("DELTET/K", 0, 1, &n, &ls.k, &found);
+        gdpool_c("DELTET/EB", 0, 1, &n, &ls.eb, &found);
+        gdpool_c("DELTET/M", 0, 2, &n, m, &found);
+        ls.m0 = m[0];
+        ls.m1 = m[1];
+        return !failed_c();
+    }
+} // namespace cspice_utils
+
+namespace moon {
+
+    // Kernels and leap seconds loaded once, for the batch calls below.
+    struct AlignmentContext {
+        cspice_utils::LeapSeconds leap_seconds;
+        std::string kernel_dir;  // kernels loaded by init_alignment_context()
+        bool ready = false;
+        std::string error;
+    };
+
+    // CSPICE is not thread-safe: its kernel pool, SPK buffers and error
+    // state are process-wide, so every SPICE call goes through this lock.
+    inline std::mutex &spice_mutex() {
+        static std::mutex m;
+        return m;
+    }
+
+    // SPICE errors as "return and flag, print nothing" for the life of the
+    // scope, so a batch can report them; the caller's error action and
+    // print selection come back on exit.  The settings are process-wide:
+    // hold spice_mutex() across the scope, and reset_c() any failure
+    // before it ends.
+    class SpiceErrorScope {
+    public:
+        SpiceErrorScope() {
+            SpiceChar action[] = "RETURN";
+            SpiceChar report[] = "NONE";
+
+            erract_c("GET", sizeof(action_), action_);
+            errprt_c("GET", sizeof(report_), report_);
+            erract_c("SET", 0, action);
+            errprt_c("SET", 0, report);
+        }
+
+        ~SpiceErrorScope() {
+            // "SET" only switches on what it lists, so clear first
+            std::string report = report_[0] ? std::string("NONE, ") + report_ : "NONE";
+            erract_c("SET", 0, action_);
+            errprt_c("SET", 0, report.data());
+        }
+
+        SpiceErrorScope(const SpiceErrorScope &) = delete;
+        SpiceErrorScope &operator=(const SpiceErrorScope &) = delete;
+
+    private:
+        SpiceChar action_[32] = {};
+        SpiceChar report_[256] = {};
+    };
+
+    // Load the kernels in kernel_dir (through init() for the default
+    // directory) and cache the leap-seconds table.  SPICE errors are
+    // caught (SpiceErrorScope) and reported in ctx.error.
+    inline bool init_alignment_context(AlignmentContext &ctx,
+                                       const std::string &kernel_dir = rootDir() + "/kernels") {
+        std::lock_guard<std::mutex> lock(spice_mutex());
+        SpiceErrorScope errors;
+
+        if (kernel_dir == rootDir() + "/kernels") init();
+        else load_kernels_from_path(kernel_dir);
+        ctx.kernel_dir = kernel_dir;
+        ctx.ready = !failed_c() && cspice_utils::load_leap_seconds(ctx.leap_seconds);
+        if (!ctx.ready) {
+            SpiceChar msg[1841] = {};
+            getmsg_c("LONG", sizeof(msg), msg);
+            ctx.error = msg[0] ? msg : "leap-seconds kernel not loaded";
+            reset_c();
+        }
+        return ctx.ready;
+    }
+
+    // Outcome of a batch: samples that SPICE could not evaluate are NaN.
+    struct AlignmentBatchStatus {
+        size_t failed = 0;
+        std::string first_error;  // SPICE long message of the first failure
+    };
+
+    namespace detail {
+        inline double norm(const SpiceDouble v[3]) {
+            return std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        }
+
+        inline UnitVector unit(const SpiceDouble v[3]) {
+            const double r = norm(v);
+            return {v[0] / r, v[1] / r, v[2] / r};
+        }
+
+        inline double separation_deg(const UnitVector &a, const UnitVector &b) {
+            const double cx = a.y * b.z - a.z * b.y;
+            const double cy = a.z * b.x - a.x * b.z;
+            const double cz = a.x * b.y - a.y * b.x;
+            return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), a.x * b.x + a.y * b.y + a.z * b.z)
+                   * (180.0 / 3.14159265358979323846);
+        }
+
+        // Samples per lock hold: long enough to amortise the lock, short
+        // enough that an error is pinned to a small range.
+        constexpr size_t alignment_chunk = 512;
+
+        inline void alignment_range(const AlignmentContext &ctx, const double *unix_seconds,
+                                    const size_t begin, const size_t end, AlignmentData *out,
+                                    double *sun_km, double *moon_km, AlignmentBatchStatus &status) {
+            constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+            SpiceDouble et[alignment_chunk];
+            SpiceDouble sun[alignment_chunk][3], moon[alignment_chunk][3];
+            SpiceBoolean ok[alignment_chunk];
+
+            for (size_t at = begin; at < end; at += alignment_chunk) {
+                const size_t n = std::min(alignment_chunk, end - at);
+                for (size_t i = 0; i < n; ++i) et[i] = ctx.leap_seconds.unix_to_et(unix_seconds[at + i]);
+                {
+                    std::lock_guard<std::mutex> lock(spice_mutex());
+                    SpiceErrorScope errors;
+                    SpiceDouble lt;
+                    for (size_t i = 0; i < n; ++i) {
+                        // Integer ids skip the name lookups of spkpos_c
+                        spkezp_c(10, et[i], "J2000", "LT+S", 399, sun[i], &lt);
+                        spkezp_c(301, et[i], "J2000", "LT+S", 399, moon[i], &lt);
+                        ok[i] = !failed_c();
+                        if (!ok[i]) {
+                            if (status.failed++ == 0) {
+                                SpiceChar msg[1841] = {};
+                                getmsg_c("LONG", sizeof(msg), msg);
+                                status.first_error = msg;
+                            }
+                            reset_c();
+                        }
+                    }
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    if (!ok[i]) {
+                        out[at + i] = {{nan, nan, nan}, {nan, nan, nan}, nan};
+                        if (sun_km) sun_km[at + i] = nan;
+                        if (moon_km) moon_km[at + i] = nan;
+                        continue;
+                    }
+                    const UnitVector s = unit(sun[i]), m = unit(moon[i]);
+                    out[at + i] = {s, m, separation_deg(s, m)};
+                    if (sun_km) sun_km[at + i] = norm(sun[i]);
+                    if (moon_km) moon_km[at + i] = norm(moon[i]);
+                }
+            }
+        }
+    } // namespace detail
+
+    // get_eclipse_alignment() for unix_seconds[0..count), without per-call
+    // init() or string time conversions.  Runs on the calling thread:
+    // CSPICE's kernel pool, SPK buffers and error state are per process,
+    // so threads could only take turns on spice_mutex() (parallel runs
+    // need processes, as in event_search.hpp).  sun_km / moon_km, if
+    // given, receive the apparent Earth-Sun and Earth-Moon distances.
+    inline AlignmentBatchStatus get_eclipse_alignments(const AlignmentContext &ctx,
+                                                       const double *unix_seconds, const size_t count,
+                                                       AlignmentData *out, double *sun_km = nullptr,
+                                                       double *moon_km = nullptr) {
+        AlignmentBatchStatus status;
+        if (!ctx.ready) {
+            status.failed = count;
+            status.first_error = ctx.error.empty() ? "alignment context not initialised" : ctx.error;
+            return status;
+        }
+        detail::alignment_range(ctx, unix_seconds, 0, count, out, sun_km, moon_km, status);
+        return status;
+    }
+} // namespace moon
+
+#endif // ALIGNMENT_BATCH_HPP
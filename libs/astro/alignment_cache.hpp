@@ -0,0 +1,419 @@
+#ifndef ALIGNMENT_CACHE_HPP
+#define ALIGNMENT_CACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define ALIGNMENT_CACHE_READ_ONLY  // no mmap: the file is read into memory
+#include <process.h>               // _getpid
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "alignment_batch.hpp"
+
+namespace moon {
+
+    // Sun/Moon alignment sampled on a regular grid t0 + i * step (unix
+    // seconds), cached on disk so that repeat launches and repeat plots
+    // skip SPICE entirely.
+    //
+    // Cache files are content-addressed: the name is the key, a hash of
+    // the kernel files' contents (kernel_files in kernels.hpp), the
+    // aberration correction and the grid.  Replacing a kernel changes the
+    // key, so stale grids are never read; they are just left behind.
+    // The kernels' hashes are kept beside the grids (kernels.memo, keyed
+    // by path, size and mtime), so a warm launch stats each kernel instead
+    // of rereading it.
+    //
+    // File layout, native byte order (the cache is local to the machine):
+    //   AlignmentCacheHeader (64 bytes)
+    //   alignment_column_count columns of count doubles, in AlignmentColumn order
+    // The columns are mmapped and read in place.
+
+    enum AlignmentColumn : uint32_t {
+        column_et,          // TDB seconds past J2000
+        column_sun_x, column_sun_y, column_sun_z,
+        column_moon_x, column_moon_y, column_moon_z,
+        column_angle_deg,   // AlignmentData::phase_angle_deg
+        column_sun_km,      // apparent Earth-Sun distance
+        column_moon_km,     // apparent Earth-Moon distance
+        alignment_column_count
+    };
+
+    struct AlignmentCacheHeader {
+        char magic[8];      // "FRALIGN" + format version
+        uint64_t key;
+        int64_t t0;
+        int64_t step;
+        uint64_t count;
+        uint32_t columns;
+        uint32_t reserved;
+        uint64_t padding[2];
+    };
+    static_assert(sizeof(AlignmentCacheHeader) == 64, "cache header must stay 64 bytes");
+
+    inline constexpr char alignment_cache_magic[8] = {'F', 'R', 'A', 'L', 'I', 'G', 'N', 1};
+
+    struct AlignmentGrid {
+        int64_t t0 = 0;
+        int64_t step = 0;
+        size_t count = 0;
+        const double *column[alignment_column_count] = {};
+        bool from_cache = false;    // true if no SPICE call was made
+
+        AlignmentGrid() = default;
+        AlignmentGrid(const AlignmentGrid &) = delete;
+        AlignmentGrid &operator=(const AlignmentGrid &) = delete;
+        ~AlignmentGrid() { release(); }
+
+        [[nodiscard]] int64_t unix_time(const size_t i) const { return t0 + static_cast<int64_t>(i) * step; }
+
+        [[nodiscard]] AlignmentData alignment(const size_t i) const {
+            return {
+                {column[column_sun_x][i], column[column_sun_y][i], column[column_sun_z][i]},
+                {column[column_moon_x][i], column[column_moon_y][i], column[column_moon_z][i]},
+                column[column_angle_deg][i]
+            };
+        }
+
+        void release() {
+#ifndef ALIGNMENT_CACHE_READ_ONLY
+            if (map) munmap(map, map_size);
+#endif
+            map = nullptr;
+            map_size = 0;
+            storage.clear();
+            storage.shrink_to_fit();
+            std::fill(std::begin(column), std::end(column), nullptr);
+            count = 0;
+            from_cache = false;
+        }
+
+        void *map = nullptr;
+        size_t map_size = 0;
+        std::vector<double> storage;    // computed or read-in columns
+    };
+
+    namespace detail {
+        // 64-bit FNV-1a over 8-byte words: not cryptographic, only has to
+        // tell kernel versions apart, and runs ~8x faster than per byte
+        // over a 100 MB SPK.
+        constexpr uint64_t fnv_offset = 14695981039346656037ull;
+        constexpr uint64_t fnv_prime = 1099511628211ull;
+
+        inline uint64_t hash_bytes(uint64_t h, const unsigned char *p, size_t n) {
+            for (; n >= 8; p += 8, n -= 8) {
+                uint64_t w;
+                std::memcpy(&w, p, 8);
+                h = (h ^ w) * fnv_prime;
+            }
+            for (; n; ++p, --n) h = (h ^ *p) * fnv_prime;
+            return h;
+        }
+
+        template<typename T>
+        inline uint64_t hash_value(const uint64_t h, const T &v) {
+            return hash_bytes(h, reinterpret_cast<const unsigned char *>(&v), sizeof(v));
+        }
+
+        inline bool hash_file_contents(const std::string &path, uint64_t &out) {
+            FILE *f = std::fopen(path.c_str(), "rb");
+            if (!f) return false;
+            std::vector<unsigned char> buf(1 << 16);
+            uint64_t h = fnv_offset, size = 0;
+            size_t n;
+            while ((n = std::fread(buf.data(), 1, buf.size(), f)) > 0) {
+                // Reads are whole words except the last, so only the tail goes per byte
+                h = hash_bytes(h, buf.data(), n);
+                size += n;
+            }
+            const bool ok = !std::ferror(f);
+            std::fclose(f);
+            out = hash_value(h, size);
+            return ok;
+        }
+
+        // Unique temporary name next to path: the pid keeps processes
+        // writing the same file apart, the counter threads.
+        inline std::string temp_path(const std::string &path) {
+            static std::atomic<unsigned> counter{0};
+#if defined(_WIN32)
+            const long pid = _getpid();
+#else
+            const long pid = static_cast<long>(::getpid());
+#endif
+            return path + "." + std::to_string(pid) + "." + std::to_string(counter.fetch_add(1)) + ".tmp";
+        }
+
+        // Content hashes of kernels by path, valid while the size and
+        // mtime still match.  Kept for the session and, per cache
+        // directory, in kernel_memo_name, so a warm launch only stats each
+        // kernel instead of rereading it.
+        struct KernelHashEntry {
+            std::uintmax_t size;
+            long long mtime;    // file_time_type ticks
+            uint64_t hash;
+        };
+
+        struct KernelHashMemo {
+            std::mutex mutex;
+            std::map<std::string, KernelHashEntry> entries;
+            std::set<std::string> loaded;   // memo files already merged
+        };
+
+        inline constexpr char kernel_memo_name[] = "kernels.memo";
+
+        inline KernelHashMemo &kernel_hash_memo() {
+            static KernelHashMemo memo;
+            return memo;
+        }
+
+        // One "hash size mtime path" line per kernel.  Entries the session
+        // already has win; the rest only count if size and mtime match.
+        inline void read_kernel_memo(const std::string &file, std::map<std::string, KernelHashEntry> &entries) {
+            FILE *f = std::fopen(file.c_str(), "r");
+            if (!f) return;
+            char line[4096];
+            while (std::fgets(line, sizeof(line), f)) {
+                unsigned long long hash, size;
+                long long mtime;
+                int at = 0;
+                if (std::sscanf(line, "%llx %llu %lld %n", &hash, &size, &mtime, &at) != 3 || !at) continue;
+                std::string path(line + at);
+                while (!path.empty() && (path.back() == '\n' || path.back() == '\r')) path.pop_back();
+                if (!path.empty()) entries.emplace(path, KernelHashEntry{size, mtime, hash});
+            }
+            std::fclose(f);
+        }
+
+        inline bool write_kernel_memo(const std::string &file, const std::map<std::string, KernelHashEntry> &entries) {
+            const std::string tmp = temp_path(file);
+            FILE *f = std::fopen(tmp.c_str(), "w");
+            if (!f) return false;
+            bool ok = true;
+            for (const auto &[path, e] : entries)
+                ok = std::fprintf(f, "%016llx %llu %lld %s\n", static_cast<unsigned long long>(e.hash),
+                                  static_cast<unsigned long long>(e.size), e.mtime, path.c_str()) > 0 && ok;
+            ok = (std::fclose(f) == 0) && ok;
+            std::error_code ec;
+            if (ok) std::filesystem::rename(tmp, file, ec);
+            if (!ok || ec) std::filesystem::remove(tmp, ec);
+            return ok && !ec;
+        }
+
+        // Content hash of a kernel from entries, or hashed and added
+        // (changed set) if its size or mtime no longer match.
+        inline bool kernel_hash(const std::string &path, uint64_t &out,
+                                std::map<std::string, KernelHashEntry> &entries, bool &changed) {
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(path, ec);
+            if (ec) return false;
+            const auto mtime = static_cast<long long>(std::filesystem::last_write_time(path, ec)
+                                                          .time_since_epoch().count());
+            if (ec) return false;
+
+            const auto it = entries.find(path);
+            if (it != entries.end() && it->second.size == size && it->second.mtime == mtime) {
+                out = it->second.hash;
+                return true;
+            }
+            if (!hash_file_contents(path, out)) return false;
+            entries[path] = {size, mtime, out};
+            changed = true;
+            return true;
+        }
+
+        inline void set_columns(AlignmentGrid &grid, const double *base) {
+            for (uint32_t c = 0; c < alignment_column_count; ++c) grid.column[c] = base + c * grid.count;
+        }
+    } // namespace detail
+
+    // Cache key of a grid computed with the kernels in kernel_dir; false
+    // if one of them cannot be read.  The kernels' content hashes are
+    // remembered for the session and, if cache_dir is given, in its
+    // kernel memo (detail::KernelHashMemo).
+    inline bool alignment_cache_key(const std::string &kernel_dir, const int64_t t0, const int64_t step,
+                                    const size_t count, uint64_t &key, const std::string &cache_dir = {}) {
+        uint64_t h = detail::hash_bytes(detail::fnv_offset,
+                                        reinterpret_cast<const unsigned char *>(alignment_cache_magic), 8);
+        {
+            detail::KernelHashMemo &memo = detail::kernel_hash_memo();
+            std::lock_guard<std::mutex> lock(memo.mutex);
+            const std::string memo_file = cache_dir.empty() ? std::string()
+                                                            : cache_dir + "/" + detail::kernel_memo_name;
+            if (!memo_file.empty() && memo.loaded.insert(memo_file).second)
+                detail::read_kernel_memo(memo_file, memo.entries);
+
+            bool changed = false;
+            for (const char *file : kernel_files) {
+                uint64_t k;
+                std::error_code ec;
+                const auto path = std::filesystem::absolute(kernel_dir + "/" + file, ec);
+                if (ec || !detail::kernel_hash(path.string(), k, memo.entries, changed)) return false;
+                h = detail::hash_value(h, k);
+            }
+            if (changed && !memo_file.empty()) {
+                std::error_code ec;
+                std::filesystem::create_directories(cache_dir, ec);
+                detail::write_kernel_memo(memo_file, memo.entries);
+            }
+        }
+        h = detail::hash_bytes(h, reinterpret_cast<const unsigned char *>("J2000 LT+S"), 10);
+        h = detail::hash_value(h, t0);
+        h = detail::hash_value(h, step);
+        key = detail::hash_value(h, static_cast<uint64_t>(count));
+        return true;
+    }
+
+    inline std::string alignment_cache_file(const std::string &cache_dir, const uint64_t key) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.align", static_cast<unsigned long long>(key));
+        return cache_dir + "/" + name;
+    }
+
+    // Map a cache file into grid if it holds exactly this key and grid.
+    inline bool open_alignment_cache(AlignmentGrid &grid, const std::string &path, const uint64_t key,
+                                     const int64_t t0, const int64_t step, const size_t count) {
+        const size_t data_size = sizeof(double) * alignment_column_count * count;
+        const size_t file_size = sizeof(AlignmentCacheHeader) + data_size;
+        AlignmentCacheHeader header{};
+
+        grid.release();
+#ifdef ALIGNMENT_CACHE_READ_ONLY
+        FILE *f = std::fopen(path.c_str(), "rb");
+        if (!f) return false;
+        bool ok = std::fread(&header, sizeof(header), 1, f) == 1;
+        if (ok) {
+            grid.storage.resize(alignment_column_count * count);
+            ok = std::fread(grid.storage.data(), 1, data_size, f) == data_size;
+        }
+        std::fclose(f);
+        const double *base = grid.storage.data();
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st{};
+        bool ok = ::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == file_size;
+        void *map = ok ? ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        ok = map != MAP_FAILED;
+        if (ok) {
+            grid.map = map;
+            grid.map_size = file_size;
+            std::memcpy(&header, map, sizeof(header));
+        }
+        const double *base = ok ? reinterpret_cast<const double *>(static_cast<const char *>(map)
+                                                                  + sizeof(AlignmentCacheHeader)) : nullptr;
+#endif
+        ok = ok && std::memcmp(header.magic, alignment_cache_magic, 8) == 0 && header.key == key
+             && header.t0 == t0 && header.step == step && header.count == count
+             && header.columns == alignment_column_count;
+        if (!ok) {
+            grid.release();
+            return false;
+        }
+        grid.t0 = t0;
+        grid.step = step;
+        grid.count = count;
+        detail::set_columns(grid, base);
+        grid.from_cache = true;
+        return true;
+    }
+
+    // Write grid to path through a temporary file (unique per process
+    // and call) and a rename, so a concurrent reader never sees a partial
+    // file and concurrent writers of the same key never share one.
+    inline bool write_alignment_cache(const AlignmentGrid &grid, const std::string &path, const uint64_t key) {
+        AlignmentCacheHeader header{};
+        std::memcpy(header.magic, alignment_cache_magic, 8);
+        header.key = key;
+        header.t0 = grid.t0;
+        header.step = grid.step;
+        header.count = grid.count;
+        header.columns = alignment_column_count;
+
+        const std::string tmp = detail::temp_path(path);
+        FILE *f = std::fopen(tmp.c_str(), "wb");
+        if (!f) return false;
+        bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+        for (uint32_t c = 0; ok && c < alignment_column_count; ++c) {
+            ok = std::fwrite(grid.column[c], sizeof(double), grid.count, f) == grid.count;
+        }
+        ok = (std::fclose(f) == 0) && ok;
+        std::error_code ec;
+        if (ok) std::filesystem::rename(tmp, path, ec);
+        if (!ok || ec) std::filesystem::remove(tmp, ec);
+        return ok && !ec;
+    }
+
+    // Alignment at t0 + i * step for i < count, from cache_dir if this
+    // grid was computed before with the same kernels, otherwise from
+    // SPICE (get_eclipse_alignments(), initialising ctx from kernel_dir
+    // unless it already uses those kernels, so the grid matches its key)
+    // and then stored in cache_dir.  A cache that cannot be written only
+    // costs the next launch a recompute.  Returns false if the grid is
+    // neither cached nor computable; samples SPICE failed on are NaN and
+    // are not cached.
+    inline bool load_alignment_grid(AlignmentGrid &grid, AlignmentContext &ctx, const std::string &cache_dir,
+                                    const int64_t t0, const int64_t step, const size_t count,
+                                    const std::string &kernel_dir = rootDir() + "/kernels") {
+        uint64_t key = 0;
+        const bool keyed = alignment_cache_key(kernel_dir, t0, step, count, key, cache_dir);
+        const std::string path = keyed ? alignment_cache_file(cache_dir, key) : std::string();
+
+        if (keyed && open_alignment_cache(grid, path, key, t0, step, count)) return true;
+        if ((!ctx.ready || ctx.kernel_dir != kernel_dir) && !init_alignment_context(ctx, kernel_dir))
+            return false;
+
+        grid.release();
+        grid.t0 = t0;
+        grid.step = step;
+        grid.count = count;
+        grid.storage.resize(alignment_column_count * count);
+        detail::set_columns(grid, grid.storage.data());
+
+        std::vector<double> unix_seconds(count);
+        std::vector<AlignmentData> samples(count);
+        for (size_t i = 0; i < count; ++i) unix_seconds[i] = static_cast<double>(grid.unix_time(i));
+        double *col = grid.storage.data();
+        const AlignmentBatchStatus status = get_eclipse_alignments(
+            ctx, unix_seconds.data(), count, samples.data(),
+            col + column_sun_km * count, col + column_moon_km * count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const AlignmentData &a = samples[i];
+            col[column_et * count + i] = ctx.leap_seconds.unix_to_et(unix_seconds[i]);
+            col[column_sun_x * count + i] = a.sun_direction.x;
+            col[column_sun_y * count + i] = a.sun_direction.y;
+            col[column_sun_z * count + i] = a.sun_direction.z;
+            col[column_moon_x * count + i] = a.moon_direction.x;
+            col[column_moon_y * count + i] = a.moon_direction.y;
+            col[column_moon_z * count + i] = a.moon_direction.z;
+            col[column_angle_deg * count + i] = a.phase_angle_deg;
+        }
+
+        if (keyed && status.failed == 0) {
+            std::error_code ec;
+            std::filesystem::create_directories(cache_dir, ec);
+            write_alignment_cache(grid, path, key);
+        }
+        return true;
+    }
+} // namespace moon
+
+#endif // ALIGNMENT_CACHE_HPP
@@ -0,0 +1,98 @@
+#ifndef EVENT_GENERATOR_HPP
+#define EVENT_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+extern "C" {
+#include "../cspice/include/SpiceUsr.h"
+}
+
+#include "alignment_batch.hpp"
+#include "event_search.hpp"
+
+namespace moon {
+
+    // event_search.hpp with the loaded kernels as the geometry source:
+    // new moons, apogees and ascending nodes over any range the SPK
+    // covers, written as a FRAC version 2 container (Ephemeris.h).
+    //
+    // CSPICE keeps its kernel pool, SPK buffers and error state per
+    // process, so threads would only take turns on spice_mutex().  Time
+    // chunks go to fork()ed worker processes instead, each with its own
+    // kernel load (run_event_workers()).
+
+    // Apparent Sun and Moon and the geometric lunar state from SPICE.  The
+    // caller holds spice_mutex() (in-process) and a SpiceErrorScope.
+    struct SpiceEventSource {
+        const cspice_utils::LeapSeconds &leap_seconds;
+
+        bool fetch(const double et, const uint32_t kind, EventGeometry &g, EventSearchStatus &status) const {
+            SpiceDouble lt;
+            if (kind != event_apogee) {
+                spkezp_c(301, et, "ECLIPJ2000", "LT+S", 399, g.moon, &lt);
+                if (kind != event_nodal_ascending) spkezp_c(10, et, "ECLIPJ2000", "LT+S", 399, g.sun, &lt);
+            }
+            if (kind == event_apogee || kind == event_kind_count)
+                spkez_c(301, et, "ECLIPJ2000", "NONE", 399, g.state, &lt);
+            if (!failed_c()) return true;
+            if (status.failed++ == 0) {
+                SpiceChar msg[1841] = {};
+                getmsg_c("LONG", sizeof(msg), msg);
+                status.first_error = msg;
+            }
+            reset_c();
+            return false;
+        }
+
+        [[nodiscard]] double et_to_unix(const double et) const { return leap_seconds.et_to_unix(et); }
+    };
+
+    // New moons, apogees and ascending nodes in [t0, t1] (unix seconds),
+    // split across processes (see run_event_workers(); each child drops
+    // the kernels it inherited and loads ctx.kernel_dir afresh, since the
+    // inherited SPK file descriptors share their offsets with the parent).
+    // step is the coarse sampling interval; a day is well inside the
+    // spacing of every event.  The range must lie within the SPK coverage
+    // (de442s: 1849-2150); samples outside it are counted as failures in
+    // the status and no events are found around them.
+    inline EventTables find_lunar_events(const AlignmentContext &ctx, const int64_t t0, const int64_t t1,
+                                         const unsigned processes = 1, const int64_t step = 86400) {
+        if (!ctx.ready || t1 < t0 || step <= 0) {
+            EventTables tables;
+            tables.status.failed = 1;
+            tables.status.first_error = !ctx.ready && !ctx.error.empty() ? ctx.error
+                                        : !ctx.ready ? "alignment context not initialised"
+                                                     : "bad event range";
+            return tables;
+        }
+
+        SpiceEventSource source{ctx.leap_seconds};
+        const detail::EventGrid grid = detail::event_grid(source, t0, t1, step);
+        return run_event_workers(grid.intervals, processes, [&](const size_t first, const size_t last,
+                                                                const bool forked) {
+            EventTables part;
+            // A child is single-threaded: no other thread can hold the lock
+            std::unique_lock<std::mutex> lock(spice_mutex(), std::defer_lock);
+            if (!forked) lock.lock();
+            SpiceErrorScope errors;
+            if (forked) {
+                kclear_c();
+                load_kernels_from_path(ctx.kernel_dir);
+                if (failed_c()) {
+                    part.status.failed = 1;
+                    SpiceChar msg[1841] = {};
+                    getmsg_c("LONG", sizeof(msg), msg);
+                    part.status.first_error = msg;
+                    reset_c();
+                    return part;
+                }
+            }
+            detail::event_range(source, grid, first, last, t0, t1, part);
+            return part;
+        });
+    }
+} // namespace moon
+
+#endif // EVENT_GENERATOR_HPP
@@ -0,0 +1,336 @@
+#ifndef EVENT_SEARCH_HPP
+#define EVENT_SEARCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "Ephemeris.h"
+
+namespace moon {
+
+    // Lunar event search (new_moon.h, apogee.h, nodal_ascending.h) over
+    // any source of geocentric Sun and Moon vectors, without SPICE; the
+    // kernel-backed source is event_generator.hpp.
+    //
+    // Each event is the upward zero of a function of the geocentric Sun
+    // and Moon, measured against the mean ecliptic of date:
+    //   new moon         Moon minus Sun apparent ecliptic longitude
+    //   apogee           minus the geometric Earth-Moon range rate
+    //   ascending node   apparent ecliptic latitude of the Moon
+    // The functions are sampled every step seconds, sign changes are
+    // bracketed and refined by the Illinois method to well under a second.
+
+    enum EventKind : uint32_t {
+        event_new_moon,
+        event_apogee,
+        event_nodal_ascending,
+        event_kind_count
+    };
+
+    // Series names in the container, in EventKind order.
+    inline const char *const event_series_names[event_kind_count] = {"new_moon", "apogee", "nodal_ascending"};
+
+    // Samples the geometry source could not evaluate.
+    struct EventSearchStatus {
+        size_t failed = 0;
+        std::string first_error;
+    };
+
+    struct EventTables {
+        std::vector<int64_t> series[event_kind_count]; // unix seconds, sorted
+        EventSearchStatus status;
+    };
+
+    // What the event functions need at one instant, in ECLIPJ2000 (any
+    // unit of length).
+    struct EventGeometry {
+        double sun[3];   // apparent Earth-Sun
+        double moon[3];  // apparent Earth-Moon
+        double state[6]; // geometric Earth-Moon position and velocity
+    };
+
+    // A geometry source provides
+    //   bool fetch(double et, uint32_t kind, EventGeometry &g, EventSearchStatus &status)
+    //       the vectors kind needs (all of them for event_kind_count);
+    //       false, with the failure counted in status, if it cannot
+    //   double et_to_unix(double et)
+    // where et is TDB seconds past J2000.
+
+    namespace detail {
+        // Refinement stops when the bracket is this narrow (seconds).
+        constexpr double event_tolerance = 0.01;
+
+        // Pole of the mean ecliptic of date in ECLIPJ2000, from the
+        // inclination pi_A and node Pi_A of that ecliptic on the ecliptic
+        // of J2000 (Lieske et al. 1977).
+        inline void ecliptic_pole_of_date(const double et, double pole[3]) {
+            constexpr double arcsec = 3.14159265358979323846 / 648000.0;
+            const double t = et / (36525.0 * 86400.0);
+            const double pi_a = (47.0029 - 0.03302 * t + 0.000060 * t * t) * t * arcsec;
+            const double node = 174.876384 * 3600.0 * arcsec + (-869.8089 + 0.03536 * t) * t * arcsec;
+            pole[0] = std::sin(pi_a) * std::sin(node);
+            pole[1] = -std::sin(pi_a) * std::cos(node);
+            pole[2] = std::cos(pi_a);
+        }
+
+        inline double dot(const double a[3], const double b[3]) {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        // The event function of kind; rises through zero at the event.
+        inline double event_value(const double et, const uint32_t kind, const EventGeometry &g) {
+            if (kind == event_apogee) return -dot(g.state, g.state + 3);
+
+            double pole[3];
+            ecliptic_pole_of_date(et, pole);
+            if (kind == event_nodal_ascending) return dot(g.moon, pole) / std::sqrt(dot(g.moon, g.moon));
+
+            // Longitude difference in (-pi, pi]: the angle from the Sun's
+            // projection on the ecliptic of date to the Moon's.
+            const double cross[3] = {g.sun[1] * g.moon[2] - g.sun[2] * g.moon[1],
+                                     g.sun[2] * g.moon[0] - g.sun[0] * g.moon[2],
+                                     g.sun[0] * g.moon[1] - g.sun[1] * g.moon[0]};
+            return std::atan2(dot(pole, cross), dot(g.sun, g.moon) - dot(g.sun, pole) * dot(g.moon, pole));
+        }
+
+        // Event of kind in (a, b] given fa < 0 <= fb; NaN if the source fails.
+        template<typename Source>
+        double refine_event(Source &source, double a, double b, double fa, double fb, const uint32_t kind,
+                            EventSearchStatus &status) {
+            int side = 0;
+            for (int i = 0; i < 64 && fb != 0.0 && b - a > event_tolerance; ++i) {
+                double c = b - fb * (b - a) / (fb - fa);
+                if (!(c > a && c < b)) c = 0.5 * (a + b);
+
+                EventGeometry g;
+                if (!source.fetch(c, kind, g, status)) return std::nan("");
+                const double fc = event_value(c, kind, g);
+                // Illinois: halve the value of an end that is kept twice
+                if (fc < 0.0) {
+                    if (side < 0) fb *= 0.5;
+                    a = c, fa = fc, side = -1;
+                } else {
+                    if (side > 0) fa *= 0.5;
+                    b = c, fb = fc, side = 1;
+                }
+            }
+            return fb == 0.0 ? b : 0.5 * (a + b);
+        }
+
+        // Sampling of [t0, t1]: intervals between the points et0 + i * step,
+        // with one step of margin on either side so events right at the
+        // ends are bracketed too.
+        struct EventGrid {
+            double et0;
+            double step;
+            size_t intervals;
+        };
+
+        template<typename Source>
+        EventGrid event_grid(Source &source, const int64_t t0, const int64_t t1, const int64_t step) {
+            // Invert et_to_unix() at t0 - step; the sources are smooth to a
+            // few ms, so two corrections land on it.
+            const auto start = static_cast<double>(t0 - step);
+            double et0 = start - 946728000.0;
+            for (int i = 0; i < 2; ++i) et0 += start - source.et_to_unix(et0);
+            return {et0, static_cast<double>(step), static_cast<size_t>((t1 - t0 + step - 1) / step) + 2};
+        }
+
+        // Events in intervals [first, last) of grid, appended to out in time
+        // order.  Interval i is (et0 + i * step, et0 + (i + 1) * step], so
+        // consecutive ranges find every bracket exactly once.
+        template<typename Source>
+        void event_range(Source &source, const EventGrid &grid, const size_t first, const size_t last,
+                         const int64_t t0, const int64_t t1, EventTables &out) {
+            if (first >= last) return;
+            const size_t n = last - first + 1;
+            std::vector<double> et(n), f(n * event_kind_count);
+            std::vector<char> ok(n);
+            for (size_t i = 0; i < n; ++i) {
+                et[i] = grid.et0 + static_cast<double>(first + i) * grid.step;
+                EventGeometry g;
+                ok[i] = source.fetch(et[i], event_kind_count, g, out.status);
+                if (ok[i])
+                    for (uint32_t k = 0; k < event_kind_count; ++k)
+                        f[i * event_kind_count + k] = event_value(et[i], k, g);
+            }
+            for (uint32_t k = 0; k < event_kind_count; ++k) {
+                for (size_t i = 0; i + 1 < n; ++i) {
+                    if (!ok[i] || !ok[i + 1]) continue;
+                    const double fa = f[i * event_kind_count + k], fb = f[(i + 1) * event_kind_count + k];
+                    // The longitude difference wraps from +pi to -pi at
+                    // full moon: a downward step, so never a bracket.
+                    if (!(fa < 0.0 && fb >= 0.0)) continue;
+
+                    const double root = refine_event(source, et[i], et[i + 1], fa, fb, k, out.status);
+                    if (std::isnan(root)) continue;
+                    const auto unix_seconds = static_cast<int64_t>(std::llround(source.et_to_unix(root)));
+                    if (unix_seconds >= t0 && unix_seconds <= t1) out.series[k].push_back(unix_seconds);
+                }
+            }
+        }
+
+        inline void append_tables(EventTables &to, const EventTables &from) {
+            for (uint32_t k = 0; k < event_kind_count; ++k)
+                to.series[k].insert(to.series[k].end(), from.series[k].begin(), from.series[k].end());
+            if (from.status.failed && to.status.first_error.empty()) to.status.first_error = from.status.first_error;
+            to.status.failed += from.status.failed;
+        }
+
+#if !defined(_WIN32)
+        // Tables through a pipe: per series a uint64 count and the values,
+        // then the failure count and the first error's length and text.
+        inline bool write_all(const int fd, const void *data, size_t size) {
+            auto p = static_cast<const char *>(data);
+            while (size) {
+                const ssize_t n = ::write(fd, p, size);
+                if (n <= 0) return false;
+                p += n, size -= static_cast<size_t>(n);
+            }
+            return true;
+        }
+
+        inline bool read_all(const int fd, void *data, size_t size) {
+            auto p = static_cast<char *>(data);
+            while (size) {
+                const ssize_t n = ::read(fd, p, size);
+                if (n <= 0) return false;
+                p += n, size -= static_cast<size_t>(n);
+            }
+            return true;
+        }
+
+        inline bool send_tables(const int fd, const EventTables &tables) {
+            for (const auto &s : tables.series) {
+                const uint64_t n = s.size();
+                if (!write_all(fd, &n, sizeof(n)) || !write_all(fd, s.data(), n * sizeof(int64_t))) return false;
+            }
+            const uint64_t failed = tables.status.failed, length = tables.status.first_error.size();
+            return write_all(fd, &failed, sizeof(failed)) && write_all(fd, &length, sizeof(length))
+                   && write_all(fd, tables.status.first_error.data(), length);
+        }
+
+        inline bool receive_tables(const int fd, EventTables &tables) {
+            for (auto &s : tables.series) {
+                uint64_t n = 0;
+                if (!read_all(fd, &n, sizeof(n)) || n > (UINT64_C(1) << 32)) return false;
+                s.resize(n);
+                if (!read_all(fd, s.data(), n * sizeof(int64_t))) return false;
+            }
+            uint64_t failed = 0, length = 0;
+            if (!read_all(fd, &failed, sizeof(failed)) || !read_all(fd, &length, sizeof(length)) || length > 4096)
+                return false;
+            tables.status.failed = failed;
+            tables.status.first_error.resize(length);
+            return read_all(fd, tables.status.first_error.data(), length);
+        }
+#endif
+    } // namespace detail
+
+    // Split intervals [0, intervals) into processes contiguous ranges and
+    // return work(first, last, forked) for each, concatenated in order.
+    // On POSIX every range but the first runs in a fork()ed child (forked
+    // true) that sends its tables back through a pipe, so sources with
+    // process-wide state -- CSPICE -- run truly in parallel; the first
+    // range, and any range whose child cannot be started, run in this
+    // process.  On Windows all ranges run here, one after another.  A
+    // child that dies or sends a short reply counts as one failure.
+    template<typename Work>
+    EventTables run_event_workers(const size_t intervals, unsigned processes, Work work) {
+        processes = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(processes, intervals)));
+        const size_t per = (intervals + processes - 1) / processes;
+        EventTables tables;
+
+#if defined(_WIN32)
+        for (unsigned p = 0; p < processes; ++p) {
+            const size_t first = std::min(intervals, p * per);
+            detail::append_tables(tables, work(first, std::min(intervals, first + per), false));
+        }
+#else
+        std::vector<pid_t> pids(processes, -1);
+        std::vector<int> fds(processes, -1);
+        for (unsigned p = 1; p < processes; ++p) {
+            int fd[2];
+            if (::pipe(fd) != 0) continue;
+            const pid_t pid = ::fork();
+            if (pid == 0) {
+                ::close(fd[0]);
+                const size_t first = std::min(intervals, p * per);
+                const bool sent = detail::send_tables(fd[1], work(first, std::min(intervals, first + per), true));
+                // _exit: no atexit handlers or stdio flushes of the parent's state
+                ::_exit(sent ? 0 : 1);
+            }
+            ::close(fd[1]);
+            if (pid < 0) {
+                ::close(fd[0]);
+                continue;
+            }
+            pids[p] = pid;
+            fds[p] = fd[0];
+        }
+
+        for (unsigned p = 0; p < processes; ++p) {
+            const size_t first = std::min(intervals, p * per), last = std::min(intervals, first + per);
+            if (pids[p] < 0) {
+                detail::append_tables(tables, work(first, last, false));
+                continue;
+            }
+            EventTables part;
+            bool ok = detail::receive_tables(fds[p], part);
+            ::close(fds[p]);
+            int wstatus = 0;
+            ok = ::waitpid(pids[p], &wstatus, 0) == pids[p] && WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0 && ok;
+            if (!ok) {
+                for (auto &s : part.series) s.clear();
+                part.status.failed = 1;
+                part.status.first_error = "event worker process failed";
+            }
+            detail::append_tables(tables, part);
+        }
+#endif
+        return tables;
+    }
+
+    // New moons, apogees and ascending nodes in [t0, t1] (unix seconds)
+    // from source, in this process.  step is the coarse sampling
+    // interval; a day is well inside the spacing of every event.
+    template<typename Source>
+    EventTables search_lunar_events(Source &source, const int64_t t0, const int64_t t1,
+                                    const int64_t step = 86400) {
+        EventTables tables;
+        if (t1 < t0 || step <= 0) {
+            tables.status.failed = 1;
+            tables.status.first_error = "bad event range";
+            return tables;
+        }
+        const detail::EventGrid grid = detail::event_grid(source, t0, t1, step);
+        detail::event_range(source, grid, 0, grid.intervals, t0, t1, tables);
+        return tables;
+    }
+
+    // Write tables as a FRAC version 2 container named after
+    // event_series_names, one index row every index_step seconds (a
+    // Julian year by default).
+    inline bool write_lunar_events(const char *path, const EventTables &tables,
+                                   const int64_t index_step = 31557600) {
+        fractonica_source_t series[event_kind_count] = {};
+        for (uint32_t k = 0; k < event_kind_count; ++k) {
+            if (tables.series[k].size() > UINT32_MAX) return false;
+            series[k].entry_count = static_cast<uint32_t>(tables.series[k].size());
+            series[k].timestamps = tables.series[k].data();
+        }
+        return fractonica_multi_write(path, event_series_names, series, event_kind_count, index_step);
+    }
+} // namespace moon
+
+#endif // EVENT_SEARCH_HPP
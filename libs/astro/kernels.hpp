@@ -35,13 +35,14 @@ static std::string rootDir()
 #endif
 }
 
-inline int load_kernels_from_path(std::string kernel_path) {
-
-    furnsh_c((kernel_path + "/naif0012.tls").c_str());
+// Kernels furnished by load_kernels_from_path(), relative to its path.
+inline const char *const kernel_files[] = {"naif0012.tls", "de442s.bsp", "pck00011.tpc"};
 
-    furnsh_c((kernel_path + "/de442s.bsp").c_str());
+inline int load_kernels_from_path(std::string kernel_path) {
 
-    furnsh_c((kernel_path + "/pck00011.tpc").c_str());
+    for (const char *file : kernel_files) {
+        furnsh_c((kernel_path + "/" + file).c_str());
+    }
 
     kernels_loaded = 1;
 
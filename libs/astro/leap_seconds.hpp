@@ -0,0 +1,56 @@
+#ifndef LEAP_SECONDS_HPP
+#define LEAP_SECONDS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace cspice_utils {
+
+    // Unix seconds <-> ET without SPICE calls or strings, from the DELTET
+    // variables of the leap-seconds kernel (naif0012.tls; filled from the
+    // kernel pool by load_leap_seconds() in alignment_batch.hpp):
+    //   TAI = UTC + DELTA_AT,  ET - TAI = DELTA_T_A + K sin(E),
+    //   E = M + EB sin(M),     M = M0 + M1 * ET.
+    // Same result as str2et_c / et2utc_c to well under a millisecond.
+    struct LeapSeconds {
+        // UTC seconds past J2000 at which each DELTA_AT value starts
+        std::vector<double> starts;
+        std::vector<double> delta_at;
+        double delta_t_a = 32.184;
+        double k = 0.0, eb = 0.0, m0 = 0.0, m1 = 0.0;
+
+        // Unix time of J2000 (2000-01-01T12:00:00 UTC)
+        static constexpr double unix_j2000 = 946728000.0;
+
+        // DELTA_AT in force at the given UTC seconds past J2000 (the
+        // first value before the table starts).
+        [[nodiscard]] double delta_at_utc(const double utc) const {
+            const auto it = std::upper_bound(starts.begin(), starts.end(), utc);
+            return delta_at[it == starts.begin() ? 0 : (it - starts.begin()) - 1];
+        }
+
+        [[nodiscard]] double et_minus_tai(const double et) const {
+            const double m = m0 + m1 * et;
+            return delta_t_a + k * std::sin(m + eb * std::sin(m));
+        }
+
+        [[nodiscard]] double unix_to_et(const double unix_seconds) const {
+            const double utc = unix_seconds - unix_j2000;
+            const double tai = utc + delta_at_utc(utc);
+            // K sin(E) is under 2 ms, so one refinement is exact to rounding
+            return tai + et_minus_tai(tai + delta_t_a);
+        }
+
+        [[nodiscard]] double et_to_unix(const double et) const {
+            const double tai = et - et_minus_tai(et);
+            // A DELTA_AT step starts at starts[i] UTC = starts[i] + delta_at[i] TAI
+            size_t i = 0;
+            while (i + 1 < starts.size() && tai >= starts[i + 1] + delta_at[i + 1]) ++i;
+            return tai - delta_at[i] + unix_j2000;
+        }
+    };
+} // namespace cspice_utils
+
+#endif // LEAP_SECONDS_HPP
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""
+build_compact_db.py — derive the SAROS_USE_COMPACT data headers from the
+raw ones written by build_db.py.
+
+  python scripts/build_compact_db.py            # every catalog under core/include/saros
+  python scripts/build_compact_db.py solar/modern
+
+For each <kind>/<slice> it reads eclipse_times_<slice>.h and
+eclipse_info_<slice>.h and writes eclipse_times_<slice>_compact.h and
+eclipse_info_<slice>_compact.h next to them.
+
+Times: frame-of-reference blocks of BLOCK_SIZE eclipses.  The first time of
+each block goes to a skip index (<arr>_base, int64); the others are stored as
+offsets from it, bit-packed at the narrowest width that fits the block.
+<arr>_frame holds one uint32 per block: payload byte offset << 8 | width.
+
+Info: the seven fields of the 10-byte record are stored biased by their
+catalog minimum at the narrowest width that fits the catalog, so every record
+has the same bit length and stays randomly addressable.  For 16-bit fields
+holding the 0xFFFF "n/a" marker, 0 encodes n/a and values are stored + 1.
+"""
+
+import os
+import re
+import sys
+
+BLOCK_SIZE = 32
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "core", "include", "saros")
+
+# (byte offset, size) of the fields of the raw 10-byte info record
+INFO_FIELDS = [(0, 2), (2, 2), (4, 2), (6, 1), (7, 1), (8, 1), (9, 1)]
+# fields stored as int16 (solar latitude / longitude); everything else is unsigned
+SIGNED_FIELDS = {"solar": {0, 1}, "lunar": set()}
+
+INFO_NAMES = {
+    "solar": ["latitude_deg10", "longitude_deg10", "central_duration_s",
+              "saros_number", "saros_pos", "ecl_type", "sun_alt"],
+    "lunar": ["pen_duration_s", "par_duration_s", "total_duration_s",
+              "saros_number", "saros_pos", "ecl_type", "_pad"],
+}
+
+PROGMEM_BLOCK = """#ifdef ECLIPSE_USE_PROGMEM
+#  include <avr/pgmspace.h>
+#  define ECLIPSE_READ_BYTE(p)   pgm_read_byte(p)
+#  define ECLIPSE_READ_WORD(p)   pgm_read_word(p)
+#  define ECLIPSE_READ_DWORD(p)  pgm_read_dword(p)
+#  define ECLIPSE_ATTR           PROGMEM
+#else
+#  define ECLIPSE_READ_BYTE(p)   (*(const uint8_t  *)(p))
+#  define ECLIPSE_READ_WORD(p)   (*(const uint16_t *)(p))
+#  define ECLIPSE_READ_DWORD(p)  (*(const uint32_t *)(p))
+#  define ECLIPSE_ATTR           /* nothing */
+#endif"""
+
+
+def read_array(path, name):
+    src = open(path).read()
+    m = re.search(r"static (?:const|ECLIPSE_CONST) uint8_t %s\[\d+u\] ECLIPSE_ATTR = \{(.*?)\};" % re.escape(name), src, re.S)
+    if not m:
+        raise SystemExit("%s: array %s not found" % (path, name))
+    data = bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{2})", m.group(1)))
+    macros = dict(re.findall(r"#define (ECLIPSE_\w+)\s+(\d+)u", src))
+    return data, macros
+
+
+class BitWriter:
+    def __init__(self):
+        self.acc = 0
+        self.bits = 0
+        self.out = bytearray()
+
+    def put(self, value, width):
+        assert 0 <= value < (1 << width) or width == 0 and value == 0
+        self.acc |= value << self.bits
+        self.bits += width
+        while self.bits >= 8:
+            self.out.append(self.acc & 0xFF)
+            self.acc >>= 8
+            self.bits -= 8
+
+    def align(self):
+        if self.bits:
+            self.out.append(self.acc & 0xFF)
+            self.acc = 0
+            self.bits = 0
+
+
+def fmt_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return ",\n".join(lines)
+
+
+def fmt_size(n):
+    return "{:,} bytes ({:.1f} KB)".format(n, n / 1024.0)
+
+
+def header(kind, what, slice_, count, first, last, flash, name):
+    return """/*
+ * Auto-generated by build_compact_db.py — DO NOT EDIT
+ *
+ * {what}
+ * Saros range : {first}–{last}
+ * Eclipses    : {count}
+ * Flash usage : {flash}
+ *
+ * Usage: #define SAROS_USE_COMPACT in the {kind} implementation unit, which
+ * then includes this header instead of the raw one.  ECLIPSE_USE_PROGMEM
+ * works as for the raw headers.
+ */
+
+#ifndef {guard}
+#define {guard}
+
+#include <stdint.h>
+
+{progmem}
+
+#define ECLIPSE_{SLICE}_COUNT       {count}u
+#define ECLIPSE_{SLICE}_SAROS_FIRST {first}u
+#define ECLIPSE_{SLICE}_SAROS_LAST  {last}u
+""".format(what=what, first=first, last=last, count=count, flash=fmt_size(flash), kind=kind,
+           guard=name.upper() + "_H", progmem=PROGMEM_BLOCK, SLICE=slice_.upper())
+
+
+def build_times(kind, slice_, times, macros):
+    count = len(times)
+    blocks = (count + BLOCK_SIZE - 1) // BLOCK_SIZE
+    base = bytearray()
+    frame = bytearray()
+    w = BitWriter()
+    for b in range(blocks):
+        block = times[b * BLOCK_SIZE:(b + 1) * BLOCK_SIZE]
+        offsets = [t - block[0] for t in block[1:]]
+        assert all(o >= 0 for o in offsets), "times are not sorted"
+        width = max(offsets).bit_length() if offsets else 0
+        assert width <= 57, "block span too wide for the decoder"
+        base += block[0].to_bytes(8, "little", signed=True)
+        frame += ((len(w.out) << 8) | width).to_bytes(4, "little")
+        for o in offsets:
+            w.put(o, width)
+        w.align()
+    assert len(w.out) < (1 << 24)
+    packed = bytes(w.out)
+
+    arr = "eclipse_times_%s" % slice_
+    flash = len(base) + len(frame) + len(packed)
+    out = header(kind, "Sorted timestamps, frame-of-reference packed in blocks of %d." % BLOCK_SIZE,
+                 slice_, count, macros["ECLIPSE_%s_SAROS_FIRST" % slice_.upper()],
+                 macros["ECLIPSE_%s_SAROS_LAST" % slice_.upper()], flash, arr + "_compact")
+    out += """#define ECLIPSE_{S}_BLOCK_SIZE  {bs}u
+#define ECLIPSE_{S}_BLOCKS      {blocks}u
+
+/* {arr}_base[] — int64_t time of the first eclipse of each block (skip index).
+ * Size: {bsize:,} bytes */
+static const uint8_t {arr}_base[{nbase}u] ECLIPSE_ATTR = {{
+{base}
+}};
+
+/* {arr}_frame[] — uint32 per block: payload byte offset << 8 | offset width.
+ * Size: {fsize:,} bytes */
+static const uint8_t {arr}_frame[{nframe}u] ECLIPSE_ATTR = {{
+{frame}
+}};
+
+/* {arr}_packed[] — per block, the offsets of eclipses 1..{last} from the block's
+ * base, LSB-first at the block's width; each block starts on a byte.
+ * Size: {psize:,} bytes */
+static const uint8_t {arr}_packed[{npacked}u] ECLIPSE_ATTR = {{
+{packed}
+}};
+
+#endif /* {guard} */
+""".format(S=slice_.upper(), bs=BLOCK_SIZE, blocks=blocks, arr=arr, bsize=len(base), nbase=len(base),
+           base=fmt_bytes(base), fsize=len(frame), nframe=len(frame), frame=fmt_bytes(frame),
+           last=BLOCK_SIZE - 1, psize=len(packed), npacked=max(len(packed), 1),
+           packed=fmt_bytes(packed) if packed else "    0x00", guard=(arr + "_compact").upper() + "_H")
+    return out, flash
+
+
+def build_info(kind, slice_, info, macros):
+    count = len(info) // 10
+    values = []
+    for i in range(count):
+        rec = info[i * 10:(i + 1) * 10]
+        row = []
+        for f, (off, size) in enumerate(INFO_FIELDS):
+            row.append(int.from_bytes(rec[off:off + size], "little", signed=f in SIGNED_FIELDS[kind]))
+        values.append(row)
+
+    bias, width, nullable = [], [], 0
+    for f, (off, size) in enumerate(INFO_FIELDS):
+        col = [r[f] for r in values]
+        is_null = size == 2 and f not in SIGNED_FIELDS[kind] and 0xFFFF in col
+        present = [v for v in col if not (is_null and v == 0xFFFF)]
+        lo = min(present) if present else 0
+        hi = max(present) if present else 0
+        span = hi - lo + (1 if is_null else 0)
+        bias.append(lo)
+        width.append(span.bit_length())
+        if is_null:
+            nullable |= 1 << f
+    rec_bits = sum(width)
+
+    w = BitWriter()
+    for row in values:
+        for f, v in enumerate(row):
+            if nullable >> f & 1:
+                s = 0 if v == 0xFFFF else v - bias[f] + 1
+            else:
+                s = v - bias[f]
+            w.put(s, width[f])
+    w.align()
+    packed = bytes(w.out)
+
+    arr = "eclipse_info_%s" % slice_
+    flash = len(packed)
+    out = header(kind, "Bit-packed %s eclipse_info_t records (%d bits each)." % (kind, rec_bits),
+                 slice_, count, macros["ECLIPSE_%s_SAROS_FIRST" % slice_.upper()],
+                 macros["ECLIPSE_%s_SAROS_LAST" % slice_.upper()], flash, arr + "_compact")
+    layout = "\n".join(" *   %-18s bias %6d  width %2d%s" % (INFO_NAMES[kind][f], bias[f], width[f],
+                                                          "  (0 = n/a)" if nullable >> f & 1 else "")
+                       for f in range(len(INFO_FIELDS)))
+    out += """#define ECLIPSE_{S}_INFO_BITS     {bits}u
+#define ECLIPSE_{S}_INFO_NULLABLE 0x{nullable:02x}u
+
+/* Field layout, in the order of the raw 10-byte record:
+{layout}
+ * A field decodes to bias + stored value; for nullable fields stored 0 is
+ * 0xFFFF and bias + stored - 1 otherwise.  Read on every decode, so these
+ * two stay in RAM. */
+static const int32_t {arr}_bias[7] = {{ {biases} }};
+static const uint8_t {arr}_width[7] = {{ {widths} }};
+
+/* {arr}_packed[] — {bits}-bit records, LSB-first, same order as the times.
+ * Size: {psize:,} bytes */
+static const uint8_t {arr}_packed[{psize}u] ECLIPSE_ATTR = {{
+{packed}
+}};
+
+#endif /* {guard} */
+""".format(S=slice_.upper(), bits=rec_bits, nullable=nullable, layout=layout, arr=arr,
+           biases=", ".join(str(b) for b in bias), widths=", ".join(str(x) for x in width),
+           psize=len(packed), packed=fmt_bytes(packed), guard=(arr + "_compact").upper() + "_H")
+    return out, flash
+
+
+def build(kind, slice_):
+    d = os.path.join(ROOT, kind)
+    times_raw, macros = read_array(os.path.join(d, "eclipse_times_%s.h" % slice_), "eclipse_times_%s" % slice_)
+    info_raw, _ = read_array(os.path.join(d, "eclipse_info_%s.h" % slice_), "eclipse_info_%s" % slice_)
+    times = [int.from_bytes(times_raw[i:i + 8], "little", signed=True) for i in range(0, len(times_raw), 8)]
+    assert len(times) * 10 == len(info_raw)
+
+    times_h, times_flash = build_times(kind, slice_, times, macros)
+    info_h, info_flash = build_info(kind, slice_, info_raw, macros)
+    with open(os.path.join(d, "eclipse_times_%s_compact.h" % slice_), "w") as f:
+        f.write(times_h)
+    with open(os.path.join(d, "eclipse_info_%s_compact.h" % slice_), "w") as f:
+        f.write(info_h)
+
+    print("%s/%s: times %6d -> %6d bytes, info %6d -> %6d bytes" % (
+        kind, slice_, len(times_raw), times_flash, len(info_raw), info_flash))
+
+
+def main(argv):
+    targets = argv[1:]
+    if not targets:
+        for kind in ("solar", "lunar"):
+            for name in sorted(os.listdir(os.path.join(ROOT, kind))):
+                m = re.match(r"eclipse_times_(\w+?)\.h$", name)
+                if m and not m.group(1).endswith("_compact"):
+                    targets.append("%s/%s" % (kind, m.group(1)))
+    for t in targets:
+        kind, slice_ = t.split("/")
+        build(kind, slice_)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
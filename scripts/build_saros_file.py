@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+build_saros_file.py — pack build_db.py output into a catalog file for
+saros_file_open() (layout in core/include/saros_file.h).
+
+  python scripts/build_saros_file.py solar/modern solar_modern.sdb
+  python scripts/build_saros_file.py path/to/solar/all solar_all.sdb
+
+The first argument names <dir>/<slice>: the raw eclipse_times_<slice>.h,
+eclipse_info_<slice>.h and saros_<slice>.h headers in <dir> (relative to
+core/include/saros unless it exists as given).
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+from build_compact_db import ROOT, read_array
+
+VERSION = 1
+HEADER_SIZE = 64
+RECORD_SIZE = 194
+INFO_SIZE = 10
+
+
+def pack(times, info, saros, kind, first, last):
+    count = len(times) // 8
+    assert len(info) == count * INFO_SIZE
+    assert len(saros) == (last - first + 1) * RECORD_SIZE
+    assert 0 < count <= 0xFFFF
+
+    times_off = HEADER_SIZE
+    info_off = times_off + len(times)
+    series_off = info_off + len(info)
+    size = series_off + len(saros)
+
+    head = struct.pack("<8sHBBBBHIIIIIIII12x", b"SAROSDB\0", VERSION, kind, 0, first, last,
+                       RECORD_SIZE, count, size, times_off, info_off, series_off,
+                       zlib.crc32(times), zlib.crc32(info), zlib.crc32(saros))
+    head += struct.pack("<I", zlib.crc32(head))
+    assert len(head) == HEADER_SIZE
+    return head + times + info + saros
+
+
+def main(argv):
+    if len(argv) != 3:
+        raise SystemExit(__doc__)
+    src, out = argv[1], argv[2]
+    d, slice_ = os.path.split(src)
+    if not os.path.isdir(d):
+        d = os.path.join(ROOT, d)
+    kind = 1 if os.path.basename(os.path.normpath(d)) == "lunar" else 0
+
+    times, macros = read_array(os.path.join(d, "eclipse_times_%s.h" % slice_), "eclipse_times_%s" % slice_)
+    info, _ = read_array(os.path.join(d, "eclipse_info_%s.h" % slice_), "eclipse_info_%s" % slice_)
+    saros, _ = read_array(os.path.join(d, "saros_%s.h" % slice_), "saros_%s" % slice_)
+    first = int(macros["ECLIPSE_%s_SAROS_FIRST" % slice_.upper()])
+    last = int(macros["ECLIPSE_%s_SAROS_LAST" % slice_.upper()])
+
+    data = pack(times, info, saros, kind, first, last)
+    with open(out, "wb") as f:
+        f.write(data)
+    print("%s: %s, %d eclipses, Saros %d-%d, %d bytes" % (
+        out, "lunar" if kind else "solar", len(times) // 8, first, last, len(data)))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -5,6 +5,8 @@
 #include "DesktopApp.h"
 
 #include "saros.h"
+#include "saros_db.h"
+#include "SarosCatalog.h"
 #include "GuiUtils.h"
 #include "implot.h"
 #include "OctalGlyph.h"
@@ -328,42 +330,41 @@ namespace Fractonica {
 
             ImPlot::Annotation(birthday,0,ImPlot::GetLastItemColor(),ImVec2(10,60),false,"Birth");
             ImPlot::Annotation(solar.eclipse.unix_time,0,ImColor(255,255,0),ImVec2(10,10),false,"Solar");
-            int64_t prev = 0;
 
-            int x = 0;
-            for (int i = 0; i < 64; i++) {
-                int64_t times[SAROS_MAX_ECLIPSES];
-                uint8_t sarosCount = 0;
-                get_solar_saros_series(i + 110, times, &sarosCount);
+            // Only the eclipses inside the visible axis range.
+            const ImPlotRect limits = ImPlot::GetPlotLimits();
+            saros_range_t range;
+            eclipse_entry_t e;
+            saros_db_range(&range, &saros_solar_db, (int64_t) limits.X.Min, (int64_t) limits.X.Max, nullptr);
+            while (saros_range_next(&range, &e)) {
+                const uint8_t number = e.info.solar.saros_number;
+                const uint8_t pos = e.info.solar.saros_pos;
                 float r,g,b;
-                ImGui::ColorConvertHSVtoRGB((float) (i) / 180, 1, 1, r, g, b);
-
-                for (size_t j = 0; j < sarosCount; ++j) {
-                    char lbl[16];
-                    char dur[128];
-                    Utils::FormatDuration(times[j] - prev, dur);
-                    prev = times[j];
-                    sprintf(lbl, "%d %lu",i + 110, j+1);
-
-                    ImPlot::Annotation(times[j],0, ImColor(r * 255,g * 255,b * 255),ImVec2(10,-10),false,lbl);
-                    if (j == 0) {
-                        ImPlot::Annotation(times[j],0, ImColor(0,255,0),ImVec2(-20,-30),false,"FIRST");
-                    }
-                    if (j == sarosCount - 1) {
-                        ImPlot::Annotation(times[j],0, ImColor(255,0,0),ImVec2(-20,-30),false,"LAST");
-                    }
+                ImGui::ColorConvertHSVtoRGB((float) (number - 110) / 180, 1, 1, r, g, b);
+
+                char lbl[16];
+                snprintf(lbl, sizeof(lbl), "%d %d", number, pos + 1);
+
+                ImPlot::Annotation(e.unix_time,0, ImColor(r * 255,g * 255,b * 255),ImVec2(10,-10),false,lbl);
+                if (pos == 0) {
+                    ImPlot::Annotation(e.unix_time,0, ImColor(0,255,0),ImVec2(-20,-30),false,"FIRST");
+                }
+                if (pos + 1 == SarosCatalog::SeriesOf<SarosCatalog::Kind::Solar>(number).count) {
+                    ImPlot::Annotation(e.unix_time,0, ImColor(255,0,0),ImVec2(-20,-30),false,"LAST");
                 }
             }
 
             ImPlot::EndPlot();
         }
 
+        uint64_t phases[ALIVE_SAROS_COUNT];
+        calculate_solar_octal_phases(now, SarosOrderedByBirth, ALIVE_SAROS_COUNT, 2, phases);
         for (uint8_t i = 0; i < ALIVE_SAROS_COUNT; ++i) {
             char lbl[16];
             uint8_t num = SarosOrderedByBirth[i];
             sprintf(lbl, "%d (%d)", i + 1, num);
             if (ImGui::TreeNode(lbl)) {
-                Gui::DrawSarosCard(now, num, &display);
+                Gui::DrawSarosCard(now, num, phases[i], &display);
                 ImGui::TreePop();
             }
         }
@@ -23,6 +23,8 @@ namespace Fractonica {
         static void Duration(int64_t seconds);
 
         static void DrawSarosCard(int64_t now, uint8_t number, IDisplay *display);
+
+        static void DrawSarosCard(int64_t now, uint8_t number, uint64_t bin, IDisplay *display);
     };
 
     static int is_leap(int y) {
@@ -77,9 +79,12 @@ namespace Fractonica {
     }
 
     inline void Gui::DrawSarosCard(int64_t now, uint8_t number, IDisplay *display) {
+        DrawSarosCard(now, number, calculate_solar_octal_phase(now, number, 2), display);
+    }
+
+    inline void Gui::DrawSarosCard(int64_t now, uint8_t number, uint64_t bin, IDisplay *display) {
         char lbl[16];
         uint8_t index = SarosIndexLookup[number];
-        auto bin = calculate_solar_octal_phase(now, number, 2);
         sprintf(lbl, "%d (%d)", index + 1, number);
         ImGui::BeginChild(lbl, ImVec2(0, 290), ImGuiChildFlags_Borders | ImGuiChildFlags_AlwaysAutoResize);
 
@@ -0,0 +1,48 @@
+// lunar_events: regenerate the new moon, apogee and ascending node tables
+// from the SPICE kernels as one FRAC version 2 file (see
+// libs/astro/event_generator.hpp).
+//
+//   lunar_events OUT.frac T0 T1 [processes] [kernel-dir]
+//
+// T0 and T1 are unix seconds (inclusive); processes defaults to the
+// number of cores, kernel-dir to ./kernels.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "astro/event_generator.hpp"
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        std::fprintf(stderr, "usage: %s OUT.frac T0 T1 [processes] [kernel-dir]\n", argv[0]);
+        return 2;
+    }
+    const int64_t t0 = std::strtoll(argv[2], nullptr, 10);
+    const int64_t t1 = std::strtoll(argv[3], nullptr, 10);
+    const unsigned processes = argc > 4 ? static_cast<unsigned>(std::strtoul(argv[4], nullptr, 10))
+                                        : std::max(1u, std::thread::hardware_concurrency());
+    const std::string kernel_dir = argc > 5 ? argv[5] : rootDir() + "/kernels";
+
+    moon::AlignmentContext ctx;
+    if (!moon::init_alignment_context(ctx, kernel_dir)) {
+        std::fprintf(stderr, "kernels in %s: %s\n", kernel_dir.c_str(), ctx.error.c_str());
+        return 1;
+    }
+
+    const moon::EventTables tables = moon::find_lunar_events(ctx, t0, t1, processes);
+    if (tables.status.failed) {
+        std::fprintf(stderr, "%zu samples failed: %s\n", tables.status.failed, tables.status.first_error.c_str());
+        return 1;
+    }
+    for (uint32_t k = 0; k < moon::event_kind_count; ++k)
+        std::printf("%-16s %zu\n", moon::event_series_names[k], tables.series[k].size());
+
+    if (!moon::write_lunar_events(argv[1], tables)) {
+        std::fprintf(stderr, "cannot write %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
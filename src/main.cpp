@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include "sokol_app.h"
 #include "sokol_gfx.h"
 #include "sokol_glue.h"
@@ -14,6 +16,7 @@
 #include "Audio.h"
 #include "OctalGlyph.h"
 #include "saros.h"
+#include "SarosPhaseSnapshot.h"
 #include "SolidExplorer.h"
 #include "Synth.h"
 #include "Utils.h"
@@ -58,6 +61,33 @@ static Fractonica::ImGuiDisplay display(512, 512, 1,  Fractonica::IMatrix::TopLe
 static std::vector<SarosState> sarosNumbers = {};
 static Fractonica::SolidExplorer solid_explorer;
 static Fractonica::ImGuiDisplay matrix16(256, 256, 2, Fractonica::IMatrix::BottomLeft,"16x16 Matrix");
+// Written by the frame loop, read by the audio callback to trigger notes
+static Fractonica::SarosPhaseSnapshot<> sarosPhases;
+// Saros resolution of the glyphs, and the octal digits it gives: 12 bits
+// per step, wrapping after 3 (calculate_solar_octal_phase_ms), so 2 -> 8
+static constexpr uint8_t glyphResolution = 2;
+static constexpr uint8_t glyphDigits = 4 * ((glyphResolution + 2) % 3 + 1);
+// Per snapshot slot: still shown (and so sounded); plus the sound toggle, for the audio thread
+static std::atomic<bool> sarosAudible[ALIVE_SAROS_COUNT];
+static std::atomic<bool> soundEnabled{false};
+
+static constexpr float notes[8] = {
+    261.63,
+    277.18,
+    293.66,
+    311.13,
+    329.63,
+    349.23,
+    369.99,
+    392.00
+};
+
+// A rollover through more zero digits rings longer
+static double NoteDuration(const uint64_t bin) {
+    uint8_t zeroes = 0;
+    while (zeroes < glyphDigits && ((bin >> (3 * zeroes)) & 7) == 0) zeroes++;
+    return 2.25 + pow(2, zeroes);
+}
 
 static void draw_mandelbrot(const ImDrawList* dl, const ImDrawCmd* cmd) {
     (void)dl;
@@ -74,7 +104,33 @@ static void draw_mandelbrot(const ImDrawList* dl, const ImDrawCmd* cmd) {
 }
 
 
+void ModulateTone(uint32_t sample_counter, uint32_t base_phase_inc, int32_t base_vol, uint32_t duration_samples, int32_t & out_phase_inc, int32_t & out_vol) {
+    tone_generator.ModulateFast(sample_counter, base_phase_inc, base_vol, duration_samples, out_phase_inc, out_vol);
+}
+
+// Start a note for every shown series whose bin changed since the last
+// block; the snapshot is only re-read when a new one was published.
+static void SonifyPhases() {
+    static uint32_t version = 0;
+    static uint64_t lastBin[ALIVE_SAROS_COUNT] = {};
+
+    const uint32_t v = sarosPhases.Version();
+    if (v == version) return;
+    version = v;
+    for (size_t slot = 0; slot < ALIVE_SAROS_COUNT; ++slot) {
+        const uint64_t bin = sarosPhases.Bin(slot);
+        if (bin == lastBin[slot]) continue;
+        if (lastBin[slot] != 0 && soundEnabled.load(std::memory_order_relaxed)
+            && sarosAudible[slot].load(std::memory_order_relaxed)) {
+            synth.PlayVoice(static_cast<int>(slot), notes[bin & 7], 0.5f, NoteDuration(bin),
+                            Fractonica::Synth::OscSine, ModulateTone);
+        }
+        lastBin[slot] = bin;
+    }
+}
+
 void HandleAudio(float* buffer, int num_frames, int num_channels, void* user_data) {
+    SonifyPhases();
     for (int i = 0; i < num_frames; ++i) {
         int16_t sample = synth.Sample();
         for (int c = 0; c < num_channels; ++c) {
@@ -112,8 +168,15 @@ void init() {
 
     for (int i = 0; i < ALIVE_SAROS_COUNT; ++i) {
         sarosNumbers.emplace_back(SarosOrderedByBirth[i], settings);
+        sarosAudible[i].store(true, std::memory_order_relaxed);
     }
 
+    static constexpr uint8_t resolutions[] = { glyphResolution };
+    const auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    sarosPhases.Configure(SarosOrderedByBirth, ALIVE_SAROS_COUNT, resolutions, 1, 1000, false, nowMs);
+
     tone_generator.Randomize(state.frequency, state.amp);
    // state.mandelbrot.setup(512, 512);
 
@@ -122,10 +185,6 @@ void init() {
 }
 
 
-void ModulateTone(uint32_t sample_counter, uint32_t base_phase_inc, int32_t base_vol, uint32_t duration_samples, int32_t & out_phase_inc, int32_t & out_vol) {
-    tone_generator.ModulateFast(sample_counter, base_phase_inc, base_vol, duration_samples, out_phase_inc, out_vol);
-}
-
 void draw_saros_glyphs() {
 
     const auto now = std::chrono::system_clock::now();
@@ -135,6 +194,11 @@ void draw_saros_glyphs() {
     ).count();
     int x = 32;
     int y = 32;
+
+    // Only the series whose bin rolled over since the last frame are recomputed
+    sarosPhases.Update(seconds);
+    soundEnabled.store(state.enableSound, std::memory_order_relaxed);
+
     for (int i = sarosNumbers.size() - 1; i >= 0; --i) {
         SarosState saros = sarosNumbers[i];
 
@@ -169,7 +233,10 @@ void draw_saros_glyphs() {
 
        const auto pos = ImGui::GetCursorScreenPos();
        // ImGui::Text("%lld", seconds);
-        const auto v = calculate_solar_octal_phase_ms(seconds, saros.number, 2);
+        uint64_t v;
+        if (!sarosPhases.TryGet(saros.number, 0, v)) {
+            v = calculate_solar_octal_phase_ms(seconds, saros.number, glyphResolution);
+        }
         if (saros.timer > 0) {
             saros.timer -= delta_time;
             saros.settings.color = Fractonica::Utils::ColorHSV(saros.timer * 0x8000, 255,255);
@@ -180,43 +247,18 @@ void draw_saros_glyphs() {
 
         Fractonica::OctalGlyph::Draw(v, &display, Vector2(pos.x, pos.y ), saros.settings);
 
-        static constexpr float notes[8] = {
-            261.63,
-            277.18,
-            293.66,
-            311.13,
-            329.63,
-            349.23,
-            369.99,
-            392.00
-        };
-
-        auto sonifiedValue = v >> 0;
-
-        if (saros.lastValue != sonifiedValue) {
-
+        // The note itself is started by the audio callback (SonifyPhases)
+        if (saros.lastValue != v) {
             if (saros.lastValue != 0) {
-                uint8_t zeroes = 0;
-                uint8_t p = 0;
-                while (true) {
-                    auto d = (sonifiedValue >> (3 * p)) & 7;
-                    p++;
-                    if (d != 0) break;
-                    zeroes++;
-                }
-                auto d0 = (sonifiedValue >> (3 * 0)) & 7;
-                saros.timer = 2.25 + (pow(2, zeroes));
-                if (state.enableSound) {
-
-                    synth.PlayVoice(i, notes[d0], 0.5f, saros.timer, Fractonica::Synth::OscSine, ModulateTone);
-                }
+                saros.timer = NoteDuration(v);
             }
-            saros.lastValue = sonifiedValue;
-
+            saros.lastValue = v;
         }
         if (ImGui::BeginPopupContextItem(name))
         {
             if (ImGui::MenuItem("Delete", "Del")) {
+                const uint8_t slot = sarosPhases.Slot(saros.number);
+                if (slot < ALIVE_SAROS_COUNT) sarosAudible[slot].store(false, std::memory_order_relaxed);
                 sarosNumbers.erase(sarosNumbers.begin() + i);
                 --i;
                 ImGui::EndPopup();